@@ -0,0 +1,270 @@
+#ifndef AIWORKER_H
+#define AIWORKER_H
+
+#include "engine.h"
+#include "kboard.h"
+#include "mcts.h"
+#include "search.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+// Native builds and wasm built with pthreads, where a std::thread is a Web
+// Worker, can think off the UI thread.
+#if !defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__)
+#define TTT_HAS_THREADS 1
+#endif
+
+namespace ttt {
+
+// Bounded queue between exactly one producer and one consumer thread: a
+// push or pop is a slot copy and a release store, no locks. Slots are
+// assigned rather than constructed, so a T holding buffers reuses them.
+template <class T, size_t N>
+class SpscMailbox {
+  T d_slots[N];
+  alignas(64) std::atomic<size_t> d_head;  // next to pop, consumer owned
+  alignas(64) std::atomic<size_t> d_tail;  // next to push, producer owned
+
+ public:
+  SpscMailbox() : d_slots(), d_head(0), d_tail(0) {}
+
+  SpscMailbox(const SpscMailbox &) = delete;
+  SpscMailbox &operator=(const SpscMailbox &) = delete;
+
+  // Producer only; false when full.
+  bool push(const T &value) {
+    const size_t tail = d_tail.load(std::memory_order_relaxed);
+    if (tail - d_head.load(std::memory_order_acquire) == N) {
+      return false;
+    }
+    d_slots[tail % N] = value;
+    d_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer only; false when empty.
+  bool pop(T *value) {
+    const size_t head = d_head.load(std::memory_order_relaxed);
+    if (head == d_tail.load(std::memory_order_acquire)) {
+      return false;
+    }
+    *value = d_slots[head % N];
+    d_head.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool empty() const {
+    return d_head.load(std::memory_order_acquire) ==
+           d_tail.load(std::memory_order_acquire);
+  }
+};
+
+struct AiRequest {
+  uint64_t id;
+  KBoard board;
+  Side side;
+  Level level;
+
+  AiRequest() : id(0), board(), side(SIDE_X), level(LEVEL_EASY) {}
+};
+
+struct AiReply {
+  uint64_t id;
+  EngineMove move;
+  SearchResult search;  // of this move when it came from the search
+  MctsResult mcts;      // of this move when it came from MCTS
+
+  AiReply() : id(0), move(), search(), mcts() {}
+};
+
+// Runs an Engine on its own thread so the UI keeps drawing while the
+// computer thinks: the UI submits positions and polls for moves through a
+// pair of SPSC mailboxes. A cancelled request is aborted if running and its
+// reply never delivered. Without threads each poll thinks on the UI thread
+// for one slice of the move, see Engine::beginMove.
+//
+// The engine belongs to the worker from construction on.
+class AiWorker {
+  static const size_t MAILBOX_SLOTS = 4;
+
+  Engine *d_engine;
+  SpscMailbox<AiRequest, MAILBOX_SLOTS> d_requests;
+  SpscMailbox<AiReply, MAILBOX_SLOTS> d_replies;
+  AiRequest d_outgoing;  // UI thread
+  AiRequest d_current;   // worker thread
+  AiReply d_reply;       // worker thread
+  uint64_t d_lastId;
+  std::atomic<uint64_t> d_cancelled;  // no replies up to this id
+  double d_sliceSeconds;
+#ifdef TTT_HAS_THREADS
+  std::mutex d_mutex;
+  std::condition_variable d_wake;
+  bool d_stop;
+  std::thread d_thread;
+#else
+  bool d_thinking;  // about d_current
+#endif
+
+#ifdef TTT_HAS_THREADS
+  // Answers every queued request.
+  void serve() {
+    while (d_requests.pop(&d_current)) {
+      // cleared before the check, so a cancel from here on aborts it
+      d_engine->clearAbort();
+      if (d_current.id <= d_cancelled.load()) {
+        continue;
+      }
+      d_reply.id = d_current.id;
+      d_reply.move =
+          d_engine->move(d_current.board, d_current.side, d_current.level);
+      d_reply.search = d_engine->lastSearch();
+      d_reply.mcts = d_engine->lastMcts();
+      // the UI holds at most one live request, so this only waits for it
+      // to discard stale replies
+      while (!d_replies.push(d_reply) &&
+             d_current.id > d_cancelled.load()) {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  void run() {
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(d_mutex);
+        d_wake.wait(lock, [this]() { return d_stop || !d_requests.empty(); });
+        if (d_stop) {
+          return;
+        }
+      }
+      serve();
+    }
+  }
+#else
+  // Thinks for one slice about the oldest request that was not cancelled.
+  void slice() {
+    if (d_thinking && d_current.id <= d_cancelled.load()) {
+      d_thinking = false;
+    }
+    while (!d_thinking) {
+      if (!d_requests.pop(&d_current)) {
+        return;
+      }
+      if (d_current.id > d_cancelled.load()) {
+        d_engine->clearAbort();
+        d_engine->beginMove(d_current.board, d_current.side, d_current.level);
+        d_thinking = true;
+      }
+    }
+    if (d_engine->stepMove(d_sliceSeconds, &d_reply.move)) {
+      d_thinking = false;
+      d_reply.id = d_current.id;
+      d_reply.search = d_engine->lastSearch();
+      d_reply.mcts = d_engine->lastMcts();
+      d_replies.push(d_reply);
+    }
+  }
+#endif
+
+ public:
+  explicit AiWorker(Engine *engine)
+      : d_engine(engine),
+        d_requests(),
+        d_replies(),
+        d_outgoing(),
+        d_current(),
+        d_reply(),
+        d_lastId(0),
+        d_cancelled(0),
+        d_sliceSeconds(0)
+#ifdef TTT_HAS_THREADS
+        ,
+        d_mutex(),
+        d_wake(),
+        d_stop(false),
+        d_thread(&AiWorker::run, this)
+#else
+        ,
+        d_thinking(false)
+#endif
+  {
+  }
+
+  ~AiWorker() {
+    cancel();
+#ifdef TTT_HAS_THREADS
+    {
+      std::lock_guard<std::mutex> lock(d_mutex);
+      d_stop = true;
+    }
+    d_wake.notify_one();
+    d_thread.join();
+#endif
+  }
+
+  AiWorker(const AiWorker &) = delete;
+  AiWorker &operator=(const AiWorker &) = delete;
+
+  bool threaded() const {
+#ifdef TTT_HAS_THREADS
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // Think time per poll() when there is no worker thread, which is also
+  // what the frame rate pays for it; 0 thinks the whole move at once.
+  void setSliceSeconds(double seconds) { d_sliceSeconds = seconds; }
+
+  // Asks for a move of side on board; returns the id its reply will carry.
+  uint64_t submit(const KBoard &board, Side side, Level level) {
+    d_outgoing.id = ++d_lastId;
+    d_outgoing.board = board;
+    d_outgoing.side = side;
+    d_outgoing.level = level;
+    while (!d_requests.push(d_outgoing)) {
+      // only cancelled requests can be queued, and they are skipped fast
+#ifdef TTT_HAS_THREADS
+      std::this_thread::yield();
+#else
+      slice();
+#endif
+    }
+#ifdef TTT_HAS_THREADS
+    {
+      std::lock_guard<std::mutex> lock(d_mutex);
+    }
+    d_wake.notify_one();
+#endif
+    return d_lastId;
+  }
+
+  // Drops every submitted request, stopping the one being thought about.
+  void cancel() {
+    d_cancelled.store(d_lastId);
+    d_engine->abort();
+  }
+
+  // The next move of a request that was not cancelled, if one is ready.
+  bool poll(AiReply *reply) {
+#ifndef TTT_HAS_THREADS
+    slice();
+#endif
+    while (d_replies.pop(reply)) {
+      if (reply->id > d_cancelled.load()) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+}  // namespace ttt
+
+#endif  // AIWORKER_H
@@ -0,0 +1,138 @@
+#ifndef ALLOCCOUNT_H
+#define ALLOCCOUNT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// Counts calls of the global operator new per thread, to check that code
+// which should not allocate does not. This replaces the global allocation
+// functions, every form of them, so include it from exactly one translation
+// unit of a program.
+
+namespace ttt {
+
+inline uint64_t &threadAllocations() {
+  static thread_local uint64_t count = 0;
+  return count;
+}
+
+// Allocations made on this thread during the lifetime of the scope.
+class AllocationScope {
+  uint64_t d_start;
+
+ public:
+  AllocationScope() : d_start(threadAllocations()) {}
+
+  uint64_t count() const { return threadAllocations() - d_start; }
+};
+
+namespace alloccount {
+
+// Out of line, so that the compiler does not pair free() with new.
+__attribute__((noinline)) inline void *allocate(std::size_t size,
+                                                std::size_t align) {
+  threadAllocations()++;
+  size = size ? size : 1;
+  if (align <= alignof(std::max_align_t)) {
+    return std::malloc(size);
+  }
+  void *p = 0;
+  return ::posix_memalign(&p, align, size) == 0 ? p : 0;
+}
+
+__attribute__((noinline)) inline void release(void *p) { std::free(p); }
+
+inline void *allocateOrThrow(std::size_t size, std::size_t align) {
+  void *p = allocate(size, align);
+  if (!p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+}  // namespace alloccount
+}  // namespace ttt
+
+void *operator new(std::size_t size) {
+  return ttt::alloccount::allocateOrThrow(size, 0);
+}
+
+void *operator new[](std::size_t size) {
+  return ttt::alloccount::allocateOrThrow(size, 0);
+}
+
+void *operator new(std::size_t size, std::align_val_t align) {
+  return ttt::alloccount::allocateOrThrow(size, std::size_t(align));
+}
+
+void *operator new[](std::size_t size, std::align_val_t align) {
+  return ttt::alloccount::allocateOrThrow(size, std::size_t(align));
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  return ttt::alloccount::allocate(size, 0);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  return ttt::alloccount::allocate(size, 0);
+}
+
+void *operator new(std::size_t size, std::align_val_t align,
+                   const std::nothrow_t &) noexcept {
+  return ttt::alloccount::allocate(size, std::size_t(align));
+}
+
+void *operator new[](std::size_t size, std::align_val_t align,
+                     const std::nothrow_t &) noexcept {
+  return ttt::alloccount::allocate(size, std::size_t(align));
+}
+
+void operator delete(void *p) noexcept { ttt::alloccount::release(p); }
+
+void operator delete[](void *p) noexcept { ttt::alloccount::release(p); }
+
+void operator delete(void *p, std::size_t) noexcept {
+  ttt::alloccount::release(p);
+}
+
+void operator delete[](void *p, std::size_t) noexcept {
+  ttt::alloccount::release(p);
+}
+
+void operator delete(void *p, std::align_val_t) noexcept {
+  ttt::alloccount::release(p);
+}
+
+void operator delete[](void *p, std::align_val_t) noexcept {
+  ttt::alloccount::release(p);
+}
+
+void operator delete(void *p, std::size_t, std::align_val_t) noexcept {
+  ttt::alloccount::release(p);
+}
+
+void operator delete[](void *p, std::size_t, std::align_val_t) noexcept {
+  ttt::alloccount::release(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+  ttt::alloccount::release(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+  ttt::alloccount::release(p);
+}
+
+void operator delete(void *p, std::align_val_t,
+                     const std::nothrow_t &) noexcept {
+  ttt::alloccount::release(p);
+}
+
+void operator delete[](void *p, std::align_val_t,
+                       const std::nothrow_t &) noexcept {
+  ttt::alloccount::release(p);
+}
+
+#endif  // ALLOCCOUNT_H
@@ -0,0 +1,65 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace ttt {
+
+// Bump allocator over one fixed buffer: allocation is a pointer increment,
+// everything is released at once by reset() and nothing is destroyed, so
+// only trivially destructible objects belong here. The buffer is allocated
+// on first use and never grows; allocate() returns 0 once it is full.
+class Arena {
+  std::unique_ptr<unsigned char[]> d_buffer;
+  size_t d_capacity;
+  size_t d_used;
+
+ public:
+  explicit Arena(size_t bytes) : d_capacity(bytes), d_used(0) {}
+
+  Arena(const Arena &) = delete;
+  Arena &operator=(const Arena &) = delete;
+
+  // Drops every allocation. Takes effect on the next reset().
+  void setCapacity(size_t bytes) {
+    if (bytes != d_capacity) {
+      d_buffer.reset();
+      d_capacity = bytes;
+    }
+  }
+
+  void reset() {
+    if (!d_buffer && d_capacity) {
+      d_buffer.reset(new unsigned char[d_capacity]);
+    }
+    d_used = 0;
+  }
+
+  size_t capacity() const { return d_capacity; }
+
+  size_t used() const { return d_used; }
+
+  // Default-constructed array of n objects, or 0 when the arena is full.
+  template <class T>
+  T *allocate(size_t n) {
+    const size_t align = alignof(T);
+    const uintptr_t base = reinterpret_cast<uintptr_t>(d_buffer.get());
+    const size_t offset = ((base + d_used + align - 1) & ~(align - 1)) - base;
+    if (!d_buffer || offset + n * sizeof(T) > d_capacity) {
+      return 0;
+    }
+    d_used = offset + n * sizeof(T);
+    T *p = reinterpret_cast<T *>(d_buffer.get() + offset);
+    for (size_t i = 0; i < n; i++) {
+      new (p + i) T();
+    }
+    return p;
+  }
+};
+
+}  // namespace ttt
+
+#endif  // ARENA_H
@@ -0,0 +1,141 @@
+// Boards/sec of the batched 3x3 win, draw and legal-move kernels: every
+// kernel available on this machine evaluates the same random positions,
+// checked against the scalar reference. No SDL; builds natively and, with
+// the simd128 kernel, under Emscripten for node.
+
+#include "batcheval.h"
+#include "bitboard.h"
+#include "ttable.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options {
+  size_t boards;
+  double seconds;  // per kernel
+  uint64_t seed;
+};
+
+void usage() {
+  fprintf(stderr,
+          "usage: batch-bench [options]\n"
+          "  --boards N    positions per batch (1048576)\n"
+          "  --seconds S   time per kernel (1)\n"
+          "  --seed N      random seed (1)\n");
+}
+
+bool parseArgs(int argc, char **argv, Options *o) {
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char *value = argv[++i];
+    if (arg == "--boards") {
+      o->boards = size_t(strtoull(value, 0, 10));
+    } else if (arg == "--seconds") {
+      o->seconds = atof(value);
+    } else if (arg == "--seed") {
+      o->seed = strtoull(value, 0, 10);
+    } else {
+      return false;
+    }
+  }
+  return o->boards > 0;
+}
+
+// Positions of random games stopped after a random number of moves, so
+// every status shows up.
+void randomPositions(const Options &o, std::vector<ttt::Mask> *xs,
+                     std::vector<ttt::Mask> *os) {
+  uint64_t rng = o.seed;
+  xs->resize(o.boards);
+  os->resize(o.boards);
+  for (size_t i = 0; i < o.boards; i++) {
+    ttt::BitBoard b;
+    const int moves = int(ttt::splitMix64(&rng) % (ttt::BOARD_CELLS + 1));
+    ttt::Side s = ttt::SIDE_X;
+    for (int m = 0; m < moves; m++) {
+      const ttt::Mask empty = b.empty();
+      const int n = int(ttt::splitMix64(&rng) % ttt::popCount(empty));
+      b.set(ttt::nthCell(empty, n), s);
+      if (b.winnerLine(s) >= 0) {
+        break;
+      }
+      s = ttt::otherSide(s);
+    }
+    (*xs)[i] = b.bits[ttt::SIDE_X];
+    (*os)[i] = b.bits[ttt::SIDE_O];
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options o;
+  o.boards = 1 << 20;
+  o.seconds = 1;
+  o.seed = 1;
+  if (!parseArgs(argc, argv, &o)) {
+    usage();
+    return 1;
+  }
+
+  std::vector<ttt::Mask> xs;
+  std::vector<ttt::Mask> os;
+  randomPositions(o, &xs, &os);
+  std::vector<uint8_t> refStatus(o.boards);
+  std::vector<ttt::Mask> refLegal(o.boards);
+  ttt::evaluateBatch(xs.data(), os.data(), o.boards, refStatus.data(),
+                     refLegal.data(), ttt::BATCH_SCALAR);
+  uint64_t counts[4] = {};
+  for (uint8_t s : refStatus) {
+    counts[s]++;
+  }
+  printf("boards       %zu: %llu open, %llu X won, %llu O won, %llu draws\n",
+         o.boards, (unsigned long long)counts[ttt::STATUS_OPEN],
+         (unsigned long long)counts[ttt::STATUS_X_WON],
+         (unsigned long long)counts[ttt::STATUS_O_WON],
+         (unsigned long long)counts[ttt::STATUS_DRAW]);
+  printf("%8s %14s %10s\n", "kernel", "boards/s", "speedup");
+
+  std::vector<uint8_t> status(o.boards);
+  std::vector<ttt::Mask> legal(o.boards);
+  double baseRate = 0;
+  bool ok = true;
+  for (int k = 0; k < ttt::NUM_BATCH_KERNELS; k++) {
+    const ttt::BatchKernel kernel = ttt::BatchKernel(k);
+    if (!ttt::batchKernelAvailable(kernel)) {
+      continue;
+    }
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point start = Clock::now();
+    double seconds = 0;
+    uint64_t boards = 0;
+    do {
+      ttt::evaluateBatch(xs.data(), os.data(), o.boards, status.data(),
+                         legal.data(), kernel);
+      boards += o.boards;
+      seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (seconds < o.seconds);
+
+    if (memcmp(status.data(), refStatus.data(), o.boards) != 0 ||
+        memcmp(legal.data(), refLegal.data(),
+               o.boards * sizeof(ttt::Mask)) != 0) {
+      printf("%8s differs from scalar\n", ttt::batchKernelName(kernel));
+      ok = false;
+      continue;
+    }
+    const double rate = boards / seconds;
+    baseRate = kernel == ttt::BATCH_SCALAR ? rate : baseRate;
+    printf("%8s %14.0f %10.2f\n", ttt::batchKernelName(kernel), rate,
+           baseRate > 0 ? rate / baseRate : 0);
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,247 @@
+#ifndef BATCHEVAL_H
+#define BATCHEVAL_H
+
+#include "bitboard.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define TTT_BATCH_SSE2 1
+#endif
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <immintrin.h>
+// compiled for AVX2 per function, picked at run time
+#define TTT_BATCH_AVX2 1
+#endif
+#if defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define TTT_BATCH_SIMD128 1
+#endif
+
+// Win, draw and legal-move tests of many 3x3 positions at once, for
+// offline analysis. Positions come as structure of arrays, x[i] and o[i]
+// the masks of board i, so a vector register holds the same side of 8 or
+// 16 boards and every win mask is tested against all of them with one
+// and/compare; there are no branches per board.
+
+namespace ttt {
+
+enum BoardStatus {
+  STATUS_OPEN = 0,
+  STATUS_X_WON = 1 + SIDE_X,
+  STATUS_O_WON = 1 + SIDE_O,
+  STATUS_DRAW = 3
+};
+
+enum BatchKernel {
+  BATCH_SCALAR,
+  BATCH_SSE2,
+  BATCH_AVX2,
+  BATCH_SIMD128,
+  NUM_BATCH_KERNELS
+};
+
+inline const char *batchKernelName(BatchKernel k) {
+  static const char *const NAMES[NUM_BATCH_KERNELS] = {"scalar", "sse2",
+                                                       "avx2", "simd128"};
+  return NAMES[k];
+}
+
+// Compiled in and, for AVX2, supported by this CPU.
+inline bool batchKernelAvailable(BatchKernel k) {
+  switch (k) {
+    case BATCH_SCALAR:
+      return true;
+#ifdef TTT_BATCH_SSE2
+    case BATCH_SSE2:
+      return true;
+#endif
+#ifdef TTT_BATCH_AVX2
+    case BATCH_AVX2:
+      return __builtin_cpu_supports("avx2");
+#endif
+#ifdef TTT_BATCH_SIMD128
+    case BATCH_SIMD128:
+      return true;
+#endif
+    default:
+      return false;
+  }
+}
+
+inline BatchKernel bestBatchKernel() {
+  for (int k = NUM_BATCH_KERNELS - 1; k > BATCH_SCALAR; k--) {
+    if (batchKernelAvailable(BatchKernel(k))) {
+      return BatchKernel(k);
+    }
+  }
+  return BATCH_SCALAR;
+}
+
+// The reference kernel, a board at a time. X is tested first, as the game
+// does; a finished game has no legal moves.
+inline void evaluateBatchScalar(const Mask *x, const Mask *o, size_t n,
+                                uint8_t *status, Mask *legal) {
+  for (size_t i = 0; i < n; i++) {
+    int wonX = 0;
+    int wonO = 0;
+    for (int w = 0; w < NUM_WIN_MASKS; w++) {
+      wonX |= (x[i] & WIN_MASKS[w]) == WIN_MASKS[w];
+      wonO |= (o[i] & WIN_MASKS[w]) == WIN_MASKS[w];
+    }
+    const Mask occupied = Mask(x[i] | o[i]);
+    const int full = occupied == FULL_MASK;
+    status[i] = uint8_t(wonX ? STATUS_X_WON
+                             : (wonO ? STATUS_O_WON
+                                     : (full ? STATUS_DRAW : STATUS_OPEN)));
+    legal[i] = wonX | wonO ? 0 : Mask(~occupied & FULL_MASK);
+  }
+}
+
+#ifdef TTT_BATCH_SSE2
+// 8 boards per step.
+inline void evaluateBatchSse2(const Mask *x, const Mask *o, size_t n,
+                              uint8_t *status, Mask *legal) {
+  const __m128i full = _mm_set1_epi16(FULL_MASK);
+  const __m128i xWon = _mm_set1_epi16(STATUS_X_WON);
+  const __m128i oWon = _mm_set1_epi16(STATUS_O_WON);
+  const __m128i draw = _mm_set1_epi16(STATUS_DRAW);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    const __m128i vx = _mm_loadu_si128((const __m128i *)(x + i));
+    const __m128i vo = _mm_loadu_si128((const __m128i *)(o + i));
+    __m128i wonX = _mm_setzero_si128();
+    __m128i wonO = _mm_setzero_si128();
+    for (int w = 0; w < NUM_WIN_MASKS; w++) {
+      const __m128i m = _mm_set1_epi16(short(WIN_MASKS[w]));
+      wonX = _mm_or_si128(wonX, _mm_cmpeq_epi16(_mm_and_si128(vx, m), m));
+      wonO = _mm_or_si128(wonO, _mm_cmpeq_epi16(_mm_and_si128(vo, m), m));
+    }
+    const __m128i occupied = _mm_or_si128(vx, vo);
+    const __m128i won = _mm_or_si128(wonX, wonO);
+    const __m128i isFull = _mm_cmpeq_epi16(occupied, full);
+    __m128i s = _mm_and_si128(wonX, xWon);
+    s = _mm_or_si128(s, _mm_andnot_si128(wonX, _mm_and_si128(wonO, oWon)));
+    s = _mm_or_si128(s, _mm_andnot_si128(won, _mm_and_si128(isFull, draw)));
+    _mm_storel_epi64((__m128i *)(status + i), _mm_packus_epi16(s, s));
+    _mm_storeu_si128((__m128i *)(legal + i),
+                     _mm_andnot_si128(won, _mm_andnot_si128(occupied, full)));
+  }
+  evaluateBatchScalar(x + i, o + i, n - i, status + i, legal + i);
+}
+#endif
+
+#ifdef TTT_BATCH_AVX2
+// 16 boards per step.
+__attribute__((target("avx2"))) inline void evaluateBatchAvx2(
+    const Mask *x, const Mask *o, size_t n, uint8_t *status, Mask *legal) {
+  const __m256i full = _mm256_set1_epi16(FULL_MASK);
+  const __m256i xWon = _mm256_set1_epi16(STATUS_X_WON);
+  const __m256i oWon = _mm256_set1_epi16(STATUS_O_WON);
+  const __m256i draw = _mm256_set1_epi16(STATUS_DRAW);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    const __m256i vx = _mm256_loadu_si256((const __m256i *)(x + i));
+    const __m256i vo = _mm256_loadu_si256((const __m256i *)(o + i));
+    __m256i wonX = _mm256_setzero_si256();
+    __m256i wonO = _mm256_setzero_si256();
+    for (int w = 0; w < NUM_WIN_MASKS; w++) {
+      const __m256i m = _mm256_set1_epi16(short(WIN_MASKS[w]));
+      wonX = _mm256_or_si256(wonX,
+                             _mm256_cmpeq_epi16(_mm256_and_si256(vx, m), m));
+      wonO = _mm256_or_si256(wonO,
+                             _mm256_cmpeq_epi16(_mm256_and_si256(vo, m), m));
+    }
+    const __m256i occupied = _mm256_or_si256(vx, vo);
+    const __m256i won = _mm256_or_si256(wonX, wonO);
+    const __m256i isFull = _mm256_cmpeq_epi16(occupied, full);
+    __m256i s = _mm256_and_si256(wonX, xWon);
+    s = _mm256_or_si256(
+        s, _mm256_andnot_si256(wonX, _mm256_and_si256(wonO, oWon)));
+    s = _mm256_or_si256(
+        s, _mm256_andnot_si256(won, _mm256_and_si256(isFull, draw)));
+    // the pack works within 128-bit lanes, so pack the halves instead
+    _mm_storeu_si128((__m128i *)(status + i),
+                     _mm_packus_epi16(_mm256_castsi256_si128(s),
+                                      _mm256_extracti128_si256(s, 1)));
+    _mm256_storeu_si256(
+        (__m256i *)(legal + i),
+        _mm256_andnot_si256(won, _mm256_andnot_si256(occupied, full)));
+  }
+  evaluateBatchScalar(x + i, o + i, n - i, status + i, legal + i);
+}
+#endif
+
+#ifdef TTT_BATCH_SIMD128
+// 8 boards per step. Note wasm_v128_andnot(a, b) is a & ~b.
+inline void evaluateBatchSimd128(const Mask *x, const Mask *o, size_t n,
+                                 uint8_t *status, Mask *legal) {
+  const v128_t full = wasm_i16x8_splat(FULL_MASK);
+  const v128_t xWon = wasm_i16x8_splat(STATUS_X_WON);
+  const v128_t oWon = wasm_i16x8_splat(STATUS_O_WON);
+  const v128_t draw = wasm_i16x8_splat(STATUS_DRAW);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    const v128_t vx = wasm_v128_load(x + i);
+    const v128_t vo = wasm_v128_load(o + i);
+    v128_t wonX = wasm_i16x8_splat(0);
+    v128_t wonO = wasm_i16x8_splat(0);
+    for (int w = 0; w < NUM_WIN_MASKS; w++) {
+      const v128_t m = wasm_i16x8_splat(short(WIN_MASKS[w]));
+      wonX = wasm_v128_or(wonX, wasm_i16x8_eq(wasm_v128_and(vx, m), m));
+      wonO = wasm_v128_or(wonO, wasm_i16x8_eq(wasm_v128_and(vo, m), m));
+    }
+    const v128_t occupied = wasm_v128_or(vx, vo);
+    const v128_t won = wasm_v128_or(wonX, wonO);
+    const v128_t isFull = wasm_i16x8_eq(occupied, full);
+    v128_t s = wasm_v128_and(wonX, xWon);
+    s = wasm_v128_or(s, wasm_v128_andnot(wasm_v128_and(wonO, oWon), wonX));
+    s = wasm_v128_or(s, wasm_v128_andnot(wasm_v128_and(isFull, draw), won));
+    wasm_v128_store64_lane(status + i, wasm_u8x16_narrow_i16x8(s, s), 0);
+    wasm_v128_store(legal + i,
+                    wasm_v128_andnot(wasm_v128_andnot(full, occupied), won));
+  }
+  evaluateBatchScalar(x + i, o + i, n - i, status + i, legal + i);
+}
+#endif
+
+// status[i] is the BoardStatus of x[i], o[i] and legal[i] its empty cells
+// while the game is open. A kernel that is not available runs as scalar.
+inline void evaluateBatch(const Mask *x, const Mask *o, size_t n,
+                          uint8_t *status, Mask *legal, BatchKernel kernel) {
+  if (!batchKernelAvailable(kernel)) {
+    kernel = BATCH_SCALAR;
+  }
+  switch (kernel) {
+#ifdef TTT_BATCH_SSE2
+    case BATCH_SSE2:
+      evaluateBatchSse2(x, o, n, status, legal);
+      return;
+#endif
+#ifdef TTT_BATCH_AVX2
+    case BATCH_AVX2:
+      evaluateBatchAvx2(x, o, n, status, legal);
+      return;
+#endif
+#ifdef TTT_BATCH_SIMD128
+    case BATCH_SIMD128:
+      evaluateBatchSimd128(x, o, n, status, legal);
+      return;
+#endif
+    default:
+      evaluateBatchScalar(x, o, n, status, legal);
+  }
+}
+
+// With the fastest kernel of this machine.
+inline void evaluateBatch(const Mask *x, const Mask *o, size_t n,
+                          uint8_t *status, Mask *legal) {
+  static const BatchKernel best = bestBatchKernel();
+  evaluateBatch(x, o, n, status, legal, best);
+}
+
+}  // namespace ttt
+
+#endif  // BATCHEVAL_H
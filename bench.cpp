@@ -0,0 +1,450 @@
+// Micro-benchmarks of the hot paths: the win check, the hard and random
+// engine moves, the C API of tttapi.h a board per call and 10k boards per
+// call and, when built with the SDL game, text drawing and whole game loop
+// frames against SDL's dummy video driver. Prints a table and
+// writes one JSON object per benchmark with --json; --baseline compares
+// against such a file and fails on regressions.
+
+#include "engine.h"
+#include "histogram.h"
+#include "kboard.h"
+#include "ttable.h"
+#include "tttapi.h"
+#ifdef TTT_BENCH_GAME
+// the game class itself, its main() left out
+#include "wasm-tic-tac-toe.cpp"
+#endif
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct Options {
+  double seconds;  // per benchmark
+  std::string filter;
+  std::string jsonPath;
+  std::string baselinePath;
+  double tolerance;  // slowdown over the baseline that fails
+  uint64_t seed;
+};
+
+struct Result {
+  std::string name;
+  uint64_t ops;
+  double nsPerOp;
+  uint64_t p50;  // of batch averages, ns per op
+  uint64_t p99;
+  int items;  // boards per op
+};
+
+// Positions a benchmark cycles through.
+const int POSITIONS = 256;
+// Boards per call of the batched C API benchmarks.
+const int API_BATCH = 10000;
+// Shortest timed batch; shorter operations run several times per batch.
+const uint64_t MIN_BATCH_NANOS = 20000;
+
+// Results end up here, so the compiler cannot drop the work.
+volatile int benchSink;
+
+void usage() {
+  fprintf(stderr,
+          "usage: tic-tac-toe-bench [options]\n"
+          "  --seconds S        time per benchmark (0.5)\n"
+          "  --filter TEXT      only benchmarks whose name contains TEXT\n"
+          "  --json PATH        write the results as JSON lines\n"
+          "  --baseline PATH    compare medians with an earlier --json file,\n"
+          "                     fail when any benchmark got slower\n"
+          "  --tolerance X      slowdown ratio that fails (1.2)\n"
+          "  --seed N           random seed (1)\n");
+}
+
+bool parseArgs(int argc, char **argv, Options *o) {
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char *value = argv[++i];
+    if (arg == "--seconds") {
+      o->seconds = atof(value);
+    } else if (arg == "--filter") {
+      o->filter = value;
+    } else if (arg == "--json") {
+      o->jsonPath = value;
+    } else if (arg == "--baseline") {
+      o->baselinePath = value;
+    } else if (arg == "--tolerance") {
+      o->tolerance = atof(value);
+    } else if (arg == "--seed") {
+      o->seed = strtoull(value, 0, 10);
+    } else {
+      return false;
+    }
+  }
+  return o->seconds > 0 && o->tolerance > 0;
+}
+
+uint64_t nanosSince(Clock::time_point start) {
+  return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      Clock::now() - start)
+                      .count());
+}
+
+// Runs op(i) with i counting up, in batches of at least MIN_BATCH_NANOS,
+// for o.seconds. Each op handles items boards.
+template <class Op>
+void run(const Options &o, const char *name, Op op,
+         std::vector<Result> *results, int items = 1) {
+  if (std::string(name).find(o.filter) == std::string::npos) {
+    return;
+  }
+  uint64_t i = 0;
+  uint64_t batch = 1;
+  for (;;) {
+    const Clock::time_point t0 = Clock::now();
+    for (uint64_t b = 0; b < batch; b++) {
+      op(i++);
+    }
+    if (nanosSince(t0) >= MIN_BATCH_NANOS) {
+      break;
+    }
+    batch *= 2;
+  }
+  ttt::Histogram h;
+  uint64_t ops = 0;
+  uint64_t nanos = 0;
+  const uint64_t limit = uint64_t(o.seconds * 1e9);
+  while (nanos < limit) {
+    const Clock::time_point t0 = Clock::now();
+    for (uint64_t b = 0; b < batch; b++) {
+      op(i++);
+    }
+    const uint64_t n = nanosSince(t0);
+    h.record(n / batch);
+    nanos += n;
+    ops += batch;
+  }
+  const Result r = {name, ops, double(nanos) / double(ops), h.percentile(50),
+                    h.percentile(99), items};
+  printf("%-28s %12llu %12.1f %10llu %10llu %12.0f\n", name,
+         (unsigned long long)ops, r.nsPerOp, (unsigned long long)r.p50,
+         (unsigned long long)r.p99, items * 1e9 / r.nsPerOp);
+  fflush(stdout);
+  results->push_back(r);
+}
+
+// Positions of random games stopped after a random number of moves, each
+// with its last move and who made it; none is over.
+struct Position {
+  ttt::KBoard board;
+  int last;
+  ttt::Side mover;
+};
+
+std::vector<Position> randomPositions(const ttt::Rules &rules, int maxMoves,
+                                      uint64_t seed, int count = POSITIONS) {
+  std::vector<Position> positions;
+  uint64_t rng = seed;
+  while (positions.size() < size_t(count)) {
+    Position p = {ttt::KBoard(rules), -1, ttt::SIDE_O};
+    const int moves = 1 + int(ttt::splitMix64(&rng) % uint64_t(maxMoves));
+    bool over = false;
+    for (int m = 0; m < moves && !over && !p.board.isFull(); m++) {
+      p.mover = ttt::otherSide(p.mover);
+      p.last = p.board.nthEmpty(
+          int(ttt::splitMix64(&rng) % uint64_t(p.board.emptyCount())));
+      p.board.play(p.last, p.mover);
+      over = p.board.lineThrough(p.last, p.mover, 0);
+    }
+    if (!over && !p.board.isFull()) {
+      positions.push_back(p);
+    }
+  }
+  return positions;
+}
+
+void engineBenchmarks(const Options &o, std::vector<Result> *results) {
+  const std::vector<Position> small =
+      randomPositions(ttt::RULES_3X3, 7, o.seed);
+  const std::vector<Position> large =
+      randomPositions(ttt::RULES_15X15, 12, o.seed);
+  const std::vector<Position> huge =
+      randomPositions(ttt::RULES_19X19, 40, o.seed);
+  int sink = 0;
+  ttt::Line line;
+
+  run(o, "win_check_3x3",
+      [&](uint64_t i) {
+        const Position &p = small[i % POSITIONS];
+        sink += p.board.lineThrough(p.last, p.mover, &line);
+      },
+      results);
+  run(o, "win_check_19x19",
+      [&](uint64_t i) {
+        const Position &p = huge[i % POSITIONS];
+        sink += p.board.lineThrough(p.last, p.mover, &line);
+      },
+      results);
+
+  // a small table, cleared per move, so every move searches the same
+  ttt::Engine engine(256 << 10, o.seed, ttt::SearchLimits{2, 0, 0});
+  run(o, "advanced_move_3x3",
+      [&](uint64_t i) {
+        const Position &p = small[i % POSITIONS];
+        sink += engine.advancedMove(p.board, ttt::otherSide(p.mover)).move;
+      },
+      results);
+  run(o, "advanced_move_15x15_depth2",
+      [&](uint64_t i) {
+        const Position &p = large[i % POSITIONS];
+        engine.transpositionTable().clear();
+        sink += engine.advancedMove(p.board, ttt::otherSide(p.mover)).move;
+      },
+      results);
+  run(o, "random_move_3x3",
+      [&](uint64_t i) {
+        sink += engine.randomMove(small[i % POSITIONS].board).move;
+      },
+      results);
+  run(o, "random_move_19x19",
+      [&](uint64_t i) {
+        sink += engine.randomMove(huge[i % POSITIONS].board).move;
+      },
+      results);
+  benchSink = sink;
+}
+
+// The C API on the same boards, one call per board against API_BATCH
+// boards per call.
+void apiBenchmarks(const Options &o, std::vector<Result> *results) {
+  const std::vector<Position> small =
+      randomPositions(ttt::RULES_3X3, 7, o.seed, API_BATCH);
+  const std::vector<Position> large =
+      randomPositions(ttt::RULES_15X15, 40, o.seed, API_BATCH);
+  std::vector<uint16_t> xs(API_BATCH);
+  std::vector<uint16_t> os(API_BATCH);
+  std::vector<uint16_t> mine(API_BATCH);
+  std::vector<uint16_t> theirs(API_BATCH);
+  std::vector<uint8_t> cells3(size_t(API_BATCH) * 9);
+  std::vector<uint8_t> toMove(API_BATCH);
+  std::vector<uint8_t> cells15(size_t(API_BATCH) * 225);
+  for (int i = 0; i < API_BATCH; i++) {
+    const ttt::KBoard &b = small[i].board;
+    const ttt::Side next = ttt::otherSide(small[i].mover);
+    xs[i] = uint16_t(b.bits(ttt::SIDE_X, 0));
+    os[i] = uint16_t(b.bits(ttt::SIDE_O, 0));
+    mine[i] = uint16_t(b.bits(next, 0));
+    theirs[i] = uint16_t(b.bits(small[i].mover, 0));
+    toMove[i] = uint8_t(1 + next);
+    for (int c = 0; c < 9; c++) {
+      cells3[size_t(i) * 9 + c] = uint8_t(
+          b.has(c, ttt::SIDE_X) ? 1 : (b.has(c, ttt::SIDE_O) ? 2 : 0));
+    }
+    const ttt::KBoard &l = large[i].board;
+    for (int c = 0; c < 225; c++) {
+      cells15[size_t(i) * 225 + c] = uint8_t(
+          l.has(c, ttt::SIDE_X) ? 1 : (l.has(c, ttt::SIDE_O) ? 2 : 0));
+    }
+  }
+  std::vector<uint8_t> status(API_BATCH);
+  std::vector<uint16_t> legal(API_BATCH);
+  std::vector<int8_t> move(API_BATCH);
+  std::vector<int8_t> value(API_BATCH);
+  std::vector<uint8_t> distance(API_BATCH);
+  std::vector<int32_t> best(API_BATCH);
+  std::vector<int32_t> score(API_BATCH);
+  ttt_engine *engine = ttt_engine_new(256 << 10, uint32_t(o.seed), 2, 0);
+
+  run(o, "api_evaluate_3x3_x1",
+      [&](uint64_t i) {
+        const size_t j = size_t(i % API_BATCH);
+        ttt_evaluate_3x3(&xs[j], &os[j], 1, &status[j], &legal[j]);
+      },
+      results);
+  run(o, "api_evaluate_3x3_x10000",
+      [&](uint64_t) {
+        ttt_evaluate_3x3(xs.data(), os.data(), API_BATCH, status.data(),
+                         legal.data());
+      },
+      results, API_BATCH);
+  run(o, "api_solve_3x3_x1",
+      [&](uint64_t i) {
+        const size_t j = size_t(i % API_BATCH);
+        ttt_solve_3x3(&mine[j], &theirs[j], 1, &move[j], &value[j],
+                      &distance[j]);
+      },
+      results);
+  run(o, "api_solve_3x3_x10000",
+      [&](uint64_t) {
+        ttt_solve_3x3(mine.data(), theirs.data(), API_BATCH, move.data(),
+                      value.data(), distance.data());
+      },
+      results, API_BATCH);
+  run(o, "api_status_15x15_x1",
+      [&](uint64_t i) {
+        const size_t j = size_t(i % API_BATCH);
+        ttt_status(15, 15, 5, &cells15[j * 225], 1, &status[j]);
+      },
+      results);
+  run(o, "api_status_15x15_x10000",
+      [&](uint64_t) {
+        ttt_status(15, 15, 5, cells15.data(), API_BATCH, status.data());
+      },
+      results, API_BATCH);
+  run(o, "api_best_move_3x3_x1",
+      [&](uint64_t i) {
+        const size_t j = size_t(i % API_BATCH);
+        ttt_best_moves(engine, TTT_HARD, 3, 3, 3, &cells3[j * 9], &toMove[j],
+                       1, &best[j], &score[j]);
+      },
+      results);
+  run(o, "api_best_move_3x3_x10000",
+      [&](uint64_t) {
+        ttt_best_moves(engine, TTT_HARD, 3, 3, 3, cells3.data(),
+                       toMove.data(), API_BATCH, best.data(), score.data());
+      },
+      results, API_BATCH);
+  ttt_engine_free(engine);
+}
+
+#ifdef TTT_BENCH_GAME
+void pushEvent(Uint32 type, SDL_Keycode sym) {
+  SDL_Event e;
+  memset(&e, 0, sizeof(e));
+  e.type = type;
+  e.key.keysym.sym = sym;
+  ::SDL_PushEvent(&e);
+}
+
+// One game loop iteration per key, as if typed.
+void typeKeys(TicTacToe *game, const char *keys) {
+  for (; *keys; keys++) {
+    pushEvent(SDL_KEYDOWN, SDL_Keycode(*keys));
+    game->gameLoop();
+  }
+}
+
+// A window event marks the frame dirty, so every iteration draws.
+void frame(TicTacToe *game) {
+  pushEvent(SDL_WINDOWEVENT, 0);
+  game->gameLoop();
+}
+
+// The game headless: SDL's dummy video driver and software renderer.
+bool gameBenchmarks(const Options &o, std::vector<Result> *results) {
+  ::SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+  TicTacToe game;
+  if (game.initialize() != 0) {
+    fprintf(stderr, "tic-tac-toe-bench: no headless SDL renderer\n");
+    return false;
+  }
+  run(o, "text_centered",
+      [&](uint64_t) {
+        game.textCentered("Press the SpaceBar to Play", 360, 90);
+      },
+      results);
+  run(o, "frame_splash", [&](uint64_t) { frame(&game); }, results);
+  // human first on an empty 3x3 board, then on 100x100
+  typeKeys(&game, "p ");
+  run(o, "frame_3x3", [&](uint64_t) { frame(&game); }, results);
+  typeKeys(&game, "qbbbb ");
+  run(o, "frame_100x100", [&](uint64_t) { frame(&game); }, results);
+  game.finalize();
+  return true;
+}
+#endif
+
+void writeJson(const std::string &path, const std::vector<Result> &results) {
+  FILE *f = fopen(path.c_str(), "w");
+  if (!f) {
+    perror(path.c_str());
+    return;
+  }
+  for (const Result &r : results) {
+    fprintf(f,
+            "{\"name\":\"%s\",\"ops\":%llu,\"ns_per_op\":%.3f,"
+            "\"p50_ns\":%llu,\"p99_ns\":%llu,\"items_per_op\":%d,"
+            "\"items_per_s\":%.0f}\n",
+            r.name.c_str(), (unsigned long long)r.ops, r.nsPerOp,
+            (unsigned long long)r.p50, (unsigned long long)r.p99, r.items,
+            r.items * 1e9 / r.nsPerOp);
+  }
+  fclose(f);
+}
+
+// False when the median of a benchmark of the baseline file is now more
+// than tolerance times higher; medians shrug off the odd preempted batch.
+bool compare(const Options &o, const std::vector<Result> &results) {
+  FILE *f = fopen(o.baselinePath.c_str(), "r");
+  if (!f) {
+    perror(o.baselinePath.c_str());
+    return false;
+  }
+  printf("\n%-28s %12s %12s %8s\n", "versus baseline", "was p50", "now p50",
+         "ratio");
+  bool ok = true;
+  char line[512];
+  while (fgets(line, sizeof(line), f)) {
+    char name[128];
+    unsigned long long ops = 0;
+    double nsPerOp = 0;
+    unsigned long long was = 0;
+    if (sscanf(line,
+               "{\"name\":\"%127[^\"]\",\"ops\":%llu,\"ns_per_op\":%lf,"
+               "\"p50_ns\":%llu",
+               name, &ops, &nsPerOp, &was) != 4 ||
+        was == 0) {
+      continue;
+    }
+    for (const Result &r : results) {
+      if (r.name == name) {
+        const double ratio = double(r.p50) / double(was);
+        const bool slower = ratio > o.tolerance;
+        ok = ok && !slower;
+        printf("%-28s %12llu %12llu %8.2f%s\n", name, was,
+               (unsigned long long)r.p50, ratio, slower ? "  REGRESSION" : "");
+      }
+    }
+  }
+  fclose(f);
+  return ok;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options o;
+  o.seconds = 0.5;
+  o.tolerance = 1.2;
+  o.seed = 1;
+  if (!parseArgs(argc, argv, &o)) {
+    usage();
+    return 1;
+  }
+
+  std::vector<Result> results;
+  printf("%-28s %12s %12s %10s %10s %12s\n", "benchmark", "ops", "ns/op",
+         "p50 ns", "p99 ns", "boards/s");
+  engineBenchmarks(o, &results);
+  apiBenchmarks(o, &results);
+#ifdef TTT_BENCH_GAME
+  if (!gameBenchmarks(o, &results)) {
+    return 1;
+  }
+#endif
+  if (!o.jsonPath.empty()) {
+    writeJson(o.jsonPath, results);
+  }
+  if (!o.baselinePath.empty() && !compare(o, results)) {
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,117 @@
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <cstdint>
+
+namespace ttt {
+
+// A 3x3 position packed as one 9-bit mask per side. Bit i is the cell at
+// col = i % 3, row = i / 3, matching TicTacToe::boardIndex():
+// 0[0,0], 1[1,0], 2[2,0]
+// 3[0,1], 4[1,1], 5[2,1]
+// 6[0,2], 7[1,2], 8[2,2]
+typedef uint16_t Mask;
+
+enum Side { SIDE_X = 0, SIDE_O = 1 };
+
+inline Side otherSide(Side s) { return s == SIDE_X ? SIDE_O : SIDE_X; }
+
+const int BOARD_CELLS = 9;
+const int NUM_WIN_MASKS = 8;
+
+constexpr Mask FULL_MASK = 0x1ff;
+constexpr Mask CORNER_MASK = 0x145;  // 0, 2, 6, 8
+constexpr Mask CENTER_MASK = 0x010;  // 4
+constexpr Mask SIDE_MASK = 0x0aa;    // 1, 3, 5, 7
+
+// Same order as TicTacToe::WinnerLine, without NONE.
+constexpr Mask WIN_MASKS[NUM_WIN_MASKS] = {
+    0x049,  // VERTICAL_LEFT       0, 3, 6
+    0x092,  // VERTICAL_MID        1, 4, 7
+    0x124,  // VERTICAL_RIGHT      2, 5, 8
+    0x007,  // HORIZONTAL_TOP      0, 1, 2
+    0x038,  // HORIZONTAL_MID      3, 4, 5
+    0x1c0,  // HORIZONTAL_BOTTOM   6, 7, 8
+    0x111,  // DIAGONAL_TOPLEFT    0, 4, 8
+    0x054,  // DIAGONAL_BOTTOMLEFT 6, 4, 2
+};
+
+constexpr Mask cellMask(int idx) { return Mask(1u << idx); }
+
+inline int popCount(Mask m) { return __builtin_popcount(m); }
+
+// Index of the lowest set bit; m must not be zero.
+inline int lowestCell(Mask m) { return __builtin_ctz(m); }
+
+inline Mask dropLowest(Mask m) { return Mask(m & (m - 1)); }
+
+// Index of the n-th (0-based) set bit; n must be below popCount(m).
+inline int nthCell(Mask m, int n) {
+  while (n-- > 0) {
+    m = dropLowest(m);
+  }
+  return lowestCell(m);
+}
+
+// Index into WIN_MASKS of the first completed line in m, or -1.
+constexpr int winnerLine(Mask m) {
+  for (int i = 0; i < NUM_WIN_MASKS; i++) {
+    if ((m & WIN_MASKS[i]) == WIN_MASKS[i]) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+constexpr bool hasLine(Mask m) { return winnerLine(m) >= 0; }
+
+struct BitBoard {
+  Mask bits[2];
+
+  BitBoard() : bits() {}
+
+  void reset() {
+    bits[SIDE_X] = 0;
+    bits[SIDE_O] = 0;
+  }
+
+  Mask occupied() const { return Mask(bits[SIDE_X] | bits[SIDE_O]); }
+
+  Mask empty() const { return Mask(~occupied() & FULL_MASK); }
+
+  int count() const { return popCount(occupied()); }
+
+  bool isFull() const { return occupied() == FULL_MASK; }
+
+  bool isEmpty(int idx) const { return (occupied() & cellMask(idx)) == 0; }
+
+  bool has(int idx, Side s) const { return (bits[s] & cellMask(idx)) != 0; }
+
+  void set(int idx, Side s) {
+    clear(idx);
+    bits[s] |= cellMask(idx);
+  }
+
+  void clear(int idx) {
+    bits[SIDE_X] &= Mask(~cellMask(idx));
+    bits[SIDE_O] &= Mask(~cellMask(idx));
+  }
+
+  int winnerLine(Side s) const { return ttt::winnerLine(bits[s]); }
+
+  // Empty cells where s would complete a line.
+  Mask winningMoves(Side s) const {
+    Mask moves = 0;
+    for (Mask e = empty(); e; e = dropLowest(e)) {
+      const int idx = lowestCell(e);
+      if (hasLine(Mask(bits[s] | cellMask(idx)))) {
+        moves |= cellMask(idx);
+      }
+    }
+    return moves;
+  }
+};
+
+}  // namespace ttt
+
+#endif  // BITBOARD_H
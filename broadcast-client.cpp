@@ -0,0 +1,332 @@
+// Test client for the spectator broadcast (broadcast.h): --subscribers
+// spectators on --threads threads follow a broadcast file, joining from
+// its keyframe over the first --late seconds, and it reports how long
+// deltas take from publish until each spectator has applied them, memory
+// per spectator and whether every spectator ends on the publisher's game.
+// With --publish it plays the games itself, engine against engine at
+// --moves-per-second; --publish 0 follows another publisher, such as
+// tic-tac-toe-server --broadcast. Linux only.
+
+#include "broadcast.h"
+#include "engine.h"
+#include "game.h"
+#include "histogram.h"
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct Options {
+  std::string ring;
+  int publish;  // board side of the games published, 0 for none
+  double movesPerSecond;
+  int subscribers;
+  int threads;
+  double late;  // seconds over which spectators join
+  double seconds;
+  uint32_t capacity;
+  uint64_t seed;
+};
+
+// How long a spectator thread sleeps at most when nothing is published,
+// so that late spectators still join on time.
+const int WAIT_MILLIS = 10;
+
+void usage() {
+  std::cerr << "usage: tic-tac-toe-broadcast [options]\n"
+               "  --ring PATH              broadcast file (ttt.feed)\n"
+               "  --publish 0|3|15|19|100  board of the games published\n"
+               "                           into a new PATH, 0 to follow\n"
+               "                           another publisher (15)\n"
+               "  --moves-per-second N     publishing rate (1000)\n"
+               "  --subscribers N          spectators (10000)\n"
+               "  --threads N              spectator threads (all cores)\n"
+               "  --late S                 spread the joins over S seconds\n"
+               "                           (1)\n"
+               "  --seconds S              run time (5)\n"
+               "  --capacity N             deltas in the ring (65536)\n"
+               "  --seed N                 random seed (1)\n";
+}
+
+bool parseArgs(int argc, char **argv, Options *o) {
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char *value = argv[++i];
+    if (arg == "--ring") {
+      o->ring = value;
+    } else if (arg == "--publish") {
+      o->publish = atoi(value);
+    } else if (arg == "--moves-per-second") {
+      o->movesPerSecond = atof(value);
+    } else if (arg == "--subscribers") {
+      o->subscribers = atoi(value);
+    } else if (arg == "--threads") {
+      o->threads = atoi(value);
+    } else if (arg == "--late") {
+      o->late = atof(value);
+    } else if (arg == "--seconds") {
+      o->seconds = atof(value);
+    } else if (arg == "--capacity") {
+      o->capacity = uint32_t(strtoul(value, 0, 10));
+    } else if (arg == "--seed") {
+      o->seed = strtoull(value, 0, 10);
+    } else {
+      return false;
+    }
+  }
+  return o->subscribers > 0 && o->threads > 0 && o->movesPerSecond > 0 &&
+         (o->publish == 0 || o->publish == 3 || o->publish == 15 ||
+          o->publish == 19 || o->publish == 100);
+}
+
+ttt::Rules boardRules(int side) {
+  switch (side) {
+    case 3:
+      return ttt::RULES_3X3;
+    case 19:
+      return ttt::RULES_19X19;
+    case 100:
+      return ttt::RULES_100X100;
+    default:
+      return ttt::RULES_15X15;
+  }
+}
+
+size_t residentBytes() {
+  FILE *f = fopen("/proc/self/statm", "r");
+  unsigned long pages = 0;
+  unsigned long resident = 0;
+  if (f) {
+    if (fscanf(f, "%lu %lu", &pages, &resident) != 2) {
+      resident = 0;
+    }
+    fclose(f);
+  }
+  return size_t(resident) * size_t(::sysconf(_SC_PAGESIZE));
+}
+
+// Random games at a steady rate, timing each delta's publish.
+struct Publisher {
+  ttt::Histogram publishNanos;
+  uint64_t games;
+
+  Publisher() : publishNanos(), games(0) {}
+
+  void run(const Options &o, ttt::BroadcastWriter *writer,
+           const std::atomic<bool> *stop) {
+    const ttt::Rules rules = boardRules(o.publish);
+    ttt::Engine engine(1 << 16, o.seed, ttt::SearchLimits{1, 0, 0});
+    ttt::Game game(rules);
+    const Clock::duration tick =
+        std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(1 / o.movesPerSecond));
+    Clock::time_point next = Clock::now();
+    while (!stop->load(std::memory_order_relaxed)) {
+      std::this_thread::sleep_until(next);
+      next += tick;
+      const uint64_t start = ttt::broadcastNanos();
+      if (!writer->inGame()) {
+        game.reset(rules, games % 2 ? ttt::SIDE_O : ttt::SIDE_X);
+        writer->game(rules);
+      } else if (game.finished()) {
+        writer->end(game.outcome());
+        games++;
+      } else {
+        const ttt::Side s = game.toMove();
+        const int cell = engine.move(game.board(), s, ttt::LEVEL_EASY).move;
+        game.play(cell);
+        writer->move(cell, s);
+      }
+      publishNanos.record(ttt::broadcastNanos() - start);
+    }
+  }
+};
+
+// A share of the spectators, followed by one thread.
+struct Follower {
+  size_t from;
+  size_t to;
+  ttt::Histogram latency;
+  uint64_t applied;
+
+  Follower() : from(0), to(0), latency(), applied(0) {}
+
+  void run(const Options &o, const ttt::BroadcastReader &feed,
+           std::vector<ttt::Spectator> *all, const std::atomic<bool> *stop) {
+    const Clock::time_point start = Clock::now();
+    std::vector<uint64_t> stamps;
+    stamps.reserve(feed.capacity());
+    auto onDelta = [&stamps](uint32_t, uint64_t stamp) {
+      stamps.push_back(stamp);
+    };
+    uint64_t seen = 0;
+    for (;;) {
+      const bool last = stop->load(std::memory_order_acquire);
+      seen = feed.head();
+      const double elapsed =
+          std::chrono::duration<double>(Clock::now() - start).count();
+      for (size_t i = from; i < to; i++) {
+        ttt::Spectator &s = (*all)[i];
+        if (s.joins() == 0) {
+          if (!last && elapsed < o.late * double(i) / double(all->size())) {
+            continue;
+          }
+          s.join();
+        }
+        stamps.clear();
+        if (s.update(onDelta) == 0) {
+          continue;
+        }
+        // a delta has reached a spectator once it is applied
+        const uint64_t now = ttt::broadcastNanos();
+        for (uint64_t stamp : stamps) {
+          latency.record(now - stamp);
+        }
+        applied += stamps.size();
+      }
+      if (last) {
+        return;
+      }
+      feed.wait(seen, WAIT_MILLIS);
+    }
+  }
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options o;
+  o.ring = "ttt.feed";
+  o.publish = 15;
+  o.movesPerSecond = 1000;
+  o.subscribers = 10000;
+  o.threads = int(std::thread::hardware_concurrency());
+  o.threads = o.threads > 0 ? o.threads : 1;
+  o.late = 1;
+  o.seconds = 5;
+  o.capacity = 1 << 16;
+  o.seed = 1;
+  if (!parseArgs(argc, argv, &o)) {
+    usage();
+    return 1;
+  }
+
+  ttt::BroadcastWriter writer;
+  if (o.publish &&
+      !writer.create(o.ring.c_str(), boardRules(o.publish).cells(),
+                     o.capacity)) {
+    perror(o.ring.c_str());
+    return 1;
+  }
+  ttt::BroadcastReader feed;
+  if (!feed.open(o.ring.c_str())) {
+    fprintf(stderr, "%s is not a broadcast\n", o.ring.c_str());
+    return 1;
+  }
+
+  const size_t before = residentBytes();
+  std::vector<ttt::Spectator> spectators(size_t(o.subscribers),
+                                         ttt::Spectator(&feed));
+  const size_t after = residentBytes();
+
+  const uint64_t firstDelta = feed.head();
+  std::atomic<bool> stopPublisher(false);
+  std::atomic<bool> stopFollowers(false);
+  Publisher publisher;
+  std::thread publisherThread;
+  if (o.publish) {
+    publisherThread = std::thread(
+        [&]() { publisher.run(o, &writer, &stopPublisher); });
+  }
+  const size_t threads = size_t(o.threads);
+  std::vector<Follower> followers(threads);
+  std::vector<std::thread> followerThreads;
+  for (size_t t = 0; t < threads; t++) {
+    followers[t].from = spectators.size() * t / threads;
+    followers[t].to = spectators.size() * (t + 1) / threads;
+    followerThreads.emplace_back([&, t]() {
+      followers[t].run(o, feed, &spectators, &stopFollowers);
+    });
+  }
+  const Clock::time_point start = Clock::now();
+  std::this_thread::sleep_for(std::chrono::duration<double>(o.seconds));
+  stopPublisher = true;
+  if (publisherThread.joinable()) {
+    publisherThread.join();
+  }
+  stopFollowers = true;
+  for (std::thread &t : followerThreads) {
+    t.join();
+  }
+  const double seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+
+  ttt::Histogram latency;
+  uint64_t applied = 0;
+  for (const Follower &f : followers) {
+    latency.merge(f.latency);
+    applied += f.applied;
+  }
+  uint64_t joins = 0;
+  for (const ttt::Spectator &s : spectators) {
+    joins += s.joins();
+  }
+
+  const uint64_t published = feed.head() - firstDelta;
+  if (o.publish) {
+    const ttt::Rules rules = boardRules(o.publish);
+    printf("broadcast    %s, %dx%d games at %.0f moves/s, %llu games\n",
+           o.ring.c_str(), rules.cols, rules.rows, o.movesPerSecond,
+           (unsigned long long)publisher.games);
+  } else {
+    printf("broadcast    %s\n", o.ring.c_str());
+  }
+  printf("ring         %u deltas, %zu bytes shared by every spectator\n",
+         feed.capacity(), feed.bytes());
+  printf("spectators   %d on %d threads, %llu keyframes taken\n",
+         o.subscribers, o.threads, (unsigned long long)joins);
+  printf("deltas       %llu published, %llu applied, %.0f applied/s\n",
+         (unsigned long long)published, (unsigned long long)applied,
+         applied / seconds);
+  if (o.publish) {
+    const ttt::Histogram &p = publisher.publishNanos;
+    printf("publish ns   p50 %llu p99 %llu max %llu\n",
+           (unsigned long long)p.percentile(50),
+           (unsigned long long)p.percentile(99), (unsigned long long)p.max());
+  }
+  printf("fan-out us   p50 %.1f p95 %.1f p99 %.1f max %.1f\n",
+         latency.percentile(50) / 1e3, latency.percentile(95) / 1e3,
+         latency.percentile(99) / 1e3, latency.max() / 1e3);
+  printf("memory       %.0f bytes per spectator resident, %zu of state\n",
+         double(after - before) / o.subscribers,
+         sizeof(ttt::Spectator) +
+             ttt::BroadcastLayout::cellWords(uint32_t(feed.maxCells())) * 8);
+
+  // with the publisher stopped, everyone should be where the keyframe is
+  if (o.publish) {
+    ttt::Spectator reference(&feed);
+    reference.join();
+    int same = 0;
+    for (const ttt::Spectator &s : spectators) {
+      same += s.sameAs(reference) ? 1 : 0;
+    }
+    printf("consistent   %d of %d spectators on the publisher's game\n",
+           same, o.subscribers);
+    return same == o.subscribers ? 0 : 1;
+  }
+  return 0;
+}
@@ -0,0 +1,550 @@
+#ifndef BROADCAST_H
+#define BROADCAST_H
+
+#include "game.h"
+#include "kboard.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Spectator broadcast of one match at a time through a shared-memory ring.
+// The publisher encodes each event once, as a 4-byte delta, into a mapped
+// file; spectators in any number of processes map the same file and read
+// the deltas in place, so a delta costs the publisher the same for one
+// spectator as for ten thousand and is never copied per spectator. The
+// file also holds a keyframe, the current game, updated with every delta
+// under a sequence lock: spectators that join late, or fall a whole ring
+// behind, start over from it. POSIX; on Linux waiting spectators sleep on
+// a futex, elsewhere they poll.
+//
+// A delta is a uint32 with its DeltaKind in the top two bits:
+//
+//   GAME  a new game, cols - 1, rows - 1 and k - 1 in bits 0-9, 10-19
+//         and 20-29
+//   MOVE  the cell in bits 0-28, the Side in bit 29
+//   END   the Outcome in bits 0-1, OUTCOME_NONE when abandoned
+
+namespace ttt {
+
+enum DeltaKind { DELTA_GAME = 1, DELTA_MOVE = 2, DELTA_END = 3 };
+
+// Largest board side a GAME delta holds.
+const int BROADCAST_MAX_SIDE = 1024;
+
+inline uint32_t gameDelta(const Rules &rules) {
+  return uint32_t(DELTA_GAME) << 30 | uint32_t(rules.k - 1) << 20 |
+         uint32_t(rules.rows - 1) << 10 | uint32_t(rules.cols - 1);
+}
+
+inline uint32_t moveDelta(int cell, Side s) {
+  return uint32_t(DELTA_MOVE) << 30 | uint32_t(s) << 29 | uint32_t(cell);
+}
+
+inline uint32_t endDelta(Outcome o) {
+  return uint32_t(DELTA_END) << 30 | uint32_t(o);
+}
+
+inline DeltaKind deltaKind(uint32_t d) { return DeltaKind(d >> 30); }
+
+inline Rules deltaRules(uint32_t d) {
+  const Rules rules = {int(d & 1023) + 1, int((d >> 10) & 1023) + 1,
+                       int((d >> 20) & 1023) + 1};
+  return rules;
+}
+
+inline int deltaCell(uint32_t d) { return int(d & ((1u << 29) - 1)); }
+
+inline Side deltaSide(uint32_t d) { return Side((d >> 29) & 1); }
+
+inline Outcome deltaOutcome(uint32_t d) { return Outcome(d & 3); }
+
+// Monotonic nanoseconds, comparable between processes on one machine.
+inline uint64_t broadcastNanos() {
+  return uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now().time_since_epoch())
+                      .count());
+}
+
+const uint32_t BROADCAST_MAGIC = 0x46545454;  // "TTTF"
+const uint32_t BROADCAST_VERSION = 1;
+
+// The start of the file. The keyframe is consistent when keySeq is even
+// and the same before and after reading it.
+struct BroadcastHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t capacity;  // deltas in the ring, a power of two
+  uint32_t maxCells;  // of the boards it carries
+  std::atomic<uint64_t> head;    // deltas published
+  std::atomic<uint32_t> wake;    // futex word, the low bits of head
+  std::atomic<uint32_t> closed;  // the publisher is gone
+  std::atomic<uint32_t> keySeq;
+  std::atomic<uint32_t> keyGame;  // GAME delta of the game, 0 before any
+  std::atomic<uint32_t> keyOutcome;
+  std::atomic<int32_t> keyMoves;
+  std::atomic<int32_t> keyLastMove;
+  std::atomic<uint64_t> keyHead;  // deltas the keyframe includes
+};
+
+// Offsets in the file: the header, the ring of deltas, their publish
+// times for latency measurements, and the keyframe's cells, 2 bits each,
+// 0 empty or 1 + Side, 32 to a word.
+struct BroadcastLayout {
+  size_t slots;
+  size_t stamps;
+  size_t cells;
+  size_t bytes;
+
+  BroadcastLayout(uint32_t capacity, uint32_t maxCells)
+      : slots(64),
+        stamps(slots + (size_t(capacity) * 4 + 63) / 64 * 64),
+        cells(stamps + size_t(capacity) * 8),
+        bytes(cells + size_t(cellWords(maxCells)) * 8) {}
+
+  static uint32_t cellWords(uint32_t cells) { return (cells + 31) / 32; }
+};
+
+static_assert(sizeof(BroadcastHeader) <= 64, "header outgrew its line");
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared atomics must be lock-free");
+
+// Publishes the deltas of the games it is told about into a new broadcast
+// file. One thread.
+class BroadcastWriter {
+  void *d_map;
+  size_t d_bytes;
+  BroadcastHeader *d_header;
+  std::atomic<uint32_t> *d_slots;
+  std::atomic<uint64_t> *d_stamps;
+  std::atomic<uint64_t> *d_cells;
+  uint64_t d_head;
+  uint32_t d_mask;
+  bool d_inGame;
+
+  void publish(uint32_t delta) {
+    BroadcastHeader &h = *d_header;
+    const uint32_t seq = h.keySeq.load(std::memory_order_relaxed);
+    h.keySeq.store(seq + 1, std::memory_order_relaxed);
+    // spectators that see the new slot also see head at its old slot's
+    // next use, so they can tell an overwritten slot from a current one
+    std::atomic_thread_fence(std::memory_order_release);
+    const size_t slot = size_t(d_head & d_mask);
+    d_slots[slot].store(delta, std::memory_order_relaxed);
+    d_stamps[slot].store(broadcastNanos(), std::memory_order_relaxed);
+    switch (deltaKind(delta)) {
+      case DELTA_GAME: {
+        const uint32_t words =
+            BroadcastLayout::cellWords(uint32_t(deltaRules(delta).cells()));
+        for (uint32_t w = 0; w < words; w++) {
+          d_cells[w].store(0, std::memory_order_relaxed);
+        }
+        h.keyGame.store(delta, std::memory_order_relaxed);
+        h.keyOutcome.store(OUTCOME_NONE, std::memory_order_relaxed);
+        h.keyMoves.store(0, std::memory_order_relaxed);
+        h.keyLastMove.store(-1, std::memory_order_relaxed);
+        break;
+      }
+      case DELTA_MOVE: {
+        const int cell = deltaCell(delta);
+        std::atomic<uint64_t> &word = d_cells[cell / 32];
+        word.store(word.load(std::memory_order_relaxed) |
+                       uint64_t(1 + deltaSide(delta)) << (2 * (cell % 32)),
+                   std::memory_order_relaxed);
+        h.keyMoves.store(h.keyMoves.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+        h.keyLastMove.store(cell, std::memory_order_relaxed);
+        break;
+      }
+      default:
+        h.keyOutcome.store(deltaOutcome(delta), std::memory_order_relaxed);
+        break;
+    }
+    d_head++;
+    h.keyHead.store(d_head, std::memory_order_relaxed);
+    h.keySeq.store(seq + 2, std::memory_order_release);
+    h.head.store(d_head, std::memory_order_release);
+    h.wake.store(uint32_t(d_head), std::memory_order_release);
+    wakeAll();
+  }
+
+  void wakeAll() {
+#ifdef __linux__
+    ::syscall(SYS_futex, &d_header->wake, FUTEX_WAKE, INT32_MAX, 0, 0, 0);
+#endif
+  }
+
+ public:
+  BroadcastWriter()
+      : d_map(0),
+        d_bytes(0),
+        d_header(0),
+        d_slots(0),
+        d_stamps(0),
+        d_cells(0),
+        d_head(0),
+        d_mask(0),
+        d_inGame(false) {}
+
+  ~BroadcastWriter() { close(); }
+
+  BroadcastWriter(const BroadcastWriter &) = delete;
+  BroadcastWriter &operator=(const BroadcastWriter &) = delete;
+
+  // A new broadcast at path for boards of up to maxCells, keeping the last
+  // capacity deltas, rounded up to a power of two. Spectators of a file it
+  // replaces keep following the old one.
+  bool create(const char *path, int maxCells, uint32_t capacity) {
+    close();
+    uint32_t ring = 64;
+    while (ring < capacity && ring < (1u << 30)) {
+      ring <<= 1;
+    }
+    const BroadcastLayout layout(ring, uint32_t(maxCells));
+    const std::string tmp = std::string(path) + ".tmp";
+    const int fd = ::open(tmp.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+      return false;
+    }
+    void *map = MAP_FAILED;
+    if (::ftruncate(fd, off_t(layout.bytes)) == 0) {
+      map = ::mmap(0, layout.bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                   0);
+    }
+    ::close(fd);
+    if (map == MAP_FAILED) {
+      ::unlink(tmp.c_str());
+      return false;
+    }
+    d_map = map;
+    d_bytes = layout.bytes;
+    unsigned char *p = static_cast<unsigned char *>(map);
+    d_header = reinterpret_cast<BroadcastHeader *>(p);
+    d_slots = reinterpret_cast<std::atomic<uint32_t> *>(p + layout.slots);
+    d_stamps = reinterpret_cast<std::atomic<uint64_t> *>(p + layout.stamps);
+    d_cells = reinterpret_cast<std::atomic<uint64_t> *>(p + layout.cells);
+    d_head = 0;
+    d_mask = ring - 1;
+    d_inGame = false;
+    // the rest of a new file is zeros, an empty keyframe and ring
+    d_header->magic = BROADCAST_MAGIC;
+    d_header->version = BROADCAST_VERSION;
+    d_header->capacity = ring;
+    d_header->maxCells = uint32_t(maxCells);
+    d_header->keyLastMove.store(-1, std::memory_order_relaxed);
+    if (::rename(tmp.c_str(), path) != 0) {
+      ::unlink(tmp.c_str());
+      close();
+      return false;
+    }
+    return true;
+  }
+
+  // Marks the broadcast closed for its spectators and unmaps it.
+  void close() {
+    if (!d_map) {
+      return;
+    }
+    d_header->closed.store(1, std::memory_order_release);
+    d_header->wake.store(uint32_t(d_head) + 1, std::memory_order_release);
+    wakeAll();
+    ::munmap(d_map, d_bytes);
+    d_map = 0;
+    d_bytes = 0;
+    d_header = 0;
+  }
+
+  bool isOpen() const { return d_map != 0; }
+
+  int maxCells() const { return d_map ? int(d_header->maxCells) : 0; }
+
+  uint64_t published() const { return d_head; }
+
+  bool inGame() const { return d_inGame; }
+
+  // Starts a game of rules; false, and nothing published, when its board
+  // does not fit.
+  bool game(const Rules &rules) {
+    if (!d_map || rules.cols > BROADCAST_MAX_SIDE ||
+        rules.rows > BROADCAST_MAX_SIDE || rules.k > BROADCAST_MAX_SIDE ||
+        rules.cells() > maxCells()) {
+      return false;
+    }
+    publish(gameDelta(rules));
+    d_inGame = true;
+    return true;
+  }
+
+  void move(int cell, Side s) {
+    if (d_inGame) {
+      publish(moveDelta(cell, s));
+    }
+  }
+
+  // Ends the game, with OUTCOME_NONE when it was abandoned.
+  void end(Outcome o) {
+    if (d_inGame) {
+      publish(endDelta(o));
+      d_inGame = false;
+    }
+  }
+};
+
+// A broadcast file mapped read-only, shared by every spectator of the
+// process.
+class BroadcastReader {
+  void *d_map;
+  size_t d_bytes;
+  const BroadcastHeader *d_header;
+  const std::atomic<uint32_t> *d_slots;
+  const std::atomic<uint64_t> *d_stamps;
+  const std::atomic<uint64_t> *d_cells;
+
+  friend class Spectator;
+
+ public:
+  BroadcastReader()
+      : d_map(0),
+        d_bytes(0),
+        d_header(0),
+        d_slots(0),
+        d_stamps(0),
+        d_cells(0) {}
+
+  ~BroadcastReader() { close(); }
+
+  BroadcastReader(const BroadcastReader &) = delete;
+  BroadcastReader &operator=(const BroadcastReader &) = delete;
+
+  // False when path is missing or not a broadcast of this version.
+  bool open(const char *path) {
+    close();
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 ||
+        size_t(st.st_size) < sizeof(BroadcastHeader)) {
+      ::close(fd);
+      return false;
+    }
+    d_bytes = size_t(st.st_size);
+    void *map = ::mmap(0, d_bytes, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+      d_bytes = 0;
+      return false;
+    }
+    d_map = map;
+    const unsigned char *p = static_cast<const unsigned char *>(map);
+    d_header = reinterpret_cast<const BroadcastHeader *>(p);
+    const uint32_t capacity = d_header->capacity;
+    if (d_header->magic != BROADCAST_MAGIC ||
+        d_header->version != BROADCAST_VERSION || capacity == 0 ||
+        (capacity & (capacity - 1)) != 0 ||
+        BroadcastLayout(capacity, d_header->maxCells).bytes > d_bytes) {
+      close();
+      return false;
+    }
+    const BroadcastLayout layout(capacity, d_header->maxCells);
+    d_slots = reinterpret_cast<const std::atomic<uint32_t> *>(p + layout.slots);
+    d_stamps =
+        reinterpret_cast<const std::atomic<uint64_t> *>(p + layout.stamps);
+    d_cells = reinterpret_cast<const std::atomic<uint64_t> *>(p + layout.cells);
+    return true;
+  }
+
+  void close() {
+    if (d_map) {
+      ::munmap(d_map, d_bytes);
+    }
+    d_map = 0;
+    d_bytes = 0;
+    d_header = 0;
+  }
+
+  bool isOpen() const { return d_map != 0; }
+
+  size_t bytes() const { return d_bytes; }
+
+  uint32_t capacity() const { return d_header->capacity; }
+
+  int maxCells() const { return int(d_header->maxCells); }
+
+  uint64_t head() const {
+    return d_header->head.load(std::memory_order_acquire);
+  }
+
+  bool closed() const {
+    return d_header->closed.load(std::memory_order_acquire) != 0;
+  }
+
+  // Returns once head() is past seen, the broadcast is closed or millis
+  // have passed; sooner now and then.
+  void wait(uint64_t seen, int millis) const {
+    const uint32_t word = d_header->wake.load(std::memory_order_acquire);
+    if (head() != seen || closed()) {
+      return;
+    }
+#ifdef __linux__
+    const timespec timeout = {millis / 1000, (millis % 1000) * 1000000L};
+    ::syscall(SYS_futex, &d_header->wake, FUTEX_WAIT, word, &timeout, 0, 0);
+#else
+    (void)word;
+    (void)millis;
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+#endif
+  }
+};
+
+// One spectator's view of a broadcast: how far it has read and the game
+// so far, rebuilt from its deltas. Its board is allocated once, for the
+// largest the broadcast carries, so following a game allocates nothing.
+class Spectator {
+  const BroadcastReader *d_feed;
+  uint64_t d_next;  // delta to read next
+  uint32_t d_game;  // GAME delta, 0 before any
+  Outcome d_outcome;
+  int d_moves;
+  int d_lastMove;
+  uint32_t d_joins;  // keyframes taken
+  std::vector<uint64_t> d_cells;
+
+  void apply(uint32_t delta) {
+    switch (deltaKind(delta)) {
+      case DELTA_GAME:
+        std::fill(d_cells.begin(), d_cells.end(), 0);
+        d_game = delta;
+        d_outcome = OUTCOME_NONE;
+        d_moves = 0;
+        d_lastMove = -1;
+        break;
+      case DELTA_MOVE: {
+        const int cell = deltaCell(delta);
+        d_cells[cell / 32] |= uint64_t(1 + deltaSide(delta))
+                              << (2 * (cell % 32));
+        d_moves++;
+        d_lastMove = cell;
+        break;
+      }
+      default:
+        d_outcome = deltaOutcome(delta);
+        break;
+    }
+  }
+
+ public:
+  explicit Spectator(const BroadcastReader *feed)
+      : d_feed(feed),
+        d_next(0),
+        d_game(0),
+        d_outcome(OUTCOME_NONE),
+        d_moves(0),
+        d_lastMove(-1),
+        d_joins(0),
+        d_cells(BroadcastLayout::cellWords(uint32_t(feed->maxCells()))) {}
+
+  // Takes the keyframe: the game as of the latest delta, which it then
+  // follows from.
+  void join() {
+    const BroadcastHeader &h = *d_feed->d_header;
+    for (;;) {
+      const uint32_t seq = h.keySeq.load(std::memory_order_acquire);
+      if (seq & 1) {
+        std::this_thread::yield();
+        continue;
+      }
+      d_game = h.keyGame.load(std::memory_order_relaxed);
+      d_outcome = Outcome(h.keyOutcome.load(std::memory_order_relaxed));
+      d_moves = h.keyMoves.load(std::memory_order_relaxed);
+      d_lastMove = h.keyLastMove.load(std::memory_order_relaxed);
+      d_next = h.keyHead.load(std::memory_order_relaxed);
+      const uint32_t words =
+          d_game ? BroadcastLayout::cellWords(
+                       uint32_t(deltaRules(d_game).cells()))
+                 : 0;
+      for (uint32_t w = 0; w < words; w++) {
+        d_cells[w] = d_feed->d_cells[w].load(std::memory_order_relaxed);
+      }
+      std::fill(d_cells.begin() + words, d_cells.end(), 0);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (h.keySeq.load(std::memory_order_relaxed) == seq) {
+        break;
+      }
+    }
+    d_joins++;
+  }
+
+  // Applies the deltas published since the last call, calling
+  // onDelta(delta, publish nanoseconds) after each, and returns how many.
+  // Rejoins from the keyframe when the ring has moved past its place.
+  template <class F>
+  size_t update(F onDelta) {
+    const uint64_t head = d_feed->head();
+    const uint64_t capacity = d_feed->capacity();
+    const uint64_t mask = capacity - 1;
+    size_t n = 0;
+    while (d_next < head) {
+      const uint32_t delta =
+          d_feed->d_slots[d_next & mask].load(std::memory_order_relaxed);
+      const uint64_t stamp =
+          d_feed->d_stamps[d_next & mask].load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      // the slot is reused once head reaches its next sequence number
+      if (d_feed->d_header->head.load(std::memory_order_relaxed) - d_next >=
+          capacity) {
+        join();
+        return n;
+      }
+      apply(delta);
+      d_next++;
+      n++;
+      onDelta(delta, stamp);
+    }
+    return n;
+  }
+
+  size_t update() {
+    return update([](uint32_t, uint64_t) {});
+  }
+
+  uint64_t next() const { return d_next; }
+  uint32_t joins() const { return d_joins; }
+  bool inGame() const { return d_game != 0; }
+  Rules rules() const { return deltaRules(d_game); }
+  Outcome outcome() const { return d_outcome; }
+  int moves() const { return d_moves; }
+  int lastMove() const { return d_lastMove; }
+
+  // 0 for an empty cell, else 1 + the Side on it.
+  int cell(int idx) const {
+    return int(d_cells[idx / 32] >> (2 * (idx % 32))) & 3;
+  }
+
+  // The same game at the same point.
+  bool sameAs(const Spectator &o) const {
+    return d_next == o.d_next && d_game == o.d_game &&
+           d_outcome == o.d_outcome && d_moves == o.d_moves &&
+           d_lastMove == o.d_lastMove && d_cells == o.d_cells;
+  }
+};
+
+}  // namespace ttt
+
+#endif  // BROADCAST_H
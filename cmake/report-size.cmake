@@ -0,0 +1,3 @@
+# Prints the size of FILE: cmake -DFILE=<path> -P report-size.cmake
+file( SIZE "${FILE}" size )
+message( "${FILE}: ${size} bytes" )
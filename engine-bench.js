@@ -0,0 +1,81 @@
+// Calls/sec of the engine's C API (tttapi.h) from JS: a board per call
+// against 10000 boards per call, on typed-array views of the module's
+// memory, so nothing is copied either way. Needs the Emscripten build of
+// dist/engine.js; prints a JSON line per benchmark.
+//
+//   node engine-bench.js [seconds per benchmark]
+
+const createTicTacToeEngine = require('./dist/engine.js');
+
+const BATCH = 10000;
+const SECONDS = Number(process.argv[2] || 1);
+
+function bench(name, boardsPerCall, call) {
+  let calls = 0;
+  const start = performance.now();
+  let now = start;
+  while (now - start < SECONDS * 1000) {
+    for (let i = 0; i < 64; i++) {
+      call(calls++ % BATCH);
+    }
+    now = performance.now();
+  }
+  const seconds = (now - start) / 1000;
+  console.log(JSON.stringify({
+    name: name,
+    ops: calls,
+    ns_per_op: seconds * 1e9 / calls,
+    items_per_op: boardsPerCall,
+    items_per_s: calls * boardsPerCall / seconds,
+  }));
+}
+
+// Positions of random 3x3 games, X first, stopped after 0 to 8 moves.
+function randomPositions(xs, os, mine, theirs) {
+  for (let i = 0; i < BATCH; i++) {
+    const stones = [0, 0];
+    const moves = Math.floor(Math.random() * 9);
+    for (let m = 0; m < moves; m++) {
+      let c;
+      do {
+        c = Math.floor(Math.random() * 9);
+      } while (((stones[0] | stones[1]) >> c) & 1);
+      stones[m & 1] |= 1 << c;
+    }
+    xs[i] = stones[0];
+    os[i] = stones[1];
+    mine[i] = stones[moves & 1];
+    theirs[i] = stones[(moves + 1) & 1];
+  }
+}
+
+createTicTacToeEngine().then((m) => {
+  // every array allocated before any view is taken: growing the memory
+  // detaches the views
+  const x = m._ttt_alloc(BATCH * 2);
+  const o = m._ttt_alloc(BATCH * 2);
+  const mine = m._ttt_alloc(BATCH * 2);
+  const theirs = m._ttt_alloc(BATCH * 2);
+  const status = m._ttt_alloc(BATCH);
+  const legal = m._ttt_alloc(BATCH * 2);
+  const move = m._ttt_alloc(BATCH);
+  const value = m._ttt_alloc(BATCH);
+  const distance = m._ttt_alloc(BATCH);
+  const u16 = (p) => new Uint16Array(m.HEAPU16.buffer, p, BATCH);
+  randomPositions(u16(x), u16(o), u16(mine), u16(theirs));
+
+  bench('js_evaluate_3x3_x1', 1, (i) =>
+    m._ttt_evaluate_3x3(x + 2 * i, o + 2 * i, 1, status + i, legal + 2 * i));
+  bench('js_evaluate_3x3_x10000', BATCH, () =>
+    m._ttt_evaluate_3x3(x, o, BATCH, status, legal));
+  bench('js_solve_3x3_x1', 1, (i) =>
+    m._ttt_solve_3x3(mine + 2 * i, theirs + 2 * i, 1, move + i, value + i,
+                     distance + i));
+  bench('js_solve_3x3_x10000', BATCH, () =>
+    m._ttt_solve_3x3(mine, theirs, BATCH, move, value, distance));
+
+  // results are read in place
+  const statuses = new Uint8Array(m.HEAPU8.buffer, status, BATCH);
+  const open = statuses.filter((s) => s === 0).length;
+  console.log(JSON.stringify({boards: BATCH, open: open}));
+});
@@ -0,0 +1,202 @@
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include "kboard.h"
+#include "mcts.h"
+#include "parallelsearch.h"
+#include "search.h"
+#include "solved3x3.h"
+#include "tablebase.h"
+#include "threadpool.h"
+#include "ttable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ttt {
+
+enum Level { LEVEL_EASY, LEVEL_HARD, LEVEL_MCTS };
+
+// Where a computer move came from.
+enum MoveSource { MOVE_RANDOM, MOVE_SOLVED, MOVE_SEARCH, MOVE_MCTS };
+
+struct EngineMove {
+  int move;
+  MoveSource source;
+  int score;  // solved value, search score or MCTS win rate in per mille
+};
+
+// The computer player without any UI: random moves for the easy level, the
+// solved table on 3x3, a tablebase on its board if one is set and the
+// search elsewhere for the hard level, Monte Carlo tree search for the MCTS
+// level. Each engine owns its random state and transposition table, so one
+// per thread; given a thread pool the search runs in parallel on it.
+class Engine {
+  TranspositionTable d_tt;
+  ParallelSearch d_search;
+  SearchLimits d_limits;
+  SearchResult d_lastSearch;
+  Mcts d_mcts;
+  MctsLimits d_mctsLimits;
+  MctsResult d_lastMcts;
+  uint64_t d_rng;
+  std::atomic<bool> d_abort;
+  Level d_stepping;  // level of the move begun by beginMove()
+  EngineMove d_stepMove;
+  const Tablebase *d_tablebase;
+
+ public:
+  Engine(size_t ttBytes, uint64_t seed, const SearchLimits &limits,
+         ThreadPool *pool = 0)
+      : d_tt(ttBytes),
+        d_search(&d_tt, pool),
+        d_limits(limits),
+        d_lastSearch(),
+        d_mcts(MCTS_ARENA_BYTES, seed ^ 0x6d637473ull),
+        d_mctsLimits{limits.maxSeconds, 0},
+        d_lastMcts(),
+        d_rng(seed),
+        d_abort(false),
+        d_stepping(LEVEL_EASY),
+        d_stepMove(),
+        d_tablebase(0) {
+    d_search.setAbort(&d_abort);
+    d_mcts.setAbort(&d_abort);
+  }
+
+  Engine(const Engine &) = delete;
+  Engine &operator=(const Engine &) = delete;
+
+  void seed(uint64_t seed) {
+    d_rng = seed;
+    d_mcts.seed(seed ^ 0x6d637473ull);
+  }
+
+  void setLimits(const SearchLimits &limits) { d_limits = limits; }
+
+  const SearchLimits &limits() const { return d_limits; }
+
+  // Search threads including the caller, at most the pool size plus one.
+  void setSearchThreads(int threads) { d_search.setThreads(threads); }
+
+  int searchThreads() const { return d_search.threads(); }
+
+  // Defaults to the search time per move. The arena is only allocated by
+  // the first MCTS move.
+  void setMctsLimits(const MctsLimits &limits) { d_mctsLimits = limits; }
+
+  void setMctsArenaBytes(size_t bytes) { d_mcts.setArenaBytes(bytes); }
+
+  const MctsResult &lastMcts() const { return d_lastMcts; }
+
+  // Statistics of the last search, untouched by random and solved moves.
+  const SearchResult &lastSearch() const { return d_lastSearch; }
+
+  TranspositionTable &transpositionTable() { return d_tt; }
+
+  // Perfect hard moves on the tablebase's board; it must outlive the
+  // engine and may be shared between engines. 0 to go back to the search.
+  void setTablebase(const Tablebase *tablebase) { d_tablebase = tablebase; }
+
+  // True when hard moves on board are read from a table, not searched.
+  bool solves(const KBoard &board) const {
+    return board.rules() == RULES_3X3 ||
+           (d_tablebase && d_tablebase->isOpen() &&
+            board.rules() == d_tablebase->rules());
+  }
+
+  // Makes a search or MCTS move running on another thread return early
+  // with the best move so far; it stays set until clearAbort().
+  void abort() { d_abort = true; }
+
+  void clearAbort() { d_abort = false; }
+
+  // Uniform in [0, n).
+  int random(int n) { return int(splitMix64(&d_rng) % uint64_t(n)); }
+
+  EngineMove randomMove(const KBoard &board) {
+    const EngineMove m = {board.nthEmpty(random(board.emptyCount())),
+                          MOVE_RANDOM, 0};
+    return m;
+  }
+
+  EngineMove advancedMove(const KBoard &board, Side s) {
+    if (board.rules() == RULES_3X3) {
+      const BitBoard b = board.toBitBoard();
+      const SolvedMove solved = solvedMove(b.bits[s], b.bits[otherSide(s)]);
+      if (solved.move >= 0) {
+        const EngineMove m = {solved.move, MOVE_SOLVED, solved.value};
+        return m;
+      }
+    } else if (solves(board)) {
+      const SolvedMove solved = d_tablebase->bestMove(board, s);
+      if (solved.move >= 0) {
+        const EngineMove m = {solved.move, MOVE_SOLVED, solved.value};
+        return m;
+      }
+    }
+    d_lastSearch = d_search.run(board, s, d_limits);
+    const EngineMove m = {d_lastSearch.move, MOVE_SEARCH, d_lastSearch.score};
+    return m;
+  }
+
+  EngineMove mctsMove(const KBoard &board, Side s) {
+    d_lastMcts = d_mcts.run(board, s, d_mctsLimits);
+    const EngineMove m = {d_lastMcts.move, MOVE_MCTS,
+                          int(d_lastMcts.winRate * 1000)};
+    return m;
+  }
+
+  EngineMove move(const KBoard &board, Side s, Level level) {
+    switch (level) {
+      case LEVEL_HARD:
+        return advancedMove(board, s);
+      case LEVEL_MCTS:
+        return mctsMove(board, s);
+      default:
+        return randomMove(board);
+    }
+  }
+
+  // move() in slices for a caller that cannot block, such as a UI thread
+  // without threads to spare: begin here, then call stepMove() once per
+  // frame until it returns true. The search and MCTS keep their state
+  // between slices; the time limits run on the wall clock from here.
+  void beginMove(const KBoard &board, Side s, Level level) {
+    d_stepping = level;
+    if (level == LEVEL_HARD && solves(board)) {
+      d_stepping = LEVEL_EASY;  // solved tables are instant
+      d_stepMove = advancedMove(board, s);
+    } else if (level == LEVEL_HARD) {
+      d_search.start(board, s, d_limits);
+    } else if (level == LEVEL_MCTS) {
+      d_mcts.start(board, s, d_mctsLimits);
+    } else {
+      d_stepMove = randomMove(board);
+    }
+  }
+
+  // Thinks for about sliceSeconds; true once *m holds the move.
+  bool stepMove(double sliceSeconds, EngineMove *m) {
+    if (d_stepping == LEVEL_HARD) {
+      if (!d_search.step(sliceSeconds)) {
+        return false;
+      }
+      d_lastSearch = d_search.result();
+      d_stepMove = {d_lastSearch.move, MOVE_SEARCH, d_lastSearch.score};
+    } else if (d_stepping == LEVEL_MCTS) {
+      if (!d_mcts.step(sliceSeconds)) {
+        return false;
+      }
+      d_lastMcts = d_mcts.result();
+      d_stepMove = {d_lastMcts.move, MOVE_MCTS, int(d_lastMcts.winRate * 1000)};
+    }
+    *m = d_stepMove;
+    return true;
+  }
+};
+
+}  // namespace ttt
+
+#endif  // ENGINE_H
@@ -0,0 +1,143 @@
+#ifndef FRAMETIMING_H
+#define FRAMETIMING_H
+
+#include "histogram.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+
+namespace ttt {
+
+// Phases of one frame; PHASE_FRAME is the whole frame. A frame that draws
+// nothing only has events and computer time.
+enum FramePhase {
+  PHASE_EVENTS,
+  PHASE_COMPUTER,
+  PHASE_BOARD,
+  PHASE_OVERLAY,
+  PHASE_PRESENT,
+  PHASE_FRAME,
+  NUM_FRAME_PHASES
+};
+
+inline const char *framePhaseName(FramePhase p) {
+  static const char *const NAMES[NUM_FRAME_PHASES] = {
+      "events", "computer", "board", "overlay", "present", "frame"};
+  return NAMES[p];
+}
+
+// Nanoseconds per phase: a rolling window of the last WINDOW frames for
+// percentiles that follow spikes, plus all-time histograms. Fixed size, no
+// allocation. Use through the TTT_FRAME_* macros so that builds without
+// TTT_FRAME_TIMING compile it out.
+class FrameTiming {
+ public:
+  static const int WINDOW = 512;
+  typedef std::chrono::steady_clock Clock;
+
+ private:
+  uint64_t d_window[NUM_FRAME_PHASES][WINDOW];
+  uint64_t d_current[NUM_FRAME_PHASES];
+  Histogram d_total[NUM_FRAME_PHASES];
+  mutable uint64_t d_scratch[WINDOW];
+  Clock::time_point d_frameStart;
+  int d_next;
+  int d_filled;
+  uint64_t d_frames;
+
+ public:
+  FrameTiming() : d_next(0), d_filled(0), d_frames(0) {
+    std::fill(d_current, d_current + NUM_FRAME_PHASES, 0);
+  }
+
+  void beginFrame() {
+    std::fill(d_current, d_current + NUM_FRAME_PHASES, 0);
+    d_frameStart = Clock::now();
+  }
+
+  void add(FramePhase p, uint64_t nanos) { d_current[p] += nanos; }
+
+  // Records the frame begun last; frames that are not ended are dropped.
+  void endFrame() {
+    d_current[PHASE_FRAME] = uint64_t(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                             d_frameStart)
+            .count());
+    for (int p = 0; p < NUM_FRAME_PHASES; p++) {
+      d_window[p][d_next] = d_current[p];
+      d_total[p].record(d_current[p]);
+    }
+    d_next = (d_next + 1) % WINDOW;
+    d_filled = d_filled < WINDOW ? d_filled + 1 : WINDOW;
+    d_frames++;
+  }
+
+  uint64_t frames() const { return d_frames; }
+
+  // Percentile of the rolling window, p in [0, 100].
+  uint64_t percentile(FramePhase phase, double p) const {
+    if (d_filled == 0) {
+      return 0;
+    }
+    std::copy(d_window[phase], d_window[phase] + d_filled, d_scratch);
+    int rank = int(p / 100.0 * (d_filled - 1) + 0.5);
+    std::nth_element(d_scratch, d_scratch + rank, d_scratch + d_filled);
+    return d_scratch[rank];
+  }
+
+  const Histogram &total(FramePhase phase) const { return d_total[phase]; }
+
+  void writeJson(std::ostream &out) const {
+    out << "{\"frames\":" << d_frames << ",\"window\":" << d_filled
+        << ",\"phases\":{";
+    for (int p = 0; p < NUM_FRAME_PHASES; p++) {
+      const FramePhase phase = FramePhase(p);
+      const Histogram &h = d_total[p];
+      out << (p ? "," : "") << "\"" << framePhaseName(phase) << "\":{"
+          << "\"p50\":" << percentile(phase, 50)
+          << ",\"p95\":" << percentile(phase, 95)
+          << ",\"p99\":" << percentile(phase, 99)
+          << ",\"mean\":" << uint64_t(h.mean())
+          << ",\"max\":" << h.max() << "}";
+    }
+    out << "}}";
+  }
+};
+
+// Adds the lifetime of the scope to a phase of the current frame.
+class PhaseTimer {
+  FrameTiming *d_timing;
+  FramePhase d_phase;
+  FrameTiming::Clock::time_point d_start;
+
+ public:
+  PhaseTimer(FrameTiming *timing, FramePhase phase)
+      : d_timing(timing), d_phase(phase), d_start(FrameTiming::Clock::now()) {}
+
+  ~PhaseTimer() {
+    d_timing->add(d_phase, uint64_t(std::chrono::duration_cast<
+                                        std::chrono::nanoseconds>(
+                                        FrameTiming::Clock::now() - d_start)
+                                        .count()));
+  }
+
+  PhaseTimer(const PhaseTimer &) = delete;
+  PhaseTimer &operator=(const PhaseTimer &) = delete;
+};
+
+}  // namespace ttt
+
+#ifdef TTT_FRAME_TIMING
+#define TTT_FRAME_BEGIN(timing) (timing).beginFrame()
+#define TTT_FRAME_END(timing) (timing).endFrame()
+#define TTT_FRAME_PHASE(timing, phase) \
+  ::ttt::PhaseTimer ttt_phase_timer_##phase(&(timing), ::ttt::phase)
+#else
+#define TTT_FRAME_BEGIN(timing) ((void)0)
+#define TTT_FRAME_END(timing) ((void)0)
+#define TTT_FRAME_PHASE(timing, phase) ((void)0)
+#endif
+
+#endif  // FRAMETIMING_H
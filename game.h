@@ -0,0 +1,102 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include "kboard.h"
+
+namespace ttt {
+
+enum Outcome { OUTCOME_NONE, OUTCOME_X, OUTCOME_O, OUTCOME_DRAW };
+
+inline const char *outcomeName(Outcome o) {
+  static const char *const NAMES[] = {"none", "X", "O", "draw"};
+  return NAMES[o];
+}
+
+// The rules of one game, without UI or engine: whose turn it is, which
+// moves are legal and how the game ended. The SDL game holds one, the
+// server one per session.
+class Game {
+  KBoard d_board;
+  Side d_toMove;
+  int d_lastMove;
+  Outcome d_outcome;
+  Line d_winnerLine;
+
+ public:
+  explicit Game(const Rules &rules = RULES_3X3)
+      : d_board(rules),
+        d_toMove(SIDE_X),
+        d_lastMove(-1),
+        d_outcome(OUTCOME_NONE),
+        d_winnerLine() {}
+
+  // An empty board of rules with first to move.
+  void reset(const Rules &rules, Side first) {
+    if (rules != d_board.rules()) {
+      d_board.reset(rules);
+    } else {
+      d_board.reset();
+    }
+    d_toMove = first;
+    d_lastMove = -1;
+    d_outcome = OUTCOME_NONE;
+  }
+
+  // The position with stones x and o, a bit per cell, as reached by play()
+  // with lastMove (-1 for none) played last and toMove to move. Boards of
+  // at most 64 cells.
+  void restore(const Rules &rules, uint64_t x, uint64_t o, Side toMove,
+               int lastMove) {
+    reset(rules, toMove);
+    for (; x; x &= x - 1) {
+      d_board.play(lowestBit64(x), SIDE_X);
+    }
+    for (; o; o &= o - 1) {
+      d_board.play(lowestBit64(o), SIDE_O);
+    }
+    d_lastMove = lastMove;
+    if (lastMove >= 0 &&
+        d_board.lineThrough(lastMove, otherSide(toMove), &d_winnerLine)) {
+      d_outcome = otherSide(toMove) == SIDE_X ? OUTCOME_X : OUTCOME_O;
+    } else if (d_board.isFull()) {
+      d_outcome = OUTCOME_DRAW;
+    }
+  }
+
+  const KBoard &board() const { return d_board; }
+  const Rules &rules() const { return d_board.rules(); }
+  Side toMove() const { return d_toMove; }
+  int lastMove() const { return d_lastMove; }  // -1 before the first
+  Outcome outcome() const { return d_outcome; }
+  bool finished() const { return d_outcome != OUTCOME_NONE; }
+
+  // The completed line of a won game.
+  const Line &winnerLine() const { return d_winnerLine; }
+
+  bool isLegal(int idx) const {
+    return !finished() && idx >= 0 && idx < d_board.cells() &&
+           d_board.isEmpty(idx);
+  }
+
+  // Plays idx for the side to move and passes the turn; false and no
+  // change when the move is not legal.
+  bool play(int idx) {
+    if (!isLegal(idx)) {
+      return false;
+    }
+    d_board.play(idx, d_toMove);
+    d_lastMove = idx;
+    // only lines through the last move can have been completed
+    if (d_board.lineThrough(idx, d_toMove, &d_winnerLine)) {
+      d_outcome = d_toMove == SIDE_X ? OUTCOME_X : OUTCOME_O;
+    } else if (d_board.isFull()) {
+      d_outcome = OUTCOME_DRAW;
+    }
+    d_toMove = otherSide(d_toMove);
+    return true;
+  }
+};
+
+}  // namespace ttt
+
+#endif  // GAME_H
@@ -0,0 +1,341 @@
+#ifndef GAMERECORD_H
+#define GAMERECORD_H
+
+#include "engine.h"
+#include "game.h"
+#include "kboard.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+
+// Binary game records. A file is a 16-byte header and then 64 KiB blocks;
+// records never straddle a block, so blocks can be read independently and
+// a block whose next record header has 0 moves ends there. A record is
+//
+//   uint32 seed         low bits of the engine seed
+//   uint16 think        engine milliseconds per move on large boards
+//   uint16 moves
+//   uint8  rules        index in RECORD_RULES
+//   uint8  flags        bits 0-1 Outcome, 2 the side that moved first,
+//                       3 moves stored as nibbles
+//   uint8  players      X in the low nibble, O in the high: 0 a human,
+//                       1 + Level an engine
+//
+// little-endian and unaligned, followed by the moves in order: two cells
+// per byte, low nibble first, on boards of up to 16 cells, else a uint16
+// per cell. New boards are appended to RECORD_RULES without a new version:
+// the nibble flag gives the size of every record, so readers skip records
+// of boards they do not know. Version 1 packed the rules into 2 bits of
+// the flags.
+
+namespace ttt {
+
+const uint32_t RECORD_MAGIC = 0x52545454;  // "TTTR"
+const uint32_t RECORD_VERSION = 2;
+const size_t RECORD_FILE_HEADER = 16;
+const size_t RECORD_BLOCK = 64 << 10;
+const size_t RECORD_HEADER = 11;
+
+// Only ever appended to: the index of a board is stored in its records.
+const int NUM_RECORD_RULES = 5;
+const Rules RECORD_RULES[NUM_RECORD_RULES] = {
+    RULES_3X3, RULES_15X15, RULES_19X19, RULES_4X4, RULES_100X100};
+// Cells of the largest board in RECORD_RULES.
+const int RECORD_MAX_CELLS = 100 * 100;
+
+// Index of rules in RECORD_RULES, -1 for boards records cannot hold.
+inline int recordRules(const Rules &rules) {
+  for (int i = 0; i < NUM_RECORD_RULES; i++) {
+    if (rules == RECORD_RULES[i]) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Player nibble of a human.
+const int RECORD_HUMAN = 0;
+
+inline int recordEngine(Level level) { return 1 + int(level); }
+
+// Whether moves on a board are stored as nibbles.
+inline bool recordNibbles(const Rules &rules) { return rules.cells() <= 16; }
+
+inline size_t recordMoveBytes(bool nibbles, int moves) {
+  return nibbles ? size_t(moves + 1) / 2 : size_t(moves) * 2;
+}
+
+// A record in place, in a block or a mapped file.
+class RecordView {
+  const unsigned char *d_p;
+
+  uint16_t u16(size_t at) const { return uint16_t(d_p[at] | d_p[at + 1] << 8); }
+
+ public:
+  explicit RecordView(const unsigned char *p = 0) : d_p(p) {}
+
+  uint32_t seed() const {
+    return uint32_t(d_p[0]) | uint32_t(d_p[1]) << 8 | uint32_t(d_p[2]) << 16 |
+           uint32_t(d_p[3]) << 24;
+  }
+  int thinkMillis() const { return u16(4); }
+  int moves() const { return u16(6); }
+  int rulesIndex() const { return d_p[8]; }
+  // Whether this build has the board in RECORD_RULES.
+  bool knownRules() const { return rulesIndex() < NUM_RECORD_RULES; }
+  const Rules &rules() const { return RECORD_RULES[rulesIndex()]; }
+  Outcome outcome() const { return Outcome(d_p[9] & 3); }
+  Side first() const { return Side((d_p[9] >> 2) & 1); }
+  bool nibbles() const { return (d_p[9] >> 3) & 1; }
+  int player(Side s) const { return (d_p[10] >> (4 * s)) & 15; }
+
+  int move(int i) const {
+    const unsigned char *m = d_p + RECORD_HEADER;
+    if (nibbles()) {
+      return (m[i >> 1] >> ((i & 1) * 4)) & 15;
+    }
+    return m[2 * i] | m[2 * i + 1] << 8;
+  }
+
+  size_t bytes() const {
+    return RECORD_HEADER + recordMoveBytes(nibbles(), moves());
+  }
+
+  // Whether the record could have been written, within room bytes: known
+  // players, a result, and on a known board the move encoding of that
+  // board and moves on it. Files are read as they are, so nothing else is
+  // trusted.
+  bool valid(size_t room) const {
+    if (room < RECORD_HEADER || (d_p[9] >> 4) != 0 ||
+        outcome() == OUTCOME_NONE || bytes() > room ||
+        player(SIDE_X) > recordEngine(LEVEL_MCTS) ||
+        player(SIDE_O) > recordEngine(LEVEL_MCTS)) {
+      return false;
+    }
+    if (!knownRules()) {
+      return true;
+    }
+    const int cells = rules().cells();
+    if (nibbles() != recordNibbles(rules()) || moves() > cells) {
+      return false;
+    }
+    for (int i = 0; i < moves(); i++) {
+      if (move(i) >= cells) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
+// Iterates the records of blocks [from, to) of a file's blocks. A record
+// that is not valid() ends its block, which counts as corrupt; records of
+// boards this build does not know are skipped.
+class RecordCursor {
+  const unsigned char *d_block;
+  const unsigned char *d_end;
+  size_t d_at;
+  size_t d_corrupt;
+  size_t d_unknown;
+
+ public:
+  RecordCursor(const unsigned char *blocks, size_t from, size_t to)
+      : d_block(blocks + from * RECORD_BLOCK),
+        d_end(blocks + to * RECORD_BLOCK),
+        d_at(0),
+        d_corrupt(0),
+        d_unknown(0) {}
+
+  bool next(RecordView *record) {
+    while (d_block < d_end) {
+      if (d_at + RECORD_HEADER <= RECORD_BLOCK) {
+        const RecordView r(d_block + d_at);
+        if (r.moves() > 0) {
+          if (r.valid(RECORD_BLOCK - d_at)) {
+            d_at += r.bytes();
+            if (!r.knownRules()) {
+              d_unknown++;
+              continue;
+            }
+            *record = r;
+            return true;
+          }
+          d_corrupt++;
+        }
+      }
+      d_block += RECORD_BLOCK;
+      d_at = 0;
+    }
+    return false;
+  }
+
+  // Blocks cut short by a record that is not valid.
+  size_t corrupt() const { return d_corrupt; }
+
+  // Records skipped for a board missing from RECORD_RULES.
+  size_t unknown() const { return d_unknown; }
+};
+
+// An append-only record file shared by writers; each hands it whole
+// blocks, so writers on several threads can share one file.
+class RecordLog {
+  FILE *d_file;
+  std::mutex d_mutex;
+
+ public:
+  RecordLog() : d_file(0), d_mutex() {}
+
+  ~RecordLog() { close(); }
+
+  RecordLog(const RecordLog &) = delete;
+  RecordLog &operator=(const RecordLog &) = delete;
+
+  // Appends to path, creating it with a header if empty. Fails with
+  // EINVAL when path holds records of another format or version.
+  bool open(const char *path) {
+    close();
+    d_file = fopen(path, "a+b");
+    if (!d_file) {
+      return false;
+    }
+    unsigned char header[RECORD_FILE_HEADER] = {};
+    const uint32_t fields[2] = {RECORD_MAGIC, RECORD_VERSION};
+    for (int i = 0; i < 8; i++) {
+      header[i] = uint8_t(fields[i / 4] >> (8 * (i % 4)));
+    }
+    fseek(d_file, 0, SEEK_END);
+    if (ftell(d_file) == 0) {
+      fwrite(header, 1, sizeof(header), d_file);
+      return true;
+    }
+    unsigned char existing[8];
+    rewind(d_file);
+    if (fread(existing, 1, 8, d_file) != 8 ||
+        memcmp(existing, header, 8) != 0) {
+      close();
+      errno = EINVAL;
+      return false;
+    }
+    return true;
+  }
+
+  void close() {
+    if (d_file) {
+      fclose(d_file);
+    }
+    d_file = 0;
+  }
+
+  bool isOpen() const { return d_file != 0; }
+
+  void writeBlock(const unsigned char *block) {
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (d_file) {
+      fwrite(block, 1, RECORD_BLOCK, d_file);
+      fflush(d_file);
+    }
+  }
+};
+
+// Streams games into a RecordLog: begin(), a move() per move and end()
+// encode a record into the writer's block, which goes to the log when the
+// next record does not fit or on flush(). Nothing is allocated per game.
+class RecordWriter {
+  RecordLog *d_log;
+  unsigned char d_block[RECORD_BLOCK];
+  size_t d_used;
+  unsigned char d_record[RECORD_HEADER + 2 * RECORD_MAX_CELLS];
+  int d_rules;  // -1 while no game is recorded
+  bool d_nibbles;
+  int d_moves;
+
+ public:
+  explicit RecordWriter(RecordLog *log)
+      : d_log(log),
+        d_block(),
+        d_used(0),
+        d_record(),
+        d_rules(-1),
+        d_nibbles(false),
+        d_moves(0) {}
+
+  ~RecordWriter() { flush(); }
+
+  RecordWriter(const RecordWriter &) = delete;
+  RecordWriter &operator=(const RecordWriter &) = delete;
+
+  // Starts a game; players per side are RECORD_HUMAN or recordEngine().
+  // Games on boards records cannot hold are not recorded.
+  void begin(const Rules &rules, Side first, int playerX, int playerO,
+             uint64_t seed, double thinkSeconds) {
+    d_rules = recordRules(rules);
+    d_nibbles = recordNibbles(rules);
+    d_moves = 0;
+    const uint32_t s = uint32_t(seed);
+    const int think = int(thinkSeconds * 1000 + 0.5);
+    const uint16_t millis = uint16_t(think < 65535 ? think : 65535);
+    d_record[0] = uint8_t(s);
+    d_record[1] = uint8_t(s >> 8);
+    d_record[2] = uint8_t(s >> 16);
+    d_record[3] = uint8_t(s >> 24);
+    d_record[4] = uint8_t(millis);
+    d_record[5] = uint8_t(millis >> 8);
+    d_record[8] = uint8_t(d_rules);
+    d_record[9] = uint8_t(first << 2 | int(d_nibbles) << 3);
+    d_record[10] = uint8_t(playerX | playerO << 4);
+    if (d_rules >= 0) {
+      memset(d_record + RECORD_HEADER, 0,
+             recordMoveBytes(d_nibbles, rules.cells()));
+    }
+  }
+
+  void move(int cell) {
+    if (d_rules < 0) {
+      return;
+    }
+    unsigned char *m = d_record + RECORD_HEADER;
+    if (d_nibbles) {
+      m[d_moves >> 1] |= uint8_t(cell << ((d_moves & 1) * 4));
+    } else {
+      m[2 * d_moves] = uint8_t(cell);
+      m[2 * d_moves + 1] = uint8_t(cell >> 8);
+    }
+    d_moves++;
+  }
+
+  // Ends the game; games without moves are dropped.
+  void end(Outcome outcome) {
+    if (d_rules < 0 || d_moves == 0) {
+      d_rules = -1;
+      return;
+    }
+    d_record[6] = uint8_t(d_moves);
+    d_record[7] = uint8_t(d_moves >> 8);
+    d_record[9] = uint8_t(d_record[9] | outcome);
+    const size_t bytes = RECORD_HEADER + recordMoveBytes(d_nibbles, d_moves);
+    if (d_used + bytes > RECORD_BLOCK) {
+      flush();
+    }
+    memcpy(d_block + d_used, d_record, bytes);
+    d_used += bytes;
+    d_rules = -1;
+  }
+
+  // Hands the block to the log, zero padded, if it holds any record.
+  void flush() {
+    if (d_used == 0) {
+      return;
+    }
+    memset(d_block + d_used, 0, RECORD_BLOCK - d_used);
+    d_log->writeBlock(d_block);
+    d_used = 0;
+  }
+};
+
+}  // namespace ttt
+
+#endif  // GAMERECORD_H
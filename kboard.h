@@ -0,0 +1,202 @@
+#ifndef KBOARD_H
+#define KBOARD_H
+
+#include "bitboard.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace ttt {
+
+// Board size and the number of stones in a row needed to win.
+struct Rules {
+  int cols;
+  int rows;
+  int k;
+
+  int cells() const { return cols * rows; }
+
+  bool operator==(const Rules &o) const {
+    return cols == o.cols && rows == o.rows && k == o.k;
+  }
+  bool operator!=(const Rules &o) const { return !(*this == o); }
+};
+
+const Rules RULES_3X3 = {3, 3, 3};
+const Rules RULES_4X4 = {4, 4, 4};
+const Rules RULES_15X15 = {15, 15, 5};
+const Rules RULES_19X19 = {19, 19, 5};
+const Rules RULES_100X100 = {100, 100, 5};
+
+// A run of stones, from and to are the cell indices of both ends.
+struct Line {
+  int from;
+  int to;
+  int length;
+};
+
+inline int popCount64(uint64_t m) { return __builtin_popcountll(m); }
+
+inline int lowestBit64(uint64_t m) { return __builtin_ctzll(m); }
+
+// An N x M position with one bitset per side. Cell idx = col + cols * row,
+// the same layout as BitBoard for 3x3.
+class KBoard {
+ public:
+  // Lines through a cell: horizontal, vertical, diagonal, anti-diagonal.
+  static const int NUM_DIRECTIONS = 4;
+
+ private:
+  Rules d_rules;
+  int d_words;
+  std::vector<uint64_t> d_bits[2];
+  int d_count;
+
+  static int dirCol(int dir) { return dir == 1 ? 0 : 1; }
+  static int dirRow(int dir) { return dir == 0 ? 0 : (dir == 3 ? -1 : 1); }
+
+  // Number of consecutive s stones from (col, row), exclusive, stepping by
+  // (dc, dr), at most limit. Sets *end to the last stone of the run.
+  int countRun(int col, int row, int dc, int dr, Side s, int limit,
+               int *end) const {
+    int n = 0;
+    for (;;) {
+      col += dc;
+      row += dr;
+      if (n == limit || col < 0 || row < 0 || col >= d_rules.cols ||
+          row >= d_rules.rows || !has(index(col, row), s)) {
+        return n;
+      }
+      *end = index(col, row);
+      n++;
+    }
+  }
+
+ public:
+  explicit KBoard(const Rules &rules = RULES_3X3) : d_count(0) {
+    reset(rules);
+  }
+
+  void reset(const Rules &rules) {
+    d_rules = rules;
+    d_words = (rules.cells() + 63) / 64;
+    d_bits[SIDE_X].assign(d_words, 0);
+    d_bits[SIDE_O].assign(d_words, 0);
+    d_count = 0;
+  }
+
+  void reset() { reset(d_rules); }
+
+  const Rules &rules() const { return d_rules; }
+  int cols() const { return d_rules.cols; }
+  int rows() const { return d_rules.rows; }
+  int cells() const { return d_rules.cells(); }
+  int words() const { return d_words; }
+
+  int index(int col, int row) const { return col + d_rules.cols * row; }
+  int col(int idx) const { return idx % d_rules.cols; }
+  int row(int idx) const { return idx / d_rules.cols; }
+  int center() const { return index(d_rules.cols / 2, d_rules.rows / 2); }
+
+  int count() const { return d_count; }
+  int emptyCount() const { return cells() - d_count; }
+  bool isFull() const { return d_count == cells(); }
+
+  bool has(int idx, Side s) const {
+    return (d_bits[s][idx >> 6] >> (idx & 63)) & 1;
+  }
+
+  bool isEmpty(int idx) const {
+    return !has(idx, SIDE_X) && !has(idx, SIDE_O);
+  }
+
+  uint64_t bits(Side s, int word) const { return d_bits[s][word]; }
+
+  // Empty cells of one 64-cell word, padding bits past the board cleared.
+  uint64_t emptyWord(int word) const {
+    uint64_t e = ~(d_bits[SIDE_X][word] | d_bits[SIDE_O][word]);
+    const int tail = cells() - word * 64;
+    if (tail < 64) {
+      e &= (uint64_t(1) << tail) - 1;
+    }
+    return e;
+  }
+
+  // Index of the n-th (0-based) empty cell; n must be below emptyCount().
+  int nthEmpty(int n) const {
+    for (int w = 0; w < d_words; w++) {
+      uint64_t e = emptyWord(w);
+      const int c = popCount64(e);
+      if (n < c) {
+        while (n-- > 0) {
+          e &= e - 1;
+        }
+        return w * 64 + lowestBit64(e);
+      }
+      n -= c;
+    }
+    return -1;
+  }
+
+  void play(int idx, Side s) {
+    d_bits[s][idx >> 6] |= uint64_t(1) << (idx & 63);
+    d_count++;
+  }
+
+  void undo(int idx, Side s) {
+    d_bits[s][idx >> 6] &= ~(uint64_t(1) << (idx & 63));
+    d_count--;
+  }
+
+  // Longest run of s through idx along one direction, capped at k on each
+  // side so the cost is O(k) whatever the board size.
+  Line runThrough(int idx, Side s, int dir) const {
+    const int c = col(idx);
+    const int r = row(idx);
+    const int dc = dirCol(dir);
+    const int dr = dirRow(dir);
+    const int limit = d_rules.k - 1;
+    Line line = {idx, idx, 1};
+    line.length += countRun(c, r, -dc, -dr, s, limit, &line.from);
+    line.length += countRun(c, r, dc, dr, s, limit, &line.to);
+    return line;
+  }
+
+  // Whether the stone of s at idx completes k in a row. Only the four lines
+  // through idx are inspected, so this is the incremental win check to run
+  // after each move.
+  bool lineThrough(int idx, Side s, Line *line) const {
+    for (int dir = 0; dir < NUM_DIRECTIONS; dir++) {
+      const Line l = runThrough(idx, s, dir);
+      if (l.length >= d_rules.k) {
+        if (line) {
+          *line = l;
+        }
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Whether s playing the empty cell idx would win.
+  bool isWinningMove(int idx, Side s) const {
+    for (int dir = 0; dir < NUM_DIRECTIONS; dir++) {
+      if (runThrough(idx, s, dir).length >= d_rules.k) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // The 3x3 board as a BitBoard; only meaningful for RULES_3X3.
+  BitBoard toBitBoard() const {
+    BitBoard b;
+    b.bits[SIDE_X] = Mask(d_bits[SIDE_X][0] & FULL_MASK);
+    b.bits[SIDE_O] = Mask(d_bits[SIDE_O][0] & FULL_MASK);
+    return b;
+  }
+};
+
+}  // namespace ttt
+
+#endif  // KBOARD_H
@@ -0,0 +1,423 @@
+// Load generator for tic-tac-toe-server: keeps --sessions games going over
+// --connections sockets, playing random legal moves as X, and reports
+// games/s, moves/s and the latency of the server's answer to each move.
+// Linux only.
+
+#include "game.h"
+#include "histogram.h"
+#include "ttable.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct Options {
+  int port;
+  std::string unixPath;
+  int connections;
+  int sessions;  // concurrent games
+  double seconds;
+  int board;
+  std::string level;
+  uint64_t seed;
+};
+
+const int MAX_EVENTS = 256;
+const size_t READ_CHUNK = 64 << 10;
+
+void usage() {
+  std::cerr << "usage: tic-tac-toe-loadgen [options]\n"
+               "  --port N          server TCP port on 127.0.0.1 (7878)\n"
+               "  --unix PATH       server Unix socket instead\n"
+               "  --connections N   sockets (64)\n"
+               "  --sessions N      concurrent games (1024)\n"
+               "  --seconds S       run time (5)\n"
+               "  --board 3|15|19   board variant (3)\n"
+               "  --level L         easy|hard|mcts (easy)\n"
+               "  --seed N          random seed (1)\n";
+}
+
+bool parseArgs(int argc, char **argv, Options *o) {
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char *value = argv[++i];
+    if (arg == "--port") {
+      o->port = atoi(value);
+    } else if (arg == "--unix") {
+      o->unixPath = value;
+    } else if (arg == "--connections") {
+      o->connections = atoi(value);
+    } else if (arg == "--sessions") {
+      o->sessions = atoi(value);
+    } else if (arg == "--seconds") {
+      o->seconds = atof(value);
+    } else if (arg == "--board") {
+      o->board = atoi(value);
+    } else if (arg == "--level") {
+      o->level = value;
+    } else if (arg == "--seed") {
+      o->seed = strtoull(value, 0, 10);
+    } else {
+      return false;
+    }
+  }
+  return o->connections > 0 && o->sessions > 0 &&
+         (o->board == 3 || o->board == 15 || o->board == 19);
+}
+
+int connectTo(const Options &o) {
+  int fd;
+  int rc;
+  if (o.unixPath.empty()) {
+    fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(uint16_t(o.port));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    rc = ::connect(fd, (sockaddr *)&addr, sizeof(addr));
+    const int one = 1;
+    ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  } else {
+    fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, o.unixPath.c_str(), sizeof(addr.sun_path) - 1);
+    rc = ::connect(fd, (sockaddr *)&addr, sizeof(addr));
+  }
+  if (rc != 0) {
+    ::close(fd);
+    return -1;
+  }
+  ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  return fd;
+}
+
+// A game slot, restarted with a new server session when its game ends.
+struct Slot {
+  ttt::Game game;
+  int conn;
+  Clock::time_point sent;  // of the move awaiting an answer
+  bool waiting;
+};
+
+struct Connection {
+  int fd;
+  std::string in;
+  std::string out;
+  std::deque<int> opening;  // slots whose "new" awaits its "ok"
+};
+
+class LoadGen {
+  Options d_options;
+  ttt::Rules d_rules;
+  int d_epoll;
+  std::vector<Connection> d_conns;
+  std::vector<Slot> d_slots;
+  // by connection and sid: a freed sid can be handed out on another
+  // connection before its "end" is read here
+  std::unordered_map<uint64_t, int> d_bySid;
+  uint64_t d_rng;
+  bool d_stopping;
+  uint64_t d_games;
+  uint64_t d_moves;
+  uint64_t d_errors;
+  int d_refused;  // slots whose "new" the server turned down
+  ttt::Histogram d_latency;  // nanoseconds
+
+  static uint64_t key(int conn, uint32_t sid) {
+    return uint64_t(conn) << 32 | sid;
+  }
+
+  void send(int conn, const char *line) {
+    d_conns[conn].out += line;
+  }
+
+  void open(int slot) {
+    Slot &s = d_slots[slot];
+    char line[64];
+    snprintf(line, sizeof(line), "new %d %s me\n", d_options.board,
+             d_options.level.c_str());
+    send(s.conn, line);
+    d_conns[s.conn].opening.push_back(slot);
+  }
+
+  void playRandom(uint32_t sid, Slot &s) {
+    const ttt::KBoard &b = s.game.board();
+    int n = int(ttt::splitMix64(&d_rng) % uint64_t(b.emptyCount()));
+    int cell = 0;
+    for (;; cell++) {
+      if (b.isEmpty(cell) && n-- == 0) {
+        break;
+      }
+    }
+    s.game.play(cell);
+    d_moves++;
+    char line[64];
+    snprintf(line, sizeof(line), "play %u %d\n", sid, cell);
+    send(s.conn, line);
+    s.sent = Clock::now();
+    s.waiting = true;
+  }
+
+  void answered(Slot &s) {
+    if (s.waiting) {
+      d_latency.record(uint64_t(std::chrono::duration_cast<
+                                    std::chrono::nanoseconds>(
+                                    Clock::now() - s.sent)
+                                    .count()));
+      s.waiting = false;
+    }
+  }
+
+  void reply(int conn, const char *line) {
+    char word[8];
+    unsigned sid;
+    char arg[16];
+    Connection &c = d_conns[conn];
+    // "err - <reason>" answers the oldest "new"; a full server or a
+    // rejected request leaves its slot closed, and it is reported
+    if (sscanf(line, "err - %15s", arg) == 1 &&
+        (strcmp(arg, "full") == 0 || strcmp(arg, "bad_request") == 0) &&
+        !c.opening.empty()) {
+      c.opening.pop_front();
+      d_refused++;
+      return;
+    }
+    const int n = sscanf(line, "%7s %u %15s", word, &sid, arg);
+    if (n >= 2 && strcmp(word, "ok") == 0) {
+      if (c.opening.empty()) {
+        d_errors++;
+        return;
+      }
+      const int slot = c.opening.front();
+      c.opening.pop_front();
+      d_bySid[key(conn, sid)] = slot;
+      Slot &s = d_slots[slot];
+      s.game.reset(d_rules, ttt::SIDE_X);
+      playRandom(sid, s);
+      return;
+    }
+    if (n < 3 || (strcmp(word, "move") != 0 && strcmp(word, "end") != 0)) {
+      d_errors++;
+      return;
+    }
+    const auto found = d_bySid.find(key(conn, sid));
+    if (found == d_bySid.end()) {
+      d_errors++;
+      return;
+    }
+    const int slot = found->second;
+    Slot &s = d_slots[slot];
+    answered(s);
+    if (strcmp(word, "move") == 0) {
+      if (!s.game.play(atoi(arg))) {
+        d_errors++;
+      }
+      d_moves++;
+      if (!s.game.finished()) {
+        playRandom(sid, s);
+      }
+      return;
+    }
+    d_games++;
+    d_bySid.erase(found);
+    if (!d_stopping) {
+      open(slot);
+    }
+  }
+
+  bool flush(int conn) {
+    Connection &c = d_conns[conn];
+    size_t done = 0;
+    while (done < c.out.size()) {
+      const ssize_t n = ::send(c.fd, c.out.data() + done,
+                               c.out.size() - done, MSG_NOSIGNAL);
+      if (n < 0 && errno != EAGAIN && errno != EINTR) {
+        return false;
+      }
+      if (n <= 0) {
+        break;
+      }
+      done += size_t(n);
+    }
+    c.out.erase(0, done);
+    epoll_event ev;
+    ev.events = EPOLLIN | (c.out.empty() ? 0u : uint32_t(EPOLLOUT));
+    ev.data.u32 = uint32_t(conn);
+    ::epoll_ctl(d_epoll, EPOLL_CTL_MOD, c.fd, &ev);
+    return true;
+  }
+
+  bool readable(int conn) {
+    Connection &c = d_conns[conn];
+    char buffer[READ_CHUNK];
+    for (;;) {
+      const ssize_t n = ::recv(c.fd, buffer, sizeof(buffer), 0);
+      if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR)) {
+        return false;
+      }
+      if (n < 0) {
+        break;
+      }
+      c.in.append(buffer, size_t(n));
+    }
+    size_t start = 0;
+    for (size_t nl; (nl = c.in.find('\n', start)) != std::string::npos;
+         start = nl + 1) {
+      c.in[nl] = '\0';
+      reply(conn, &c.in[start]);
+    }
+    c.in.erase(0, start);
+    return true;
+  }
+
+ public:
+  explicit LoadGen(const Options &o)
+      : d_options(o),
+        d_rules(o.board == 15 ? ttt::RULES_15X15
+                              : (o.board == 19 ? ttt::RULES_19X19
+                                               : ttt::RULES_3X3)),
+        d_epoll(-1),
+        d_conns(),
+        d_slots(),
+        d_bySid(),
+        d_rng(o.seed),
+        d_stopping(false),
+        d_games(0),
+        d_moves(0),
+        d_errors(0),
+        d_refused(0),
+        d_latency() {}
+
+  ~LoadGen() {
+    for (const Connection &c : d_conns) {
+      ::close(c.fd);
+    }
+    if (d_epoll >= 0) {
+      ::close(d_epoll);
+    }
+  }
+
+  LoadGen(const LoadGen &) = delete;
+  LoadGen &operator=(const LoadGen &) = delete;
+
+  bool connect() {
+    d_epoll = ::epoll_create1(0);
+    for (int i = 0; i < d_options.connections; i++) {
+      Connection c;
+      c.fd = connectTo(d_options);
+      if (c.fd < 0) {
+        return false;
+      }
+      epoll_event ev;
+      ev.events = EPOLLIN;
+      ev.data.u32 = uint32_t(d_conns.size());
+      ::epoll_ctl(d_epoll, EPOLL_CTL_ADD, c.fd, &ev);
+      d_conns.push_back(c);
+    }
+    d_slots.resize(size_t(d_options.sessions));
+    d_bySid.reserve(size_t(d_options.sessions) * 2);
+    for (int i = 0; i < d_options.sessions; i++) {
+      d_slots[i].conn = i % d_options.connections;
+      d_slots[i].waiting = false;
+      open(i);
+    }
+    return true;
+  }
+
+  // Plays until the time is up; false when the server went away.
+  bool run() {
+    const Clock::time_point start = Clock::now();
+    epoll_event events[MAX_EVENTS];
+    for (size_t c = 0; c < d_conns.size(); c++) {
+      flush(int(c));
+    }
+    double seconds = 0;
+    while (seconds < d_options.seconds) {
+      const int n = ::epoll_wait(d_epoll, events, MAX_EVENTS, 100);
+      for (int i = 0; i < n; i++) {
+        const int conn = int(events[i].data.u32);
+        if ((events[i].events & (EPOLLERR | EPOLLHUP)) ||
+            ((events[i].events & EPOLLIN) && !readable(conn))) {
+          return false;
+        }
+      }
+      for (size_t c = 0; c < d_conns.size(); c++) {
+        if (!d_conns[c].out.empty() && !flush(int(c))) {
+          return false;
+        }
+      }
+      seconds = std::chrono::duration<double>(Clock::now() - start).count();
+    }
+    d_stopping = true;
+
+    printf("board        %dx%d, AI %s\n", d_rules.cols, d_rules.rows,
+           d_options.level.c_str());
+    printf("load         %d sessions over %d connections\n",
+           d_options.sessions - d_refused, d_options.connections);
+    if (d_refused) {
+      printf("refused      %d sessions turned down by the server\n", d_refused);
+    }
+    printf("games        %llu in %.3f s, %.0f games/s\n",
+           (unsigned long long)d_games, seconds, d_games / seconds);
+    printf("moves        %llu, %.0f moves/s\n", (unsigned long long)d_moves,
+           d_moves / seconds);
+    printf("reply us     p50 %.1f p95 %.1f p99 %.1f max %.1f\n",
+           d_latency.percentile(50) / 1e3, d_latency.percentile(95) / 1e3,
+           d_latency.percentile(99) / 1e3, d_latency.max() / 1e3);
+    printf("errors       %llu\n", (unsigned long long)d_errors);
+    return true;
+  }
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options o;
+  o.port = 7878;
+  o.connections = 64;
+  o.sessions = 1024;
+  o.seconds = 5;
+  o.board = 3;
+  o.level = "easy";
+  o.seed = 1;
+  if (!parseArgs(argc, argv, &o)) {
+    usage();
+    return 1;
+  }
+  LoadGen load(o);
+  if (!load.connect()) {
+    perror("tic-tac-toe-loadgen: connect");
+    return 1;
+  }
+  if (!load.run()) {
+    fprintf(stderr, "tic-tac-toe-loadgen: server closed the connection\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,306 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <type_traits>
+
+// Levels below TTT_LOG_LEVEL compile to nothing.
+#define TTT_LOG_LEVEL_DEBUG 0
+#define TTT_LOG_LEVEL_INFO 1
+#define TTT_LOG_LEVEL_WARN 2
+#define TTT_LOG_LEVEL_ERROR 3
+#define TTT_LOG_LEVEL_OFF 4
+
+#ifndef TTT_LOG_LEVEL
+#define TTT_LOG_LEVEL TTT_LOG_LEVEL_INFO
+#endif
+
+namespace ttt {
+
+enum LogLevel { LOG_DEBUG, LOG_INFO, LOG_WARN, LOG_ERROR };
+
+inline const char *logLevelName(LogLevel l) {
+  static const char *const NAMES[] = {"debug", "info", "warn", "error"};
+  return NAMES[l];
+}
+
+// One key/value of an event. Keys and string values must outlive the
+// event, in practice they are literals: nothing is formatted or copied on
+// the logging thread.
+struct LogField {
+  enum Kind { INT, REAL, TEXT };
+
+  const char *key;
+  Kind kind;
+  union {
+    int64_t i;
+    double d;
+    const char *s;
+  };
+
+  LogField() : key(""), kind(INT), i(0) {}
+
+  template <class T, typename std::enable_if<std::is_integral<T>::value,
+                                             int>::type = 0>
+  LogField(const char *k, T v) : key(k), kind(INT), i(int64_t(v)) {}
+
+  LogField(const char *k, double v) : key(k), kind(REAL), d(v) {}
+
+  LogField(const char *k, const char *v) : key(k), kind(TEXT), s(v) {}
+};
+
+struct LogEvent {
+  static const int MAX_FIELDS = 8;
+
+  uint64_t nanos;  // since the logger started
+  LogLevel level;
+  const char *name;
+  int numFields;
+  LogField fields[MAX_FIELDS];
+};
+
+// Structured events through a bounded lock-free ring: any thread logs with
+// a couple of atomics and a copy, one thread at a time drains and formats.
+// A full ring drops events and counts them rather than block, unless set
+// to wait for the drainer.
+class Logger {
+ public:
+  static const size_t CAPACITY = 1024;
+
+ private:
+  struct Slot {
+    std::atomic<uint64_t> sequence;
+    LogEvent event;
+  };
+
+  std::unique_ptr<Slot[]> d_slots;
+  std::atomic<uint64_t> d_tail;
+  uint64_t d_head;
+  std::atomic<uint64_t> d_dropped;
+  std::mutex d_drainMutex;
+  std::chrono::steady_clock::time_point d_start;
+  bool d_json;
+  std::atomic<bool> d_blocking;
+
+  static void writeString(std::ostream &out, const char *s) {
+    out << '"';
+    for (; *s; s++) {
+      if (*s == '"' || *s == '\\') {
+        out << '\\';
+      }
+      out << *s;
+    }
+    out << '"';
+  }
+
+  void write(std::ostream &out, const LogEvent &e) const {
+    char time[32];
+    snprintf(time, sizeof(time), "%.6f", e.nanos / 1e9);
+    if (d_json) {
+      out << "{\"t\":" << time << ",\"level\":\"" << logLevelName(e.level)
+          << "\",\"event\":";
+      writeString(out, e.name);
+    } else {
+      out << time << ' ' << logLevelName(e.level) << ' ' << e.name;
+    }
+    for (int i = 0; i < e.numFields; i++) {
+      const LogField &f = e.fields[i];
+      if (d_json) {
+        out << ',';
+        writeString(out, f.key);
+        out << ':';
+      } else {
+        out << ' ' << f.key << '=';
+      }
+      if (f.kind == LogField::INT) {
+        out << f.i;
+      } else if (f.kind == LogField::REAL) {
+        out << f.d;
+      } else if (d_json) {
+        writeString(out, f.s);
+      } else {
+        out << f.s;
+      }
+    }
+    out << (d_json ? "}\n" : "\n");
+  }
+
+ public:
+  Logger()
+      : d_slots(new Slot[CAPACITY]),
+        d_tail(0),
+        d_head(0),
+        d_dropped(0),
+        d_start(std::chrono::steady_clock::now()),
+        d_json(false),
+        d_blocking(false) {
+    for (size_t i = 0; i < CAPACITY; i++) {
+      d_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  Logger(const Logger &) = delete;
+  Logger &operator=(const Logger &) = delete;
+
+  // JSON lines instead of "seconds level event key=value ...".
+  void setJson(bool json) { d_json = json; }
+
+  // Whether a full ring makes log() wait instead of dropping; for tools
+  // that must not lose events and drain from another thread.
+  void setBlocking(bool blocking) { d_blocking = blocking; }
+
+  uint64_t dropped() const { return d_dropped.load(); }
+
+  void log(LogLevel level, const char *name,
+           std::initializer_list<LogField> fields) {
+    uint64_t pos = d_tail.load(std::memory_order_relaxed);
+    Slot *slot;
+    for (;;) {
+      slot = &d_slots[pos % CAPACITY];
+      const uint64_t seq = slot->sequence.load(std::memory_order_acquire);
+      const int64_t diff = int64_t(seq) - int64_t(pos);
+      if (diff == 0) {
+        if (d_tail.compare_exchange_weak(pos, pos + 1,
+                                         std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        if (!d_blocking.load(std::memory_order_relaxed)) {
+          d_dropped.fetch_add(1, std::memory_order_relaxed);
+          return;
+        }
+        std::this_thread::yield();
+        pos = d_tail.load(std::memory_order_relaxed);
+      } else {
+        pos = d_tail.load(std::memory_order_relaxed);
+      }
+    }
+
+    LogEvent &e = slot->event;
+    e.nanos = uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - d_start)
+                           .count());
+    e.level = level;
+    e.name = name;
+    e.numFields = 0;
+    for (const LogField &f : fields) {
+      if (e.numFields < LogEvent::MAX_FIELDS) {
+        e.fields[e.numFields++] = f;
+      }
+    }
+    slot->sequence.store(pos + 1, std::memory_order_release);
+  }
+
+  // Formats every queued event to out and flushes once; returns how many.
+  // Concurrent callers return 0 instead of waiting.
+  size_t drain(std::ostream &out) {
+    std::unique_lock<std::mutex> lock(d_drainMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+      return 0;
+    }
+    size_t n = 0;
+    for (;;) {
+      Slot &slot = d_slots[d_head % CAPACITY];
+      if (slot.sequence.load(std::memory_order_acquire) != d_head + 1) {
+        break;
+      }
+      write(out, slot.event);
+      slot.sequence.store(d_head + CAPACITY, std::memory_order_release);
+      d_head++;
+      n++;
+    }
+    if (n) {
+      out.flush();
+    }
+    return n;
+  }
+};
+
+inline Logger &logger() {
+  static Logger instance;
+  return instance;
+}
+
+// Drains the logger to a stream from a background thread until destroyed.
+class LogDrainer {
+  std::ostream &d_out;
+  std::atomic<bool> d_stop;
+  std::thread d_thread;
+
+  void run() {
+    while (!d_stop.load()) {
+      if (logger().drain(d_out) == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      }
+    }
+  }
+
+ public:
+  explicit LogDrainer(std::ostream &out)
+      : d_out(out), d_stop(false), d_thread(&LogDrainer::run, this) {}
+
+  ~LogDrainer() {
+    d_stop = true;
+    d_thread.join();
+    while (logger().drain(d_out)) {
+    }
+  }
+
+  LogDrainer(const LogDrainer &) = delete;
+  LogDrainer &operator=(const LogDrainer &) = delete;
+};
+
+}  // namespace ttt
+
+// Disabled levels still type-check their arguments, keeping variables used
+// only for logging warning-free, but never evaluate them and generate no
+// code.
+#define TTT_LOG_DISABLED(level, name, ...)                      \
+  do {                                                          \
+    if (false) {                                                \
+      ::ttt::logger().log(level, name, {__VA_ARGS__});          \
+    }                                                           \
+  } while (0)
+
+// TTT_LOG_INFO("move", {"cell", 4}, {"side", "X"}, {"seconds", 0.5});
+#if TTT_LOG_LEVEL <= TTT_LOG_LEVEL_DEBUG
+#define TTT_LOG_DEBUG(name, ...) \
+  ::ttt::logger().log(::ttt::LOG_DEBUG, name, {__VA_ARGS__})
+#else
+#define TTT_LOG_DEBUG(name, ...) \
+  TTT_LOG_DISABLED(::ttt::LOG_DEBUG, name, __VA_ARGS__)
+#endif
+
+#if TTT_LOG_LEVEL <= TTT_LOG_LEVEL_INFO
+#define TTT_LOG_INFO(name, ...) \
+  ::ttt::logger().log(::ttt::LOG_INFO, name, {__VA_ARGS__})
+#else
+#define TTT_LOG_INFO(name, ...) \
+  TTT_LOG_DISABLED(::ttt::LOG_INFO, name, __VA_ARGS__)
+#endif
+
+#if TTT_LOG_LEVEL <= TTT_LOG_LEVEL_WARN
+#define TTT_LOG_WARN(name, ...) \
+  ::ttt::logger().log(::ttt::LOG_WARN, name, {__VA_ARGS__})
+#else
+#define TTT_LOG_WARN(name, ...) \
+  TTT_LOG_DISABLED(::ttt::LOG_WARN, name, __VA_ARGS__)
+#endif
+
+#if TTT_LOG_LEVEL <= TTT_LOG_LEVEL_ERROR
+#define TTT_LOG_ERROR(name, ...) \
+  ::ttt::logger().log(::ttt::LOG_ERROR, name, {__VA_ARGS__})
+#else
+#define TTT_LOG_ERROR(name, ...) \
+  TTT_LOG_DISABLED(::ttt::LOG_ERROR, name, __VA_ARGS__)
+#endif
+
+#endif  // LOG_H
@@ -0,0 +1,357 @@
+#ifndef MCTS_H
+#define MCTS_H
+
+#include "arena.h"
+#include "kboard.h"
+#include "ttable.h"
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ttt {
+
+// Tree memory of one MCTS move.
+const size_t MCTS_ARENA_BYTES = 32 << 20;
+
+struct MctsLimits {
+  double maxSeconds;     // 0 is no time limit
+  uint64_t maxPlayouts;  // 0 is no playout limit
+};
+
+struct MctsResult {
+  int move;
+  double winRate;  // of the chosen move for the side to move
+  uint64_t playouts;
+  uint64_t nodes;
+  size_t arenaBytes;
+  double seconds;
+
+  double playoutsPerSecond() const {
+    return seconds > 0 ? playouts / seconds : 0.0;
+  }
+};
+
+// Monte Carlo tree search (UCT) for boards too large to search full width.
+// Tree nodes live in an arena that is reset every move, so memory is bounded
+// by its size: once it is full the tree stops growing and playouts continue
+// from the leaves. Playouts draw random empty cells straight from the board
+// bitmasks and detect wins incrementally; nothing is allocated per playout.
+class Mcts {
+  enum { NOT_TERMINAL = 0, TERMINAL_WIN = 1 };
+
+  struct Node {
+    Node *children;
+    int numChildren;  // -1 until expanded
+    int move;
+    int terminal;
+    uint32_t visits;
+    float reward;  // summed for the side that played move: win 1, draw 0.5
+
+    Node()
+        : children(0),
+          numChildren(-1),
+          move(-1),
+          terminal(NOT_TERMINAL),
+          visits(0),
+          reward(0) {}
+  };
+
+  struct Played {
+    int move;
+    Side side;
+  };
+
+  Arena d_arena;
+  KBoard d_board;
+  std::vector<Played> d_played;
+  std::vector<Node *> d_path;
+  std::vector<uint8_t> d_mark;
+  std::vector<int> d_candidates;
+  uint64_t d_rng;
+  uint64_t d_nodes;
+  std::atomic<bool> *d_abort;
+  std::chrono::steady_clock::time_point d_start;
+  MctsLimits d_limits;
+  Side d_toMove;
+  Node *d_root;
+  MctsResult d_result;
+  bool d_done;
+
+  int random(int n) { return int(splitMix64(&d_rng) % uint64_t(n)); }
+
+  void play(int move, Side s) {
+    d_board.play(move, s);
+    d_played.push_back(Played{move, s});
+  }
+
+  void undoAll() {
+    while (!d_played.empty()) {
+      d_board.undo(d_played.back().move, d_played.back().side);
+      d_played.pop_back();
+    }
+  }
+
+  // Empty cells next to a stone on large boards, every empty cell on small
+  // ones, the center on an empty board.
+  void candidates() {
+    d_candidates.clear();
+    const int cells = d_board.cells();
+    if (cells <= 64 || d_board.count() == 0) {
+      if (cells > 64) {
+        d_candidates.push_back(d_board.center());
+        return;
+      }
+      for (int idx = 0; idx < cells; idx++) {
+        if (d_board.isEmpty(idx)) {
+          d_candidates.push_back(idx);
+        }
+      }
+      return;
+    }
+    for (int idx = 0; idx < cells; idx++) {
+      d_mark[idx] = 0;
+    }
+    for (int idx = 0; idx < cells; idx++) {
+      if (d_board.isEmpty(idx)) {
+        continue;
+      }
+      const int c = d_board.col(idx);
+      const int r = d_board.row(idx);
+      for (int dr = -1; dr <= 1; dr++) {
+        for (int dc = -1; dc <= 1; dc++) {
+          const int nc = c + dc;
+          const int nr = r + dr;
+          if (nc < 0 || nr < 0 || nc >= d_board.cols() ||
+              nr >= d_board.rows()) {
+            continue;
+          }
+          const int n = d_board.index(nc, nr);
+          if (!d_mark[n] && d_board.isEmpty(n)) {
+            d_mark[n] = 1;
+            d_candidates.push_back(n);
+          }
+        }
+      }
+    }
+  }
+
+  // Children for s to move; false when the arena is full.
+  bool expand(Node *node, Side s) {
+    candidates();
+    Node *children = d_arena.allocate<Node>(d_candidates.size());
+    if (!children) {
+      return false;
+    }
+    for (size_t i = 0; i < d_candidates.size(); i++) {
+      children[i].move = d_candidates[i];
+      children[i].terminal = d_board.isWinningMove(d_candidates[i], s)
+                                 ? TERMINAL_WIN
+                                 : NOT_TERMINAL;
+    }
+    node->children = children;
+    node->numChildren = int(d_candidates.size());
+    d_nodes += d_candidates.size();
+    return true;
+  }
+
+  // UCB1 with unvisited children first.
+  Node *select(Node *node) const {
+    const double logVisits = std::log(double(node->visits));
+    Node *best = 0;
+    double bestValue = -1;
+    for (int i = 0; i < node->numChildren; i++) {
+      Node *child = &node->children[i];
+      if (child->visits == 0) {
+        return child;
+      }
+      const double value =
+          child->reward / child->visits +
+          1.4 * std::sqrt(logVisits / child->visits);
+      if (value > bestValue) {
+        bestValue = value;
+        best = child;
+      }
+    }
+    return best;
+  }
+
+  // Random game from the current board with s to move; the winner or -1.
+  int playout(Side s) {
+    while (!d_board.isFull()) {
+      const int move = d_board.nthEmpty(random(d_board.emptyCount()));
+      play(move, s);
+      if (d_board.lineThrough(move, s, 0)) {
+        return s;
+      }
+      s = otherSide(s);
+    }
+    return -1;
+  }
+
+  void iterate(Node *root, Side toMove) {
+    d_path.clear();
+    d_path.push_back(root);
+    Node *node = root;
+    Side s = toMove;
+    while (node->numChildren > 0 && node->terminal == NOT_TERMINAL) {
+      node = select(node);
+      play(node->move, s);
+      d_path.push_back(node);
+      s = otherSide(s);
+    }
+
+    // reward for the side that played into node, the one not to move
+    double reward = 0.5;
+    if (node->terminal == TERMINAL_WIN) {
+      reward = 1;
+    } else if (!d_board.isFull()) {
+      if ((node->visits > 0 || node == root) && expand(node, s)) {
+        node = select(node);
+        play(node->move, s);
+        d_path.push_back(node);
+        s = otherSide(s);
+      }
+      if (node->terminal == TERMINAL_WIN) {
+        reward = 1;
+      } else {
+        const int winner = playout(s);
+        reward = winner < 0 ? 0.5 : (winner == s ? 0.0 : 1.0);
+      }
+    }
+
+    for (size_t i = d_path.size(); i-- > 0;) {
+      d_path[i]->visits++;
+      d_path[i]->reward += float(reward);
+      reward = 1 - reward;
+    }
+    undoAll();
+  }
+
+ public:
+  explicit Mcts(size_t arenaBytes = MCTS_ARENA_BYTES, uint64_t seed = 1)
+      : d_arena(arenaBytes),
+        d_rng(seed),
+        d_nodes(0),
+        d_abort(0),
+        d_limits(),
+        d_toMove(SIDE_X),
+        d_root(0),
+        d_result(),
+        d_done(true) {}
+
+  Mcts(const Mcts &) = delete;
+  Mcts &operator=(const Mcts &) = delete;
+
+  void seed(uint64_t seed) { d_rng = seed; }
+
+  void setArenaBytes(size_t bytes) { d_arena.setCapacity(bytes); }
+
+  // Ends run() after the current playout once set.
+  void setAbort(std::atomic<bool> *abort) { d_abort = abort; }
+
+  // Best move for toMove by visit count. Without any limit a small playout
+  // budget applies.
+  MctsResult run(const KBoard &board, Side toMove, MctsLimits limits) {
+    start(board, toMove, limits);
+    step(0);
+    return d_result;
+  }
+
+  // Sets up a run that step() carries out a slice at a time, the time
+  // limit counting from here.
+  void start(const KBoard &board, Side toMove, MctsLimits limits) {
+    d_start = std::chrono::steady_clock::now();
+    if (limits.maxSeconds <= 0 && limits.maxPlayouts == 0) {
+      limits.maxPlayouts = 10000;
+    }
+    d_limits = limits;
+    d_toMove = toMove;
+
+    d_arena.reset();
+    d_board = board;
+    d_played.reserve(board.cells());
+    d_path.reserve(board.cells() + 1);
+    d_mark.resize(board.cells());
+    d_candidates.reserve(board.cells());
+    d_nodes = 1;
+
+    d_result = MctsResult{-1, 0, 0, 0, 0, 0};
+    d_root = d_arena.allocate<Node>(1);
+    d_done = !d_root || board.isFull();
+  }
+
+  // Plays out for about sliceSeconds more, or to a limit with 0; true once
+  // done, with the move in result().
+  bool step(double sliceSeconds) {
+    typedef std::chrono::steady_clock Clock;
+    if (d_done) {
+      return true;
+    }
+    const Clock::time_point sliceStart = Clock::now();
+    bool finished = false;
+    for (;;) {
+      iterate(d_root, d_toMove);
+      d_result.playouts++;
+      if (d_limits.maxPlayouts && d_result.playouts >= d_limits.maxPlayouts) {
+        finished = true;
+        break;
+      }
+      if (d_abort && d_abort->load(std::memory_order_relaxed)) {
+        finished = true;
+        break;
+      }
+      if ((d_result.playouts & 63) == 0) {
+        const Clock::time_point now = Clock::now();
+        if (d_limits.maxSeconds > 0 &&
+            std::chrono::duration<double>(now - d_start).count() >=
+                d_limits.maxSeconds) {
+          finished = true;
+          break;
+        }
+        if (sliceSeconds > 0 &&
+            std::chrono::duration<double>(now - sliceStart).count() >=
+                sliceSeconds) {
+          break;
+        }
+      }
+      if (d_root->numChildren < 0) {
+        finished = true;
+        break;  // the arena cannot even hold the root's children
+      }
+    }
+    if (!finished) {
+      return false;
+    }
+
+    const Node *best = 0;
+    for (int i = 0; i < d_root->numChildren; i++) {
+      const Node *child = &d_root->children[i];
+      if (!best || child->visits > best->visits) {
+        best = child;
+      }
+    }
+    if (best) {
+      d_result.move = best->move;
+      d_result.winRate = best->visits ? best->reward / best->visits : 0;
+    } else {
+      d_result.move = d_board.nthEmpty(random(d_board.emptyCount()));
+    }
+    d_result.nodes = d_nodes;
+    d_result.arenaBytes = d_arena.used();
+    d_result.seconds =
+        std::chrono::duration<double>(Clock::now() - d_start).count();
+    d_done = true;
+    return true;
+  }
+
+  // Of the last finished run.
+  const MctsResult &result() const { return d_result; }
+};
+
+}  // namespace ttt
+
+#endif  // MCTS_H
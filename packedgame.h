@@ -0,0 +1,84 @@
+#ifndef PACKEDGAME_H
+#define PACKEDGAME_H
+
+#include "bitboard.h"
+#include "engine.h"
+#include "game.h"
+
+#include <cstdint>
+
+namespace ttt {
+
+// A 3x3 game and its AI level in 4 bytes, for keeping millions of sessions
+// in memory and in snapshots. Bits 0-8 are X's stones, 9-17 O's, 18 the
+// side to move, 19-22 the last move (15 for none) and 23-24 the level;
+// the outcome and winning line follow from the rest. All ones, an
+// impossible position, marks an empty slot.
+struct PackedGame {
+  uint32_t bits;
+
+  static const uint32_t NO_LAST_MOVE = 15;
+
+  static PackedGame none() {
+    const PackedGame p = {~uint32_t(0)};
+    return p;
+  }
+
+  bool isNone() const { return bits == ~uint32_t(0); }
+
+  Mask x() const { return Mask(bits & FULL_MASK); }
+  Mask o() const { return Mask((bits >> 9) & FULL_MASK); }
+  Side toMove() const { return Side((bits >> 18) & 1); }
+  int lastMove() const {
+    const int m = int((bits >> 19) & 15);
+    return m == int(NO_LAST_MOVE) ? -1 : m;
+  }
+  Level level() const { return Level((bits >> 23) & 3); }
+
+  // Whether packGame() could have written this: disjoint stones, counts
+  // that fit the side to move, the last move a stone of the other side and
+  // a level. Snapshots are read as they are, so nothing else is trusted.
+  bool valid() const {
+    if ((bits >> 25) != 0 || (x() & o()) != 0 || level() > LEVEL_MCTS) {
+      return false;
+    }
+    const int xs = popCount(x());
+    const int os = popCount(o());
+    // X and O each may have moved first
+    if (toMove() == SIDE_X ? (os != xs && os != xs + 1)
+                           : (xs != os && xs != os + 1)) {
+      return false;
+    }
+    const int m = int((bits >> 19) & 15);
+    if (m == int(NO_LAST_MOVE)) {
+      return true;
+    }
+    const Mask other = toMove() == SIDE_X ? o() : x();
+    return m < BOARD_CELLS && (other >> m & 1) != 0;
+  }
+};
+
+static_assert(sizeof(PackedGame) == 4, "PackedGame is 4 bytes");
+
+// The state of a 3x3 game; of a larger board only the level is kept.
+inline PackedGame packGame(const Game &game, Level level) {
+  uint32_t bits = uint32_t(level) << 23;
+  if (game.rules() == RULES_3X3) {
+    const KBoard &b = game.board();
+    const int last = game.lastMove();
+    bits |= uint32_t(b.bits(SIDE_X, 0)) | uint32_t(b.bits(SIDE_O, 0)) << 9 |
+            uint32_t(game.toMove()) << 18 |
+            uint32_t(last < 0 ? PackedGame::NO_LAST_MOVE : last) << 19;
+  }
+  const PackedGame p = {bits};
+  return p;
+}
+
+// Sets game to the 3x3 game packed in p.
+inline void unpackGame(PackedGame p, Game *game) {
+  game->restore(RULES_3X3, p.x(), p.o(), p.toMove(), p.lastMove());
+}
+
+}  // namespace ttt
+
+#endif  // PACKEDGAME_H
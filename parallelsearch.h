@@ -0,0 +1,109 @@
+#ifndef PARALLELSEARCH_H
+#define PARALLELSEARCH_H
+
+#include "kboard.h"
+#include "search.h"
+#include "threadpool.h"
+#include "ttable.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace ttt {
+
+// Lazy SMP: the calling thread runs the main search while helpers on the
+// pool search the same position into the shared table. Helpers only make
+// the table better; the move and score always come from the main search,
+// and helpers are stopped as soon as it finishes. Without a pool, or with
+// one thread, this is exactly the plain Search.
+class ParallelSearch {
+  TranspositionTable *d_tt;
+  ThreadPool *d_pool;
+  int d_threads;
+  std::vector<std::unique_ptr<Search> > d_searchers;
+  std::vector<SearchResult> d_results;
+  std::atomic<bool> d_stop;
+  std::atomic<bool> *d_abort;
+
+ public:
+  ParallelSearch(TranspositionTable *tt, ThreadPool *pool)
+      : d_tt(tt), d_pool(pool), d_threads(1), d_stop(false), d_abort(0) {
+    setThreads(pool ? pool->size() + 1 : 1);
+  }
+
+  ParallelSearch(const ParallelSearch &) = delete;
+  ParallelSearch &operator=(const ParallelSearch &) = delete;
+
+  // Total searching threads including the caller, capped by the pool.
+  void setThreads(int threads) {
+    const int most = d_pool ? d_pool->size() + 1 : 1;
+    d_threads = threads < 1 ? 1 : (threads > most ? most : threads);
+    while (int(d_searchers.size()) < d_threads) {
+      const int helper = int(d_searchers.size());
+      d_searchers.emplace_back(new Search(d_tt));
+      d_searchers.back()->setParallel(&d_stop, helper);
+      d_searchers.back()->setAbort(d_abort);
+    }
+    d_results.resize(d_searchers.size());
+  }
+
+  int threads() const { return d_threads; }
+
+  // Stops the main search, and with it the helpers, once set.
+  void setAbort(std::atomic<bool> *abort) {
+    d_abort = abort;
+    for (const std::unique_ptr<Search> &searcher : d_searchers) {
+      searcher->setAbort(abort);
+    }
+  }
+
+  // Like Search::run, with nodes summed over all threads and seconds
+  // measured until the last helper has returned.
+  SearchResult run(const KBoard &board, Side toMove,
+                   const SearchLimits &limits) {
+    const std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+    d_stop = false;
+    d_tt->newSearch();
+
+    // helpers run until stopped, the main search owns the limits
+    const SearchLimits helperLimits = {limits.maxDepth, 0, 0};
+    ThreadPool::Group group;
+    for (int i = 1; i < d_threads; i++) {
+      d_pool->submit(&group, [this, i, &board, toMove, helperLimits]() {
+        d_results[i] = d_searchers[i]->run(board, toMove, helperLimits);
+      });
+    }
+    SearchResult result = d_searchers[0]->run(board, toMove, limits);
+    d_stop = true;
+    if (d_threads > 1) {
+      d_pool->wait(&group);
+    }
+
+    for (int i = 1; i < d_threads; i++) {
+      result.nodes += d_results[i].nodes;
+    }
+    result.seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+    return result;
+  }
+
+  // The main search alone, carried out a slice at a time by step(); for
+  // callers without threads, see Search::start.
+  void start(const KBoard &board, Side toMove, const SearchLimits &limits) {
+    d_stop = false;
+    d_tt->newSearch();
+    d_searchers[0]->start(board, toMove, limits);
+  }
+
+  bool step(double sliceSeconds) { return d_searchers[0]->step(sliceSeconds); }
+
+  const SearchResult &result() const { return d_searchers[0]->result(); }
+};
+
+}  // namespace ttt
+
+#endif  // PARALLELSEARCH_H
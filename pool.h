@@ -0,0 +1,73 @@
+#ifndef POOL_H
+#define POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ttt {
+
+// Fixed-capacity object pool: objects live contiguously in one block
+// reserved up front and are named by 32-bit indices, recycled through a
+// free list. Allocation is O(1), never moves an object, and a recycled
+// slot keeps whatever its object had allocated. Released objects are not
+// destroyed; allocate() hands them out as they were left.
+template <class T>
+class Pool {
+  std::vector<T> d_items;  // reserved to capacity, never reallocated
+  std::vector<uint32_t> d_free;
+  size_t d_capacity;
+
+ public:
+  static const uint32_t NONE = ~uint32_t(0);
+
+  explicit Pool(size_t capacity)
+      : d_items(), d_free(), d_capacity(capacity) {
+    d_items.reserve(capacity);
+    d_free.reserve(capacity);
+  }
+
+  Pool(const Pool &) = delete;
+  Pool &operator=(const Pool &) = delete;
+
+  // A slot, NONE when all capacity slots are in use.
+  uint32_t allocate() {
+    if (!d_free.empty()) {
+      const uint32_t i = d_free.back();
+      d_free.pop_back();
+      return i;
+    }
+    if (d_items.size() == d_capacity) {
+      return NONE;
+    }
+    d_items.emplace_back();
+    return uint32_t(d_items.size() - 1);
+  }
+
+  void release(uint32_t i) { d_free.push_back(i); }
+
+  // Allocates every slot below n that never was, in order, as when
+  // restoring objects at known indices; the caller releases those it does
+  // not need. False when n is above the capacity.
+  bool extend(size_t n) {
+    if (n > d_capacity) {
+      return false;
+    }
+    while (d_items.size() < n) {
+      d_items.emplace_back();
+    }
+    return true;
+  }
+
+  T &operator[](uint32_t i) { return d_items[i]; }
+  const T &operator[](uint32_t i) const { return d_items[i]; }
+
+  // Slots ever allocated, the valid indices.
+  size_t size() const { return d_items.size(); }
+  size_t live() const { return d_items.size() - d_free.size(); }
+  size_t capacity() const { return d_capacity; }
+};
+
+}  // namespace ttt
+
+#endif  // POOL_H
@@ -0,0 +1,97 @@
+#ifndef QOI_H
+#define QOI_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ttt {
+
+// Decoded image, always 8-bit RGBA rows top to bottom.
+struct QoiImage {
+  int width;
+  int height;
+  std::vector<unsigned char> pixels;
+
+  QoiImage() : width(0), height(0), pixels() {}
+};
+
+// Decoder for the "Quite OK Image" format (qoiformat.org) the asset
+// pipeline embeds instead of raw bitmaps: a single pass, no tables beyond
+// 64 recent colors, and about as small as PNG for flat artwork.
+inline bool qoiDecode(const unsigned char *data, size_t size, QoiImage *out) {
+  const size_t HEADER = 14;
+  const size_t PADDING = 8;
+  if (size < HEADER + PADDING || data[0] != 'q' || data[1] != 'o' ||
+      data[2] != 'i' || data[3] != 'f') {
+    return false;
+  }
+  const uint32_t w = uint32_t(data[4]) << 24 | uint32_t(data[5]) << 16 |
+                     uint32_t(data[6]) << 8 | data[7];
+  const uint32_t h = uint32_t(data[8]) << 24 | uint32_t(data[9]) << 16 |
+                     uint32_t(data[10]) << 8 | data[11];
+  if (w == 0 || h == 0 || w > 16384 || h > 16384) {
+    return false;
+  }
+
+  out->width = int(w);
+  out->height = int(h);
+  out->pixels.resize(size_t(w) * h * 4);
+
+  unsigned char index[64][4] = {};
+  unsigned char px[4] = {0, 0, 0, 255};
+  size_t p = HEADER;
+  const size_t end = size - PADDING;
+  int run = 0;
+  for (size_t o = 0; o < out->pixels.size(); o += 4) {
+    if (run > 0) {
+      run--;
+    } else if (p < end) {
+      const unsigned char b = data[p++];
+      if (b == 0xfe) {  // QOI_OP_RGB
+        px[0] = data[p++];
+        px[1] = data[p++];
+        px[2] = data[p++];
+      } else if (b == 0xff) {  // QOI_OP_RGBA
+        px[0] = data[p++];
+        px[1] = data[p++];
+        px[2] = data[p++];
+        px[3] = data[p++];
+      } else if ((b & 0xc0) == 0x00) {  // QOI_OP_INDEX
+        const unsigned char *c = index[b];
+        px[0] = c[0];
+        px[1] = c[1];
+        px[2] = c[2];
+        px[3] = c[3];
+      } else if ((b & 0xc0) == 0x40) {  // QOI_OP_DIFF
+        px[0] += ((b >> 4) & 3) - 2;
+        px[1] += ((b >> 2) & 3) - 2;
+        px[2] += (b & 3) - 2;
+      } else if ((b & 0xc0) == 0x80) {  // QOI_OP_LUMA
+        const unsigned char b2 = data[p++];
+        const int dg = (b & 0x3f) - 32;
+        px[0] += dg - 8 + ((b2 >> 4) & 0x0f);
+        px[1] += dg;
+        px[2] += dg - 8 + (b2 & 0x0f);
+      } else {  // QOI_OP_RUN
+        run = b & 0x3f;
+      }
+      unsigned char *slot =
+          index[(px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64];
+      slot[0] = px[0];
+      slot[1] = px[1];
+      slot[2] = px[2];
+      slot[3] = px[3];
+    }
+    unsigned char *dst = &out->pixels[o];
+    dst[0] = px[0];
+    dst[1] = px[1];
+    dst[2] = px[2];
+    dst[3] = px[3];
+  }
+  return p <= end;
+}
+
+}  // namespace ttt
+
+#endif  // QOI_H
@@ -0,0 +1,298 @@
+// Aggregates game record files: results, game length, win rates by first
+// move and the most frequent openings. Files are mapped, and their blocks
+// are shared out to threads. Written by tic-tac-toe-sim --record and the
+// game. No SDL.
+
+#include "gamerecord.h"
+#include "recordreader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Options {
+  std::vector<std::string> files;
+  int threads;
+  int top;  // openings listed
+};
+
+// Boards up to this many cells count openings in an array, larger ones in
+// a map, since an array would take cells squared counters.
+const int DENSE_CELLS = 19 * 19;
+// Blocks a thread takes at a time.
+const size_t CHUNK_BLOCKS = 64;
+
+// Counts of one board variant.
+struct Tally {
+  int cells;
+  uint64_t games;
+  uint64_t moves;
+  uint64_t outcomes[4];          // by Outcome
+  uint64_t firstMoverWins;
+  uint64_t secondMoverWins;
+  std::vector<uint64_t> byFirstMove;  // [cell][3]: games, first, second wins
+  std::vector<uint64_t> openings;     // [first cell * cells + second]
+  std::unordered_map<size_t, uint64_t> sparseOpenings;  // large boards
+
+  explicit Tally(int boardCells)
+      : cells(boardCells),
+        games(0),
+        moves(0),
+        outcomes(),
+        firstMoverWins(0),
+        secondMoverWins(0),
+        byFirstMove(size_t(boardCells) * 3),
+        openings(boardCells <= DENSE_CELLS
+                     ? size_t(boardCells) * size_t(boardCells)
+                     : 0),
+        sparseOpenings() {}
+
+  void opening(int first, int second) {
+    const size_t key = size_t(first) * size_t(cells) + size_t(second);
+    if (openings.empty()) {
+      sparseOpenings[key]++;
+    } else {
+      openings[key]++;
+    }
+  }
+
+  void merge(const Tally &o) {
+    games += o.games;
+    moves += o.moves;
+    for (int i = 0; i < 4; i++) {
+      outcomes[i] += o.outcomes[i];
+    }
+    firstMoverWins += o.firstMoverWins;
+    secondMoverWins += o.secondMoverWins;
+    for (size_t i = 0; i < byFirstMove.size(); i++) {
+      byFirstMove[i] += o.byFirstMove[i];
+    }
+    for (size_t i = 0; i < openings.size(); i++) {
+      openings[i] += o.openings[i];
+    }
+    for (const auto &entry : o.sparseOpenings) {
+      sparseOpenings[entry.first] += entry.second;
+    }
+  }
+};
+
+// A run of blocks of one file.
+struct Chunk {
+  const ttt::RecordReader *file;
+  size_t from;
+  size_t to;
+};
+
+void usage() {
+  fprintf(stderr,
+          "usage: tic-tac-toe-stats [options] FILE...\n"
+          "  --threads N   threads (all cores)\n"
+          "  --top N       openings listed per board (10)\n");
+}
+
+bool parseArgs(int argc, char **argv, Options *o) {
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg.compare(0, 2, "--") != 0) {
+      o->files.push_back(arg);
+      continue;
+    }
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char *value = argv[++i];
+    if (arg == "--threads") {
+      o->threads = atoi(value);
+    } else if (arg == "--top") {
+      o->top = atoi(value);
+    } else {
+      return false;
+    }
+  }
+  return !o->files.empty() && o->threads > 0;
+}
+
+void tallyRecords(const std::vector<Chunk> &chunks, std::atomic<size_t> *next,
+                  Tally *tallies, std::atomic<size_t> *corrupt,
+                  std::atomic<size_t> *unknown) {
+  for (size_t c; (c = next->fetch_add(1)) < chunks.size();) {
+    ttt::RecordCursor cursor =
+        chunks[c].file->records(chunks[c].from, chunks[c].to);
+    for (ttt::RecordView r; cursor.next(&r);) {
+      Tally &t = tallies[r.rulesIndex()];
+      const int moves = r.moves();
+      const ttt::Outcome outcome = r.outcome();
+      t.games++;
+      t.moves += uint64_t(moves);
+      t.outcomes[outcome]++;
+      const int winner = outcome == ttt::OUTCOME_X
+                             ? ttt::SIDE_X
+                             : (outcome == ttt::OUTCOME_O ? ttt::SIDE_O : -1);
+      const bool firstWon = winner == int(r.first());
+      const bool secondWon = winner >= 0 && !firstWon;
+      t.firstMoverWins += firstWon;
+      t.secondMoverWins += secondWon;
+      const int first = r.move(0);
+      uint64_t *byMove = &t.byFirstMove[size_t(first) * 3];
+      byMove[0]++;
+      byMove[1] += firstWon;
+      byMove[2] += secondWon;
+      if (moves > 1) {
+        t.opening(first, r.move(1));
+      }
+    }
+    corrupt->fetch_add(cursor.corrupt());
+    unknown->fetch_add(cursor.unknown());
+  }
+}
+
+void report(const Options &o, const ttt::Rules &rules, const Tally &t) {
+  const double games = double(t.games);
+  printf("\nboard        %dx%d k=%d\n", rules.cols, rules.rows, rules.k);
+  printf("games        %llu, %.2f moves on average\n",
+         (unsigned long long)t.games, t.moves / games);
+  printf("results      X %.2f%%, O %.2f%%, draw %.2f%%\n",
+         100.0 * t.outcomes[ttt::OUTCOME_X] / games,
+         100.0 * t.outcomes[ttt::OUTCOME_O] / games,
+         100.0 * t.outcomes[ttt::OUTCOME_DRAW] / games);
+  printf("first mover  wins %.2f%%, loses %.2f%%\n",
+         100.0 * t.firstMoverWins / games, 100.0 * t.secondMoverWins / games);
+
+  const int cells = rules.cells();
+  std::vector<int> order;
+  for (int c = 0; c < cells; c++) {
+    if (t.byFirstMove[size_t(c) * 3]) {
+      order.push_back(c);
+    }
+  }
+  std::sort(order.begin(), order.end(), [&t](int a, int b) {
+    return t.byFirstMove[size_t(a) * 3] > t.byFirstMove[size_t(b) * 3];
+  });
+  if (int(order.size()) > o.top) {
+    order.resize(size_t(o.top));
+  }
+  printf("%12s %14s %8s %10s %10s\n", "first move", "games", "share",
+         "mover win", "mover loss");
+  for (int c : order) {
+    const uint64_t *m = &t.byFirstMove[size_t(c) * 3];
+    printf("%8d,%-3d %14llu %7.2f%% %9.2f%% %9.2f%%\n", c % rules.cols,
+           c / rules.cols, (unsigned long long)m[0], 100.0 * m[0] / games,
+           100.0 * m[1] / m[0], 100.0 * m[2] / m[0]);
+  }
+
+  // (first cell * cells + second, games)
+  std::vector<std::pair<size_t, uint64_t> > openings(
+      t.sparseOpenings.begin(), t.sparseOpenings.end());
+  for (size_t i = 0; i < t.openings.size(); i++) {
+    if (t.openings[i]) {
+      openings.emplace_back(i, t.openings[i]);
+    }
+  }
+  const size_t top = std::min(openings.size(), size_t(o.top));
+  std::partial_sort(
+      openings.begin(), openings.begin() + top, openings.end(),
+      [](const std::pair<size_t, uint64_t> &a,
+         const std::pair<size_t, uint64_t> &b) { return a.second > b.second; });
+  printf("%12s %14s %8s\n", "opening", "games", "share");
+  for (size_t i = 0; i < top; i++) {
+    const int a = int(openings[i].first / size_t(cells));
+    const int b = int(openings[i].first % size_t(cells));
+    printf("%5d,%d %d,%-2d %14llu %7.2f%%\n", a % rules.cols, a / rules.cols,
+           b % rules.cols, b / rules.cols,
+           (unsigned long long)openings[i].second,
+           100.0 * openings[i].second / games);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options o;
+  o.threads = int(std::thread::hardware_concurrency());
+  o.threads = o.threads > 0 ? o.threads : 1;
+  o.top = 10;
+  if (!parseArgs(argc, argv, &o)) {
+    usage();
+    return 1;
+  }
+
+  std::vector<std::unique_ptr<ttt::RecordReader> > files;
+  std::vector<Chunk> chunks;
+  size_t bytes = 0;
+  for (const std::string &path : o.files) {
+    files.emplace_back(new ttt::RecordReader());
+    if (!files.back()->open(path.c_str())) {
+      fprintf(stderr, "tic-tac-toe-stats: %s is not a record file\n",
+              path.c_str());
+      return 1;
+    }
+    const size_t blocks = files.back()->blocks();
+    bytes += blocks * ttt::RECORD_BLOCK;
+    for (size_t b = 0; b < blocks; b += CHUNK_BLOCKS) {
+      const Chunk c = {files.back().get(), b,
+                       std::min(b + CHUNK_BLOCKS, blocks)};
+      chunks.push_back(c);
+    }
+  }
+
+  typedef std::chrono::steady_clock Clock;
+  const Clock::time_point start = Clock::now();
+  std::atomic<size_t> next(0);
+  std::atomic<size_t> corrupt(0);
+  std::atomic<size_t> unknown(0);
+  std::vector<std::vector<Tally> > tallies(size_t(o.threads));
+  std::vector<std::thread> workers;
+  for (int t = 0; t < o.threads; t++) {
+    for (const ttt::Rules &rules : ttt::RECORD_RULES) {
+      tallies[t].emplace_back(rules.cells());
+    }
+    workers.emplace_back(tallyRecords, std::cref(chunks), &next,
+                         tallies[t].data(), &corrupt, &unknown);
+  }
+  for (std::thread &w : workers) {
+    w.join();
+  }
+  for (int t = 1; t < o.threads; t++) {
+    for (int r = 0; r < ttt::NUM_RECORD_RULES; r++) {
+      tallies[0][r].merge(tallies[t][r]);
+    }
+  }
+  const double seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+
+  uint64_t games = 0;
+  for (int r = 0; r < ttt::NUM_RECORD_RULES; r++) {
+    games += tallies[0][r].games;
+  }
+  printf("read         %llu games, %.1f MB in %.3f s, %.0f games/s\n",
+         (unsigned long long)games, bytes / 1e6, seconds, games / seconds);
+  if (corrupt) {
+    fprintf(stderr,
+            "tic-tac-toe-stats: %zu corrupt blocks, read up to the first "
+            "bad record\n",
+            corrupt.load());
+  }
+  if (unknown) {
+    fprintf(stderr,
+            "tic-tac-toe-stats: %zu games on boards this version does not "
+            "know, skipped\n",
+            unknown.load());
+  }
+  for (int r = 0; r < ttt::NUM_RECORD_RULES; r++) {
+    if (tallies[0][r].games) {
+      report(o, ttt::RECORD_RULES[r], tallies[0][r]);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,89 @@
+#ifndef RECORDREADER_H
+#define RECORDREADER_H
+
+#include "gamerecord.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ttt {
+
+// A record file mapped read-only: records are read in place, so a file of
+// any size costs page-ins, not copies. POSIX only.
+class RecordReader {
+  void *d_map;
+  size_t d_bytes;
+
+ public:
+  RecordReader() : d_map(0), d_bytes(0) {}
+
+  ~RecordReader() { close(); }
+
+  RecordReader(const RecordReader &) = delete;
+  RecordReader &operator=(const RecordReader &) = delete;
+
+  // False when path is missing or not a record file of this version.
+  bool open(const char *path) {
+    close();
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || size_t(st.st_size) < RECORD_FILE_HEADER) {
+      ::close(fd);
+      return false;
+    }
+    d_bytes = size_t(st.st_size);
+    void *map = ::mmap(0, d_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+      d_bytes = 0;
+      return false;
+    }
+    d_map = map;
+    // read front to back, once
+    ::madvise(d_map, d_bytes, MADV_SEQUENTIAL);
+    const unsigned char *h = static_cast<const unsigned char *>(d_map);
+    const uint32_t magic = uint32_t(h[0]) | uint32_t(h[1]) << 8 |
+                           uint32_t(h[2]) << 16 | uint32_t(h[3]) << 24;
+    const uint32_t version = uint32_t(h[4]) | uint32_t(h[5]) << 8 |
+                             uint32_t(h[6]) << 16 | uint32_t(h[7]) << 24;
+    if (magic != RECORD_MAGIC || version != RECORD_VERSION) {
+      close();
+      return false;
+    }
+    return true;
+  }
+
+  void close() {
+    if (d_map) {
+      ::munmap(d_map, d_bytes);
+    }
+    d_map = 0;
+    d_bytes = 0;
+  }
+
+  // Whole blocks; a torn last block is ignored.
+  size_t blocks() const {
+    return d_map ? (d_bytes - RECORD_FILE_HEADER) / RECORD_BLOCK : 0;
+  }
+
+  // Records of blocks [from, to).
+  RecordCursor records(size_t from, size_t to) const {
+    return RecordCursor(
+        static_cast<const unsigned char *>(d_map) + RECORD_FILE_HEADER, from,
+        to);
+  }
+
+  RecordCursor records() const { return records(0, blocks()); }
+};
+
+}  // namespace ttt
+
+#endif  // RECORDREADER_H
@@ -0,0 +1,1063 @@
+static const unsigned char RedO_qoi[] = {
+0x71,0x6f,0x69,0x66,0x0,0x0,0x1,0x7a,0x0,0x0,0x1,0x7a,0x4,0x0,0x0,0xfd,
+0xfd,0xfd,0xfd,0xfd,0xfd,0xfd,0xfd,0xf8,0xff,0xb3,0x1d,0x1c,0xff,0xfe,0xbb,0x1d,
+0x1c,0x9f,0xc7,0xfe,0xc3,0x19,0x19,0xfe,0xc9,0x17,0x17,0xa0,0xc7,0x61,0x68,0xa1,
+0x69,0xc0,0x18,0xc0,0x1a,0xc0,0x18,0xc0,0xa0,0x7a,0x7f,0x18,0xc0,0xa2,0x65,0xa0,
+0x49,0xa1,0x3c,0xa2,0x18,0xa2,0x26,0xa2,0x28,0x0,0xfd,0xfd,0xfd,0xfd,0xfd,0xdd,
+0xff,0xb6,0x8,0x9,0xff,0xfe,0xce,0x14,0x15,0xfe,0xd4,0x12,0x12,0x9f,0xc9,0x9f,
+0xc7,0x74,0x9e,0xc9,0xa0,0xa7,0xa1,0xa8,0x61,0x78,0x9e,0xda,0xa0,0xa7,0x76,0x76,
+0xa0,0xa6,0x76,0xce,0x12,0x1a,0x1c,0x1e,0x1f,0x5e,0x2b,0x7f,0x49,0xa1,0x49,0x4a,
+0x3,0x4a,0x9,0xa2,0x27,0xfe,0xc0,0xe,0xe,0x0,0xfd,0xfd,0xfd,0xfd,0xfd,0xcc,
+0x39,0xfe,0xc7,0x17,0x19,0xfe,0xd1,0x13,0x13,0xfe,0xda,0x10,0xe,0xfe,0xe2,0xc,
+0xa,0xfe,0xea,0x9,0x7,0xfe,0xf3,0x5,0x5,0xfe,0xfa,0x2,0x2,0x9e,0xe8,0xd7,
+0x7f,0x2f,0xd0,0xa1,0x49,0xfe,0xf4,0x4,0x3,0x10,0xfe,0xe5,0xb,0x9,0xfe,0xdc,
+0xf,0xc,0xfe,0xd3,0x13,0x12,0x24,0xfe,0xbe,0x1b,0x1c,0x0,0xfd,0xfd,0xfd,0xfd,
+0xfd,0xff,0xb5,0x9,0x9,0xff,0xfe,0xcd,0x15,0x13,0xfe,0xd5,0x13,0x13,0xfe,0xdb,
+0x11,0x11,0x9c,0xe8,0x2d,0x21,0x1e,0x9e,0xea,0x9f,0xc7,0x9e,0xc8,0x9f,0xc7,0x9f,
+0xc8,0x9f,0xc7,0x9f,0xc9,0x2f,0xc4,0x5a,0x2f,0xd1,0x3e,0x2c,0xc0,0x2f,0xc4,0x31,
+0xc0,0x2f,0xc3,0x3e,0x2f,0x31,0x39,0xa2,0x36,0x4f,0xa1,0x47,0xa1,0x49,0xa2,0x28,
+0x1c,0x21,0xa2,0x49,0xa1,0x28,0x3,0x9,0xa2,0x9,0xfe,0xb8,0xa,0xb,0xff,0x0,
+0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0xf2,0xff,0xb7,0x1c,0x1a,0xff,0x24,0x3d,0x1f,
+0x6,0xfe,0xf7,0x3,0x2,0x31,0x3e,0x2f,0x3e,0x2f,0xc0,0x3e,0x2f,0xc1,0x7e,0x2f,
+0xc3,0x2c,0x2f,0xc5,0x3e,0x2f,0xc1,0x3e,0x2f,0xd1,0x31,0xc0,0x2f,0x3e,0x2f,0xce,
+0x2c,0x31,0x3b,0xfe,0xf3,0x5,0x5,0xfe,0xe9,0xb,0xa,0x3,0xfe,0xca,0x16,0x15,
+0xfe,0xbb,0x1d,0x1c,0x0,0xfd,0xfd,0xfd,0xfd,0xe9,0xff,0xb3,0xb,0xa,0xff,0x16,
+0xfe,0xd7,0x11,0x10,0xfe,0xdc,0xe,0xe,0x2b,0x9f,0xd6,0x12,0x4,0x9f,0xe7,0x9e,
+0xe9,0x78,0x2f,0xc1,0x2c,0x2f,0xc9,0x3e,0x2f,0xc4,0x3e,0x2f,0xc3,0x3e,0x2f,0xe7,
+0x5e,0x3b,0xa2,0x48,0x4,0x10,0x1e,0x2b,0xa2,0x28,0xa1,0x8,0xfe,0xd1,0x15,0x14,
+0xfe,0xb5,0xb,0xb,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0xe1,0xff,0xbc,
+0x1c,0x1c,0xff,0xfe,0xce,0x15,0x13,0x27,0x10,0xfe,0xf8,0x3,0x2,0x2f,0x2c,0x2f,
+0x31,0xc0,0x2f,0xcc,0x2c,0x2f,0xdf,0x3e,0x2f,0xcf,0x2c,0x2f,0xce,0x3a,0xfe,0xef,
+0x7,0x5,0xfe,0xe2,0xc,0xa,0xc,0xfe,0xc0,0x1a,0x1a,0x0,0xfd,0xfd,0xfd,0xfd,
+0xda,0xff,0xbc,0xe,0xd,0xff,0xfe,0xd3,0x13,0x12,0x3,0xfe,0xe1,0xd,0xc,0xfe,
+0xe9,0xb,0xa,0xfe,0xee,0x6,0x6,0xfe,0xf4,0x4,0x3,0x9f,0xd8,0x31,0x2f,0xc9,
+0xa0,0x8a,0xc0,0x2f,0xe6,0x3d,0xc2,0x2f,0xdd,0x31,0x3a,0xa1,0x38,0x8,0xa2,0x8,
+0xa2,0xb,0x37,0xfe,0xd7,0x11,0x12,0xfe,0xc5,0x11,0x12,0x0,0xfd,0xfd,0xfd,0xfd,
+0xd3,0xff,0xbb,0x1d,0x1c,0xff,0xfe,0xd0,0x14,0x13,0x2b,0x4,0xfe,0xfb,0x1,0x2,
+0x31,0xc0,0x2f,0xce,0x3d,0xc0,0x2f,0xe6,0x3d,0xc2,0x2f,0xe4,0xa0,0x7a,0xfe,0xf6,
+0x3,0x5,0xfe,0xe4,0xa,0x9,0xfe,0xd4,0x12,0x12,0xfe,0xc2,0x1a,0x19,0x0,0xfd,
+0xfd,0xfd,0xfd,0xcd,0xff,0xcd,0x15,0x15,0xff,0x3,0xfe,0xe1,0xd,0xc,0xfe,0xe9,
+0xa,0xb,0xfe,0xef,0x7,0x7,0xfe,0xf4,0x4,0x3,0xfe,0xfa,0x2,0x2,0x31,0x76,
+0xc8,0x3d,0xc0,0x2f,0xc6,0x3d,0xc0,0x2f,0xfd,0xca,0x3d,0x2f,0xc1,0x31,0xc0,0x2f,
+0x39,0xa2,0x6,0x6,0xa2,0xa,0xfe,0xe2,0xb,0x9,0x33,0xe,0xfe,0xb1,0xd,0xc,
+0x0,0xfd,0xfd,0xfd,0xfd,0xc6,0xff,0xbe,0x1c,0x1a,0xff,0x9,0x1f,0xfe,0xf6,0x4,
+0x3,0x2f,0x3d,0xc0,0x2f,0xc4,0x3e,0x2f,0xc5,0x3d,0xc0,0x2f,0xc6,0x3d,0xc0,0x2f,
+0xfd,0xca,0x3d,0xc0,0x2f,0xc0,0x5e,0xc0,0x2f,0xc5,0xfe,0xf8,0x4,0x3,0xfe,0xea,
+0x9,0x7,0xfe,0xd8,0x10,0x10,0x2c,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,
+0xc1,0xff,0xc8,0x14,0x15,0xff,0x3,0x2d,0xfe,0xea,0xa,0xa,0xfe,0xf0,0x6,0x5,
+0xfe,0xf6,0x4,0x3,0x39,0x2f,0xc6,0x3e,0xc0,0x2f,0xcf,0x31,0xc0,0x2f,0xee,0x31,
+0xc0,0x2f,0xd4,0xa0,0x8a,0xc0,0x2f,0xc4,0x5a,0x2f,0xc4,0x30,0xa1,0x39,0xa2,0x9,
+0x1a,0xfe,0xe2,0xc,0xc,0x33,0x18,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xf9,
+0xff,0xaa,0x18,0x18,0xff,0xfe,0xc9,0x15,0x16,0xfe,0xe1,0xc,0xe,0xfe,0xf4,0x4,
+0x5,0x31,0x2f,0xc2,0x3e,0x2f,0xc0,0x2c,0xc0,0x2f,0x2c,0x2f,0xd3,0x31,0xc0,0x2f,
+0xee,0x31,0xc0,0x2f,0xd4,0x3d,0xc0,0x2f,0xc8,0x2c,0x2f,0xc6,0xfe,0xf6,0x4,0x3,
+0x29,0x18,0xfe,0xad,0x17,0x16,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xf4,0x18,
+0x3,0x21,0x10,0x8,0x39,0x2f,0xc1,0x3d,0xc0,0x2f,0xc4,0x3e,0x2f,0xf3,0x31,0xc0,
+0x2f,0xe0,0x3d,0xc0,0x2f,0xca,0x31,0xc0,0x2f,0xc9,0x39,0xa3,0x6,0x10,0x1f,0x33,
+0xe,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xf0,0xff,0xcd,0x15,0x13,0xff,0x1f,
+0xfe,0xf6,0x4,0x3,0x39,0x2f,0xc5,0x5b,0x3d,0x2f,0xfa,0x31,0xc0,0x2f,0xd4,0x3d,
+0xc0,0x2f,0xc8,0x3d,0xc0,0x2f,0xca,0x31,0x7f,0x2f,0xc4,0x2c,0x2f,0xc6,0x39,0xa2,
+0x27,0x1e,0xe,0xfe,0xae,0x18,0x17,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xea,
+0xff,0xc4,0x12,0x12,0xff,0xfe,0xdc,0x10,0x11,0x21,0xfe,0xee,0x8,0x8,0xfe,0xf6,
+0x4,0x3,0x39,0x31,0x2f,0xfd,0xfd,0xca,0x31,0x39,0x3e,0x16,0xfe,0xe6,0xa,0xa,
+0xfe,0xdc,0xe,0xe,0xfe,0xcd,0x15,0x15,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,
+0xe6,0xff,0xc2,0x1a,0x19,0xff,0xfe,0xdb,0xf,0xe,0x4,0xfe,0xfd,0x0,0x2,0x2f,
+0xfd,0xfd,0xd5,0xfe,0xf4,0x4,0x3,0x2d,0xfe,0xc8,0x18,0x18,0x0,0xfd,0xfd,0xfd,
+0xe2,0xe,0x27,0x1a,0xfe,0xf3,0x5,0x5,0x3b,0x2f,0xfd,0xfd,0xd6,0x39,0x3a,0xfe,
+0xec,0x8,0x7,0x2b,0xfe,0xd4,0x12,0x12,0xfe,0xb9,0x11,0x11,0x0,0xfd,0xfd,0xfd,
+0xdd,0xff,0xcc,0x16,0x13,0xff,0xfe,0xe3,0xc,0xa,0xfe,0xf6,0x4,0x3,0x2f,0xfd,
+0xfd,0xde,0x37,0xfe,0xec,0x8,0x9,0xfe,0xd5,0x11,0x12,0xfe,0xb0,0x18,0x17,0xff,
+0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xd8,0x1d,0x9,0xfe,0xe4,0xd,0xb,0xfe,0xed,
+0x7,0x7,0x3a,0x39,0x9f,0xc7,0xc5,0x3d,0xc0,0x2f,0xfd,0xfd,0xd5,0x30,0xa0,0x5b,
+0x6,0x1f,0x2e,0xfe,0xbe,0x12,0x10,0x0,0xfd,0xfd,0xfd,0xd5,0xe,0xfe,0xe7,0x9,
+0x8,0x3e,0x2f,0x5e,0xc0,0x2f,0xc6,0x3d,0xc0,0x2f,0xfd,0xfd,0xd9,0xfe,0xf7,0x2,
+0x1,0xfe,0xed,0x8,0x5,0x3f,0xfe,0xae,0x18,0x17,0x0,0xfd,0xfd,0xfd,0xd1,0xff,
+0xd1,0x13,0x13,0xff,0x29,0x16,0x3e,0x9d,0xe9,0x2f,0xfd,0xfd,0xd7,0x3d,0xc0,0x2f,
+0xcb,0x31,0x2b,0x4,0x1f,0xfe,0xd5,0x11,0x12,0xfe,0xb9,0x11,0x10,0x0,0xfd,0xfd,
+0xfd,0xcd,0xff,0xcc,0x16,0x15,0xff,0x21,0xfe,0xf6,0x4,0x3,0x2f,0xfd,0xfd,0xdb,
+0x3d,0xc0,0x2f,0xc8,0x7f,0x2f,0xc4,0x37,0x20,0xb,0xff,0x0,0x0,0x0,0x0,0xfd,
+0xfd,0xfd,0xca,0xff,0xce,0x15,0x13,0xff,0xfe,0xe2,0xc,0xa,0xfe,0xee,0x8,0x8,
+0xfe,0xf6,0x4,0x3,0xfe,0xfb,0x1,0x2,0x2f,0xc3,0x31,0xc0,0x2f,0xc4,0x31,0xc0,
+0x2f,0xc2,0x31,0xc0,0x2f,0xfd,0xfd,0xc6,0x31,0xc0,0x2f,0xcc,0x31,0xc0,0x2f,0x30,
+0x3c,0x6,0xfe,0xe3,0xc,0xa,0xc,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xc6,
+0xff,0xb9,0x16,0x17,0xff,0x33,0xfe,0xf3,0x5,0x3,0xfe,0xfe,0x0,0x0,0xc7,0x31,
+0xc0,0x2f,0xc4,0x31,0xc0,0x2f,0xc2,0x31,0xc0,0x2f,0xfd,0xfd,0xc6,0x31,0xc0,0x2f,
+0xcc,0x31,0xc0,0x2f,0xc3,0x3a,0xfe,0xe2,0xc,0xc,0xfe,0xc5,0x19,0x19,0x0,0xfd,
+0xfd,0xfd,0xc2,0x25,0x3,0xfe,0xe8,0xa,0x9,0xa,0x3b,0x2f,0xc1,0xa1,0x8a,0x3d,
+0x2f,0xfd,0xfd,0xe0,0x31,0xc0,0x2f,0xca,0x3d,0xc0,0x2f,0x39,0x3a,0xfe,0xea,0x8,
+0x9,0xfe,0xdc,0xe,0xe,0xfe,0xbf,0x11,0x12,0x0,0xfd,0xfd,0xfd,0xff,0xcc,0x16,
+0x15,0xff,0xfe,0xea,0x8,0x9,0x39,0xa0,0xa6,0x2f,0xc3,0x3d,0xc0,0x2f,0xfd,0xfd,
+0xe0,0x31,0xc0,0x2f,0xca,0x3d,0xc0,0x2f,0xc1,0x31,0xa0,0x58,0x12,0xfe,0xcf,0x13,
+0x12,0x0,0xfd,0xfd,0xfa,0xff,0xcd,0x15,0x15,0xff,0x27,0x10,0xfe,0xf7,0x3,0x3,
+0x31,0x2f,0xc4,0x5a,0x2f,0xfd,0xfd,0xe3,0x3d,0xc0,0x2f,0xc6,0xa0,0x7a,0xc0,0x2f,
+0xc4,0x31,0x37,0xfe,0xef,0x7,0x5,0x2b,0xe,0x0,0xfd,0xfd,0xf7,0xff,0xdb,0xf,
+0x10,0xff,0xfe,0xf4,0x6,0x6,0x3b,0x2f,0xc0,0x2c,0x2f,0xfd,0xfd,0xea,0x3d,0xc0,
+0x2f,0xc6,0x3a,0xc0,0x2f,0xc4,0x31,0x56,0x2f,0x39,0xfe,0xf4,0x4,0x3,0xfe,0xde,
+0xe,0xe,0xfe,0xb2,0x18,0x18,0x0,0xfd,0xfd,0xf3,0xe,0x21,0xa,0x3b,0x31,0x2f,
+0xd7,0x3d,0xc0,0x2f,0xfd,0xfd,0xe2,0x2c,0x2f,0xc1,0x31,0xc0,0xa1,0x6a,0x3c,0xfe,
+0xe6,0xb,0x9,0xb,0x0,0xfd,0xfd,0xf0,0xff,0xb5,0x15,0x15,0xff,0x33,0x4,0x2f,
+0xcb,0x7f,0x2f,0xcd,0x3d,0xc0,0x2f,0xfd,0xfd,0xe2,0x2c,0x2f,0xc1,0x31,0xc0,0x2f,
+0xc1,0x3c,0xfe,0xdf,0xd,0xe,0xfe,0xbb,0x15,0x15,0x0,0xfd,0xfd,0xed,0x7,0xfe,
+0xe6,0xa,0xa,0x4,0x3b,0x31,0xc1,0x2f,0xfd,0xfd,0xfd,0xc9,0x3b,0xa2,0x9,0x1e,
+0xfe,0xd8,0x10,0x10,0x0,0xfd,0xfd,0xea,0xff,0xb4,0x18,0x19,0xff,0xfe,0xe1,0xd,
+0xc,0xfe,0xf7,0x3,0x2,0x9f,0xd7,0x2f,0x31,0xc2,0x2f,0xfd,0xfd,0xfd,0xca,0x3e,
+0x31,0xa2,0x18,0x20,0xfe,0xbd,0x19,0x18,0x0,0xfd,0xfd,0xe7,0xff,0xd0,0x14,0x15,
+0xff,0x1f,0xfe,0xf4,0x4,0x3,0x30,0x31,0x2f,0xfd,0xfd,0xfd,0xcf,0x3e,0x2f,0x31,
+0xfe,0xf6,0x4,0x3,0xfe,0xe9,0x9,0x9,0xb,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,
+0xe5,0x7,0x6,0x2f,0x31,0xc0,0x2f,0xfd,0xfd,0xfd,0xd5,0x4,0xfe,0xda,0x10,0xe,
+0xfe,0xac,0x12,0x12,0x0,0xfd,0xfd,0xe1,0xff,0xc1,0x13,0x12,0xff,0xfe,0xdf,0xd,
+0xe,0x6,0x3b,0x2f,0xc1,0x3e,0x2f,0xfd,0xfd,0xfd,0xcf,0xa0,0x8a,0x59,0x2f,0xc0,
+0x3e,0x3b,0x4,0xfe,0xe2,0xc,0xc,0xfe,0xc8,0x14,0x15,0x0,0xfd,0xfd,0xdf,0xff,
+0xce,0x14,0x15,0xff,0xfe,0xea,0x9,0x7,0xfe,0xf7,0x1,0x2,0x2f,0xc3,0x2c,0x2f,
+0xfd,0xfd,0xfd,0xce,0x3e,0x3d,0xc0,0x2f,0xc3,0xfe,0xf8,0x3,0x2,0xfe,0xef,0x7,
+0x7,0xfe,0xd3,0x12,0x13,0x0,0xfd,0xfd,0xdd,0xff,0xda,0x10,0xe,0xff,0x12,0x37,
+0xfe,0xfd,0x0,0x2,0x2f,0xfd,0xfd,0xfd,0xdc,0x31,0xa2,0x18,0x16,0xfe,0xdc,0xe,
+0xe,0xfe,0xb3,0xf,0xe,0x0,0xfd,0xfd,0xd9,0xff,0xb7,0x19,0x18,0xff,0x20,0x3a,
+0x9e,0xf8,0x2f,0x2c,0x2f,0xfd,0xfd,0xfd,0xd5,0x2c,0x2f,0xc6,0x31,0xa1,0x49,0x1f,
+0xfe,0xbf,0x19,0x19,0x0,0xfd,0xfd,0xd7,0xe,0xfe,0xe8,0xa,0x9,0xfe,0xf6,0x4,
+0x3,0xfe,0xfe,0x2,0x1,0x2f,0xfd,0xfd,0xfd,0xe2,0x31,0xfe,0xf6,0x4,0x3,0x1c,
+0xb,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xd5,0x7,0x6,0x2f,0xc1,0x3e,0x2f,0xfd,
+0xfd,0xfd,0xe4,0xa,0xfe,0xdb,0xf,0xe,0xfe,0xb2,0x14,0x13,0x0,0xfd,0xfd,0xd1,
+0x15,0x27,0x6,0x3b,0x2f,0xfd,0xfd,0xfd,0xe8,0x3b,0xa,0x20,0xfe,0xca,0x14,0x13,
+0x0,0xfd,0xfd,0xcf,0x18,0x11,0x3a,0x2f,0xc0,0x3e,0x2f,0xfd,0xfd,0xfd,0xe9,0x3a,
+0xfe,0xef,0x7,0x5,0x9,0x0,0xfd,0xfd,0xcd,0xff,0xd7,0x11,0x10,0xff,0x12,0x37,
+0x31,0x2f,0xc3,0x3e,0x2f,0xc1,0x31,0xc0,0x2f,0xc4,0x31,0xc0,0x2f,0xfd,0xfd,0xfd,
+0xd9,0x31,0x3a,0x16,0xfe,0xdc,0xe,0xe,0xfe,0xad,0xf,0xe,0x0,0xfd,0xfd,0xca,
+0x33,0xfe,0xf5,0x3,0x2,0x30,0x2f,0xc9,0x5e,0xc0,0x2f,0xc4,0x31,0xc0,0x2f,0xfd,
+0xfd,0xfd,0xdb,0xa0,0x7a,0x3b,0xfe,0xe1,0xd,0xc,0x0,0xfd,0xfd,0xc8,0xff,0xae,
+0xe,0xe,0xff,0xfe,0xdf,0xd,0xc,0xfe,0xf1,0x5,0x5,0x30,0x31,0x2c,0x2f,0xce,
+0x31,0xc0,0x2f,0xfd,0xfd,0xfd,0xdc,0x3d,0xc0,0x3a,0xa,0xfe,0xe3,0xb,0xc,0xfe,
+0xbb,0x13,0x12,0x0,0xfd,0xfd,0xc6,0x2d,0x3b,0x31,0x2f,0xd1,0x31,0xc0,0x2f,0xfd,
+0xfd,0xfd,0xdc,0x5b,0x2f,0xc0,0x31,0x39,0x1f,0xfe,0xb8,0x18,0x18,0x0,0xfd,0xfd,
+0xc3,0x3,0xfe,0xe2,0xc,0xa,0xfe,0xf3,0x5,0x3,0x30,0x3e,0x2f,0xfd,0xef,0x31,
+0xc0,0x2f,0xf6,0xa0,0x8a,0xc0,0x2f,0xfd,0xc6,0x31,0xfe,0xf6,0x4,0x3,0xf,0xfe,
+0xc8,0x14,0x15,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xc1,0xff,0xb7,0x19,0x18,0xff,
+0xfe,0xe5,0xb,0x9,0x30,0x31,0xc0,0x3e,0x2f,0xfd,0xef,0x31,0xc0,0x2f,0xf6,0x3d,
+0xc0,0x2f,0xfd,0xc9,0xfe,0xea,0x8,0x9,0xfe,0xc5,0x19,0x19,0x0,0xfd,0xfd,0xff,
+0xc7,0x15,0x15,0xff,0xfe,0xe6,0xb,0x9,0xfe,0xf4,0x4,0x3,0x31,0xc0,0x2f,0xfd,
+0xe5,0x31,0xc0,0x2f,0xf0,0x3d,0xc2,0x2f,0xfd,0xd6,0x31,0xc0,0x2f,0xfe,0xf7,0x3,
+0x3,0x1a,0xe,0x0,0xfd,0xfb,0x30,0x1a,0xfe,0xfe,0x2,0x1,0x31,0xc0,0x2f,0xfd,
+0xe6,0x31,0xc0,0x2f,0xf0,0x3d,0xc2,0x2f,0xfd,0xd6,0x31,0xc0,0x2f,0x2c,0xa1,0x98,
+0xfe,0xed,0x7,0x7,0x18,0xff,0x0,0x0,0x0,0x0,0xfd,0xf9,0xe,0x1a,0xfe,0xf7,
+0x3,0x3,0x2f,0x7f,0xc0,0x2f,0xfd,0xda,0x31,0xc0,0x2f,0xc2,0x31,0xc0,0x2f,0xce,
+0x3d,0xc0,0x2f,0xc0,0x31,0xc0,0x3d,0xc0,0x2f,0xdc,0x3d,0xc0,0x2f,0xc6,0x31,0xc0,
+0x2f,0xfd,0xd5,0xfe,0xf8,0x3,0x2,0xfe,0xed,0x8,0x5,0xfe,0xd5,0x12,0x10,0x0,
+0xfd,0xf7,0xff,0xce,0x14,0x15,0xff,0xfe,0xef,0x7,0x7,0x2f,0xfd,0xdf,0x31,0xc0,
+0x2f,0xc2,0x31,0xc0,0x2f,0xce,0x3d,0xc0,0x2f,0xc0,0x31,0xc0,0x3d,0xc0,0x2f,0xdc,
+0x3d,0xc0,0x2f,0xc6,0x31,0xc0,0x2f,0xfd,0xd7,0xfe,0xf0,0x6,0x5,0xfe,0xd5,0x11,
+0x12,0x0,0xfd,0xf5,0x7,0x16,0x3a,0x2f,0xfd,0xdb,0x3d,0xc0,0x2f,0xc3,0x3d,0x2f,
+0xcc,0x3d,0xc0,0x2f,0xc2,0x31,0xc0,0x2f,0xf2,0x31,0xc2,0x2f,0xfd,0xca,0x7f,0x2f,
+0xc2,0x3b,0x6,0xfe,0xda,0xe,0xf,0x0,0xfd,0xf3,0x7,0x6,0x2f,0xc0,0x2c,0x2f,
+0x2c,0x2f,0xfd,0xd8,0x3d,0xc0,0x2f,0xc3,0x3d,0x2f,0xcc,0xa0,0x7a,0x39,0x3b,0x4e,
+0xc0,0x5b,0xa1,0x47,0x3c,0xc0,0xa,0x4a,0x6,0x16,0x10,0xc2,0x16,0x6,0x4,0xa,
+0xc0,0x76,0xa0,0xa6,0x3e,0x79,0x67,0x3b,0x39,0x31,0x2f,0xdc,0x31,0xc2,0x2f,0xfd,
+0xd1,0xa,0xfe,0xde,0xe,0xe,0xfe,0xad,0x11,0x12,0xff,0x0,0x0,0x0,0x0,0xfd,
+0xf0,0xff,0xd8,0x10,0x10,0xff,0x6,0x3b,0x2f,0xfd,0xdb,0x7f,0x2f,0xc4,0x3e,0x2f,
+0xc4,0x7e,0x2f,0x3e,0x2f,0xa0,0x8a,0x2f,0xc2,0x31,0x39,0xa1,0x26,0xfe,0xf1,0x7,
+0x6,0xa1,0x36,0x10,0x1a,0x20,0x27,0x5e,0xa0,0x6a,0xa2,0x28,0x9,0xfe,0xce,0x15,
+0x13,0xa1,0x59,0x18,0xc1,0xe,0x9,0x9e,0xea,0x9e,0xe8,0x9f,0xb9,0x78,0x9e,0xe8,
+0xfe,0xea,0x8,0x9,0x10,0xa0,0x8a,0x9f,0xc7,0xfe,0xf6,0x4,0x3,0x3b,0x9f,0xc7,
+0x2f,0xc9,0x3e,0x2f,0x3e,0x2f,0xfd,0xe3,0xa0,0x8a,0x3b,0xa,0xfe,0xde,0xe,0xe,
+0x34,0xff,0x0,0x0,0x0,0x0,0xfd,0xee,0xff,0xd5,0x11,0x12,0xff,0x6,0x2f,0xfd,
+0xe3,0x3e,0x2f,0xc2,0x31,0x39,0x3a,0xa0,0x38,0x4,0x10,0x1a,0x1f,0x29,0x36,0xa2,
+0x16,0xa2,0x48,0xa0,0x29,0xe,0x99,0x8,0x9a,0x7,0xa1,0x18,0x67,0x0,0xd2,0x10,
+0xc0,0x9f,0xc8,0xfe,0xc0,0xe,0xc,0xa7,0xf8,0x9,0x9e,0xe8,0x31,0x27,0x20,0x1f,
+0x1a,0x9f,0xc7,0x6,0x9f,0xe8,0x9e,0xc9,0x39,0xa0,0xa6,0x2f,0xfd,0xe5,0xa0,0x8a,
+0xc0,0x2f,0xfe,0xf3,0x5,0x3,0x27,0x0,0xfd,0xed,0x7,0x6,0x3b,0x2f,0xfd,0xe1,
+0x2c,0x2f,0xc4,0xa2,0x36,0xfe,0xf4,0x4,0x3,0x12,0x2d,0xfe,0xd7,0x11,0x10,0x18,
+0xfe,0xc2,0x1a,0x1a,0xfe,0xb9,0x1f,0x1f,0x0,0xe6,0xff,0xb5,0x1d,0x1c,0xff,0x33,
+0xfe,0xcc,0x16,0x15,0xfe,0xd4,0x12,0x12,0x27,0xfe,0xea,0x8,0x9,0x8,0x39,0x2f,
+0xfd,0xe8,0x3b,0xa3,0x7,0xfe,0xdb,0xf,0xe,0x0,0xfd,0xeb,0xd,0x16,0x2f,0xfd,
+0xdf,0x2c,0x2f,0xc0,0x31,0x39,0x3e,0x4,0x12,0x1f,0x2d,0xa3,0x8,0xfe,0xd4,0x14,
+0x13,0xfe,0xc1,0xd,0xc,0x0,0xf2,0xff,0xbd,0xb,0xb,0xff,0xfe,0xd1,0x13,0x13,
+0x3,0x35,0x21,0xfe,0xea,0x8,0x9,0x6,0xfe,0xf6,0x4,0x2,0x9e,0xe8,0x31,0x2f,
+0xc2,0x7f,0x2f,0xfd,0xdb,0x3e,0x2f,0x6,0x7,0x0,0xfd,0xe9,0xff,0xd0,0x14,0x13,
+0xff,0x16,0xfe,0xf8,0x3,0x2,0x2f,0xfd,0xda,0x3e,0x2f,0xc5,0xa1,0x49,0x8,0xfe,
+0xe8,0xa,0x9,0x3f,0xfe,0xc6,0x18,0x17,0xfe,0xae,0x18,0x19,0x0,0xfb,0xff,0xc3,
+0x19,0x19,0xff,0xfe,0xd4,0x12,0x12,0x21,0x4,0x3b,0x2f,0xc0,0x3e,0xc0,0x2f,0xc5,
+0x31,0xc0,0x2f,0xfd,0xd5,0x3b,0x6,0x7,0x0,0xfd,0xe7,0xff,0xc5,0x19,0x19,0xff,
+0x1a,0x2f,0xfd,0xde,0x3b,0x2b,0x10,0xa2,0x19,0xfe,0xe1,0xd,0xc,0x33,0x9,0xfe,
+0xc4,0x12,0x12,0x0,0xfd,0xc4,0xff,0xbd,0xf,0xe,0xff,0xfe,0xd4,0x13,0x14,0x1,
+0x2d,0x1f,0x10,0x3c,0xfe,0xfb,0x3,0x3,0x31,0x2f,0xc2,0x31,0xc0,0x2f,0xfd,0xd7,
+0xfe,0xee,0x6,0x6,0xfe,0xce,0x14,0x15,0x0,0xfd,0xe5,0xff,0xc7,0x15,0x15,0xff,
+0x1a,0xfe,0xf7,0x3,0x3,0x2f,0xfd,0xdd,0x31,0xfe,0xf2,0x4,0x2,0xfe,0xe1,0xd,
+0xc,0x18,0xfe,0xb4,0x18,0x19,0x0,0xfd,0xcc,0xff,0xb0,0x18,0x17,0xff,0xfe,0xca,
+0x16,0x15,0xfe,0xde,0xe,0xc,0x4,0x39,0x31,0x2f,0xc2,0x3d,0x2f,0xfd,0xc8,0x3d,
+0x2f,0xcc,0xfe,0xf7,0x2,0x1,0xfe,0xef,0x7,0x7,0xe,0x0,0xfd,0xe3,0xff,0xb7,
+0x17,0x17,0xff,0xfe,0xe8,0xa,0x9,0x31,0x2f,0xc1,0x7f,0x2f,0xfd,0xd5,0xa2,0x36,
+0xa1,0x3a,0x4,0xfe,0xe9,0x9,0x9,0x2d,0xfe,0xd8,0x10,0x10,0xfe,0xc4,0x12,0x10,
+0x0,0xfd,0xd2,0xff,0xc0,0x10,0x10,0xff,0xfe,0xd7,0x11,0x12,0x27,0x1e,0xfe,0xf0,
+0x6,0x5,0x3e,0x39,0x9f,0xc9,0x2f,0xfd,0xc8,0x3d,0xc0,0x2f,0xc7,0x7e,0x2f,0xc0,
+0x7f,0x2f,0xc0,0x1a,0x2a,0x0,0xfd,0xe1,0xff,0xbc,0x12,0x12,0xff,0x1d,0xfe,0xf6,
+0x4,0x3,0x31,0x3e,0x2f,0xfd,0xcd,0x3e,0x2f,0xc5,0x31,0xc0,0x2f,0xfe,0xf7,0x3,
+0x2,0x1a,0xfe,0xd8,0x10,0x10,0xfe,0xc0,0x1a,0x1a,0xff,0x0,0x0,0x0,0x0,0xfd,
+0xd8,0xff,0xba,0x1a,0x1a,0xff,0xfe,0xd4,0x12,0x13,0x20,0xfe,0xf7,0x3,0x3,0x2f,
+0xc0,0x7f,0x2f,0x3e,0x2f,0xd0,0xa0,0x7a,0xc0,0x31,0xc0,0x2f,0xc4,0xa0,0x8a,0xc0,
+0x2f,0xf5,0xfe,0xf7,0x3,0x3,0x1a,0xfe,0xc7,0x15,0x15,0x0,0xfd,0xdf,0xff,0xab,
+0x17,0x17,0xff,0xfe,0xe3,0xc,0xa,0x30,0x31,0xc0,0xa0,0xa9,0x2f,0xfd,0xd2,0x31,
+0x39,0xa3,0x6,0xfe,0xed,0x7,0x7,0x21,0xfe,0xdc,0xe,0xe,0xe,0xfe,0xb2,0xc,
+0xc,0xff,0x0,0x0,0x0,0x0,0xfd,0xdd,0xff,0xd0,0x14,0x15,0xff,0xfe,0xdd,0xf,
+0xf,0x21,0x10,0xfe,0xf4,0x4,0x3,0x3b,0x9f,0xc7,0x2f,0xcf,0xa0,0x7a,0xc0,0x31,
+0xc0,0x2f,0xc4,0x3d,0xc0,0x2f,0xf6,0x31,0xfe,0xe5,0xa,0x8,0xfe,0xb6,0x18,0x17,
+0xff,0x0,0x0,0x0,0x0,0xfd,0xdd,0xff,0xae,0xf,0xc,0xff,0xfe,0xe2,0xc,0xa,
+0x3c,0x31,0xc0,0x2f,0xfd,0xc9,0x3d,0xc0,0x2f,0xc7,0x39,0xfe,0xf4,0x4,0x3,0x21,
+0xfe,0xce,0x14,0x15,0x26,0x0,0xfd,0xe3,0xff,0xca,0x16,0x17,0xff,0xfe,0xe1,0xb,
+0xb,0xfe,0xf3,0x5,0x5,0x3b,0x2f,0x3e,0x2f,0xc5,0x3e,0x2f,0xfd,0xcb,0x2c,0xfe,
+0xf5,0x3,0x2,0xfe,0xe5,0xb,0x9,0xfe,0xb8,0x13,0x11,0x0,0xfd,0xdc,0x27,0x3b,
+0x9f,0xc7,0xc0,0x2f,0xfd,0xca,0x3d,0xc0,0x2f,0xc3,0x31,0x39,0x3a,0xfe,0xea,0x8,
+0x9,0xfe,0xde,0xe,0xe,0x16,0x0,0xfd,0xe8,0xff,0xca,0x14,0x13,0xff,0xfe,0xdb,
+0xf,0xe,0xfe,0xe9,0x9,0x9,0xa,0x3b,0x31,0x2f,0xfd,0xd1,0x3e,0x31,0x4e,0x1d,
+0x0,0xfd,0xdb,0x33,0x4,0x31,0x3e,0xc0,0x2f,0xfd,0xd1,0x39,0x8,0xfe,0xe1,0xd,
+0xc,0x2a,0x0,0xfd,0xec,0xff,0xbd,0x19,0x1a,0xff,0xfe,0xdc,0xe,0xe,0xfe,0xf0,
+0x6,0x5,0xfe,0xf9,0x1,0x1,0x2f,0x5a,0x2f,0xc1,0x2c,0x3e,0xc0,0x2f,0xfd,0xcb,
+0x5e,0xfe,0xf3,0x5,0x3,0x27,0x0,0xfd,0xd9,0x3f,0xfe,0xf6,0x4,0x2,0x30,0x2f,
+0xfd,0xd0,0x31,0x3b,0xa,0x1c,0xfe,0xdc,0xe,0xe,0xfe,0xcc,0x14,0x14,0x0,0xfd,
+0xf0,0xff,0xc5,0x13,0x13,0xff,0x3,0xfe,0xe6,0xa,0xa,0x4,0xfe,0xf8,0x3,0x2,
+0x9e,0xf8,0x2f,0xfd,0xcf,0x3e,0x31,0x3a,0x33,0x0,0xfd,0xd7,0x18,0x12,0x30,0x31,
+0x2c,0x2f,0xfd,0xcf,0x3b,0x6,0xfe,0xdc,0xe,0xe,0xfe,0xbc,0x19,0x1a,0x0,0xfd,
+0xf4,0xff,0xb1,0x17,0x17,0xff,0xfe,0xd8,0x10,0x10,0x10,0x3a,0x2f,0xfd,0xd1,0x5e,
+0xfe,0xef,0x7,0x5,0xfe,0xd4,0x14,0x13,0x0,0xfd,0xd5,0xff,0xc1,0x13,0x12,0xff,
+0x11,0x3a,0x2f,0xfd,0xce,0x31,0x3b,0x3c,0xfe,0xe8,0xa,0x9,0x3,0xfe,0xc3,0x13,
+0x13,0x0,0xfd,0xf8,0xff,0xbe,0x12,0x12,0xff,0xd,0x21,0x4,0x3a,0x31,0x2f,0xfd,
+0xce,0x3a,0x8,0xfe,0xca,0x14,0x11,0x0,0xfd,0xd4,0x27,0xfe,0xf7,0x3,0x2,0x31,
+0x2f,0xfd,0xc3,0xa0,0x8a,0xc0,0x2f,0xc1,0x3e,0x2f,0xc0,0x3e,0x2f,0x31,0x3b,0xfe,
+0xf1,0x6,0x3,0x29,0xfe,0xb6,0x18,0x17,0x0,0xfd,0xfc,0xff,0xab,0x17,0x17,0xff,
+0xd,0xfe,0xef,0x7,0x7,0x3a,0x2f,0xc0,0x3e,0x2f,0xc0,0x3e,0x2f,0x3e,0x2c,0x3d,
+0xc0,0x2f,0xfd,0xc2,0x31,0x4e,0x3a,0x20,0xfe,0xb1,0x13,0x12,0x0,0xfd,0xd2,0xff,
+0xd5,0x11,0x12,0xff,0x6,0x2f,0xfd,0xc5,0x3d,0xc0,0x2f,0xc4,0x31,0x37,0x10,0x27,
+0xfe,0xcd,0x15,0x13,0x0,0xfd,0xfd,0xc2,0xff,0xc2,0x12,0x12,0xff,0xfe,0xdc,0xe,
+0xe,0x12,0xfe,0xf7,0x3,0x3,0xfe,0xfd,0x1,0x0,0x2f,0x2c,0x2f,0xc2,0x3d,0xc0,
+0x2f,0xfd,0xc2,0x31,0xc0,0x2f,0xfe,0xf3,0x5,0x5,0x33,0x0,0xfd,0xd1,0xff,0xd0,
+0x14,0x13,0xff,0x6,0xfe,0xf9,0x1,0x1,0x2f,0xfd,0xcc,0x31,0xa0,0x6a,0x12,0xfe,
+0xcd,0x13,0x14,0x0,0xfd,0xfd,0xc6,0xff,0xc7,0x17,0x17,0xff,0xfe,0xe8,0xa,0x9,
+0xfe,0xfa,0x2,0x2,0x31,0x2f,0x7f,0x2f,0xc0,0x5a,0x2f,0xfd,0xc7,0x3b,0xa,0xfe,
+0xd4,0x12,0x12,0x0,0xfd,0xcf,0xff,0xb7,0x19,0x18,0xff,0xfe,0xe8,0x9,0xa,0x2f,
+0xc0,0x3e,0x2f,0xfd,0xc9,0x39,0xa3,0x6,0x11,0xfe,0xdc,0xe,0xe,0xfe,0xbe,0x12,
+0x12,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xc8,0xff,0xb4,0xe,0xe,0xff,0x3,0x1e,
+0xa,0x3b,0x2f,0xfd,0xcb,0x2c,0xfe,0xea,0x8,0x9,0xfe,0xc0,0x18,0x18,0x0,0xfd,
+0xce,0x1d,0xfe,0xf6,0x4,0x3,0x2f,0x5e,0xc0,0x2f,0xfd,0xc9,0x0,0xfe,0xe3,0xc,
+0xa,0xfe,0xc6,0x19,0x15,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xcc,0xff,0xba,0x16,
+0x15,0xff,0xfe,0xdc,0xe,0xe,0xa,0x2f,0xfd,0xc9,0x5e,0xc0,0x2f,0xfe,0xf7,0x3,
+0x3,0x1e,0xfe,0xb9,0x11,0x11,0x0,0xfd,0xcc,0xff,0xda,0x10,0xe,0xff,0x3a,0x9f,
+0xf8,0x2f,0x31,0xc0,0x2f,0xfd,0xc5,0x0,0x3b,0xa,0x1f,0xfe,0xd3,0x11,0x11,0xff,
+0x0,0x0,0x0,0x0,0xfd,0xfd,0xd0,0xe,0x21,0x4,0x3b,0x31,0x2f,0xfd,0xc5,0x31,
+0xc0,0x2f,0x31,0xa0,0x6a,0xfe,0xde,0xc,0xb,0x0,0xfd,0xcb,0xff,0xce,0x15,0x13,
+0xff,0x12,0xfe,0xfc,0x0,0x0,0x2f,0x7f,0x2f,0xc0,0x3e,0x2f,0xfd,0xc4,0xa3,0x28,
+0xfe,0xf3,0x5,0x5,0xfe,0xdc,0xe,0xe,0x1c,0x0,0xfd,0xfd,0xd3,0xff,0xd8,0x10,
+0x10,0xff,0x6,0x3b,0x2f,0xf9,0x5e,0xc0,0x2f,0xca,0x31,0x8,0x9,0x0,0xfd,0xc9,
+0xff,0xc1,0x13,0x14,0xff,0x11,0xfe,0xf8,0x2,0x3,0x2f,0xfd,0xc8,0x39,0xfe,0xf4,
+0x4,0x3,0x1f,0xc,0x0,0xfd,0xfd,0xd6,0xff,0xca,0x14,0x13,0xff,0xfe,0xe2,0xc,
+0xc,0x4,0x3b,0x2f,0xf7,0x31,0xc0,0x2f,0xcb,0xfe,0xf8,0x3,0x2,0x8,0x3c,0x0,
+0xfd,0xc8,0xff,0xdf,0xd,0xe,0xff,0x37,0xfe,0xfd,0x0,0x2,0x2f,0xfd,0xc1,0x5a,
+0x2f,0xc0,0x2c,0x2f,0xc1,0xfe,0xf4,0x4,0x3,0x2d,0xfe,0xbb,0x15,0x15,0x0,0xfd,
+0xfd,0xd8,0xff,0xac,0x12,0x12,0xff,0xfe,0xdb,0x11,0xf,0xfe,0xf1,0x5,0x5,0x2f,
+0xcb,0x31,0xc0,0x2f,0xf7,0x31,0xa2,0x18,0x1d,0xfe,0xb0,0x14,0x15,0x0,0xfd,0xc6,
+0xff,0xd6,0x12,0x13,0xff,0x6,0x2f,0xfd,0xc8,0xfe,0xf8,0x4,0x4,0xfe,0xeb,0x7,
+0x8,0xfe,0xd7,0x11,0x12,0x0,0xfd,0xfd,0xdc,0xff,0xd3,0x13,0x12,0xff,0xfe,0xe9,
+0x9,0x9,0xfe,0xf6,0x4,0x3,0xfe,0xfe,0x2,0x1,0x2c,0x2f,0xc0,0x2c,0x2f,0xc4,
+0x31,0xc0,0x2f,0xf9,0xa,0x33,0xff,0x0,0x0,0x0,0x0,0xfd,0xc5,0xff,0xd1,0x15,
+0x14,0xff,0x6,0x3a,0x31,0x2f,0xfd,0xc2,0x2c,0x2f,0xc1,0xa0,0x7a,0x1a,0xfe,0xc7,
+0x17,0x19,0x0,0xfd,0xfd,0xde,0xff,0xbe,0x18,0x18,0xff,0xfe,0xe6,0xb,0x9,0x39,
+0x31,0x2f,0xfd,0xc4,0x3e,0x2f,0x3b,0xa,0x9,0x0,0xfd,0xc3,0xff,0xb6,0x18,0x17,
+0xff,0x1e,0x2f,0x31,0xc0,0x2f,0xfd,0xc3,0x31,0x3b,0x4,0x2d,0xfe,0xc0,0x14,0x14,
+0x0,0xfd,0xfd,0xe0,0xff,0xb7,0x11,0x11,0xff,0xfe,0xde,0xe,0xc,0xfe,0xef,0x7,
+0x7,0x3b,0x31,0x2f,0xc1,0x7e,0x2f,0xfd,0xc0,0x3e,0x2f,0x1a,0xfe,0xc0,0x18,0x17,
+0x0,0xfd,0xc2,0x2d,0xfe,0xf4,0x4,0x3,0x2f,0xc7,0x31,0xc0,0x2f,0xf4,0x31,0xc0,
+0x2f,0xc0,0x3e,0x3b,0xfe,0xf3,0x5,0x3,0xfe,0xd8,0x11,0xe,0x0,0xfd,0xfd,0xe4,
+0x9,0x6,0x3b,0x2f,0xc3,0x31,0xc0,0x2f,0xf6,0x3e,0xc0,0x2f,0xc2,0x3e,0xfe,0xf6,
+0x4,0x3,0x1f,0xfe,0xb1,0xf,0xd,0xff,0x0,0x0,0x0,0x0,0xfd,0xc0,0xff,0xd5,
+0x11,0x12,0xff,0xfe,0xf7,0x3,0x3,0x39,0x2f,0xc7,0x31,0xc0,0x2f,0xf4,0x31,0xc0,
+0x2f,0x39,0x3a,0x1f,0xfe,0xd0,0x14,0x13,0x0,0xfd,0xfd,0xe6,0xff,0xcb,0x13,0x13,
+0xff,0x20,0xa,0x3b,0x9f,0xe8,0x45,0x2f,0x31,0xc0,0x2f,0xf7,0x2c,0x2f,0xc3,0x31,
+0x3b,0x3,0x0,0xfd,0xff,0xb6,0x16,0x16,0xff,0xfe,0xe5,0x9,0x9,0x39,0xa1,0xa6,
+0x31,0x3e,0x2f,0xfd,0xc2,0xfe,0xf4,0x4,0x3,0x2d,0x22,0xff,0x0,0x0,0x0,0x0,
+0xfd,0xfd,0xe8,0xff,0xb2,0x14,0x13,0xff,0xfe,0xdc,0xe,0xe,0xa,0x2f,0xfd,0xc1,
+0x2c,0x2f,0xc1,0x5e,0x1c,0xfe,0xc3,0x17,0x17,0x0,0xfc,0xff,0xdd,0xf,0xf,0xff,
+0xa,0x2f,0x31,0xc0,0x3e,0x2f,0xfd,0xc0,0x3b,0x4,0xfe,0xdc,0xe,0xe,0xfe,0xae,
+0xe,0xe,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xeb,0x3,0x16,0xfe,0xfb,0x3,0x3,
+0x2f,0xfc,0x2c,0x2f,0xc3,0x3a,0x2b,0x0,0xfb,0xe,0xfe,0xf3,0x5,0x5,0x3b,0x2f,
+0xfd,0xc4,0x4,0xd,0x0,0xfd,0xfd,0xee,0xc,0xfe,0xf0,0x6,0x7,0x2f,0xc4,0x3e,
+0x2f,0xf2,0x5e,0xc0,0x2f,0xc5,0x39,0x3a,0x9,0x0,0xf9,0xff,0xab,0x17,0x17,0xff,
+0xfe,0xe6,0xc,0xb,0x2f,0xfd,0xc4,0xfe,0xf8,0x3,0x2,0x16,0xd,0x0,0xfd,0xfd,
+0xf0,0xff,0xd3,0x12,0x13,0xff,0xfe,0xec,0x8,0x7,0xfe,0xf7,0x2,0x1,0x2f,0xc0,
+0x2c,0x2f,0xf4,0x31,0xc0,0x2f,0xc7,0x1e,0xfe,0xb7,0x17,0x17,0x0,0xf8,0x33,0xfe,
+0xf3,0x5,0x5,0x2f,0xfd,0xc4,0x16,0xfe,0xce,0x15,0x13,0x0,0xfd,0xfd,0xf2,0xff,
+0xc8,0x16,0x16,0xff,0x12,0x2f,0x3e,0x2f,0xfd,0xa0,0x8a,0xc0,0x2f,0xfe,0xf4,0x4,
+0x3,0xfe,0xe2,0xc,0xc,0x0,0xf7,0xff,0xce,0x14,0x15,0xff,0xa,0x3b,0x2f,0xf8,
+0x2c,0x2f,0xc5,0xfe,0xf8,0x3,0x2,0xfe,0xec,0x8,0x9,0xe,0x0,0xfd,0xfd,0xf4,
+0xff,0xcd,0x15,0x15,0xff,0x1c,0xfe,0xf7,0x3,0x3,0x2f,0xfd,0x3d,0xc0,0x2f,0x39,
+0x3e,0xfe,0xd5,0x13,0x13,0x0,0xf6,0x2d,0x3b,0x31,0x2f,0x31,0xc0,0x2f,0xfb,0x2c,
+0x2f,0x12,0xfe,0xc6,0x18,0x19,0x0,0xfd,0xfd,0xf6,0xff,0xbf,0x19,0x19,0xff,0xfe,
+0xe8,0x9,0xa,0x31,0x2f,0xfd,0xc1,0x31,0x39,0xfe,0xe3,0xc,0xa,0xfe,0xac,0x16,
+0x17,0x0,0xf4,0x16,0xfe,0xef,0x7,0x7,0x2f,0xc1,0x31,0xc0,0x2f,0xfb,0x3e,0xfe,
+0xe8,0xa,0x9,0xfe,0xc8,0x14,0x13,0x0,0xfd,0xfd,0xf8,0x25,0x21,0xfe,0xf4,0x4,
+0x3,0x31,0x2f,0xfd,0x7f,0x2f,0x6,0x7,0x0,0xf3,0x1,0x12,0xfe,0xf8,0x2,0x3,
+0x2f,0xc5,0xa0,0x7a,0xc0,0x2f,0xf6,0x3e,0x1e,0xfe,0xb7,0x17,0x17,0x0,0xfd,0xfd,
+0xfa,0xff,0xac,0x16,0x15,0xff,0x20,0x39,0x9f,0xb9,0x3d,0x2f,0xfd,0x3b,0xfe,0xf1,
+0x7,0x6,0xfe,0xc8,0x16,0x16,0x0,0xf2,0x33,0x39,0x31,0x2c,0x2f,0x3e,0x2f,0xc2,
+0x3a,0xc0,0x2f,0xf4,0x2c,0xfe,0xf7,0x3,0x3,0x1e,0xfe,0xc1,0x11,0x11,0x0,0xfd,
+0xfd,0xfc,0x26,0xfe,0xe3,0xb,0xc,0xfe,0xf5,0x5,0x6,0x3d,0x2f,0xfc,0x2c,0x2f,
+0xa2,0x67,0xfe,0xdf,0xd,0xc,0xff,0x0,0x0,0x0,0x0,0xf1,0xf,0x1c,0x31,0x2f,
+0xfd,0xc0,0x31,0x1e,0x2e,0x0,0xfd,0xfd,0xfd,0xc0,0xff,0xad,0x17,0x18,0xff,0xfe,
+0xe5,0xb,0xc,0x3a,0xa1,0x96,0x55,0xfd,0xc0,0x12,0xfe,0xc9,0x17,0x17,0x0,0xf0,
+0xff,0xde,0xe,0xe,0xff,0xfe,0xf4,0x6,0x6,0x2f,0xc0,0x3e,0xc0,0x2f,0xfa,0xfe,
+0xf7,0x3,0x2,0x1a,0xfe,0xc7,0x15,0x13,0x0,0xfd,0xfd,0xfd,0xc2,0x25,0xfe,0xe8,
+0x9,0xa,0xfe,0xf7,0x3,0x3,0x2f,0xc5,0x2c,0x2f,0xf6,0xfe,0xf6,0x4,0x3,0xfe,
+0xe3,0xc,0xa,0xff,0x0,0x0,0x0,0x0,0xef,0xd,0xa,0xfe,0xfb,0x3,0x3,0x9e,
+0xe8,0x2f,0xfd,0xfe,0xea,0x9,0x7,0xfe,0xc5,0x19,0x19,0x0,0xfd,0xfd,0xfd,0xc4,
+0xff,0xbc,0x1a,0x18,0xff,0x1e,0x31,0x2f,0xc8,0x3d,0xc0,0x2f,0xf1,0x39,0xa3,0x6,
+0x9,0xff,0x0,0x0,0x0,0x0,0xee,0x2b,0x2f,0xfd,0xc0,0xfe,0xf8,0x3,0x2,0x16,
+0xfe,0xd1,0x15,0x14,0x0,0xfd,0xfd,0xfd,0xc6,0x36,0xfe,0xeb,0xa,0x8,0xfe,0xf7,
+0x3,0x3,0x2f,0xc3,0x7f,0x2f,0xc1,0x3d,0xc0,0x2f,0xf3,0x21,0xfe,0xad,0x19,0x19,
+0x0,0xec,0xff,0xce,0x14,0x15,0xff,0xfe,0xef,0x7,0x7,0x2f,0xfd,0x2c,0x16,0xfe,
+0xcd,0x13,0x14,0x0,0xfd,0xfd,0xfd,0xc8,0xff,0xc6,0x18,0x17,0xff,0xfe,0xec,0x8,
+0x9,0x2f,0x3e,0x2f,0xc5,0x3d,0xc0,0x2f,0xf3,0xfe,0xf1,0x5,0x5,0xfe,0xd6,0x10,
+0x11,0x0,0xeb,0xff,0xb1,0xd,0xe,0xff,0xfe,0xe8,0x9,0xa,0xfe,0xf7,0x3,0x3,
+0x2f,0xfc,0x3b,0x4,0xfe,0xd7,0x11,0x12,0x0,0xfd,0xfd,0xfd,0xca,0xc,0x16,0x3a,
+0x2f,0xc2,0x2c,0x2f,0xc0,0x3d,0x2f,0xf4,0x3a,0xfe,0xed,0x7,0x7,0xfe,0xbe,0x12,
+0x12,0x0,0xea,0x18,0xfe,0xf6,0x2,0x2,0x39,0x9f,0xc7,0xfc,0x4,0xfe,0xd7,0x11,
+0x10,0x0,0xfd,0xfd,0xfd,0xcc,0xff,0xce,0x15,0x13,0xff,0x16,0x2f,0xfc,0x31,0xa1,
+0x18,0xfe,0xd8,0x10,0x10,0x0,0xea,0xff,0xe3,0xc,0xa,0xff,0x2f,0xc5,0x7f,0x2f,
+0xf4,0x39,0xfe,0xf4,0x4,0x3,0xfe,0xdc,0xe,0xe,0x0,0xfd,0xfd,0xfd,0xce,0x3f,
+0x4,0x3b,0x2f,0xfc,0xfe,0xe6,0xa,0xa,0xfe,0xb0,0x18,0x17,0x0,0xe8,0xc,0x16,
+0x2f,0x5e,0xc0,0x2f,0xf9,0x3a,0x2d,0xfe,0xae,0x10,0xf,0x0,0xfd,0xfd,0xfd,0xcf,
+0x3d,0x4,0x2f,0xfc,0x4,0x3f,0x0,0xe7,0xff,0xb4,0xe,0xe,0xff,0x1c,0xfe,0xf7,
+0x3,0x3,0x2f,0x31,0xc0,0x2f,0xf7,0x31,0x3b,0x1f,0xfe,0xb8,0x14,0x13,0x0,0xfd,
+0xfd,0xfd,0xd1,0x2d,0xfe,0xf8,0x3,0x2,0x31,0x2f,0xfa,0x3a,0x10,0xfe,0xbf,0x11,
+0x10,0x0,0xe6,0xff,0xd7,0x11,0x12,0xff,0x3e,0x9e,0xe9,0x2f,0xc1,0xa0,0x8a,0xc0,
+0x2f,0xf5,0x3b,0xfe,0xf2,0x4,0x4,0xe,0x0,0xfd,0xfd,0xfd,0xd2,0xff,0xc4,0x12,
+0x12,0xff,0x10,0x3a,0xfe,0xff,0x1,0x1,0x2f,0xf9,0x31,0x3a,0x3,0x0,0xe5,0xff,
+0xae,0x18,0x19,0xff,0x1f,0x2f,0x2c,0x2f,0xc1,0x3d,0xc0,0x2f,0xf4,0x31,0xfe,0xf0,
+0x6,0x5,0xfe,0xd8,0x10,0x10,0x0,0xfd,0xfd,0xfd,0xd4,0xff,0xcf,0x13,0x12,0xff,
+0x10,0x31,0x2f,0xf9,0x3e,0x2f,0x1c,0x13,0x0,0xe4,0xff,0xd3,0x12,0x13,0xff,0x14,
+0x2f,0xc0,0x3e,0x2f,0xf7,0x31,0x39,0x2d,0x0,0xfd,0xfd,0xfd,0xd6,0xff,0xdc,0xe,
+0xe,0xff,0xfe,0xfa,0x2,0x2,0x9f,0xc7,0x2f,0xf9,0x7e,0xfe,0xf1,0x6,0x3,0xfe,
+0xda,0x10,0xe,0x0,0xe3,0xff,0xb0,0xd,0xe,0xff,0xfe,0xe8,0x9,0xa,0xfe,0xf7,
+0x3,0x3,0x2f,0xfa,0x3e,0x1c,0x1,0x0,0xfd,0xfd,0xfd,0xd6,0xff,0xb3,0xf,0x10,
+0xff,0x21,0xfe,0xf6,0x4,0x3,0x2f,0xf9,0x2c,0x3a,0x10,0x7,0xff,0x0,0x0,0x0,
+0x0,0xe2,0xd,0xfe,0xf8,0x4,0x4,0x39,0x2f,0xfa,0x1a,0xfe,0xc5,0x17,0x18,0x0,
+0xfd,0xfd,0xfd,0xd8,0xff,0xbd,0x19,0x1a,0xff,0x1c,0x2f,0xf7,0x7f,0x2f,0xc0,0x31,
+0x3a,0xfe,0xd7,0x11,0x10,0x0,0xe2,0x2d,0x2c,0x2f,0xf9,0x39,0xfe,0xf4,0x4,0x3,
+0xfe,0xd4,0x10,0x11,0x0,0xfd,0xfd,0xfd,0xda,0xc,0x4,0xfe,0xfa,0x2,0x2,0x2f,
+0xfa,0x21,0x0,0xe1,0x30,0x1a,0x2c,0x2f,0xec,0x31,0xc0,0x2f,0xc2,0xa0,0x8a,0xc0,
+0x2f,0xc0,0x3e,0x2f,0xc0,0x3a,0x27,0x0,0xfd,0xfd,0xfd,0xdc,0xff,0xd8,0x10,0x10,
+0xff,0x4,0x2f,0xfa,0x16,0xfe,0xce,0x15,0x13,0x0,0xe0,0xff,0xdd,0xd,0xd,0xff,
+0xfe,0xf3,0x5,0x5,0x2f,0xed,0x31,0xc0,0x2f,0xc2,0xa0,0x8a,0xc0,0x2f,0xc0,0x2c,
+0x31,0xa2,0x49,0xfe,0xe6,0xa,0xa,0xfe,0xb8,0x14,0x13,0x0,0xfd,0xfd,0xfd,0xdd,
+0xff,0xe2,0xc,0xc,0xff,0xfe,0xf8,0x3,0x2,0x31,0x2f,0xf8,0xfe,0xf6,0x4,0x3,
+0x21,0xff,0x0,0x0,0x0,0x0,0xdf,0xff,0xcb,0x15,0x14,0xff,0xfe,0xf3,0x5,0x5,
+0x3b,0x2f,0xf3,0x2c,0x2f,0x2c,0x2f,0xc0,0x3b,0xa,0xfe,0xcf,0x13,0x12,0x0,0xfd,
+0xfd,0xfd,0xde,0x36,0xfe,0xef,0x7,0x5,0x3a,0x2f,0xf8,0x39,0xa3,0x6,0x1d,0xff,
+0x0,0x0,0x0,0x0,0xde,0xff,0xdc,0xe,0xe,0xff,0xfe,0xfd,0x1,0x0,0x3e,0x2f,
+0xf8,0xa,0xfe,0xdc,0xe,0xe,0x0,0xfd,0xfd,0xfd,0xe0,0xff,0xd5,0x12,0x10,0xff,
+0xfe,0xf0,0x6,0x5,0x2f,0xf9,0x5e,0xfe,0xe0,0xe,0xd,0x0,0xdd,0x1e,0x1f,0x2f,
+0xc7,0x3d,0xc0,0x2f,0xe6,0x31,0xc2,0x2f,0xc3,0x1f,0x1e,0x0,0xfd,0xfd,0xfd,0xe1,
+0xff,0xe3,0xc,0xa,0xff,0x2f,0xfa,0x1c,0xfe,0xbd,0x19,0x18,0x0,0xdc,0xe,0x16,
+0x2f,0xc7,0x3d,0xc0,0x2f,0xe6,0x31,0xc2,0x2f,0xc1,0x39,0xfe,0xf3,0x3,0x2,0xfe,
+0xd3,0x13,0x12,0x0,0xfd,0xfd,0xfd,0xe2,0xff,0xce,0x14,0x15,0xff,0xa,0x3b,0x2f,
+0xf8,0x4,0xfe,0xd7,0x11,0x10,0x0,0xdc,0xff,0xe8,0xa,0x9,0xff,0xfe,0xf7,0x3,
+0x2,0x2f,0xc3,0x31,0xc0,0x2f,0xf1,0xfe,0xf4,0x4,0x3,0xfe,0xe2,0xc,0xc,0x0,
+0xfd,0xfd,0xfd,0xe4,0x33,0xa,0x2f,0xf8,0xfe,0xf7,0x2,0x1,0x10,0xfe,0xb4,0xc,
+0xc,0x0,0xda,0xd,0xfe,0xf6,0x4,0x2,0x9e,0xf8,0x2f,0xc1,0x7f,0x2f,0x31,0xc0,
+0x2f,0xf0,0x31,0x1a,0xfe,0xc3,0x17,0x17,0x0,0xfd,0xfd,0xfd,0xe4,0xff,0xb6,0x16,
+0x16,0xff,0xfe,0xe6,0xa,0xa,0x31,0x2f,0xf7,0x31,0x3b,0xfe,0xd3,0x12,0x13,0x0,
+0xda,0x33,0x30,0x31,0xc0,0x2f,0xc4,0x3d,0xc0,0x2f,0xc2,0x3d,0xc0,0x2f,0xe2,0x31,
+0xc0,0x2f,0xc1,0x31,0xa0,0x6a,0xfe,0xdc,0xe,0xe,0x0,0xfd,0xfd,0xfd,0xe6,0xff,
+0xd6,0x10,0xf,0xff,0xfe,0xf8,0x3,0x2,0x9e,0xf8,0x2f,0xf7,0x31,0xfe,0xde,0xe,
+0xe,0x0,0xd9,0x26,0x1f,0x2f,0x31,0xc0,0x2f,0xc4,0x3d,0xc0,0x2f,0xc2,0x3d,0xc0,
+0x2f,0xe2,0x31,0xc0,0x2f,0xc1,0x3a,0xfe,0xec,0x8,0x9,0x1,0x0,0xfd,0xfd,0xfd,
+0xe7,0x1f,0xfe,0xf6,0x4,0x3,0x2f,0xf8,0x1e,0xfe,0xba,0x1a,0x1a,0xff,0x0,0x0,
+0x0,0x0,0xd8,0xff,0xce,0x15,0x13,0xff,0x8,0x2f,0xc3,0x3d,0xc0,0x2f,0xc4,0x31,
+0xc2,0x2f,0xe7,0x10,0xfe,0xcd,0x15,0x15,0x0,0xfd,0xfd,0xfd,0xe8,0xff,0xc1,0x17,
+0x17,0xff,0x1a,0x2f,0xf6,0x2c,0x2f,0x4,0x3f,0x0,0xd8,0xff,0xe3,0xc,0xa,0xff,
+0xfe,0xf6,0x4,0x3,0x2f,0xc3,0x3d,0xc0,0x2f,0xc4,0x31,0xc2,0x2f,0xe5,0x31,0x3b,
+0x27,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xea,0x3,0xfe,0xf7,0x3,0x2,0x9f,
+0xd7,0x2f,0xf6,0x37,0x1a,0xfe,0xb2,0xc,0xc,0x0,0xd6,0xff,0xcb,0x13,0x13,0xff,
+0xfe,0xf4,0x4,0x3,0xfe,0xfa,0x0,0x1,0x2f,0x3d,0xc0,0x2f,0xf3,0x3b,0x4,0xfe,
+0xca,0x14,0x13,0x0,0xfd,0xfd,0xfd,0xea,0x1,0xfe,0xea,0x9,0x7,0x37,0x2f,0xc2,
+0x2c,0x2f,0xee,0x2c,0x2f,0xc0,0x30,0xa1,0x3a,0xfe,0xd2,0x14,0x14,0x0,0xd6,0x3,
+0x31,0x2f,0xc0,0x3d,0xc0,0x2f,0xf3,0xa,0x33,0x0,0xfd,0xfd,0xfd,0xec,0xb,0x6,
+0x2f,0x7f,0x2c,0x2f,0xf4,0x2c,0xfe,0xde,0xe,0xe,0x0,0xd6,0xff,0xe2,0xc,0xc,
+0xff,0xfe,0xff,0x1,0x3,0x2f,0x3e,0x2f,0xc6,0x3d,0xc0,0x31,0xc0,0x2f,0xe8,0x3d,
+0x1f,0xfe,0xb1,0x17,0x17,0x0,0xfd,0xfd,0xfd,0xed,0x20,0x2f,0xc2,0x2c,0x3d,0xc0,
+0x31,0xc0,0x2f,0xc0,0x31,0xc0,0x2f,0xeb,0xfe,0xe6,0xc,0xb,0xfe,0xab,0x17,0x17,
+0x0,0xd4,0xff,0xc2,0x1a,0x1a,0xff,0x1a,0x3d,0x2f,0x3e,0x2f,0xc6,0x3d,0xc0,0x31,
+0xc0,0x2f,0xe7,0xa0,0x7a,0xa2,0x17,0xfe,0xd8,0x10,0x12,0x0,0xfd,0xfd,0xfd,0xee,
+0xff,0xd4,0x12,0x12,0xff,0xfe,0xf7,0x3,0x3,0x39,0x2c,0xa1,0x98,0x2f,0x3d,0x2f,
+0x31,0xc0,0x2f,0xc0,0x31,0xc0,0x2f,0xeb,0x10,0xfe,0xc9,0x15,0x16,0x0,0xd4,0xff,
+0xd8,0x10,0x10,0xff,0x4,0x2f,0x31,0xc0,0x2f,0xee,0x2c,0x2f,0xc2,0xfe,0xf8,0x3,
+0x2,0x10,0x5,0x0,0xfd,0xfd,0xfd,0xee,0xff,0xb2,0xe,0xf,0xff,0xfe,0xe8,0x8,
+0x9,0xfe,0xf7,0x3,0x3,0x2f,0xf1,0xa0,0x8a,0xc0,0x2f,0xc1,0xfe,0xf4,0x4,0x3,
+0x27,0x0,0xd3,0xff,0xaf,0xb,0xa,0xff,0xfe,0xe9,0x9,0x9,0x3e,0x2f,0x31,0xc0,
+0x2f,0xf3,0x4,0x3,0x0,0xfd,0xfd,0xfd,0xf0,0xff,0xd1,0x13,0x13,0xff,0xfe,0xef,
+0x7,0x7,0x2f,0xf1,0x3d,0xc0,0x2f,0x2c,0x2f,0xfe,0xf8,0x3,0x2,0x8,0xfe,0xbc,
+0x10,0xe,0x0,0xd2,0xe,0xfe,0xf7,0x3,0x2,0x9f,0xd7,0x2f,0x7f,0x2f,0xef,0x2c,
+0x2f,0xc0,0x2c,0x2f,0x1c,0xfe,0xbc,0x19,0x1a,0x0,0xfd,0xfd,0xfd,0xf1,0x20,0x2f,
+0x3d,0xc0,0x2f,0xf3,0x31,0x3a,0xfe,0xd3,0x13,0x12,0x0,0xd2,0xff,0xdb,0xd,0xd,
+0xff,0x2f,0xf6,0x31,0x3b,0xfe,0xdb,0xf,0xe,0x0,0xfd,0xfd,0xfd,0xf2,0x9,0xfe,
+0xf7,0x3,0x3,0x39,0x9f,0xb8,0x2f,0xee,0x7f,0x2f,0xc4,0xfe,0xde,0xe,0xc,0x0,
+0xd2,0x20,0x2f,0xf6,0x3b,0xfe,0xf3,0x5,0x5,0xfe,0xca,0x14,0x13,0x0,0xfd,0xfd,
+0xfd,0xf2,0xff,0xb1,0xd,0xc,0xff,0x1e,0xfe,0xf7,0x3,0x3,0x2f,0xef,0x7f,0x2f,
+0xc4,0xfe,0xe5,0xb,0xa,0x0,0xd1,0xff,0xc2,0x1a,0x19,0xff,0x1a,0x2f,0x3e,0x2f,
+0xf4,0xfe,0xf4,0x6,0x4,0xfe,0xde,0xe,0xe,0x0,0xfd,0xfd,0xfd,0xf4,0xff,0xd3,
+0x13,0x12,0xff,0x6,0x2f,0xf1,0x5a,0x2f,0xc2,0xfe,0xec,0x8,0x9,0xfe,0xc7,0x17,
+0x17,0x0,0xd0,0xff,0xd5,0x11,0x12,0xff,0x6,0x2f,0x3e,0x2f,0xf1,0x3d,0xc0,0x2f,
+0xfe,0xe9,0x9,0x9,0xfe,0xbc,0x1a,0x18,0x0,0xfd,0xfd,0xfd,0xf4,0xff,0xae,0x18,
+0x17,0xff,0x1f,0x2f,0xf1,0x3e,0x2f,0x3e,0x2f,0x3d,0xa,0xfe,0xdb,0xf,0x10,0x0,
+0xd0,0x1f,0xfe,0xf6,0x4,0x3,0x2f,0xc0,0x2c,0x2f,0xf0,0x3d,0x5a,0x3b,0xfe,0xdb,
+0xf,0xe,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xf6,0xff,0xd7,0xf,0xf,0xff,
+0xfe,0xf8,0x3,0x2,0x31,0x2f,0xf0,0x2c,0x2f,0xc0,0x3d,0xfe,0xf7,0x3,0x3,0xfe,
+0xed,0x9,0xa,0xfe,0xad,0x7,0x7,0x0,0xce,0xff,0xc4,0x10,0x11,0xff,0xfe,0xf4,
+0x4,0x3,0x39,0x2c,0x7a,0xf2,0x3d,0xa2,0x27,0xfe,0xf4,0x6,0x6,0x3c,0x0,0xfd,
+0xfd,0xfd,0xf6,0xff,0xbe,0x12,0x12,0xff,0xfe,0xed,0x7,0x7,0xfe,0xf8,0x3,0x2,
+0x2f,0xf4,0x39,0xa1,0x48,0xd,0x0,0xce,0xff,0xd5,0x11,0x12,0xff,0xfe,0xfe,0x1,
+0x3,0x2f,0xf4,0x3d,0xfe,0xf6,0x3,0x5,0xfe,0xe3,0xb,0xc,0x0,0xfd,0xfd,0xfd,
+0xf8,0x3,0xfe,0xf2,0x6,0x6,0x2f,0xf6,0x3,0x0,0xce,0xff,0xdc,0xe,0xe,0xff,
+0x2f,0xf6,0x10,0xfe,0xcc,0x15,0x17,0x0,0xfd,0xfd,0xfd,0xf8,0xff,0xbc,0x1a,0x18,
+0xff,0x1c,0x2f,0xc1,0x3d,0xc0,0x2f,0xf1,0x27,0x0,0xce,0xff,0xe2,0xa,0xb,0xff,
+0x2f,0xf6,0x21,0x0,0xfd,0xfd,0xfd,0xfa,0x27,0xfe,0xfd,0x1,0x0,0x2f,0xc0,0x3d,
+0xc0,0x2f,0xf1,0x1f,0x26,0x0,0xcc,0xff,0xc0,0x1a,0x1a,0xff,0xfe,0xea,0x8,0x9,
+0x2f,0xc3,0x2c,0x2f,0xf0,0xfe,0xdc,0xe,0xe,0x0,0xfd,0xfd,0xfd,0xfa,0xff,0xd8,
+0x12,0x13,0xff,0x39,0xa0,0xa6,0x2f,0xf4,0xfe,0xec,0x8,0x7,0x24,0x0,0xcc,0xff,
+0xd3,0x12,0x13,0xff,0x6,0x2f,0xf4,0x39,0x3e,0xe,0x0,0xfd,0xfd,0xfd,0xfa,0xff,
+0xbf,0xf,0xf,0xff,0x4,0x3b,0x2f,0xf4,0xa,0x33,0x0,0xcc,0xff,0xe2,0xb,0x9,
+0xff,0xfe,0xf6,0x4,0x3,0x2f,0xf4,0x3e,0xfe,0xe9,0x9,0x9,0xff,0x0,0x0,0x0,
+0x0,0xfd,0xfd,0xfd,0xfc,0xff,0xde,0xe,0xc,0xff,0xfe,0xf4,0x4,0x5,0x2f,0xf4,
+0x3a,0x12,0xfe,0xad,0x7,0x7,0x0,0xca,0xff,0xb9,0xd,0xd,0xff,0x6,0x3b,0x2f,
+0xf4,0x6,0x7,0x0,0xfd,0xfd,0xfd,0xfc,0x24,0x12,0xfe,0xff,0x1,0x1,0x2f,0xf3,
+0x30,0xa1,0x39,0xfe,0xcb,0x13,0x13,0x0,0xca,0xe,0x3b,0x31,0x2f,0xf2,0x3e,0x2f,
+0x1c,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0x21,0x2f,0xf4,0x31,0x30,0xfe,0xd4,0x12,0x10,
+0x0,0xca,0xff,0xd8,0x10,0x10,0xff,0x2f,0xf2,0x3e,0x2f,0xc0,0x31,0x27,0x0,0xfd,
+0xfd,0xfd,0xfd,0xc0,0x1,0x39,0x2f,0xf2,0x2c,0x3e,0x2f,0x33,0x0,0xca,0xff,0xde,
+0xe,0xe,0xff,0x3e,0x2f,0xc0,0xa0,0x8a,0xc0,0x2f,0xe4,0x31,0xc0,0x2f,0xc4,0x3d,
+0xc0,0x2f,0x31,0x30,0xfe,0xd8,0x12,0x11,0x0,0xfd,0xfd,0xfd,0xfd,0xc0,0xff,0xd1,
+0x15,0x14,0xff,0xfe,0xf7,0x3,0x3,0xfe,0xfd,0x0,0x2,0x2f,0xf4,0xfe,0xe1,0xd,
+0xc,0x0,0xca,0xff,0xe2,0xa,0xb,0xff,0x2f,0xc1,0x3d,0xc0,0x2f,0xe4,0x31,0xc0,
+0x2f,0xc4,0x3d,0xc0,0x2f,0xa2,0x28,0x4,0xfe,0xc0,0x10,0x10,0x0,0xfd,0xfd,0xfd,
+0xfd,0xc1,0xff,0xea,0x8,0x9,0xff,0x3e,0x2f,0xf4,0x21,0xfe,0xac,0x18,0x18,0x0,
+0xc8,0xff,0xba,0x1a,0x1a,0xff,0xfe,0xe8,0x9,0xa,0x2f,0xf2,0x7f,0x2c,0xa,0x37,
+0x0,0xfd,0xfd,0xfd,0xfd,0xc2,0xff,0xd4,0x12,0x13,0xff,0xfe,0xf0,0x6,0x7,0x2f,
+0xf4,0x1a,0xfe,0xc3,0x19,0x19,0x0,0xc8,0x23,0xfe,0xed,0x7,0x7,0x2f,0xf4,0x10,
+0xfe,0xca,0x16,0x17,0x0,0xfd,0xfd,0xfd,0xfd,0xc2,0xff,0xbc,0x19,0x1a,0xff,0xfe,
+0xe9,0x9,0x9,0x2f,0xf3,0x3e,0x6,0xb,0x0,0xc8,0x33,0xa,0x2f,0xf4,0x1f,0xfe,
+0xac,0x16,0x17,0x0,0xfd,0xfd,0xfd,0xfd,0xc3,0x2d,0x31,0x2f,0xf3,0xfe,0xf6,0x4,
+0x3,0xfe,0xe4,0xd,0xb,0xff,0x0,0x0,0x0,0x0,0xc8,0xff,0xe8,0xa,0x9,0xff,
+0xfe,0xf7,0x3,0x3,0xfe,0xfe,0x0,0x0,0xf4,0xfe,0xdf,0xd,0xe,0x0,0xfd,0xfd,
+0xfd,0xfd,0xc4,0x3,0x31,0xa0,0xa9,0x2f,0xf0,0x3e,0x2f,0x3b,0x6,0xfe,0xb5,0xb,
+0xb,0x0,0xc6,0xff,0xbb,0xb,0xb,0xff,0xa,0x3b,0x2f,0xf4,0x3,0x0,0xfd,0xfd,
+0xfd,0xfd,0xc4,0xff,0xd4,0x12,0x12,0xff,0x3a,0x2f,0xf3,0x31,0xa2,0x18,0xfe,0xcb,
+0x13,0x13,0x0,0xc6,0xff,0xd0,0x14,0x13,0xff,0x3b,0x31,0x2f,0xf2,0x31,0x3b,0xc,
+0x0,0xfd,0xfd,0xfd,0xfd,0xc4,0xff,0xc5,0x11,0x10,0xff,0xfe,0xf6,0x4,0x3,0x39,
+0x2f,0xf0,0x2c,0x2f,0xc0,0x31,0xfe,0xd4,0x12,0x12,0xff,0x0,0x0,0x0,0x0,0xc6,
+0x7,0x31,0x2f,0x3e,0x2f,0xf1,0x3b,0x4,0xfe,0xbd,0xf,0xe,0x0,0xfd,0xfd,0xfd,
+0xfd,0xc5,0x1e,0xfe,0xf6,0x2,0x2,0x2c,0x7a,0xf3,0x3,0x0,0xc6,0x1,0x2f,0xf4,
+0xfe,0xf5,0x3,0x2,0x21,0x0,0xfd,0xfd,0xfd,0xfd,0xc6,0xff,0xd8,0x11,0xe,0xff,
+0x4,0x2f,0xf4,0x37,0x0,0xc6,0x37,0x3e,0x2f,0xf3,0x6,0x9,0x0,0xfd,0xfd,0xfd,
+0xfd,0xc6,0xff,0xc7,0x17,0x17,0xff,0x12,0x2f,0xf3,0x3d,0xfe,0xe1,0xc,0xe,0x0,
+0xc6,0x2b,0x2f,0xf4,0x1a,0xfe,0xc2,0x18,0x18,0x0,0xfd,0xfd,0xfd,0xfd,0xc6,0xff,
+0xb2,0x1a,0x19,0xff,0x1f,0x2f,0xf3,0x3d,0xfe,0xe5,0xb,0xc,0x0,0xc5,0xff,0xb0,
+0x17,0x19,0xff,0x1f,0xfe,0xfe,0x0,0x0,0xc3,0x3d,0xc2,0x2f,0xe2,0x3d,0xc0,0x2f,
+0xc2,0x5e,0xc0,0x2f,0x21,0x0,0xfd,0xfd,0xfd,0xfd,0xc8,0x2d,0x2f,0xf3,0x5b,0xfe,
+0xe9,0x9,0xa,0xfe,0xbe,0x1b,0x1c,0x0,0xc4,0xff,0xc2,0x19,0x1c,0xff,0x1a,0x2f,
+0xc3,0x3d,0xc2,0x2f,0xe2,0x3d,0xc0,0x2f,0xc2,0x31,0xc0,0x2f,0xfe,0xdf,0xd,0xc,
+0x0,0xfd,0xfd,0xfd,0xfd,0xc8,0x1,0x31,0x2f,0xf2,0x33,0xfe,0xec,0x8,0x9,0x22,
+0x0,0xc4,0xff,0xcd,0x15,0x15,0xff,0x10,0x2f,0xc0,0x2c,0x2f,0xf1,0xfe,0xd8,0x10,
+0x10,0x0,0xfd,0xfd,0xfd,0xfd,0xc8,0xb,0x39,0x31,0x2f,0xc3,0xa0,0x8a,0xc0,0x2f,
+0xc4,0x31,0xc0,0x2f,0xe0,0x3d,0xc0,0x2f,0x14,0x9,0x0,0xc4,0x7,0x4,0x2f,0xf1,
+0x3e,0x31,0x3b,0x1d,0x0,0xfd,0xfd,0xfd,0xfd,0xc8,0xff,0xc0,0xe,0xe,0xff,0xfe,
+0xf3,0x5,0x3,0x39,0x2f,0xc3,0x3d,0xc0,0x2f,0xc4,0x31,0xc0,0x2f,0xe0,0x3d,0xc0,
+0x2f,0xa,0x37,0x0,0xc4,0x37,0xfe,0xf4,0x4,0x5,0x2f,0xc0,0x2c,0x2f,0xef,0x3b,
+0x4,0xfe,0xb8,0xa,0x9,0x0,0xfd,0xfd,0xfd,0xfd,0xc9,0x1f,0xfe,0xf7,0x3,0x3,
+0x2f,0xf0,0x2c,0x2f,0xfe,0xf6,0x4,0x3,0x21,0xff,0x0,0x0,0x0,0x0,0xc4,0xff,
+0xe8,0x9,0xa,0xff,0x3e,0x2f,0x2c,0x2f,0xf0,0x3e,0xfe,0xe8,0xa,0x9,0x0,0xfd,
+0xfd,0xfd,0xfd,0xca,0x1,0xa,0x2f,0xf2,0xfe,0xf8,0x3,0x2,0x10,0x0,0xc3,0xff,
+0xb3,0x9,0x9,0xff,0x6,0x3b,0x2f,0xf2,0xa,0x37,0x0,0xfd,0xfd,0xfd,0xfd,0xca,
+0xc,0x16,0x2f,0xf0,0x7f,0x2f,0xa0,0x49,0xa4,0x6,0xfe,0xc0,0xe,0xc,0xff,0x0,
+0x0,0x0,0x0,0xc2,0xff,0xc7,0x11,0x10,0xff,0xfe,0xf7,0x3,0x3,0x39,0x2f,0xf2,
+0x6,0x9,0x0,0xfd,0xfd,0xfd,0xfd,0xca,0xff,0xc7,0x17,0x17,0xff,0x12,0x2f,0xf2,
+0x31,0x39,0xfe,0xcf,0x13,0x12,0x0,0xc2,0xc,0x39,0x31,0x2f,0xc3,0x31,0xc0,0x2f,
+0xeb,0x10,0x22,0x0,0xfd,0xfd,0xfd,0xfd,0xca,0xff,0xbc,0x1c,0x1c,0xff,0x1c,0x2f,
+0xc9,0x31,0xc0,0x2f,0xe6,0x31,0x9,0x0,0xc2,0x7,0x2f,0xc5,0x31,0xc0,0x2f,0xeb,
+0x1c,0xfe,0xbf,0x19,0x19,0x0,0xfd,0xfd,0xfd,0xfd,0xcb,0x21,0x2f,0xc9,0x31,0xc0,
+0x2f,0xe7,0xfe,0xd7,0x11,0x10,0x0,0xc2,0xff,0xd9,0x11,0x11,0xff,0x2c,0x2f,0xf0,
+0x31,0xc0,0x2c,0x1f,0xfe,0xaf,0x19,0x1a,0x0,0xfd,0xfd,0xfd,0xfd,0xcb,0x2b,0x3d,
+0x2f,0xf3,0x3,0x0,0xc2,0xff,0xdb,0xf,0xe,0xff,0x2f,0xc0,0x7f,0x2f,0xee,0x31,
+0xc0,0x2f,0x2b,0x0,0xfd,0xfd,0xfd,0xfd,0xcc,0x37,0x2f,0xc1,0x2c,0x2f,0xf0,0xfe,
+0xdc,0xe,0xe,0x0,0xc2,0x37,0x2f,0xc7,0x5e,0xc0,0x2f,0xe9,0xfe,0xe0,0xe,0xf,
+0x0,0xfd,0xfd,0xfd,0xfd,0xcc,0x33,0x2f,0xc1,0x2c,0x2f,0xc3,0x31,0xc0,0x2f,0xe9,
+0x27,0x0,0xc2,0x27,0x2f,0xc7,0x31,0xc0,0x2f,0xe8,0x3e,0x33,0x0,0xfd,0xfd,0xfd,
+0xfd,0xcc,0x3f,0x2f,0xc1,0x2c,0x2f,0xc3,0x31,0xc0,0x2f,0xe9,0x2d,0x0,0xc2,0x2d,
+0x2c,0x2f,0x2c,0x3d,0xc0,0x2f,0xef,0xfe,0xd8,0x10,0x10,0x0,0xfd,0xfd,0xfd,0xfd,
+0xcc,0xd,0x31,0x2f,0xc0,0xa0,0x8a,0xc0,0x2f,0xef,0xfe,0xe2,0xc,0xa,0x0,0xc2,
+0x1d,0x2f,0xc1,0x3d,0x59,0x2f,0xee,0x31,0x9,0x0,0xfd,0xfd,0xfd,0xfd,0xcc,0xff,
+0xc9,0x11,0x11,0xff,0xfe,0xf8,0x2,0x3,0x9e,0xf9,0x2f,0x3d,0xc0,0x2f,0xef,0x21,
+0x0,0xc2,0x11,0x2f,0xc5,0x3d,0x2f,0xea,0x31,0xa2,0x18,0xfe,0xcc,0x14,0x14,0x0,
+0xfd,0xfd,0xfd,0xfd,0xcc,0xff,0xb6,0xa,0xa,0xff,0x14,0x3b,0x2f,0xf2,0x1f,0xfe,
+0xae,0x18,0x17,0x0,0xc0,0xff,0xab,0x17,0x15,0xff,0xfe,0xe5,0xb,0x9,0x2f,0xf2,
+0xa1,0x49,0xfe,0xf4,0x4,0x3,0xfe,0xb9,0x9,0x9,0x0,0xfd,0xfd,0xfd,0xfd,0xcd,
+0xff,0xe9,0x9,0x9,0xff,0xfe,0xf7,0x3,0x3,0x2c,0x2f,0xf1,0xfe,0xe8,0xa,0x9,
+0xfe,0xbb,0x1d,0x1c,0x0,0xc0,0xff,0xb9,0x1e,0x1c,0xff,0xfe,0xe7,0x8,0x9,0x2f,
+0xf2,0xa2,0x28,0x6,0xfe,0xb0,0x7,0x4,0x0,0xfd,0xfd,0xfd,0xfd,0xcd,0x2b,0xfe,
+0xf6,0x4,0x3,0x2f,0xf2,0x1c,0xfe,0xc0,0x1a,0x1a,0xff,0x0,0x0,0x0,0x0,0xc0,
+0xff,0xbe,0x1c,0x1a,0xff,0x23,0x3d,0x2f,0xf1,0xfe,0xf7,0x3,0x2,0x12,0x0,0xfd,
+0xfd,0xfd,0xfd,0xce,0xff,0xde,0xe,0xe,0xff,0xa,0xfe,0xff,0x1,0x1,0x2f,0xf1,
+0xfe,0xec,0x8,0x9,0xfe,0xc7,0x19,0x1a,0x0,0xc0,0xff,0xc2,0x1a,0x19,0xff,0xfe,
+0xea,0x8,0x9,0x2f,0xc1,0xa0,0x8a,0xc0,0x5c,0xc0,0x2f,0xeb,0xfe,0xf6,0x4,0x3,
+0x1e,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xff,0xdb,0xf,0xe,0xff,
+0xa,0x2f,0xf2,0x10,0xfe,0xcc,0x16,0x15,0x0,0xc0,0xff,0xc6,0x18,0x17,0xff,0x12,
+0x2f,0xc1,0x3d,0xc0,0x31,0xc0,0x2f,0xeb,0xfe,0xf6,0x4,0x3,0xfe,0xe3,0xc,0xa,
+0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0x3f,0xfe,0xf1,0x5,0x5,0x2f,
+0xf2,0x16,0xfe,0xcf,0x13,0x12,0x0,0xc0,0xff,0xca,0x16,0x15,0xff,0x10,0x2f,0xf2,
+0xfe,0xf4,0x4,0x3,0xfe,0xe1,0xd,0xc,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xff,0xd5,
+0x13,0x13,0xff,0xfe,0xef,0x5,0x4,0x2f,0xf2,0x6,0xb,0x0,0xc0,0x1a,0x10,0x2f,
+0xc1,0x5a,0x2f,0xee,0xa,0xfe,0xdc,0xe,0xe,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xff,
+0xd0,0x14,0x13,0xff,0x16,0x2f,0xf2,0x6,0xfe,0xd4,0x12,0x12,0x0,0xc0,0x1a,0xfe,
+0xed,0x7,0x9,0xfe,0xff,0x1,0x3,0x2f,0xf1,0x4,0x3,0x0,0xfd,0xfd,0xfd,0xfd,
+0xce,0xff,0xcd,0x15,0x15,0xff,0x10,0x2f,0x3e,0x2f,0xf0,0x6,0x9,0x0,0xc0,0x18,
+0x10,0x3d,0x2f,0xf1,0x4,0xfe,0xd7,0x11,0x10,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xff,
+0xcb,0x17,0x18,0xff,0xfe,0xec,0x6,0x6,0x2c,0x2f,0xf1,0x6,0xfe,0xd5,0x12,0x10,
+0x0,0xc0,0xff,0xd1,0x13,0x13,0xff,0x16,0x2f,0xf2,0x6,0x9,0x0,0xfd,0xfd,0xfd,
+0xfd,0xce,0xff,0xc6,0x18,0x19,0xff,0xfe,0xec,0x8,0x9,0x2f,0xc2,0x2c,0x2f,0xed,
+0x4,0xfe,0xd9,0xf,0xf,0x0,0xc0,0xff,0xd4,0x14,0x13,0xff,0x6,0x2f,0xf2,0x16,
+0xe,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xff,0xc3,0x19,0x19,0xff,0xfe,0xea,0x8,0x9,
+0x2f,0xf2,0xa,0xfe,0xdc,0x10,0xf,0x0,0xc0,0xff,0xd4,0x12,0x10,0xff,0x6,0xfe,
+0xff,0x1,0x1,0x2f,0xc0,0x5e,0xc0,0x2f,0xed,0x10,0x18,0x0,0xfd,0xfd,0xfd,0xfd,
+0xce,0xff,0xbf,0x1b,0x1a,0xff,0x1c,0xfe,0xfe,0x0,0x0,0xf2,0xa,0xfe,0xdc,0xe,
+0xe,0x0,0xc0,0x3b,0x6,0x2f,0xc1,0x5e,0xc0,0x2f,0xed,0x12,0x22,0x0,0xfd,0xfd,
+0xfd,0xfd,0xce,0xff,0xbe,0x1c,0x1a,0xff,0x1c,0x2f,0xf2,0xfe,0xf3,0x5,0x3,0xfe,
+0xdc,0xe,0xe,0x0,0xc0,0x7,0x6,0x2f,0xef,0x3d,0xc0,0x2f,0x1a,0x2e,0x0,0xfd,
+0xfd,0xfd,0xfd,0xce,0xff,0xbc,0x1c,0x1c,0xff,0xfe,0xe8,0xa,0x9,0x2f,0xf2,0x3c,
+0x31,0x0,0xc0,0x7,0x37,0x2f,0xef,0x3d,0xc0,0x2f,0x1a,0x2e,0x0,0xfd,0xfd,0xfd,
+0xfd,0xce,0xff,0xbb,0x1d,0x1c,0xff,0x1e,0x2f,0xf2,0x3c,0x31,0x0,0xc0,0x9,0x6,
+0x3e,0x69,0x2f,0xeb,0x5e,0xc0,0x2f,0xc1,0x12,0x22,0x0,0xfd,0xfd,0xfd,0xfd,0xce,
+0x39,0x1e,0x2f,0xf2,0x3c,0xfe,0xdc,0xe,0xe,0x0,0xc0,0x9,0x6,0x2f,0xed,0x5e,
+0xc0,0x2f,0xc1,0x10,0x18,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xff,0xbf,0x1b,0x1c,0xff,
+0xfe,0xe8,0x8,0x8,0x2f,0xf2,0x3c,0xfe,0xdc,0xe,0xe,0x0,0xc0,0x9,0x6,0x2f,
+0xed,0xa0,0x8a,0xc0,0x2f,0xc1,0x16,0xe,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xff,0xc2,
+0x1a,0x1a,0xff,0x1a,0x2f,0xf2,0x3c,0x31,0x0,0xc0,0xff,0xd1,0x14,0x12,0xff,0x6,
+0x2f,0xed,0x3d,0xc0,0x2f,0xc1,0x6,0xb,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xff,0xc5,
+0x19,0x19,0xff,0x20,0x2f,0xf2,0x4,0xfe,0xdb,0xf,0xe,0x0,0xc0,0xff,0xcd,0x15,
+0x13,0xff,0x16,0x2f,0xf2,0x6,0x7,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0x24,0x10,0x2c,
+0x2f,0xf1,0x6,0x3f,0x0,0xc0,0xff,0xcc,0x16,0x15,0xff,0x10,0x2f,0xf2,0x4,0xfe,
+0xd8,0x10,0x10,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0x18,0x10,0x2f,0xf2,0x6,0xfe,0xd3,
+0x11,0x11,0x0,0xc0,0x1a,0x10,0x2c,0x2f,0xc8,0x5e,0xc0,0x2f,0xe5,0xfe,0xf3,0x5,
+0x5,0xfe,0xdc,0xe,0xe,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xe,0x16,0x2f,0xc1,0x3e,
+0x2f,0xee,0x6,0x9,0x0,0xc0,0x14,0x10,0x2f,0x3e,0x2f,0xc7,0x5e,0xc0,0x2f,0xe5,
+0xfe,0xf4,0x4,0x3,0x27,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0x9,0x6,0x2f,0xf2,0xfe,
+0xef,0x7,0x5,0xb,0x0,0xc0,0xff,0xc7,0x17,0x17,0xff,0x12,0x2f,0xf2,0xfe,0xf6,
+0x4,0x3,0xfe,0xe3,0xc,0xa,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0xce,
+0xff,0xd7,0x11,0x12,0xff,0x4,0x2f,0x2c,0x2f,0xef,0x31,0x10,0xe,0x0,0xc0,0x30,
+0xfe,0xea,0x8,0x9,0x2f,0x3e,0x2f,0xf0,0xfe,0xf7,0x3,0x3,0xfe,0xe8,0x9,0xa,
+0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xff,0xdb,0xf,0x10,0xff,0xa,0x2f,0xf1,0x31,0x10,
+0xfe,0xcd,0x17,0x16,0x0,0xc0,0xff,0xbf,0x1b,0x1c,0xff,0x1c,0x2c,0x2f,0xf1,0x3e,
+0x1a,0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xff,0xde,0xd,0x10,0xff,0xa,0x2f,0xc2,0x2c,
+0x2f,0xed,0x12,0xfe,0xc7,0x18,0x15,0xff,0x0,0x0,0x0,0x0,0xc0,0xff,0xb9,0x1d,
+0x1e,0xff,0x20,0x2f,0x7f,0x2c,0x2f,0xef,0xfe,0xf8,0x3,0x2,0x16,0xfe,0xaf,0x7,
+0x7,0x0,0xfd,0xfd,0xfd,0xfd,0xcd,0x2b,0xfe,0xf4,0x4,0x3,0x2f,0xeb,0xa0,0x8a,
+0xc0,0x2f,0xc3,0x1a,0xfe,0xc2,0x1a,0x19,0x0,0xc1,0x21,0x2f,0xc7,0x3d,0xc0,0x2f,
+0xe7,0xa2,0x28,0xa,0xfe,0xb6,0x8,0x9,0x0,0xfd,0xfd,0xfd,0xfd,0xcd,0xff,0xe8,
+0xa,0x9,0xff,0xfe,0xf7,0x3,0x3,0x2f,0xc7,0x3d,0xc0,0x2f,0xe0,0x3d,0xc0,0x2f,
+0xc3,0x1e,0xfe,0xbd,0x1d,0x1d,0x0,0xc1,0xff,0xe3,0xc,0xa,0xff,0x2f,0xc7,0x3d,
+0xc0,0x2f,0xe7,0xa1,0x49,0x3e,0xfe,0xc7,0x11,0x10,0x0,0xfd,0xfd,0xfd,0xfd,0xcc,
+0xff,0xb3,0xb,0xb,0xff,0xfe,0xef,0x7,0x7,0xfe,0xf8,0x3,0x2,0x2f,0xc7,0x3d,
+0xc0,0x2f,0xe0,0x3d,0xc0,0x2f,0xc3,0x1f,0xfe,0xb2,0x1a,0x19,0x0,0xc1,0x1d,0x2f,
+0xc7,0x3d,0xc0,0x2f,0xe7,0x31,0x39,0xfe,0xd4,0x13,0x14,0x0,0xfd,0xfd,0xfd,0xfd,
+0xcc,0xff,0xc3,0xf,0x10,0xff,0x3e,0x9e,0xe9,0x2f,0xf2,0x21,0x0,0xc2,0x2d,0x2f,
+0xc7,0x3d,0xc0,0x2f,0xe9,0x3f,0x0,0xfd,0xfd,0xfd,0xfd,0xcc,0xff,0xd2,0x14,0x14,
+0xff,0x39,0x31,0x2f,0xf2,0x1d,0x0,0xc2,0xff,0xdf,0xd,0xe,0xff,0x2f,0xc1,0x5a,
+0x2f,0xf0,0x33,0x0,0xfd,0xfd,0xfd,0xfd,0xcc,0x7,0x31,0x2f,0xf3,0x2d,0x0,0xc2,
+0xff,0xdd,0xf,0xf,0xff,0x2c,0x2f,0xf3,0xfe,0xde,0xe,0xc,0xff,0x0,0x0,0x0,
+0x0,0xfd,0xfd,0xfd,0xfd,0xcc,0xff,0xda,0x10,0x10,0xff,0x2f,0xc1,0x7f,0x2f,0xf0,
+0x27,0x0,0xc2,0x1,0x2f,0xeb,0x3d,0xc0,0x2f,0xc5,0x2b,0x0,0xfd,0xfd,0xfd,0xfd,
+0xcc,0xff,0xde,0xe,0xe,0xff,0x2f,0xf4,0xfe,0xdc,0xe,0xe,0x0,0xc2,0xff,0xd8,
+0x10,0x10,0xff,0x2f,0xeb,0xa0,0x8a,0xc0,0x2f,0xc5,0x21,0x0,0xfd,0xfd,0xfd,0xfd,
+0xcc,0x2d,0x2f,0xf4,0x1,0x0,0xc2,0x7,0x2f,0xf4,0x1e,0xfe,0xbe,0x1b,0x1c,0x0,
+0xfd,0xfd,0xfd,0xfd,0xcb,0x20,0x2f,0xf4,0xfe,0xd9,0x11,0x11,0x0,0xc2,0x1b,0xfe,
+0xfb,0x2,0x0,0x9f,0xb9,0x2f,0xf2,0xfe,0xec,0x8,0x9,0xfe,0xc7,0x17,0x19,0x0,
+0xfd,0xfd,0xfd,0xfd,0xca,0xff,0xb7,0x1c,0x1a,0xff,0x1e,0x2f,0xef,0x3e,0xc1,0x2f,
+0x4a,0x9,0x0,0xc2,0xff,0xc3,0xf,0xe,0xff,0xfe,0xf6,0x4,0x2,0x30,0x2f,0xc7,
+0x3d,0xc0,0x2f,0xe0,0x31,0xc0,0x2f,0xc2,0x3e,0x16,0xfe,0xd1,0x13,0x13,0x0,0xfd,
+0xfd,0xfd,0xfd,0xca,0xff,0xc5,0x19,0x19,0xff,0x1a,0x2f,0xf2,0x31,0xa0,0x6a,0xe,
+0x0,0xc2,0xff,0xb3,0xa,0x7,0xff,0xfe,0xef,0x7,0x5,0x3b,0x2f,0xc7,0x3d,0xc0,
+0x2f,0xe0,0x5e,0xc0,0x2f,0xc2,0x3e,0xa,0x33,0x0,0xfd,0xfd,0xfd,0xfd,0xca,0xff,
+0xce,0x14,0x15,0xff,0xfe,0xef,0x7,0x7,0x2f,0xf2,0x39,0xa2,0x27,0x2b,0x0,0xc3,
+0xff,0xe6,0xb,0x9,0xff,0x3e,0x2f,0xed,0x31,0xc0,0x2f,0xc1,0xfe,0xf6,0x4,0x3,
+0x21,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0xca,0xff,0xd7,0xf,0xf,0xff,
+0x4,0x2f,0xed,0x3d,0xc0,0x2f,0xc0,0x5a,0xa3,0x7,0x16,0xfe,0xb2,0x8,0x8,0x0,
+0xc3,0x27,0xfe,0xf4,0x4,0x3,0x2f,0xed,0x31,0xc0,0x2f,0xc1,0xfe,0xf8,0x3,0x2,
+0x8,0xfe,0xb3,0x9,0x9,0x0,0xfd,0xfd,0xfd,0xfd,0xc9,0xff,0xe3,0xc,0xa,0xff,
+0xfe,0xf6,0x4,0x3,0x2f,0xed,0x3d,0xc0,0x2f,0xc1,0x0,0x1e,0xff,0x0,0x0,0x0,
+0x0,0xc4,0x3f,0x4,0x2f,0xc0,0x2c,0x2f,0xe8,0x3d,0xc0,0x2f,0xc3,0x31,0xa2,0x18,
+0xfe,0xcc,0x13,0x11,0x0,0xfd,0xfd,0xfd,0xfd,0xc8,0xff,0xb7,0xb,0x9,0xff,0x4,
+0x3b,0x9e,0xe8,0xf2,0xfe,0xf3,0x5,0x3,0x27,0x0,0xc4,0xff,0xcd,0x13,0x14,0xff,
+0x16,0x2f,0xc0,0x7f,0x2f,0xe8,0x3d,0xc0,0x2f,0xc3,0x2c,0x2f,0x3f,0x0,0xfd,0xfd,
+0xfd,0xfd,0xc8,0xe,0xfe,0xf9,0x1,0x1,0x31,0x2f,0xef,0x3e,0x2f,0xc0,0x6,0xfe,
+0xd5,0x11,0x12,0x0,0xc4,0x30,0x1a,0x2f,0xed,0x3d,0xc0,0x2f,0xc3,0xfe,0xdc,0xf,
+0xc,0x0,0xfd,0xfd,0xfd,0xfd,0xc8,0xff,0xd8,0x10,0x10,0xff,0x31,0x2f,0xf1,0x3e,
+0x2f,0xfe,0xed,0x7,0x7,0xfe,0xcc,0x16,0x15,0x0,0xc4,0xff,0xb4,0x19,0x17,0xff,
+0xfe,0xe8,0x9,0xa,0xfe,0xfe,0x0,0x0,0xf4,0xfe,0xe2,0xc,0xa,0x0,0xfd,0xfd,
+0xfd,0xfd,0xc8,0x37,0x3e,0x2f,0xf1,0x3e,0x2f,0xfe,0xea,0x8,0x9,0xfe,0xc2,0x1a,
+0x1a,0x0,0xc5,0xff,0xe3,0xb,0xc,0xff,0x2f,0xc3,0x31,0xc0,0x2f,0xed,0xfe,0xe9,
+0x9,0x9,0xfe,0xbe,0x1c,0x19,0x0,0xfd,0xfd,0xfd,0xfd,0xc7,0x21,0x2f,0xf1,0x3e,
+0x2f,0xc0,0x1f,0xfe,0xae,0x18,0x19,0x0,0xc5,0x27,0x2f,0x3e,0x2f,0xc1,0x31,0xc0,
+0x2f,0xec,0x5a,0x8,0xfe,0xd0,0x14,0x12,0x0,0xfd,0xfd,0xfd,0xfd,0xc6,0xff,0xc3,
+0x19,0x19,0xff,0x1a,0x2f,0xf4,0xfe,0xe3,0xd,0xd,0x0,0xc6,0xff,0xdb,0xf,0xe,
+0xff,0x2f,0xc1,0x31,0xc0,0x2f,0xee,0x7e,0xfe,0xf4,0x4,0x3,0x2d,0x0,0xfd,0xfd,
+0xfd,0xfd,0xc6,0x9,0x6,0x2f,0xf2,0x3e,0x2f,0xfe,0xde,0xe,0xe,0x0,0xc6,0x3f,
+0x31,0x2c,0x2f,0x31,0xc0,0x2f,0xee,0x7e,0xfe,0xf8,0x3,0x2,0x16,0xfe,0xb5,0xb,
+0xb,0x0,0xfd,0xfd,0xfd,0xfd,0xc5,0xff,0xe3,0xc,0xa,0xff,0xfe,0xf6,0x4,0x3,
+0x3e,0x2f,0xf1,0x2c,0x2f,0x3,0xff,0x0,0x0,0x0,0x0,0xc6,0xc,0x39,0x31,0x2f,
+0x31,0xc0,0x2f,0xea,0xa0,0x8a,0xc0,0x2f,0xc1,0x31,0x3a,0xfe,0xd1,0x15,0x14,0x0,
+0xfd,0xfd,0xfd,0xfd,0xc4,0xff,0xbe,0xe,0xe,0xff,0xa,0x3b,0x2f,0xf4,0xfe,0xd5,
+0x11,0x12,0x0,0xc6,0xff,0xc3,0xf,0x10,0xff,0xfe,0xf6,0x4,0x3,0xfe,0xfb,0x1,
+0x2,0x2f,0x31,0xc0,0x2f,0xea,0x3d,0xc0,0x2f,0xc3,0xfe,0xd8,0x10,0x10,0xff,0x0,
+0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0xc4,0xb,0x39,0x31,0x2f,0xf2,0x31,0x3b,0xe,
+0x0,0xc7,0x1a,0xfe,0xf8,0x2,0x3,0x2f,0xf4,0xfe,0xde,0xe,0xe,0x0,0xfd,0xfd,
+0xfd,0xfd,0xc4,0x3,0xfe,0xfe,0x2,0x1,0x2f,0xf0,0xa0,0x8a,0xc0,0x2f,0xa3,0x28,
+0xfe,0xf3,0x5,0x5,0xfe,0xba,0xc,0xb,0xff,0x0,0x0,0x0,0x0,0xc7,0x37,0xa,
+0x2f,0xf4,0x21,0x0,0xfd,0xfd,0xfd,0xfd,0xc4,0x2d,0x2f,0xf1,0x3d,0xc0,0x2f,0xfe,
+0xf6,0x4,0x3,0x1f,0xff,0x0,0x0,0x0,0x0,0xc8,0xff,0xce,0x15,0x13,0xff,0x16,
+0x3e,0x2f,0xea,0x31,0xc0,0x2f,0xc5,0x1a,0xfe,0xc5,0x18,0x1a,0x0,0xfd,0xfd,0xfd,
+0xfd,0xc2,0xff,0xb1,0x17,0x17,0xff,0x1f,0x3e,0x2f,0xf3,0x4,0xfe,0xd8,0x12,0x11,
+0x0,0xc8,0xff,0xbf,0x1b,0x1a,0xff,0xfe,0xe9,0x9,0x9,0xfe,0xfe,0x0,0x0,0xeb,
+0x31,0xc0,0x2f,0xc1,0x3e,0x2f,0xc1,0x4,0xfe,0xd9,0xe,0x11,0x0,0xfd,0xfd,0xfd,
+0xfd,0xc2,0xff,0xce,0x14,0x15,0xff,0xfe,0xf0,0x8,0x8,0x2f,0xf4,0xfe,0xec,0x8,
+0x7,0xfe,0xc7,0x17,0x17,0x0,0xc9,0x20,0x2f,0xf4,0x3a,0xfe,0xef,0x7,0x7,0xfe,
+0xb7,0xd,0xe,0x0,0xfd,0xfd,0xfd,0xfd,0xc1,0xff,0xe5,0x9,0x9,0xff,0xfe,0xf6,
+0x4,0x3,0x2f,0xf3,0x5a,0x1f,0xfe,0xb4,0x1a,0x1a,0xff,0x0,0x0,0x0,0x0,0xc9,
+0x27,0x2f,0xef,0x3e,0x2f,0xc2,0x31,0x3b,0xfe,0xd4,0x12,0x12,0x0,0xfd,0xfd,0xfd,
+0xfd,0xc0,0xff,0xca,0x14,0x13,0xff,0xfe,0xf4,0x4,0x3,0xfe,0xfc,0x2,0x3,0x2f,
+0xf2,0x2c,0x2f,0xfe,0xe2,0xc,0xc,0x0,0xca,0x34,0x2f,0xc1,0xa0,0x8a,0xc0,0x2f,
+0xea,0x3d,0xc0,0x2f,0xc2,0x31,0x37,0x0,0xfd,0xfd,0xfd,0xfd,0xc0,0xff,0xd8,0x10,
+0x10,0xff,0x39,0x31,0x2f,0xc0,0x2c,0x2f,0xee,0x5b,0xc0,0x2f,0xfe,0xdc,0xe,0xe,
+0x0,0xca,0xff,0xd3,0x12,0x13,0xff,0x39,0xa0,0xa6,0x2f,0xa0,0x8a,0xc0,0x2f,0xea,
+0x3d,0xc0,0x2f,0xc3,0x1f,0xfe,0xb1,0x19,0x18,0x0,0xfd,0xfd,0xfd,0xfd,0x2b,0x2f,
+0xf3,0x3d,0xc0,0x5a,0xfe,0xd7,0x11,0x12,0x0,0xca,0xff,0xc2,0x10,0x10,0xff,0xfe,
+0xf4,0x4,0x3,0x39,0x2f,0xf4,0x16,0xfe,0xce,0x15,0x13,0x0,0xfd,0xfd,0xfd,0xfc,
+0x2a,0x1a,0x2f,0xf4,0xa0,0x7a,0xa2,0x36,0xfe,0xd0,0x14,0x13,0x0,0xcb,0xff,0xe8,
+0xa,0x9,0xff,0xfe,0xf7,0x3,0x3,0x2f,0xf4,0xfe,0xf6,0x4,0x3,0x20,0xff,0x0,
+0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfc,0x3,0x4,0x2f,0xc0,0x7f,0x2f,0xf1,0xfe,0xf8,
+0x3,0x2,0xfe,0xf0,0x6,0x7,0x18,0x0,0xcb,0xff,0xd7,0x11,0x12,0xff,0x4,0x2f,
+0xeb,0x31,0xc0,0x2f,0xc5,0x39,0xfe,0xf4,0x4,0x3,0x3c,0x0,0xfd,0xfd,0xfd,0xfa,
+0xff,0xb7,0xd,0xd,0xff,0x16,0xfe,0xf8,0x3,0x2,0x2f,0xf4,0xa,0x35,0x0,0xcc,
+0x30,0x1a,0x2f,0xeb,0x31,0xc0,0x2f,0xc6,0x31,0x3,0x0,0xfd,0xfd,0xfd,0xfa,0x9,
+0xfe,0xfb,0x3,0x3,0x31,0x2f,0xf4,0xfe,0xed,0x7,0x7,0xfe,0xcd,0x15,0x15,0x0,
+0xcd,0x21,0x2f,0x31,0xc0,0x2f,0xf3,0x2b,0x0,0xfd,0xfd,0xfd,0xfa,0x37,0x31,0x2f,
+0xc2,0x31,0xc0,0x2f,0xef,0x1e,0xfe,0xba,0x1c,0x1d,0x0,0xcd,0x37,0x2f,0x31,0xc0,
+0x2f,0xf3,0x1a,0x30,0x0,0xfd,0xfd,0xfd,0xf8,0xff,0xb2,0x17,0x15,0xff,0xfe,0xe8,
+0x9,0xa,0x2f,0xc3,0x31,0xc0,0x2f,0xef,0xfe,0xe0,0xc,0xb,0x0,0xce,0x3f,0x31,
+0x2f,0xf5,0xfe,0xf3,0x5,0x5,0x37,0x0,0xfd,0xfd,0xfd,0xf8,0x9,0x14,0x2f,0xe5,
+0x3d,0xc0,0x2f,0xcd,0xfe,0xdb,0xf,0xe,0x0,0xce,0xff,0xcb,0x13,0x11,0xff,0xfe,
+0xf6,0x4,0x2,0x9e,0xf8,0x2f,0xf4,0xfe,0xf8,0x3,0x2,0xfe,0xef,0x7,0x5,0xfe,
+0xc0,0x12,0x11,0x0,0xfd,0xfd,0xfd,0xf6,0xff,0xb2,0xe,0xf,0xff,0x20,0xfe,0xf7,
+0x3,0x3,0x2f,0xe5,0x3d,0xc0,0x2f,0xcb,0x31,0xa2,0x18,0xc,0x0,0xcf,0x1c,0x3e,
+0xfe,0xfd,0x0,0x0,0x2f,0xf3,0x31,0x3a,0xfe,0xd8,0x10,0x10,0x0,0xfd,0xfd,0xfd,
+0xf6,0xff,0xd4,0x12,0x13,0xff,0x3e,0x9e,0xe9,0x2f,0xf4,0x3a,0x8,0xfe,0xb9,0xd,
+0xd,0x0,0xcf,0x3d,0x4,0x2f,0xf6,0x1f,0xfe,0xb0,0x18,0x17,0x0,0xfd,0xfd,0xfd,
+0xf5,0x29,0x2f,0xf6,0xfe,0xf4,0x4,0x3,0xfe,0xe1,0xd,0xc,0x0,0xd0,0x2a,0x1a,
+0x2f,0x7f,0x2f,0x3e,0x2f,0xf2,0xfe,0xf0,0x4,0x4,0x3d,0x0,0xfd,0xfd,0xfd,0xf4,
+0x24,0xfe,0xed,0x7,0x7,0x2f,0xf6,0x10,0x18,0x0,0xd1,0xff,0xe3,0xc,0xa,0xff,
+0x2f,0xf5,0x3e,0xfe,0xf8,0x3,0x2,0x10,0xfe,0xbe,0x12,0x12,0x0,0xfd,0xfd,0xfd,
+0xf3,0x2b,0xfe,0xf4,0x4,0x3,0x2f,0xf6,0x1f,0xfe,0xb3,0x19,0x19,0x0,0xd1,0xff,
+0xdc,0xe,0xe,0xff,0x2f,0xf5,0x7e,0x4a,0xa2,0x18,0xfe,0xd6,0x10,0x11,0x0,0xfd,
+0xfd,0xfd,0xf2,0xe,0xfe,0xf4,0x4,0x3,0x39,0x2f,0xf6,0x27,0x0,0xd2,0xc,0xfe,
+0xf8,0x3,0x2,0x31,0x2f,0xf4,0x2c,0x2f,0x21,0x0,0xfd,0xfd,0xfd,0xf2,0x2d,0xfe,
+0xff,0x1,0x1,0x2f,0xf5,0x31,0x3b,0xfe,0xd5,0x11,0x12,0x0,0xd2,0x36,0x10,0xfe,
+0xf7,0x2,0x1,0x2f,0xf6,0x16,0xc,0x0,0xfd,0xfd,0xfd,0xf0,0xff,0xc7,0x17,0x17,
+0xff,0x12,0x2f,0xf6,0x3b,0xa,0xfe,0xc4,0x12,0x12,0x0,0xd3,0xff,0xdc,0xe,0xe,
+0xff,0xa,0x2f,0xf6,0xfe,0xf7,0x3,0x3,0xfe,0xe8,0x9,0xa,0xfe,0xb1,0xd,0xe,
+0x0,0xfd,0xfd,0xfd,0xef,0xff,0xe2,0xc,0xc,0xff,0xfe,0xf4,0x4,0x3,0x2f,0xc0,
+0x2c,0x2f,0xee,0x2c,0x2f,0xc2,0xfe,0xf6,0x4,0x3,0x21,0xff,0x0,0x0,0x0,0x0,
+0xd4,0xff,0xc7,0x17,0x19,0xff,0xfe,0xec,0x8,0x9,0x2f,0xf4,0x37,0x6b,0x39,0xa2,
+0x27,0x9,0x0,0xfd,0xfd,0xfd,0xee,0xff,0xce,0x14,0x15,0xff,0x3a,0x39,0x2f,0xf2,
+0x7f,0x2f,0xc1,0xfe,0xef,0x7,0x7,0xfe,0xce,0x14,0x15,0x0,0xd5,0x21,0x2f,0xf8,
+0xfe,0xe2,0xb,0x9,0x0,0xfd,0xfd,0xfd,0xee,0xff,0xdf,0xd,0xe,0xff,0xfe,0xfd,
+0x0,0x0,0x2f,0xf3,0x2c,0x2f,0xc1,0x1f,0xfe,0xb4,0x18,0x19,0x0,0xd5,0x31,0x2f,
+0xf1,0x3e,0x2f,0xc0,0x3e,0x2f,0xc1,0xfe,0xf0,0x6,0x5,0xfe,0xd4,0x14,0x13,0x0,
+0xfd,0xfd,0xfd,0xec,0xff,0xc6,0x16,0x16,0xff,0x20,0x2f,0x2c,0x2f,0xc1,0xa0,0x8a,
+0xc0,0x2f,0xc2,0x3d,0xc0,0x2f,0xe8,0x5e,0xc0,0x2f,0x27,0x0,0xd6,0xe,0xfe,0xf7,
+0x3,0x3,0x39,0x2f,0xf2,0x7f,0x2f,0xc1,0xfe,0xf7,0x3,0x2,0xfe,0xeb,0x9,0xa,
+0xfe,0xbc,0x12,0x12,0x0,0xfd,0xfd,0xfd,0xeb,0x2b,0x3a,0x2f,0xc2,0x2c,0x3d,0xc0,
+0x2f,0xc2,0x3d,0xc0,0x2f,0xe8,0x31,0x30,0xa1,0x49,0x9,0x0,0xd6,0xff,0xae,0xc,
+0xa,0xff,0xfe,0xe8,0x8,0x8,0xfe,0xf6,0x2,0x2,0xfe,0xfe,0x0,0x0,0xf6,0x30,
+0xa1,0x3a,0xfe,0xd8,0x10,0x10,0x0,0xfd,0xfd,0xfd,0xea,0x9,0xfe,0xf4,0x4,0x3,
+0x39,0x2f,0x31,0xc0,0x2f,0xf3,0xfe,0xf8,0x3,0x2,0x6,0xfe,0xbf,0x11,0x10,0x0,
+0xd7,0x9,0x6,0xfe,0xff,0x1,0x1,0x2f,0xf7,0x1c,0xfe,0xbe,0x18,0x18,0x0,0xfd,
+0xfd,0xfd,0xe8,0xff,0xb1,0x17,0x17,0xff,0x1f,0x2f,0xc1,0x31,0xc0,0x2f,0xf3,0xa,
+0xfe,0xde,0xe,0xe,0x0,0xd8,0xff,0xb9,0x1b,0x1a,0xff,0xfe,0xe9,0xb,0xa,0x2f,
+0xf7,0xa0,0x8a,0xfe,0xf6,0x4,0x3,0xfe,0xe3,0xc,0xa,0xff,0x0,0x0,0x0,0x0,
+0xfd,0xfd,0xfd,0xe8,0xff,0xdc,0xe,0xe,0xff,0xa,0x2f,0xed,0x5e,0xc2,0x2f,0xc4,
+0x3e,0xfe,0xea,0x8,0x9,0x2a,0x0,0xd9,0xff,0xde,0xe,0xc,0xff,0x31,0x2f,0xf6,
+0x3d,0x39,0x3a,0xfe,0xd5,0x12,0x10,0x0,0xfd,0xfd,0xfd,0xe6,0xff,0xcf,0x16,0x14,
+0xff,0xfe,0xf3,0x5,0x3,0x3b,0x2f,0xed,0x31,0xc2,0x2f,0xc4,0x31,0xfe,0xe1,0xd,
+0xc,0x0,0xda,0xb,0x3b,0x31,0x2f,0xc5,0x3d,0xc0,0x2f,0xec,0x7f,0x31,0xc0,0x21,
+0xfe,0xb3,0x18,0x16,0x0,0xfd,0xfd,0xfd,0xe5,0x2d,0x3b,0x31,0x2f,0xf4,0x3d,0x2f,
+0x4a,0x39,0x3f,0x0,0xda,0xff,0xb5,0xd,0xd,0xff,0x12,0x3a,0x2f,0xf5,0x3e,0x2f,
+0xc0,0x4,0xfe,0xd8,0x10,0x10,0x0,0xfd,0xfd,0xfd,0xe4,0x1b,0xfe,0xef,0x7,0x7,
+0x2f,0xf8,0x3b,0xfe,0xf1,0x7,0x6,0xfe,0xc0,0x10,0x10,0x0,0xdb,0x7,0x6,0x2f,
+0xc9,0xa0,0x8a,0xc0,0x2f,0xeb,0x3b,0x6,0xfe,0xca,0x14,0x13,0x0,0xfd,0xfd,0xfd,
+0xe2,0xff,0xc2,0x12,0x12,0xff,0x10,0x3a,0x2f,0xf8,0xfe,0xf3,0x5,0x3,0xfe,0xdc,
+0xe,0xe,0x0,0xdc,0xff,0xba,0x1a,0x1a,0xff,0xfe,0xe9,0x9,0x9,0x2f,0xc9,0x3d,
+0xc0,0x2f,0xec,0x5e,0x2b,0x0,0xfd,0xfd,0xfd,0xe2,0x37,0xfe,0xfc,0x0,0x1,0x2c,
+0x2f,0xf8,0xfe,0xea,0x9,0x7,0xfe,0xc5,0x19,0x19,0x0,0xdd,0x27,0x2f,0xf8,0x2c,
+0x2f,0x6,0xb,0x0,0xfd,0xfd,0xfd,0xe0,0xff,0xcc,0x16,0x15,0xff,0xfe,0xed,0x9,
+0x8,0x31,0x2f,0xf2,0x3d,0xc0,0x31,0xc0,0x2f,0xc1,0x2b,0x0,0xde,0xe,0xfe,0xf6,
+0x4,0x3,0x39,0x2f,0xf5,0x2c,0x2f,0xc0,0x3a,0x10,0x13,0xff,0x0,0x0,0x0,0x0,
+0xfd,0xfd,0xfd,0xde,0xff,0xb9,0x11,0x11,0xff,0x1f,0xfe,0xf6,0x4,0x3,0x31,0x2f,
+0xf2,0x3d,0xc0,0x31,0xc0,0x2f,0xa2,0x36,0xa0,0x5b,0x9,0xff,0x0,0x0,0x0,0x0,
+0xdf,0xff,0xe3,0xc,0xa,0xff,0xfe,0xf6,0x4,0x3,0x2f,0xf8,0x31,0x3a,0x27,0xff,
+0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xde,0xff,0xdc,0xe,0xe,0xff,0xfe,0xf6,0x4,
+0x3,0x39,0x2f,0xf4,0x3e,0x2f,0xc1,0xfe,0xf7,0x3,0x2,0xfe,0xec,0x8,0x9,0xfe,
+0xb4,0xc,0xc,0xff,0x0,0x0,0x0,0x0,0xdf,0x1a,0x10,0x2f,0xfa,0x6,0x7,0x0,
+0xfd,0xfd,0xfd,0xdc,0xff,0xce,0x15,0x13,0xff,0x16,0x2f,0xfa,0x6,0x7,0x0,0xe1,
+0xff,0xe3,0xb,0xc,0xff,0xfe,0xfd,0x0,0x0,0x2f,0xf9,0x3b,0x6,0xe,0x0,0xfd,
+0xfd,0xfd,0xda,0xff,0xc8,0x14,0x13,0xff,0x10,0x3a,0x2f,0xf5,0x3e,0xc0,0x2f,0x2c,
+0x2f,0x1f,0xfe,0xb1,0x17,0x17,0x0,0xe1,0x7,0x3a,0x9e,0xf8,0x2f,0xfa,0xfe,0xe8,
+0x9,0xa,0xfe,0xb6,0x18,0x19,0x0,0xfd,0xfd,0xfd,0xd8,0xff,0xab,0x17,0x17,0xff,
+0xfe,0xe5,0xb,0xa,0x31,0x2f,0xf9,0x31,0xa0,0x49,0x3,0x0,0xe2,0xff,0xbe,0x12,
+0x10,0xff,0xfe,0xed,0x8,0x5,0x3a,0x2f,0xef,0x31,0xc0,0x2f,0xc7,0xfe,0xf6,0x4,
+0x3,0x29,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xd8,0x28,0xfe,0xf3,0x5,0x5,
+0x2f,0xf7,0x7f,0x2f,0xc0,0x3b,0xa,0xfe,0xca,0x14,0x13,0x0,0xe3,0xff,0xd8,0x10,
+0x10,0xff,0x4,0x2f,0xef,0x31,0xc0,0x2f,0xc7,0x31,0x3b,0x33,0x0,0xfd,0xfd,0xfd,
+0xd6,0x9,0xfe,0xf4,0x5,0x2,0xfe,0xfb,0x1,0x2,0x2f,0xfa,0xfe,0xf4,0x4,0x3,
+0x2b,0x0,0xe4,0xff,0xb2,0x1a,0x19,0xff,0x1f,0x2f,0xfb,0x31,0x10,0xd,0x0,0xfd,
+0xfd,0xfd,0xd4,0xff,0xc3,0x17,0x15,0xff,0xfe,0xe8,0xa,0x9,0x30,0x31,0x2f,0xfa,
+0xfe,0xec,0x8,0x9,0xfe,0xc6,0x18,0x19,0x0,0xe5,0x3d,0xfe,0xf8,0x3,0x2,0x31,
+0x2f,0xfa,0x3a,0x12,0xfe,0xc3,0x13,0x13,0x0,0xfd,0xfd,0xfd,0xd2,0xff,0xb2,0xf,
+0x10,0xff,0xfe,0xe3,0xc,0xa,0xfe,0xf7,0x5,0x4,0x2f,0xc0,0x5a,0x2f,0xc3,0x3e,
+0x2f,0xf1,0x31,0x39,0x27,0x0,0xe6,0xff,0xbe,0x12,0x12,0xff,0x10,0x3a,0x2f,0xfa,
+0x31,0x3a,0x2d,0x0,0xfd,0xfd,0xfd,0xd2,0xff,0xdb,0xf,0x10,0xff,0xfe,0xf6,0x4,
+0x3,0x39,0x2f,0xf8,0x3e,0x2f,0x30,0x0,0xe,0xff,0x0,0x0,0x0,0x0,0xe7,0x3d,
+0xfe,0xf1,0x5,0x5,0x2f,0xfb,0x3e,0x4,0xfe,0xd7,0x11,0x12,0x0,0xfd,0xfd,0xfd,
+0xd0,0xff,0xce,0x14,0x15,0xff,0xfe,0xef,0x7,0x7,0x2f,0xfa,0x3e,0x2f,0xfe,0xf6,
+0x4,0x2,0x20,0x0,0xe8,0xff,0xb0,0x18,0x17,0xff,0x1f,0x3e,0x2f,0xf6,0x31,0xc0,
+0x2f,0xc1,0x3b,0x4,0xfe,0xd5,0x11,0x12,0x0,0xfd,0xfd,0xfd,0xce,0xff,0xd0,0x14,
+0x15,0xff,0x16,0x3a,0x2f,0xed,0xa0,0x8a,0xc0,0x2f,0xc6,0x3d,0xc0,0x3e,0x2f,0xc0,
+0x11,0x2a,0x0,0xe9,0xff,0xd8,0x10,0x10,0xff,0x3a,0x31,0x2f,0xf5,0x4a,0x31,0x2f,
+0xc3,0x10,0xfe,0xcd,0x15,0x13,0x0,0xfd,0xfd,0xfd,0xcc,0xff,0xc3,0x19,0x1a,0xff,
+0xfe,0xeb,0x9,0xa,0x2c,0x2f,0xee,0xa0,0x8a,0xc0,0x2f,0xc6,0x3d,0xc0,0x2f,0x5e,
+0xa1,0x47,0x28,0x0,0xea,0xff,0xbe,0x12,0x12,0xff,0x10,0x3a,0x2f,0xfa,0x3e,0x2f,
+0x3a,0x10,0xfe,0xce,0x15,0x13,0x0,0xfd,0xfd,0xfd,0xca,0xff,0xc7,0x15,0x15,0xff,
+0xfe,0xea,0x8,0x9,0xfe,0xf7,0x3,0x3,0x2f,0xfb,0x2c,0x3b,0xfe,0xf3,0x5,0x5,
+0xfe,0xca,0x14,0x13,0x0,0xeb,0x3f,0x4,0x2f,0xfd,0xc0,0x29,0xfe,0xc1,0x17,0x18,
+0x0,0xfd,0xfd,0xfd,0xc8,0xff,0xb6,0x18,0x17,0xff,0xfe,0xe8,0xa,0x9,0x31,0x2f,
+0xfd,0xfe,0xf3,0x5,0x3,0xfe,0xde,0xe,0xe,0x0,0xec,0xff,0xb0,0x17,0x19,0xff,
+0x1f,0x2f,0xc1,0x31,0xc0,0x2f,0xf5,0x7f,0x3d,0xc0,0x2f,0xfe,0xf7,0x3,0x3,0xfe,
+0xe9,0x9,0x9,0xfe,0xc5,0x15,0x15,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xc6,
+0xff,0xb9,0x11,0x10,0xff,0xfe,0xe5,0xb,0x9,0xfe,0xf6,0x4,0x3,0x2f,0xfd,0xc0,
+0x1c,0xfe,0xbc,0x1a,0x18,0xff,0x0,0x0,0x0,0x0,0xed,0xff,0xd5,0x11,0x12,0xff,
+0xfe,0xf6,0x4,0x3,0x9e,0xf7,0x2f,0x31,0xc0,0x2f,0xf6,0x5b,0x3d,0x7d,0x2f,0x31,
+0xfe,0xe6,0xb,0x9,0xfe,0xb4,0x18,0x19,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,
+0xc4,0xff,0xaa,0x18,0x18,0xff,0xfe,0xe2,0xc,0xa,0x30,0xa0,0xb9,0x2f,0xc4,0x3e,
+0x2f,0xf5,0x30,0xa0,0x5b,0xfe,0xd8,0x10,0x10,0xff,0x0,0x0,0x0,0x0,0xee,0xff,
+0xb0,0xd,0xe,0xff,0x1f,0xfe,0xf6,0x4,0x3,0x2f,0xc1,0x2c,0x2f,0xfa,0x0,0x21,
+0xfe,0xb7,0x11,0x11,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xc2,0xff,0xad,0xf,
+0xe,0xff,0xfe,0xe1,0xd,0xc,0xfe,0xf3,0x5,0x3,0x31,0x2f,0xc8,0xa0,0x8a,0x2f,
+0xed,0x2c,0x2f,0xc2,0xfe,0xf7,0x3,0x2,0xfe,0xec,0x8,0x9,0xfe,0xbd,0x13,0x13,
+0x0,0xef,0xff,0xca,0x16,0x15,0xff,0xfe,0xed,0x7,0x7,0x2c,0x2f,0xc0,0x3e,0x2f,
+0xf7,0x3e,0xc0,0x2f,0x31,0xa0,0x6a,0x2b,0x0,0xfd,0xfd,0xfd,0xc2,0xff,0xde,0xe,
+0xe,0xff,0x3b,0x31,0x2f,0xc9,0x3d,0xc0,0x2f,0xf1,0xfe,0xf0,0x6,0x5,0xfe,0xd3,
+0x12,0x13,0x0,0xf1,0xff,0xdf,0xd,0xc,0xff,0x31,0x2f,0xf2,0x31,0xc0,0x2f,0xc0,
+0x3d,0xc0,0x2f,0xc0,0x3e,0x2f,0x2c,0x2f,0x31,0xa,0xfe,0xe2,0xe,0xd,0xfe,0xae,
+0xe,0xe,0x0,0xfd,0xfd,0xfd,0xff,0xdc,0xe,0x10,0xff,0x4,0x31,0x2f,0xfa,0x3e,
+0x2f,0xc2,0xfe,0xe2,0xb,0x9,0x0,0xf2,0x36,0x15,0x3b,0x2f,0xf1,0x31,0xc0,0x2f,
+0xc0,0x3d,0xc0,0x2f,0xc2,0x3e,0x2f,0xc0,0x31,0x3b,0xfe,0xdf,0xd,0xc,0x0,0xfd,
+0xfd,0xfc,0x3f,0xfe,0xf7,0x3,0x3,0x39,0x2f,0xfd,0xc0,0x3b,0xfe,0xf4,0x6,0x6,
+0xfe,0xce,0x15,0x13,0x0,0xf3,0xff,0xd7,0x11,0x12,0xff,0x4,0x2c,0x2f,0xfd,0xc0,
+0x31,0xa,0x2d,0xfe,0xb6,0x12,0x11,0x0,0xfd,0xfd,0xf8,0x29,0x37,0xfe,0xf1,0x5,
+0x7,0x39,0x31,0x2f,0xc3,0x31,0xc0,0x2f,0xf7,0xa,0xfe,0xdc,0xe,0xe,0x0,0xf4,
+0xff,0xb2,0x18,0x18,0xff,0x21,0x39,0xa0,0xa6,0x2f,0xfd,0xc0,0x31,0x30,0xfe,0xe3,
+0xc,0xa,0xfe,0xb3,0x19,0x19,0x0,0xfd,0xfd,0xf6,0xff,0xaa,0x18,0x19,0xff,0x2d,
+0x3b,0x9e,0xda,0x3d,0x2f,0xc4,0x31,0xc0,0x2f,0xf3,0x7f,0x2f,0xc0,0x31,0x1e,0xfe,
+0xbc,0x1a,0x18,0x0,0xf5,0xb,0xfe,0xf5,0x3,0x2,0x39,0x2f,0xf9,0x3e,0x2f,0xc3,
+0x5e,0xfe,0xf4,0x4,0x3,0x21,0xfe,0xc1,0x13,0x14,0x0,0xfd,0xfd,0xf4,0xff,0xb9,
+0x11,0x11,0xff,0xfe,0xe2,0xc,0xc,0x19,0x31,0x2f,0xce,0x31,0xc0,0x2f,0xe2,0x3d,
+0xc2,0x2f,0xc2,0x5a,0x2f,0xc0,0x31,0xa0,0x49,0xfe,0xd8,0x10,0x10,0x0,0xf7,0x1d,
+0x3a,0xfe,0xfd,0x0,0x0,0x2f,0xfd,0xc2,0xa2,0x67,0xfe,0xe8,0x9,0xa,0xfe,0xbe,
+0x18,0x18,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xf2,0xff,0xb7,0x19,0x18,0xff,0x21,
+0x39,0x31,0x2f,0xcf,0x31,0xc0,0x2f,0xe3,0xa0,0x8a,0xc1,0x2f,0xc5,0xfe,0xf6,0x4,
+0x3,0x1f,0xfe,0xb0,0xe,0xc,0xff,0x0,0x0,0x0,0x0,0xf7,0x13,0x1c,0x2f,0xc0,
+0x2c,0x2f,0xc0,0x3e,0x2f,0xfc,0xfe,0xf7,0x3,0x3,0x1c,0x18,0x0,0xfd,0xfd,0xf0,
+0xff,0xc7,0x15,0x15,0xff,0xfe,0xe6,0xb,0x9,0xfe,0xf5,0x3,0x2,0xfe,0xfe,0x2,
+0x1,0x2f,0xfd,0xc3,0xfe,0xea,0x8,0x9,0xfe,0xc6,0x1a,0x1a,0xff,0x0,0x0,0x0,
+0x0,0xf9,0xff,0xd5,0x12,0x10,0xff,0xfe,0xf6,0x4,0x3,0x39,0x2f,0xfd,0xc4,0xfe,
+0xec,0x8,0x7,0x24,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xee,0x2a,0xfe,0xeb,0x9,
+0xa,0xfe,0xfd,0x1,0x0,0x2f,0xfd,0xc3,0x39,0xa2,0x27,0x3,0x0,0xfa,0xff,0xae,
+0xe,0xe,0xff,0xfe,0xe3,0xc,0xa,0xfe,0xf6,0x4,0x3,0xfe,0xff,0x1,0x1,0x2f,
+0xca,0x31,0xc0,0x2f,0xf3,0xfe,0xf8,0x3,0x2,0x12,0xfe,0xd4,0x14,0x13,0xff,0x0,
+0x0,0x0,0x0,0xfd,0xfd,0xec,0xe,0xfe,0xea,0x8,0x9,0xfe,0xf7,0x3,0x3,0x2f,
+0xfd,0xc4,0x3e,0x1c,0xfe,0xbb,0x13,0x13,0x0,0xfb,0xff,0xc5,0x15,0x15,0xff,0x1a,
+0x31,0x2c,0x2f,0xc9,0x31,0xc0,0x2f,0xf0,0x7f,0x2f,0xc2,0xfe,0xf0,0x6,0x5,0xb,
+0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xea,0xff,0xce,0x15,0x13,0xff,0x16,0x2c,0x2f,
+0xfd,0xc4,0x31,0x10,0xfe,0xce,0x14,0x15,0x0,0xfd,0x1,0x3b,0x31,0x2f,0xfd,0xc1,
+0x2c,0x2f,0xc0,0x3a,0xfe,0xf0,0x8,0x6,0xfe,0xdc,0xe,0xe,0xfe,0xbc,0x12,0x12,
+0x0,0xfd,0xfd,0xe6,0xff,0xb2,0x10,0xe,0xff,0xfe,0xdb,0xf,0x10,0xfe,0xef,0x7,
+0x7,0x3a,0x2f,0xa0,0x7a,0x59,0x2f,0xf8,0xa0,0x8a,0xc0,0x2f,0xc3,0x5e,0xa1,0x6a,
+0x37,0x0,0xfd,0xc0,0xff,0xb5,0xf,0xf,0xff,0xfe,0xe8,0x9,0xa,0xfe,0xf7,0x3,
+0x3,0x2f,0xc2,0x7f,0x2f,0xfd,0xc0,0x31,0xfe,0xf5,0x3,0x2,0x1e,0x14,0x0,0xfd,
+0xfd,0xe4,0xff,0xc3,0x17,0x17,0xff,0xfe,0xe3,0xc,0xa,0xfe,0xf6,0x4,0x3,0x2f,
+0xc1,0x3a,0xc0,0x2f,0x3e,0x2f,0xf6,0x3d,0xc0,0x2f,0xc3,0xfe,0xf7,0x3,0x2,0x1a,
+0xfe,0xbe,0x12,0x12,0xff,0x0,0x0,0x0,0x0,0xfd,0xc1,0x3f,0x1a,0x2f,0xc7,0x3d,
+0xc0,0x2f,0xf6,0x2c,0x2f,0x3d,0x39,0xa3,0x6,0x1a,0xfe,0xd8,0x10,0x10,0xff,0x0,
+0x0,0x0,0x0,0xfd,0xfd,0xe2,0xb,0x1e,0xfe,0xf6,0x4,0x3,0x39,0x2f,0xfd,0xc6,
+0x10,0x14,0xff,0x0,0x0,0x0,0x0,0xfd,0xc3,0xff,0xd5,0x11,0x12,0xff,0xfe,0xf3,
+0x5,0x5,0x39,0x2c,0x2f,0xc4,0xa0,0x8a,0xc0,0x2f,0xf8,0x3d,0xc0,0x5c,0x39,0xa1,
+0x48,0x2b,0xfe,0xb1,0x17,0x17,0x0,0xfd,0xfd,0xdf,0xff,0xdc,0xe,0xe,0xff,0xfe,
+0xf4,0x4,0x3,0x39,0x2f,0xc6,0x3e,0x2f,0xfb,0x39,0xa3,0x6,0x3,0xff,0x0,0x0,
+0x0,0x0,0xfd,0xc5,0xff,0xdf,0xf,0xf,0xff,0xfe,0xf4,0x4,0x5,0x2f,0xfd,0xc6,
+0x5e,0x9f,0x9b,0xfe,0xf4,0x4,0x3,0xfe,0xe6,0xa,0xa,0xd,0x0,0xfd,0xfd,0xdc,
+0xff,0xc8,0x14,0x15,0xff,0xfe,0xe3,0xb,0xc,0xa,0x39,0x31,0x2f,0xfd,0xc5,0x31,
+0x3a,0x20,0xfe,0xb2,0xf,0x10,0x0,0xfd,0xc5,0xff,0xb7,0x14,0x15,0xff,0x21,0x3b,
+0x9e,0xda,0x2f,0xfd,0xc8,0xfe,0xf0,0x6,0x5,0x9,0x0,0xfd,0xfd,0xda,0x18,0xfe,
+0xed,0x7,0x9,0x30,0x2f,0xfd,0xc7,0x31,0x3b,0xfe,0xe8,0xa,0x9,0xfe,0xc4,0x18,
+0x18,0x0,0xfd,0xc7,0xd,0xfe,0xf1,0x5,0x5,0xfe,0xf9,0x1,0x2,0x3d,0x2f,0xc0,
+0x31,0xc0,0x2f,0xfd,0xc3,0x3b,0x6,0xfe,0xdf,0xd,0xe,0x23,0x0,0xfd,0xfd,0xd6,
+0xff,0xb4,0xe,0xe,0xff,0x1,0x10,0x3c,0x2f,0xc7,0x3d,0xc0,0x2f,0xc0,0x3d,0xc0,
+0x2f,0xf7,0xa1,0x49,0xfe,0xf4,0x4,0x3,0xb,0x0,0xfd,0xc9,0xff,0xd7,0x11,0x10,
+0xff,0xfe,0xf0,0x6,0x7,0xfe,0xfd,0x0,0x2,0x2f,0xc0,0x31,0xc0,0x2f,0xfd,0xc5,
+0x37,0xfe,0xec,0x8,0x9,0xe,0x0,0xfd,0xfd,0xd4,0xff,0xca,0x16,0x15,0xff,0x1f,
+0xfe,0xf6,0x4,0x3,0x2f,0xc9,0x3d,0xc0,0x2f,0xc0,0x3d,0xc0,0x2f,0xf7,0xa,0xfe,
+0xdc,0xe,0xe,0xff,0x0,0x0,0x0,0x0,0xfd,0xcb,0x2d,0x39,0xa0,0xa6,0x2f,0xfd,
+0xc8,0xa1,0x37,0x3c,0xfe,0xf0,0x8,0x8,0x2d,0x36,0x0,0xfd,0xfd,0xd0,0x23,0xfe,
+0xde,0xe,0xe,0xfe,0xec,0x8,0x7,0xfe,0xf6,0x4,0x3,0x39,0x2f,0xc0,0x3e,0x2f,
+0xfd,0xc6,0x31,0xfe,0xe3,0xc,0xa,0xff,0x0,0x0,0x0,0x0,0xfd,0xcc,0xff,0xbc,
+0x12,0x12,0xff,0xfe,0xe9,0x9,0x9,0xfe,0xf7,0x3,0x3,0x2f,0xfd,0xcb,0x31,0x6,
+0x7,0x0,0xfd,0xfd,0xce,0xe,0x10,0x3a,0x31,0xc0,0x2f,0xc5,0x2c,0x2f,0xfd,0xc1,
+0xfe,0xf8,0x3,0x2,0x10,0xfe,0xc7,0x15,0x15,0x0,0xfd,0xcd,0xff,0xc5,0x19,0x19,
+0xff,0xfe,0xec,0x8,0x9,0x2f,0xfd,0x3d,0xc0,0x2f,0xc5,0x2c,0x2f,0x2c,0x2f,0x3b,
+0xfe,0xf0,0x6,0x5,0xfe,0xe3,0xc,0xa,0xb,0x0,0xfd,0xfd,0xca,0xff,0xcd,0x15,
+0x13,0xff,0x2d,0x16,0x3a,0x2f,0xc2,0x2c,0x2f,0xfd,0xc6,0x7f,0x10,0xfe,0xcc,0x16,
+0x15,0x0,0xfd,0xcf,0x3f,0xfe,0xf4,0x4,0x3,0x39,0x2f,0xfb,0x3d,0xc0,0x2f,0xc5,
+0x3e,0x2f,0xc2,0x3e,0x39,0xa3,0x6,0x2b,0xfe,0xb9,0x16,0x17,0xff,0x0,0x0,0x0,
+0x0,0xfd,0xfd,0xc6,0xff,0xb1,0x19,0x18,0xff,0xfe,0xdb,0xf,0xe,0xfe,0xf3,0x5,
+0x3,0x3b,0x9e,0xe8,0xc9,0x3e,0x2f,0xfd,0xc0,0x39,0xa3,0x6,0x2,0xff,0x0,0x0,
+0x0,0x0,0xfd,0xd1,0xff,0xe1,0xd,0xa,0xff,0x3a,0x2f,0xc1,0x31,0xc0,0x2f,0xfd,
+0xc4,0x3d,0xc0,0x31,0xc0,0x39,0x3a,0x1c,0xfe,0xd7,0x11,0x12,0xfe,0xb3,0xf,0xe,
+0x0,0xfd,0xfd,0xc3,0xb,0xfe,0xe6,0xa,0xa,0xfe,0xf3,0x5,0x5,0xfe,0xfa,0x2,
+0x2,0x31,0x2f,0xfd,0xcc,0xfe,0xf6,0x4,0x3,0x1d,0xfe,0xb7,0x12,0x10,0xff,0x0,
+0x0,0x0,0x0,0xfd,0xd1,0xff,0xbb,0x16,0x14,0xff,0x1f,0x3b,0x31,0x2f,0x31,0xc0,
+0x2f,0xfd,0xc4,0x3d,0xc0,0x31,0xc0,0x2f,0xc1,0xfe,0xf7,0x3,0x3,0xfe,0xe8,0x9,
+0xa,0x18,0x0,0xfd,0xfd,0xc0,0x21,0xfe,0xe1,0xd,0xc,0x3a,0x2f,0xfd,0xce,0x31,
+0x39,0x1c,0xfe,0xc6,0x17,0x14,0x0,0xfd,0xd3,0xff,0xd2,0x14,0x14,0xff,0xa,0x3b,
+0x2f,0xfd,0xce,0x39,0x3e,0x10,0xfe,0xe3,0xd,0xd,0xe,0x0,0xfd,0xfa,0x18,0xfe,
+0xe0,0xe,0xd,0xfe,0xea,0x8,0x9,0xfe,0xf4,0x4,0x3,0x39,0x2f,0xfd,0xce,0xa0,
+0x49,0xa4,0x6,0xfe,0xd5,0x12,0x10,0xff,0x0,0x0,0x0,0x0,0xfd,0xd5,0x3,0x4,
+0x31,0x2f,0xfd,0xcb,0x2c,0x2f,0xc3,0x3a,0xfe,0xe2,0xc,0xa,0xfe,0xc9,0x17,0x15,
+0x0,0xfd,0xf6,0xff,0xc3,0x19,0x19,0xff,0xfe,0xde,0xe,0xc,0x3c,0x2f,0xfd,0xd2,
+0xa,0x37,0x0,0xfd,0xd7,0x2d,0x39,0x31,0x2f,0xc7,0x31,0xc0,0x2f,0xfd,0xc1,0x2c,
+0x2f,0xc0,0x31,0x3b,0x3a,0x12,0x2b,0xc,0x0,0xfd,0xf2,0xff,0xce,0x15,0x13,0xff,
+0xfe,0xdf,0xd,0xc,0x1a,0x3c,0x3b,0x2f,0xc0,0x7f,0x2f,0xfd,0xce,0xa0,0x7a,0xfe,
+0xe3,0xb,0xc,0x0,0xfd,0xd8,0xff,0xb6,0x12,0x11,0xff,0xfe,0xe3,0xc,0xa,0xfe,
+0xf4,0x4,0x3,0x2f,0xc7,0x31,0xc0,0x2f,0xfd,0x3e,0x2f,0xc2,0x31,0xc0,0x2f,0xc1,
+0xfe,0xf6,0x4,0x3,0xfe,0xe5,0xb,0xa,0x18,0xff,0x0,0x0,0x0,0x0,0xfd,0xee,
+0xff,0xc9,0x17,0x17,0xff,0x2b,0x3a,0x2f,0x2c,0x2f,0xc3,0x3e,0x2f,0xfd,0xca,0x3e,
+0x2f,0xfe,0xf7,0x3,0x3,0xfe,0xe8,0x9,0xa,0xfe,0xc0,0x14,0x14,0x0,0xfd,0xd9,
+0xff,0xb3,0x19,0x19,0xff,0x21,0xfe,0xfd,0x0,0x2,0x2f,0xfd,0xc4,0x3d,0xc0,0x2f,
+0xc2,0x7f,0x2c,0x2f,0xc4,0x31,0xa1,0x47,0xa2,0x29,0x10,0xfe,0xe3,0xc,0xa,0x9,
+0xfe,0xb2,0xe,0xd,0xff,0x0,0x0,0x0,0x0,0xfd,0xe9,0xc,0xfe,0xe3,0xd,0xd,
+0x12,0xfe,0xf4,0x4,0x3,0x39,0x2f,0xfd,0xd4,0xfe,0xea,0xa,0xa,0xfe,0xbd,0x19,
+0x18,0x0,0xfd,0xdb,0x23,0x1c,0xfe,0xf7,0x3,0x3,0x2f,0xfd,0xc3,0x3d,0xc0,0x2f,
+0xc6,0x5a,0x2f,0xc1,0x31,0xc0,0x2f,0xc1,0xfe,0xf7,0x3,0x2,0x1c,0x9,0xfe,0xb4,
+0x19,0x17,0x0,0xfd,0xe4,0xff,0xb1,0x19,0x18,0xff,0xc,0x1f,0xfe,0xf6,0x4,0x3,
+0xfe,0xfe,0x0,0x0,0x31,0xc0,0x2f,0xc4,0x2c,0x2f,0xfd,0xcc,0xfe,0xf8,0x3,0x2,
+0x12,0x18,0xff,0x0,0x0,0x0,0x0,0xfd,0xdd,0xff,0xc0,0x18,0x18,0xff,0x1a,0x2f,
+0x7f,0x2f,0xfd,0x3d,0xc0,0x2f,0xd1,0xa2,0x36,0xa1,0x3a,0xfe,0xef,0x5,0x4,0x1e,
+0xfe,0xde,0xe,0xe,0x9,0xfe,0xbd,0x11,0x11,0x0,0xfd,0xde,0xff,0xb6,0xe,0xe,
+0xff,0xb,0xfe,0xdc,0xe,0xe,0x1f,0xfe,0xef,0x7,0x7,0xfe,0xf6,0x4,0x3,0x39,
+0x2f,0xfd,0xd1,0x2c,0x2f,0xc0,0x2c,0x2f,0x12,0x24,0xff,0x0,0x0,0x0,0x0,0xfd,
+0xdf,0x18,0xfe,0xec,0x6,0x6,0xfe,0xf9,0x4,0x3,0x2f,0xc0,0x2c,0x2f,0xfa,0x3d,
+0xc0,0x2f,0xc2,0x3d,0xc0,0x2f,0xcf,0x5e,0x39,0xfe,0xef,0x7,0x5,0xfe,0xdb,0xf,
+0x10,0x2a,0x0,0xfd,0xda,0xff,0xc0,0x1a,0x1a,0xff,0xfe,0xd8,0x10,0x10,0x10,0x3b,
+0x31,0x2f,0xfd,0xd8,0x3a,0x16,0xfe,0xd3,0x12,0x13,0x0,0xfd,0xe1,0x14,0x10,0x2f,
+0xc7,0xa0,0x8a,0xc0,0x2f,0xfd,0xc2,0x31,0xc0,0x2f,0xc8,0x31,0x3a,0xa,0x1a,0xfe,
+0xe1,0xb,0xb,0xfe,0xd8,0x10,0x10,0xfe,0xca,0x14,0x13,0x0,0xfd,0xd4,0xff,0xc6,
+0x12,0x13,0xff,0xfe,0xd7,0x11,0x10,0xfe,0xe2,0xe,0xb,0xfe,0xe9,0x9,0x9,0x4,
+0x3a,0x31,0x2f,0xfd,0xd9,0x16,0xc,0x0,0xfd,0xe3,0xff,0xd4,0x12,0x12,0xff,0xfe,
+0xef,0x5,0x4,0x3b,0x2f,0xc5,0xa0,0x8a,0xc0,0x2f,0xfd,0xc2,0x31,0xc0,0x2f,0xcb,
+0x7f,0x2f,0x39,0xfe,0xf4,0x4,0x3,0x1f,0xfe,0xce,0x15,0x13,0xfe,0xb1,0x17,0x17,
+0x0,0xfd,0xce,0xff,0xac,0x16,0x15,0xff,0xfe,0xcc,0x16,0x15,0x29,0x19,0xfe,0xfa,
+0x2,0x0,0x2f,0xc1,0x2c,0xc1,0x2f,0xfd,0xd6,0x3b,0xa,0xfe,0xd8,0x10,0x10,0x0,
+0xfd,0xe5,0x9,0xfe,0xf0,0x6,0x5,0x2f,0xc0,0x2c,0x2f,0xfd,0xd4,0x3e,0x2f,0xc2,
+0xa2,0x67,0x39,0xa4,0x6,0x16,0x1f,0xa3,0x7,0x3,0xfe,0xd3,0x12,0x13,0xfe,0xbe,
+0xe,0x10,0xff,0x0,0x0,0x0,0x0,0xfd,0xc6,0xff,0xb9,0xd,0xd,0xff,0xc,0x3d,
+0x27,0x1f,0x10,0xfe,0xf6,0x4,0x3,0x3b,0x31,0x2f,0xc1,0x3e,0x2f,0xfd,0xd6,0x3e,
+0x9f,0x68,0x4,0x33,0xff,0x0,0x0,0x0,0x0,0xfd,0xe7,0x3,0xa,0x3b,0x3e,0x2f,
+0xfd,0xdf,0x31,0x39,0x4,0xfe,0xe3,0xb,0xc,0xb,0xfe,0xc2,0x1a,0x19,0x0,0xfd,
+0xc0,0xff,0xbf,0x1b,0x1a,0xff,0xe,0x2d,0x6,0x3b,0x31,0x76,0xc8,0x3e,0x2f,0xfd,
+0xd5,0x39,0xfe,0xf5,0x5,0x4,0xfe,0xde,0xe,0xe,0x0,0xfd,0xe9,0x33,0xa,0x2f,
+0xfd,0xc7,0x31,0xc0,0x2f,0xc8,0x3e,0x2f,0xc4,0x3e,0x2f,0xc4,0x31,0x3b,0xa2,0x7,
+0x8,0xa2,0xa,0x21,0x35,0x3d,0xc,0xfe,0xb9,0xb,0xc,0x0,0xf4,0xff,0xb3,0x9,
+0x9,0xff,0xfe,0xcf,0x16,0x14,0xfe,0xd7,0x11,0x12,0x37,0x29,0xfe,0xe9,0x9,0x9,
+0x16,0xfe,0xf4,0x4,0x3,0x3b,0x31,0x2f,0xc1,0x5a,0x5a,0x31,0x3e,0x2f,0xc7,0x31,
+0xc0,0x2f,0xc2,0x31,0xc0,0x2f,0xfd,0xc7,0x2c,0x2f,0x3a,0xfe,0xe2,0xc,0xc,0xfe,
+0xb5,0x12,0x13,0x0,0xfd,0xea,0x37,0x3a,0x39,0x2f,0xfd,0xc5,0x31,0xc0,0x2f,0xd1,
+0x3e,0x2f,0xc3,0x3e,0x31,0xc0,0x2f,0xc1,0x31,0x3b,0x4,0xfe,0xe3,0xb,0xc,0xd,
+0x1a,0xfe,0xc3,0x1b,0x1a,0xfe,0xb8,0x1e,0x1c,0x0,0xea,0xff,0xb6,0x1e,0x1d,0xff,
+0xfe,0xc0,0x1a,0x1a,0xfe,0xc9,0x17,0x15,0xfe,0xd4,0x12,0x12,0xfe,0xe1,0xd,0xc,
+0x6,0xfe,0xf9,0x4,0x3,0x31,0x2f,0xc9,0xa2,0x67,0x31,0x2f,0xc3,0x2c,0x2f,0xc2,
+0x31,0xc0,0x2f,0xc2,0x31,0xc0,0x2f,0xfd,0xc7,0x39,0xa2,0x27,0x20,0xfe,0xb9,0x13,
+0x13,0xff,0x0,0x0,0x0,0x0,0xfd,0xeb,0xff,0xb5,0x13,0x11,0xff,0x1d,0x3a,0x2f,
+0xc2,0x2c,0x2f,0xfd,0xe2,0x31,0xa1,0x49,0xa2,0x27,0xa1,0x29,0x10,0xa1,0x49,0xa3,
+0x15,0x20,0xa0,0x6c,0xa2,0x18,0x3,0xa2,0x29,0xe,0xfe,0xc0,0xe,0xe,0xff,0x0,
+0x0,0x0,0x0,0xdc,0xff,0xbb,0xb,0xb,0xff,0xfe,0xce,0x15,0x13,0xfe,0xd4,0x12,
+0x12,0x3d,0x9e,0xe8,0x27,0x29,0x1f,0x1c,0x12,0x6,0x3a,0x3b,0x9f,0xc7,0x2f,0xfd,
+0xe7,0x3e,0x1c,0xfe,0xc1,0x13,0x12,0x0,0xfd,0xed,0xff,0xb9,0x15,0x14,0xff,0x2b,
+0xfe,0xf6,0x4,0x3,0x39,0xa0,0xc7,0x2f,0xfd,0xec,0xa0,0x8a,0xc0,0x2f,0x31,0x39,
+0x3a,0xfe,0xe9,0x7,0x8,0x29,0x27,0xa2,0x28,0xa1,0x4b,0xa2,0x27,0xa2,0x8,0xa2,
+0x46,0x18,0x24,0xfe,0xc0,0x1a,0x1a,0xa2,0x28,0xc1,0xa1,0x69,0x68,0x9f,0xab,0x3b,
+0xc0,0x9e,0xe8,0xfe,0xc7,0x17,0x19,0xfe,0xcd,0x15,0x17,0x5a,0x16,0x10,0x9e,0xe7,
+0x33,0x9f,0xc7,0x20,0xfe,0xea,0x8,0x9,0xfe,0xf4,0x4,0x5,0xfe,0xfa,0x2,0x2,
+0x31,0x66,0x7a,0xfd,0xed,0x3e,0x2c,0x30,0xa1,0x3a,0x1f,0xfe,0xc5,0x15,0x15,0xff,
+0x0,0x0,0x0,0x0,0xfd,0xef,0xff,0xbb,0x15,0x15,0xff,0x20,0xf,0x2f,0x2c,0x2f,
+0xcb,0xa0,0x8a,0x2f,0xfd,0xd7,0x31,0xc0,0x3d,0xc0,0x2f,0xc4,0x31,0xa0,0x6a,0x3e,
+0x5e,0x9f,0x68,0xa,0x4,0xa1,0x69,0x5e,0x4a,0x6c,0x12,0x1c,0x1e,0xc1,0x67,0x1e,
+0x20,0x1e,0xc0,0x1c,0x9f,0xc9,0x10,0xc0,0x16,0x14,0x4,0xa,0x68,0x0,0x75,0x39,
+0x31,0x2c,0x2f,0xfd,0xf0,0x37,0x1c,0xfe,0xc5,0x15,0x15,0xff,0x0,0x0,0x0,0x0,
+0xfd,0xf1,0x28,0x35,0xa,0x3b,0x2f,0xcb,0x3d,0x2f,0xfd,0xd7,0x31,0xc0,0x3d,0xc0,
+0x2f,0xc5,0x2c,0xa1,0x98,0x2f,0xc3,0x3e,0x2f,0xcb,0x3e,0x2f,0xfd,0xf9,0x3e,0x39,
+0x3a,0xfe,0xe3,0xb,0xc,0xfe,0xc2,0x12,0x14,0x0,0xfd,0xf4,0x33,0xa,0x2f,0xfd,
+0xe7,0x31,0xc0,0x3d,0xc0,0x2f,0xc6,0x2c,0x2f,0xcd,0x31,0xc2,0x2f,0x3e,0x2f,0xc6,
+0x3e,0x2f,0xfd,0xe7,0x31,0xc0,0x2c,0x2f,0xc1,0x4a,0xfe,0xf5,0x5,0x4,0xfe,0xe2,
+0xc,0xc,0xfe,0xb9,0x13,0x13,0x0,0xfd,0xf6,0x3,0x6,0x3b,0x2f,0xfd,0xe5,0x31,
+0xc0,0x3d,0xc0,0x2f,0xcc,0x3d,0xc0,0x2f,0xc6,0x31,0xc2,0x2f,0xc6,0x3e,0x2f,0xfd,
+0xe9,0x31,0xc0,0x2f,0xc1,0x3b,0xfe,0xf1,0x5,0x5,0xfe,0xde,0xe,0xe,0xfe,0xb5,
+0x12,0x13,0x0,0xfd,0xf8,0xff,0xd4,0x12,0x12,0xff,0xfe,0xf1,0x7,0x6,0x2f,0xa0,
+0x7a,0xc0,0x2f,0xfd,0xe6,0x3d,0xc0,0x2f,0xce,0x31,0xc0,0x2f,0xc2,0x3e,0x2f,0xc4,
+0x3e,0x2f,0xc0,0x3d,0xc0,0x2f,0xfd,0xea,0x31,0xc0,0x2f,0xc1,0x4,0xfe,0xdb,0xf,
+0xe,0x0,0xfd,0xfb,0xff,0xd3,0x13,0x12,0xff,0x12,0xfe,0xf7,0x3,0x3,0x3a,0x2f,
+0xfd,0xe6,0x5b,0x3d,0x2f,0xc6,0x7f,0x2f,0xc5,0x31,0xc0,0x2f,0xcc,0x3d,0xc0,0x2f,
+0xfd,0xea,0x31,0xc0,0x2f,0xfe,0xf8,0x3,0x2,0x14,0xfe,0xd8,0x10,0x10,0x0,0xfd,
+0xfd,0xff,0xca,0x18,0x18,0xff,0x20,0x2f,0x3e,0x2f,0xfd,0xed,0x31,0xc0,0x2f,0xfd,
+0xfd,0xc3,0x2c,0x2f,0xc2,0x3e,0x16,0xfe,0xd3,0x12,0x13,0x0,0xfd,0xfd,0xc1,0xff,
+0xce,0x16,0x16,0xff,0x1c,0xfe,0xf7,0x3,0x3,0x2f,0xfd,0xed,0x31,0xc0,0x2f,0xfd,
+0xfd,0xc7,0x3a,0x10,0xd,0x0,0xfd,0xfd,0xc3,0xff,0xbe,0x18,0x18,0xff,0x1c,0xfe,
+0xfd,0x0,0x2,0x2f,0xfd,0xfd,0xcc,0x31,0xc0,0x2f,0xfd,0xe2,0x31,0xc0,0x2f,0xc0,
+0x7f,0x10,0xfe,0xca,0x16,0x15,0x0,0xfd,0xfd,0xc5,0xff,0xc1,0x13,0x14,0xff,0x1f,
+0xfe,0xf5,0x3,0x2,0xfe,0xfd,0x1,0x0,0x2f,0xfd,0xfd,0xca,0x31,0xc0,0x2f,0xfd,
+0xe0,0x2c,0x2f,0x31,0xc1,0xa2,0x9,0x1c,0x18,0x0,0xfd,0xfd,0xc7,0xff,0xb1,0x17,
+0x17,0xff,0xfe,0xe4,0xd,0xb,0x39,0x31,0x76,0xfd,0xfd,0xfd,0xf0,0x31,0x3a,0xfe,
+0xe8,0x9,0xa,0x11,0x0,0xfd,0xfd,0xc9,0x28,0xfe,0xdf,0xd,0xc,0x6,0x3b,0x31,
+0x2f,0xfd,0xfd,0xfd,0xec,0x31,0x39,0xa,0xfe,0xe3,0xb,0xc,0xfe,0xc0,0x14,0x14,
+0x0,0xfd,0xfd,0xcc,0x3d,0x3c,0x3b,0x2f,0xfd,0xe7,0xa0,0x8a,0xc0,0x2f,0xd0,0x31,
+0xc0,0x2f,0xfd,0xea,0x7f,0x39,0xa3,0x6,0x37,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,
+0xcf,0xff,0xd1,0x14,0x12,0xff,0x1f,0xfe,0xf4,0x4,0x3,0x39,0x2f,0xfd,0xe5,0x3d,
+0xc0,0x2f,0xd0,0x31,0xc0,0x2f,0xfd,0xe9,0x39,0xa2,0x27,0x1a,0xfe,0xd5,0x12,0x10,
+0x0,0xfd,0xfd,0xd1,0x22,0xfe,0xe1,0xd,0xc,0x3a,0x2f,0x7f,0x2f,0x31,0xc0,0x2f,
+0xc4,0x3e,0x2c,0x2f,0xc4,0x3d,0xc0,0x2f,0xfd,0xfd,0xfd,0xcf,0x2c,0x2f,0xc1,0xfe,
+0xf6,0x2,0x2,0x1e,0xfe,0xc7,0x15,0x13,0x0,0xfd,0xfd,0xd4,0xff,0xd8,0x10,0x10,
+0xff,0x12,0xfe,0xf7,0x3,0x3,0xfe,0xfc,0x0,0x0,0x31,0xc0,0x76,0xc3,0x7f,0x2f,
+0xc6,0xa0,0x8a,0xc0,0x2f,0xfd,0xfd,0xfd,0xce,0x3e,0x2f,0xc0,0xfe,0xf8,0x3,0x2,
+0x16,0x2,0xfe,0xb8,0x13,0x11,0x0,0xfd,0xfd,0xd6,0x24,0x1a,0xfe,0xfd,0x0,0x2,
+0x31,0x2f,0xc3,0x31,0xc0,0x2f,0xfd,0xfd,0xfd,0xcc,0x31,0xc0,0x2f,0xc9,0x3e,0x31,
+0x10,0xfe,0xce,0x14,0x15,0x0,0xfd,0xfd,0xd9,0x23,0xfe,0xe1,0xb,0xb,0x4,0x3b,
+0x31,0x2f,0xc0,0x3e,0x31,0xc0,0x2c,0x2f,0xfd,0xfd,0xfd,0xcb,0x31,0xc0,0x2f,0xc7,
+0x31,0x39,0xfe,0xf4,0x6,0x4,0xfe,0xe5,0xb,0xa,0xfe,0xc8,0x14,0x13,0x0,0xfd,
+0xfd,0xdc,0x3,0xfe,0xf3,0x5,0x5,0x3b,0x2f,0xc9,0x31,0xc0,0x2f,0xfd,0xfd,0xfd,
+0xce,0x31,0xa1,0x47,0xa2,0x29,0xfe,0xdc,0xf,0xc,0xff,0x0,0x0,0x0,0x0,0xfd,
+0xfd,0xdf,0xc,0x1f,0xfe,0xf4,0x4,0x3,0x39,0x2f,0xc7,0x31,0xc0,0x2f,0xfd,0xfd,
+0xfd,0xcd,0x30,0xa2,0x19,0xfe,0xe8,0xa,0x7,0x9,0xff,0x0,0x0,0x0,0x0,0xfd,
+0xfd,0xe1,0x22,0xfe,0xe1,0xd,0xc,0x3a,0x2f,0xfd,0xfd,0xfd,0xd3,0x31,0xc0,0x2f,
+0xc1,0xfe,0xf6,0x4,0x3,0xfe,0xe6,0xc,0xb,0xfe,0xc4,0x16,0x15,0xff,0x0,0x0,
+0x0,0x0,0xfd,0xfd,0xe4,0xff,0xd7,0x11,0x10,0xff,0x12,0xfe,0xf7,0x3,0x3,0x31,
+0x2f,0xfd,0xfd,0xfd,0xd0,0x31,0xc1,0xa2,0x18,0xfe,0xed,0x7,0x7,0x1,0xfe,0xb3,
+0xf,0xe,0x0,0xfd,0xfd,0xe6,0xff,0xc7,0x17,0x17,0xff,0x1a,0x39,0x9f,0xb9,0xa1,
+0x96,0x2f,0xc3,0x2c,0x2f,0xfd,0xfd,0xfd,0xc9,0x31,0x3a,0x12,0x18,0x0,0xfd,0xfd,
+0xe9,0xff,0xbc,0x12,0x12,0xff,0x37,0xfe,0xec,0x8,0x9,0xfe,0xf7,0x3,0x3,0x39,
+0x2f,0xc0,0x2c,0x2f,0xfd,0xfd,0xfd,0xc9,0x39,0x3e,0x10,0x35,0xfe,0xc2,0x14,0x15,
+0x0,0xfd,0xfd,0xec,0xff,0xcc,0x15,0x17,0xff,0xfe,0xe8,0x9,0xa,0x3e,0x2f,0xc3,
+0x29,0x31,0x2f,0xfd,0xfd,0xfa,0x7f,0x2f,0x3d,0xc0,0x2f,0x2c,0x2f,0xc0,0x3e,0xfe,
+0xf7,0x3,0x3,0xfe,0xe9,0x9,0x9,0xfe,0xce,0x15,0x13,0x0,0xfd,0xfd,0xef,0x3b,
+0xfe,0xd8,0x10,0x10,0x1c,0xfe,0xf6,0x4,0x3,0x31,0x2f,0xc0,0x31,0xc0,0x2f,0xfd,
+0xfd,0xfc,0xa0,0x8a,0xc0,0x2f,0xc0,0x31,0x3e,0xfe,0xec,0x8,0x9,0x3,0x1,0xff,
+0x0,0x0,0x0,0x0,0xfd,0xfd,0xf2,0xff,0xbe,0x19,0x17,0xff,0x21,0xfe,0xf8,0x3,
+0x2,0x31,0x2f,0xfd,0xfd,0xfd,0xc0,0x2c,0x2f,0xc1,0x31,0xa1,0x49,0xfe,0xe8,0x9,
+0xa,0xfe,0xc6,0x18,0x19,0x0,0xfd,0xfd,0xf5,0xff,0xad,0xd,0xd,0xff,0x3f,0x1f,
+0x4,0x3b,0x2f,0xfd,0xfd,0xfd,0xc0,0x3b,0xfe,0xf2,0x4,0x4,0xfe,0xe8,0xa,0x9,
+0x3,0xfe,0xb3,0xf,0xe,0x0,0xfd,0xfd,0xf8,0xff,0xb7,0x17,0x17,0xff,0xfe,0xda,
+0x10,0xe,0x4,0x2f,0xfd,0xfd,0xfb,0x2c,0x2f,0xc0,0xa,0x37,0xf,0x0,0xfd,0xfd,
+0xfc,0xff,0xcd,0x15,0x15,0xff,0x2b,0xfe,0xef,0x7,0x7,0x3e,0x9f,0xd6,0x2f,0xfd,
+0xfd,0xf6,0x31,0xa3,0x18,0x6,0xfe,0xe3,0xc,0xa,0xfe,0xd1,0x15,0x14,0x0,0xfd,
+0xfd,0xfd,0xc2,0xff,0xce,0x15,0x13,0xff,0x1e,0xfe,0xf7,0x3,0x2,0x2f,0xc4,0x7f,
+0x2f,0xc1,0x2c,0x2f,0xc2,0x3d,0xc0,0x2f,0xc0,0x31,0xc0,0x2f,0xce,0x31,0xc0,0x2f,
+0xfd,0xea,0x31,0xc0,0x2f,0xc4,0x31,0xc0,0x2f,0xc4,0x3d,0xc0,0x2f,0xcf,0x3a,0x10,
+0xfe,0xd4,0x12,0x12,0x0,0xfd,0xfd,0xfd,0xc5,0x3b,0x3f,0xfe,0xe7,0x9,0x8,0xa,
+0xfe,0xfa,0x2,0x2,0x31,0x2c,0x2f,0xc8,0x3d,0xc0,0x2f,0xc0,0x31,0xc0,0x2f,0xce,
+0x31,0xc0,0x2f,0xfd,0xea,0x31,0xc0,0x2f,0xc4,0x31,0xc0,0x2f,0xc4,0x3d,0xc0,0x2f,
+0xcb,0x31,0x39,0xfe,0xf4,0x4,0x3,0x1c,0x3,0xfe,0xbf,0x11,0x10,0x0,0xfd,0xfd,
+0xfd,0xc8,0xff,0xb4,0x18,0x19,0xff,0xfe,0xdb,0xf,0x10,0x6,0x3b,0x2f,0x3e,0x2f,
+0xc4,0x3e,0x2f,0xce,0x31,0xc0,0x2f,0xfd,0xfd,0xc9,0x2c,0x2f,0xc2,0x3e,0x2f,0xc1,
+0x2c,0x39,0x3a,0x2d,0xfe,0xbe,0x18,0x18,0x0,0xfd,0xfd,0xfd,0xcc,0xff,0xc5,0x13,
+0x13,0xff,0x1,0x1c,0x8,0x3b,0x31,0x2f,0xd3,0x31,0xc0,0x2f,0xfd,0xfd,0xcc,0x3e,
+0x2f,0xc0,0x31,0x39,0xa3,0x6,0x1a,0xfe,0xde,0xe,0xe,0xd,0xff,0x0,0x0,0x0,
+0x0,0xfd,0xfd,0xfd,0xd0,0xff,0xbd,0x19,0x1a,0xff,0xfe,0xdf,0xd,0xe,0xa,0x3b,
+0x2f,0xd7,0x31,0xc0,0x2f,0xfd,0xec,0x3d,0xc0,0x2f,0xca,0x31,0xc0,0x2f,0xcb,0x39,
+0xa3,0x6,0x20,0xfe,0xc5,0x19,0x19,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xd4,
+0xff,0xca,0x14,0x13,0xff,0xfe,0xdc,0xe,0xe,0x1a,0x3a,0x3b,0x9f,0xc7,0x2f,0xd3,
+0x31,0xc0,0x2f,0xfd,0xec,0x3d,0xc0,0x2f,0xca,0x31,0xc0,0x2f,0xc5,0x3e,0x2f,0x31,
+0x39,0xa3,0x6,0xfe,0xec,0x8,0x9,0x27,0xc,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,
+0xfd,0xd8,0xff,0xc2,0x1a,0x19,0xff,0x27,0xa,0x3b,0x2f,0xc3,0x31,0xc0,0x2f,0xd0,
+0x31,0xc0,0x2f,0xc0,0x3d,0xc0,0x31,0xc0,0x2f,0xfd,0xf0,0x3d,0xc0,0x2f,0xc7,0xa0,
+0x49,0x3a,0xfe,0xe3,0xb,0xc,0xfe,0xc6,0x18,0x19,0x0,0xfd,0xfd,0xfd,0xdc,0x36,
+0x34,0xfe,0xe6,0xa,0xa,0x6,0xfe,0xf7,0x3,0x2,0x9f,0xd7,0x2f,0x31,0xc0,0x2f,
+0xd0,0x31,0xc0,0x2f,0xc0,0x3d,0xc0,0x31,0xc0,0x2f,0xfd,0xf0,0x3d,0xc0,0x2f,0xc3,
+0x31,0xa2,0x18,0x4,0x1e,0xfe,0xdc,0xe,0xe,0x18,0x0,0xfd,0xfd,0xfd,0xe0,0xff,
+0xb1,0x19,0x18,0xff,0x9,0xfe,0xea,0x9,0x7,0x37,0x2f,0xcb,0x3d,0xc0,0x2f,0xc1,
+0x3e,0x2f,0xfd,0xec,0x5e,0xc0,0x2f,0xc4,0x5a,0x2f,0xca,0x3a,0x10,0xfe,0xd8,0x10,
+0x10,0xfe,0xb8,0x18,0x18,0x0,0xfd,0xfd,0xfd,0xe4,0xff,0xb4,0xf,0xd,0xff,0x9,
+0xfe,0xe1,0xd,0xa,0x11,0xa,0x3b,0x31,0x2f,0xc6,0xa1,0x8a,0x55,0x2f,0xfd,0xf0,
+0x31,0xc0,0x2f,0xcd,0x3b,0x19,0x12,0xfe,0xe2,0xc,0xa,0xfe,0xd5,0x12,0x10,0xfe,
+0xba,0x10,0x10,0x0,0xfd,0xfd,0xfd,0xe9,0xff,0xc3,0x19,0x19,0xff,0xfe,0xdb,0xf,
+0xe,0x6,0x39,0x31,0x2f,0xc0,0x7f,0x2f,0xc5,0x3e,0x2f,0xc4,0x31,0xc0,0x2f,0xfd,
+0xee,0x3d,0xc0,0x2f,0xc0,0x3e,0x2f,0x3d,0xc0,0x5a,0xa,0xfe,0xde,0xe,0xe,0xfe,
+0xc6,0x18,0x17,0x0,0xfd,0xfd,0xfd,0xee,0xff,0xc0,0x10,0x10,0xff,0x3f,0xfe,0xe1,
+0xd,0xc,0x1a,0xa,0x9e,0xf7,0x31,0x2f,0xc2,0x2c,0x2f,0xc6,0x31,0xc0,0x2f,0xfd,
+0xee,0x3d,0xc0,0x2f,0x31,0x3a,0xa,0x1a,0x2b,0x3,0xfe,0xc5,0x11,0x12,0x0,0xfd,
+0xfd,0xfd,0xf3,0xff,0xc2,0x1a,0x19,0xff,0xfe,0xdc,0x10,0xf,0xfe,0xec,0x6,0x6,
+0x3a,0x3e,0x2f,0xfd,0xf4,0x3d,0xc0,0x2f,0xc2,0x5a,0x2f,0xc2,0x3a,0xfe,0xef,0x7,
+0x5,0x37,0xfe,0xc4,0x18,0x18,0x0,0xfd,0xfd,0xfd,0xf8,0x23,0x9,0x27,0xfe,0xe8,
+0x9,0xa,0x16,0xfe,0xf6,0x4,0x3,0x3b,0x31,0x2f,0xfd,0xef,0x3d,0xc0,0x2f,0xc1,
+0x31,0x39,0xa2,0x27,0xfe,0xf0,0x6,0x7,0x20,0x2d,0xfe,0xd5,0x11,0x12,0xfe,0xbf,
+0x11,0x10,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0x38,0xfe,0xce,0x14,0x15,
+0xfe,0xe5,0xb,0xc,0xa,0x3b,0x9e,0xe8,0x2c,0x2f,0x3d,0xc0,0x2f,0xfd,0xe8,0x31,
+0xc0,0x2f,0xc3,0x39,0xa3,0x6,0x20,0xfe,0xd3,0x12,0x13,0xfe,0xba,0x1a,0x1c,0xff,
+0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0xc5,0xff,0xc4,0x12,0x12,0xff,0x7,0x27,
+0xfe,0xe6,0xa,0xa,0x10,0xfe,0xf4,0x4,0x5,0xfe,0xfb,0x3,0x4,0x9d,0xd9,0x2f,
+0xfd,0xe7,0x31,0x30,0x3b,0xa2,0x7,0xa3,0x9,0x1e,0x2d,0x3f,0x3c,0x0,0xfd,0xfd,
+0xfd,0xfd,0xcb,0xff,0xb3,0x19,0x19,0xff,0x18,0xfe,0xe1,0xc,0xe,0x14,0x3b,0x2f,
+0x31,0xc0,0x2f,0xd4,0x2c,0x2f,0xcb,0x3d,0xc0,0x2f,0xec,0x31,0xc0,0x3d,0x59,0x2f,
+0xc6,0x7f,0x2f,0xc2,0x3b,0x6,0x2b,0xfe,0xce,0x15,0x13,0xfe,0xb9,0x1b,0x1a,0x0,
+0xfd,0xfd,0xfd,0xfd,0xd1,0xff,0xb9,0xd,0xd,0xff,0xfe,0xd1,0x13,0x13,0xfe,0xdb,
+0xf,0xe,0x2d,0x9e,0xf7,0x10,0xfe,0xf4,0x4,0x3,0x3b,0x31,0x2f,0xcd,0x2c,0x2f,
+0xc3,0x2c,0x2f,0xc8,0x3d,0xc0,0x2f,0xdd,0x3e,0x2f,0xc4,0x3e,0x2f,0xc5,0x31,0xc0,
+0x3d,0xc0,0x2f,0xc4,0x31,0x3b,0x3a,0x16,0x1c,0x2b,0x33,0xfe,0xd3,0x12,0x13,0xfe,
+0xbe,0x10,0x11,0x0,0xfd,0xfd,0xfd,0xfd,0xd8,0xff,0xb8,0x1d,0x1b,0xff,0xfe,0xcd,
+0x15,0x13,0x27,0x6,0x3b,0x31,0x2f,0xc1,0x2c,0x2f,0x3e,0x2f,0xc0,0x3e,0x2f,0xf8,
+0x31,0xc0,0x2f,0xca,0xa1,0x8a,0x3d,0x2f,0xc3,0x31,0x3b,0x4,0x2d,0xe,0xfe,0xbd,
+0x1a,0x1b,0x0,0xfd,0xfd,0xfd,0xfd,0xdf,0xff,0xb5,0xb,0xb,0xff,0xfe,0xcf,0x13,
+0x12,0xfe,0xd6,0x10,0xf,0xfe,0xdc,0xe,0xe,0xfe,0xe2,0xc,0xc,0x1e,0x10,0x4,
+0xfe,0xf7,0x3,0x2,0x39,0xa0,0xa6,0x2f,0xc3,0x2c,0x2f,0xf3,0x31,0xc0,0x2f,0xc8,
+0x3e,0x9f,0x68,0x39,0xa0,0x48,0xa5,0x7,0x10,0x1e,0xa1,0x2a,0xa3,0x7,0xfe,0xd7,
+0x11,0x10,0xe,0x3c,0x0,0xfd,0xfd,0xfd,0xfd,0xe7,0xff,0xbb,0x1d,0x1c,0xff,0xfe,
+0xca,0x16,0x15,0xfe,0xda,0x10,0xe,0xfe,0xe9,0x9,0x7,0x3a,0x39,0x3e,0x2f,0xc1,
+0x7e,0x2f,0xc7,0x2c,0x2f,0xe0,0x31,0xc0,0x2f,0xc2,0x2c,0x2f,0xc8,0x3e,0x2f,0xc3,
+0x39,0xa3,0x6,0x12,0xfe,0xdc,0xe,0xe,0xfe,0xcc,0x16,0x15,0xfe,0xbc,0x1c,0x1c,
+0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0xf0,0xff,0xc0,0x11,0xe,0xff,0xfe,
+0xd0,0x14,0x13,0x3f,0x33,0x27,0x9f,0xc7,0x9f,0xd8,0x9e,0xfb,0x10,0x4,0x3a,0x9f,
+0xc9,0x9f,0xc8,0x9e,0xda,0x2f,0xe3,0x5e,0xc0,0x2f,0xc7,0x31,0x3b,0xa1,0x47,0x5f,
+0x4,0x16,0xa1,0x29,0x20,0xa4,0x5,0xa0,0x3b,0x33,0x3f,0xa2,0x9,0xfe,0xc5,0x11,
+0x10,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0xfa,0xff,0xb6,0x1e,0x1d,0xff,
+0xfe,0xc1,0x19,0x19,0xfe,0xcd,0x15,0x15,0xfe,0xd8,0x10,0x10,0x2b,0x1a,0xfe,0xf3,
+0x5,0x5,0xfe,0xfa,0x2,0x3,0x9e,0xe9,0x68,0xcc,0x31,0xc0,0x2f,0xd0,0x3d,0xc0,
+0x2f,0xc4,0x5a,0x2f,0xc2,0x3b,0xa,0xfe,0xea,0x9,0x7,0xfe,0xe3,0xc,0xa,0xfe,
+0xda,0x10,0xe,0xe,0xfe,0xc5,0x19,0x19,0xfe,0xb9,0x1d,0x1e,0x0,0xfd,0xfd,0xfd,
+0xfd,0xfd,0xc8,0xff,0xb5,0x7,0x8,0xff,0xfe,0xce,0x14,0x15,0xfe,0xd5,0x13,0x14,
+0x9e,0xc8,0x34,0x9f,0xc8,0x27,0xa0,0xa8,0x9e,0xca,0xa0,0xa6,0x76,0x9f,0xb9,0x1c,
+0x12,0x10,0xa0,0xa8,0x6,0x4,0xa,0xcf,0x6,0x16,0x10,0xa1,0x69,0x1c,0x5b,0x1f,
+0x21,0x29,0x2d,0x9f,0x6a,0xa3,0x47,0xa1,0x48,0xd,0xa1,0x47,0xfe,0xce,0x15,0x13,
+0xfe,0xb9,0x9,0xb,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xfd,0xfd,0xd8,0xff,
+0xb5,0x1f,0x20,0xff,0x9e,0xe8,0xfe,0xbf,0x1b,0x1a,0xfe,0xc7,0x17,0x17,0x18,0xe,
+0x9,0x33,0x9e,0xc9,0x7f,0x28,0x31,0xc0,0x37,0xc0,0x31,0xc0,0x37,0xc0,0x31,0xc0,
+0x37,0x28,0x37,0x33,0x7,0xc,0x18,0x1e,0xfe,0xc0,0x1c,0x1b,0x3,0xf,0x0,0xfd,
+0xfd,0xfd,0xfd,0xfd,0xeb,0xff,0xae,0x0,0x0,0xff,0x0,0xfd,0xfd,0xfd,0xc7,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x1,
+};
@@ -0,0 +1,630 @@
+static const unsigned char RedX_qoi[] = {
+0x71,0x6f,0x69,0x66,0x0,0x0,0x1,0x7a,0x0,0x0,0x1,0x7a,0x4,0x0,0x0,0xed,
+0xff,0xff,0x0,0x0,0x10,0xff,0xff,0x0,0x0,0x8a,0xff,0xff,0x0,0x0,0x2,0x0,
+0xfd,0xfd,0xfd,0xfd,0xde,0xff,0xff,0x0,0x0,0x26,0xff,0xff,0x0,0x0,0x22,0x0,
+0xfd,0xdc,0x2d,0xff,0xff,0x0,0x0,0xcb,0xff,0xff,0x0,0x0,0xff,0xff,0xff,0x0,
+0x0,0xa1,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xdc,0xff,0xff,0x0,0x0,0x20,0xff,0xff,
+0x0,0x0,0xe5,0xff,0xff,0x0,0x0,0xe1,0xff,0xff,0x0,0x0,0x21,0x0,0xfd,0xda,
+0x2d,0x36,0x32,0xc1,0xff,0xff,0x0,0x0,0xa1,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xda,
+0x2d,0xff,0xff,0x0,0x0,0xd2,0x32,0xc0,0xff,0xff,0x0,0x0,0xe1,0xff,0xff,0x0,
+0x0,0x1c,0x0,0xfd,0xd8,0xff,0xff,0x0,0x0,0x1b,0xff,0xff,0x0,0x0,0xd3,0x32,
+0xc3,0xff,0xff,0x0,0x0,0x9c,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xd8,0xff,0xff,0x0,
+0x0,0x21,0xe,0x32,0xc2,0xff,0xff,0x0,0x0,0xd5,0x26,0x0,0xfd,0xd6,0x2d,0xe,
+0x32,0xc5,0xff,0xff,0x0,0x0,0xa1,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xd6,0xff,0xff,
+0x0,0x0,0x21,0xff,0xff,0x0,0x0,0xe6,0x32,0xc4,0xff,0xff,0x0,0x0,0xdf,0x1d,
+0x0,0xfd,0xd4,0x2d,0x36,0x32,0xc7,0xff,0xff,0x0,0x0,0xa1,0x13,0x0,0xfd,0xfd,
+0xfd,0xfd,0xd4,0x2d,0xff,0xff,0x0,0x0,0xd4,0x32,0xc6,0x12,0xff,0xff,0x0,0x0,
+0x1a,0x0,0xfd,0xd2,0x26,0xe,0x32,0xc9,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xd2,
+0x33,0x19,0x32,0xc8,0xe,0x1b,0x0,0xfd,0xd0,0x2d,0xe,0x32,0xcb,0x28,0x13,0x0,
+0xfd,0xfd,0xfd,0xfd,0xd0,0xff,0xff,0x0,0x0,0x23,0xff,0xff,0x0,0x0,0xe7,0x32,
+0xca,0x12,0xff,0xff,0x0,0x0,0x1f,0x0,0xfd,0xce,0x2d,0x36,0x32,0xcd,0x28,0x13,
+0x0,0xfd,0xfd,0xfd,0xfd,0xce,0xff,0xff,0x0,0x0,0x12,0x24,0x32,0xcc,0xff,0xff,
+0x0,0x0,0xde,0xff,0xff,0x0,0x0,0x1e,0x0,0xfd,0xcc,0x2d,0x36,0x32,0xcf,0x28,
+0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xcc,0x3,0xff,0xff,0x0,0x0,0xcd,0x32,0xce,0xff,
+0xff,0x0,0x0,0xde,0xff,0xff,0x0,0x0,0x19,0x0,0xfd,0xca,0x26,0xe,0x32,0xd1,
+0x31,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xca,0x3e,0x24,0x32,0xd0,0xff,0xff,0x0,0x0,
+0xd2,0x10,0x0,0xfd,0xc8,0x2d,0xe,0x32,0xd3,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xfd,
+0xc8,0xff,0xff,0x0,0x0,0x24,0xff,0xff,0x0,0x0,0xe8,0x32,0xd2,0xff,0xff,0x0,
+0x0,0xdd,0xff,0xff,0x0,0x0,0x1e,0x0,0xfd,0xc6,0x2d,0x36,0x32,0xd5,0x28,0x13,
+0x0,0xfd,0xfd,0xfd,0xfd,0xc6,0xff,0xff,0x0,0x0,0x13,0xff,0xff,0x0,0x0,0xd7,
+0x32,0xd4,0x3c,0xff,0xff,0x0,0x0,0x18,0x0,0xfd,0xc4,0x26,0xff,0xff,0x0,0x0,
+0xd3,0x32,0xd7,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xc4,0xff,0xff,0x0,0x0,0x25,
+0x3a,0x32,0xd6,0xff,0xff,0x0,0x0,0xd0,0x5,0x0,0xfd,0xc2,0xff,0xff,0x0,0x0,
+0x10,0xe,0x32,0xd9,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xc2,0x14,0xff,0xff,0x0,
+0x0,0xe9,0x32,0xd8,0xff,0xff,0x0,0x0,0xdc,0xff,0xff,0x0,0x0,0x1c,0xff,0x0,
+0x0,0x0,0x0,0xfd,0xc0,0x2d,0x36,0x32,0xdb,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xfd,
+0xc0,0xff,0xff,0x0,0x0,0x13,0x3a,0x32,0xda,0xff,0xff,0x0,0x0,0xdb,0x31,0x0,
+0xfc,0x2d,0x36,0x32,0xdd,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xfc,0xff,0xff,0x0,0x0,
+0x14,0xff,0xff,0x0,0x0,0xd1,0x32,0xdc,0x26,0xff,0xff,0x0,0x0,0x17,0x0,0xfa,
+0xff,0xff,0x0,0x0,0x1b,0xff,0xff,0x0,0x0,0xd3,0x32,0xdf,0xff,0xff,0x0,0x0,
+0x9c,0x13,0x0,0xfd,0xfd,0xfd,0xfa,0xff,0xff,0x0,0x0,0x26,0xff,0xff,0x0,0x0,
+0xd9,0x32,0xde,0xff,0xff,0x0,0x0,0xcf,0xff,0xff,0x0,0x0,0x16,0x0,0xf8,0x2d,
+0xe,0x32,0xe1,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xf8,0x1f,0xff,0xff,0x0,0x0,0xea,
+0x32,0xe0,0xff,0xff,0x0,0x0,0xda,0x26,0x0,0xf6,0x2d,0x36,0x32,0xe3,0x28,0x13,
+0x0,0xfd,0xfd,0xfd,0xf6,0xff,0xff,0x0,0x0,0x15,0x10,0x32,0xe2,0x1b,0x2f,0x0,
+0xf4,0x26,0xe,0x32,0xe5,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xf4,0xff,0xff,0x0,0x0,
+0x28,0x1b,0x32,0xe4,0xff,0xff,0x0,0x0,0xce,0x2f,0x0,0xf2,0x2d,0xe,0x32,0xe7,
+0x28,0x13,0x0,0xfd,0xfd,0xfd,0xf2,0x35,0xff,0xff,0x0,0x0,0xec,0x32,0xe6,0x10,
+0xff,0xff,0x0,0x0,0x1a,0x0,0xf0,0x2d,0x36,0x32,0xe9,0x28,0x13,0x0,0xfd,0xfd,
+0xfd,0xf0,0x2f,0xff,0xff,0x0,0x0,0xda,0x32,0xe8,0xff,0xff,0x0,0x0,0xd8,0x24,
+0x0,0xee,0xff,0xff,0x0,0x0,0xd,0x36,0x32,0xeb,0x28,0x13,0x0,0xfd,0xfd,0xfd,
+0xee,0x2f,0xe,0x32,0xea,0xff,0xff,0x0,0x0,0xc3,0xff,0xff,0x0,0x0,0x7,0x0,
+0xec,0xc,0xff,0xff,0x0,0x0,0xc0,0x32,0xed,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xec,
+0xff,0xff,0x0,0x0,0x29,0xff,0xff,0x0,0x0,0xdb,0x32,0xec,0x1e,0x24,0xff,0x0,
+0x0,0x0,0x0,0xea,0x2d,0x36,0x32,0xef,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xea,0xff,
+0xff,0x0,0x0,0x29,0xff,0xff,0x0,0x0,0xed,0x32,0xee,0x5,0xff,0xff,0x0,0x0,
+0x18,0xff,0x0,0x0,0x0,0x0,0xe8,0x2d,0x36,0x32,0xf1,0x28,0x13,0x0,0xfd,0xfd,
+0xfd,0xe8,0x3a,0xff,0xff,0x0,0x0,0xdc,0x32,0xf0,0xff,0xff,0x0,0x0,0xd6,0x19,
+0x0,0xe6,0xff,0xff,0x0,0x0,0x1b,0xe,0x32,0xf3,0xff,0xff,0x0,0x0,0x9c,0x13,
+0x0,0xfd,0xfd,0xfd,0xe6,0xff,0xff,0x0,0x0,0x2a,0xff,0xff,0x0,0x0,0xdc,0x32,
+0xf2,0x36,0x19,0x0,0xe4,0x2d,0xe,0x32,0xf5,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xe4,
+0xb,0x2c,0x32,0xf4,0x2f,0x5,0x0,0xe2,0x2d,0x36,0x32,0xf7,0x28,0x13,0x0,0xfd,
+0xfd,0xfd,0xe2,0x5,0x3c,0x32,0xf6,0x2f,0xff,0xff,0x0,0x0,0x13,0x0,0xe0,0x26,
+0xff,0xff,0x0,0x0,0xd3,0x32,0xf9,0xff,0xff,0x0,0x0,0xb1,0xff,0xff,0x0,0x0,
+0xa,0x0,0xfd,0xfd,0xfd,0xe0,0xff,0xff,0x0,0x0,0x2b,0x3c,0x32,0xf8,0xff,0xff,
+0x0,0x0,0xca,0xff,0xff,0x0,0x0,0x13,0x0,0xde,0x2d,0xff,0xff,0x0,0x0,0xd3,
+0x32,0xfb,0x18,0x13,0x0,0xfd,0xfd,0xfd,0xde,0xff,0xff,0x0,0x0,0x34,0xff,0xff,
+0x0,0x0,0xee,0x32,0xfa,0xff,0xff,0x0,0x0,0xd4,0xff,0xff,0x0,0x0,0x16,0x0,
+0xdc,0x2d,0x36,0x32,0xfd,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xdc,0xff,0xff,0x0,0x0,
+0x2c,0x37,0x32,0xfc,0x19,0x2f,0x0,0xda,0x2d,0x36,0x32,0xfd,0xc1,0x28,0x13,0x0,
+0xfd,0xfd,0xfd,0xda,0xff,0xff,0x0,0x0,0x1a,0xff,0xff,0x0,0x0,0xde,0x32,0xfd,
+0xc0,0x19,0xff,0xff,0x0,0x0,0x12,0x0,0xd8,0x26,0xe,0x32,0xfd,0xc3,0xff,0xff,
+0x0,0x0,0x9c,0x13,0x0,0xfd,0xfd,0xfd,0xd8,0xff,0xff,0x0,0x0,0x2d,0xff,0xff,
+0x0,0x0,0xdf,0x32,0xfd,0xc2,0xff,0xff,0x0,0x0,0xc8,0x3,0x0,0xd6,0x2d,0xe,
+0x32,0xfd,0xc5,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xd6,0x2c,0xff,0xff,0x0,0x0,0xef,
+0x32,0xfd,0xc4,0xff,0xff,0x0,0x0,0xd2,0x24,0x0,0xd4,0x2d,0x36,0x32,0xfd,0xc7,
+0x28,0x13,0x0,0xfd,0xfd,0xfd,0xd4,0x1b,0x12,0x32,0xfd,0xc6,0x3,0xff,0xff,0x0,
+0x0,0x11,0x0,0xd2,0x26,0xe,0x32,0xfd,0xc9,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xd2,
+0xff,0xff,0x0,0x0,0x2e,0x12,0x32,0xfd,0xc8,0xff,0xff,0x0,0x0,0xc7,0x38,0x0,
+0xd0,0x2d,0xe,0x32,0xfd,0xcb,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xd0,0xff,0xff,0x0,
+0x0,0x2f,0xff,0xff,0x0,0x0,0xf0,0x32,0xfd,0xca,0x3,0xff,0xff,0x0,0x0,0x14,
+0x0,0xce,0x2d,0x36,0x32,0xfd,0xcd,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xce,0xff,0xff,
+0x0,0x0,0x1c,0xff,0xff,0x0,0x0,0xe1,0x32,0xfd,0xcc,0xff,0xff,0x0,0x0,0xd1,
+0x19,0x0,0xcc,0x2d,0x36,0x32,0xfd,0xcf,0xff,0xff,0x0,0x0,0xa1,0x13,0x0,0xfd,
+0xfd,0xfd,0xcc,0x31,0xff,0xff,0x0,0x0,0xdb,0x32,0xfd,0xce,0xff,0xff,0x0,0x0,
+0xd0,0xff,0xff,0x0,0x0,0x10,0x0,0xca,0xff,0xff,0x0,0x0,0x1b,0xe,0x32,0xfd,
+0xd1,0xff,0xff,0x0,0x0,0x9c,0x13,0x0,0xfd,0xfd,0xfd,0xca,0xff,0xff,0x0,0x0,
+0x30,0xff,0xff,0x0,0x0,0xe1,0x32,0xfd,0xd0,0xff,0xff,0x0,0x0,0xc5,0x2d,0x0,
+0xc8,0x2d,0xe,0x32,0xfd,0xd3,0xff,0xff,0x0,0x0,0xa1,0x13,0x0,0xfd,0xfd,0xfd,
+0xc8,0xff,0xff,0x0,0x0,0x31,0xff,0xff,0x0,0x0,0xf1,0x32,0xfd,0xd2,0xff,0xff,
+0x0,0x0,0xd0,0xff,0xff,0x0,0x0,0x13,0x0,0xc6,0xff,0xff,0x0,0x0,0x10,0x36,
+0x32,0xfd,0xd5,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xc6,0xff,0xff,0x0,0x0,0x1d,0xff,
+0xff,0x0,0x0,0xe2,0x32,0xfd,0xd4,0xff,0xff,0x0,0x0,0xd0,0xff,0xff,0x0,0x0,
+0xf,0x0,0xc4,0x26,0xff,0xff,0x0,0x0,0xd3,0x32,0xfd,0xd7,0x31,0x13,0x0,0xfd,
+0xfd,0xfd,0xc4,0xff,0xff,0x0,0x0,0x31,0x33,0x32,0xfd,0xd6,0xff,0xff,0x0,0x0,
+0xc4,0x22,0x0,0xc2,0xff,0xff,0x0,0x0,0x10,0xe,0x32,0xfd,0xd9,0x28,0x13,0x0,
+0xfd,0xfd,0xfd,0xc2,0x18,0xff,0xff,0x0,0x0,0xf2,0x32,0xfd,0xd8,0x17,0xff,0xff,
+0x0,0x0,0x12,0x0,0xc0,0x2d,0x36,0x32,0xfd,0xdb,0x28,0x13,0x0,0xfd,0xfd,0xfd,
+0xc0,0xff,0xff,0x0,0x0,0x1e,0x33,0x32,0xfd,0xda,0x17,0x22,0x2d,0x36,0x32,0xfd,
+0xdd,0x28,0x13,0x0,0xfd,0xfd,0xfc,0xff,0xff,0x0,0x0,0x1f,0xff,0xff,0x0,0x0,
+0xde,0x32,0xfd,0xdc,0xff,0xff,0x0,0x0,0xb7,0xff,0xff,0x0,0x0,0xaa,0x32,0xfd,
+0xdf,0x31,0x13,0x0,0xfd,0xfd,0xfa,0xff,0xff,0x0,0x0,0x33,0xff,0xff,0x0,0x0,
+0xe4,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xed,0x3,0xff,0xff,0x0,0x0,0xcd,0x32,
+0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xf8,0x2e,0xff,0xff,0x0,0x0,0xf3,0x32,0xfd,
+0xdd,0xff,0xff,0x0,0x0,0xf6,0xff,0xff,0x0,0x0,0x3b,0x0,0x3,0xc,0x32,0xfd,
+0xdf,0x28,0x13,0x0,0xfd,0xfd,0xf6,0x12,0x9,0x32,0xfd,0xdd,0xf,0xff,0xff,0x0,
+0x0,0x46,0x0,0xc1,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,
+0x0,0x0,0x2,0x0,0xfd,0xfd,0xf4,0xff,0xff,0x0,0x0,0x35,0x9,0x32,0xfd,0xdd,
+0xff,0xff,0x0,0x0,0xec,0xff,0xff,0x0,0x0,0x3a,0x0,0xc3,0x22,0xc,0x32,0xfd,
+0xdf,0x28,0x13,0x0,0xfd,0xfd,0xf2,0x4,0xff,0xff,0x0,0x0,0xf4,0x32,0xfd,0xdd,
+0xf,0x3b,0x0,0xc5,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xf0,0xff,
+0xff,0x0,0x0,0x21,0xff,0xff,0x0,0x0,0xe5,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,
+0xf5,0xff,0xff,0x0,0x0,0x45,0x0,0xc7,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,
+0xdf,0xff,0xff,0x0,0x0,0xb1,0xff,0xff,0x0,0x0,0xa,0x0,0xfd,0xfd,0xee,0xff,
+0xff,0x0,0x0,0x35,0x14,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xeb,0xff,0xff,0x0,
+0x0,0x38,0x0,0xc9,0x22,0xc,0x32,0xfd,0xdf,0x18,0xff,0xff,0x0,0x0,0x2,0x0,
+0xfd,0xfd,0xec,0xff,0xff,0x0,0x0,0x42,0x39,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,
+0xf5,0x25,0x0,0xcb,0x3,0xc,0x32,0xfd,0xdf,0xff,0xff,0x0,0x0,0xa1,0xff,0xff,
+0x0,0x0,0x2,0x0,0xfd,0xfd,0xea,0xff,0xff,0x0,0x0,0x37,0x4,0x32,0xfd,0xdd,
+0x4,0xff,0xff,0x0,0x0,0x43,0x0,0xcd,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,
+0xfd,0xfd,0xe8,0xff,0xff,0x0,0x0,0x22,0xff,0xff,0x0,0x0,0xe6,0x32,0xfd,0xdd,
+0x4,0x1e,0x0,0xcf,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,
+0x0,0x0,0x2,0x0,0xfd,0xfd,0xe6,0x1a,0x1f,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,
+0xea,0xff,0xff,0x0,0x0,0x36,0x0,0xd1,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,
+0xfd,0xfd,0xe4,0x25,0x4,0x32,0xfd,0xdd,0x39,0xf,0x0,0xd3,0x3,0xc,0x32,0xfd,
+0xdf,0x28,0x13,0x0,0xfd,0xfd,0xe2,0xff,0xff,0x0,0x0,0x24,0x2a,0x32,0xfd,0xdd,
+0x39,0xff,0xff,0x0,0x0,0x41,0x0,0xd5,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,
+0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xfd,0xe0,0xff,0xff,0x0,0x0,0x39,
+0xff,0xff,0x0,0x0,0xe8,0x32,0xfd,0xdd,0xb,0xf,0x0,0xd7,0x22,0xc,0x32,0xfd,
+0xdf,0x28,0x13,0x0,0xfd,0xfd,0xde,0x30,0xff,0xff,0x0,0x0,0xf6,0x32,0xfd,0xdd,
+0x2e,0xff,0xff,0x0,0x0,0x35,0x0,0xd9,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,
+0xfd,0xfd,0xdc,0xff,0xff,0x0,0x0,0x25,0x35,0x32,0xfd,0xdd,0x2e,0xff,0xff,0x0,
+0x0,0x3f,0x0,0xdb,0x3,0xc,0xff,0xff,0x0,0x0,0xff,0xfd,0xdf,0x28,0x13,0x0,
+0xfd,0xfd,0xda,0xff,0xff,0x0,0x0,0x26,0xff,0xff,0x0,0x0,0xe4,0x32,0xfd,0xdd,
+0x2e,0xff,0xff,0x0,0x0,0x3f,0x0,0xdd,0x22,0xff,0xff,0x0,0x0,0xc2,0xff,0xff,
+0x0,0x0,0xff,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xfd,0xd8,0x6,
+0xff,0xff,0x0,0x0,0xe9,0x32,0xfd,0xdd,0x35,0xff,0xff,0x0,0x0,0x34,0xff,0x0,
+0x0,0x0,0x0,0xdf,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xd6,0x6,
+0xff,0xff,0x0,0x0,0xf7,0x32,0xfd,0xdd,0x2e,0x39,0x0,0xe1,0x3,0xc,0x32,0xfd,
+0xdf,0x28,0x13,0x0,0xfd,0xfd,0xd4,0x1f,0xff,0xff,0x0,0x0,0xe9,0x32,0xfd,0xdd,
+0x23,0xff,0xff,0x0,0x0,0x3d,0xff,0x0,0x0,0x0,0x0,0xe3,0x22,0xff,0xff,0x0,
+0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xfd,0xd2,0xff,
+0xff,0x0,0x0,0x3c,0xff,0xff,0x0,0x0,0xe9,0x32,0xfd,0xdd,0x2a,0xff,0xff,0x0,
+0x0,0x32,0xff,0x0,0x0,0x0,0x0,0xe5,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,
+0xfd,0xfd,0xd0,0x1c,0x1a,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xf2,0xff,0xff,0x0,
+0x0,0x32,0x0,0xe7,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xce,0xff,
+0xff,0x0,0x0,0x28,0xb,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xf2,0x11,0x0,0xe9,
+0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xcc,0x35,0xff,0xff,0x0,0x0,
+0xe6,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xf1,0x6,0x0,0xeb,0x22,0xff,0xff,0x0,
+0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xfd,0xca,0xff,
+0xff,0x0,0x0,0x3e,0xb,0x32,0xfd,0xdd,0x1f,0xd,0x0,0xed,0x22,0xc,0x32,0xfd,
+0xdf,0x28,0x13,0x0,0xfd,0xfd,0xc8,0xff,0xff,0x0,0x0,0x3f,0xff,0xff,0x0,0x0,
+0xf8,0xff,0xff,0x0,0x0,0xff,0xfd,0xdd,0x18,0xd,0x0,0xef,0x3,0xc,0x32,0xfd,
+0xdf,0x28,0x13,0x0,0xfd,0xfd,0xc6,0xff,0xff,0x0,0x0,0x2a,0x16,0x32,0xfd,0xdd,
+0x18,0x3b,0x0,0xf1,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,
+0x0,0x0,0x2,0x0,0xfd,0xfd,0xc4,0xff,0xff,0x0,0x0,0x40,0x16,0x32,0xfd,0xdd,
+0xff,0xff,0x0,0x0,0xe5,0xd,0x0,0xf3,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,
+0xfd,0xfd,0xc2,0x3d,0x25,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xf0,0x2,0x0,0xf5,
+0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xc0,0xff,0xff,0x0,0x0,0x2b,
+0x21,0x32,0xfd,0xdd,0xd,0xff,0xff,0x0,0x0,0x38,0x0,0xf7,0x3,0xff,0xff,0x0,
+0x0,0xd5,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfc,0xff,0xff,0x0,0x0,0x2c,0xff,
+0xff,0x0,0x0,0xe9,0x32,0xfd,0xdd,0x23,0xff,0xff,0x0,0x0,0x37,0xff,0x0,0x0,
+0x0,0x0,0xf9,0x3c,0x24,0x32,0xfd,0xdf,0x31,0x13,0x0,0xfd,0xfa,0xff,0xff,0x0,
+0x0,0x42,0x2c,0x32,0xfd,0xdd,0x23,0x8,0x0,0xfb,0x3,0xc,0x32,0xfd,0xdf,0x28,
+0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xf8,0xff,0xff,0x0,0x0,0x42,0xff,0xff,0x0,
+0x0,0xf9,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xef,0xff,0xff,0x0,0x0,0x36,0x0,
+0xfd,0x3,0xc,0x32,0xfd,0xdf,0x28,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xf6,0x21,
+0x2c,0x32,0xfd,0xdd,0x2,0xf,0x0,0xfd,0xc1,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,
+0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xf4,0xff,0xff,0x0,0x0,0x44,
+0xff,0xff,0x0,0x0,0xee,0x32,0xfd,0xdd,0x9,0x21,0x0,0xfd,0xc3,0x22,0xc,0x32,
+0xfd,0xdf,0x28,0x13,0x0,0xfd,0xf2,0x29,0xff,0xff,0x0,0x0,0xfa,0x32,0xfd,0xdd,
+0x2,0x21,0x0,0xfd,0xc5,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xf0,0xff,
+0xff,0x0,0x0,0x2e,0xff,0xff,0x0,0x0,0xee,0x32,0xfd,0xdd,0x37,0x39,0x0,0xfd,
+0xc7,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0xff,0xff,0x0,0x0,0xb1,0x2b,
+0x0,0xfd,0xee,0x29,0x37,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xe2,0x16,0x0,0xfd,
+0xc9,0x22,0xc,0x32,0xfd,0xdf,0x18,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xec,0xff,
+0xff,0x0,0x0,0x54,0x3b,0x32,0xfd,0xdd,0x37,0x16,0x0,0xfd,0xcb,0x3,0xc,0x32,
+0xfd,0xdf,0x28,0x13,0x0,0xfd,0xea,0x3f,0x3b,0x32,0xfd,0xdd,0x37,0xff,0xff,0x0,
+0x0,0x33,0x0,0xfd,0xcd,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xe8,0xff,
+0xff,0x0,0x0,0x30,0x2,0x32,0xfd,0xdd,0x2c,0x2e,0x0,0xfd,0xcf,0x22,0xff,0xff,
+0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xe6,0xff,
+0xff,0x0,0x0,0x47,0x2,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xe1,0xff,0xff,0x0,
+0x0,0x29,0xff,0x0,0x0,0x0,0x0,0xfd,0xd1,0x22,0xc,0x32,0xfd,0xdf,0xff,0xff,
+0x0,0x0,0xa1,0x13,0x0,0xfd,0xe4,0xa,0x3b,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,
+0xec,0xff,0xff,0x0,0x0,0x29,0xff,0x0,0x0,0x0,0x0,0xfd,0xd3,0x3,0xc,0x32,
+0xfd,0xdf,0x28,0x13,0x0,0xfd,0xe2,0xff,0xff,0x0,0x0,0x32,0xff,0xff,0x0,0x0,
+0xf0,0x32,0xfd,0xdd,0x21,0xff,0xff,0x0,0x0,0x31,0x0,0xfd,0xd5,0x22,0xff,0xff,
+0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xe0,0xff,
+0xff,0x0,0x0,0x49,0xd,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xe1,0x35,0x0,0xfd,
+0xd7,0x22,0xc,0x32,0xfd,0xdf,0xff,0xff,0x0,0x0,0xa1,0x13,0x0,0xfd,0xde,0x20,
+0xff,0xff,0x0,0x0,0xfb,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xeb,0x35,0x0,0xfd,
+0xd9,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xdc,0x2e,0xd,0x32,0xfd,0xdd,
+0x16,0xff,0xff,0x0,0x0,0x2f,0x0,0xfd,0xdb,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,
+0x0,0xfd,0xda,0x39,0x37,0x32,0xfd,0xdd,0x16,0x2,0x0,0xfd,0xdd,0x22,0xff,0xff,
+0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xd8,0xff,
+0xff,0x0,0x0,0x4b,0xff,0xff,0x0,0x0,0xf1,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,
+0xdf,0xff,0xff,0x0,0x0,0x27,0x0,0xfd,0xdf,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,
+0x0,0xfd,0xd6,0x36,0x6,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xea,0x2a,0x0,0xfd,
+0xe1,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xd4,0x4,0x18,0x32,0xfd,0xdd,
+0xb,0xff,0xff,0x0,0x0,0x2d,0x0,0xfd,0xe3,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,
+0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xd2,0xff,0xff,0x0,0x0,0x4d,
+0x18,0x32,0xfd,0xdd,0x7,0xff,0xff,0x0,0x0,0x25,0x0,0xfd,0xe5,0x22,0xff,0xff,
+0x0,0x0,0xcd,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xd0,0xff,0xff,0x0,0x0,0x4d,
+0xff,0xff,0x0,0x0,0xfc,0x32,0xfd,0xdd,0xb,0x14,0x0,0xfd,0xe7,0x3,0xff,0xff,
+0x0,0x0,0xcd,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xce,0xf,0xff,0xff,0x0,0x0,
+0xf2,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xe9,0x2c,0xff,0x0,0x0,0x0,0x0,0xfd,
+0xe9,0x3,0x24,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xcc,0x1a,0xd,0x32,0xfd,0xdd,
+0x21,0xff,0xff,0x0,0x0,0x2b,0x0,0xfd,0xeb,0x3c,0x24,0x32,0xfd,0xdf,0x31,0x13,
+0x0,0xfd,0xca,0xff,0xff,0x0,0x0,0x4e,0x23,0x32,0xfd,0xdd,0x21,0xf,0x0,0xfd,
+0xed,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xc8,0xff,0xff,0x0,0x0,0x50,
+0x11,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xe8,0x16,0x0,0xfd,0xef,0x3,0xc,0x32,
+0xfd,0xdf,0x28,0x13,0x0,0xfd,0xc6,0xff,0xff,0x0,0x0,0x39,0xff,0xff,0x0,0x0,
+0xf3,0x32,0xfd,0xdd,0x35,0x16,0x0,0xfd,0xf1,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,
+0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xc4,0x2d,0x2e,0x32,0xfd,0xdd,
+0xff,0xff,0x0,0x0,0xdc,0x3e,0x0,0xfd,0xf3,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,
+0x0,0xfd,0xc2,0x2d,0x11,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xe7,0xff,0xff,0x0,
+0x0,0x22,0x0,0xfd,0xf5,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xc0,0xff,
+0xff,0x0,0x0,0x3b,0x2e,0x32,0xfd,0xdd,0x2a,0xff,0xff,0x0,0x0,0x29,0xff,0x0,
+0x0,0x0,0x0,0xfd,0xf7,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0xff,0xff,
+0x0,0x0,0xb1,0x2b,0x0,0xfc,0xff,0xff,0x0,0x0,0x52,0xff,0xff,0x0,0x0,0xf4,
+0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xdb,0x33,0x0,0xfd,0xf9,0x22,0xc,0x32,0xfd,
+0xdf,0x18,0xff,0xff,0x0,0x0,0x2,0x0,0xfa,0xff,0xff,0x0,0x0,0x63,0xff,0xff,
+0x0,0x0,0xfd,0x32,0xfd,0xdd,0x1f,0x33,0x0,0xfd,0xfb,0xff,0xff,0x0,0x0,0x12,
+0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xf8,0xff,0xff,0x0,0x0,0x53,0x1c,0x32,0xfd,
+0xdd,0x1f,0xff,0xff,0x0,0x0,0x27,0x0,0xfd,0xfd,0x3,0xc,0x32,0xfd,0xdf,0x28,
+0x13,0x0,0xf6,0xff,0xff,0x0,0x0,0x3c,0x39,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,
+0xe5,0x2a,0x0,0xfd,0xfd,0xc1,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0xff,
+0xff,0x0,0x0,0x9c,0xff,0xff,0x0,0x0,0x2,0x0,0xf4,0xff,0xff,0x0,0x0,0x55,
+0xff,0xff,0x0,0x0,0xf5,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xda,0x1d,0x0,0xfd,
+0xfd,0xc3,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xf2,0x24,0x1c,0x32,0xfd,0xdd,
+0x14,0x1d,0x0,0xfd,0xfd,0xc5,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xf0,0x27,
+0x4,0x32,0xfd,0xdd,0x9,0xff,0xff,0x0,0x0,0x26,0x0,0xfd,0xfd,0xc7,0x22,0xff,
+0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xee,0x24,
+0x4,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xd8,0xff,0xff,0x0,0x0,0x1f,0x0,0xfd,
+0xfd,0xc9,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xec,0xff,0xff,0x0,0x0,0x57,
+0x1c,0x32,0xfd,0xdd,0x9,0x12,0x0,0xfd,0xfd,0xcb,0x3,0xc,0x32,0xfd,0xdf,0x28,
+0x13,0x0,0xea,0x3d,0x4,0x32,0xfd,0xdd,0x9,0xff,0xff,0x0,0x0,0x25,0x0,0xfd,
+0xfd,0xcd,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xe8,0x3d,0x39,0x32,0xfd,0xdd,
+0xff,0xff,0x0,0x0,0xe3,0x14,0x0,0xfd,0xfd,0xcf,0x22,0xff,0xff,0x0,0x0,0xc2,
+0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xe6,0xff,0xff,0x0,0x0,0x58,
+0xff,0xff,0x0,0x0,0xf6,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xd7,0xff,0xff,0x0,
+0x0,0x1e,0x0,0xfd,0xfd,0xd1,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xe4,0xff,
+0xff,0x0,0x0,0x59,0xff,0xff,0x0,0x0,0xfe,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,
+0xe2,0x3c,0x0,0xfd,0xfd,0xd3,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xe2,0xff,
+0xff,0x0,0x0,0x42,0xf,0x32,0xfd,0xdd,0x33,0xff,0xff,0x0,0x0,0x23,0x0,0xfd,
+0xfd,0xd5,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,
+0x2,0x0,0xe0,0xff,0xff,0x0,0x0,0x5a,0xf,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,
+0xd6,0x3c,0x0,0xfd,0xfd,0xd7,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xde,0x1b,
+0x27,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xe1,0xff,0xff,0x0,0x0,0x1c,0x0,0xfd,
+0xfd,0xd9,0x3,0xc,0x32,0xfd,0xdf,0xff,0xff,0x0,0x0,0xa1,0x13,0x0,0xdc,0x1e,
+0xf,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xe1,0xff,0xff,0x0,0x0,0x22,0x0,0xfd,
+0xfd,0xdb,0x3,0xc,0x32,0xfd,0xdf,0xff,0xff,0x0,0x0,0xa1,0x13,0x0,0xda,0x29,
+0x4,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xe1,0x33,0x0,0xfd,0xfd,0xdd,0x22,0xff,
+0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0xff,0xff,0x0,0x0,0x9c,0xff,0xff,0x0,0x0,
+0x2,0x0,0xd8,0xff,0xff,0x0,0x0,0x5d,0xff,0xff,0x0,0x0,0xf7,0x32,0xfd,0xdd,
+0xff,0xff,0x0,0x0,0xd5,0xff,0xff,0x0,0x0,0x1c,0x0,0xfd,0xfd,0xdf,0x22,0xc,
+0x32,0xfd,0xdf,0xff,0xff,0x0,0x0,0xa1,0x13,0x0,0xd6,0x3c,0x27,0x32,0xfd,0xdd,
+0xff,0xff,0x0,0x0,0xdf,0xff,0xff,0x0,0x0,0x1b,0x0,0xfd,0xfd,0xe1,0x3,0xc,
+0x32,0xfd,0xdf,0x28,0x13,0x0,0xd4,0x34,0x1a,0x32,0xfd,0xdd,0x12,0x1d,0x0,0xfd,
+0xfd,0xe3,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0xff,0xff,0x0,0x0,0x9c,
+0xff,0xff,0x0,0x0,0x2,0x0,0xd2,0xff,0xff,0x0,0x0,0x5f,0x1a,0x32,0xfd,0xdd,
+0xff,0xff,0x0,0x0,0xd3,0xff,0xff,0x0,0x0,0x1a,0x0,0xfd,0xfd,0xe5,0x22,0xc,
+0x32,0xfd,0xdf,0x28,0x13,0x0,0xd0,0x12,0x27,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,
+0xdf,0x1b,0x0,0xfd,0xfd,0xe7,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xce,0xa,
+0xff,0xff,0x0,0x0,0xf8,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xde,0xff,0xff,0x0,
+0x0,0x1f,0x0,0xfd,0xfd,0xe9,0x3,0x24,0x32,0xfd,0xdf,0x28,0x13,0x0,0xcc,0xff,
+0xff,0x0,0x0,0x48,0x1a,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xe3,0xff,0xff,0x0,
+0x0,0x1e,0x0,0xfd,0xfd,0xeb,0xff,0xff,0x0,0x0,0x1d,0x24,0x32,0xfd,0xdf,0x31,
+0x13,0x0,0xca,0xff,0xff,0x0,0x0,0x60,0x25,0x32,0xfd,0xdd,0x3e,0xff,0xff,0x0,
+0x0,0x2a,0x0,0xfd,0xfd,0xed,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xc8,0xff,
+0xff,0x0,0x0,0x62,0x27,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xdd,0x7,0x0,0xfd,
+0xfd,0xef,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xc6,0xff,0xff,0x0,0x0,0x4a,
+0xff,0xff,0x0,0x0,0xf9,0x32,0xfd,0xdd,0x3c,0x7,0x0,0xfd,0xfd,0xf1,0x22,0xff,
+0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xc4,0x33,
+0x30,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xd0,0xff,0xff,0x0,0x0,0x18,0x0,0xfd,
+0xfd,0xf3,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xc2,0xff,0xff,0x0,0x0,0x63,
+0x27,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xdc,0x5,0x0,0xfd,0xfd,0xf5,0x3,0xc,
+0x32,0xfd,0xdf,0x28,0x13,0x0,0xc0,0xff,0xff,0x0,0x0,0x4c,0x30,0x32,0xfd,0xdd,
+0x31,0xff,0xff,0x0,0x0,0x1d,0x0,0xfd,0xfd,0xf7,0x22,0xff,0xff,0x0,0x0,0xc2,
+0x32,0xfd,0xdf,0xff,0xff,0x0,0x0,0x9c,0xff,0xff,0x0,0x0,0x2,0xff,0xff,0x0,
+0x0,0x65,0x30,0x32,0xfd,0xdd,0x2d,0xff,0xff,0x0,0x0,0x17,0x0,0xfd,0xfd,0xf9,
+0x22,0xc,0x32,0xfd,0xdf,0xc,0x27,0x32,0xfd,0xdd,0xff,0xff,0x0,0x0,0xda,0x3a,
+0x0,0xfd,0xfd,0xfb,0x3,0xc,0x32,0xfd,0xfd,0xfd,0xc0,0x1b,0x26,0x0,0xfd,0xfd,
+0xfd,0x3,0xc,0x32,0xfd,0xfd,0xfc,0x1b,0x26,0x0,0xfd,0xfd,0xfd,0xc1,0x22,0xff,
+0xff,0x0,0x0,0xc2,0x32,0xfd,0xfd,0xfa,0xff,0xff,0x0,0x0,0xce,0xff,0xff,0x0,
+0x0,0x16,0x0,0xfd,0xfd,0xfd,0xc3,0x22,0xc,0x32,0xfd,0xfd,0xf8,0xff,0xff,0x0,
+0x0,0xd9,0x2f,0x0,0xfd,0xfd,0xfd,0xc5,0x3,0xc,0x32,0xfd,0xfd,0xf6,0xff,0xff,
+0x0,0x0,0xd8,0xff,0xff,0x0,0x0,0x1a,0x0,0xfd,0xfd,0xfd,0xc7,0x22,0x13,0x32,
+0xfd,0xfd,0xf4,0xc,0xff,0xff,0x0,0x0,0x15,0x0,0xfd,0xfd,0xfd,0xc9,0x22,0xc,
+0x32,0xfd,0xfd,0xf2,0x5,0x24,0x0,0xfd,0xfd,0xfd,0xcb,0x3,0xc,0x32,0xfd,0xfd,
+0xf0,0x5,0xff,0xff,0x0,0x0,0x19,0x0,0xfd,0xfd,0xfd,0xcd,0x3,0xc,0x32,0xfd,
+0xfd,0xee,0xff,0xff,0x0,0x0,0xd6,0x10,0x0,0xfd,0xfd,0xfd,0xcf,0x22,0x13,0x32,
+0xfd,0xfd,0xec,0xff,0xff,0x0,0x0,0xcb,0xff,0xff,0x0,0x0,0x14,0x0,0xfd,0xfd,
+0xfd,0xd1,0x22,0xc,0x32,0xfd,0xfd,0xea,0x2f,0x19,0x0,0xfd,0xfd,0xfd,0xd3,0x3,
+0xc,0x32,0xfd,0xfd,0xe8,0x2f,0xff,0xff,0x0,0x0,0x18,0x0,0xfd,0xfd,0xfd,0xd5,
+0x22,0x13,0x32,0xfd,0xfd,0xe6,0xff,0xff,0x0,0x0,0xca,0x19,0x0,0xfd,0xfd,0xfd,
+0xd7,0x22,0xc,0x32,0xfd,0xfd,0xe4,0xff,0xff,0x0,0x0,0xd4,0xff,0xff,0x0,0x0,
+0x13,0x0,0xfd,0xfd,0xfd,0xd9,0x3,0xc,0x32,0xfd,0xfd,0xe2,0x19,0xff,0xff,0x0,
+0x0,0x16,0x0,0xfd,0xfd,0xfd,0xdb,0x3,0xff,0xff,0x0,0x0,0xd5,0x32,0xfd,0xfd,
+0xe0,0xff,0xff,0x0,0x0,0xdb,0x2f,0x0,0xfd,0xfd,0xfd,0xdd,0x3c,0x24,0x32,0xfd,
+0xfd,0xde,0x26,0xff,0xff,0x0,0x0,0x22,0x0,0xfd,0xfd,0xfd,0xdf,0x3,0xc,0x32,
+0xfd,0xfd,0xdc,0xff,0xff,0x0,0x0,0xd2,0x2f,0x0,0xfd,0xfd,0xfd,0xe1,0xff,0xff,
+0x0,0x0,0x12,0xc,0x32,0xfd,0xfd,0xda,0xff,0xff,0x0,0x0,0xd2,0xff,0xff,0x0,
+0x0,0x15,0x0,0xfd,0xfd,0xfd,0xe3,0x22,0x13,0x32,0xfd,0xfd,0xd8,0xff,0xff,0x0,
+0x0,0xc7,0xff,0xff,0x0,0x0,0x11,0x0,0xfd,0xfd,0xfd,0xe5,0x22,0xc,0x32,0xfd,
+0xfd,0xd6,0x3,0x38,0x0,0xfd,0xfd,0xfd,0xe7,0xff,0xff,0x0,0x0,0x12,0xc,0x32,
+0xfd,0xfd,0xd4,0xff,0xff,0x0,0x0,0xd1,0x24,0x0,0xfd,0xfd,0xfd,0xe9,0x22,0x13,
+0x32,0xfd,0xfd,0xd2,0xff,0xff,0x0,0x0,0xc6,0xff,0xff,0x0,0x0,0x10,0x0,0xfd,
+0xfd,0xfd,0xeb,0x22,0xc,0x32,0xfd,0xfd,0xd0,0xff,0xff,0x0,0x0,0xd0,0xff,0xff,
+0x0,0x0,0x10,0x0,0xfd,0xfd,0xfd,0xed,0x3,0xc,0x32,0xfd,0xfd,0xce,0xff,0xff,
+0x0,0x0,0xd0,0xff,0xff,0x0,0x0,0x14,0x0,0xfd,0xfd,0xfd,0xef,0x3,0xc,0x32,
+0xfd,0xfd,0xcc,0x2d,0xe,0x0,0xfd,0xfd,0xfd,0xf1,0x22,0x13,0x32,0xfd,0xfd,0xca,
+0xff,0xff,0x0,0x0,0xc4,0x22,0x0,0xfd,0xfd,0xfd,0xf3,0x22,0xc,0x32,0xfd,0xfd,
+0xc8,0x17,0x22,0x0,0xfd,0xfd,0xfd,0xf5,0x3,0xc,0x32,0xfd,0xfd,0xc6,0x17,0x3,
+0x0,0xfd,0xfd,0xfd,0xf7,0x22,0x13,0x32,0xfd,0xfd,0xc4,0xff,0xff,0x0,0x0,0xc3,
+0x22,0x0,0xfd,0xfd,0xfd,0xf9,0x22,0xc,0x32,0xfd,0xfd,0xc2,0xff,0xff,0x0,0x0,
+0xcc,0x22,0x0,0xfd,0xfd,0xfd,0xfb,0x3,0xc,0x32,0xfd,0xfd,0xc0,0x1,0xff,0xff,
+0x0,0x0,0x11,0x0,0xfd,0xfd,0xfd,0xfd,0x3,0xc,0x32,0xfd,0xfc,0x1,0x38,0x0,
+0xfd,0xfd,0xfd,0xfd,0xc1,0x22,0x13,0x32,0xfd,0xfa,0xff,0xff,0x0,0x0,0xc1,0xff,
+0xff,0x0,0x0,0xe,0x0,0xfd,0xfd,0xfd,0xfd,0xc3,0x22,0xc,0x32,0xfd,0xf8,0x36,
+0x17,0x0,0xfd,0xfd,0xfd,0xfd,0xc5,0x3,0xc,0x32,0xfd,0xf6,0x2b,0xff,0xff,0x0,
+0x0,0x10,0x0,0xfd,0xfd,0xfd,0xfd,0xc7,0x22,0x13,0x32,0xfd,0xf4,0xff,0xff,0x0,
+0x0,0xc0,0xff,0xff,0x0,0x0,0xd,0x0,0xfd,0xfd,0xfd,0xfd,0xc9,0x22,0xff,0xff,
+0x0,0x0,0xcd,0x32,0xfd,0xf2,0x2b,0xff,0xff,0x0,0x0,0xd,0x0,0xfd,0xfd,0xfd,
+0xfd,0xcb,0x3,0xff,0xff,0x0,0x0,0xcd,0x32,0xfd,0xf0,0xff,0xff,0x0,0x0,0xc9,
+0x2d,0x0,0xfd,0xfd,0xfd,0xfd,0xcd,0x3,0xc,0x32,0xfd,0xee,0xff,0xff,0x0,0x0,
+0xc8,0x22,0x0,0xfd,0xfd,0xfd,0xfd,0xcf,0x22,0x13,0x32,0xfd,0xec,0xff,0xff,0x0,
+0x0,0xbe,0xff,0xff,0x0,0x0,0xc,0x0,0xfd,0xfd,0xfd,0xfd,0xd1,0x22,0xc,0x32,
+0xfd,0xea,0xa,0x1,0x0,0xfd,0xfd,0xfd,0xfd,0xd3,0x3,0xc,0x32,0xfd,0xe8,0xa,
+0x17,0x0,0xfd,0xfd,0xfd,0xfd,0xd5,0x22,0x13,0x32,0xfd,0xe6,0xff,0xff,0x0,0x0,
+0xbc,0x1,0x0,0xfd,0xfd,0xfd,0xfd,0xd7,0x22,0xc,0x32,0xfd,0xe4,0x3f,0xff,0xff,
+0x0,0x0,0xb,0x0,0xfd,0xfd,0xfd,0xfd,0xd9,0x3,0xc,0x32,0xfd,0xe2,0xff,0xff,
+0x0,0x0,0xc5,0xff,0xff,0x0,0x0,0xd,0x0,0xfd,0xfd,0xfd,0xfd,0xdb,0x22,0x13,
+0x32,0xfd,0xe0,0xff,0xff,0x0,0x0,0xbb,0x36,0x0,0xfd,0xfd,0xfd,0xfd,0xdd,0x2d,
+0xff,0xff,0x0,0x0,0xef,0x32,0xfd,0xdf,0x18,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,
+0xfd,0xfd,0xfd,0xdd,0xff,0xff,0x0,0x0,0x84,0x32,0xfd,0xe1,0x28,0x13,0x0,0xfd,
+0xfd,0xfd,0xfd,0xdb,0xff,0xff,0x0,0x0,0x6d,0xff,0xff,0x0,0x0,0xfe,0x32,0xfd,
+0xe2,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xd8,0xff,0xff,0x0,0x0,0x1,0xff,0xff,
+0x0,0x0,0x86,0x27,0x32,0xfd,0xe4,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xd7,0xff,
+0xff,0x0,0x0,0x87,0x32,0xfd,0xe7,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xd5,0xff,
+0xff,0x0,0x0,0x70,0x27,0x32,0xfd,0xe8,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xd2,
+0x8,0xa,0x27,0x32,0xfd,0xea,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xd1,0xff,0xff,
+0x0,0x0,0x88,0x32,0xfd,0xed,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xcf,0xff,0xff,
+0x0,0x0,0x72,0x27,0x32,0xfd,0xee,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xcd,0xff,
+0xff,0x0,0x0,0x73,0x27,0x32,0xfd,0xf0,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xfd,0xca,
+0x13,0xff,0xff,0x0,0x0,0x8a,0x27,0x32,0xfd,0xf2,0x31,0x13,0x0,0xfd,0xfd,0xfd,
+0xfd,0xc9,0xff,0xff,0x0,0x0,0x8b,0x32,0xfd,0xf5,0x28,0x13,0x0,0xfd,0xfd,0xfd,
+0xfd,0xc7,0xff,0xff,0x0,0x0,0x75,0x27,0x32,0xfd,0xf6,0x28,0x13,0x0,0xfd,0xfd,
+0xfd,0xfd,0xc4,0x13,0xff,0xff,0x0,0x0,0x8c,0x27,0x32,0xfd,0xf8,0x31,0x13,0x0,
+0xfd,0xfd,0xfd,0xfd,0xc3,0xff,0xff,0x0,0x0,0x8d,0x32,0xfd,0xfb,0x28,0x13,0x0,
+0xfd,0xfd,0xfd,0xfd,0xc1,0xff,0xff,0x0,0x0,0x76,0x27,0x32,0xfd,0xfc,0x28,0x13,
+0x0,0xfd,0xfd,0xfd,0xfd,0xff,0xff,0x0,0x0,0x78,0x27,0x32,0xfd,0xfd,0xc0,0x28,
+0x13,0x0,0xfd,0xfd,0xfd,0xfa,0x13,0xff,0xff,0x0,0x0,0x8f,0x27,0x32,0xfd,0xfd,
+0xc2,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xf9,0x22,0x32,0xfd,0xfd,0xc5,0x28,0x13,0x0,
+0xfd,0xfd,0xfd,0xf7,0xff,0xff,0x0,0x0,0x7a,0x27,0x32,0xfd,0xfd,0xc6,0x28,0x13,
+0x0,0xfd,0xfd,0xfd,0xf4,0xff,0xff,0x0,0x0,0x3,0xff,0xff,0x0,0x0,0x90,0x27,
+0x32,0xfd,0xfd,0xc8,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xf3,0xff,0xff,0x0,0x0,0x92,
+0x32,0xfd,0xfd,0xcb,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xf1,0xff,0xff,0x0,0x0,0x7d,
+0x32,0xfd,0xfd,0xcd,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xef,0x1c,0x32,0xfd,0xfd,0xcf,
+0x28,0x13,0x0,0xfd,0xfd,0xfd,0xec,0x1e,0xff,0xff,0x0,0x0,0x93,0x32,0xfd,0xfd,
+0xd1,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xeb,0xff,0xff,0x0,0x0,0x94,0x32,0xfd,0xfd,
+0xd3,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xe9,0xff,0xff,0x0,0x0,0x80,0x32,0xfd,0xfd,
+0xd5,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xe6,0x1e,0xff,0xff,0x0,0x0,0x95,0x32,0xfd,
+0xfd,0xd7,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xe5,0x24,0x32,0xfd,0xfd,0xd9,0x28,0x13,
+0x0,0xfd,0xfd,0xfd,0xe2,0x5a,0xff,0xff,0x0,0x0,0x82,0x32,0xfd,0xfd,0xdb,0x28,
+0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xfd,0xfd,0xe0,0xff,0xff,0x0,0x0,0x4,0xff,
+0xff,0x0,0x0,0x97,0x32,0xfd,0xfd,0xdd,0x18,0xff,0xff,0x0,0x0,0xa,0x0,0xfd,
+0xfd,0xfd,0xde,0xff,0xff,0x0,0x0,0x5,0xff,0xff,0x0,0x0,0xb0,0x32,0xfd,0xfd,
+0xdf,0x18,0x13,0x0,0xfd,0xfd,0xfd,0xdc,0x3d,0xff,0xff,0x0,0x0,0x98,0x32,0xfd,
+0xfd,0xe1,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xda,0x3d,0xff,0xff,0x0,0x0,0x84,0x32,
+0xfd,0xfd,0xe3,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xd8,0xff,0xff,0x0,0x0,0x4,0xff,
+0xff,0x0,0x0,0x9a,0x32,0xfd,0xfd,0xe5,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xd6,0x3d,
+0x1b,0x32,0xfd,0xfd,0xe7,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xd4,0x3d,0xa,0x32,0xfd,
+0xfd,0xe9,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xd2,0x29,0xff,0xff,0x0,0x0,0x9b,0x32,
+0xfd,0xfd,0xeb,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xd0,0x3d,0xff,0xff,0x0,0x0,0x9d,
+0x32,0xfd,0xfd,0xed,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xce,0x3d,0xff,0xff,0x0,0x0,
+0x8a,0x32,0xfd,0xfd,0xef,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xcc,0x3d,0x2b,0x32,0xfd,
+0xfd,0xf1,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xca,0x34,0xff,0xff,0x0,0x0,0x9e,0x32,
+0xfd,0xfd,0xf3,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xc8,0x3d,0xff,0xff,0x0,0x0,0x9f,
+0x32,0xfd,0xfd,0xf5,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xc6,0x3d,0xc,0x32,0xfd,0xfd,
+0xf7,0x28,0x13,0x0,0xfd,0xfd,0xfd,0xc4,0x34,0xff,0xff,0x0,0x0,0xa0,0x32,0xfd,
+0xfd,0xf9,0x31,0x13,0x0,0xfd,0xfd,0xfd,0xc2,0x3d,0x1d,0x32,0xfd,0xfd,0xfb,0x28,
+0x13,0x0,0xfd,0xfd,0xfd,0xc0,0x3d,0xff,0xff,0x0,0x0,0x8e,0x32,0xfd,0xfd,0xfd,
+0x28,0x13,0x0,0xfd,0xfd,0xfc,0x3d,0x2d,0x32,0xfd,0xfd,0xfd,0xc1,0x28,0x13,0x0,
+0xfd,0xfd,0xfa,0xff,0xff,0x0,0x0,0x6,0xff,0xff,0x0,0x0,0xa2,0x32,0xfd,0xde,
+0xff,0xff,0x0,0x0,0xaa,0xff,0xff,0x0,0x0,0xd5,0x32,0xfd,0xdf,0x31,0x13,0x0,
+0xfd,0xfd,0xf8,0x3d,0xff,0xff,0x0,0x0,0xa3,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,
+0xa8,0x1e,0xff,0xff,0x0,0x0,0x12,0xff,0xff,0x0,0x0,0xcd,0x32,0xfd,0xdf,0x28,
+0x13,0x0,0xfd,0xfd,0xf6,0x3d,0xff,0xff,0x0,0x0,0x91,0x32,0xfd,0xde,0xff,0xff,
+0x0,0x0,0xa7,0x1e,0x0,0xc0,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,
+0xf4,0xff,0xff,0x0,0x0,0x7,0xff,0xff,0x0,0x0,0xa4,0x32,0xfd,0xde,0x28,0x1e,
+0x0,0xc2,0xff,0xff,0x0,0x0,0xf,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,
+0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xfd,0xf2,0x3d,0xff,0xff,0x0,0x0,0xa5,0x32,
+0xfd,0xde,0xff,0xff,0x0,0x0,0xa6,0x1e,0x0,0xc4,0x22,0xc,0x32,0xfd,0xdf,0x28,
+0x13,0x0,0xfd,0xfd,0xf0,0x3d,0xe,0x32,0xfd,0xde,0x1f,0x1e,0x0,0xc6,0x3,0xc,
+0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xee,0xff,0xff,0x0,0x0,0x8,0x1f,0x32,
+0xfd,0xde,0x12,0x13,0x0,0xc8,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x18,
+0xff,0xff,0x0,0x0,0xa,0x0,0xfd,0xfd,0xec,0xff,0xff,0x0,0x0,0x9,0xff,0xff,
+0x0,0x0,0xbe,0x32,0xfd,0xde,0x9,0xff,0xff,0x0,0x0,0x2,0x0,0xca,0x22,0xc,
+0x32,0xfd,0xdf,0x18,0x13,0x0,0xfd,0xfd,0xea,0x8,0x2a,0x32,0xfd,0xde,0x9,0x1e,
+0x0,0xcc,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xe8,0x8,0xff,0xff,
+0x0,0x0,0x96,0x32,0xfd,0xde,0x3e,0x1e,0x0,0xce,0x3,0xc,0x32,0xfd,0xdf,0x28,
+0x13,0x0,0xfd,0xfd,0xe6,0xa,0x35,0x32,0xfd,0xde,0x31,0x13,0x0,0xd0,0x22,0xff,
+0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xfd,
+0xe4,0x8,0x35,0x32,0xfd,0xde,0x28,0x13,0x0,0xd2,0x22,0xc,0x32,0xfd,0xdf,0x28,
+0x13,0x0,0xfd,0xfd,0xe2,0x8,0xff,0xff,0x0,0x0,0x99,0x32,0xfd,0xde,0x28,0x13,
+0x0,0xd4,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xe0,0x15,0xb,0x32,
+0xfd,0xde,0x26,0x13,0x0,0xd6,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,
+0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xfd,0xde,0x8,0xb,0x32,0xfd,0xde,0x1d,0x13,
+0x0,0xd8,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xdc,0x8,0x1b,0x32,
+0xfd,0xde,0x7,0x13,0x0,0xda,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,
+0xda,0x8,0x26,0x32,0xfd,0xde,0x7,0x13,0x0,0xdc,0x3,0xc,0x32,0xfd,0xdf,0x28,
+0x13,0x0,0xfd,0xfd,0xd8,0x20,0xff,0xff,0x0,0x0,0xac,0x32,0xfd,0xde,0x10,0x8,
+0x0,0xde,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,
+0x2,0x0,0xfd,0xfd,0xd6,0x8,0xff,0xff,0x0,0x0,0xad,0x32,0xfd,0xde,0x3c,0x8,
+0x0,0xe0,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xd4,0x13,0x3c,0x32,
+0xfd,0xde,0x31,0x8,0x0,0xe2,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,
+0xd2,0x20,0x2c,0x32,0xfd,0xde,0x3a,0x8,0x0,0xe4,0x22,0xff,0xff,0x0,0x0,0xc2,
+0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xfd,0xd0,0x13,0xff,0xff,
+0x0,0x0,0xaf,0x32,0xfd,0xde,0x26,0x8,0x0,0xe6,0x22,0xc,0x32,0xfd,0xdf,0x28,
+0x13,0x0,0xfd,0xfd,0xce,0x13,0x12,0x32,0xfd,0xde,0x26,0x8,0x0,0xe8,0x3,0xc,
+0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xcc,0x13,0x1d,0x32,0xfd,0xde,0x10,0x8,
+0x0,0xea,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xca,0x2b,0xd,0x32,
+0xfd,0xde,0x19,0x8,0x0,0xec,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,
+0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xfd,0xc8,0x13,0x18,0x32,0xfd,0xde,0x5,0x8,
+0x0,0xee,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xc6,0x13,0x33,0x32,
+0xfd,0xde,0x5,0x8,0x0,0xf0,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,
+0xc4,0x2b,0xff,0xff,0x0,0x0,0xb2,0x32,0xfd,0xde,0xe,0x8,0x0,0xf2,0x22,0xff,
+0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xfd,
+0xc2,0x13,0x23,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x95,0x3d,0x0,0xf4,0x22,0xc,
+0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfd,0xc0,0x1e,0x3e,0x32,0xfd,0xde,0x24,0x8,
+0x0,0xf6,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xfc,0x1e,0x14,0x32,0xfd,
+0xde,0x1f,0x8,0x0,0xf8,0x3,0xff,0xff,0x0,0x0,0xd5,0x32,0xfd,0xdf,0x28,0x13,
+0x0,0xfd,0xfa,0xff,0xff,0x0,0x0,0xb,0xff,0xff,0x0,0x0,0xb4,0x32,0xfd,0xde,
+0x1f,0xa,0x0,0xfa,0xff,0xff,0x0,0x0,0x1d,0x24,0x32,0xfd,0xdf,0x31,0x13,0x0,
+0xfd,0xf8,0x1e,0x39,0x32,0xfd,0xde,0xe,0x3d,0x0,0xfc,0x3,0xc,0x32,0xfd,0xdf,
+0x28,0x13,0x0,0xfd,0xf6,0x1e,0x1f,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x92,0x3d,
+0x0,0xfd,0xc0,0xff,0xff,0x0,0x0,0x12,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,
+0xf4,0xff,0xff,0x0,0x0,0xc,0xff,0xff,0x0,0x0,0xb5,0x32,0xfd,0xde,0xff,0xff,
+0x0,0x0,0x8f,0x3d,0x0,0xfd,0xc2,0xff,0xff,0x0,0x0,0xf,0xff,0xff,0x0,0x0,
+0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xf2,0x1e,0xff,0xff,
+0x0,0x0,0xb6,0x32,0xfd,0xde,0x38,0x3d,0x0,0xfd,0xc4,0x22,0xc,0x32,0xfd,0xdf,
+0x28,0x13,0x0,0xfd,0xf0,0x29,0x35,0x32,0xfd,0xde,0x2d,0x3d,0x0,0xfd,0xc6,0x3,
+0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xee,0x22,0xff,0xff,0x0,0x0,0xb7,0x32,
+0xfd,0xde,0xff,0xff,0x0,0x0,0x8c,0x3d,0x0,0xfd,0xc8,0x22,0xff,0xff,0x0,0x0,
+0xc2,0x32,0xfd,0xdf,0x18,0x2b,0x0,0xfd,0xec,0x22,0xff,0xff,0x0,0x0,0xce,0x32,
+0xfd,0xde,0xff,0xff,0x0,0x0,0x8f,0x3d,0x0,0xfd,0xca,0xff,0xff,0x0,0x0,0xf,
+0xc,0x32,0xfd,0xdf,0x18,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xea,0x29,0xff,0xff,
+0x0,0x0,0xb9,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x8e,0x3d,0x0,0xfd,0xcc,0x3,
+0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xe8,0x29,0xff,0xff,0x0,0x0,0xab,0x32,
+0xfd,0xde,0x17,0x3d,0x0,0xfd,0xce,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,
+0xe6,0xff,0xff,0x0,0x0,0xd,0x30,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x8a,0x3d,
+0x0,0xfd,0xd0,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,
+0x0,0x2,0x0,0xfd,0xe4,0x29,0x30,0x32,0xfd,0xde,0x1,0x3d,0x0,0xfd,0xd2,0x22,
+0xff,0xff,0x0,0x0,0xcd,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xe2,0x34,0x2c,0x32,
+0xfd,0xde,0xff,0xff,0x0,0x0,0x8b,0x3d,0x0,0xfd,0xd4,0x3,0xc,0x32,0xfd,0xdf,
+0x28,0x13,0x0,0xfd,0xe0,0xff,0xff,0x0,0x0,0xe,0x6,0x32,0xfd,0xde,0xff,0xff,
+0x0,0x0,0x89,0x3d,0x0,0xfd,0xd6,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,
+0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xde,0x34,0x6,0x32,0xfd,0xde,0x2b,0x3d,
+0x0,0xfd,0xd8,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xdc,0x34,0xff,0xff,
+0x0,0x0,0xae,0x32,0xfd,0xde,0x20,0x3d,0x0,0xfd,0xda,0x3,0xc,0x32,0xfd,0xdf,
+0x28,0x13,0x0,0xfd,0xda,0x34,0x2,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x88,0x3d,
+0x0,0xfd,0xdc,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xd8,0x22,0xff,0xff,
+0x0,0x0,0xbd,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x86,0x3d,0x0,0xfd,0xde,0x22,
+0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,
+0xd6,0xff,0xff,0x0,0x0,0x6,0x1c,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x87,0x3d,
+0x0,0xfd,0xe0,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xd4,0x3f,0x18,0x32,
+0xfd,0xde,0xff,0xff,0x0,0x0,0x85,0x3d,0x0,0xfd,0xe2,0x3,0xc,0x32,0xfd,0xdf,
+0x28,0x13,0x0,0xfd,0xd2,0xff,0xff,0x0,0x0,0x10,0x27,0x32,0xfd,0xde,0xff,0xff,
+0x0,0x0,0x84,0x3d,0x0,0xfd,0xe4,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,
+0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xd0,0x3f,0xff,0xff,0x0,0x0,0xbf,0xff,
+0xff,0x0,0x0,0xff,0xfd,0xde,0x34,0x3d,0x0,0xfd,0xe6,0x22,0xc,0x32,0xfd,0xdf,
+0x28,0x13,0x0,0xfd,0xce,0x3f,0xff,0xff,0x0,0x0,0xb3,0x32,0xfd,0xde,0x29,0x3d,
+0x0,0xfd,0xe8,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xcc,0x3f,0x2e,0x32,
+0xfd,0xde,0x3a,0x3d,0x0,0xfd,0xea,0x3,0x24,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,
+0xca,0x2d,0xff,0xff,0x0,0x0,0xc0,0x32,0xfd,0xde,0x3a,0x1e,0x0,0xfd,0xec,0x3c,
+0x24,0x32,0xfd,0xdf,0x31,0x13,0x0,0xfd,0xc8,0xff,0xff,0x0,0x0,0x7,0xff,0xff,
+0x0,0x0,0xc1,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x81,0x0,0xfd,0xef,0x3,0xc,
+0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xc6,0xa,0x4,0x32,0xfd,0xde,0x8,0x0,0xfd,
+0xf1,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfd,0xc4,0xff,0xff,0x0,0x0,0x11,
+0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x80,0x0,0xfd,0xf3,
+0x22,0x13,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,0xc2,0xa,0xff,
+0xff,0x0,0x0,0xc2,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x7f,0x0,0xfd,0xf5,0x22,
+0xc,0xff,0xff,0x0,0x0,0xff,0xfd,0xdf,0x28,0xff,0xff,0x0,0x0,0x2,0x0,0xfd,
+0xc0,0xff,0xff,0x0,0x0,0x8,0xf,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x7e,0x0,
+0xfd,0xf7,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xfc,0xff,0xff,0x0,0x0,0x16,
+0xff,0xff,0x0,0x0,0xc3,0x32,0xfd,0xde,0x27,0x0,0xfd,0xf9,0x22,0xff,0xff,0x0,
+0x0,0xc2,0x32,0xfd,0xdf,0x18,0xff,0xff,0x0,0x0,0xa,0x0,0xfa,0x2f,0xff,0xff,
+0x0,0x0,0xd9,0x32,0xfd,0xde,0x27,0x0,0xfd,0xfb,0x22,0xc,0x32,0xfd,0xdf,0x18,
+0xff,0xff,0x0,0x0,0x2,0x0,0xf8,0x15,0xff,0xff,0x0,0x0,0xc4,0x32,0xfd,0xdd,
+0xff,0xff,0x0,0x0,0xfe,0xff,0xff,0x0,0x0,0x7b,0x0,0xfd,0xfd,0x3,0xc,0x32,
+0xfd,0xdf,0x28,0x13,0x0,0xf6,0x15,0x30,0x32,0xfd,0xdd,0x27,0x6,0x0,0xfd,0xfd,
+0xc1,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xf4,0xff,0xff,0x0,0x0,0x13,0xff,
+0xff,0x0,0x0,0xc5,0x32,0xfd,0xdd,0x27,0x6,0x0,0xfd,0xfd,0xc3,0x22,0xff,0xff,
+0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xf2,0xff,0xff,
+0x0,0x0,0x9,0xff,0xff,0x0,0x0,0xc6,0x32,0xfd,0xdd,0x27,0x3b,0x0,0xfd,0xfd,
+0xc5,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xf0,0x20,0xff,0xff,0x0,0x0,0xbb,
+0x32,0xfd,0xdd,0x27,0xff,0xff,0x0,0x0,0x79,0x0,0xfd,0xfd,0xc7,0x3,0xc,0x32,
+0xfd,0xdf,0x28,0x13,0x0,0xee,0xe,0x3f,0x32,0xfd,0xdd,0x27,0x30,0x0,0xfd,0xfd,
+0xc9,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,
+0x0,0xec,0x2b,0xff,0xff,0x0,0x0,0xc7,0x32,0xfd,0xdd,0x27,0xff,0xff,0x0,0x0,
+0x77,0x0,0xfd,0xfd,0xcb,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xea,0x2b,0x1c,
+0x32,0xfd,0xdd,0x27,0x1a,0x0,0xfd,0xfd,0xcd,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,
+0x0,0xe8,0x2b,0x1c,0x32,0xfd,0xdd,0x27,0x1a,0x0,0xfd,0xfd,0xcf,0x3,0xc,0x32,
+0xfd,0xdf,0x28,0x13,0x0,0xe6,0xff,0xff,0x0,0x0,0x14,0xff,0xff,0x0,0x0,0xc8,
+0x32,0xfd,0xdd,0x27,0xff,0xff,0x0,0x0,0x76,0x0,0xfd,0xfd,0xd1,0x22,0xff,0xff,
+0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xe4,0x2b,0x15,
+0x32,0xfd,0xdd,0x27,0xff,0xff,0x0,0x0,0x74,0x0,0xfd,0xfd,0xd3,0x22,0xc,0x32,
+0xfd,0xdf,0x28,0x13,0x0,0xe2,0xff,0xff,0x0,0x0,0xb,0xff,0xff,0x0,0x0,0xbf,
+0xff,0xff,0x0,0x0,0xff,0xfd,0xdd,0x27,0x39,0x0,0xfd,0xfd,0xd5,0x3,0xc,0x32,
+0xfd,0xdf,0x28,0x13,0x0,0xe0,0xff,0xff,0x0,0x0,0x15,0xff,0xff,0x0,0x0,0xca,
+0x32,0xfd,0xdd,0x27,0xf,0x0,0xfd,0xfd,0xd7,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,
+0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xde,0x36,0x2b,0x32,0xfd,0xdd,0x27,
+0xff,0xff,0x0,0x0,0x72,0x0,0xfd,0xfd,0xd9,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,
+0x0,0xdc,0x36,0xff,0xff,0x0,0x0,0xc0,0x32,0xfd,0xdd,0x27,0xff,0xff,0x0,0x0,
+0x71,0x0,0xfd,0xfd,0xdb,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xda,0xff,0xff,
+0x0,0x0,0xc,0xff,0xff,0x0,0x0,0xc1,0x32,0xfd,0xdd,0x27,0x18,0x0,0xfd,0xfd,
+0xdd,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xd8,0x2f,0xff,0xff,0x0,0x0,0xcc,
+0x32,0xfd,0xdd,0x27,0xff,0xff,0x0,0x0,0x73,0x0,0xfd,0xfd,0xdf,0x22,0xff,0xff,
+0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xd6,0xff,0xff,
+0x0,0x0,0xc,0xff,0xff,0x0,0x0,0xcc,0x32,0xfd,0xdd,0x27,0xff,0xff,0x0,0x0,
+0x70,0x0,0xfd,0xfd,0xe1,0x22,0xc,0x32,0xfd,0xdf,0x28,0x13,0x0,0xd4,0xff,0xff,
+0x0,0x0,0xc,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdd,0x27,0xff,0xff,0x0,0x0,
+0x6e,0x0,0xfd,0xfd,0xe3,0x3,0xc,0x32,0xfd,0xdf,0x28,0xff,0xff,0x0,0x0,0x2,
+0x0,0xd2,0xff,0xff,0x0,0x0,0x18,0xc,0x32,0xfd,0xdd,0x27,0x18,0x0,0xfd,0xfd,
+0xe5,0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,
+0x0,0xd0,0xff,0xff,0x0,0x0,0xd,0xff,0xff,0x0,0x0,0xce,0x32,0xfd,0xdd,0x27,
+0x37,0x0,0xfd,0xfd,0xe7,0x22,0xff,0xff,0x0,0x0,0xcd,0x32,0xfd,0xdf,0x28,0x13,
+0x0,0xce,0xff,0xff,0x0,0x0,0xd,0x29,0x32,0xfd,0xdd,0x27,0xff,0xff,0x0,0x0,
+0x6d,0x0,0xfd,0xfd,0xe9,0x3,0xff,0xff,0x0,0x0,0xcd,0x32,0xfd,0xdf,0x28,0x13,
+0x0,0xcc,0xff,0xff,0x0,0x0,0xd,0x29,0x32,0xfd,0xde,0xff,0xff,0x0,0x0,0x83,
+0x0,0xfd,0xfd,0xeb,0x3,0xff,0xff,0x0,0x0,0xd5,0x32,0xfd,0xdf,0x28,0x13,0x0,
+0xca,0x5,0x17,0x32,0xfd,0xdd,0x27,0x1e,0xff,0xff,0x0,0x0,0x1,0x0,0xfd,0xfd,
+0xec,0x3c,0x24,0x32,0xfd,0xdf,0x31,0x13,0x0,0xc8,0xff,0xff,0x0,0x0,0xe,0xff,
+0xff,0x0,0x0,0xcf,0x32,0xfd,0xdd,0x27,0xff,0xff,0x0,0x0,0x6a,0x0,0xfd,0xfd,
+0xef,0x3,0xff,0xff,0x0,0x0,0xcd,0x32,0xfd,0xdf,0x28,0x13,0x0,0xc6,0x17,0x3f,
+0x32,0xfd,0xdd,0x27,0xb,0x0,0xfd,0xfd,0xf1,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,
+0x0,0xc4,0xff,0xff,0x0,0x0,0x19,0xff,0xff,0x0,0x0,0xd0,0x32,0xfd,0xdd,0x27,
+0x2c,0x0,0xfd,0xfd,0xf3,0xff,0xff,0x0,0x0,0xf,0xff,0xff,0x0,0x0,0xc2,0x32,
+0xfd,0xdf,0x31,0xff,0xff,0x0,0x0,0x2,0x0,0xc2,0x17,0x2d,0x32,0xfd,0xdd,0xff,
+0xff,0x0,0x0,0xfd,0xff,0xff,0x0,0x0,0x68,0x0,0xfd,0xfd,0xf5,0x22,0xc,0x32,
+0xfd,0xdf,0x28,0x13,0x0,0xc0,0x22,0xa,0x32,0xfd,0xdd,0x27,0x35,0x0,0xfd,0xfd,
+0xf7,0x3,0xc,0x32,0xfd,0xdf,0x28,0x13,0xff,0xff,0x0,0x0,0x20,0xff,0xff,0x0,
+0x0,0xd1,0x32,0xfd,0xdd,0x1c,0xff,0xff,0x0,0x0,0x6b,0x0,0xfd,0xfd,0xf9,0x22,
+0xff,0xff,0x0,0x0,0xc3,0x32,0xfd,0xdf,0xff,0xff,0x0,0x0,0x8f,0xff,0xff,0x0,
+0x0,0x2f,0xff,0xff,0x0,0x0,0xec,0x32,0xfd,0xdc,0x1c,0xff,0xff,0x0,0x0,0x66,
+0x0,0xfd,0xfd,0xfb,0xff,0xff,0x0,0x0,0xf,0xc,0x32,0xfd,0xdd,0xff,0xff,0x0,
+0x0,0xf8,0xff,0xff,0x0,0x0,0x3e,0x0,0xff,0xff,0x0,0x0,0x30,0x21,0x32,0xfd,
+0xda,0x1c,0xff,0xff,0x0,0x0,0x65,0x0,0xfd,0xfd,0xfd,0x3,0xc,0x32,0xfd,0xdb,
+0x25,0xff,0xff,0x0,0x0,0x4b,0x0,0xc1,0xd,0xff,0xff,0x0,0x0,0xef,0x32,0xfd,
+0xd8,0x1c,0x14,0x0,0xfd,0xfd,0xfd,0xc1,0x3,0xc,0x32,0xfd,0xd9,0xff,0xff,0x0,
+0x0,0xf9,0x36,0x0,0xc3,0xff,0xff,0x0,0x0,0x3b,0x2,0x32,0xfd,0xd6,0x1c,0xff,
+0xff,0x0,0x0,0x69,0xff,0x0,0x0,0x0,0x0,0xfd,0xfd,0xfd,0xc3,0x22,0xff,0xff,
+0x0,0x0,0xc2,0x32,0xfd,0xd7,0x30,0xff,0xff,0x0,0x0,0x53,0x0,0xc5,0xd,0x21,
+0x32,0xfd,0xd4,0x1c,0xff,0xff,0x0,0x0,0x64,0x0,0xfd,0xfd,0xfd,0xc5,0x22,0xc,
+0x32,0xfd,0xd5,0x25,0x36,0x0,0xc7,0xff,0xff,0x0,0x0,0x32,0xff,0xff,0x0,0x0,
+0xf0,0x32,0xfd,0xd2,0x1c,0xff,0xff,0x0,0x0,0x62,0x0,0xfd,0xfd,0xfd,0xc7,0x3,
+0xc,0x32,0xfd,0xd3,0x30,0x36,0x0,0xc9,0xff,0xff,0x0,0x0,0x3c,0xd,0x32,0xfd,
+0xd0,0x1c,0x1f,0x0,0xfd,0xfd,0xfd,0xc9,0x22,0x13,0x32,0xfd,0xd1,0x30,0xe,0x0,
+0xcb,0x23,0xff,0xff,0x0,0x0,0xed,0x32,0xfd,0xce,0x1c,0xff,0xff,0x0,0x0,0x61,
+0x0,0xfd,0xfd,0xfd,0xcb,0x22,0xc,0x32,0xfd,0xcf,0x25,0x36,0x0,0xcd,0x23,0x2c,
+0x32,0xfd,0xcc,0xff,0xff,0x0,0x0,0xfc,0x28,0x0,0xfd,0xfd,0xfd,0xcd,0x3,0xc,
+0x32,0xfd,0xcd,0x25,0x36,0x0,0xcf,0xff,0xff,0x0,0x0,0x33,0xff,0xff,0x0,0x0,
+0xf1,0x32,0xfd,0xca,0x1c,0x28,0x0,0xfd,0xfd,0xfd,0xcf,0x3,0xc,0x32,0xfd,0xcb,
+0x30,0x36,0x0,0xd1,0x27,0x18,0x32,0xfd,0xc8,0x1c,0x9,0x0,0xfd,0xfd,0xfd,0xd1,
+0x22,0x13,0x32,0xfd,0xc9,0x30,0xe,0x0,0xd3,0xff,0xff,0x0,0x0,0x34,0xff,0xff,
+0x0,0x0,0xee,0x32,0xfd,0xc6,0x11,0xff,0xff,0x0,0x0,0x5f,0x0,0xfd,0xfd,0xfd,
+0xd3,0x22,0xc,0x32,0xfd,0xc7,0x25,0x36,0x0,0xd5,0x39,0x18,0x32,0xfd,0xc4,0x11,
+0xff,0xff,0x0,0x0,0x5e,0x0,0xfd,0xfd,0xfd,0xd5,0x3,0xc,0x32,0xfd,0xc5,0x30,
+0x36,0x0,0xd7,0xff,0xff,0x0,0x0,0x3f,0xff,0xff,0x0,0x0,0xf2,0xff,0xff,0x0,
+0x0,0xff,0xfd,0xc2,0x11,0xff,0xff,0x0,0x0,0x63,0x0,0xfd,0xfd,0xfd,0xd7,0x22,
+0x13,0x32,0xfd,0xc3,0x30,0xe,0x0,0xd9,0xff,0xff,0x0,0x0,0x36,0x2,0x32,0xfd,
+0xc0,0x11,0xff,0xff,0x0,0x0,0x5c,0x0,0xfd,0xfd,0xfd,0xd9,0x22,0xc,0x32,0xfd,
+0xc1,0x25,0x36,0x0,0xdb,0xf,0x2,0x32,0xfc,0x11,0x31,0x0,0xfd,0xfd,0xfd,0xdb,
+0x3,0xc,0x32,0xfd,0x25,0x36,0x0,0xdd,0xff,0xff,0x0,0x0,0x37,0x23,0x32,0xfb,
+0xff,0xff,0x0,0x0,0x74,0x0,0xfd,0xfd,0xfd,0xdd,0x3,0x24,0x32,0xfb,0x30,0x36,
+0x0,0xdf,0xff,0xff,0x0,0x0,0x41,0x23,0x32,0xf8,0x11,0x39,0xff,0xff,0x0,0x0,
+0x0,0x0,0xfd,0xfd,0xfd,0xde,0x3c,0x24,0x32,0xf9,0x30,0xe,0x0,0xe1,0xff,0xff,
+0x0,0x0,0x38,0xd,0x32,0xf6,0xff,0xff,0x0,0x0,0xfb,0xff,0xff,0x0,0x0,0x5a,
+0x0,0xfd,0xfd,0xfd,0xe1,0x3,0xc,0x32,0xf7,0xff,0xff,0x0,0x0,0xf8,0x36,0x0,
+0xe3,0xff,0xff,0x0,0x0,0x39,0xff,0xff,0x0,0x0,0xf3,0x32,0xf4,0x11,0xff,0xff,
+0x0,0x0,0x59,0x0,0xfd,0xfd,0xfd,0xe3,0x3,0xc,0x32,0xf5,0xff,0xff,0x0,0x0,
+0xf9,0x36,0x0,0xe5,0xff,0xff,0x0,0x0,0x43,0x2e,0x32,0xf2,0x11,0x12,0x0,0xfd,
+0xfd,0xfd,0xe5,0x22,0x13,0x32,0xf3,0x30,0xe,0x0,0xe7,0xff,0xff,0x0,0x0,0x39,
+0x18,0x32,0xf0,0x6,0xff,0xff,0x0,0x0,0x58,0x0,0xfd,0xfd,0xfd,0xe7,0x22,0xc,
+0x32,0xf1,0x25,0x36,0x0,0xe9,0x30,0x23,0x32,0xee,0x11,0x5,0x0,0xfd,0xfd,0xfd,
+0xe9,0x3,0xc,0x32,0xef,0x25,0x36,0x0,0xeb,0xff,0xff,0x0,0x0,0x31,0xff,0xff,
+0x0,0x0,0xe7,0x32,0xec,0x6,0xff,0xff,0x0,0x0,0x5d,0x0,0xfd,0xfd,0xfd,0xeb,
+0x22,0x13,0x32,0xed,0x37,0x27,0x0,0xed,0x18,0x23,0x32,0xea,0x6,0xff,0xff,0x0,
+0x0,0x56,0x0,0xfd,0xfd,0xfd,0xed,0x22,0xc,0x32,0xeb,0x25,0x27,0x0,0xef,0xff,
+0xff,0x0,0x0,0x3b,0x23,0x32,0xe8,0xff,0xff,0x0,0x0,0xfa,0x2f,0x0,0xfd,0xfd,
+0xfd,0xef,0x3,0xc,0x32,0xe9,0x25,0x36,0x0,0xf1,0x6,0xff,0xff,0x0,0x0,0xf4,
+0x32,0xe6,0xff,0xff,0x0,0x0,0xfb,0xff,0xff,0x0,0x0,0x55,0x0,0xfd,0xfd,0xfd,
+0xf1,0x3,0xc,0x32,0xe7,0xff,0xff,0x0,0x0,0xf9,0x36,0x0,0xf3,0xff,0xff,0x0,
+0x0,0x46,0xff,0xff,0x0,0x0,0xf5,0x32,0xe4,0x6,0xff,0xff,0x0,0x0,0x5b,0x0,
+0xfd,0xfd,0xfd,0xf3,0x22,0x13,0x32,0xe5,0x30,0xe,0x0,0xf5,0xff,0xff,0x0,0x0,
+0x3d,0x2e,0x32,0xe2,0x3b,0xe,0x0,0xfd,0xfd,0xfd,0xf5,0x22,0xc,0x32,0xe3,0x25,
+0x36,0x0,0xf7,0x1c,0x4,0x32,0xe0,0x6,0xe,0x0,0xfd,0xfd,0xfd,0xf7,0x3,0xc,
+0x32,0xe1,0x30,0x36,0x0,0xf9,0xff,0xff,0x0,0x0,0x47,0x4,0x32,0xde,0x6,0x10,
+0x0,0xfd,0xfd,0xfd,0xf9,0x22,0x13,0x32,0xdf,0x30,0xe,0x0,0xfb,0xff,0xff,0x0,
+0x0,0x3f,0x39,0xff,0xff,0x0,0x0,0xff,0xdc,0x30,0xff,0xff,0x0,0x0,0x52,0x0,
+0xfd,0xfd,0xfd,0xfb,0x22,0xc,0x32,0xdd,0x25,0x36,0x0,0xfd,0xff,0xff,0x0,0x0,
+0x3f,0x39,0xff,0xff,0x0,0x0,0xff,0xda,0x30,0xff,0xff,0x0,0x0,0x51,0x0,0xfd,
+0xfd,0xfd,0xfd,0xff,0xff,0x0,0x0,0x12,0xc,0x32,0xdb,0x25,0x36,0x0,0xfd,0xc1,
+0xff,0xff,0x0,0x0,0x40,0xff,0xff,0x0,0x0,0xf6,0x32,0xd8,0x3b,0x38,0x0,0xfd,
+0xfd,0xfd,0xfd,0xc1,0x3,0xc,0x32,0xd9,0x30,0x36,0x0,0xfd,0xc3,0xff,0xff,0x0,
+0x0,0x49,0xf,0x32,0xd6,0x3b,0xff,0xff,0x0,0x0,0x57,0x0,0xfd,0xfd,0xfd,0xfd,
+0xc3,0x22,0x13,0x32,0xd7,0x30,0xe,0x0,0xfd,0xc5,0x3d,0x39,0x32,0xd4,0x30,0xff,
+0xff,0x0,0x0,0x50,0x0,0xfd,0xfd,0xfd,0xfd,0xc5,0x22,0xc,0x32,0xd5,0x25,0x36,
+0x0,0xfd,0xc7,0xff,0xff,0x0,0x0,0x42,0xf,0x32,0xd2,0x3b,0xff,0xff,0x0,0x0,
+0x4e,0x0,0xfd,0xfd,0xfd,0xfd,0xc7,0x3,0xc,0x32,0xd3,0x30,0x36,0x0,0xfd,0xc9,
+0x36,0xf,0x32,0xd0,0x3b,0x24,0x0,0xfd,0xfd,0xfd,0xfd,0xc9,0x22,0xff,0xff,0x0,
+0x0,0xc2,0x32,0xd1,0x30,0xe,0x0,0xfd,0xcb,0xff,0xff,0x0,0x0,0x42,0x4,0x32,
+0xce,0x25,0x17,0x0,0xfd,0xfd,0xfd,0xfd,0xcb,0x22,0xc,0x32,0xcf,0x25,0x36,0x0,
+0xfd,0xcd,0x1e,0x4,0x32,0xcc,0x25,0xff,0xff,0x0,0x0,0x4d,0x0,0xfd,0xfd,0xfd,
+0xfd,0xcd,0x3,0xff,0xff,0x0,0x0,0xcd,0x32,0xcd,0x25,0x36,0x0,0xfd,0xcf,0x1e,
+0xff,0xff,0x0,0x0,0xf7,0x32,0xca,0x30,0xff,0xff,0x0,0x0,0x4d,0x0,0xfd,0xfd,
+0xfd,0xfd,0xcf,0x3,0xff,0xff,0x0,0x0,0xcd,0x32,0xcb,0x30,0x36,0x0,0xfd,0xd1,
+0xff,0xff,0x0,0x0,0x4d,0x1a,0x32,0xc8,0x30,0xe,0x0,0xfd,0xfd,0xfd,0xfd,0xd1,
+0x22,0xff,0xff,0x0,0x0,0xc2,0x32,0xc9,0x30,0xe,0x0,0xfd,0xd3,0xff,0xff,0x0,
+0x0,0x45,0xf,0x32,0xc6,0x25,0x36,0x0,0xfd,0xfd,0xfd,0xfd,0xd3,0x22,0xff,0xff,
+0x0,0x0,0xcd,0x32,0xc7,0x25,0x36,0x0,0xfd,0xd5,0x34,0x1a,0x32,0xc4,0x30,0x36,
+0x0,0xfd,0xfd,0xfd,0xfd,0xd5,0x3,0xc,0x32,0xc5,0x30,0x36,0x0,0xfd,0xd7,0x17,
+0x25,0x32,0xc2,0x25,0xff,0xff,0x0,0x0,0x52,0x0,0xfd,0xfd,0xfd,0xfd,0xd7,0x22,
+0x13,0x32,0xc3,0x30,0xe,0x0,0xfd,0xd9,0xa,0xf,0x32,0xc0,0x1a,0x20,0x0,0xfd,
+0xfd,0xfd,0xfd,0xd9,0x22,0xc,0x32,0xc1,0x25,0x36,0x0,0xfd,0xdb,0xa,0x1a,0x25,
+0x20,0x0,0xfd,0xfd,0xfd,0xfd,0xdb,0xff,0xff,0x0,0x0,0x12,0xc,0x32,0x25,0x36,
+0x0,0xfd,0xdd,0xff,0xff,0x0,0x0,0x3b,0xff,0xff,0x0,0x0,0x4f,0x0,0xfd,0xfd,
+0xfd,0xfd,0xdd,0xff,0xff,0x0,0x0,0xf,0xff,0xff,0x0,0x0,0xb2,0x27,0x0,0xed,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,
+};
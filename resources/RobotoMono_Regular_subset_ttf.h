@@ -0,0 +1,735 @@
+static const unsigned char RobotoMono_Regular_subset_ttf[] = {
+0x0,0x1,0x0,0x0,0x0,0xd,0x0,0x80,0x0,0x3,0x0,0x50,0x47,0x53,0x55,0x42,
+0x93,0x15,0x82,0x16,0x0,0x0,0x2d,0x44,0x0,0x0,0x0,0x36,0x4f,0x53,0x2f,0x32,
+0x72,0xb1,0x62,0xf4,0x0,0x0,0x2b,0xa0,0x0,0x0,0x0,0x60,0x53,0x54,0x41,0x54,
+0xe7,0x70,0xcc,0x2e,0x0,0x0,0x2d,0x7c,0x0,0x0,0x0,0x48,0x63,0x6d,0x61,0x70,
+0x8,0x27,0x7,0x44,0x0,0x0,0x2c,0x0,0x0,0x0,0x0,0xa6,0x67,0x61,0x73,0x70,
+0x0,0x0,0x0,0x10,0x0,0x0,0x2d,0x3c,0x0,0x0,0x0,0x8,0x67,0x6c,0x79,0x66,
+0x73,0x6c,0xe7,0xa,0x0,0x0,0x0,0xdc,0x0,0x0,0x28,0xc0,0x68,0x65,0x61,0x64,
+0x1,0x35,0x9c,0xe,0x0,0x0,0x2a,0x80,0x0,0x0,0x0,0x36,0x68,0x68,0x65,0x61,
+0xa,0xb1,0x1,0x2a,0x0,0x0,0x2b,0x7c,0x0,0x0,0x0,0x24,0x68,0x6d,0x74,0x78,
+0x29,0xb4,0x20,0xf,0x0,0x0,0x2a,0xb8,0x0,0x0,0x0,0xc2,0x6c,0x6f,0x63,0x61,
+0xee,0xba,0xe6,0x29,0x0,0x0,0x29,0xbc,0x0,0x0,0x0,0xc2,0x6d,0x61,0x78,0x70,
+0x0,0x7f,0x1,0x3a,0x0,0x0,0x29,0x9c,0x0,0x0,0x0,0x20,0x6e,0x61,0x6d,0x65,
+0x9,0x58,0x19,0xe3,0x0,0x0,0x2c,0xa8,0x0,0x0,0x0,0x74,0x70,0x6f,0x73,0x74,
+0xff,0x6d,0x0,0x65,0x0,0x0,0x2d,0x1c,0x0,0x0,0x0,0x20,0x0,0x2,0x0,0x51,
+0x0,0x0,0x4,0x90,0x5,0xb0,0x0,0x7,0x0,0xa,0x0,0x0,0x41,0x13,0x33,0x1,
+0x23,0x1,0x33,0x13,0x37,0x13,0x13,0x3,0x65,0x73,0xb8,0xfe,0x32,0x9b,0xfe,0x2a,
+0xb9,0x75,0x32,0xc3,0xc0,0x1,0x79,0xfe,0x87,0x5,0xb0,0xfa,0x50,0x1,0x79,0xa1,
+0x2,0x78,0xfd,0x88,0x0,0x3,0x0,0xac,0x0,0x0,0x4,0x60,0x5,0xb0,0x0,0x1b,
+0x0,0x2a,0x0,0x39,0x0,0x0,0x73,0x21,0x36,0x36,0x37,0x36,0x36,0x27,0x34,0x26,
+0x27,0x26,0x26,0x27,0x35,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x26,0x26,
+0x27,0x21,0x13,0x21,0x16,0x16,0x17,0x16,0x16,0x7,0x14,0x6,0x7,0x6,0x6,0x7,
+0x21,0x11,0x11,0x33,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,
+0xac,0x1,0xd2,0x5d,0xaf,0x43,0x43,0x50,0x1,0x27,0x23,0x21,0x66,0x37,0x35,0x4b,
+0x1f,0x1e,0x23,0x1,0x1,0x50,0x43,0x43,0xac,0x5a,0xfe,0x4f,0xba,0x1,0x27,0x3b,
+0x66,0x26,0x26,0x2b,0x1,0x2f,0x28,0x28,0x68,0x3a,0xfe,0xe3,0xfd,0x36,0x67,0x28,
+0x27,0x2f,0x30,0x27,0x27,0x64,0x34,0x1,0x38,0x35,0x34,0x9c,0x66,0x41,0x70,0x2d,
+0x29,0x44,0xd,0x3,0x17,0x34,0x26,0x25,0x5e,0x39,0x66,0x92,0x2f,0x2f,0x2d,0x1,
+0xfc,0xf9,0x2,0x24,0x21,0x22,0x60,0x3e,0x3d,0x60,0x21,0x21,0x25,0x1,0x2,0xa6,
+0x1,0xcf,0x1,0x1a,0x1b,0x1c,0x56,0x3d,0x39,0x56,0x1d,0x1e,0x1f,0x1,0x0,0x1,
+0x0,0x6b,0xff,0xec,0x4,0x5d,0x5,0xc4,0x0,0x3f,0x0,0x0,0x41,0x23,0x6,0x6,
+0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,
+0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x26,0x26,
+0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,
+0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x4,0x5d,0xb9,0x9,
+0x2c,0x25,0x25,0x6b,0x49,0x43,0x64,0x25,0x25,0x30,0xf,0xf,0xd,0xd,0xf,0xf,
+0x31,0x25,0x24,0x65,0x42,0x49,0x6b,0x25,0x25,0x2c,0x9,0xb9,0xc,0x4b,0x3e,0x3e,
+0xac,0x6d,0x5b,0x92,0x39,0x3a,0x53,0x1b,0x1c,0x1b,0x1,0x1,0x1b,0x1c,0x1b,0x53,
+0x3a,0x39,0x93,0x5a,0x69,0xab,0x3f,0x3e,0x4e,0x1,0xb6,0x42,0x71,0x29,0x2a,0x2e,
+0x2b,0x26,0x25,0x62,0x38,0x37,0x73,0x36,0xcd,0x36,0x73,0x37,0x37,0x62,0x25,0x25,
+0x2b,0x31,0x2b,0x2b,0x72,0x42,0x68,0xac,0x3e,0x3d,0x43,0x33,0x2d,0x2d,0x7b,0x48,
+0x48,0x9e,0x51,0xcb,0x51,0x9e,0x48,0x48,0x7a,0x2d,0x2d,0x33,0x43,0x3d,0x3c,0xa9,
+0x0,0x2,0x0,0x9b,0x0,0x0,0x4,0x70,0x5,0xb0,0x0,0x15,0x0,0x2b,0x0,0x0,
+0x73,0x21,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x26,0x26,0x27,0x26,
+0x26,0x27,0x26,0x26,0x27,0x21,0x17,0x33,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,
+0x17,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x23,0x9b,0x1,0x51,0x69,
+0xb5,0x48,0x44,0x6e,0x24,0x23,0x25,0x1,0x27,0x25,0x29,0x89,0x59,0x40,0x97,0x55,
+0xfe,0xaf,0xbc,0x95,0x45,0x74,0x2f,0x42,0x5b,0x1b,0x15,0x15,0x1,0x1,0x14,0x14,
+0x17,0x4f,0x36,0x33,0x83,0x50,0x95,0x1,0x30,0x2d,0x2b,0x7a,0x4b,0x48,0xac,0x60,
+0x6b,0x64,0xb0,0x4a,0x57,0x85,0x29,0x1e,0x21,0x1,0x98,0x1,0x1d,0x1a,0x23,0x71,
+0x46,0x36,0x7d,0x44,0x6d,0x43,0x7b,0x35,0x41,0x69,0x24,0x23,0x26,0x1,0x0,0x1,
+0x0,0xb6,0x0,0x0,0x4,0x34,0x5,0xb0,0x0,0xb,0x0,0x0,0x41,0x35,0x21,0x11,
+0x21,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x3,0xcf,0xfd,0xa0,0x2,0xbc,0xfc,0x8b,
+0x3,0x7e,0xfd,0x3b,0x2,0xa1,0x9d,0x1,0xd4,0x9e,0xfa,0x50,0x9d,0x2,0x4,0x0,
+0x0,0x1,0x0,0xbf,0x0,0x0,0x4,0x3d,0x5,0xb0,0x0,0x9,0x0,0x0,0x41,0x35,
+0x21,0x11,0x21,0x35,0x21,0x11,0x33,0x11,0x3,0xd8,0xfd,0xa2,0x2,0xc3,0xfc,0x82,
+0xbb,0x2,0x83,0x9d,0x1,0xf2,0x9e,0xfa,0x50,0x2,0x83,0x0,0x0,0x1,0x0,0x64,
+0xff,0xeb,0x4,0x5c,0x5,0xc4,0x0,0x43,0x0,0x0,0x65,0x3,0x21,0x15,0x21,0x3,
+0x6,0x6,0x7,0x6,0x6,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x35,
+0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,
+0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x15,
+0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x36,0x37,0x36,0x36,0x4,0x5c,
+0x3,0xfe,0x28,0x1,0x28,0x2,0x17,0x44,0x27,0x27,0x53,0x26,0x42,0x68,0x27,0x28,
+0x38,0x12,0x12,0x11,0x1,0xe,0x10,0x10,0x32,0x26,0x26,0x66,0x42,0x45,0x68,0x26,
+0x25,0x2e,0xb,0xb7,0x9,0x4e,0x40,0x40,0xac,0x66,0x5c,0x94,0x3a,0x3b,0x54,0x1c,
+0x1c,0x1b,0x1,0x1,0x1f,0x1f,0x1e,0x5a,0x3c,0x3c,0x97,0x5a,0x59,0xa2,0x46,0x29,
+0x4c,0xbf,0x2,0x16,0x9c,0xfe,0xb9,0x21,0x29,0xc,0xc,0x8,0x1,0x1,0x2d,0x26,
+0x26,0x64,0x38,0x38,0x75,0x37,0xab,0x36,0x74,0x38,0x38,0x65,0x26,0x26,0x2d,0x2b,
+0x26,0x26,0x6b,0x3f,0x66,0xa5,0x3b,0x3a,0x3f,0x36,0x2e,0x2f,0x7f,0x4a,0x4a,0xa1,
+0x51,0xa9,0x52,0xa1,0x49,0x4a,0x7e,0x2e,0x2f,0x35,0x1,0x1,0x29,0x2a,0x18,0x41,
+0x0,0x1,0x0,0x8d,0x0,0x0,0x4,0x3f,0x5,0xb0,0x0,0xb,0x0,0x0,0x61,0x11,
+0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x4,0x3f,0xaf,0xfd,0xab,0xae,
+0xae,0x2,0x55,0x5,0xb0,0xfd,0x8e,0x2,0x72,0xfa,0x50,0x2,0xa1,0xfd,0x5f,0x0,
+0x0,0x1,0x0,0xae,0x0,0x0,0x4,0x1e,0x5,0xb0,0x0,0xb,0x0,0x0,0x53,0x15,
+0x21,0x11,0x21,0x15,0x21,0x35,0x21,0x11,0x21,0x35,0xae,0x1,0x55,0xfe,0xab,0x3,
+0x70,0xfe,0xa3,0x1,0x5d,0x5,0xb0,0xa1,0xfb,0x91,0xa0,0xa0,0x4,0x6f,0xa1,0x0,
+0x0,0x1,0x0,0x62,0xff,0xec,0x4,0x16,0x5,0xb0,0x0,0x1b,0x0,0x0,0x41,0x11,
+0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x23,0x16,0x16,0x17,
+0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x11,0x3,0x59,0x2,0x27,0x24,0x25,
+0x68,0x42,0x40,0x67,0x25,0x25,0x2b,0x3,0xbc,0x9,0x4a,0x3e,0x3d,0xa7,0x66,0x65,
+0xab,0x3f,0x3f,0x49,0x2,0x5,0xb0,0xfc,0xb,0x3e,0x6f,0x2a,0x2a,0x31,0x2a,0x27,
+0x26,0x68,0x3d,0x65,0xa3,0x39,0x3a,0x3e,0x45,0x3e,0x3d,0xaa,0x65,0x3,0xf5,0x0,
+0x0,0x1,0x0,0xac,0x0,0x0,0x4,0xa4,0x5,0xb0,0x0,0xc,0x0,0x0,0x41,0x1,
+0x33,0x1,0x1,0x23,0x1,0x7,0x11,0x23,0x11,0x33,0x11,0x2,0xb,0x1,0xb8,0xe1,
+0xfd,0xe1,0x1,0xfd,0xe1,0xfe,0x55,0x8d,0xbd,0xbd,0x2,0xa4,0xfd,0x5c,0x3,0x33,
+0x2,0x7d,0xfd,0xe9,0xb0,0x2,0xc7,0xfa,0x50,0x1,0xec,0x0,0x0,0x1,0x0,0xc6,
+0x0,0x0,0x4,0x47,0x5,0xb0,0x0,0x5,0x0,0x0,0x65,0x11,0x23,0x11,0x21,0x35,
+0x1,0x7f,0xb9,0x3,0x81,0x9d,0x5,0x13,0xfa,0x50,0x9d,0x0,0x0,0x1,0x0,0x94,
+0x0,0x0,0x4,0x4c,0x5,0xb0,0x0,0xe,0x0,0x0,0x41,0x23,0x11,0x33,0x11,0x3,
+0x13,0x33,0x1,0x3,0x11,0x33,0x11,0x23,0x1,0x1,0x79,0xe5,0xb4,0xf,0xf7,0x6a,
+0x1,0xd,0xf,0xb4,0xe6,0xff,0x0,0x5,0xb0,0xfa,0x50,0x2,0x45,0x2,0x4b,0xfd,
+0x5,0x3,0x10,0xfd,0xa0,0xfd,0xbb,0x5,0xb0,0xfd,0x28,0x0,0x0,0x1,0x0,0x8f,
+0x0,0x0,0x4,0x3e,0x5,0xb0,0x0,0x9,0x0,0x0,0x61,0x11,0x23,0x3,0x1,0x23,
+0x11,0x33,0x13,0x1,0x4,0x3e,0xbb,0x3,0xfd,0xcb,0xbc,0xbb,0x3,0x2,0x35,0x5,
+0xb0,0xfb,0xc2,0x4,0x3e,0xfa,0x50,0x4,0x40,0xfb,0xc0,0x0,0x0,0x2,0x0,0x6a,
+0xff,0xec,0x4,0x61,0x5,0xc4,0x0,0x25,0x0,0x4b,0x0,0x0,0x41,0x35,0x26,0x26,
+0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,
+0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,
+0x36,0x36,0x27,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,
+0x26,0x26,0x27,0x26,0x26,0x27,0x35,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,
+0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x4,0x61,0x1,0x19,0x1a,0x1b,0x51,0x38,
+0x38,0x92,0x5a,0x5a,0x91,0x38,0x38,0x51,0x1a,0x1b,0x19,0x1,0x1,0x1a,0x1b,0x1a,
+0x52,0x38,0x38,0x91,0x5a,0x5a,0x91,0x38,0x38,0x51,0x1a,0x1a,0x19,0xb6,0x1,0xb,
+0xe,0xf,0x2f,0x23,0x24,0x63,0x41,0x41,0x62,0x24,0x24,0x30,0xf,0xf,0xd,0x1,
+0x1,0xd,0xf,0xe,0x30,0x24,0x24,0x62,0x40,0x41,0x62,0x24,0x24,0x30,0xf,0xe,
+0xc,0x2,0x84,0xa6,0x4e,0xa0,0x4a,0x4a,0x81,0x30,0x30,0x37,0x37,0x30,0x31,0x81,
+0x4a,0x4a,0x9f,0x4e,0xa6,0x4e,0x9e,0x4a,0x4a,0x81,0x30,0x30,0x37,0x37,0x30,0x30,
+0x80,0x4a,0x4a,0x9f,0xf6,0xa8,0x34,0x72,0x37,0x38,0x65,0x26,0x27,0x2e,0x2e,0x27,
+0x26,0x66,0x38,0x37,0x72,0x33,0xa8,0x33,0x71,0x38,0x37,0x65,0x27,0x26,0x2e,0x2d,
+0x26,0x27,0x65,0x37,0x38,0x71,0x0,0x2,0x0,0xbf,0x0,0x0,0x4,0x79,0x5,0xb0,
+0x0,0x10,0x0,0x1f,0x0,0x0,0x41,0x21,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,
+0x27,0x26,0x26,0x27,0x21,0x11,0x33,0x11,0x11,0x21,0x16,0x16,0x17,0x16,0x16,0x15,
+0x14,0x6,0x7,0x6,0x6,0x7,0x1,0x78,0x1,0x1f,0x62,0xaf,0x42,0x42,0x4d,0x4d,
+0x42,0x42,0xaf,0x62,0xfe,0x28,0xb9,0x1,0x1f,0x40,0x6d,0x28,0x27,0x2d,0x2d,0x28,
+0x28,0x6c,0x40,0x2,0x48,0x1,0x3a,0x37,0x37,0xa1,0x69,0x69,0xa2,0x37,0x37,0x3a,
+0x2,0xfa,0x50,0x2,0xe0,0x2,0x38,0x1,0x28,0x25,0x25,0x6a,0x42,0x42,0x67,0x24,
+0x24,0x27,0x1,0x0,0x0,0x2,0x0,0x5e,0xff,0xa,0x4,0x8c,0x5,0xc4,0x0,0x28,
+0x0,0x4e,0x0,0x0,0x41,0x35,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,
+0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x16,
+0x16,0x33,0x32,0x36,0x37,0x5,0x37,0x27,0x36,0x36,0x37,0x36,0x36,0x27,0x15,0x6,
+0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,
+0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,
+0x17,0x16,0x16,0x4,0x6e,0x1,0x1a,0x1a,0x1b,0x53,0x39,0x3a,0x95,0x5d,0x5d,0x95,
+0x39,0x3a,0x52,0x1b,0x1b,0x1a,0x1,0x1,0x1a,0x1b,0x1b,0x54,0x3a,0x39,0x94,0x5d,
+0x24,0x43,0x1f,0x1,0x20,0x7f,0xfb,0x3a,0x53,0x1b,0x1a,0x1a,0xb7,0x1,0xb,0xe,
+0xf,0x30,0x25,0x25,0x67,0x45,0x44,0x67,0x25,0x25,0x31,0xf,0xf,0xd,0xd,0xf,
+0xf,0x31,0x25,0x25,0x66,0x44,0x45,0x67,0x25,0x25,0x31,0xf,0xe,0xb,0x2,0x97,
+0x80,0x50,0xa5,0x4c,0x4c,0x85,0x31,0x31,0x39,0x39,0x31,0x32,0x85,0x4c,0x4c,0xa4,
+0x50,0x80,0x50,0xa3,0x4c,0x4c,0x85,0x31,0x31,0x39,0x9,0x9,0xf4,0x79,0xd1,0x31,
+0x85,0x4c,0x4c,0xa4,0xd3,0x82,0x37,0x77,0x3a,0x3a,0x68,0x27,0x28,0x2f,0x2f,0x28,
+0x28,0x68,0x3a,0x3a,0x77,0x36,0x82,0x36,0x77,0x3a,0x39,0x68,0x28,0x27,0x2f,0x2e,
+0x27,0x28,0x68,0x39,0x3a,0x77,0x0,0x2,0x0,0xb5,0x0,0x0,0x4,0x72,0x5,0xb0,
+0x0,0x14,0x0,0x23,0x0,0x0,0x41,0x1,0x33,0x37,0x1,0x36,0x36,0x37,0x36,0x36,
+0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x21,0x11,0x33,0x11,0x35,0x11,0x33,0x16,0x16,
+0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x2,0x90,0x1,0x1e,0xc3,0x1,
+0xfe,0xcb,0x3c,0x64,0x24,0x24,0x29,0x4d,0x43,0x44,0xb4,0x66,0xfe,0x55,0xb8,0xf3,
+0x43,0x71,0x29,0x29,0x2e,0x30,0x29,0x2a,0x6e,0x3e,0x2,0x52,0xfd,0xae,0xc,0x2,
+0x6e,0x1a,0x4a,0x30,0x30,0x76,0x47,0x6e,0xa3,0x36,0x36,0x36,0x2,0xfa,0x50,0x2,
+0x52,0x98,0x2,0x2e,0x1,0x24,0x23,0x24,0x69,0x46,0x42,0x65,0x23,0x23,0x25,0x1,
+0x0,0x1,0x0,0x76,0xff,0xec,0x4,0x69,0x5,0xc4,0x0,0x49,0x0,0x0,0x41,0x14,
+0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x23,0x16,0x16,0x17,0x16,
+0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,
+0x27,0x26,0x26,0x27,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,
+0x33,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,
+0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x3,0xa8,0x34,0x29,0x29,0x69,0x36,0x44,
+0x73,0x2c,0x2c,0x38,0x9,0xbd,0x3,0x4d,0x42,0x4a,0xc9,0x68,0x57,0xae,0x45,0x45,
+0x57,0x51,0x42,0x43,0xa2,0x51,0x31,0x6f,0x2f,0x30,0x3e,0x1,0x2f,0x28,0x27,0x65,
+0x35,0x42,0x69,0x26,0x26,0x2e,0x8,0xbe,0x2,0x52,0x44,0x44,0xb0,0x5f,0x56,0xaa,
+0x43,0x43,0x53,0x53,0x42,0x41,0x9f,0x4d,0x35,0x73,0x30,0x30,0x3d,0x1,0x70,0x3c,
+0x57,0x1c,0x1d,0x1b,0x25,0x25,0x24,0x69,0x44,0x5e,0x99,0x39,0x42,0x46,0x31,0x31,
+0x30,0x92,0x62,0x61,0x94,0x33,0x37,0x47,0x19,0xf,0x28,0x1e,0x1e,0x57,0x3f,0x3a,
+0x58,0x1e,0x1e,0x1e,0x29,0x25,0x25,0x67,0x3f,0x64,0xa2,0x39,0x39,0x3f,0x35,0x33,
+0x33,0x94,0x5e,0x5e,0x8b,0x33,0x32,0x47,0x19,0x11,0x2a,0x1f,0x20,0x5c,0x0,0x1,
+0x0,0x4c,0x0,0x0,0x4,0x84,0x5,0xb0,0x0,0x7,0x0,0x0,0x41,0x35,0x21,0x15,
+0x21,0x11,0x33,0x11,0x4,0x84,0xfb,0xc8,0x1,0xc2,0xb4,0x5,0x12,0x9e,0x9e,0xfa,
+0xee,0x5,0x12,0x0,0x0,0x1,0x0,0x8b,0xff,0xec,0x4,0x42,0x5,0xb0,0x0,0x1d,
+0x0,0x0,0x41,0x23,0x3,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,
+0x27,0x3,0x23,0x3,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,
+0x4,0x40,0xb3,0x3,0x2,0x26,0x24,0x25,0x6c,0x47,0x47,0x6d,0x24,0x25,0x27,0x1,
+0x4,0xb0,0x2,0x1,0x46,0x3e,0x3e,0xae,0x6a,0x68,0xae,0x3f,0x3f,0x48,0x5,0xb0,
+0xfc,0x26,0x41,0x78,0x2e,0x2f,0x37,0x38,0x2e,0x2e,0x78,0x41,0x3,0xda,0xfc,0x26,
+0x66,0xb3,0x42,0x43,0x4c,0x4d,0x43,0x42,0xb2,0x66,0x0,0x1,0x0,0x47,0x0,0x0,
+0x4,0x7f,0x5,0xb0,0x0,0x8,0x0,0x0,0x61,0x33,0x1,0x23,0x1,0x7,0x27,0x1,
+0x23,0x2,0x13,0xa1,0x1,0xcb,0xc5,0xfe,0xbe,0x16,0x15,0xfe,0xc0,0xc6,0x5,0xb0,
+0xfb,0xc3,0x49,0x47,0x4,0x3f,0x0,0x1,0x0,0x49,0x0,0x0,0x4,0x9e,0x5,0xb0,
+0x0,0x12,0x0,0x0,0x73,0x33,0x13,0x37,0x17,0x13,0x33,0x13,0x23,0x3,0x7,0x27,
+0x3,0x23,0x3,0x7,0x27,0x3,0x23,0xfa,0xbe,0xb2,0xb,0xa,0xb1,0xbd,0xb1,0xaf,
+0x69,0x6,0xb,0xb1,0xa1,0xb0,0xb,0x6,0x69,0xb0,0x4,0xb,0x3e,0x3d,0xfb,0xf4,
+0x5,0xb0,0xfc,0x16,0x3c,0x3b,0x3,0xeb,0xfc,0x16,0x3c,0x3a,0x3,0xec,0x0,0x1,
+0x0,0x57,0x0,0x0,0x4,0x8f,0x5,0xb0,0x0,0xb,0x0,0x0,0x41,0x1,0x23,0x1,
+0x1,0x33,0x1,0x1,0x33,0x1,0x1,0x23,0x2,0x71,0xfe,0xca,0xd9,0x1,0xa7,0xfe,
+0x4e,0xdb,0x1,0x43,0x1,0x42,0xd8,0xfe,0x4f,0x1,0xa7,0xda,0x3,0x75,0x2,0x3b,
+0xfd,0x2e,0xfd,0x22,0x2,0x46,0xfd,0xba,0x2,0xde,0x2,0xd2,0x0,0x1,0x0,0x3d,
+0x0,0x0,0x4,0x79,0x5,0xb0,0x0,0x8,0x0,0x0,0x41,0x1,0x23,0x1,0x13,0x33,
+0x13,0x1,0x23,0x2,0x5b,0xfe,0xb5,0xd3,0x1,0xc5,0x3,0xac,0x3,0x1,0xc5,0xd2,
+0x2,0xd5,0x2,0xdb,0xfc,0x6f,0xfd,0xe1,0x2,0x1f,0x3,0x91,0x0,0x1,0x0,0x72,
+0x0,0x0,0x4,0x37,0x5,0xb0,0x0,0x9,0x0,0x0,0x65,0x1,0x27,0x21,0x15,0x21,
+0x1,0x17,0x21,0x35,0x1,0x45,0x2,0xd7,0x2,0xfc,0x65,0x2,0xc8,0xfd,0x2b,0x2,
+0x3,0xc3,0x9d,0x4,0x86,0x8d,0x9e,0xfb,0x7e,0x90,0x9d,0x0,0x0,0x2,0x0,0x9c,
+0xff,0xec,0x4,0x36,0x4,0x4e,0x0,0x35,0x0,0x49,0x0,0x0,0x61,0x33,0x35,0x26,
+0x26,0x35,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x33,
+0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x23,0x22,0x6,
+0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,
+0x16,0x16,0x25,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x33,
+0x15,0x6,0x6,0x7,0x6,0x6,0x3,0x75,0xc1,0x12,0x14,0x42,0x39,0x3a,0x9e,0x5c,
+0x65,0x9f,0x37,0x38,0x3b,0x1,0xba,0x21,0x1e,0x1e,0x57,0x37,0x3b,0x5f,0x21,0x21,
+0x24,0xca,0x71,0xb7,0x41,0x41,0x47,0x35,0x31,0x30,0x8b,0x56,0x35,0x5e,0x2a,0x29,
+0x45,0x1c,0x3,0xd,0xfe,0xc4,0x36,0x52,0x1b,0x1b,0x1b,0x1f,0x1e,0x2a,0x8f,0x60,
+0xac,0x10,0x38,0x26,0x27,0x5e,0x10,0x2d,0x79,0x36,0x1,0xf7,0x5b,0x88,0x2e,0x2d,
+0x2d,0x38,0x2d,0x2e,0x72,0x3b,0x22,0x3f,0x17,0x17,0x1c,0x1e,0x1b,0x1c,0x4e,0x31,
+0x55,0x2c,0x2c,0x2d,0x86,0x59,0x44,0x75,0x2a,0x2b,0x32,0x16,0x13,0x13,0x32,0x1c,
+0x22,0x3f,0x78,0x1c,0x19,0x18,0x44,0x28,0x2a,0x42,0x18,0x22,0x21,0xdb,0x20,0x3b,
+0x17,0x17,0x1c,0x0,0x0,0x2,0x0,0xaf,0xff,0xec,0x4,0x43,0x6,0x0,0x0,0x23,
+0x0,0x43,0x0,0x0,0x41,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,
+0x6,0x7,0x6,0x6,0x7,0x11,0x23,0x11,0x33,0x37,0x16,0x16,0x17,0x16,0x16,0x33,
+0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x27,0x15,0x14,0x6,0x7,0x6,0x6,0x7,
+0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x11,0x36,0x36,0x37,0x36,0x36,0x33,
+0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x4,0x43,0x1c,0x1b,0x1a,0x44,0x2b,0x30,
+0x76,0x46,0x38,0x60,0x28,0x20,0x38,0x17,0xb9,0xaa,0x9,0x12,0x28,0x16,0x2e,0x73,
+0x46,0x3d,0x69,0x2c,0x3d,0x57,0x1b,0x14,0x15,0xb9,0xc,0xd,0x10,0x36,0x28,0x1e,
+0x4c,0x2e,0x30,0x50,0x20,0x20,0x31,0x12,0x11,0x31,0x20,0x1f,0x50,0x30,0x2c,0x48,
+0x1d,0x2a,0x3a,0x12,0xd,0xd,0x2,0x11,0x15,0x55,0x99,0x3f,0x38,0x5b,0x20,0x22,
+0x26,0x16,0x15,0x11,0x2f,0x1d,0x2,0x3a,0xfa,0x0,0x7b,0x17,0x26,0x10,0x20,0x22,
+0x1e,0x1b,0x27,0x77,0x4b,0x39,0x83,0x5c,0x15,0x30,0x5c,0x28,0x35,0x56,0x1c,0x16,
+0x17,0x19,0x17,0x17,0x3d,0x24,0x1,0xd9,0x24,0x3d,0x17,0x16,0x19,0x14,0x12,0x19,
+0x58,0x35,0x2b,0x61,0x0,0x1,0x0,0x8f,0xff,0xec,0x4,0x33,0x4,0x4e,0x0,0x33,
+0x0,0x0,0x65,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,
+0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,
+0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,
+0x23,0x6,0x6,0x7,0x6,0x6,0x2,0x7b,0x57,0x75,0x23,0x24,0x1f,0x1f,0x24,0x24,
+0x75,0x56,0x38,0x61,0x23,0x23,0x29,0x1,0xaf,0x42,0x3a,0x3b,0xa1,0x60,0x7b,0xb8,
+0x3d,0x3e,0x3e,0x3e,0x3e,0x3d,0xb8,0x7b,0x56,0x9e,0x3d,0x3d,0x49,0x1,0xaf,0x1,
+0x2d,0x25,0x25,0x5f,0x82,0x45,0x38,0x37,0x8b,0x47,0x2a,0x46,0x8a,0x38,0x37,0x45,
+0x26,0x21,0x21,0x57,0x31,0x52,0x90,0x35,0x34,0x3d,0x58,0x4a,0x4b,0xc4,0x6b,0x2a,
+0x6c,0xc3,0x4a,0x4b,0x58,0x3b,0x32,0x31,0x83,0x48,0x2d,0x4d,0x1c,0x1d,0x20,0x0,
+0x0,0x2,0x0,0x8b,0xff,0xec,0x4,0x1c,0x6,0x0,0x0,0x17,0x0,0x2b,0x0,0x0,
+0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x17,0x33,0x11,0x23,0x11,
+0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,
+0x32,0x16,0x17,0x11,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x8b,0x3e,0x38,0x38,
+0x9f,0x62,0x64,0x96,0x36,0x8,0xaa,0xb9,0x35,0x91,0x61,0x63,0xa0,0x38,0x39,0x3d,
+0xb9,0x22,0x24,0x23,0x6f,0x4e,0x5b,0x7a,0x24,0x24,0x7a,0x5d,0x4d,0x6e,0x23,0x24,
+0x22,0x2,0x26,0x15,0x74,0xc9,0x4a,0x4a,0x54,0x44,0x42,0x72,0x6,0x0,0xfd,0xcf,
+0x3e,0x41,0x52,0x49,0x49,0xcb,0x8e,0x15,0x4f,0x8f,0x37,0x36,0x40,0x55,0x42,0xfe,
+0xa,0x47,0x54,0x3f,0x36,0x36,0x8e,0x0,0x0,0x2,0x0,0x87,0xff,0xec,0x4,0x45,
+0x4,0x4e,0x0,0x22,0x0,0x30,0x0,0x0,0x45,0x32,0x36,0x37,0x27,0x6,0x6,0x23,
+0x22,0x26,0x27,0x26,0x26,0x27,0x35,0x21,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,
+0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x13,0x32,0x16,0x17,0x16,
+0x16,0x15,0x15,0x21,0x36,0x36,0x37,0x36,0x36,0x2,0x8c,0x9e,0xd7,0x36,0x71,0x33,
+0x9a,0x63,0x4b,0x7c,0x2c,0x2b,0x31,0x7,0x3,0x5,0x39,0x3a,0x3a,0xaf,0x75,0x5d,
+0xb1,0x45,0x46,0x54,0x4c,0x44,0x44,0xbf,0x5a,0x47,0x67,0x22,0x22,0x26,0xfd,0xba,
+0xb,0x37,0x28,0x28,0x64,0x14,0x7f,0x52,0x58,0x42,0x50,0x38,0x31,0x2e,0x78,0x4f,
+0x7,0x53,0x71,0xc2,0x48,0x47,0x51,0x4c,0x47,0x48,0xcf,0x83,0x2a,0x71,0xc0,0x46,
+0x46,0x4e,0x3,0xca,0x34,0x2a,0x2a,0x73,0x32,0x9,0x4b,0x73,0x28,0x27,0x29,0x0,
+0x0,0x1,0x0,0x98,0x0,0x0,0x4,0x6b,0x6,0x2b,0x0,0x20,0x0,0x0,0x61,0x33,
+0x11,0x21,0x35,0x21,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x37,0x26,
+0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x21,0x15,0x21,0x1,
+0xc2,0xba,0x1,0xa1,0xfe,0x5f,0x23,0x22,0x20,0x61,0x3f,0x3e,0x6d,0x29,0x16,0x1a,
+0x32,0x19,0x26,0x4e,0x28,0x60,0x9c,0x37,0x38,0x3d,0xfe,0xd6,0x1,0x2a,0x3,0xab,
+0x8f,0x4c,0x44,0x66,0x20,0x1f,0x1f,0x15,0xe,0x99,0x7,0xb,0x5,0x7,0x9,0x36,
+0x35,0x35,0x9d,0x68,0x4c,0x8f,0x0,0x2,0x0,0x8c,0xfe,0x56,0x4,0x1d,0x4,0x4e,
+0x0,0x35,0x0,0x4f,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,
+0x37,0x36,0x36,0x37,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,
+0x27,0x7,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x23,
+0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,
+0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x11,0x6,0x6,0x7,0x6,0x6,
+0x23,0x22,0x26,0x27,0x26,0x26,0x8c,0x3c,0x38,0x37,0xa0,0x63,0x3b,0x66,0x2a,0x1b,
+0x2f,0x15,0x28,0x25,0x26,0x6a,0x42,0x25,0x4a,0x25,0x25,0x48,0x22,0x60,0x25,0x67,
+0x38,0x37,0x6c,0x2a,0x66,0xa8,0x3d,0x3c,0x43,0xa8,0x9,0x13,0x2b,0x18,0x2c,0x6d,
+0x41,0x65,0xa0,0x38,0x38,0x3b,0xb9,0x21,0x24,0x23,0x6f,0x4e,0x2e,0x4c,0x1f,0x1f,
+0x30,0x12,0x12,0x30,0x1e,0x1f,0x4d,0x30,0x4d,0x6e,0x23,0x24,0x21,0x2,0x26,0x15,
+0x74,0xc9,0x4a,0x4a,0x54,0x19,0x17,0xf,0x28,0x18,0x5d,0x46,0x6c,0x24,0x25,0x26,
+0xf,0x11,0x11,0x39,0x29,0x6f,0x35,0x48,0x15,0x16,0x13,0x3c,0x3a,0x3a,0xa6,0x6b,
+0x4,0x23,0x76,0x18,0x28,0xf,0x1d,0x1e,0x52,0x49,0x49,0xcb,0x8e,0x15,0x4f,0x8f,
+0x37,0x36,0x40,0x17,0x14,0x15,0x38,0x22,0xfe,0x10,0x23,0x3a,0x15,0x15,0x17,0x3f,
+0x36,0x36,0x8e,0x0,0x0,0x1,0x0,0xae,0x0,0x0,0x4,0x2c,0x6,0x0,0x0,0x1f,
+0x0,0x0,0x41,0x11,0x23,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x36,0x16,
+0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,
+0x6,0x6,0x1,0x67,0xb9,0xb9,0x14,0x33,0x1e,0x26,0x5a,0x32,0x3d,0x5e,0x1f,0x1d,
+0x1e,0xb9,0x35,0x31,0x31,0x8b,0x55,0x41,0x73,0x30,0x1e,0x36,0x3,0x99,0x2,0x67,
+0xfa,0x0,0x3,0x12,0x20,0x35,0x14,0x1a,0x1c,0x1,0x23,0x23,0x20,0x61,0x40,0xfd,
+0x55,0x2,0xa9,0x6d,0x9f,0x34,0x34,0x31,0x1,0x24,0x23,0x15,0x37,0x0,0x0,0x2,
+0x0,0xcb,0x0,0x0,0x4,0x55,0x5,0xc3,0x0,0x9,0x0,0x1b,0x0,0x0,0x53,0x15,
+0x21,0x11,0x21,0x15,0x21,0x35,0x21,0x11,0x3,0x14,0x16,0x33,0x32,0x36,0x35,0x34,
+0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0xcb,0x1,0x70,0xfe,0x90,0x3,
+0x8a,0xfe,0x9f,0xd1,0x37,0x38,0x37,0x38,0x10,0x10,0xd,0x28,0x1a,0x1a,0x29,0xd,
+0x10,0xf,0x4,0x3a,0xa1,0xfd,0x7,0xa0,0xa0,0x3,0x9a,0x1,0x1c,0x2d,0x3c,0x3c,
+0x2d,0x19,0x2a,0xe,0xd,0xf,0xf,0xd,0xf,0x2a,0x0,0x2,0x0,0xd3,0xfe,0x4b,
+0x3,0x58,0x5,0xc3,0x0,0x1d,0x0,0x29,0x0,0x0,0x41,0x15,0x21,0x11,0x14,0x6,
+0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x17,0x16,0x16,
+0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x3,0x14,0x16,0x33,0x32,0x36,0x35,0x34,
+0x26,0x23,0x22,0x6,0x1,0x2b,0x1,0x69,0x27,0x22,0x22,0x5c,0x34,0xe,0x31,0x1a,
+0x1b,0x34,0x11,0xd,0x19,0x2e,0x17,0x1c,0x3a,0x1f,0x64,0x9d,0x37,0x36,0x39,0xd3,
+0x36,0x38,0x38,0x38,0x38,0x38,0x38,0x36,0x4,0x3a,0xa1,0xfc,0x60,0x4d,0x69,0x20,
+0x20,0x1b,0x1,0x2,0x1,0x5,0x3,0x98,0x4,0x7,0x2,0x2,0x2,0x39,0x37,0x36,
+0xa0,0x68,0x4,0x41,0x1,0x1d,0x2d,0x3d,0x3d,0x2d,0x2d,0x3f,0x3f,0x0,0x0,0x1,
+0x0,0xb0,0x0,0x0,0x4,0x6a,0x6,0x0,0x0,0xc,0x0,0x0,0x41,0x1,0x33,0x1,
+0x1,0x23,0x1,0x7,0x11,0x23,0x11,0x33,0x11,0x1,0xf2,0x1,0x8d,0xeb,0xfe,0x7,
+0x1,0xb6,0xe1,0xfe,0x9d,0x79,0xba,0xba,0x1,0xf9,0xfe,0x7,0x2,0x77,0x1,0xc3,
+0xfe,0x9c,0x82,0x3,0xac,0xfa,0x0,0x1,0x76,0x0,0x0,0x1,0x0,0xcb,0x0,0x0,
+0x4,0x55,0x6,0x0,0x0,0x9,0x0,0x0,0x53,0x15,0x21,0x11,0x21,0x15,0x21,0x35,
+0x21,0x11,0xcb,0x1,0x70,0xfe,0x90,0x3,0x8a,0xfe,0x9f,0x6,0x0,0xa1,0xfb,0x41,
+0xa0,0xa0,0x5,0x60,0x0,0x1,0x0,0x5d,0x0,0x0,0x4,0x72,0x4,0x4e,0x0,0x3a,
+0x0,0x0,0x41,0x23,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,
+0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x34,0x35,0x36,0x36,0x37,0x36,0x36,0x33,0x32,
+0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x6,0x6,
+0x7,0x6,0x6,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,0x1,0x3,0xa6,
+0xb0,0x6,0x13,0xd,0x11,0x31,0x21,0x1e,0x2d,0xf,0x10,0xf,0xb0,0x3,0x12,0x10,
+0x10,0x30,0x21,0x1f,0x2f,0x10,0xf,0x10,0xb0,0x24,0x22,0x1f,0x5a,0x38,0x29,0x45,
+0x1c,0x16,0x26,0xe,0xb,0x1f,0x13,0x1a,0x45,0x2b,0x4c,0x6b,0x21,0x4,0x3a,0xfb,
+0xc6,0x3,0x5d,0x10,0x1c,0xb,0xe,0xf,0xf,0x10,0x11,0x34,0x22,0xfc,0xd5,0x3,
+0x2a,0x6,0x9,0x5,0x19,0x29,0x10,0xf,0x12,0x10,0x10,0x11,0x34,0x22,0xfc,0xd6,
+0x3,0x28,0x4e,0x73,0x24,0x20,0x21,0x1,0x14,0x11,0xf,0x28,0x17,0x19,0x28,0xe,
+0x12,0x13,0x1,0x40,0x39,0x0,0x0,0x1,0x0,0xae,0x0,0x0,0x4,0x29,0x4,0x4e,
+0x0,0x1f,0x0,0x0,0x73,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,
+0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,0x6,
+0x6,0x7,0x27,0x23,0xae,0xb9,0x13,0x33,0x1e,0x25,0x58,0x33,0x3b,0x5b,0x20,0x1f,
+0x20,0xb9,0x35,0x31,0x31,0x8b,0x55,0x3f,0x71,0x30,0x20,0x39,0x18,0xd,0xa6,0x3,
+0x8,0x23,0x3a,0x16,0x19,0x1d,0x1c,0x1f,0x1f,0x64,0x48,0xfd,0x55,0x2,0xaf,0x6c,
+0x9d,0x33,0x33,0x30,0x1,0x23,0x20,0x15,0x39,0x22,0xa0,0x0,0x0,0x2,0x0,0x7a,
+0xff,0xec,0x4,0x52,0x4,0x4e,0x0,0x19,0x0,0x33,0x0,0x0,0x53,0x15,0x14,0x16,
+0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,
+0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,
+0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,
+0x7a,0x44,0x40,0x3f,0xb7,0x73,0x72,0xb6,0x40,0x3f,0x44,0x44,0x3f,0x40,0xb7,0x73,
+0x72,0xb6,0x3f,0x40,0x44,0xb9,0x26,0x27,0x26,0x72,0x4d,0x4d,0x73,0x27,0x26,0x27,
+0x26,0x26,0x27,0x73,0x4c,0x4d,0x74,0x26,0x27,0x26,0x2,0x27,0x16,0x75,0xc8,0x4a,
+0x4a,0x54,0x54,0x4a,0x4a,0xc8,0x75,0x16,0x75,0xc9,0x4a,0x4a,0x55,0x55,0x4a,0x4a,
+0xc9,0x8b,0x16,0x4f,0x91,0x37,0x37,0x41,0x41,0x37,0x37,0x91,0x4f,0x16,0x50,0x91,
+0x37,0x37,0x40,0x40,0x37,0x37,0x91,0x0,0x0,0x2,0x0,0xad,0xfe,0x60,0x4,0x3f,
+0x4,0x4e,0x0,0x1d,0x0,0x37,0x0,0x0,0x53,0x33,0x11,0x16,0x16,0x17,0x16,0x16,
+0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,
+0x7,0x6,0x6,0x7,0x27,0x23,0x1,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,
+0x27,0x26,0x26,0x27,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,
+0xad,0xb9,0x14,0x2e,0x1a,0x2b,0x6b,0x3e,0x66,0x9f,0x36,0x36,0x38,0x38,0x36,0x36,
+0xa0,0x68,0x3b,0x67,0x2a,0x1e,0x34,0x16,0x9,0xa9,0x2,0xd9,0x23,0x24,0x24,0x70,
+0x4d,0x30,0x4f,0x20,0x1c,0x2c,0x11,0x13,0x32,0x20,0x1d,0x49,0x2b,0x4e,0x70,0x25,
+0x24,0x23,0xfe,0x60,0x2,0x8,0x16,0x25,0xf,0x18,0x1a,0x54,0x4a,0x4a,0xc9,0x74,
+0x15,0x79,0xcb,0x49,0x49,0x52,0x19,0x18,0x10,0x2d,0x1c,0x76,0xfd,0xec,0x15,0x4f,
+0x90,0x37,0x37,0x41,0x18,0x15,0x12,0x34,0x1e,0x2,0x9,0x22,0x38,0x13,0x13,0x14,
+0x40,0x36,0x37,0x8f,0x0,0x2,0x0,0x8c,0xfe,0x60,0x4,0x1c,0x4,0x4e,0x0,0x1d,
+0x0,0x37,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,
+0x36,0x37,0x11,0x33,0x11,0x23,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,
+0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,
+0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x8c,0x3b,0x38,0x38,
+0xa1,0x67,0x35,0x5c,0x27,0x1f,0x35,0x18,0xb9,0xaa,0x8,0x15,0x30,0x1b,0x2a,0x65,
+0x3a,0x68,0xa3,0x38,0x38,0x3a,0xb9,0x23,0x25,0x24,0x70,0x4d,0x2b,0x49,0x1f,0x1e,
+0x31,0x13,0x14,0x32,0x20,0x1e,0x48,0x2b,0x4d,0x6f,0x24,0x24,0x23,0x2,0x26,0x15,
+0x74,0xc9,0x4a,0x4a,0x54,0x14,0x13,0xe,0x28,0x19,0xfd,0xfe,0x5,0xda,0x6b,0x18,
+0x28,0xf,0x18,0x18,0x52,0x49,0x49,0xcb,0x8e,0x15,0x4f,0x90,0x38,0x37,0x42,0x15,
+0x13,0x13,0x33,0x1f,0xfd,0xea,0x21,0x37,0x13,0x11,0x14,0x41,0x37,0x37,0x90,0x0,
+0x0,0x1,0x1,0x49,0x0,0x0,0x4,0x31,0x4,0x4e,0x0,0x15,0x0,0x0,0x41,0x22,
+0x6,0x7,0x27,0x27,0x23,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,
+0x17,0x37,0x26,0x26,0x3,0x73,0x76,0xb9,0x42,0x1,0x8,0xb0,0xba,0x12,0x37,0x25,
+0x29,0x6e,0x44,0x35,0x61,0x36,0x19,0x1c,0x6f,0x4,0x4e,0x67,0x59,0x1b,0x91,0xfb,
+0xc6,0x2,0xb6,0x32,0x51,0x1c,0x20,0x21,0xb,0xc,0xb5,0xc,0xe,0x0,0x0,0x1,
+0x0,0xaf,0xff,0xec,0x4,0x36,0x4,0x4e,0x0,0x49,0x0,0x0,0x41,0x14,0x6,0x7,
+0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x23,0x14,0x16,0x17,0x16,0x16,0x33,
+0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,
+0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x34,
+0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,
+0x17,0x16,0x16,0x17,0x16,0x16,0x3,0x7d,0x14,0x13,0x1f,0x6e,0x4a,0x2f,0x60,0x27,
+0x28,0x35,0x4,0xb9,0x3f,0x3c,0x3b,0xac,0x6e,0x60,0xa2,0x3a,0x3a,0x41,0x39,0x36,
+0x36,0x9e,0x64,0x4c,0x63,0x1d,0x1e,0x18,0x1e,0x1e,0x1d,0x59,0x3b,0x39,0x5b,0x20,
+0x20,0x24,0xb9,0x3d,0x38,0x38,0xa0,0x64,0x5d,0x9b,0x38,0x38,0x3e,0x3c,0x37,0x36,
+0x99,0x5d,0x4c,0x66,0x1f,0x1f,0x1a,0x1,0x1f,0x1a,0x2e,0x13,0x1f,0x23,0x14,0x18,
+0x18,0x4e,0x39,0x45,0x80,0x30,0x31,0x3b,0x2e,0x2a,0x2a,0x76,0x48,0x43,0x66,0x27,
+0x26,0x37,0x15,0xf,0x20,0x14,0x14,0x32,0x20,0x1f,0x3a,0x16,0x16,0x1a,0x20,0x1a,
+0x1a,0x43,0x23,0x47,0x7b,0x2e,0x2e,0x34,0x32,0x2b,0x2b,0x73,0x42,0x43,0x65,0x25,
+0x26,0x36,0x13,0xf,0x25,0x16,0x16,0x35,0x0,0x1,0x0,0x8e,0xff,0xec,0x4,0x29,
+0x5,0x40,0x0,0x23,0x0,0x0,0x41,0x23,0x11,0x21,0x15,0x21,0x11,0x14,0x16,0x17,
+0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x23,
+0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x21,0x35,0x21,0x2,0x64,0xba,0xfe,0xe4,0x1,
+0x1c,0x35,0x2e,0x2e,0x7d,0x48,0x2b,0x57,0x27,0x27,0x42,0x17,0x1a,0x11,0x35,0x1e,
+0x1f,0x40,0x1e,0x29,0x49,0x1c,0x1c,0x20,0x1,0x9c,0xfe,0x64,0x5,0x40,0xfe,0xfa,
+0x8f,0xfd,0xb4,0x64,0x8d,0x2c,0x2d,0x29,0x8,0x8,0x7,0x15,0xe,0x83,0x4,0xb,
+0x5,0x5,0x7,0x14,0x19,0x18,0x52,0x3f,0x2,0x4c,0x8f,0x0,0x0,0x1,0x0,0xb4,
+0xff,0xec,0x4,0x1f,0x4,0x3a,0x0,0x1c,0x0,0x0,0x61,0x33,0x11,0x23,0x11,0x6,
+0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x16,
+0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x3,0x77,0xa8,0xba,0xf,0x2d,0x1e,0x24,0x62,
+0x3e,0x35,0x51,0x1c,0x1c,0x1c,0xb9,0x35,0x31,0x31,0x8a,0x55,0x6a,0xa2,0x36,0x4,
+0x3a,0xfc,0xf8,0x23,0x3b,0x15,0x1a,0x1d,0x1c,0x23,0x22,0x74,0x58,0x2,0x85,0xfd,
+0x7d,0x79,0xad,0x38,0x38,0x35,0x59,0x50,0x0,0x1,0x0,0x62,0x0,0x0,0x4,0x65,
+0x4,0x3a,0x0,0x8,0x0,0x0,0x61,0x33,0x1,0x23,0x1,0x7,0x27,0x1,0x23,0x2,
+0x1f,0x8d,0x1,0xb9,0xbd,0xfe,0xd1,0x12,0x11,0xfe,0xca,0xbe,0x4,0x3a,0xfc,0xd0,
+0x43,0x43,0x3,0x30,0x0,0x1,0x0,0x30,0x0,0x0,0x4,0xa7,0x4,0x3a,0x0,0x12,
+0x0,0x0,0x61,0x33,0x13,0x37,0x17,0x13,0x33,0x13,0x23,0x3,0x7,0x27,0x3,0x23,
+0x3,0x7,0x27,0x3,0x23,0x1,0x16,0x92,0xa7,0x1b,0x1c,0xa9,0x92,0xe6,0xa4,0x78,
+0x1b,0x1d,0xac,0x77,0xad,0x1b,0x16,0x7e,0xa4,0x2,0x97,0xa8,0xa8,0xfd,0x69,0x4,
+0x3a,0xfd,0x4e,0xaa,0xaa,0x2,0xb2,0xfd,0x4e,0x9b,0x9b,0x2,0xb2,0x0,0x0,0x1,
+0x0,0x6e,0x0,0x0,0x4,0x72,0x4,0x3a,0x0,0xb,0x0,0x0,0x41,0x1,0x23,0x1,
+0x1,0x33,0x1,0x1,0x33,0x1,0x1,0x23,0x2,0x6d,0xfe,0xe2,0xd6,0x1,0x93,0xfe,
+0x62,0xd8,0x1,0x2b,0x1,0x2b,0xd6,0xfe,0x62,0x1,0x93,0xd9,0x2,0xa9,0x1,0x91,
+0xfd,0xe9,0xfd,0xdd,0x1,0x9c,0xfe,0x64,0x2,0x23,0x2,0x17,0x0,0x1,0x0,0x44,
+0xfe,0x4b,0x4,0x85,0x4,0x3a,0x0,0x1b,0x0,0x0,0x41,0x32,0x36,0x37,0x36,0x36,
+0x37,0x1,0x23,0x1,0x7,0x27,0x1,0x23,0x1,0x7,0x6,0x6,0x7,0x6,0x6,0x23,
+0x22,0x26,0x27,0x7,0x16,0x16,0x1,0x5,0x49,0x70,0x2a,0x2a,0x3b,0x13,0x2,0x25,
+0xcf,0xfe,0xe9,0x33,0x30,0xfe,0xd7,0xcf,0x1,0xd2,0x4a,0xa,0x23,0x18,0x19,0x3f,
+0x26,0xe,0x31,0x19,0x1e,0x12,0x46,0xfe,0x4b,0x36,0x28,0x28,0x5e,0x2a,0x4,0xe1,
+0xfd,0x42,0x7f,0x83,0x2,0xba,0xfb,0xf9,0x90,0x14,0x3e,0x1d,0x1d,0x2a,0x3,0x2,
+0x97,0x4,0xc,0x0,0x0,0x1,0x0,0xa0,0x0,0x0,0x4,0x3d,0x4,0x3a,0x0,0x9,
+0x0,0x0,0x65,0x1,0x35,0x21,0x15,0x21,0x1,0x15,0x21,0x35,0x1,0x8c,0x2,0x8d,
+0xfc,0x90,0x2,0x7d,0xfd,0x7a,0x3,0x9d,0x97,0x3,0x20,0x83,0x99,0xfc,0xe7,0x88,
+0x97,0x0,0x0,0x3,0x0,0x91,0xff,0xec,0x4,0x40,0x5,0xc5,0x0,0x19,0x0,0x2a,
+0x0,0x3b,0x0,0x0,0x41,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,
+0x6,0x15,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x25,0x34,
+0x34,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x13,
+0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x1,0x14,0x14,0x15,
+0x4,0x40,0x40,0x3c,0x3d,0xaf,0x70,0x6f,0xaf,0x3c,0x3d,0x40,0x40,0x3d,0x3d,0xb0,
+0x6f,0x70,0xae,0x3c,0x3c,0x40,0xfd,0xb,0x29,0x2a,0x23,0x65,0x42,0x41,0x63,0x22,
+0x23,0x29,0x8,0x4,0x2b,0x2e,0x22,0x62,0x3f,0x3c,0x60,0x22,0x25,0x2e,0x9,0x2,
+0x36,0x2,0x2d,0x1,0x55,0x8b,0xd7,0x4a,0x4a,0x4d,0x4d,0x4a,0x4a,0xd7,0x8b,0xfe,
+0xab,0x8b,0xd7,0x49,0x4b,0x4b,0x4c,0x4a,0x49,0xd7,0xb0,0x1a,0x32,0x19,0xf4,0x66,
+0x9b,0x31,0x27,0x29,0x26,0x26,0x25,0x6f,0x48,0xfe,0x1,0x6b,0x9e,0x31,0x24,0x26,
+0x23,0x22,0x24,0x6f,0x49,0x1,0xb1,0x1c,0x55,0xf,0x0,0x1,0x0,0xd0,0x0,0x0,
+0x3,0x6,0x5,0xb0,0x0,0x6,0x0,0x0,0x61,0x11,0x23,0x5,0x15,0x25,0x11,0x3,
+0x6,0xf,0xfd,0xd9,0x1,0x7d,0x5,0xb0,0xd4,0xa9,0x91,0xfb,0x3c,0x0,0x0,0x1,
+0x0,0x55,0x0,0x0,0x4,0x2b,0x5,0xc4,0x0,0x2a,0x0,0x0,0x61,0x35,0x21,0x1,
+0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,
+0x6,0x15,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,
+0x6,0x7,0x6,0x6,0x7,0x1,0x15,0x4,0x2b,0xfd,0x25,0x1,0x87,0x37,0x63,0x26,
+0x25,0x2c,0x3d,0x39,0x39,0xa5,0x67,0x70,0xaf,0x3c,0x3d,0x40,0xba,0x23,0x24,0x23,
+0x6b,0x49,0x3c,0x5f,0x22,0x21,0x23,0x16,0x1a,0x1a,0x56,0x40,0xfe,0x23,0x97,0x1,
+0xa8,0x3c,0x79,0x3e,0x3e,0x7f,0x41,0x57,0x94,0x36,0x36,0x3d,0x48,0x3d,0x3d,0xa3,
+0x5c,0x44,0x6e,0x27,0x26,0x2a,0x29,0x23,0x23,0x5f,0x36,0x2c,0x53,0x2e,0x2f,0x6e,
+0x47,0xfd,0xee,0x85,0x0,0x1,0x0,0x5e,0xff,0xec,0x3,0xf9,0x5,0xc4,0x0,0x4c,
+0x0,0x0,0x41,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,
+0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,
+0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,
+0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x33,0x34,0x36,0x37,
+0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x1,
+0x86,0x84,0x45,0x73,0x29,0x28,0x2d,0x27,0x24,0x24,0x66,0x3f,0x3f,0x67,0x24,0x24,
+0x27,0xb9,0x49,0x3e,0x3e,0xa9,0x60,0x62,0xa9,0x3e,0x3e,0x46,0x17,0x1c,0x1d,0x5f,
+0x47,0x3b,0x55,0x1b,0x1b,0x1a,0x40,0x3a,0x3a,0xa2,0x62,0x65,0xa5,0x3b,0x3b,0x41,
+0xba,0x26,0x23,0x22,0x61,0x3b,0x3d,0x5f,0x20,0x21,0x22,0x26,0x24,0x25,0x6b,0x46,
+0x3,0x31,0x96,0x20,0x21,0x21,0x63,0x44,0x45,0x65,0x22,0x22,0x21,0x24,0x21,0x21,
+0x5e,0x39,0x60,0x96,0x34,0x34,0x36,0x39,0x37,0x36,0x9e,0x66,0x32,0x66,0x2e,0x2e,
+0x4a,0x17,0x19,0x4b,0x2b,0x2a,0x5a,0x2a,0x65,0x9a,0x34,0x34,0x35,0x3f,0x36,0x37,
+0x93,0x53,0x39,0x5c,0x21,0x21,0x23,0x1f,0x1f,0x20,0x61,0x41,0x37,0x5c,0x21,0x21,
+0x26,0x0,0x0,0x2,0x0,0x4b,0x0,0x0,0x4,0x67,0x5,0xb0,0x0,0xa,0x0,0xe,
+0x0,0x0,0x41,0x11,0x23,0x1,0x15,0x21,0x11,0x33,0x11,0x33,0x35,0x21,0x1,0x37,
+0x11,0x3,0x9c,0xc5,0xfd,0x74,0x2,0x98,0xb9,0xcb,0xfc,0xb1,0x1,0xad,0x1e,0x1,
+0xe9,0x3,0xc7,0xfc,0xf,0x6d,0xfe,0xae,0x1,0x52,0x97,0x2,0x99,0x38,0xfd,0x2f,
+0x0,0x1,0x0,0xbb,0xff,0xec,0x4,0x4f,0x5,0xb0,0x0,0x30,0x0,0x0,0x53,0x17,
+0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,
+0x6,0x23,0x22,0x26,0x27,0x23,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,
+0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x13,0x21,0x35,0x21,0xf0,
+0x94,0x19,0x2f,0x1b,0x1b,0x43,0x2e,0x46,0x6c,0x25,0x25,0x27,0x23,0x22,0x23,0x66,
+0x42,0x75,0x95,0x11,0xb0,0xa,0x4f,0x3e,0x3d,0x9e,0x59,0x74,0xac,0x39,0x38,0x38,
+0x3c,0x38,0x38,0xa0,0x65,0x4f,0x78,0x2b,0x29,0x2,0x4f,0xfd,0x15,0x2,0xda,0x26,
+0x16,0x22,0xc,0xc,0xd,0x32,0x2b,0x2c,0x76,0x44,0x4b,0x7a,0x2b,0x2c,0x2f,0x80,
+0x7c,0x65,0x98,0x32,0x32,0x32,0x49,0x41,0x40,0xb2,0x68,0x6e,0xb4,0x40,0x3f,0x46,
+0x26,0x19,0x1,0x84,0xb4,0x0,0x0,0x2,0x0,0x8d,0xff,0xec,0x4,0x25,0x5,0xb1,
+0x0,0x27,0x0,0x40,0x0,0x0,0x41,0x23,0x22,0x6,0x7,0x6,0x2,0x15,0x15,0x14,
+0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,
+0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x36,0x36,0x37,0x36,0x36,0x33,0x33,0x3,0x32,
+0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,
+0x35,0x35,0x36,0x36,0x37,0x36,0x36,0x3,0x58,0x10,0x9c,0xf6,0x56,0x7d,0x56,0x40,
+0x41,0x3a,0xaa,0x70,0x6f,0xa9,0x39,0x39,0x39,0x30,0x33,0x33,0x9e,0x6d,0x32,0x5b,
+0x27,0x28,0x44,0x1a,0x6,0x41,0x3f,0x3c,0xb8,0x84,0x10,0xf2,0x43,0x64,0x21,0x21,
+0x20,0x23,0x22,0x23,0x64,0x41,0x38,0x66,0x27,0x27,0x2e,0x11,0x3a,0x26,0x26,0x58,
+0x5,0xb1,0x57,0x56,0x7d,0xfe,0xa0,0xb6,0x57,0x6a,0xd3,0x4f,0x48,0x5a,0x4e,0x44,
+0x43,0xb4,0x66,0x59,0xac,0x44,0x44,0x53,0x17,0x13,0x14,0x35,0x1f,0x60,0xb6,0x42,
+0x3f,0x4b,0xfe,0x16,0x38,0x2f,0x2f,0x79,0x40,0x48,0x7b,0x2c,0x2c,0x32,0x35,0x33,
+0x33,0x95,0x60,0x3e,0x2e,0x4c,0x1b,0x1b,0x1e,0x0,0x0,0x1,0x0,0x70,0x0,0x0,
+0x4,0x48,0x5,0xb0,0x0,0x6,0x0,0x0,0x41,0x35,0x21,0x15,0x21,0x1,0x33,0x4,
+0x48,0xfc,0x28,0x3,0x14,0xfd,0xa7,0xc2,0x5,0x48,0x68,0xa2,0xfa,0xf2,0x0,0x3,
+0x0,0xb1,0xff,0xec,0x4,0x4f,0x5,0xc4,0x0,0x2f,0x0,0x47,0x0,0x5f,0x0,0x0,
+0x41,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,
+0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,
+0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,
+0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,
+0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,
+0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,
+0x4,0x2e,0x42,0x3a,0x3a,0x9e,0x5c,0x5d,0x9d,0x38,0x39,0x40,0x1e,0x1b,0x1b,0x4e,
+0x30,0x38,0x5a,0x20,0x20,0x22,0x48,0x3f,0x3e,0xa9,0x62,0x60,0xa8,0x3f,0x3e,0x49,
+0x23,0x20,0x21,0x5b,0x38,0x20,0x38,0x17,0x30,0x36,0x97,0x29,0x24,0x25,0x66,0x3d,
+0x40,0x67,0x24,0x24,0x27,0x27,0x24,0x24,0x66,0x3f,0x3d,0x67,0x25,0x25,0x29,0x22,
+0x24,0x20,0x21,0x5a,0x35,0x36,0x59,0x20,0x21,0x23,0x23,0x20,0x20,0x58,0x36,0x36,
+0x5a,0x21,0x20,0x25,0x4,0x34,0x5f,0x95,0x33,0x33,0x36,0x36,0x33,0x33,0x95,0x5f,
+0x36,0x62,0x29,0x2a,0x43,0x18,0x18,0x48,0x2d,0x2e,0x6d,0x3d,0x64,0x9a,0x34,0x35,
+0x36,0x37,0x35,0x34,0x9a,0x63,0x3d,0x6c,0x2e,0x2e,0x47,0x18,0x10,0x28,0x17,0x30,
+0x7f,0xfd,0xa2,0x3f,0x63,0x22,0x22,0x24,0x24,0x22,0x22,0x63,0x3f,0x3d,0x66,0x25,
+0x24,0x28,0x28,0x24,0x25,0x66,0x2,0x67,0x38,0x5c,0x20,0x21,0x23,0x23,0x21,0x20,
+0x5b,0x39,0x39,0x5d,0x21,0x21,0x23,0x25,0x21,0x22,0x5c,0x0,0x0,0x2,0x0,0x95,
+0xff,0xff,0x4,0x29,0x5,0xc4,0x0,0x28,0x0,0x41,0x0,0x0,0x65,0x23,0x15,0x33,
+0x32,0x36,0x37,0x36,0x12,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,
+0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x15,
+0x6,0x6,0x7,0x6,0x6,0x13,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,
+0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x6,0x6,0x7,0x6,0x6,0x1,0x75,
+0x13,0x13,0xb4,0xfb,0x47,0x76,0x48,0x42,0x42,0x38,0xa5,0x70,0x70,0xa9,0x38,0x39,
+0x39,0x30,0x33,0x33,0x9d,0x6c,0x38,0x5f,0x27,0x27,0x3e,0x18,0x5,0x30,0x45,0x39,
+0xbb,0x51,0x43,0x63,0x20,0x21,0x20,0x24,0x23,0x22,0x64,0x41,0x39,0x65,0x27,0x26,
+0x2d,0x11,0x3b,0x25,0x26,0x59,0xa4,0xa5,0x63,0x50,0x84,0x1,0x55,0xa9,0x43,0x77,
+0xef,0x50,0x44,0x53,0x51,0x44,0x45,0xb7,0x67,0x58,0xae,0x45,0x45,0x55,0x17,0x14,
+0x14,0x35,0x1e,0x2,0x5c,0xac,0x4b,0x3d,0x43,0x1,0xdc,0x3b,0x30,0x30,0x7b,0x40,
+0x48,0x7d,0x2e,0x2d,0x34,0x38,0x34,0x35,0x98,0x61,0x3c,0x2f,0x4d,0x1c,0x1d,0x1f,
+0x0,0x1,0x0,0xa2,0xff,0x30,0x4,0x45,0x6,0x9c,0x0,0x4f,0x0,0x0,0x41,0x14,
+0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,
+0x16,0x17,0x15,0x33,0x35,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,
+0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,
+0x16,0x16,0x15,0x33,0x26,0x26,0x27,0x26,0x26,0x27,0x35,0x23,0x15,0x6,0x6,0x7,
+0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x3,0x8b,
+0x27,0x24,0x24,0x68,0x41,0x33,0x64,0x27,0x28,0x32,0xb9,0x42,0x37,0x37,0x8f,0x4e,
+0x95,0x57,0x8f,0x32,0x32,0x37,0x37,0x34,0x34,0x96,0x5e,0x4d,0x6d,0x22,0x23,0x20,
+0x1d,0x1c,0x1e,0x5f,0x40,0x3b,0x5c,0x20,0x1f,0x21,0xb8,0x1,0x3c,0x39,0x2c,0x78,
+0x49,0x95,0x51,0x85,0x2e,0x2f,0x33,0x3a,0x36,0x35,0x96,0x5d,0x4a,0x6c,0x22,0x22,
+0x1f,0x1,0x77,0x37,0x57,0x1e,0x1f,0x20,0x1c,0x21,0x21,0x6f,0x54,0x71,0xa2,0x35,
+0x36,0x38,0x8,0xbf,0xc0,0x9,0x3c,0x32,0x31,0x8a,0x57,0x59,0x86,0x33,0x33,0x4c,
+0x1f,0x1a,0x37,0x20,0x20,0x4e,0x32,0x33,0x53,0x1e,0x21,0x24,0x2e,0x28,0x29,0x71,
+0x43,0x73,0xb1,0x3c,0x2d,0x39,0xa,0xdc,0xdc,0xa,0x3e,0x32,0x33,0x88,0x54,0x59,
+0x88,0x34,0x35,0x4c,0x1d,0x18,0x39,0x21,0x21,0x4d,0x0,0x2,0x1,0xe6,0xff,0xf5,
+0x2,0xcc,0x5,0xb0,0x0,0x3,0x0,0xf,0x0,0x0,0x41,0x11,0x23,0x11,0x3,0x14,
+0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x2,0xb2,0xba,0x12,0x39,0x39,
+0x39,0x3b,0x3b,0x39,0x39,0x39,0x1,0xd7,0x3,0xd9,0xfc,0x27,0xfe,0x8a,0x2e,0x3e,
+0x3e,0x2e,0x30,0x40,0x40,0x0,0x0,0x2,0x0,0xbf,0xff,0xf5,0x4,0x1b,0x5,0xc4,
+0x0,0x31,0x0,0x3d,0x0,0x0,0x41,0x33,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,
+0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,
+0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,
+0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x3,0x14,0x16,0x33,0x32,0x36,0x35,0x34,
+0x26,0x23,0x22,0x6,0x1,0xff,0xb9,0x4,0x8,0x8,0x21,0x1e,0x2f,0x61,0x27,0x27,
+0x32,0x3a,0x37,0x37,0x9f,0x65,0x5b,0x9d,0x39,0x3a,0x44,0x1,0xb9,0x2a,0x23,0x22,
+0x59,0x2f,0x3d,0x5e,0x1f,0x1c,0x1d,0x26,0x1d,0x1e,0x47,0x22,0x32,0x3c,0x10,0x10,
+0xa,0x16,0x39,0x39,0x39,0x3b,0x3b,0x39,0x39,0x39,0x1,0x9a,0x27,0x3d,0x1b,0x1b,
+0x34,0x1d,0x2a,0x62,0x39,0x38,0x7f,0x48,0x5a,0x8c,0x31,0x31,0x33,0x31,0x2e,0x2f,
+0x86,0x54,0x34,0x4b,0x19,0x18,0x17,0x20,0x1f,0x1c,0x51,0x34,0x32,0x5a,0x28,0x29,
+0x4a,0x23,0x2e,0x43,0x24,0x25,0x5d,0xfe,0x7f,0x2e,0x3e,0x3e,0x2e,0x30,0x40,0x40,
+0x0,0x1,0x1,0x62,0xfe,0xb0,0x2,0x83,0x0,0xdb,0x0,0x9,0x0,0x0,0x65,0x35,
+0x23,0x15,0x14,0x6,0x7,0x17,0x36,0x36,0x2,0x83,0xc9,0x28,0x30,0x73,0x50,0x5e,
+0x2b,0xb0,0xb3,0x55,0x9e,0x46,0x3f,0x47,0xd0,0x0,0x0,0x1,0x1,0xf0,0xff,0xed,
+0x3,0x14,0x1,0x7,0x0,0xb,0x0,0x0,0x65,0x14,0x16,0x33,0x32,0x36,0x35,0x34,
+0x26,0x23,0x22,0x6,0x1,0xf0,0x49,0x48,0x47,0x4c,0x4b,0x48,0x49,0x48,0x78,0x3a,
+0x51,0x50,0x3b,0x3c,0x53,0x54,0xff,0xff,0x2,0x22,0xff,0xed,0x3,0x46,0x4,0x73,
+0x4,0x26,0x0,0x44,0x32,0x0,0x0,0x7,0x0,0x44,0x0,0x32,0x3,0x6c,0xff,0xff,
+0x1,0xe6,0xfe,0xb0,0x3,0x3d,0x4,0x73,0x4,0x27,0x0,0x44,0x0,0x29,0x3,0x6c,
+0x0,0x7,0x0,0x43,0x0,0x84,0x0,0x0,0x0,0x1,0x0,0x9b,0xff,0x69,0x4,0x30,
+0x0,0x0,0x0,0x3,0x0,0x0,0x45,0x35,0x21,0x15,0x4,0x30,0xfc,0x6b,0x97,0x97,
+0x97,0x0,0x0,0x1,0x0,0xda,0x2,0x31,0x3,0xd7,0x2,0xc9,0x0,0x3,0x0,0x0,
+0x41,0x35,0x21,0x15,0x3,0xd7,0xfd,0x3,0x2,0x31,0x98,0x98,0x0,0x1,0x1,0xee,
+0x4,0x21,0x2,0x8d,0x6,0x0,0x0,0x5,0x0,0x0,0x41,0x35,0x23,0x15,0x3,0x33,
+0x2,0x8d,0x9e,0x1,0x8a,0x5,0x91,0x6f,0x7f,0xfe,0xa0,0x0,0x0,0x2,0x1,0x62,
+0x4,0x21,0x3,0x5f,0x6,0x0,0x0,0x5,0x0,0xb,0x0,0x0,0x41,0x35,0x23,0x15,
+0x3,0x33,0x1,0x37,0x23,0x15,0x3,0x33,0x1,0xf9,0x96,0x1,0x82,0x1,0x7a,0x1,
+0x96,0x1,0x81,0x5,0x93,0x6d,0x7d,0xfe,0x9e,0x1,0x72,0x6d,0x7d,0xfe,0x9e,0x0,
+0x0,0x1,0x1,0x65,0xfe,0x2a,0x3,0x75,0x6,0x6b,0x0,0x27,0x0,0x0,0x41,0x15,
+0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x37,0x26,0x26,0x27,0x26,0x26,0x27,
+0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,
+0x7,0x6,0x6,0x7,0x6,0x6,0x1,0x65,0x2d,0x26,0x25,0x63,0x37,0x36,0x6f,0x32,
+0x27,0x29,0x51,0x26,0x25,0x44,0x1a,0x18,0x1c,0x1e,0x1b,0x1c,0x54,0x2e,0x1f,0x41,
+0x20,0x27,0x32,0x6e,0x36,0x37,0x63,0x26,0x26,0x2d,0x2,0x4f,0xa,0x8f,0xfc,0x6b,
+0x6c,0xb1,0x45,0x46,0x61,0x1c,0x71,0x21,0x5d,0x3c,0x3f,0x9f,0x5d,0x5c,0xda,0x7d,
+0xe,0x82,0xe2,0x5e,0x68,0xaf,0x41,0x2a,0x44,0x18,0x7a,0x1c,0x62,0x45,0x45,0xb2,
+0x6b,0x6c,0xfc,0x0,0x0,0x1,0x1,0x40,0xfe,0x2a,0x3,0x51,0x6,0x6b,0x0,0x27,
+0x0,0x0,0x41,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,
+0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,
+0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x3,0x51,0x2f,0x24,0x25,0x62,
+0x38,0x36,0x70,0x32,0x27,0x21,0x46,0x21,0x2b,0x52,0x1d,0x14,0x21,0x19,0x17,0x16,
+0x45,0x25,0x27,0x56,0x2a,0x27,0x32,0x6f,0x37,0x36,0x63,0x26,0x26,0x2d,0x2,0x45,
+0xa,0x99,0xf5,0x69,0x6d,0xae,0x47,0x45,0x62,0x1c,0x71,0x1b,0x4d,0x33,0x41,0xaf,
+0x6e,0x4d,0xdc,0x87,0xe,0x77,0xd1,0x5a,0x61,0xa3,0x41,0x40,0x62,0x1f,0x71,0x1c,
+0x61,0x46,0x45,0xb1,0x6c,0x6b,0xfc,0x0,0x0,0x1,0x1,0xaa,0xfe,0xc8,0x3,0x36,
+0x6,0x80,0x0,0x7,0x0,0x0,0x41,0x35,0x21,0x11,0x21,0x35,0x23,0x11,0x3,0x36,
+0xfe,0x74,0x1,0x8c,0xdd,0x5,0xe8,0x98,0xf8,0x48,0x98,0x6,0x88,0x0,0x0,0x1,
+0x1,0x95,0xfe,0xc8,0x3,0x22,0x6,0x80,0x0,0x7,0x0,0x0,0x41,0x15,0x33,0x11,
+0x23,0x15,0x21,0x11,0x1,0x95,0xde,0xde,0x1,0x8d,0x6,0x80,0x98,0xf9,0x78,0x98,
+0x7,0xb8,0x0,0x1,0x1,0x43,0xfe,0x92,0x3,0xe7,0x6,0x3d,0x0,0x2a,0x0,0x0,
+0x41,0x37,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x26,0x26,0x27,0x36,0x36,0x35,0x35,
+0x34,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x6,
+0x23,0x15,0x16,0x16,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x3,0xd2,0x15,0x3e,0x51,
+0x18,0x19,0x14,0x1,0x6e,0x74,0x74,0x6f,0xc,0x16,0x15,0x55,0x48,0x15,0x65,0x8e,
+0x2c,0x2f,0x2b,0x89,0x8d,0x8d,0x89,0x2e,0x2d,0x2f,0x8e,0xfe,0x92,0x73,0x2,0x40,
+0x32,0x31,0x7b,0x3e,0xa9,0x77,0xb5,0x2e,0x2f,0xb5,0x78,0xaa,0x3d,0x7c,0x32,0x31,
+0x40,0x2,0x73,0x3,0x51,0x40,0x43,0xa9,0x51,0xaa,0x91,0x81,0x91,0x1,0x82,0x90,
+0xa9,0x50,0xa3,0x42,0x45,0x54,0x0,0x1,0x1,0x43,0xfe,0x92,0x3,0xe7,0x6,0x3d,
+0x0,0x36,0x0,0x0,0x45,0x17,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x36,0x37,
+0x36,0x36,0x37,0x35,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x26,0x27,0x26,0x26,
+0x27,0x7,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,
+0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x1,0x43,0x15,0x62,0x8e,
+0x2f,0x2e,0x2c,0x20,0x21,0x22,0x6b,0x48,0x52,0x75,0x21,0x17,0x17,0x2d,0x33,0x2d,
+0x8b,0x61,0x14,0x48,0x54,0x16,0x15,0xd,0x2e,0x30,0x19,0x43,0x28,0x27,0x41,0x1a,
+0x31,0x2f,0x15,0x18,0x19,0x52,0xfb,0x73,0x2,0x56,0x43,0x43,0xa3,0x50,0xa9,0x46,
+0x66,0x22,0x23,0x21,0x1,0x91,0x2b,0x2f,0x21,0x5b,0x3c,0xaa,0x54,0xac,0x45,0x3d,
+0x4c,0x3,0x73,0x2,0x40,0x31,0x32,0x7c,0x3d,0xaa,0x4e,0x85,0x32,0x1b,0x2c,0x10,
+0x10,0x2a,0x1a,0x31,0x86,0x4f,0xa9,0x3e,0x7b,0x31,0x32,0x40,0x0,0x1,0x0,0x77,
+0x0,0x92,0x4,0x5d,0x4,0xb6,0x0,0xb,0x0,0x0,0x41,0x11,0x23,0x11,0x21,0x15,
+0x21,0x11,0x33,0x11,0x21,0x35,0x2,0xc6,0xb9,0xfe,0x6a,0x1,0x96,0xb9,0x1,0x97,
+0x3,0xd,0x1,0xa9,0xfe,0x57,0xb8,0xfe,0x3d,0x1,0xc3,0xb8,0x0,0x2,0x0,0xad,
+0x1,0x6d,0x4,0x2a,0x3,0xad,0x0,0x3,0x0,0x7,0x0,0x0,0x41,0x35,0x21,0x15,
+0x1,0x35,0x21,0x15,0x4,0x2a,0xfc,0x83,0x3,0x7d,0xfc,0x83,0x3,0xc,0xa1,0xa1,
+0xfe,0x61,0xa0,0xa0,0x0,0x1,0x0,0xaa,0x0,0xc4,0x3,0xfa,0x4,0x4b,0x0,0x8,
+0x0,0x0,0x65,0x35,0x25,0x27,0x37,0x25,0x35,0x1,0x15,0x3,0xfa,0xfd,0x9c,0x35,
+0x35,0x2,0x64,0xfc,0xb0,0xc4,0xc4,0xec,0x12,0x11,0xf0,0xc4,0xfe,0x86,0x92,0x0,
+0x0,0x1,0x0,0xb2,0x0,0xc5,0x4,0x25,0x4,0x4c,0x0,0x8,0x0,0x0,0x77,0x1,
+0x35,0x1,0x15,0x5,0x17,0x7,0x5,0xb2,0x3,0x73,0xfc,0x8d,0x2,0x87,0x3c,0x3c,
+0xfd,0x79,0xc5,0x1,0x7b,0x92,0x1,0x7a,0xbf,0xf0,0x13,0x11,0xf4,0x0,0x0,0x1,
+0x0,0xfc,0xff,0x83,0x4,0x1,0x5,0xb0,0x0,0x3,0x0,0x0,0x45,0x1,0x23,0x1,
+0x1,0xa2,0x2,0x5f,0xa5,0xfd,0xa0,0x7d,0x6,0x2d,0xf9,0xd3,0x0,0x1,0x0,0xe7,
+0xff,0x83,0x3,0xee,0x5,0xb0,0x0,0x3,0x0,0x0,0x53,0x1,0x33,0x1,0xe7,0x2,
+0x60,0xa7,0xfd,0xa0,0x5,0xb0,0xf9,0xd3,0x6,0x2d,0x0,0x5,0x0,0x2c,0xff,0xeb,
+0x4,0x9e,0x5,0xc5,0x0,0x19,0x0,0x33,0x0,0x4d,0x0,0x67,0x0,0x6b,0x0,0x0,
+0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,
+0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,
+0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,
+0x26,0x27,0x26,0x26,0x1,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,
+0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,
+0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,
+0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x5,0x1,0x27,0x1,0x2c,0x23,0x22,0x22,
+0x65,0x41,0x41,0x64,0x22,0x21,0x23,0x23,0x21,0x22,0x65,0x42,0x41,0x64,0x21,0x22,
+0x23,0x8a,0xe,0x10,0xf,0x31,0x23,0x24,0x31,0x10,0xf,0xf,0xf,0xf,0xf,0x31,
+0x23,0x24,0x31,0x10,0x10,0xe,0x1,0xcf,0x23,0x22,0x22,0x65,0x42,0x41,0x63,0x22,
+0x22,0x23,0x23,0x22,0x22,0x64,0x42,0x41,0x64,0x22,0x22,0x23,0x8a,0xe,0x10,0xf,
+0x31,0x24,0x23,0x32,0x10,0xf,0xe,0xe,0xf,0xf,0x31,0x23,0x24,0x32,0xf,0x10,
+0xf,0xfe,0x7f,0x2,0x37,0x6f,0xfd,0xc9,0x4,0xaa,0x4d,0x39,0x66,0x26,0x27,0x2d,
+0x2d,0x27,0x26,0x66,0x39,0x4d,0x39,0x67,0x27,0x27,0x2d,0x2d,0x27,0x27,0x67,0x86,
+0x4d,0x1f,0x3b,0x17,0x16,0x1b,0x1b,0x16,0x17,0x3b,0x1f,0x4d,0x1f,0x39,0x16,0x17,
+0x1b,0x1b,0x17,0x16,0x39,0xfd,0x14,0x4e,0x39,0x66,0x26,0x27,0x2d,0x2d,0x27,0x26,
+0x66,0x39,0x4e,0x39,0x66,0x27,0x27,0x2d,0x2d,0x27,0x27,0x66,0x87,0x4e,0x1f,0x3a,
+0x17,0x16,0x1b,0x1b,0x16,0x17,0x3a,0x1f,0x4e,0x1f,0x3a,0x16,0x17,0x1b,0x1b,0x17,
+0x16,0x3a,0x29,0x4,0xd,0x3e,0xfb,0xf3,0x0,0x1,0x2,0x1c,0xfe,0x72,0x2,0xb1,
+0x5,0xb0,0x0,0x3,0x0,0x0,0x41,0x11,0x23,0x11,0x2,0xb1,0x95,0xfe,0x72,0x7,
+0x3e,0xf8,0xc2,0x0,0x0,0x1,0x0,0xa0,0x1,0xd9,0x4,0x60,0x5,0xb0,0x0,0xe,
+0x0,0x0,0x41,0x1,0x17,0x13,0x13,0x37,0x1,0x25,0x27,0x5,0x13,0x23,0x13,0x25,
+0x7,0x2,0x19,0xfe,0xfb,0x92,0xd4,0xd6,0x92,0xff,0x0,0x1,0x7e,0x36,0xfe,0x95,
+0x1d,0xb2,0x19,0xfe,0x93,0x36,0x3,0x93,0xfe,0xb9,0x6a,0x1,0x62,0xfe,0x95,0x6e,
+0x1,0x44,0x5e,0xb2,0x96,0x1,0xab,0xfe,0x5b,0x97,0xaf,0x0,0x0,0x2,0x0,0x3d,
+0x0,0x0,0x4,0x99,0x5,0xb0,0x0,0x1b,0x0,0x1f,0x0,0x0,0x41,0x3,0x33,0x13,
+0x33,0x35,0x23,0x13,0x33,0x35,0x23,0x13,0x23,0x3,0x21,0x13,0x23,0x3,0x21,0x15,
+0x21,0x3,0x21,0x15,0x33,0x3,0x33,0x13,0x37,0x13,0x21,0x3,0x2,0xc3,0x50,0x8f,
+0x50,0xfc,0xe2,0x45,0xe8,0xcd,0x52,0x8f,0x52,0xfe,0xf8,0x52,0x8f,0x52,0xfe,0xe3,
+0x1,0x2,0x45,0xfe,0xf7,0xef,0x50,0x8f,0x50,0x1a,0x45,0x1,0x8,0x45,0x1,0x9a,
+0xfe,0x66,0x1,0x9a,0x89,0x1,0x62,0x8b,0x1,0xa0,0xfe,0x60,0x1,0xa0,0xfe,0x60,
+0x8b,0xfe,0x9e,0x89,0xfe,0x66,0x1,0x9a,0x89,0x1,0x62,0xfe,0x9e,0x0,0x0,0x3,
+0x0,0x6b,0xff,0xec,0x4,0xa9,0x5,0xc5,0x0,0x36,0x0,0x4a,0x0,0x63,0x0,0x0,
+0x53,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x17,0x33,0x27,
+0x36,0x36,0x35,0x23,0x6,0x6,0x7,0x1,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,
+0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,
+0x17,0x7,0x6,0x6,0x7,0x6,0x6,0x1,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,
+0x37,0x36,0x36,0x37,0x37,0x1,0x6,0x6,0x7,0x6,0x6,0x3,0x34,0x36,0x37,0x36,
+0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x7,0x26,
+0x26,0x27,0x26,0x26,0x6b,0x3d,0x38,0x38,0xa0,0x63,0x3d,0x73,0x35,0x20,0x3d,0x1c,
+0x53,0xdd,0xb5,0x46,0x49,0xa7,0x1,0x28,0x23,0xfe,0xcd,0x5e,0x2c,0x4c,0x1c,0x1b,
+0x1f,0x2c,0x28,0x29,0x74,0x47,0x52,0x84,0x2f,0x2f,0x33,0x11,0xf,0x13,0x3a,0x25,
+0x24,0x31,0x51,0x1f,0x24,0x28,0x1,0xb0,0x3d,0x5c,0x1f,0x1f,0x20,0xb,0x11,0x10,
+0x3e,0x32,0x1c,0x1,0x43,0x18,0x33,0x1b,0x25,0x50,0xa0,0x16,0x16,0x15,0x41,0x2b,
+0x21,0x34,0x13,0x12,0x13,0x9,0xb,0xb,0x28,0x1f,0x75,0x19,0x26,0xc,0xa,0xa,
+0x1,0x75,0x56,0x91,0x34,0x34,0x3a,0x1a,0x19,0xf,0x28,0x18,0x6e,0xed,0x58,0xdb,
+0x80,0x58,0x98,0x40,0x1,0x93,0x50,0x21,0x44,0x26,0x26,0x57,0x35,0x3e,0x70,0x2b,
+0x2a,0x32,0x2e,0x2c,0x2d,0x83,0x55,0x28,0x4c,0x25,0x2d,0x5d,0x32,0x1a,0x25,0x4c,
+0x2a,0x32,0x72,0xfe,0xca,0x26,0x21,0x21,0x58,0x33,0x13,0x39,0x23,0x22,0x4e,0x29,
+0x18,0xfe,0x51,0x14,0x21,0xc,0x11,0x12,0x3,0xe6,0x28,0x47,0x1b,0x1b,0x20,0x1b,
+0x15,0x16,0x39,0x1e,0x17,0x30,0x17,0x18,0x2e,0x15,0x5d,0x24,0x44,0x21,0x19,0x33,
+0x0,0x2,0x0,0x40,0xff,0xf8,0x4,0x8b,0x5,0xb2,0x0,0x5e,0x0,0x75,0x0,0x0,
+0x41,0x36,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x2,0x7,0x6,0x12,0x17,
+0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x23,
+0x22,0x26,0x27,0x26,0x26,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,
+0x16,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x37,0x13,0x26,
+0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x16,0x17,0x16,0x16,0x33,0x32,0x36,
+0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x5,
+0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x3,0x7,0x6,0x6,0x7,0x6,0x6,
+0x23,0x22,0x26,0x27,0x26,0x26,0x4,0x87,0x4,0x40,0x40,0x41,0xbe,0x7a,0x7d,0xcf,
+0x4c,0x50,0x5f,0x6,0x5,0x3b,0x43,0x42,0xd3,0x93,0x20,0x48,0x23,0x23,0x40,0x19,
+0x20,0x16,0x36,0x1e,0x1e,0x3e,0x1e,0x70,0xa5,0x35,0x35,0x30,0x5,0x4,0x4a,0x43,
+0x3f,0x9f,0x61,0x60,0x96,0x34,0x33,0x32,0x4,0x1,0x14,0x13,0x13,0x39,0x25,0x10,
+0x1c,0x9,0xa,0xa,0x3,0x2c,0x1a,0x58,0x43,0x47,0x76,0x2c,0x2d,0x38,0x9,0x6,
+0x11,0x17,0x16,0x48,0x31,0x22,0x3e,0x1b,0x16,0x27,0x10,0x7,0x16,0xf,0x15,0x3a,
+0x24,0x4a,0x66,0x21,0x20,0x20,0xfd,0x52,0x8,0x21,0x1b,0x1b,0x4f,0x35,0xf,0x1d,
+0xe,0x26,0x1,0xb,0x1a,0xe,0x17,0x37,0x1e,0x18,0x23,0xb,0xb,0x8,0x3,0x15,
+0x97,0xf7,0x58,0x58,0x5f,0x72,0x64,0x69,0xfe,0xe0,0xa0,0x99,0xfe,0xff,0x5d,0x5d,
+0x67,0x9,0xa,0x9,0x1c,0x13,0x75,0xf,0x18,0x8,0x9,0x9,0x4d,0x4a,0x49,0xd4,
+0x88,0x91,0xf3,0x56,0x50,0x57,0x4a,0x46,0x46,0xca,0x7f,0x49,0x82,0x30,0x31,0x39,
+0xa,0xf,0xe,0x33,0x29,0x1,0xf8,0x24,0x35,0x43,0x3e,0x3f,0xb3,0x6f,0x4e,0x82,
+0x2f,0x2f,0x34,0x14,0x12,0x10,0x2a,0x19,0x18,0x27,0xf,0x15,0x16,0x56,0x44,0x44,
+0xa7,0x23,0x52,0x85,0x2f,0x2e,0x33,0x6,0x7,0xfe,0x4d,0xa,0x18,0x25,0xe,0x16,
+0x14,0x1d,0x1c,0x1b,0x51,0x0,0x0,0x1,0x0,0xe7,0x2,0xa5,0x3,0xe5,0x5,0xb0,
+0x0,0x8,0x0,0x0,0x53,0x33,0x13,0x37,0x17,0x13,0x33,0x1,0x23,0xe7,0xac,0xc3,
+0xf,0xf,0xc6,0xab,0xfe,0xc1,0x7f,0x2,0xa5,0x1,0xe6,0x44,0x44,0xfe,0x1a,0x3,
+0xb,0x0,0x0,0x1,0x0,0x30,0x1,0x92,0x4,0x9c,0x3,0x22,0x0,0x31,0x0,0x0,
+0x41,0x27,0x14,0x6,0x7,0x6,0x6,0x23,0x6,0x26,0x27,0x26,0x26,0x27,0x26,0x26,
+0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x17,0x34,0x36,0x37,0x36,0x36,
+0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,
+0x36,0x36,0x4,0x9c,0x86,0x1a,0x16,0x17,0x3d,0x23,0x1e,0x38,0x1b,0x17,0x30,0x1a,
+0x27,0x4b,0x27,0x27,0x53,0x2e,0x43,0x6e,0x27,0x28,0x2c,0x86,0x1a,0x16,0x16,0x3d,
+0x23,0x17,0x2b,0x15,0x1e,0x3d,0x21,0x28,0x4b,0x27,0x26,0x51,0x2f,0x43,0x6e,0x28,
+0x28,0x2c,0x2,0xe4,0x12,0x26,0x46,0x1a,0x1b,0x20,0x1,0xf,0xf,0xc,0x23,0x16,
+0x20,0x34,0x12,0x12,0x13,0x35,0x2d,0x2d,0x78,0x42,0x11,0x26,0x43,0x19,0x18,0x1d,
+0x8,0x9,0xc,0x29,0x1b,0x22,0x34,0x12,0x12,0x12,0x38,0x2f,0x2f,0x7a,0x0,0x1,
+0x1,0x9f,0x4,0xbf,0x3,0x2d,0x5,0xc9,0x0,0x3,0x0,0x0,0x41,0x3,0x23,0x13,
+0x3,0x2d,0xaf,0xdf,0xf8,0x4,0xbf,0x1,0xa,0xfe,0xf6,0x0,0x0,0x1,0x0,0x0,
+0x0,0x60,0x0,0xb1,0x0,0x16,0x0,0x87,0x0,0x5,0x0,0x1,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x1,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x1c,0x0,0x79,0x0,0xda,0x1,0x21,0x1,0x3a,0x1,0x50,0x1,0xba,
+0x1,0xd2,0x1,0xea,0x2,0x1a,0x2,0x38,0x2,0x48,0x2,0x68,0x2,0x80,0x2,0xf5,
+0x3,0x2c,0x3,0xa5,0x3,0xe2,0x4,0x51,0x4,0x64,0x4,0x97,0x4,0xad,0x4,0xd1,
+0x4,0xf0,0x5,0x8,0x5,0x20,0x5,0x8c,0x5,0xf4,0x6,0x42,0x6,0x86,0x6,0xd2,
+0x7,0x5,0x7,0x7c,0x7,0xb1,0x7,0xdf,0x8,0x21,0x8,0x3f,0x8,0x54,0x8,0xad,
+0x8,0xe0,0x9,0x2e,0x9,0x84,0x9,0xda,0xa,0x1,0xa,0x6e,0xa,0xa8,0xa,0xd6,
+0xa,0xec,0xb,0x11,0xb,0x30,0xb,0x64,0xb,0x7b,0xb,0xd7,0xb,0xe9,0xc,0x2c,
+0xc,0x9b,0xc,0xba,0xd,0x5,0xd,0x67,0xd,0x79,0xe,0x8,0xe,0x6a,0xe,0xdf,
+0xe,0xfd,0xf,0x5a,0xf,0x6f,0xf,0x85,0xf,0x91,0xf,0x9e,0xf,0xab,0xf,0xb8,
+0xf,0xc8,0xf,0xe2,0x10,0x24,0x10,0x66,0x10,0x79,0x10,0x8b,0x10,0xcd,0x11,0x20,
+0x11,0x38,0x11,0x4c,0x11,0x62,0x11,0x79,0x11,0x88,0x11,0x97,0x12,0x36,0x12,0x44,
+0x12,0x68,0x12,0xa1,0x13,0x3a,0x13,0xed,0x14,0x3,0x14,0x51,0x14,0x60,0x0,0x0,
+0x0,0x1,0x0,0x0,0x0,0x3,0x0,0x0,0x76,0xbf,0xaa,0xbf,0x5f,0xf,0x3c,0xf5,
+0x0,0xb,0x8,0x0,0x0,0x0,0x0,0x0,0xc4,0xf0,0x11,0x2e,0x0,0x0,0x0,0x0,
+0xda,0xd8,0x3f,0xab,0xfc,0x5,0xfd,0xd5,0x6,0x47,0x8,0x62,0x0,0x0,0x0,0x9,
+0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0xcd,0x0,0x0,0x0,0x0,0x0,0x51,
+0x0,0xac,0x0,0x6b,0x0,0x9b,0x0,0xb6,0x0,0xbf,0x0,0x64,0x0,0x8d,0x0,0xae,
+0x0,0x62,0x0,0xac,0x0,0xc6,0x0,0x94,0x0,0x8f,0x0,0x6a,0x0,0xbf,0x0,0x5e,
+0x0,0xb5,0x0,0x76,0x0,0x4c,0x0,0x8b,0x0,0x47,0x0,0x49,0x0,0x57,0x0,0x3d,
+0x0,0x72,0x0,0x9c,0x0,0xaf,0x0,0x8f,0x0,0x8b,0x0,0x87,0x0,0x98,0x0,0x8c,
+0x0,0xae,0x0,0xcb,0x0,0xd3,0x0,0xb0,0x0,0xcb,0x0,0x5d,0x0,0xae,0x0,0x7a,
+0x0,0xad,0x0,0x8c,0x1,0x49,0x0,0xaf,0x0,0x8e,0x0,0xb4,0x0,0x62,0x0,0x30,
+0x0,0x6e,0x0,0x44,0x0,0xa0,0x0,0x91,0x0,0xd0,0x0,0x55,0x0,0x5e,0x0,0x4b,
+0x0,0xbb,0x0,0x8d,0x0,0x70,0x0,0xb1,0x0,0x95,0x0,0xa2,0x1,0xe6,0x0,0xbf,
+0x1,0x62,0x1,0xf0,0x2,0x22,0x1,0xe6,0x0,0x9b,0x0,0xda,0x1,0xee,0x1,0x62,
+0x1,0x65,0x1,0x40,0x1,0xaa,0x1,0x95,0x1,0x43,0x1,0x43,0x0,0x77,0x0,0xad,
+0x0,0xaa,0x0,0xb2,0x0,0xfc,0x0,0xe7,0x0,0x2c,0x2,0x1c,0x0,0xa0,0x0,0x3d,
+0x0,0x6b,0x0,0x40,0x0,0xe7,0x0,0x30,0x1,0x9f,0x0,0x0,0x0,0x1,0x0,0x0,
+0x8,0x62,0xfd,0xd5,0x0,0x0,0x4,0xcd,0xfc,0x5,0xfe,0x86,0x6,0x47,0x0,0x1,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,
+0x0,0x4,0x4,0xcd,0x1,0x90,0x0,0x5,0x0,0x0,0x5,0x9a,0x5,0x33,0x0,0x0,
+0x1,0x1f,0x5,0x9a,0x5,0x33,0x0,0x0,0x3,0xd1,0x0,0x66,0x2,0x0,0x0,0x0,
+0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x47,0x4f,0x4f,0x47,0x0,0x40,
+0x0,0x20,0x0,0x7e,0x8,0x62,0xfd,0xd5,0x0,0x0,0x8,0x62,0x2,0x2b,0x0,0x0,
+0x0,0x1,0x0,0x0,0x0,0x0,0x4,0x3a,0x5,0xb0,0x0,0x0,0x0,0x20,0x0,0x1,
+0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x14,0x0,0x3,0x0,0x1,
+0x0,0x0,0x0,0x14,0x0,0x4,0x0,0x92,0x0,0x0,0x0,0x10,0x0,0x10,0x0,0x3,
+0x0,0x0,0x0,0x2f,0x0,0x39,0x0,0x40,0x0,0x5a,0x0,0x60,0x0,0x7a,0x0,0x7e,
+0xff,0xff,0x0,0x0,0x0,0x20,0x0,0x30,0x0,0x3a,0x0,0x41,0x0,0x5b,0x0,0x61,
+0x0,0x7b,0xff,0xff,0x0,0x0,0x0,0x6,0x0,0x0,0xff,0xc1,0x0,0x0,0xff,0xbb,
+0x0,0x0,0x0,0x1,0x0,0x10,0x0,0x0,0x0,0x2c,0x0,0x0,0x0,0x36,0x0,0x0,
+0x0,0x3e,0x0,0x0,0x0,0x1,0x0,0x41,0x0,0x4a,0x0,0x5a,0x0,0x40,0x0,0x57,
+0x0,0x5b,0x0,0x49,0x0,0x4b,0x0,0x4c,0x0,0x59,0x0,0x51,0x0,0x43,0x0,0x48,
+0x0,0x44,0x0,0x55,0x0,0x45,0x0,0x46,0x0,0x53,0x0,0x52,0x0,0x54,0x0,0x42,
+0x0,0x5c,0x0,0x4d,0x0,0x56,0x0,0x4e,0x0,0x5d,0x0,0x47,0x0,0x5f,0x0,0x4f,
+0x0,0x58,0x0,0x50,0x0,0x5e,0x0,0x0,0x0,0x0,0x0,0x5,0x0,0x42,0x0,0x3,
+0x0,0x1,0x4,0x9,0x0,0x2,0x0,0xe,0x0,0x0,0x0,0x3,0x0,0x1,0x4,0x9,
+0x1,0x0,0x0,0xc,0x0,0xe,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0xb,0x0,0xc,
+0x0,0x1a,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0xe,0x0,0xe,0x0,0x0,0x0,0x3,
+0x0,0x1,0x4,0x9,0x1,0x11,0x0,0xc,0x0,0x26,0x0,0x52,0x0,0x65,0x0,0x67,
+0x0,0x75,0x0,0x6c,0x0,0x61,0x0,0x72,0x0,0x57,0x0,0x65,0x0,0x69,0x0,0x67,
+0x0,0x68,0x0,0x74,0x0,0x49,0x0,0x74,0x0,0x61,0x0,0x6c,0x0,0x69,0x0,0x63,
+0x0,0x4e,0x0,0x6f,0x0,0x72,0x0,0x6d,0x0,0x61,0x0,0x6c,0x0,0x3,0x0,0x0,
+0x0,0x0,0x0,0x0,0xff,0x6a,0x0,0x64,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x1,
+0xff,0xff,0x0,0xf,0x0,0x1,0x0,0x0,0x0,0xa,0x0,0x32,0x0,0x34,0x0,0x4,
+0x44,0x46,0x4c,0x54,0x0,0x1a,0x63,0x79,0x72,0x6c,0x0,0x24,0x67,0x72,0x65,0x6b,
+0x0,0x24,0x6c,0x61,0x74,0x6e,0x0,0x24,0x0,0x4,0x0,0x0,0x0,0x0,0xff,0xff,
+0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x1,
+0x0,0x8,0x0,0x2,0x0,0x0,0x0,0x14,0x0,0x2,0x0,0x0,0x0,0x24,0x0,0x2,
+0x77,0x67,0x68,0x74,0x1,0x0,0x0,0x0,0x69,0x74,0x61,0x6c,0x1,0xb,0x0,0x1,
+0x0,0x4,0x0,0x14,0x0,0x3,0x0,0x0,0x0,0x2,0x1,0xe,0x1,0x90,0x0,0x0,
+0x2,0xbc,0x0,0x0,0x0,0x3,0x0,0x1,0x0,0x2,0x1,0x11,0x0,0x0,0x0,0x0,
+0x0,0x1,0x0,0x0,
+};
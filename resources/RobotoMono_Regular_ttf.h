@@ -1,3 +0,0 @@
-static const unsigned char RobotoMono_Regular_ttf[] = {
-0x0,0x1,0x0,0x0,0x0,0xe,0x0,0x80,0x0,0x3,0x0,0x60,0x47,0x53,0x55,0x42,0x36,0xbd,0x35,0xcb,0x0,0x0,0x2,0x20,0x0,0x0,0x2,0xa8,0x4f,0x53,0x2f,0x32,0x97,0xb7,0xc1,0x74,0x0,0x0,0x1,0xc0,0x0,0x0,0x0,0x60,0x53,0x54,0x41,0x54,0xe7,0x80,0xcc,0x1e,0x0,0x0,0x1,0x78,0x0,0x0,0x0,0x48,0x63,0x6d,0x61,0x70,0xab,0x9c,0xd1,0xb9,0x0,0x0,0x9,0xc0,0x0,0x0,0x7,0x60,0x67,0x61,0x73,0x70,0x0,0x0,0x0,0x10,0x0,0x0,0x0,0xf4,0x0,0x0,0x0,0x8,0x67,0x6c,0x79,0x66,0xc6,0x51,0xda,0x86,0x0,0x0,0x42,0x7c,0x0,0x1,0x12,0x48,0x68,0x65,0x61,0x64,0x1,0x35,0x9c,0xe,0x0,0x0,0x1,0x40,0x0,0x0,0x0,0x36,0x68,0x68,0x65,0x61,0xa,0xb1,0x1,0x2a,0x0,0x0,0x1,0x1c,0x0,0x0,0x0,0x24,0x68,0x6d,0x74,0x78,0x7,0x17,0x13,0xd1,0x0,0x0,0x11,0x20,0x0,0x0,0x7,0xd0,0x6c,0x6f,0x63,0x61,0x3d,0x4e,0x80,0xea,0x0,0x0,0x18,0xf0,0x0,0x0,0x7,0xd0,0x6d,0x61,0x78,0x70,0x4,0x6,0x1,0x3a,0x0,0x0,0x0,0xfc,0x0,0x0,0x0,0x20,0x6e,0x61,0x6d,0x65,0x8c,0x8f,0xd3,0x56,0x0,0x0,0x4,0xc8,0x0,0x0,0x4,0xf8,0x70,0x6f,0x73,0x74,0x97,0xb9,0xaf,0x6,0x0,0x0,0x20,0xc0,0x0,0x0,0x21,0xbc,0x70,0x72,0x65,0x70,0x68,0x6,0x8c,0x85,0x0,0x0,0x0,0xec,0x0,0x0,0x0,0x7,0xb8,0x1,0xff,0x85,0xb0,0x4,0x8d,0x0,0x0,0x1,0x0,0x1,0xff,0xff,0x0,0xf,0x0,0x1,0x0,0x0,0x3,0xe7,0x0,0xb1,0x0,0x16,0x0,0x87,0x0,0x5,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x0,0x1,0x0,0x1,0x0,0x0,0x8,0x62,0xfd,0xd5,0x0,0x0,0x4,0xcd,0xfc,0x5,0xfe,0x86,0x6,0x47,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x1,0x0,0x0,0x0,0x3,0x0,0x0,0x22,0x9,0xdf,0xc8,0x5f,0xf,0x3c,0xf5,0x0,0xb,0x8,0x0,0x0,0x0,0x0,0x0,0xc4,0xf0,0x11,0x2e,0x0,0x0,0x0,0x0,0xda,0xd8,0x3f,0xab,0xfc,0x5,0xfd,0xd5,0x6,0x47,0x8,0x62,0x0,0x0,0x0,0x9,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x1,0x0,0x8,0x0,0x2,0x0,0x0,0x0,0x14,0x0,0x2,0x0,0x0,0x0,0x24,0x0,0x2,0x77,0x67,0x68,0x74,0x1,0x0,0x0,0x0,0x69,0x74,0x61,0x6c,0x1,0xb,0x0,0x1,0x0,0x14,0x0,0x4,0x0,0x3,0x0,0x1,0x0,0x2,0x1,0x11,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x2,0x1,0xe,0x1,0x90,0x0,0x0,0x2,0xbc,0x0,0x0,0x0,0x4,0x4,0xcd,0x1,0x90,0x0,0x5,0x0,0x0,0x5,0x9a,0x5,0x33,0x0,0x0,0x1,0x1f,0x5,0x9a,0x5,0x33,0x0,0x0,0x3,0xd1,0x0,0x66,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x0,0x2,0xff,0x10,0x0,0x20,0x5b,0x0,0x0,0x0,0x20,0x0,0x0,0x0,0x0,0x47,0x4f,0x4f,0x47,0x0,0x40,0x0,0xd,0xff,0xfd,0x8,0x62,0xfd,0xd5,0x0,0x0,0x8,0x62,0x2,0x2b,0x20,0x0,0x1,0x9f,0x4f,0x1,0x0,0x0,0x4,0x3a,0x5,0xb0,0x0,0x0,0x0,0x20,0x0,0x1,0x0,0x1,0x0,0x0,0x0,0xa,0x0,0x30,0x0,0x3e,0x0,0x4,0x44,0x46,0x4c,0x54,0x0,0x1a,0x63,0x79,0x72,0x6c,0x0,0x1a,0x67,0x72,0x65,0x6b,0x0,0x1a,0x6c,0x61,0x74,0x6e,0x0,0x1a,0x0,0x4,0x0,0x0,0x0,0x0,0xff,0xff,0x0,0x1,0x0,0x0,0x0,0x1,0x73,0x6d,0x63,0x70,0x0,0x8,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x1,0x0,0x4,0x0,0x1,0x0,0x0,0x0,0x1,0x0,0x8,0x0,0x2,0x1,0xbe,0x0,0xdc,0x2,0x4f,0x2,0x50,0x2,0x51,0x2,0x52,0x2,0x53,0x2,0x54,0x2,0x55,0x2,0x56,0x2,0x57,0x2,0x58,0x2,0x59,0x2,0x5a,0x2,0x5b,0x2,0x5c,0x2,0x5d,0x2,0x70,0x2,0x5e,0x2,0x5f,0x2,0x60,0x2,0x61,0x2,0x62,0x2,0x63,0x2,0x64,0x2,0x65,0x2,0x66,0x2,0x67,0x2,0x4f,0x2,0x50,0x2,0x51,0x2,0x52,0x2,0x53,0x2,0x54,0x2,0x55,0x2,0x56,0x2,0x57,0x2,0x58,0x2,0x59,0x2,0x5a,0x2,0x5b,0x2,0x5c,0x2,0x5d,0x2,0x70,0x2,0x5e,0x2,0x5f,0x2,0x60,0x2,0x61,0x2,0x62,0x2,0x63,0x2,0x64,0x2,0x65,0x2,0x66,0x2,0x67,0x2,0x82,0x2,0x72,0x2,0x85,0x2,0xa0,0x2,0x86,0x2,0x88,0x2,0x84,0x2,0x9f,0x2,0xa1,0x2,0x89,0x2,0x8a,0x2,0x87,0x2,0xa2,0x2,0xa4,0x2,0x8b,0x2,0xa3,0x2,0xa5,0x2,0x81,0x2,0x8d,0x2,0xa7,0x2,0xaa,0x2,0x8e,0x2,0x8f,0x2,0xa8,0x2,0x8c,0x2,0xa6,0x2,0xa9,0x2,0x82,0x2,0xac,0x2,0xab,0x2,0xad,0x2,0xae,0x2,0x91,0x2,0xb1,0x2,0x92,0x2,0x93,0x2,0xb3,0x2,0x90,0x2,0xb0,0x2,0xb2,0x2,0xaf,0x2,0xb4,0x2,0xb5,0x2,0xb6,0x2,0xb8,0x2,0xb7,0x2,0xb9,0x2,0xba,0x2,0xbc,0x2,0xbb,0x2,0x94,0x2,0x96,0x2,0xbe,0x2,0x97,0x2,0x99,0x2,0x95,0x2,0xbf,0x2,0xbd,0x2,0x98,0x2,0xc0,0x2,0xc2,0x2,0xc1,0x2,0xc3,0x2,0xc6,0x2,0xc5,0x2,0xc4,0x2,0x83,0x2,0xc7,0x2,0x9b,0x2,0xca,0x2,0x9c,0x2,0x9d,0x2,0x9a,0x2,0xcc,0x2,0xc9,0x2,0xcd,0x2,0xcb,0x2,0xc8,0x2,0xce,0x2,0x9e,0x2,0xcf,0x2,0xd0,0x2,0xd1,0x2,0xd3,0x2,0xd2,0x2,0x85,0x2,0xa0,0x2,0x86,0x2,0x88,0x2,0x84,0x2,0x9f,0x2,0xa1,0x2,0x89,0x2,0x8a,0x2,0x87,0x2,0xa2,0x2,0xa4,0x2,0x8b,0x2,0xa3,0x2,0xa5,0x2,0x81,0x2,0x8d,0x2,0xa7,0x2,0xaa,0x2,0x8e,0x2,0x8f,0x2,0xa8,0x2,0x8c,0x2,0xa6,0x2,0xa9,0x2,0xac,0x2,0xab,0x2,0xad,0x2,0xae,0x2,0x91,0x2,0xb1,0x2,0x92,0x2,0x93,0x2,0x90,0x2,0xb0,0x2,0xb2,0x2,0xaf,0x2,0xb4,0x2,0xb5,0x2,0xb6,0x2,0xb8,0x2,0xb7,0x2,0xb9,0x2,0xba,0x2,0xbc,0x2,0xbb,0x2,0x94,0x2,0x96,0x2,0xbe,0x2,0x97,0x2,0x99,0x2,0x95,0x2,0xbf,0x2,0xbd,0x2,0x98,0x2,0xc0,0x2,0xc2,0x2,0xc1,0x2,0xc3,0x2,0xc6,0x2,0xc5,0x2,0xc4,0x2,0x83,0x2,0xc7,0x2,0x9b,0x2,0xca,0x2,0x9c,0x2,0x9d,0x2,0x9a,0x2,0xcc,0x2,0xc9,0x2,0xcd,0x2,0xcb,0x2,0xc8,0x2,0xce,0x2,0x9e,0x2,0xcf,0x2,0xd0,0x2,0xd1,0x2,0xd3,0x2,0xd2,0x2,0x7f,0x2,0x7f,0x0,0x2,0x0,0x1a,0x0,0x2,0x0,0x35,0x0,0x0,0x0,0x4c,0x0,0x4c,0x0,0x34,0x0,0x50,0x0,0x50,0x0,0x35,0x0,0x9e,0x0,0xa7,0x0,0x36,0x0,0xa9,0x0,0xb6,0x0,0x40,0x0,0xb8,0x0,0xbc,0x0,0x4e,0x0,0xbe,0x0,0xcd,0x0,0x53,0x0,0xcf,0x0,0xd7,0x0,0x63,0x0,0xd9,0x0,0xda,0x0,0x6c,0x0,0xdd,0x0,0xeb,0x0,0x6e,0x0,0xed,0x0,0xf1,0x0,0x7d,0x0,0xf3,0x0,0xf3,0x0,0x82,0x0,0xf6,0x0,0xf8,0x0,0x83,0x0,0xfa,0x1,0x6,0x0,0x86,0x1,0x8,0x1,0x15,0x0,0x93,0x1,0x17,0x1,0x1a,0x0,0xa1,0x1,0x1c,0x1,0x2a,0x0,0xa5,0x1,0x2c,0x1,0x34,0x0,0xb4,0x1,0x36,0x1,0x37,0x0,0xbd,0x1,0x3a,0x1,0x48,0x0,0xbf,0x1,0x4a,0x1,0x4e,0x0,0xce,0x1,0x50,0x1,0x50,0x0,0xd3,0x1,0x53,0x1,0x55,0x0,0xd4,0x1,0x57,0x1,0x59,0x0,0xd7,0x2,0x7e,0x2,0x7e,0x0,0xda,0x2,0x80,0x2,0x80,0x0,0xdb,0x0,0x0,0x0,0x1f,0x1,0x7a,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0x0,0x0,0xb4,0x2,0xca,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0x1,0x0,0x16,0x2,0xb4,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0x2,0x0,0xe,0x2,0xa6,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0x3,0x0,0x3a,0x2,0x6c,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0x4,0x0,0x26,0x2,0x46,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0x5,0x0,0x1a,0x2,0x2c,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0x6,0x0,0x24,0x2,0x8,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0x7,0x0,0x4a,0x1,0xbe,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0x9,0x0,0xc,0x1,0xb2,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0xb,0x0,0x14,0x1,0x9e,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0xc,0x0,0x26,0x1,0x78,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0xd,0x0,0x5c,0x1,0x1c,0x0,0x3,0x0,0x1,0x4,0x9,0x0,0xe,0x0,0x54,0x0,0xc8,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x0,0x0,0xc,0x0,0xbc,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x1,0x0,0x8,0x0,0xb4,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x2,0x0,0x1e,0x0,0x96,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x3,0x0,0xa,0x0,0x8c,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x4,0x0,0x20,0x0,0x6c,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x5,0x0,0xe,0x2,0xa6,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x6,0x0,0x24,0x2,0x8,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x7,0x0,0xc,0x0,0x60,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x8,0x0,0x22,0x0,0x3e,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x9,0x0,0x8,0x0,0x36,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0xa,0x0,0x1e,0x0,0x18,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0xb,0x0,0xc,0x0,0xc,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0xc,0x0,0x8,0x0,0xb4,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0xd,0x0,0xa,0x0,0x8c,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0xe,0x0,0xe,0x2,0xa6,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0xf,0x0,0xc,0x0,0x60,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x10,0x0,0x8,0x0,0x36,0x0,0x3,0x0,0x1,0x4,0x9,0x1,0x11,0x0,0xc,0x0,0x0,0x0,0x4e,0x0,0x6f,0x0,0x72,0x0,0x6d,0x0,0x61,0x0,0x6c,0x0,0x49,0x0,0x74,0x0,0x61,0x0,0x6c,0x0,0x69,0x0,0x63,0x0,0x52,0x0,0x6f,0x0,0x62,0x0,0x6f,0x0,0x74,0x0,0x6f,0x0,0x4d,0x0,0x6f,0x0,0x6e,0x0,0x6f,0x0,0x2d,0x0,0x42,0x0,0x6f,0x0,0x6c,0x0,0x64,0x0,0x42,0x0,0x6f,0x0,0x6c,0x0,0x64,0x0,0x52,0x0,0x6f,0x0,0x62,0x0,0x6f,0x0,0x74,0x0,0x6f,0x0,0x4d,0x0,0x6f,0x0,0x6e,0x0,0x6f,0x0,0x2d,0x0,0x4d,0x0,0x65,0x0,0x64,0x0,0x69,0x0,0x75,0x0,0x6d,0x0,0x4d,0x0,0x65,0x0,0x64,0x0,0x69,0x0,0x75,0x0,0x6d,0x0,0x52,0x0,0x6f,0x0,0x62,0x0,0x6f,0x0,0x74,0x0,0x6f,0x0,0x4d,0x0,0x6f,0x0,0x6e,0x0,0x6f,0x0,0x2d,0x0,0x4c,0x0,0x69,0x0,0x67,0x0,0x68,0x0,0x74,0x0,0x4c,0x0,0x69,0x0,0x67,0x0,0x68,0x0,0x74,0x0,0x52,0x0,0x6f,0x0,0x62,0x0,0x6f,0x0,0x74,0x0,0x6f,0x0,0x4d,0x0,0x6f,0x0,0x6e,0x0,0x6f,0x0,0x2d,0x0,0x54,0x0,0x68,0x0,0x69,0x0,0x6e,0x0,0x54,0x0,0x68,0x0,0x69,0x0,0x6e,0x0,0x57,0x0,0x65,0x0,0x69,0x0,0x67,0x0,0x68,0x0,0x74,0x0,0x68,0x0,0x74,0x0,0x74,0x0,0x70,0x0,0x3a,0x0,0x2f,0x0,0x2f,0x0,0x77,0x0,0x77,0x0,0x77,0x0,0x2e,0x0,0x61,0x0,0x70,0x0,0x61,0x0,0x63,0x0,0x68,0x0,0x65,0x0,0x2e,0x0,0x6f,0x0,0x72,0x0,0x67,0x0,0x2f,0x0,0x6c,0x0,0x69,0x0,0x63,0x0,0x65,0x0,0x6e,0x0,0x73,0x0,0x65,0x0,0x73,0x0,0x2f,0x0,0x4c,0x0,0x49,0x0,0x43,0x0,0x45,0x0,0x4e,0x0,0x53,0x0,0x45,0x0,0x2d,0x0,0x32,0x0,0x2e,0x0,0x30,0x0,0x4c,0x0,0x69,0x0,0x63,0x0,0x65,0x0,0x6e,0x0,0x73,0x0,0x65,0x0,0x64,0x0,0x20,0x0,0x75,0x0,0x6e,0x0,0x64,0x0,0x65,0x0,0x72,0x0,0x20,0x0,0x74,0x0,0x68,0x0,0x65,0x0,0x20,0x0,0x41,0x0,0x70,0x0,0x61,0x0,0x63,0x0,0x68,0x0,0x65,0x0,0x20,0x0,0x4c,0x0,0x69,0x0,0x63,0x0,0x65,0x0,0x6e,0x0,0x73,0x0,0x65,0x0,0x2c,0x0,0x20,0x0,0x56,0x0,0x65,0x0,0x72,0x0,0x73,0x0,0x69,0x0,0x6f,0x0,0x6e,0x0,0x20,0x0,0x32,0x0,0x2e,0x0,0x30,0x0,0x43,0x0,0x68,0x0,0x72,0x0,0x69,0x0,0x73,0x0,0x74,0x0,0x69,0x0,0x61,0x0,0x6e,0x0,0x20,0x0,0x52,0x0,0x6f,0x0,0x62,0x0,0x65,0x0,0x72,0x0,0x74,0x0,0x73,0x0,0x6f,0x0,0x6e,0x0,0x47,0x0,0x6f,0x0,0x6f,0x0,0x67,0x0,0x6c,0x0,0x65,0x0,0x2e,0x0,0x63,0x0,0x6f,0x0,0x6d,0x0,0x47,0x0,0x6f,0x0,0x6f,0x0,0x67,0x0,0x6c,0x0,0x65,0x0,0x52,0x0,0x6f,0x0,0x62,0x0,0x6f,0x0,0x74,0x0,0x6f,0x0,0x20,0x0,0x4d,0x0,0x6f,0x0,0x6e,0x0,0x6f,0x0,0x20,0x0,0x69,0x0,0x73,0x0,0x20,0x0,0x61,0x0,0x20,0x0,0x74,0x0,0x72,0x0,0x61,0x0,0x64,0x0,0x65,0x0,0x6d,0x0,0x61,0x0,0x72,0x0,0x6b,0x0,0x20,0x0,0x6f,0x0,0x66,0x0,0x20,0x0,0x47,0x0,0x6f,0x0,0x6f,0x0,0x67,0x0,0x6c,0x0,0x65,0x0,0x2e,0x0,0x52,0x0,0x6f,0x0,0x62,0x0,0x6f,0x0,0x74,0x0,0x6f,0x0,0x4d,0x0,0x6f,0x0,0x6e,0x0,0x6f,0x0,0x2d,0x0,0x52,0x0,0x65,0x0,0x67,0x0,0x75,0x0,0x6c,0x0,0x61,0x0,0x72,0x0,0x56,0x0,0x65,0x0,0x72,0x0,0x73,0x0,0x69,0x0,0x6f,0x0,0x6e,0x0,0x20,0x0,0x33,0x0,0x2e,0x0,0x30,0x0,0x30,0x0,0x30,0x0,0x52,0x0,0x6f,0x0,0x62,0x0,0x6f,0x0,0x74,0x0,0x6f,0x0,0x20,0x0,0x4d,0x0,0x6f,0x0,0x6e,0x0,0x6f,0x0,0x20,0x0,0x52,0x0,0x65,0x0,0x67,0x0,0x75,0x0,0x6c,0x0,0x61,0x0,0x72,0x0,0x33,0x0,0x2e,0x0,0x30,0x0,0x30,0x0,0x30,0x0,0x3b,0x0,0x47,0x0,0x4f,0x0,0x4f,0x0,0x47,0x0,0x3b,0x0,0x52,0x0,0x6f,0x0,0x62,0x0,0x6f,0x0,0x74,0x0,0x6f,0x0,0x4d,0x0,0x6f,0x0,0x6e,0x0,0x6f,0x0,0x2d,0x0,0x52,0x0,0x65,0x0,0x67,0x0,0x75,0x0,0x6c,0x0,0x61,0x0,0x72,0x0,0x52,0x0,0x65,0x0,0x67,0x0,0x75,0x0,0x6c,0x0,0x61,0x0,0x72,0x0,0x52,0x0,0x6f,0x0,0x62,0x0,0x6f,0x0,0x74,0x0,0x6f,0x0,0x20,0x0,0x4d,0x0,0x6f,0x0,0x6e,0x0,0x6f,0x0,0x43,0x0,0x6f,0x0,0x70,0x0,0x79,0x0,0x72,0x0,0x69,0x0,0x67,0x0,0x68,0x0,0x74,0x0,0x20,0x0,0x32,0x0,0x30,0x0,0x31,0x0,0x35,0x0,0x20,0x0,0x54,0x0,0x68,0x0,0x65,0x0,0x20,0x0,0x52,0x0,0x6f,0x0,0x62,0x0,0x6f,0x0,0x74,0x0,0x6f,0x0,0x20,0x0,0x4d,0x0,0x6f,0x0,0x6e,0x0,0x6f,0x0,0x20,0x0,0x50,0x0,0x72,0x0,0x6f,0x0,0x6a,0x0,0x65,0x0,0x63,0x0,0x74,0x0,0x20,0x0,0x41,0x0,0x75,0x0,0x74,0x0,0x68,0x0,0x6f,0x0,0x72,0x0,0x73,0x0,0x20,0x0,0x28,0x0,0x68,0x0,0x74,0x0,0x74,0x0,0x70,0x0,0x73,0x0,0x3a,0x0,0x2f,0x0,0x2f,0x0,0x67,0x0,0x69,0x0,0x74,0x0,0x68,0x0,0x75,0x0,0x62,0x0,0x2e,0x0,0x63,0x0,0x6f,0x0,0x6d,0x0,0x2f,0x0,0x67,0x0,0x6f,0x0,0x6f,0x0,0x67,0x0,0x6c,0x0,0x65,0x0,0x66,0x0,0x6f,0x0,0x6e,0x0,0x74,0x0,0x73,0x0,0x2f,0x0,0x72,0x0,0x6f,0x0,0x62,0x0,0x6f,0x0,0x74,0x0,0x6f,0x0,0x6d,0x0,0x6f,0x0,0x6e,0x0,0x6f,0x0,0x29,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x3,0x0,0x0,0x0,0x14,0x0,0x3,0x0,0x1,0x0,0x0,0x0,0x14,0x0,0x4,0x7,0x4c,0x0,0x0,0x0,0xc2,0x0,0x80,0x0,0x6,0x0,0x42,0x0,0xd,0x0,0x2f,0x0,0x39,0x0,0x40,0x0,0x5a,0x0,0x60,0x0,0x7a,0x0,0x7e,0x1,0x7f,0x1,0x92,0x1,0xa1,0x1,0xb0,0x1,0xf0,0x1,0xff,0x2,0x1b,0x2,0x37,0x2,0x59,0x2,0xbc,0x2,0xc7,0x2,0xc9,0x2,0xdd,0x2,0xf3,0x3,0x1,0x3,0x3,0x3,0x9,0x3,0xf,0x3,0x23,0x3,0x8a,0x3,0x8c,0x3,0x92,0x3,0xa1,0x3,0xb0,0x3,0xb9,0x3,0xc9,0x3,0xce,0x3,0xd2,0x3,0xd6,0x4,0x25,0x4,0x2f,0x4,0x45,0x4,0x4f,0x4,0x62,0x4,0x6f,0x4,0x77,0x4,0x86,0x4,0xce,0x4,0xd7,0x4,0xe1,0x4,0xf5,0x5,0x1,0x5,0x10,0x5,0x13,0x1e,0x1,0x1e,0x3f,0x1e,0x85,0x1e,0xf1,0x1e,0xf3,0x1e,0xf9,0x1f,0x4d,0x20,0xb,0x20,0x15,0x20,0x1e,0x20,0x22,0x20,0x26,0x20,0x30,0x20,0x33,0x20,0x3a,0x20,0x3c,0x20,0x44,0x20,0x74,0x20,0x7f,0x20,0xa4,0x20,0xa7,0x20,0xac,0x21,0x5,0x21,0x13,0x21,0x16,0x21,0x22,0x21,0x26,0x21,0x2e,0x21,0x5e,0x22,0x2,0x22,0x6,0x22,0xf,0x22,0x12,0x22,0x15,0x22,0x1a,0x22,0x1e,0x22,0x2b,0x22,0x48,0x22,0x60,0x22,0x65,0x25,0xca,0xf6,0xc3,0xfe,0xff,0xff,0xfd,0xff,0xff,0x0,0x0,0x0,0xd,0x0,0x20,0x0,0x30,0x0,0x3a,0x0,0x41,0x0,0x5b,0x0,0x61,0x0,0x7b,0x0,0xa0,0x1,0x92,0x1,0xa0,0x1,0xaf,0x1,0xf0,0x1,0xfa,0x2,0x18,0x2,0x37,0x2,0x59,0x2,0xbc,0x2,0xc6,0x2,0xc9,0x2,0xd8,0x2,0xf3,0x3,0x0,0x3,0x3,0x3,0x9,0x3,0xf,0x3,0x23,0x3,0x84,0x3,0x8c,0x3,0x8e,0x3,0x93,0x3,0xa3,0x3,0xb1,0x3,0xba,0x3,0xca,0x3,0xd1,0x3,0xd6,0x4,0x0,0x4,0x26,0x4,0x30,0x4,0x46,0x4,0x50,0x4,0x63,0x4,0x70,0x4,0x78,0x4,0x88,0x4,0xcf,0x4,0xd8,0x4,0xe2,0x4,0xf6,0x5,0x2,0x5,0x11,0x1e,0x0,0x1e,0x3e,0x1e,0x80,0x1e,0xa0,0x1e,0xf2,0x1e,0xf4,0x1f,0x4d,0x20,0x0,0x20,0x13,0x20,0x17,0x20,0x20,0x20,0x25,0x20,0x30,0x20,0x32,0x20,0x39,0x20,0x3c,0x20,0x44,0x20,0x74,0x20,0x7f,0x20,0xa3,0x20,0xa7,0x20,0xab,0x21,0x5,0x21,0x13,0x21,0x16,0x21,0x22,0x21,0x26,0x21,0x2e,0x21,0x5b,0x22,0x2,0x22,0x6,0x22,0xf,0x22,0x11,0x22,0x15,0x22,0x1a,0x22,0x1e,0x22,0x2b,0x22,0x48,0x22,0x60,0x22,0x64,0x25,0xca,0xf6,0xc3,0xfe,0xff,0xff,0xfc,0xff,0xff,0x1,0x5c,0x0,0x0,0x0,0x6,0x0,0x0,0xff,0xc1,0x0,0x0,0xff,0xbb,0x0,0x0,0x0,0x0,0xfe,0xc4,0x0,0x0,0x0,0x0,0x1,0x33,0x0,0x0,0x0,0x62,0xff,0x3a,0xfd,0xf8,0x0,0x68,0x0,0x0,0xfe,0x95,0x0,0x0,0xfe,0x7f,0xfe,0x73,0xfe,0x72,0xfe,0x6d,0xfe,0x68,0xfe,0x42,0x0,0x0,0xff,0x4c,0xff,0x4b,0x0,0x0,0x0,0x0,0xfd,0xd4,0x0,0x0,0xff,0x2c,0xfd,0xc8,0xfd,0xc5,0x0,0x0,0xfd,0x83,0x0,0x0,0xfd,0x7b,0x0,0x0,0xfd,0x70,0x0,0x0,0xfd,0x6c,0x0,0x0,0xfe,0x6c,0x0,0x0,0xfe,0x69,0x0,0x0,0xfd,0x14,0x0,0x0,0xe5,0x27,0xe4,0xe7,0x0,0x0,0xe4,0xc6,0x0,0x0,0xe4,0xc4,0xe3,0xdc,0xe2,0x25,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe0,0x5d,0xe0,0x40,0xe0,0x41,0xe2,0xe6,0xe0,0x47,0xe1,0xc0,0xe1,0xb6,0xdf,0xb4,0xdf,0xb2,0x0,0x0,0xe1,0x32,0xe1,0x25,0xe1,0x23,0xdf,0x72,0xe0,0x5e,0xe1,0xc,0xe0,0xe0,0xe0,0x3d,0xdf,0x76,0xe0,0x31,0x0,0x0,0xde,0x74,0xe0,0x28,0xe0,0x25,0xe0,0x19,0xde,0x3b,0xde,0x22,0xde,0x22,0xdc,0x7b,0xa,0xa5,0x3,0x47,0x2,0x4b,0x0,0x1,0x0,0x0,0x0,0xc0,0x0,0x0,0x0,0xdc,0x0,0x0,0x0,0xe6,0x0,0x0,0x0,0xee,0x0,0xf4,0x0,0x0,0x2,0xb0,0x2,0xb2,0x0,0x0,0x2,0xb2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xb4,0x0,0x0,0x2,0xb4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0xb2,0x0,0x0,0x0,0x0,0x2,0xba,0x2,0xd6,0x0,0x0,0x2,0xee,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0x6,0x0,0x0,0x3,0x4e,0x0,0x0,0x3,0x76,0x0,0x0,0x3,0x98,0x0,0x0,0x3,0xa4,0x0,0x0,0x4,0x2e,0x0,0x0,0x4,0x3e,0x0,0x0,0x4,0x52,0x0,0x0,0x0,0x0,0x4,0x52,0x0,0x0,0x4,0x5a,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x56,0x4,0x5a,0x4,0x68,0x4,0x6c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x5c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x4a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x5b,0x0,0x6b,0x0,0x97,0x0,0x52,0x0,0x8c,0x0,0x98,0x0,0x6a,0x0,0x74,0x0,0x75,0x0,0x96,0x0,0x7c,0x0,0x5f,0x0,0x67,0x0,0x60,0x0,0x89,0x0,0x61,0x0,0x62,0x0,0x84,0x0,0x81,0x0,0x85,0x0,0x5d,0x0,0x99,0x0,0x76,0x0,0x8a,0x0,0x77,0x0,0x9c,0x0,0x66,0x1,0x5a,0x0,0x78,0x0,0x8e,0x0,0x79,0x0,0x9d,0x2,0x73,0x0,0x5c,0x0,0x53,0x0,0x54,0x0,0x5a,0x0,0x55,0x0,0x8f,0x0,0x9a,0x1,0x61,0x0,0x92,0x0,0x43,0x1,0x6a,0x0,0x88,0x2,0x74,0x0,0x93,0x1,0x5e,0x0,0x95,0x0,0x7e,0x0,0x41,0x0,0x42,0x1,0x5b,0x1,0x6b,0x0,0x9b,0x0,0x64,0x1,0x66,0x0,0x40,0x0,0x44,0x1,0x6c,0x0,0x46,0x0,0x45,0x0,0x47,0x0,0x5e,0x0,0xa2,0x0,0x9e,0x0,0xa0,0x0,0xa7,0x0,0xa1,0x0,0xa5,0x0,0x48,0x0,0xab,0x0,0xb5,0x0,0xaf,0x0,0xb2,0x0,0xb3,0x0,0xc4,0x0,0xbf,0x0,0xc1,0x0,0xc2,0x0,0xb9,0x0,0xd2,0x0,0xd7,0x0,0xd3,0x0,0xd5,0x0,0xdd,0x0,0xd6,0x0,0x7f,0x0,0xdb,0x0,0xeb,0x0,0xe7,0x0,0xe9,0x0,0xea,0x0,0xf6,0x0,0x4d,0x0,0x50,0x1,0x1,0x0,0xfd,0x0,0xff,0x1,0x6,0x1,0x0,0x1,0x4,0x0,0x49,0x1,0xa,0x1,0x14,0x1,0xe,0x1,0x11,0x1,0x12,0x1,0x21,0x1,0x1d,0x1,0x1f,0x1,0x20,0x0,0x4c,0x1,0x2f,0x1,0x34,0x1,0x30,0x1,0x32,0x1,0x3a,0x1,0x33,0x0,0x80,0x1,0x38,0x1,0x48,0x1,0x44,0x1,0x46,0x1,0x47,0x1,0x53,0x0,0x4e,0x1,0x55,0x0,0xa3,0x1,0x2,0x0,0x9f,0x0,0xfe,0x0,0xa4,0x1,0x3,0x0,0xa9,0x1,0x8,0x0,0xac,0x1,0xb,0x2,0x75,0x2,0x76,0x0,0xaa,0x1,0x9,0x0,0xad,0x1,0xc,0x0,0xae,0x1,0xd,0x0,0xb6,0x1,0x15,0x0,0xb0,0x1,0xf,0x0,0xb4,0x1,0x13,0x0,0xb8,0x1,0x17,0x0,0xb1,0x1,0x10,0x0,0xbb,0x1,0x19,0x0,0xba,0x1,0x18,0x2,0x77,0x2,0x78,0x0,0xbc,0x1,0x1a,0x0,0xbe,0x1,0x1c,0x0,0xbd,0x1,0x1b,0x0,0xc7,0x1,0x24,0x0,0xc5,0x1,0x22,0x0,0xc0,0x1,0x1e,0x0,0xc6,0x1,0x23,0x0,0xc3,0x1,0x6d,0x1,0x6e,0x1,0x6f,0x0,0xc8,0x1,0x25,0x0,0xc9,0x1,0x26,0x0,0x4f,0x0,0xca,0x1,0x27,0x0,0xcc,0x1,0x29,0x0,0xcb,0x1,0x28,0x0,0xcd,0x1,0x2a,0x0,0xce,0x1,0x2b,0x0,0xcf,0x1,0x2c,0x0,0xd1,0x1,0x2e,0x0,0xd0,0x1,0x2d,0x2,0x79,0x0,0xb7,0x1,0x16,0x0,0xda,0x1,0x37,0x0,0xd4,0x1,0x31,0x0,0xd9,0x1,0x36,0x0,0x4a,0x0,0x4b,0x0,0xde,0x1,0x3b,0x0,0xe0,0x1,0x3d,0x0,0xdf,0x1,0x3c,0x0,0xe1,0x1,0x3e,0x0,0xe4,0x1,0x41,0x0,0xe3,0x1,0x40,0x0,0xe2,0x1,0x3f,0x2,0x7e,0x2,0x80,0x0,0xe6,0x1,0x43,0x0,0xe5,0x1,0x42,0x0,0xf1,0x1,0x4e,0x0,0xee,0x1,0x4b,0x0,0xe8,0x1,0x45,0x0,0xf0,0x1,0x4d,0x0,0xed,0x1,0x4a,0x0,0xef,0x1,0x4c,0x0,0xf3,0x1,0x50,0x0,0xf7,0x1,0x54,0x0,0xf8,0x0,0xfa,0x1,0x57,0x0,0xfc,0x1,0x59,0x0,0xfb,0x1,0x58,0x1,0x70,0x0,0xd8,0x1,0x35,0x0,0xec,0x1,0x49,0x0,0xa6,0x1,0x5,0x0,0xa8,0x1,0x7,0x0,0xdc,0x1,0x39,0x1,0x5c,0x1,0x64,0x1,0x5f,0x1,0x60,0x1,0x62,0x1,0x67,0x1,0x5d,0x1,0x63,0x1,0x78,0x1,0x79,0x2,0xd4,0x1,0x7a,0x2,0xd5,0x2,0xd6,0x2,0xd7,0x1,0x7b,0x1,0x7c,0x2,0xde,0x2,0xdf,0x2,0xe0,0x1,0x7d,0x2,0xe1,0x2,0xe2,0x1,0x7e,0x2,0xe3,0x2,0xe4,0x1,0x7f,0x2,0xe5,0x1,0x80,0x2,0xe6,0x1,0x81,0x2,0xe7,0x2,0xe8,0x1,0x82,0x2,0xe9,0x1,0x83,0x1,0x84,0x2,0xea,0x2,0xeb,0x2,0xec,0x2,0xed,0x2,0xee,0x2,0xef,0x2,0xf0,0x2,0xf1,0x1,0x8e,0x2,0xf3,0x2,0xf4,0x1,0x8f,0x2,0xf2,0x1,0x90,0x1,0x91,0x1,0x92,0x1,0x93,0x1,0x94,0x1,0x95,0x1,0x96,0x2,0xf5,0x1,0x97,0x1,0x98,0x3,0x2a,0x2,0xfb,0x1,0x9c,0x2,0xfc,0x1,0x9d,0x2,0xfd,0x2,0xfe,0x2,0xff,0x3,0x0,0x1,0x9e,0x1,0x9f,0x1,0xa0,0x3,0x2,0x3,0x2b,0x3,0x3,0x1,0xa1,0x3,0x4,0x1,0xa2,0x3,0x5,0x3,0x6,0x1,0xa3,0x3,0x7,0x1,0xa4,0x1,0xa5,0x1,0xa6,0x3,0x8,0x3,0x1,0x1,0xa7,0x3,0x9,0x3,0xa,0x3,0xb,0x3,0xc,0x3,0xd,0x3,0xe,0x3,0xf,0x1,0xa8,0x3,0x10,0x3,0x11,0x3,0x12,0x1,0xb3,0x1,0xb4,0x1,0xb5,0x1,0xb6,0x3,0x13,0x1,0xb7,0x1,0xb8,0x1,0xb9,0x3,0x14,0x1,0xba,0x1,0xbb,0x1,0xbc,0x1,0xbd,0x3,0x15,0x1,0xbe,0x3,0x16,0x3,0x17,0x1,0xbf,0x3,0x18,0x1,0xc0,0x3,0x19,0x3,0x2c,0x3,0x1a,0x1,0xcb,0x3,0x1b,0x1,0xcc,0x3,0x1c,0x3,0x1d,0x3,0x1e,0x3,0x1f,0x1,0xcd,0x1,0xce,0x1,0xcf,0x3,0x20,0x3,0x2d,0x3,0x21,0x1,0xd0,0x1,0xd1,0x1,0xd2,0x3,0xd4,0x3,0x2e,0x3,0x2f,0x1,0xe0,0x1,0xe1,0x1,0xe2,0x1,0xe3,0x3,0x30,0x3,0x31,0x1,0xf3,0x1,0xf4,0x3,0xd9,0x3,0xda,0x3,0xd3,0x3,0xd2,0x1,0xf5,0x1,0xf6,0x1,0xf7,0x1,0xf8,0x3,0xd5,0x3,0xd6,0x1,0xf9,0x1,0xfa,0x3,0xcd,0x3,0xce,0x3,0x32,0x3,0x33,0x3,0xbf,0x3,0xc0,0x1,0xfb,0x1,0xfc,0x3,0xd7,0x3,0xd8,0x1,0xfd,0x1,0xfe,0x3,0xc1,0x3,0xc2,0x1,0xff,0x2,0x0,0x2,0x1,0x2,0x2,0x2,0x3,0x2,0x4,0x3,0x34,0x3,0x35,0x3,0xc3,0x3,0xc4,0x3,0x36,0x3,0x37,0x3,0xe1,0x3,0xe2,0x3,0xc5,0x3,0xc6,0x2,0x5,0x2,0x6,0x3,0xc7,0x3,0xc8,0x2,0x7,0x2,0x8,0x2,0x9,0x3,0xd1,0x2,0xa,0x2,0xb,0x3,0xcf,0x3,0xd0,0x3,0x38,0x3,0x39,0x3,0x3a,0x2,0xc,0x2,0xd,0x3,0xdf,0x3,0xe0,0x2,0xe,0x2,0xf,0x3,0xdb,0x3,0xdc,0x3,0xc9,0x3,0xca,0x3,0xdd,0x3,0xde,0x2,0x10,0x3,0x45,0x3,0x44,0x3,0x46,0x3,0x47,0x3,0x48,0x3,0x49,0x3,0x4a,0x2,0x11,0x2,0x12,0x3,0xcb,0x3,0xcc,0x3,0x5f,0x3,0x60,0x2,0x13,0x2,0x14,0x3,0x61,0x3,0x62,0x3,0xe3,0x3,0xe4,0x2,0x15,0x3,0x63,0x3,0xe5,0x3,0x64,0x3,0x65,0x0,0xf5,0x1,0x52,0x0,0xf2,0x1,0x4f,0x0,0xf4,0x1,0x51,0x0,0xf9,0x1,0x56,0x0,0x68,0x0,0x69,0x3,0xe6,0x2,0x31,0x0,0x6c,0x0,0x6d,0x0,0x6e,0x2,0x32,0x0,0x6f,0x0,0x70,0x0,0x71,0x0,0x90,0x0,0x91,0x0,0x65,0x2,0x33,0x0,0x63,0x3,0xbe,0x2,0x36,0x2,0x41,0x0,0x7d,0x4,0xcd,0x0,0x0,0x0,0x0,0x0,0x51,0x0,0xac,0x0,0x6b,0x0,0x9b,0x0,0xb6,0x0,0xbf,0x0,0x64,0x0,0x8d,0x0,0xae,0x0,0x62,0x0,0xac,0x0,0xc6,0x0,0x94,0x0,0x8f,0x0,0x6a,0x0,0xbf,0x0,0x5e,0x0,0xb5,0x0,0x76,0x0,0x4c,0x0,0x8b,0x0,0x47,0x0,0x49,0x0,0x57,0x0,0x3d,0x0,0x72,0x0,0x9c,0x0,0xaf,0x0,0x8f,0x0,0x8b,0x0,0x87,0x0,0x98,0x0,0x8c,0x0,0xae,0x0,0xcb,0x0,0xd3,0x0,0xb0,0x0,0xcb,0x0,0x5d,0x0,0xae,0x0,0x7a,0x0,0xad,0x0,0x8c,0x1,0x49,0x0,0xaf,0x0,0x8e,0x0,0xb4,0x0,0x62,0x0,0x30,0x0,0x6e,0x0,0x44,0x0,0xa0,0x0,0x91,0x0,0xd0,0x0,0x55,0x0,0x5e,0x0,0x4b,0x0,0xbb,0x0,0x8d,0x0,0x70,0x0,0xb1,0x0,0x95,0x1,0x82,0x1,0x3c,0x1,0x43,0x1,0x1c,0x1,0x10,0x0,0x24,0x0,0x30,0x0,0x26,0x0,0x20,0x0,0x2b,0x0,0x4f,0x0,0x2e,0x0,0x49,0x0,0xa8,0x0,0xad,0x0,0xba,0x0,0xa9,0x0,0xb1,0x0,0xa2,0x0,0x93,0x0,0x71,0x0,0x21,0x0,0xa0,0x0,0x11,0x0,0x69,0x0,0x7f,0x0,0x67,0x1,0xe6,0x1,0xf2,0x0,0xbf,0x0,0xcc,0x1,0x62,0x1,0xf0,0x2,0x22,0x1,0xe6,0x1,0x9,0x1,0xf8,0x1,0x9a,0x0,0x9b,0x0,0xda,0x0,0x4a,0x0,0x4f,0x1,0xee,0x1,0x62,0x1,0xec,0x1,0xcd,0x1,0xbc,0x1,0x49,0x1,0x2d,0x1,0x2f,0x1,0xee,0x1,0x62,0x1,0x65,0x1,0x40,0x1,0xaa,0x1,0x95,0x1,0x43,0x1,0x43,0x1,0x8c,0x1,0x8c,0x0,0x77,0x0,0xa9,0x0,0x9c,0x0,0xb5,0x0,0x73,0x0,0xad,0x0,0xa9,0x0,0x8d,0x0,0xaa,0x0,0xb2,0x0,0xbb,0x0,0xc2,0x0,0xbd,0x0,0xfc,0x0,0xe7,0x1,0x2b,0x0,0x2c,0x0,0x36,0x2,0x1c,0x1,0xff,0x0,0x77,0x0,0x79,0x0,0x5a,0x0,0x57,0x0,0x67,0x1,0x69,0x0,0xa0,0x0,0x3d,0x0,0x6b,0x0,0x40,0x0,0x57,0x0,0xd3,0x0,0xe7,0x0,0x30,0x0,0x51,0x0,0x51,0x0,0x51,0x0,0x51,0x0,0x51,0x0,0x51,0x0,0x51,0x0,0x51,0x0,0x51,0x0,0x51,0x0,0x20,0x0,0x6b,0x0,0x6b,0x0,0x6b,0x0,0x6b,0x0,0x9b,0xff,0xc5,0x0,0xb6,0x0,0xb6,0x0,0xb6,0x0,0xb6,0x0,0xb6,0x0,0xb6,0x0,0xb6,0x0,0xb6,0x0,0xaf,0x0,0xb6,0xff,0xc5,0x0,0x64,0x0,0x64,0x0,0x64,0x0,0x18,0x0,0x8d,0x0,0xae,0x0,0xae,0x0,0xae,0x0,0xae,0x0,0xae,0x0,0xae,0x0,0xae,0x0,0xae,0x0,0xae,0x0,0x62,0x0,0xac,0x0,0xc6,0x0,0xc6,0x0,0xc6,0x0,0xc6,0x0,0x3a,0x0,0x8f,0x0,0x8f,0x0,0x8f,0x0,0x8f,0x0,0x6a,0x0,0x6a,0x0,0x6a,0x0,0x6a,0x0,0x6a,0x0,0x63,0x0,0x6a,0x0,0x6a,0x0,0x47,0x0,0x47,0x0,0x6a,0x0,0xb5,0x0,0xb5,0x0,0xb5,0x0,0x76,0x0,0x76,0x0,0x76,0x0,0x76,0x0,0x4c,0x0,0x4c,0x0,0x8b,0x0,0x8b,0x0,0x8b,0x0,0x8b,0x0,0x8b,0x0,0x8b,0x0,0x8b,0x0,0x8b,0x0,0x8b,0x0,0x8b,0x0,0x8b,0x0,0x49,0x0,0x49,0x0,0x49,0x0,0x49,0x0,0x3d,0x0,0x3d,0x0,0x3d,0x0,0x3d,0x0,0x72,0x0,0x72,0x0,0x72,0x0,0x9c,0x0,0x9c,0x0,0x9c,0x0,0x9c,0x0,0x9c,0x0,0x9c,0x0,0x9c,0x0,0x9c,0x0,0x9c,0x0,0x9c,0x0,0x2b,0x0,0x8f,0x0,0x8f,0x0,0x8f,0x0,0x8f,0x0,0x64,0x0,0x7c,0x0,0x87,0x0,0x87,0x0,0x87,0x0,0x87,0x0,0x87,0x0,0x87,0x0,0x87,0x0,0x87,0x0,0xb8,0x0,0x87,0x0,0x8c,0x0,0x8c,0x0,0x8c,0x0,0xb,0xff,0xe7,0x0,0xcb,0x0,0xcb,0x0,0xcb,0x0,0xcb,0x0,0xcb,0x0,0xcb,0x0,0xcb,0x0,0xcb,0x0,0xb0,0x0,0xb0,0x0,0xcb,0x0,0x99,0x0,0xcb,0x0,0x85,0x0,0xcb,0x0,0xae,0x0,0xae,0x0,0xae,0x0,0xae,0x0,0x7a,0x0,0x7a,0x0,0x7a,0x0,0x7a,0x0,0x7a,0x0,0x77,0x0,0x7a,0x0,0x7a,0x0,0x7a,0x0,0x7a,0x0,0x7a,0x1,0x49,0x1,0x14,0x1,0x10,0x0,0xaf,0x0,0xaf,0x0,0xaf,0x0,0xaf,0x0,0x8e,0x0,0x7f,0x0,0xb4,0x0,0xb4,0x0,0xb4,0x0,0xb4,0x0,0xb4,0x0,0xb4,0x0,0xb4,0x0,0xb4,0x0,0xb4,0x0,0xb4,0x0,0xb4,0x0,0x30,0x0,0x30,0x0,0x30,0x0,0x30,0x0,0x44,0x0,0x44,0x0,0x44,0x0,0x44,0x0,0xa0,0x0,0xa0,0x0,0xa0,0x1,0x9f,0x1,0x9a,0x0,0xc1,0x0,0x8a,0x1,0x1,0x1,0x3b,0x1,0xf2,0x1,0x1f,0x1,0x9a,0x0,0xf6,0x1,0x30,0xfd,0x27,0x1,0xcd,0x1,0x8e,0x1,0x2e,0x0,0x0,0x0,0xd4,0x0,0xbc,0x0,0xf1,0x0,0xcb,0x0,0x80,0x0,0x50,0x1,0xc8,0x0,0xb0,0x1,0xad,0xfc,0xca,0xfd,0x68,0xfc,0x88,0xfd,0x59,0xfc,0x5,0x2,0x29,0x1,0x13,0x2,0x30,0x0,0xb5,0x0,0x2e,0x0,0x6a,0x0,0x36,0x0,0x91,0x0,0xa2,0x0,0x70,0x0,0x45,0x0,0x65,0x0,0x61,0x0,0x81,0x0,0xae,0x0,0x47,0x0,0x78,0x0,0x8b,0x0,0x75,0x0,0xa4,0x0,0xb9,0x0,0xb8,0x0,0x39,0x0,0xaf,0x0,0x59,0x0,0xa5,0x0,0x78,0x0,0x6d,0x0,0xad,0x0,0x9e,0x0,0x6e,0x0,0x61,0x0,0x4f,0x0,0x98,0x0,0x36,0x0,0x2e,0x0,0x2a,0x0,0x81,0x0,0x1e,0x0,0x83,0x0,0x43,0x0,0xa2,0x0,0xa2,0x0,0x46,0x0,0x1d,0x0,0x59,0x0,0xa2,0x0,0x2f,0x0,0x2b,0x0,0xa6,0x0,0xab,0x0,0x7d,0x0,0x7d,0x0,0x32,0x0,0x90,0x0,0xa8,0x0,0x72,0x0,0x77,0x0,0x41,0x0,0x81,0x0,0xa4,0x0,0xb7,0x0,0x36,0x0,0x11,0x0,0x87,0x0,0xa5,0x0,0xa4,0x0,0x37,0x0,0x89,0x0,0xa5,0x0,0xa5,0x0,0x68,0x0,0x7a,0x0,0xaa,0x0,0x8d,0x0,0x81,0x0,0x76,0x0,0x39,0x0,0x90,0x0,0xa5,0x0,0x81,0x0,0x71,0x0,0x4f,0xff,0xe9,0x0,0x8f,0x0,0x26,0x0,0x82,0x0,0x1c,0x0,0xa5,0x0,0x6b,0x0,0x5f,0x0,0x1c,0x0,0x7d,0x0,0x9b,0x0,0x27,0x0,0x57,0x0,0x71,0x0,0x70,0x0,0x55,0x0,0x69,0x0,0x50,0x0,0x51,0x0,0xca,0x0,0xde,0x0,0x63,0x0,0x5d,0x0,0x1a,0x0,0x51,0x0,0x45,0x0,0x37,0x0,0x6a,0x0,0x7a,0x0,0x4d,0x0,0x67,0x0,0x71,0x0,0x5f,0x0,0x97,0x0,0xbf,0x0,0x76,0x0,0xd1,0x0,0xfc,0x1,0xc3,0x2,0x3c,0xfe,0xab,0xfe,0xb4,0x0,0xbf,0x0,0xad,0x0,0xb6,0x0,0xb6,0x0,0xb9,0x0,0xb8,0x0,0xae,0x0,0xa3,0x0,0x2d,0x0,0x38,0x0,0x72,0x0,0x6e,0x0,0x6d,0x0,0x74,0x0,0x68,0x0,0x5c,0x0,0x39,0x0,0x34,0x0,0xab,0x0,0x92,0x0,0xe3,0x0,0x26,0x0,0x26,0x0,0xc8,0x0,0xb4,0x0,0xb6,0x0,0xb3,0x0,0x5a,0x0,0x94,0x0,0x89,0x0,0x42,0x0,0x74,0x0,0x61,0x0,0x4d,0x0,0x65,0x0,0x37,0x0,0x50,0x0,0xb3,0x0,0xd0,0x0,0x14,0x0,0x2f,0x0,0x6f,0x0,0x75,0x0,0x8e,0x0,0xa0,0x0,0x4c,0x0,0x49,0x0,0x6c,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xa6,0x1,0xcf,0x1,0x5c,0x1,0xf,0x1,0x4b,0x0,0x7f,0x0,0x49,0x0,0xdd,0x0,0x79,0x0,0x99,0x0,0x50,0x0,0x33,0x0,0x24,0x0,0x41,0x0,0x7e,0x0,0xa7,0x0,0x33,0x0,0x39,0x0,0x35,0x0,0xf8,0x0,0x8e,0x0,0x0,0x0,0x5c,0x0,0xf,0x1,0x11,0x0,0xfc,0x0,0x10,0x1,0xb,0x1,0x3e,0x1,0xf9,0x0,0x36,0x0,0xd0,0x0,0x6e,0x0,0xb7,0x0,0xc8,0x0,0xe7,0x0,0x7c,0x0,0x9b,0x0,0xd9,0x0,0x96,0x0,0xb4,0x0,0xd1,0x0,0x9b,0x0,0xc2,0x0,0x82,0x0,0x5e,0x0,0x90,0x0,0x8a,0x0,0x5d,0x0,0xb5,0x0,0x56,0x0,0x2f,0x0,0x60,0x0,0x4d,0x0,0xb9,0x1,0x52,0x1,0x42,0x1,0x35,0x1,0xd1,0x1,0xf5,0x1,0x74,0x2,0x6,0x1,0x60,0x0,0xcc,0x0,0xa9,0x0,0xd2,0x0,0x0,0x0,0xda,0x0,0x6b,0x0,0x8f,0x0,0x64,0x0,0x8c,0xff,0xba,0x0,0x76,0x0,0xaf,0x0,0x4c,0x0,0x8e,0x0,0x4c,0x0,0x5d,0x0,0x8e,0xff,0xe7,0xff,0xe7,0x0,0x5d,0x0,0x36,0x0,0x36,0x0,0x36,0x0,0x36,0x0,0x36,0x0,0x36,0x0,0x36,0x0,0x6e,0x0,0xc8,0x0,0xc8,0x0,0xc8,0x0,0xc8,0x0,0xd9,0x0,0xd9,0x0,0xd9,0x0,0xd9,0x0,0xc2,0x0,0x82,0x0,0x82,0x0,0x82,0x0,0x82,0x0,0x82,0x0,0xb5,0x0,0xb5,0x0,0xb5,0x0,0xb5,0x0,0x4d,0x0,0x36,0x0,0x36,0x0,0x36,0x0,0x6e,0x0,0x6e,0x0,0x6e,0x0,0xb7,0x0,0xc8,0x0,0xc8,0x0,0xc8,0x0,0xc8,0x0,0xc8,0x0,0x7c,0x0,0x7c,0x0,0x7c,0x0,0x9b,0x0,0xd9,0x0,0xd9,0x0,0xd9,0x0,0xd9,0x0,0xd9,0x0,0x96,0x0,0xb4,0x0,0xb6,0x0,0xd1,0x0,0xd1,0x0,0xd1,0x0,0xc2,0x0,0xc2,0x0,0xc2,0x0,0x82,0x0,0x82,0x0,0x82,0x0,0x90,0x0,0x90,0x0,0x90,0x0,0x8a,0x0,0x8a,0x0,0x8a,0x0,0x8a,0x0,0x5d,0x0,0xb5,0x0,0xb5,0x0,0xb5,0x0,0xb5,0x0,0xb5,0x0,0xb5,0x0,0x2f,0x0,0x4d,0x0,0x4d,0x0,0xb9,0x0,0xb9,0x0,0xb9,0x0,0x51,0xff,0xdd,0xff,0xcb,0xff,0xba,0xff,0xff,0xff,0x80,0xff,0xfb,0x0,0xb8,0x0,0x51,0x0,0xac,0x0,0xb6,0x0,0x72,0x0,0x8d,0x0,0xae,0x0,0xac,0x0,0x94,0x0,0x8f,0x0,0x6a,0x0,0xbf,0x0,0x4c,0x0,0x3d,0x0,0x57,0x0,0xae,0x0,0x3d,0x0,0x81,0x0,0x8b,0x0,0xa4,0x0,0xb8,0x0,0x9e,0x0,0xba,0x0,0x7a,0x0,0xbc,0x0,0x62,0x0,0x6e,0x0,0xb8,0x0,0x9e,0x0,0x7a,0x0,0x9e,0x0,0x4f,0x0,0xb6,0x0,0xb5,0x0,0x76,0x0,0xae,0x0,0xae,0x0,0x62,0x0,0xa9,0x0,0xac,0x0,0x2b,0x0,0x51,0x0,0xac,0x0,0xb5,0x0,0xb6,0x0,0xa2,0x0,0x94,0x0,0x8d,0x0,0x6a,0x0,0xa2,0x0,0xbf,0x0,0x6b,0x0,0x4c,0x0,0x45,0x0,0x57,0x0,0x9c,0x0,0x87,0x0,0xa5,0x0,0x7a,0x0,0xad,0x0,0x8f,0x0,0x44,0x0,0x6e,0x0,0x87,0x0,0xb7,0x0,0xaf,0x0,0xcb,0x0,0xcb,0x0,0xd3,0x0,0xa4,0x0,0x44,0x0,0x68,0x0,0xb0,0x1,0xcd,0x0,0x94,0x0,0x5d,0x0,0x51,0x0,0x9c,0xff,0x89,0x0,0xb6,0x0,0xa2,0x0,0x87,0x0,0xa5,0x0,0x65,0x0,0x61,0x0,0x1a,0x0,0x40,0x0,0x59,0x0,0x87,0x0,0x6b,0x0,0x8f,0x0,0x3d,0x0,0x47,0x0,0xae,0x0,0x1d,0x0,0x11,0x0,0xae,0x0,0x51,0x0,0x9c,0x0,0x51,0x0,0x9c,0x0,0x20,0x0,0x2b,0x0,0xb6,0x0,0x87,0x0,0x5a,0x0,0xb1,0x0,0xb1,0x0,0x1d,0x0,0x11,0x0,0x59,0x0,0x87,0x0,0xa2,0x0,0xa5,0x0,0xa2,0x0,0xa5,0x0,0x6a,0x0,0x7a,0x0,0x63,0x0,0x5d,0x0,0x63,0x0,0x5d,0x0,0x72,0x0,0x81,0x0,0x2b,0x0,0x44,0x0,0x2b,0x0,0x44,0x0,0x2b,0x0,0x44,0x0,0xab,0x0,0x8d,0x0,0x90,0x0,0x90,0x0,0x57,0x0,0x6e,0x0,0x8b,0x0,0x2f,0x0,0x37,0x0,0x51,0x0,0x9c,0x0,0x51,0x0,0x9c,0x0,0x51,0x0,0x9c,0xff,0xfc,0xff,0xf8,0x0,0x51,0x0,0x9c,0x0,0x51,0x0,0x9c,0x0,0x51,0x0,0x9c,0x0,0x51,0x0,0x9c,0x0,0x51,0x0,0x9c,0x0,0x51,0x0,0x9c,0x0,0x51,0x0,0x9c,0x0,0x51,0x0,0x9c,0x0,0xb6,0x0,0x87,0x0,0xb6,0x0,0x87,0x0,0xb6,0x0,0x87,0x0,0xb6,0x0,0x87,0xff,0xf2,0xff,0xf3,0x0,0xb6,0x0,0x87,0x0,0xb6,0x0,0x87,0x0,0xb6,0x0,0x87,0x0,0xae,0x0,0xcb,0x0,0xae,0x0,0xcb,0x0,0x6a,0x0,0x7a,0x0,0x6a,0x0,0x7a,0x0,0x6a,0x0,0x7a,0x0,0x0,0xff,0xed,0x0,0x6a,0x0,0x7a,0x0,0x6a,0x0,0x7a,0x0,0x6a,0x0,0x7a,0x0,0x63,0x0,0x77,0x0,0x63,0x0,0x77,0x0,0x63,0x0,0x77,0x0,0x63,0x0,0x77,0x0,0x63,0x0,0x77,0x0,0x8b,0x0,0xb4,0x0,0x8b,0x0,0xb4,0x0,0x8b,0x0,0xb4,0x0,0x8b,0x0,0xb4,0x0,0x8b,0x0,0xb4,0x0,0x8b,0x0,0xb4,0x0,0x8b,0x0,0xb4,0x0,0x3d,0x0,0x44,0x0,0x3d,0x0,0x44,0x0,0x3d,0x0,0x44,0x0,0x7c,0x0,0xa9,0x0,0xa4,0x0,0x8d,0x0,0xa5,0x0,0x4c,0x0,0x68,0x0,0x57,0x0,0x6e,0x0,0xab,0x0,0x8d,0x0,0xab,0x0,0x8d,0x0,0xb5,0x0,0xb7,0x0,0x1d,0x0,0x11,0x0,0x26,0x0,0x26,0x0,0xae,0x0,0x12,0xff,0xd4,0xff,0xd4,0xff,0xfd,0xff,0xfb,0xff,0xff,0xff,0xe9,0x0,0xa2,0x0,0xa5,0x0,0x8d,0x0,0xa5,0x0,0x94,0x0,0x89,0x0,0x2f,0x0,0x37,0x0,0x3d,0x0,0x47,0x0,0x57,0x0,0x6e,0x0,0x8b,0x0,0x4f,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1c,0x0,0x79,0x0,0xda,0x1,0x21,0x1,0x3a,0x1,0x50,0x1,0xba,0x1,0xd2,0x1,0xea,0x2,0x1a,0x2,0x38,0x2,0x48,0x2,0x68,0x2,0x80,0x2,0xf5,0x3,0x2c,0x3,0xa5,0x3,0xe2,0x4,0x51,0x4,0x64,0x4,0x97,0x4,0xad,0x4,0xd1,0x4,0xf0,0x5,0x8,0x5,0x20,0x5,0x8c,0x5,0xf4,0x6,0x42,0x6,0x86,0x6,0xd2,0x7,0x5,0x7,0x7c,0x7,0xb1,0x7,0xdf,0x8,0x21,0x8,0x3f,0x8,0x54,0x8,0xad,0x8,0xe0,0x9,0x2e,0x9,0x84,0x9,0xda,0xa,0x1,0xa,0x6e,0xa,0xa8,0xa,0xd6,0xa,0xec,0xb,0x11,0xb,0x30,0xb,0x64,0xb,0x7b,0xb,0xd7,0xb,0xe9,0xc,0x2c,0xc,0x9b,0xc,0xba,0xd,0x5,0xd,0x67,0xd,0x79,0xe,0x8,0xe,0x6a,0xe,0x7c,0xe,0xbf,0xf,0x2e,0xf,0x9b,0xf,0xe9,0x10,0x42,0x10,0x75,0x11,0x5,0x11,0x2c,0x11,0xe9,0x12,0x36,0x12,0xe3,0x13,0x51,0x13,0x88,0x13,0xde,0x13,0xfc,0x14,0x74,0x14,0xcc,0x15,0x41,0x15,0x97,0x15,0xe6,0x16,0x13,0x16,0x5b,0x16,0x67,0x16,0xbf,0x17,0x1a,0x17,0x76,0x17,0x94,0x17,0xb2,0x18,0xf,0x18,0x6c,0x18,0x81,0x18,0x97,0x18,0xa3,0x18,0xb0,0x18,0xc1,0x18,0xd8,0x19,0x3,0x19,0x10,0x19,0x1d,0x19,0x2a,0x19,0x37,0x19,0x47,0x19,0x61,0x19,0x7b,0x19,0x95,0x19,0xae,0x19,0xbb,0x19,0xc8,0x19,0xf4,0x19,0xfc,0x1a,0x4,0x1a,0x46,0x1a,0x88,0x1a,0x9b,0x1a,0xad,0x1a,0xef,0x1b,0x42,0x1b,0x56,0x1b,0x6a,0x1b,0x82,0x1b,0x8f,0x1b,0xae,0x1b,0xcf,0x1b,0xfd,0x1c,0x11,0x1c,0x35,0x1c,0x84,0x1c,0x9a,0x1c,0xb1,0x1c,0xce,0x1c,0xec,0x1c,0xfd,0x1d,0xc,0x1d,0x1b,0x1d,0x2b,0x1d,0xca,0x1e,0xb2,0x1e,0xc0,0x1e,0xd4,0x1e,0xec,0x1f,0xe,0x1f,0x9e,0x20,0xc,0x20,0x33,0x20,0x7d,0x20,0xa1,0x20,0xda,0x21,0x73,0x22,0x26,0x22,0xf5,0x23,0x13,0x23,0x29,0x23,0x77,0x23,0x83,0x23,0x8f,0x23,0x9b,0x23,0xa7,0x23,0xb3,0x23,0xbf,0x24,0x2,0x24,0xe,0x24,0x1a,0x24,0x26,0x24,0x32,0x24,0x3e,0x24,0x4a,0x24,0x55,0x24,0x61,0x24,0x6d,0x24,0xac,0x24,0xb8,0x24,0xc4,0x24,0xd0,0x24,0xdc,0x24,0xe8,0x24,0xf4,0x25,0x0,0x25,0xc,0x25,0x3e,0x25,0x7e,0x25,0xbd,0x25,0xc9,0x25,0xd5,0x25,0xe1,0x26,0xa,0x26,0x16,0x26,0x22,0x26,0x2e,0x26,0x3a,0x26,0x46,0x26,0x52,0x26,0x5e,0x26,0x6a,0x26,0xaa,0x26,0xb6,0x26,0xc2,0x26,0xce,0x26,0xda,0x26,0xe6,0x26,0xf2,0x26,0xfe,0x27,0x1a,0x27,0x26,0x27,0x32,0x27,0x3e,0x27,0x4a,0x27,0x56,0x27,0x62,0x27,0x6e,0x27,0x7a,0x27,0x86,0x27,0xee,0x27,0xfa,0x28,0x6,0x28,0x79,0x28,0x85,0x28,0x91,0x28,0x9d,0x28,0xa9,0x28,0xb5,0x28,0xc1,0x28,0xcd,0x28,0xd8,0x28,0xe4,0x29,0x0,0x29,0xc,0x29,0x18,0x29,0x24,0x29,0x30,0x29,0x3c,0x29,0x48,0x29,0x8f,0x29,0x9b,0x29,0xa7,0x2a,0x5,0x2a,0x11,0x2a,0x1d,0x2a,0x29,0x2a,0x35,0x2a,0x41,0x2a,0x4d,0x2a,0x59,0x2a,0x65,0x2a,0x71,0x2a,0x7d,0x2a,0x89,0x2a,0x95,0x2a,0xa1,0x2a,0xad,0x2a,0xb8,0x2a,0xc4,0x2a,0xcf,0x2a,0xda,0x2a,0xe5,0x2b,0x78,0x2b,0x83,0x2b,0x8e,0x2b,0x9a,0x2b,0xa6,0x2b,0xb2,0x2b,0xbd,0x2b,0xc8,0x2b,0xd4,0x2b,0xe0,0x2c,0x3f,0x2c,0x4a,0x2c,0x55,0x2c,0x60,0x2c,0x6b,0x2c,0x76,0x2c,0x81,0x2c,0x8c,0x2c,0x97,0x2c,0xe3,0x2d,0x55,0x2d,0x60,0x2d,0x6b,0x2d,0x76,0x2d,0xb4,0x2d,0xc0,0x2d,0xcc,0x2d,0xd7,0x2d,0xe3,0x2d,0xee,0x2d,0xf9,0x2e,0x4,0x2e,0x51,0x2e,0x5d,0x2e,0x69,0x2e,0x75,0x2e,0x81,0x2e,0x8d,0x2e,0x99,0x2e,0xa5,0x2e,0xc8,0x2e,0xd3,0x2e,0xde,0x2e,0xea,0x2e,0xf5,0x2f,0x0,0x2f,0xb,0x2f,0x16,0x2f,0x21,0x2f,0x2c,0x2f,0x8c,0x2f,0x98,0x2f,0xa3,0x30,0x9,0x30,0x14,0x30,0x20,0x30,0x2b,0x30,0x36,0x30,0x42,0x30,0x4e,0x30,0x59,0x30,0x64,0x30,0x70,0x30,0xb1,0x30,0xbd,0x30,0xc8,0x30,0xd3,0x30,0xde,0x30,0xe9,0x30,0xf4,0x31,0x32,0x31,0x3e,0x31,0x49,0x31,0x9e,0x31,0xa9,0x31,0xb5,0x31,0xc0,0x31,0xcb,0x31,0xd6,0x31,0xe1,0x31,0xed,0x31,0xf9,0x32,0x4,0x32,0xf,0x32,0x1b,0x32,0x26,0x32,0x31,0x32,0x40,0x32,0x4f,0x32,0x63,0x32,0x9f,0x32,0xac,0x32,0xd7,0x32,0xee,0x33,0x15,0x33,0x5f,0x33,0x76,0x33,0x89,0x33,0x9f,0x33,0xcd,0x33,0xfc,0x34,0x11,0x34,0x11,0x34,0x1e,0x34,0x50,0x34,0x5d,0x34,0x72,0x34,0xa2,0x35,0x0,0x35,0x25,0x35,0x57,0x35,0x8f,0x35,0x9e,0x35,0xad,0x35,0xb6,0x35,0xe5,0x35,0xfc,0x36,0xb,0x36,0x3a,0x36,0x42,0x36,0x52,0x36,0x6d,0x36,0xc4,0x36,0xd8,0x36,0xf2,0x37,0x5,0x37,0x21,0x37,0x7b,0x37,0xb5,0x38,0xd,0x38,0x7f,0x38,0xf4,0x39,0x11,0x39,0x8e,0x3a,0x6,0x3a,0x62,0x3a,0x96,0x3a,0xec,0x3b,0x19,0x3b,0x64,0x3b,0xeb,0x3c,0x1b,0x3c,0x6e,0x3c,0xcf,0x3d,0x22,0x3d,0x52,0x3d,0x8d,0x3d,0xf3,0x3e,0x34,0x3e,0xb0,0x3f,0x22,0x3f,0x6f,0x3f,0xf5,0x40,0x33,0x40,0x87,0x40,0xe4,0x41,0x20,0x41,0x51,0x41,0x6a,0x41,0xa2,0x41,0xe0,0x42,0xa,0x42,0x82,0x42,0x9b,0x42,0xcf,0x43,0x1,0x43,0x1a,0x43,0x45,0x43,0x5d,0x43,0x7a,0x43,0xb0,0x43,0xec,0x44,0x21,0x44,0x75,0x44,0xcf,0x45,0xa,0x45,0x81,0x45,0xda,0x45,0xea,0x46,0x1d,0x46,0x48,0x46,0xc0,0x46,0xd8,0x46,0xf5,0x47,0x25,0x47,0x3f,0x47,0x57,0x47,0x6a,0x47,0x7d,0x47,0xdc,0x47,0xf5,0x48,0x24,0x48,0x3c,0x48,0x5a,0x48,0x90,0x48,0xcc,0x49,0x1,0x49,0x52,0x49,0xa9,0x49,0xe1,0x4a,0x38,0x4a,0x8a,0x4a,0xdf,0x4b,0x1d,0x4b,0x5b,0x4b,0x74,0x4b,0xcb,0x4c,0x21,0x4c,0x60,0x4c,0xdd,0x4d,0x4a,0x4d,0x6f,0x4d,0x94,0x4d,0xc2,0x4d,0xf0,0x4e,0x38,0x4e,0x84,0x4e,0xd5,0x4f,0x28,0x4f,0xbc,0x50,0x59,0x50,0xd4,0x51,0x28,0x51,0x54,0x51,0x83,0x51,0xfe,0x52,0x77,0x52,0xfb,0x53,0x58,0x54,0x2f,0x54,0xf2,0x55,0x5e,0x55,0xc0,0x56,0x2,0x56,0x48,0x56,0x74,0x56,0x88,0x56,0xc0,0x56,0xd1,0x56,0xe1,0x57,0xc1,0x58,0x15,0x58,0x55,0x58,0xb4,0x58,0xc7,0x58,0xda,0x59,0x10,0x59,0x46,0x59,0x6b,0x59,0x8f,0x59,0xaf,0x59,0xcf,0x59,0xea,0x5a,0x5,0x5a,0x51,0x5a,0x89,0x5b,0x24,0x5b,0xc4,0x5b,0xe2,0x5c,0x0,0x5c,0x3b,0x5c,0x71,0x5c,0x9b,0x5d,0x10,0x5d,0x6a,0x5d,0xa9,0x5d,0xe3,0x5e,0x14,0x5e,0x45,0x5e,0xb5,0x5e,0xfc,0x5f,0x43,0x5f,0x53,0x5f,0x63,0x5f,0x98,0x5f,0xe8,0x60,0x96,0x61,0x11,0x61,0x89,0x61,0xee,0x62,0x58,0x62,0xd3,0x63,0x48,0x63,0xa2,0x63,0xf7,0x64,0x55,0x64,0xa7,0x64,0xf8,0x65,0x3b,0x65,0xaa,0x65,0xaa,0x65,0xaa,0x65,0xaa,0x65,0xaa,0x65,0xaa,0x65,0xaa,0x65,0xaa,0x65,0xaa,0x65,0xaa,0x65,0xaa,0x65,0xaa,0x65,0xaa,0x65,0xb6,0x65,0xd0,0x65,0xdd,0x65,0xfc,0x66,0x30,0x66,0x7f,0x67,0x1d,0x67,0x7d,0x67,0xe3,0x68,0x28,0x68,0xcc,0x69,0xcd,0x6a,0xa5,0x6b,0x49,0x6b,0xb7,0x6b,0xca,0x6b,0xe6,0x6c,0x0,0x6c,0xd1,0x6d,0x10,0x6d,0x35,0x6d,0x35,0x6e,0x7,0x6e,0x66,0x6e,0xaf,0x6e,0xea,0x6f,0x6,0x6f,0x22,0x6f,0x54,0x6f,0x69,0x6f,0x88,0x6f,0xe1,0x70,0x32,0x70,0x68,0x70,0x81,0x70,0x97,0x70,0xed,0x71,0x5,0x71,0x1d,0x71,0x4d,0x71,0x6b,0x71,0x7b,0x71,0x96,0x71,0xae,0x71,0xff,0x72,0x5a,0x72,0x97,0x73,0xb,0x73,0x1e,0x73,0x52,0x73,0x6a,0x73,0x8f,0x73,0xae,0x73,0xc8,0x73,0xdf,0x74,0x32,0x74,0x64,0x74,0x71,0x74,0xb2,0x74,0xda,0x75,0x28,0x75,0x36,0x75,0x5b,0x75,0x92,0x75,0xaf,0x76,0xd,0x76,0x15,0x76,0x1d,0x76,0x29,0x76,0x34,0x76,0x40,0x76,0x4b,0x76,0x57,0x76,0x63,0x76,0x6f,0x76,0x7b,0x76,0x87,0x76,0x92,0x76,0x9d,0x76,0xa9,0x76,0xb5,0x76,0xc1,0x76,0xcc,0x76,0xd7,0x76,0xe2,0x76,0xed,0x76,0xf9,0x77,0x4,0x77,0x10,0x77,0x1c,0x77,0x27,0x77,0x33,0x77,0x3e,0x77,0x49,0x77,0x54,0x77,0x5f,0x77,0x6b,0x77,0x77,0x77,0x82,0x77,0x8e,0x77,0x99,0x77,0xa5,0x77,0xb1,0x77,0xbd,0x77,0xc8,0x77,0xd3,0x77,0xdf,0x77,0xeb,0x77,0xf6,0x78,0x1,0x78,0xc,0x78,0x17,0x78,0x5d,0x78,0x68,0x78,0x73,0x78,0x7e,0x78,0x89,0x78,0x94,0x78,0x9f,0x78,0xaa,0x78,0xea,0x78,0xf5,0x79,0x0,0x79,0xb,0x79,0x17,0x79,0x23,0x79,0x2f,0x79,0x3a,0x79,0x45,0x79,0x85,0x79,0x90,0x79,0x9c,0x79,0xa8,0x79,0xb4,0x79,0xc0,0x79,0xcc,0x79,0xd8,0x79,0xe4,0x79,0xf0,0x79,0xfb,0x7a,0x6,0x7a,0x11,0x7a,0x1d,0x7a,0x28,0x7a,0x34,0x7a,0x3f,0x7a,0x4a,0x7a,0x55,0x7a,0x60,0x7a,0x6b,0x7a,0x76,0x7a,0x82,0x7a,0x8d,0x7a,0x98,0x7a,0xa4,0x7a,0xb0,0x7b,0x9,0x7b,0x15,0x7b,0x20,0x7b,0x2b,0x7b,0x37,0x7b,0x42,0x7b,0x4d,0x7b,0x59,0x7b,0x65,0x7b,0x71,0x7b,0x7d,0x7b,0x89,0x7b,0x95,0x7b,0xa1,0x7b,0xac,0x7b,0xb4,0x7b,0xbc,0x7b,0xc4,0x7b,0xcc,0x7b,0xd4,0x7b,0xdc,0x7b,0xe4,0x7b,0xec,0x7b,0xf4,0x7b,0xfc,0x7c,0x4,0x7c,0xc,0x7c,0x14,0x7c,0x1c,0x7c,0x28,0x7c,0x34,0x7c,0x3f,0x7c,0x4a,0x7c,0x55,0x7c,0x60,0x7c,0x6b,0x7c,0x73,0x7c,0x7b,0x7c,0x83,0x7c,0x8b,0x7c,0x93,0x7c,0x9e,0x7c,0xa9,0x7c,0xb4,0x7c,0xbf,0x7c,0xca,0x7c,0xd6,0x7c,0xe2,0x7d,0x5a,0x7d,0x62,0x7d,0x6e,0x7d,0x76,0x7d,0x7e,0x7d,0x8a,0x7d,0x96,0x7d,0x9e,0x7d,0xa6,0x7d,0xae,0x7d,0xb6,0x7d,0xc2,0x7d,0xca,0x7d,0xd2,0x7d,0xda,0x7d,0xe2,0x7d,0xea,0x7d,0xf2,0x7d,0xfa,0x7e,0x2,0x7e,0xa,0x7e,0x12,0x7e,0x1a,0x7e,0x25,0x7e,0x2d,0x7e,0x35,0x7e,0x83,0x7e,0x8b,0x7e,0x93,0x7e,0x9e,0x7e,0xa9,0x7e,0xb1,0x7e,0xb9,0x7e,0xc4,0x7e,0xcc,0x7e,0xd7,0x7e,0xe2,0x7e,0xef,0x7e,0xfa,0x7f,0x2,0x7f,0xe,0x7f,0x1a,0x7f,0x25,0x7f,0x30,0x7f,0x3c,0x7f,0x48,0x7f,0x54,0x7f,0x5f,0x7f,0x6b,0x7f,0x73,0x7f,0x7b,0x7f,0x87,0x7f,0x93,0x7f,0x9e,0x7f,0xa9,0x7f,0xb4,0x7f,0xbf,0x7f,0xc7,0x7f,0xcf,0x7f,0xd7,0x7f,0xe3,0x7f,0xee,0x7f,0xf6,0x80,0x2,0x80,0xd,0x80,0x19,0x80,0x24,0x80,0x2c,0x80,0x34,0x80,0x40,0x80,0x4b,0x80,0x57,0x80,0x5f,0x80,0x6a,0x80,0x76,0x80,0x81,0x80,0x8d,0x80,0x98,0x80,0xa4,0x80,0xaf,0x80,0xbb,0x80,0xc6,0x80,0xd2,0x80,0xdd,0x80,0xe5,0x80,0xed,0x80,0xf9,0x81,0x4,0x81,0x10,0x81,0x1b,0x81,0x27,0x81,0x32,0x81,0x3e,0x81,0x49,0x81,0x55,0x81,0x61,0x81,0x6d,0x81,0x78,0x81,0x84,0x81,0x8f,0x81,0x9b,0x81,0xa7,0x81,0xaf,0x81,0xbb,0x81,0xc7,0x81,0xd3,0x81,0xdf,0x81,0xeb,0x81,0xf7,0x82,0x3,0x82,0xe,0x82,0x1a,0x82,0x25,0x82,0x31,0x82,0x3c,0x82,0x48,0x82,0x53,0x82,0x63,0x82,0x73,0x82,0x7f,0x82,0x8a,0x82,0x96,0x82,0xa1,0x82,0xad,0x82,0xb8,0x82,0xc4,0x82,0xcf,0x82,0xdf,0x82,0xee,0x82,0xfa,0x83,0x6,0x83,0x12,0x83,0x1e,0x83,0x2a,0x83,0x36,0x83,0x42,0x83,0x4d,0x83,0x59,0x83,0x64,0x83,0x70,0x83,0x7b,0x83,0x87,0x83,0x92,0x83,0xa2,0x83,0xb1,0x83,0xbd,0x83,0xc9,0x83,0xd5,0x83,0xe1,0x83,0xed,0x83,0xf9,0x84,0x5,0x84,0x11,0x84,0x1d,0x84,0x28,0x84,0x34,0x84,0x3f,0x84,0x4b,0x84,0x56,0x84,0x62,0x84,0x6d,0x84,0x7d,0x84,0x8c,0x84,0x98,0x84,0xa3,0x84,0xaf,0x84,0xba,0x84,0xc6,0x84,0xd2,0x84,0xde,0x84,0xea,0x84,0xf6,0x85,0x2,0x85,0xe,0x85,0x1a,0x85,0x26,0x85,0x32,0x85,0x3e,0x85,0x49,0x85,0x55,0x85,0x60,0x85,0x6c,0x85,0x78,0x85,0x84,0x85,0x90,0x85,0x9c,0x85,0xa8,0x85,0xb4,0x85,0xc0,0x85,0xcc,0x85,0xd8,0x85,0xe4,0x85,0xf0,0x85,0xff,0x86,0xb,0x86,0x17,0x86,0x23,0x86,0x2f,0x86,0x3b,0x86,0x47,0x86,0x53,0x86,0x5f,0x86,0x6b,0x86,0x77,0x86,0x83,0x86,0x8f,0x86,0x9b,0x86,0xa7,0x86,0xb3,0x86,0xbf,0x86,0xcb,0x86,0xd7,0x86,0xdf,0x87,0x1c,0x87,0x59,0x87,0x96,0x87,0xb0,0x87,0xca,0x87,0xf0,0x88,0x14,0x88,0x24,0x88,0x33,0x88,0x3f,0x88,0x4b,0x88,0x57,0x88,0x63,0x88,0x6f,0x88,0x7b,0x88,0x9f,0x88,0xc1,0x88,0xe8,0x89,0xf,0x89,0x17,0x89,0x24,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0xff,0x6a,0x0,0x64,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x3,0xe7,0x0,0x0,0x0,0x3,0x0,0x24,0x0,0x25,0x0,0x26,0x0,0x27,0x0,0x28,0x0,0x29,0x0,0x2a,0x0,0x2b,0x0,0x2c,0x0,0x2d,0x0,0x2e,0x0,0x2f,0x0,0x30,0x0,0x31,0x0,0x32,0x0,0x33,0x0,0x34,0x0,0x35,0x0,0x36,0x0,0x37,0x0,0x38,0x0,0x39,0x0,0x3a,0x0,0x3b,0x0,0x3c,0x0,0x3d,0x0,0x44,0x0,0x45,0x0,0x46,0x0,0x47,0x0,0x48,0x0,0x49,0x0,0x4a,0x0,0x4b,0x0,0x4c,0x0,0x4d,0x0,0x4e,0x0,0x4f,0x0,0x50,0x0,0x51,0x0,0x52,0x0,0x53,0x0,0x54,0x0,0x55,0x0,0x56,0x0,0x57,0x0,0x58,0x0,0x59,0x0,0x5a,0x0,0x5b,0x0,0x5c,0x0,0x5d,0x0,0x13,0x0,0x14,0x0,0x15,0x0,0x16,0x0,0x17,0x0,0x18,0x0,0x19,0x0,0x1a,0x0,0x1b,0x0,0x1c,0x0,0xf1,0x0,0xf2,0x0,0xf3,0x0,0x9d,0x0,0x9e,0x0,0xf4,0x0,0xf5,0x0,0xf6,0x0,0x90,0x0,0xa0,0x0,0xb0,0x0,0xb1,0x0,0xea,0x0,0xed,0x0,0xee,0x1,0x2,0x0,0x89,0x1,0x3,0x0,0x7,0x0,0x84,0x0,0x85,0x0,0x96,0x0,0xa6,0x0,0xf7,0x1,0x4,0x1,0x5,0x0,0xbd,0x0,0x4,0x0,0xa3,0x0,0x22,0x0,0xa2,0x0,0xf,0x0,0x11,0x0,0x1d,0x0,0x1e,0x0,0xab,0x0,0xc3,0x0,0x87,0x0,0x42,0x0,0x10,0x0,0xb2,0x0,0xb3,0x0,0xa,0x0,0x5,0x0,0xb6,0x0,0xb7,0x0,0xc4,0x0,0xb4,0x0,0xb5,0x0,0xc5,0x1,0x6,0x1,0x7,0x0,0xb,0x0,0xc,0x0,0x3e,0x0,0x40,0x0,0x5e,0x0,0x60,0x0,0xbe,0x0,0xbf,0x0,0xe,0x0,0xef,0x0,0x93,0x0,0xf0,0x0,0xb8,0x0,0x20,0x0,0x8f,0x0,0xa7,0x0,0x1f,0x0,0x21,0x0,0x94,0x0,0x95,0x0,0xa4,0x0,0x12,0x0,0x3f,0x0,0xbc,0x0,0x8,0x0,0xc6,0x0,0x5f,0x0,0xe8,0x0,0x82,0x0,0xc2,0x0,0x8b,0x0,0x8a,0x0,0x8c,0x0,0x83,0x0,0xd,0x0,0x6,0x0,0x9,0x0,0x23,0x0,0x86,0x0,0x88,0x0,0x41,0x0,0x61,0x0,0xc9,0x1,0x8,0x0,0xc7,0x0,0x62,0x0,0xad,0x1,0x9,0x1,0xa,0x0,0x63,0x1,0xb,0x0,0xae,0x1,0xc,0x0,0xfd,0x0,0xff,0x0,0x64,0x1,0xd,0x1,0xe,0x1,0xf,0x0,0x65,0x1,0x10,0x1,0x11,0x0,0xc8,0x0,0xca,0x1,0x12,0x0,0xcb,0x1,0x13,0x1,0x14,0x1,0x15,0x0,0xe9,0x0,0xf8,0x1,0x16,0x1,0x17,0x1,0x18,0x1,0x19,0x0,0xcc,0x1,0x1a,0x0,0xcd,0x0,0xce,0x0,0xfa,0x0,0xcf,0x1,0x1b,0x1,0x1c,0x1,0x1d,0x1,0x1e,0x1,0x1f,0x1,0x20,0x1,0x21,0x1,0x22,0x1,0x23,0x0,0xe2,0x1,0x24,0x1,0x25,0x1,0x26,0x0,0x66,0x0,0xd0,0x1,0x27,0x0,0xd1,0x0,0x67,0x0,0xd3,0x1,0x28,0x1,0x29,0x1,0x2a,0x0,0x91,0x1,0x2b,0x0,0xaf,0x1,0x2c,0x1,0x2d,0x1,0x2e,0x1,0x2f,0x0,0xe4,0x0,0xfb,0x1,0x30,0x1,0x31,0x1,0x32,0x0,0xd4,0x1,0x33,0x0,0xd5,0x0,0x68,0x0,0xd6,0x1,0x34,0x1,0x35,0x1,0x36,0x1,0x37,0x1,0x38,0x1,0x39,0x1,0x3a,0x1,0x3b,0x1,0x3c,0x1,0x3d,0x0,0xeb,0x1,0x3e,0x0,0xbb,0x1,0x3f,0x1,0x40,0x0,0xe6,0x1,0x41,0x0,0x69,0x1,0x42,0x0,0x6b,0x0,0x6c,0x0,0x6a,0x1,0x43,0x1,0x44,0x0,0x6e,0x1,0x45,0x0,0x6d,0x1,0x46,0x0,0xfe,0x1,0x0,0x0,0x6f,0x1,0x47,0x1,0x48,0x1,0x1,0x0,0x70,0x1,0x49,0x1,0x4a,0x0,0x72,0x0,0x73,0x1,0x4b,0x0,0x71,0x1,0x4c,0x1,0x4d,0x1,0x4e,0x0,0xf9,0x1,0x4f,0x1,0x50,0x1,0x51,0x1,0x52,0x0,0x74,0x1,0x53,0x0,0x76,0x0,0x77,0x0,0x75,0x1,0x54,0x1,0x55,0x1,0x56,0x1,0x57,0x1,0x58,0x1,0x59,0x1,0x5a,0x1,0x5b,0x1,0x5c,0x0,0xe3,0x1,0x5d,0x1,0x5e,0x1,0x5f,0x0,0x78,0x0,0x79,0x1,0x60,0x0,0x7b,0x0,0x7c,0x0,0x7a,0x1,0x61,0x1,0x62,0x1,0x63,0x0,0xa1,0x1,0x64,0x0,0x7d,0x1,0x65,0x1,0x66,0x1,0x67,0x1,0x68,0x0,0xe5,0x0,0xfc,0x1,0x69,0x1,0x6a,0x1,0x6b,0x0,0x7e,0x1,0x6c,0x0,0x80,0x0,0x81,0x0,0x7f,0x1,0x6d,0x1,0x6e,0x1,0x6f,0x1,0x70,0x1,0x71,0x1,0x72,0x1,0x73,0x1,0x74,0x1,0x75,0x1,0x76,0x0,0xec,0x1,0x77,0x0,0xba,0x1,0x78,0x1,0x79,0x0,0xe7,0x1,0x7a,0x0,0x43,0x0,0x8d,0x0,0xd8,0x0,0xd9,0x0,0xda,0x0,0xdb,0x0,0xdc,0x0,0x8e,0x0,0xdd,0x0,0xdf,0x0,0xe1,0x1,0x7b,0x0,0xde,0x0,0xe0,0x1,0x7c,0x0,0x2,0x0,0xa9,0x0,0x97,0x0,0xaa,0x0,0xd7,0x1,0x7d,0x1,0x7e,0x1,0x7f,0x1,0x80,0x1,0x81,0x1,0x82,0x1,0x83,0x1,0x84,0x1,0x85,0x1,0x86,0x1,0x87,0x1,0x88,0x1,0x89,0x1,0x8a,0x0,0xa8,0x1,0x8b,0x1,0x8c,0x1,0x8d,0x1,0x8e,0x1,0x8f,0x1,0x90,0x1,0x91,0x0,0x9f,0x1,0x92,0x1,0x93,0x1,0x94,0x1,0x95,0x1,0x96,0x1,0x97,0x1,0x98,0x1,0x99,0x1,0x9a,0x1,0x9b,0x1,0x9c,0x0,0x9b,0x1,0x9d,0x1,0x9e,0x1,0x9f,0x1,0xa0,0x1,0xa1,0x1,0xa2,0x1,0xa3,0x1,0xa4,0x1,0xa5,0x1,0xa6,0x1,0xa7,0x1,0xa8,0x1,0xa9,0x1,0xaa,0x1,0xab,0x1,0xac,0x1,0xad,0x1,0xae,0x1,0xaf,0x1,0xb0,0x1,0xb1,0x1,0xb2,0x1,0xb3,0x1,0xb4,0x1,0xb5,0x1,0xb6,0x1,0xb7,0x1,0xb8,0x1,0xb9,0x1,0xba,0x1,0xbb,0x1,0xbc,0x1,0xbd,0x1,0xbe,0x1,0xbf,0x1,0xc0,0x1,0xc1,0x1,0xc2,0x1,0xc3,0x1,0xc4,0x1,0xc5,0x1,0xc6,0x1,0xc7,0x1,0xc8,0x1,0xc9,0x1,0xca,0x1,0xcb,0x1,0xcc,0x1,0xcd,0x1,0xce,0x1,0xcf,0x1,0xd0,0x1,0xd1,0x1,0xd2,0x1,0xd3,0x1,0xd4,0x1,0xd5,0x1,0xd6,0x1,0xd7,0x1,0xd8,0x1,0xd9,0x1,0xda,0x1,0xdb,0x1,0xdc,0x1,0xdd,0x1,0xde,0x1,0xdf,0x1,0xe0,0x1,0xe1,0x1,0xe2,0x1,0xe3,0x1,0xe4,0x1,0xe5,0x1,0xe6,0x1,0xe7,0x1,0xe8,0x1,0xe9,0x1,0xea,0x1,0xeb,0x1,0xec,0x1,0xed,0x1,0xee,0x1,0xef,0x1,0xf0,0x1,0xf1,0x1,0xf2,0x1,0xf3,0x1,0xf4,0x1,0xf5,0x1,0xf6,0x1,0xf7,0x1,0xf8,0x1,0xf9,0x1,0xfa,0x1,0xfb,0x1,0xfc,0x1,0xfd,0x1,0xfe,0x1,0xff,0x2,0x0,0x2,0x1,0x2,0x2,0x2,0x3,0x2,0x4,0x2,0x5,0x2,0x6,0x2,0x7,0x2,0x8,0x2,0x9,0x2,0xa,0x2,0xb,0x2,0xc,0x2,0xd,0x2,0xe,0x2,0xf,0x2,0x10,0x2,0x11,0x2,0x12,0x2,0x13,0x2,0x14,0x2,0x15,0x2,0x16,0x2,0x17,0x2,0x18,0x2,0x19,0x2,0x1a,0x2,0x1b,0x2,0x1c,0x2,0x1d,0x2,0x1e,0x2,0x1f,0x2,0x20,0x2,0x21,0x2,0x22,0x2,0x23,0x2,0x24,0x2,0x25,0x2,0x26,0x2,0x27,0x2,0x28,0x2,0x29,0x2,0x2a,0x2,0x2b,0x2,0x2c,0x2,0x2d,0x2,0x2e,0x2,0x2f,0x2,0x30,0x2,0x31,0x2,0x32,0x2,0x33,0x2,0x34,0x2,0x35,0x2,0x36,0x2,0x37,0x2,0x38,0x2,0x39,0x2,0x3a,0x2,0x3b,0x2,0x3c,0x2,0x3d,0x2,0x3e,0x2,0x3f,0x2,0x40,0x2,0x41,0x2,0x42,0x2,0x43,0x2,0x44,0x2,0x45,0x2,0x46,0x2,0x47,0x2,0x48,0x2,0x49,0x2,0x4a,0x0,0x98,0x0,0x9a,0x0,0x99,0x0,0xa5,0x0,0x92,0x0,0x9c,0x0,0xb9,0x2,0x4b,0x2,0x4c,0x2,0x4d,0x2,0x4e,0x2,0x4f,0x2,0x50,0x2,0x51,0x2,0x52,0x2,0x53,0x2,0x54,0x2,0x55,0x2,0x56,0x2,0x57,0x2,0x58,0x2,0x59,0x2,0x5a,0x2,0x5b,0x2,0x5c,0x2,0x5d,0x2,0x5e,0x2,0x5f,0x2,0x60,0x2,0x61,0x2,0x62,0x2,0x63,0x2,0x64,0x2,0x65,0x2,0x66,0x2,0x67,0x2,0x68,0x2,0x69,0x2,0x6a,0x2,0x6b,0x2,0x6c,0x2,0x6d,0x2,0x6e,0x2,0x6f,0x2,0x70,0x2,0x71,0x2,0x72,0x2,0x73,0x2,0x74,0x2,0x75,0x2,0x76,0x2,0x77,0x0,0xac,0x2,0x78,0x2,0x79,0x2,0x7a,0x2,0x7b,0x2,0x7c,0x2,0x7d,0x2,0x7e,0x2,0x7f,0x2,0x80,0x2,0x81,0x2,0x82,0x2,0x83,0x2,0x84,0x2,0x85,0x2,0x86,0x2,0x87,0x2,0x88,0x2,0x89,0x2,0x8a,0x2,0x8b,0x2,0x8c,0x2,0x8d,0x2,0x8e,0x2,0x8f,0x2,0x90,0x2,0x91,0x2,0x92,0x2,0x93,0x2,0x94,0x2,0x95,0x2,0x96,0x2,0x97,0x2,0x98,0x2,0x99,0x2,0x9a,0x2,0x9b,0x2,0x9c,0x2,0x9d,0x2,0x9e,0x2,0x9f,0x2,0xa0,0x2,0xa1,0x2,0xa2,0x2,0xa3,0x2,0xa4,0x2,0xa5,0x2,0xa6,0x2,0xa7,0x2,0xa8,0x2,0xa9,0x2,0xaa,0x2,0xab,0x2,0xac,0x2,0xad,0x2,0xae,0x2,0xaf,0x2,0xb0,0x2,0xb1,0x2,0xb2,0x2,0xb3,0x2,0xb4,0x2,0xb5,0x2,0xb6,0x2,0xb7,0x2,0xb8,0x2,0xb9,0x2,0xba,0x2,0xbb,0x2,0xbc,0x2,0xbd,0x2,0xbe,0x2,0xbf,0x2,0xc0,0x2,0xc1,0x2,0xc2,0x2,0xc3,0x2,0xc4,0x2,0xc5,0x2,0xc6,0x2,0xc7,0x2,0xc8,0x2,0xc9,0x2,0xca,0x2,0xcb,0x2,0xcc,0x2,0xcd,0x2,0xce,0x2,0xcf,0x2,0xd0,0x2,0xd1,0x2,0xd2,0x2,0xd3,0x2,0xd4,0x2,0xd5,0x2,0xd6,0x2,0xd7,0x2,0xd8,0x2,0xd9,0x2,0xda,0x2,0xdb,0x2,0xdc,0x2,0xdd,0x2,0xde,0x2,0xdf,0x2,0xe0,0x2,0xe1,0x2,0xe2,0x2,0xe3,0x2,0xe4,0x2,0xe5,0x2,0xe6,0x2,0xe7,0x2,0xe8,0x2,0xe9,0x2,0xea,0x2,0xeb,0x2,0xec,0x2,0xed,0x2,0xee,0x2,0xef,0x2,0xf0,0x2,0xf1,0x2,0xf2,0x2,0xf3,0x2,0xf4,0x2,0xf5,0x2,0xf6,0x2,0xf7,0x2,0xf8,0x2,0xf9,0x2,0xfa,0x2,0xfb,0x2,0xfc,0x2,0xfd,0x2,0xfe,0x2,0xff,0x3,0x0,0x3,0x1,0x3,0x2,0x3,0x3,0x3,0x4,0x3,0x5,0x3,0x6,0x3,0x7,0x3,0x8,0x3,0x9,0x3,0xa,0x3,0xb,0x3,0xc,0x3,0xd,0x3,0xe,0x3,0xf,0x3,0x10,0x3,0x11,0x3,0x12,0x3,0x13,0x3,0x14,0x3,0x15,0x3,0x16,0x3,0x17,0x3,0x18,0x3,0x19,0x3,0x1a,0x3,0x1b,0x3,0x1c,0x3,0x1d,0x3,0x1e,0x3,0x1f,0x3,0x20,0x3,0x21,0x3,0x22,0x3,0x23,0x3,0x24,0x3,0x25,0x3,0x26,0x3,0x27,0x3,0x28,0x3,0x29,0x3,0x2a,0x3,0x2b,0x3,0x2c,0x3,0x2d,0x3,0x2e,0x3,0x2f,0x3,0x30,0x3,0x31,0x3,0x32,0x3,0x33,0x3,0x34,0x3,0x35,0x3,0x36,0x3,0x37,0x3,0x38,0x3,0x39,0x3,0x3a,0x3,0x3b,0x3,0x3c,0x3,0x3d,0x3,0x3e,0x3,0x3f,0x3,0x40,0x3,0x41,0x3,0x42,0x3,0x43,0x3,0x44,0x3,0x45,0x3,0x46,0x3,0x47,0x3,0x48,0x3,0x49,0x3,0x4a,0x3,0x4b,0x3,0x4c,0x3,0x4d,0x3,0x4e,0x3,0x4f,0x3,0x50,0x3,0x51,0x3,0x52,0x3,0x53,0x3,0x54,0x3,0x55,0x3,0x56,0x3,0x57,0x3,0x58,0x3,0x59,0x3,0x5a,0x3,0x5b,0x3,0x5c,0x3,0x5d,0x3,0x5e,0x3,0x5f,0x3,0x60,0x3,0x61,0x3,0x62,0x3,0x63,0x3,0x64,0x3,0x65,0x3,0x66,0x3,0x67,0x3,0x68,0x3,0x69,0x3,0x6a,0x3,0x6b,0x3,0x6c,0x3,0x6d,0x3,0x6e,0x3,0x6f,0x3,0x70,0x3,0x71,0x3,0x72,0x3,0x73,0x3,0x74,0x3,0x75,0x3,0x76,0x3,0x77,0x3,0x78,0x3,0x79,0x3,0x7a,0x3,0x7b,0x3,0x7c,0x3,0x7d,0x3,0x7e,0x3,0x7f,0x3,0x80,0x3,0x81,0x3,0x82,0x3,0x83,0x3,0x84,0x3,0x85,0x3,0x86,0x3,0x87,0x3,0x88,0x3,0x89,0x3,0x8a,0x3,0x8b,0x3,0x8c,0x3,0x8d,0x3,0x8e,0x3,0x8f,0x3,0x90,0x3,0x91,0x3,0x92,0x3,0x93,0x3,0x94,0x3,0x95,0x3,0x96,0x3,0x97,0x3,0x98,0x3,0x99,0x3,0x9a,0x3,0x9b,0x3,0x9c,0x3,0x9d,0x3,0x9e,0x3,0x9f,0x3,0xa0,0x3,0xa1,0x3,0xa2,0x3,0xa3,0x3,0xa4,0x3,0xa5,0x3,0xa6,0x3,0xa7,0x3,0xa8,0x3,0xa9,0x3,0xaa,0x3,0xab,0x3,0xac,0x3,0xad,0x3,0xae,0x3,0xaf,0x3,0xb0,0x3,0xb1,0x3,0xb2,0x3,0xb3,0x3,0xb4,0x3,0xb5,0x3,0xb6,0x3,0xb7,0x3,0xb8,0x3,0xb9,0x3,0xba,0x3,0xbb,0x3,0xbc,0x3,0xbd,0x3,0xbe,0x3,0xbf,0x3,0xc0,0x3,0xc1,0x3,0xc2,0x3,0xc3,0x3,0xc4,0x3,0xc5,0x3,0xc6,0x3,0xc7,0x3,0xc8,0x3,0xc9,0x3,0xca,0x3,0xcb,0x3,0xcc,0x3,0xcd,0x3,0xce,0x3,0xcf,0x3,0xd0,0x3,0xd1,0x3,0xd2,0x3,0xd3,0x3,0xd4,0x3,0xd5,0x3,0xd6,0x3,0xd7,0x3,0xd8,0x3,0xd9,0x3,0xda,0x3,0xdb,0x3,0xdc,0x3,0xdd,0x3,0xde,0x3,0xdf,0x3,0xe0,0x3,0xe1,0x3,0xe2,0x3,0xe3,0x3,0xe4,0x3,0xe5,0x3,0xe6,0x3,0xe7,0x3,0xe8,0x3,0xe9,0x3,0xea,0xc,0x6b,0x67,0x72,0x65,0x65,0x6e,0x6c,0x61,0x6e,0x64,0x69,0x63,0x5,0x73,0x63,0x68,0x77,0x61,0x4,0x6c,0x69,0x72,0x61,0x6,0x70,0x65,0x73,0x65,0x74,0x61,0x6,0x6d,0x69,0x6e,0x75,0x74,0x65,0x6,0x73,0x65,0x63,0x6f,0x6e,0x64,0x6,0x41,0x62,0x72,0x65,0x76,0x65,0x7,0x41,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x7,0x41,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0xa,0x41,0x72,0x69,0x6e,0x67,0x61,0x63,0x75,0x74,0x65,0x7,0x41,0x45,0x61,0x63,0x75,0x74,0x65,0xb,0x43,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x6,0x44,0x63,0x61,0x72,0x6f,0x6e,0x6,0x44,0x63,0x72,0x6f,0x61,0x74,0x6,0x45,0x62,0x72,0x65,0x76,0x65,0x6,0x45,0x63,0x61,0x72,0x6f,0x6e,0xa,0x45,0x64,0x6f,0x74,0x61,0x63,0x63,0x65,0x6e,0x74,0x7,0x45,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x3,0x45,0x6e,0x67,0x7,0x45,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0xb,0x47,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0xc,0x47,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x4,0x48,0x62,0x61,0x72,0xb,0x48,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x6,0x49,0x62,0x72,0x65,0x76,0x65,0x7,0x49,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x7,0x49,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0x6,0x49,0x74,0x69,0x6c,0x64,0x65,0xb,0x4a,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0xc,0x4b,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x6,0x4c,0x61,0x63,0x75,0x74,0x65,0x6,0x4c,0x63,0x61,0x72,0x6f,0x6e,0xc,0x4c,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x4,0x4c,0x64,0x6f,0x74,0x6,0x4e,0x61,0x63,0x75,0x74,0x65,0x6,0x4e,0x63,0x61,0x72,0x6f,0x6e,0xc,0x4e,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x6,0x4f,0x62,0x72,0x65,0x76,0x65,0x5,0x4f,0x68,0x6f,0x72,0x6e,0xd,0x4f,0x68,0x75,0x6e,0x67,0x61,0x72,0x75,0x6d,0x6c,0x61,0x75,0x74,0x7,0x4f,0x6d,0x61,0x63,0x72,0x6f,0x6e,0xb,0x4f,0x73,0x6c,0x61,0x73,0x68,0x61,0x63,0x75,0x74,0x65,0x6,0x52,0x61,0x63,0x75,0x74,0x65,0x6,0x52,0x63,0x61,0x72,0x6f,0x6e,0xc,0x52,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x6,0x53,0x61,0x63,0x75,0x74,0x65,0xb,0x53,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x4,0x54,0x62,0x61,0x72,0x6,0x54,0x63,0x61,0x72,0x6f,0x6e,0x6,0x55,0x62,0x72,0x65,0x76,0x65,0x5,0x55,0x68,0x6f,0x72,0x6e,0xd,0x55,0x68,0x75,0x6e,0x67,0x61,0x72,0x75,0x6d,0x6c,0x61,0x75,0x74,0x7,0x55,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x7,0x55,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0x5,0x55,0x72,0x69,0x6e,0x67,0x6,0x55,0x74,0x69,0x6c,0x64,0x65,0x6,0x57,0x61,0x63,0x75,0x74,0x65,0xb,0x57,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x9,0x57,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x6,0x57,0x67,0x72,0x61,0x76,0x65,0xb,0x59,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x6,0x59,0x67,0x72,0x61,0x76,0x65,0x6,0x5a,0x61,0x63,0x75,0x74,0x65,0xa,0x5a,0x64,0x6f,0x74,0x61,0x63,0x63,0x65,0x6e,0x74,0x6,0x61,0x62,0x72,0x65,0x76,0x65,0x7,0x61,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x7,0x61,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0xa,0x61,0x72,0x69,0x6e,0x67,0x61,0x63,0x75,0x74,0x65,0x7,0x61,0x65,0x61,0x63,0x75,0x74,0x65,0xb,0x63,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x6,0x64,0x63,0x61,0x72,0x6f,0x6e,0x6,0x65,0x62,0x72,0x65,0x76,0x65,0x6,0x65,0x63,0x61,0x72,0x6f,0x6e,0xa,0x65,0x64,0x6f,0x74,0x61,0x63,0x63,0x65,0x6e,0x74,0x7,0x65,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x3,0x65,0x6e,0x67,0x7,0x65,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0xb,0x67,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0xc,0x67,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x4,0x68,0x62,0x61,0x72,0xb,0x68,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x6,0x69,0x62,0x72,0x65,0x76,0x65,0x7,0x69,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x7,0x69,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0x6,0x69,0x74,0x69,0x6c,0x64,0x65,0xb,0x6a,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0xc,0x6b,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x6,0x6c,0x61,0x63,0x75,0x74,0x65,0x6,0x6c,0x63,0x61,0x72,0x6f,0x6e,0xc,0x6c,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x4,0x6c,0x64,0x6f,0x74,0x6,0x6e,0x61,0x63,0x75,0x74,0x65,0x6,0x6e,0x63,0x61,0x72,0x6f,0x6e,0xc,0x6e,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x6,0x6f,0x62,0x72,0x65,0x76,0x65,0x5,0x6f,0x68,0x6f,0x72,0x6e,0xd,0x6f,0x68,0x75,0x6e,0x67,0x61,0x72,0x75,0x6d,0x6c,0x61,0x75,0x74,0x7,0x6f,0x6d,0x61,0x63,0x72,0x6f,0x6e,0xb,0x6f,0x73,0x6c,0x61,0x73,0x68,0x61,0x63,0x75,0x74,0x65,0x6,0x72,0x61,0x63,0x75,0x74,0x65,0x6,0x72,0x63,0x61,0x72,0x6f,0x6e,0xc,0x72,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x6,0x73,0x61,0x63,0x75,0x74,0x65,0xb,0x73,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x4,0x74,0x62,0x61,0x72,0x6,0x74,0x63,0x61,0x72,0x6f,0x6e,0x6,0x75,0x62,0x72,0x65,0x76,0x65,0x5,0x75,0x68,0x6f,0x72,0x6e,0xd,0x75,0x68,0x75,0x6e,0x67,0x61,0x72,0x75,0x6d,0x6c,0x61,0x75,0x74,0x7,0x75,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x7,0x75,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0x5,0x75,0x72,0x69,0x6e,0x67,0x6,0x75,0x74,0x69,0x6c,0x64,0x65,0x6,0x77,0x61,0x63,0x75,0x74,0x65,0xb,0x77,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x9,0x77,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x6,0x77,0x67,0x72,0x61,0x76,0x65,0xb,0x79,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x6,0x79,0x67,0x72,0x61,0x76,0x65,0x6,0x7a,0x61,0x63,0x75,0x74,0x65,0xa,0x7a,0x64,0x6f,0x74,0x61,0x63,0x63,0x65,0x6e,0x74,0x8,0x64,0x6f,0x74,0x62,0x65,0x6c,0x6f,0x77,0xb,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x2,0x49,0x4a,0x2,0x69,0x6a,0x5,0x6c,0x6f,0x6e,0x67,0x73,0x7,0x75,0x6e,0x69,0x30,0x32,0x33,0x37,0x7,0x75,0x6e,0x69,0x30,0x32,0x46,0x33,0x9,0x67,0x72,0x61,0x76,0x65,0x63,0x6f,0x6d,0x62,0x9,0x61,0x63,0x75,0x74,0x65,0x63,0x6f,0x6d,0x62,0x9,0x74,0x69,0x6c,0x64,0x65,0x63,0x6f,0x6d,0x62,0x4,0x68,0x6f,0x6f,0x6b,0x7,0x75,0x6e,0x69,0x30,0x33,0x30,0x46,0x5,0x74,0x6f,0x6e,0x6f,0x73,0xd,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x74,0x6f,0x6e,0x6f,0x73,0x9,0x61,0x6e,0x6f,0x74,0x65,0x6c,0x65,0x69,0x61,0x5,0x47,0x61,0x6d,0x6d,0x61,0x5,0x54,0x68,0x65,0x74,0x61,0x6,0x4c,0x61,0x6d,0x62,0x64,0x61,0x2,0x58,0x69,0x2,0x50,0x69,0x5,0x53,0x69,0x67,0x6d,0x61,0x3,0x50,0x68,0x69,0x3,0x50,0x73,0x69,0x5,0x61,0x6c,0x70,0x68,0x61,0x4,0x62,0x65,0x74,0x61,0x5,0x67,0x61,0x6d,0x6d,0x61,0x5,0x64,0x65,0x6c,0x74,0x61,0x7,0x65,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x4,0x7a,0x65,0x74,0x61,0x3,0x65,0x74,0x61,0x5,0x74,0x68,0x65,0x74,0x61,0x4,0x69,0x6f,0x74,0x61,0x6,0x6c,0x61,0x6d,0x62,0x64,0x61,0x2,0x78,0x69,0x3,0x72,0x68,0x6f,0x6,0x73,0x69,0x67,0x6d,0x61,0x31,0x5,0x73,0x69,0x67,0x6d,0x61,0x3,0x74,0x61,0x75,0x7,0x75,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x3,0x70,0x68,0x69,0x3,0x70,0x73,0x69,0x5,0x6f,0x6d,0x65,0x67,0x61,0x7,0x75,0x6e,0x69,0x30,0x33,0x44,0x31,0x7,0x75,0x6e,0x69,0x30,0x33,0x44,0x32,0x7,0x75,0x6e,0x69,0x30,0x33,0x44,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x42,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x30,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x32,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x33,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x34,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x35,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x36,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x37,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x38,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x39,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x41,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x42,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x43,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x44,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x45,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x46,0x7,0x75,0x6e,0x69,0x30,0x35,0x31,0x30,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x30,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x31,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x32,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x33,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x34,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x35,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x36,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x37,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x38,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x39,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x41,0x7,0x75,0x6e,0x69,0x32,0x30,0x30,0x42,0xd,0x75,0x6e,0x64,0x65,0x72,0x73,0x63,0x6f,0x72,0x65,0x64,0x62,0x6c,0xd,0x71,0x75,0x6f,0x74,0x65,0x72,0x65,0x76,0x65,0x72,0x73,0x65,0x64,0x7,0x75,0x6e,0x69,0x32,0x30,0x32,0x35,0x7,0x75,0x6e,0x69,0x32,0x30,0x37,0x34,0x9,0x6e,0x73,0x75,0x70,0x65,0x72,0x69,0x6f,0x72,0x4,0x45,0x75,0x72,0x6f,0x7,0x75,0x6e,0x69,0x32,0x31,0x30,0x35,0x7,0x75,0x6e,0x69,0x32,0x31,0x31,0x33,0x7,0x75,0x6e,0x69,0x32,0x31,0x31,0x36,0x9,0x65,0x73,0x74,0x69,0x6d,0x61,0x74,0x65,0x64,0x9,0x6f,0x6e,0x65,0x65,0x69,0x67,0x68,0x74,0x68,0xc,0x74,0x68,0x72,0x65,0x65,0x65,0x69,0x67,0x68,0x74,0x68,0x73,0xb,0x66,0x69,0x76,0x65,0x65,0x69,0x67,0x68,0x74,0x68,0x73,0xc,0x73,0x65,0x76,0x65,0x6e,0x65,0x69,0x67,0x68,0x74,0x68,0x73,0x7,0x75,0x6e,0x69,0x46,0x45,0x46,0x46,0x7,0x75,0x6e,0x69,0x46,0x46,0x46,0x43,0x7,0x75,0x6e,0x69,0x46,0x46,0x46,0x44,0x13,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x74,0x69,0x6c,0x64,0x65,0x63,0x6f,0x6d,0x62,0x12,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x68,0x6f,0x6f,0x6b,0x63,0x6f,0x6d,0x62,0x13,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x67,0x72,0x61,0x76,0x65,0x63,0x6f,0x6d,0x62,0x13,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x61,0x63,0x75,0x74,0x65,0x63,0x6f,0x6d,0x62,0xe,0x62,0x72,0x65,0x76,0x65,0x67,0x72,0x61,0x76,0x65,0x63,0x6f,0x6d,0x62,0x11,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x72,0x6f,0x74,0x61,0x74,0x65,0x6,0x41,0x2e,0x73,0x6d,0x63,0x70,0x6,0x42,0x2e,0x73,0x6d,0x63,0x70,0x6,0x43,0x2e,0x73,0x6d,0x63,0x70,0x6,0x44,0x2e,0x73,0x6d,0x63,0x70,0x6,0x45,0x2e,0x73,0x6d,0x63,0x70,0x6,0x46,0x2e,0x73,0x6d,0x63,0x70,0x6,0x47,0x2e,0x73,0x6d,0x63,0x70,0x6,0x48,0x2e,0x73,0x6d,0x63,0x70,0x6,0x49,0x2e,0x73,0x6d,0x63,0x70,0x6,0x4a,0x2e,0x73,0x6d,0x63,0x70,0x6,0x4b,0x2e,0x73,0x6d,0x63,0x70,0x6,0x4c,0x2e,0x73,0x6d,0x63,0x70,0x6,0x4d,0x2e,0x73,0x6d,0x63,0x70,0x6,0x4e,0x2e,0x73,0x6d,0x63,0x70,0x6,0x4f,0x2e,0x73,0x6d,0x63,0x70,0x6,0x51,0x2e,0x73,0x6d,0x63,0x70,0x6,0x52,0x2e,0x73,0x6d,0x63,0x70,0x6,0x53,0x2e,0x73,0x6d,0x63,0x70,0x6,0x54,0x2e,0x73,0x6d,0x63,0x70,0x6,0x55,0x2e,0x73,0x6d,0x63,0x70,0x6,0x56,0x2e,0x73,0x6d,0x63,0x70,0x6,0x57,0x2e,0x73,0x6d,0x63,0x70,0x6,0x58,0x2e,0x73,0x6d,0x63,0x70,0x6,0x59,0x2e,0x73,0x6d,0x63,0x70,0x6,0x5a,0x2e,0x73,0x6d,0x63,0x70,0xd,0x62,0x72,0x65,0x76,0x65,0x68,0x6f,0x6f,0x6b,0x63,0x6f,0x6d,0x62,0xe,0x62,0x72,0x65,0x76,0x65,0x61,0x63,0x75,0x74,0x65,0x63,0x6f,0x6d,0x62,0x8,0x63,0x72,0x6f,0x73,0x73,0x62,0x61,0x72,0x9,0x72,0x69,0x6e,0x67,0x61,0x63,0x75,0x74,0x65,0x9,0x64,0x61,0x73,0x69,0x61,0x6f,0x78,0x69,0x61,0xe,0x62,0x72,0x65,0x76,0x65,0x74,0x69,0x6c,0x64,0x65,0x63,0x6f,0x6d,0x62,0xb,0x63,0x79,0x72,0x69,0x6c,0x6c,0x69,0x63,0x74,0x69,0x63,0xc,0x63,0x79,0x72,0x69,0x6c,0x6c,0x69,0x63,0x68,0x6f,0x6f,0x6b,0x6,0x50,0x2e,0x73,0x6d,0x63,0x70,0x5,0x4b,0x2e,0x61,0x6c,0x74,0xf,0x47,0x65,0x72,0x6d,0x61,0x6e,0x64,0x62,0x6c,0x73,0x2e,0x73,0x6d,0x63,0x70,0x7,0x75,0x6e,0x69,0x30,0x30,0x41,0x44,0x7,0x75,0x6e,0x69,0x30,0x31,0x30,0x41,0x7,0x75,0x6e,0x69,0x30,0x31,0x30,0x42,0x7,0x75,0x6e,0x69,0x30,0x31,0x32,0x30,0x7,0x75,0x6e,0x69,0x30,0x31,0x32,0x31,0xb,0x6e,0x61,0x70,0x6f,0x73,0x74,0x72,0x6f,0x70,0x68,0x65,0x7,0x75,0x6e,0x69,0x30,0x32,0x31,0x38,0x7,0x75,0x6e,0x69,0x30,0x32,0x31,0x39,0x7,0x75,0x6e,0x69,0x30,0x32,0x31,0x41,0x7,0x75,0x6e,0x69,0x30,0x32,0x31,0x42,0x7,0x75,0x6e,0x69,0x30,0x31,0x36,0x32,0xc,0x75,0x6e,0x69,0x30,0x31,0x36,0x32,0x2e,0x73,0x6d,0x63,0x70,0x7,0x75,0x6e,0x69,0x30,0x31,0x36,0x33,0xb,0x44,0x63,0x72,0x6f,0x61,0x74,0x2e,0x73,0x6d,0x63,0x70,0x8,0x45,0x74,0x68,0x2e,0x73,0x6d,0x63,0x70,0x9,0x54,0x62,0x61,0x72,0x2e,0x73,0x6d,0x63,0x70,0xb,0x41,0x67,0x72,0x61,0x76,0x65,0x2e,0x73,0x6d,0x63,0x70,0xb,0x41,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0x10,0x41,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0xb,0x41,0x74,0x69,0x6c,0x64,0x65,0x2e,0x73,0x6d,0x63,0x70,0xe,0x41,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x2e,0x73,0x6d,0x63,0x70,0xa,0x41,0x72,0x69,0x6e,0x67,0x2e,0x73,0x6d,0x63,0x70,0xf,0x41,0x72,0x69,0x6e,0x67,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0xd,0x43,0x63,0x65,0x64,0x69,0x6c,0x6c,0x61,0x2e,0x73,0x6d,0x63,0x70,0xb,0x45,0x67,0x72,0x61,0x76,0x65,0x2e,0x73,0x6d,0x63,0x70,0xb,0x45,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0x10,0x45,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0xe,0x45,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x2e,0x73,0x6d,0x63,0x70,0xb,0x49,0x67,0x72,0x61,0x76,0x65,0x2e,0x73,0x6d,0x63,0x70,0xb,0x49,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0x10,0x49,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0xe,0x49,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x2e,0x73,0x6d,0x63,0x70,0xb,0x4e,0x74,0x69,0x6c,0x64,0x65,0x2e,0x73,0x6d,0x63,0x70,0xb,0x4f,0x67,0x72,0x61,0x76,0x65,0x2e,0x73,0x6d,0x63,0x70,0xb,0x4f,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0x10,0x4f,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0xb,0x4f,0x74,0x69,0x6c,0x64,0x65,0x2e,0x73,0x6d,0x63,0x70,0xe,0x4f,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x2e,0x73,0x6d,0x63,0x70,0xb,0x55,0x67,0x72,0x61,0x76,0x65,0x2e,0x73,0x6d,0x63,0x70,0xb,0x55,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0x10,0x55,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0xe,0x55,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x2e,0x73,0x6d,0x63,0x70,0xb,0x59,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0xc,0x41,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xb,0x41,0x62,0x72,0x65,0x76,0x65,0x2e,0x73,0x6d,0x63,0x70,0xc,0x41,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0x2e,0x73,0x6d,0x63,0x70,0xb,0x43,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0x10,0x43,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0xb,0x43,0x63,0x61,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xb,0x44,0x63,0x61,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xc,0x45,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xb,0x45,0x62,0x72,0x65,0x76,0x65,0x2e,0x73,0x6d,0x63,0x70,0xf,0x45,0x64,0x6f,0x74,0x61,0x63,0x63,0x65,0x6e,0x74,0x2e,0x73,0x6d,0x63,0x70,0xc,0x45,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0x2e,0x73,0x6d,0x63,0x70,0xb,0x45,0x63,0x61,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0x10,0x47,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0xb,0x47,0x62,0x72,0x65,0x76,0x65,0x2e,0x73,0x6d,0x63,0x70,0x11,0x47,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x2e,0x73,0x6d,0x63,0x70,0x10,0x48,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0xb,0x49,0x74,0x69,0x6c,0x64,0x65,0x2e,0x73,0x6d,0x63,0x70,0xc,0x49,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xb,0x49,0x62,0x72,0x65,0x76,0x65,0x2e,0x73,0x6d,0x63,0x70,0xc,0x49,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0x2e,0x73,0x6d,0x63,0x70,0xf,0x49,0x64,0x6f,0x74,0x61,0x63,0x63,0x65,0x6e,0x74,0x2e,0x73,0x6d,0x63,0x70,0x10,0x4a,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0x11,0x4b,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x2e,0x73,0x6d,0x63,0x70,0xb,0x4c,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0x11,0x4c,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x2e,0x73,0x6d,0x63,0x70,0xb,0x4c,0x63,0x61,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0x9,0x4c,0x64,0x6f,0x74,0x2e,0x73,0x6d,0x63,0x70,0xb,0x4e,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0x11,0x4e,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x2e,0x73,0x6d,0x63,0x70,0xb,0x4e,0x63,0x61,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xc,0x4f,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xb,0x4f,0x62,0x72,0x65,0x76,0x65,0x2e,0x73,0x6d,0x63,0x70,0x12,0x4f,0x68,0x75,0x6e,0x67,0x61,0x72,0x75,0x6d,0x6c,0x61,0x75,0x74,0x2e,0x73,0x6d,0x63,0x70,0xb,0x52,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0x11,0x52,0x63,0x6f,0x6d,0x6d,0x61,0x61,0x63,0x63,0x65,0x6e,0x74,0x2e,0x73,0x6d,0x63,0x70,0xb,0x52,0x63,0x61,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xb,0x53,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0x10,0x53,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0xd,0x53,0x63,0x65,0x64,0x69,0x6c,0x6c,0x61,0x2e,0x73,0x6d,0x63,0x70,0xb,0x53,0x63,0x61,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xb,0x54,0x63,0x61,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xb,0x55,0x74,0x69,0x6c,0x64,0x65,0x2e,0x73,0x6d,0x63,0x70,0xc,0x55,0x6d,0x61,0x63,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xb,0x55,0x62,0x72,0x65,0x76,0x65,0x2e,0x73,0x6d,0x63,0x70,0xa,0x55,0x72,0x69,0x6e,0x67,0x2e,0x73,0x6d,0x63,0x70,0x12,0x55,0x68,0x75,0x6e,0x67,0x61,0x72,0x75,0x6d,0x6c,0x61,0x75,0x74,0x2e,0x73,0x6d,0x63,0x70,0xc,0x55,0x6f,0x67,0x6f,0x6e,0x65,0x6b,0x2e,0x73,0x6d,0x63,0x70,0x10,0x57,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0x10,0x59,0x63,0x69,0x72,0x63,0x75,0x6d,0x66,0x6c,0x65,0x78,0x2e,0x73,0x6d,0x63,0x70,0xe,0x59,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x2e,0x73,0x6d,0x63,0x70,0xb,0x5a,0x61,0x63,0x75,0x74,0x65,0x2e,0x73,0x6d,0x63,0x70,0xf,0x5a,0x64,0x6f,0x74,0x61,0x63,0x63,0x65,0x6e,0x74,0x2e,0x73,0x6d,0x63,0x70,0xb,0x5a,0x63,0x61,0x72,0x6f,0x6e,0x2e,0x73,0x6d,0x63,0x70,0xa,0x41,0x6c,0x70,0x68,0x61,0x74,0x6f,0x6e,0x6f,0x73,0xc,0x45,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x74,0x6f,0x6e,0x6f,0x73,0x8,0x45,0x74,0x61,0x74,0x6f,0x6e,0x6f,0x73,0x9,0x49,0x6f,0x74,0x61,0x74,0x6f,0x6e,0x6f,0x73,0xc,0x4f,0x6d,0x69,0x63,0x72,0x6f,0x6e,0x74,0x6f,0x6e,0x6f,0x73,0xc,0x55,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x74,0x6f,0x6e,0x6f,0x73,0xa,0x4f,0x6d,0x65,0x67,0x61,0x74,0x6f,0x6e,0x6f,0x73,0x11,0x69,0x6f,0x74,0x61,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x74,0x6f,0x6e,0x6f,0x73,0x5,0x41,0x6c,0x70,0x68,0x61,0x4,0x42,0x65,0x74,0x61,0x7,0x45,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x4,0x5a,0x65,0x74,0x61,0x3,0x45,0x74,0x61,0x4,0x49,0x6f,0x74,0x61,0x5,0x4b,0x61,0x70,0x70,0x61,0x2,0x4d,0x75,0x2,0x4e,0x75,0x7,0x4f,0x6d,0x69,0x63,0x72,0x6f,0x6e,0x3,0x52,0x68,0x6f,0x3,0x54,0x61,0x75,0x7,0x55,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x3,0x43,0x68,0x69,0xc,0x49,0x6f,0x74,0x61,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0xf,0x55,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0xa,0x61,0x6c,0x70,0x68,0x61,0x74,0x6f,0x6e,0x6f,0x73,0xc,0x65,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x74,0x6f,0x6e,0x6f,0x73,0x8,0x65,0x74,0x61,0x74,0x6f,0x6e,0x6f,0x73,0x9,0x69,0x6f,0x74,0x61,0x74,0x6f,0x6e,0x6f,0x73,0x14,0x75,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0x74,0x6f,0x6e,0x6f,0x73,0x5,0x6b,0x61,0x70,0x70,0x61,0x7,0x6f,0x6d,0x69,0x63,0x72,0x6f,0x6e,0x7,0x75,0x6e,0x69,0x30,0x33,0x42,0x43,0x2,0x6e,0x75,0x3,0x63,0x68,0x69,0xc,0x69,0x6f,0x74,0x61,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0xf,0x75,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x64,0x69,0x65,0x72,0x65,0x73,0x69,0x73,0xc,0x6f,0x6d,0x69,0x63,0x72,0x6f,0x6e,0x74,0x6f,0x6e,0x6f,0x73,0xc,0x75,0x70,0x73,0x69,0x6c,0x6f,0x6e,0x74,0x6f,0x6e,0x6f,0x73,0xa,0x6f,0x6d,0x65,0x67,0x61,0x74,0x6f,0x6e,0x6f,0x73,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x31,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x32,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x33,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x34,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x45,0x9,0x65,0x78,0x63,0x6c,0x61,0x6d,0x64,0x62,0x6c,0x7,0x75,0x6e,0x69,0x30,0x31,0x46,0x30,0x7,0x75,0x6e,0x69,0x30,0x32,0x42,0x43,0x7,0x75,0x6e,0x69,0x31,0x45,0x33,0x45,0x7,0x75,0x6e,0x69,0x31,0x45,0x33,0x46,0x7,0x75,0x6e,0x69,0x31,0x45,0x30,0x30,0x7,0x75,0x6e,0x69,0x31,0x45,0x30,0x31,0x7,0x75,0x6e,0x69,0x31,0x46,0x34,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x30,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x35,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x37,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x44,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x45,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x34,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x38,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x44,0x7,0x75,0x6e,0x69,0x30,0x35,0x30,0x31,0x7,0x75,0x6e,0x69,0x30,0x35,0x31,0x32,0x7,0x75,0x6e,0x69,0x30,0x35,0x31,0x33,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x30,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x31,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x32,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x33,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x34,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x35,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x36,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x37,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x38,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x39,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x41,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x42,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x43,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x44,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x45,0x7,0x75,0x6e,0x69,0x31,0x45,0x41,0x46,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x30,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x31,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x32,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x33,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x34,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x35,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x36,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x37,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x38,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x39,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x41,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x42,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x43,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x44,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x45,0x7,0x75,0x6e,0x69,0x31,0x45,0x42,0x46,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x30,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x31,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x32,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x33,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x34,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x35,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x36,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x37,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x38,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x39,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x41,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x42,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x43,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x44,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x45,0x7,0x75,0x6e,0x69,0x31,0x45,0x43,0x46,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x30,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x31,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x32,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x33,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x34,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x35,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x36,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x37,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x38,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x39,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x41,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x42,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x43,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x44,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x45,0x7,0x75,0x6e,0x69,0x31,0x45,0x44,0x46,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x30,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x31,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x32,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x33,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x34,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x35,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x36,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x37,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x38,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x39,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x41,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x42,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x43,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x44,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x45,0x7,0x75,0x6e,0x69,0x31,0x45,0x45,0x46,0x7,0x75,0x6e,0x69,0x31,0x45,0x46,0x30,0x7,0x75,0x6e,0x69,0x31,0x45,0x46,0x31,0x7,0x75,0x6e,0x69,0x31,0x45,0x46,0x34,0x7,0x75,0x6e,0x69,0x31,0x45,0x46,0x35,0x7,0x75,0x6e,0x69,0x31,0x45,0x46,0x36,0x7,0x75,0x6e,0x69,0x31,0x45,0x46,0x37,0x7,0x75,0x6e,0x69,0x31,0x45,0x46,0x38,0x7,0x75,0x6e,0x69,0x31,0x45,0x46,0x39,0x7,0x75,0x6e,0x69,0x32,0x30,0x41,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x41,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x37,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x43,0x7,0x75,0x6e,0x69,0x30,0x34,0x36,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x32,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x33,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x39,0x46,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x38,0x42,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x39,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x41,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x44,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x35,0x7,0x75,0x6e,0x69,0x30,0x34,0x43,0x36,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x30,0x7,0x75,0x6e,0x69,0x30,0x34,0x42,0x31,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x45,0x7,0x75,0x6e,0x69,0x30,0x34,0x46,0x46,0x7,0x75,0x6e,0x69,0x30,0x35,0x31,0x31,0x7,0x75,0x6e,0x69,0x32,0x30,0x31,0x35,0x0,0x2,0x0,0x51,0x0,0x0,0x4,0x90,0x5,0xb0,0x0,0x7,0x0,0xa,0x0,0x0,0x41,0x13,0x33,0x1,0x23,0x1,0x33,0x13,0x37,0x13,0x13,0x3,0x65,0x73,0xb8,0xfe,0x32,0x9b,0xfe,0x2a,0xb9,0x75,0x32,0xc3,0xc0,0x1,0x79,0xfe,0x87,0x5,0xb0,0xfa,0x50,0x1,0x79,0xa1,0x2,0x78,0xfd,0x88,0x0,0x3,0x0,0xac,0x0,0x0,0x4,0x60,0x5,0xb0,0x0,0x1b,0x0,0x2a,0x0,0x39,0x0,0x0,0x73,0x21,0x36,0x36,0x37,0x36,0x36,0x27,0x34,0x26,0x27,0x26,0x26,0x27,0x35,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x26,0x26,0x27,0x21,0x13,0x21,0x16,0x16,0x17,0x16,0x16,0x7,0x14,0x6,0x7,0x6,0x6,0x7,0x21,0x11,0x11,0x33,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0xac,0x1,0xd2,0x5d,0xaf,0x43,0x43,0x50,0x1,0x27,0x23,0x21,0x66,0x37,0x35,0x4b,0x1f,0x1e,0x23,0x1,0x1,0x50,0x43,0x43,0xac,0x5a,0xfe,0x4f,0xba,0x1,0x27,0x3b,0x66,0x26,0x26,0x2b,0x1,0x2f,0x28,0x28,0x68,0x3a,0xfe,0xe3,0xfd,0x36,0x67,0x28,0x27,0x2f,0x30,0x27,0x27,0x64,0x34,0x1,0x38,0x35,0x34,0x9c,0x66,0x41,0x70,0x2d,0x29,0x44,0xd,0x3,0x17,0x34,0x26,0x25,0x5e,0x39,0x66,0x92,0x2f,0x2f,0x2d,0x1,0xfc,0xf9,0x2,0x24,0x21,0x22,0x60,0x3e,0x3d,0x60,0x21,0x21,0x25,0x1,0x2,0xa6,0x1,0xcf,0x1,0x1a,0x1b,0x1c,0x56,0x3d,0x39,0x56,0x1d,0x1e,0x1f,0x1,0x0,0x1,0x0,0x6b,0xff,0xec,0x4,0x5d,0x5,0xc4,0x0,0x3f,0x0,0x0,0x41,0x23,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x4,0x5d,0xb9,0x9,0x2c,0x25,0x25,0x6b,0x49,0x43,0x64,0x25,0x25,0x30,0xf,0xf,0xd,0xd,0xf,0xf,0x31,0x25,0x24,0x65,0x42,0x49,0x6b,0x25,0x25,0x2c,0x9,0xb9,0xc,0x4b,0x3e,0x3e,0xac,0x6d,0x5b,0x92,0x39,0x3a,0x53,0x1b,0x1c,0x1b,0x1,0x1,0x1b,0x1c,0x1b,0x53,0x3a,0x39,0x93,0x5a,0x69,0xab,0x3f,0x3e,0x4e,0x1,0xb6,0x42,0x71,0x29,0x2a,0x2e,0x2b,0x26,0x25,0x62,0x38,0x37,0x73,0x36,0xcd,0x36,0x73,0x37,0x37,0x62,0x25,0x25,0x2b,0x31,0x2b,0x2b,0x72,0x42,0x68,0xac,0x3e,0x3d,0x43,0x33,0x2d,0x2d,0x7b,0x48,0x48,0x9e,0x51,0xcb,0x51,0x9e,0x48,0x48,0x7a,0x2d,0x2d,0x33,0x43,0x3d,0x3c,0xa9,0x0,0x2,0x0,0x9b,0x0,0x0,0x4,0x70,0x5,0xb0,0x0,0x15,0x0,0x2b,0x0,0x0,0x73,0x21,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x21,0x17,0x33,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x23,0x9b,0x1,0x51,0x69,0xb5,0x48,0x44,0x6e,0x24,0x23,0x25,0x1,0x27,0x25,0x29,0x89,0x59,0x40,0x97,0x55,0xfe,0xaf,0xbc,0x95,0x45,0x74,0x2f,0x42,0x5b,0x1b,0x15,0x15,0x1,0x1,0x14,0x14,0x17,0x4f,0x36,0x33,0x83,0x50,0x95,0x1,0x30,0x2d,0x2b,0x7a,0x4b,0x48,0xac,0x60,0x6b,0x64,0xb0,0x4a,0x57,0x85,0x29,0x1e,0x21,0x1,0x98,0x1,0x1d,0x1a,0x23,0x71,0x46,0x36,0x7d,0x44,0x6d,0x43,0x7b,0x35,0x41,0x69,0x24,0x23,0x26,0x1,0x0,0x1,0x0,0xb6,0x0,0x0,0x4,0x34,0x5,0xb0,0x0,0xb,0x0,0x0,0x41,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x3,0xcf,0xfd,0xa0,0x2,0xbc,0xfc,0x8b,0x3,0x7e,0xfd,0x3b,0x2,0xa1,0x9d,0x1,0xd4,0x9e,0xfa,0x50,0x9d,0x2,0x4,0x0,0x0,0x1,0x0,0xbf,0x0,0x0,0x4,0x3d,0x5,0xb0,0x0,0x9,0x0,0x0,0x41,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x33,0x11,0x3,0xd8,0xfd,0xa2,0x2,0xc3,0xfc,0x82,0xbb,0x2,0x83,0x9d,0x1,0xf2,0x9e,0xfa,0x50,0x2,0x83,0x0,0x0,0x1,0x0,0x64,0xff,0xeb,0x4,0x5c,0x5,0xc4,0x0,0x43,0x0,0x0,0x65,0x3,0x21,0x15,0x21,0x3,0x6,0x6,0x7,0x6,0x6,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x36,0x37,0x36,0x36,0x4,0x5c,0x3,0xfe,0x28,0x1,0x28,0x2,0x17,0x44,0x27,0x27,0x53,0x26,0x42,0x68,0x27,0x28,0x38,0x12,0x12,0x11,0x1,0xe,0x10,0x10,0x32,0x26,0x26,0x66,0x42,0x45,0x68,0x26,0x25,0x2e,0xb,0xb7,0x9,0x4e,0x40,0x40,0xac,0x66,0x5c,0x94,0x3a,0x3b,0x54,0x1c,0x1c,0x1b,0x1,0x1,0x1f,0x1f,0x1e,0x5a,0x3c,0x3c,0x97,0x5a,0x59,0xa2,0x46,0x29,0x4c,0xbf,0x2,0x16,0x9c,0xfe,0xb9,0x21,0x29,0xc,0xc,0x8,0x1,0x1,0x2d,0x26,0x26,0x64,0x38,0x38,0x75,0x37,0xab,0x36,0x74,0x38,0x38,0x65,0x26,0x26,0x2d,0x2b,0x26,0x26,0x6b,0x3f,0x66,0xa5,0x3b,0x3a,0x3f,0x36,0x2e,0x2f,0x7f,0x4a,0x4a,0xa1,0x51,0xa9,0x52,0xa1,0x49,0x4a,0x7e,0x2e,0x2f,0x35,0x1,0x1,0x29,0x2a,0x18,0x41,0x0,0x1,0x0,0x8d,0x0,0x0,0x4,0x3f,0x5,0xb0,0x0,0xb,0x0,0x0,0x61,0x11,0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x4,0x3f,0xaf,0xfd,0xab,0xae,0xae,0x2,0x55,0x5,0xb0,0xfd,0x8e,0x2,0x72,0xfa,0x50,0x2,0xa1,0xfd,0x5f,0x0,0x0,0x1,0x0,0xae,0x0,0x0,0x4,0x1e,0x5,0xb0,0x0,0xb,0x0,0x0,0x53,0x15,0x21,0x11,0x21,0x15,0x21,0x35,0x21,0x11,0x21,0x35,0xae,0x1,0x55,0xfe,0xab,0x3,0x70,0xfe,0xa3,0x1,0x5d,0x5,0xb0,0xa1,0xfb,0x91,0xa0,0xa0,0x4,0x6f,0xa1,0x0,0x0,0x1,0x0,0x62,0xff,0xec,0x4,0x16,0x5,0xb0,0x0,0x1b,0x0,0x0,0x41,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x23,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x11,0x3,0x59,0x2,0x27,0x24,0x25,0x68,0x42,0x40,0x67,0x25,0x25,0x2b,0x3,0xbc,0x9,0x4a,0x3e,0x3d,0xa7,0x66,0x65,0xab,0x3f,0x3f,0x49,0x2,0x5,0xb0,0xfc,0xb,0x3e,0x6f,0x2a,0x2a,0x31,0x2a,0x27,0x26,0x68,0x3d,0x65,0xa3,0x39,0x3a,0x3e,0x45,0x3e,0x3d,0xaa,0x65,0x3,0xf5,0x0,0x0,0x1,0x0,0xac,0x0,0x0,0x4,0xa4,0x5,0xb0,0x0,0xc,0x0,0x0,0x41,0x1,0x33,0x1,0x1,0x23,0x1,0x7,0x11,0x23,0x11,0x33,0x11,0x2,0xb,0x1,0xb8,0xe1,0xfd,0xe1,0x1,0xfd,0xe1,0xfe,0x55,0x8d,0xbd,0xbd,0x2,0xa4,0xfd,0x5c,0x3,0x33,0x2,0x7d,0xfd,0xe9,0xb0,0x2,0xc7,0xfa,0x50,0x1,0xec,0x0,0x0,0x1,0x0,0xc6,0x0,0x0,0x4,0x47,0x5,0xb0,0x0,0x5,0x0,0x0,0x65,0x11,0x23,0x11,0x21,0x35,0x1,0x7f,0xb9,0x3,0x81,0x9d,0x5,0x13,0xfa,0x50,0x9d,0x0,0x0,0x1,0x0,0x94,0x0,0x0,0x4,0x4c,0x5,0xb0,0x0,0xe,0x0,0x0,0x41,0x23,0x11,0x33,0x11,0x3,0x13,0x33,0x1,0x3,0x11,0x33,0x11,0x23,0x1,0x1,0x79,0xe5,0xb4,0xf,0xf7,0x6a,0x1,0xd,0xf,0xb4,0xe6,0xff,0x0,0x5,0xb0,0xfa,0x50,0x2,0x45,0x2,0x4b,0xfd,0x5,0x3,0x10,0xfd,0xa0,0xfd,0xbb,0x5,0xb0,0xfd,0x28,0x0,0x0,0x1,0x0,0x8f,0x0,0x0,0x4,0x3e,0x5,0xb0,0x0,0x9,0x0,0x0,0x61,0x11,0x23,0x3,0x1,0x23,0x11,0x33,0x13,0x1,0x4,0x3e,0xbb,0x3,0xfd,0xcb,0xbc,0xbb,0x3,0x2,0x35,0x5,0xb0,0xfb,0xc2,0x4,0x3e,0xfa,0x50,0x4,0x40,0xfb,0xc0,0x0,0x0,0x2,0x0,0x6a,0xff,0xec,0x4,0x61,0x5,0xc4,0x0,0x25,0x0,0x4b,0x0,0x0,0x41,0x35,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x27,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x35,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x4,0x61,0x1,0x19,0x1a,0x1b,0x51,0x38,0x38,0x92,0x5a,0x5a,0x91,0x38,0x38,0x51,0x1a,0x1b,0x19,0x1,0x1,0x1a,0x1b,0x1a,0x52,0x38,0x38,0x91,0x5a,0x5a,0x91,0x38,0x38,0x51,0x1a,0x1a,0x19,0xb6,0x1,0xb,0xe,0xf,0x2f,0x23,0x24,0x63,0x41,0x41,0x62,0x24,0x24,0x30,0xf,0xf,0xd,0x1,0x1,0xd,0xf,0xe,0x30,0x24,0x24,0x62,0x40,0x41,0x62,0x24,0x24,0x30,0xf,0xe,0xc,0x2,0x84,0xa6,0x4e,0xa0,0x4a,0x4a,0x81,0x30,0x30,0x37,0x37,0x30,0x31,0x81,0x4a,0x4a,0x9f,0x4e,0xa6,0x4e,0x9e,0x4a,0x4a,0x81,0x30,0x30,0x37,0x37,0x30,0x30,0x80,0x4a,0x4a,0x9f,0xf6,0xa8,0x34,0x72,0x37,0x38,0x65,0x26,0x27,0x2e,0x2e,0x27,0x26,0x66,0x38,0x37,0x72,0x33,0xa8,0x33,0x71,0x38,0x37,0x65,0x27,0x26,0x2e,0x2d,0x26,0x27,0x65,0x37,0x38,0x71,0x0,0x2,0x0,0xbf,0x0,0x0,0x4,0x79,0x5,0xb0,0x0,0x10,0x0,0x1f,0x0,0x0,0x41,0x21,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x21,0x11,0x33,0x11,0x11,0x21,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x1,0x78,0x1,0x1f,0x62,0xaf,0x42,0x42,0x4d,0x4d,0x42,0x42,0xaf,0x62,0xfe,0x28,0xb9,0x1,0x1f,0x40,0x6d,0x28,0x27,0x2d,0x2d,0x28,0x28,0x6c,0x40,0x2,0x48,0x1,0x3a,0x37,0x37,0xa1,0x69,0x69,0xa2,0x37,0x37,0x3a,0x2,0xfa,0x50,0x2,0xe0,0x2,0x38,0x1,0x28,0x25,0x25,0x6a,0x42,0x42,0x67,0x24,0x24,0x27,0x1,0x0,0x0,0x2,0x0,0x5e,0xff,0xa,0x4,0x8c,0x5,0xc4,0x0,0x28,0x0,0x4e,0x0,0x0,0x41,0x35,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x5,0x37,0x27,0x36,0x36,0x37,0x36,0x36,0x27,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x4,0x6e,0x1,0x1a,0x1a,0x1b,0x53,0x39,0x3a,0x95,0x5d,0x5d,0x95,0x39,0x3a,0x52,0x1b,0x1b,0x1a,0x1,0x1,0x1a,0x1b,0x1b,0x54,0x3a,0x39,0x94,0x5d,0x24,0x43,0x1f,0x1,0x20,0x7f,0xfb,0x3a,0x53,0x1b,0x1a,0x1a,0xb7,0x1,0xb,0xe,0xf,0x30,0x25,0x25,0x67,0x45,0x44,0x67,0x25,0x25,0x31,0xf,0xf,0xd,0xd,0xf,0xf,0x31,0x25,0x25,0x66,0x44,0x45,0x67,0x25,0x25,0x31,0xf,0xe,0xb,0x2,0x97,0x80,0x50,0xa5,0x4c,0x4c,0x85,0x31,0x31,0x39,0x39,0x31,0x32,0x85,0x4c,0x4c,0xa4,0x50,0x80,0x50,0xa3,0x4c,0x4c,0x85,0x31,0x31,0x39,0x9,0x9,0xf4,0x79,0xd1,0x31,0x85,0x4c,0x4c,0xa4,0xd3,0x82,0x37,0x77,0x3a,0x3a,0x68,0x27,0x28,0x2f,0x2f,0x28,0x28,0x68,0x3a,0x3a,0x77,0x36,0x82,0x36,0x77,0x3a,0x39,0x68,0x28,0x27,0x2f,0x2e,0x27,0x28,0x68,0x39,0x3a,0x77,0x0,0x2,0x0,0xb5,0x0,0x0,0x4,0x72,0x5,0xb0,0x0,0x14,0x0,0x23,0x0,0x0,0x41,0x1,0x33,0x37,0x1,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x21,0x11,0x33,0x11,0x35,0x11,0x33,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x2,0x90,0x1,0x1e,0xc3,0x1,0xfe,0xcb,0x3c,0x64,0x24,0x24,0x29,0x4d,0x43,0x44,0xb4,0x66,0xfe,0x55,0xb8,0xf3,0x43,0x71,0x29,0x29,0x2e,0x30,0x29,0x2a,0x6e,0x3e,0x2,0x52,0xfd,0xae,0xc,0x2,0x6e,0x1a,0x4a,0x30,0x30,0x76,0x47,0x6e,0xa3,0x36,0x36,0x36,0x2,0xfa,0x50,0x2,0x52,0x98,0x2,0x2e,0x1,0x24,0x23,0x24,0x69,0x46,0x42,0x65,0x23,0x23,0x25,0x1,0x0,0x1,0x0,0x76,0xff,0xec,0x4,0x69,0x5,0xc4,0x0,0x49,0x0,0x0,0x41,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x23,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x3,0xa8,0x34,0x29,0x29,0x69,0x36,0x44,0x73,0x2c,0x2c,0x38,0x9,0xbd,0x3,0x4d,0x42,0x4a,0xc9,0x68,0x57,0xae,0x45,0x45,0x57,0x51,0x42,0x43,0xa2,0x51,0x31,0x6f,0x2f,0x30,0x3e,0x1,0x2f,0x28,0x27,0x65,0x35,0x42,0x69,0x26,0x26,0x2e,0x8,0xbe,0x2,0x52,0x44,0x44,0xb0,0x5f,0x56,0xaa,0x43,0x43,0x53,0x53,0x42,0x41,0x9f,0x4d,0x35,0x73,0x30,0x30,0x3d,0x1,0x70,0x3c,0x57,0x1c,0x1d,0x1b,0x25,0x25,0x24,0x69,0x44,0x5e,0x99,0x39,0x42,0x46,0x31,0x31,0x30,0x92,0x62,0x61,0x94,0x33,0x37,0x47,0x19,0xf,0x28,0x1e,0x1e,0x57,0x3f,0x3a,0x58,0x1e,0x1e,0x1e,0x29,0x25,0x25,0x67,0x3f,0x64,0xa2,0x39,0x39,0x3f,0x35,0x33,0x33,0x94,0x5e,0x5e,0x8b,0x33,0x32,0x47,0x19,0x11,0x2a,0x1f,0x20,0x5c,0x0,0x1,0x0,0x4c,0x0,0x0,0x4,0x84,0x5,0xb0,0x0,0x7,0x0,0x0,0x41,0x35,0x21,0x15,0x21,0x11,0x33,0x11,0x4,0x84,0xfb,0xc8,0x1,0xc2,0xb4,0x5,0x12,0x9e,0x9e,0xfa,0xee,0x5,0x12,0x0,0x0,0x1,0x0,0x8b,0xff,0xec,0x4,0x42,0x5,0xb0,0x0,0x1d,0x0,0x0,0x41,0x23,0x3,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x3,0x23,0x3,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x4,0x40,0xb3,0x3,0x2,0x26,0x24,0x25,0x6c,0x47,0x47,0x6d,0x24,0x25,0x27,0x1,0x4,0xb0,0x2,0x1,0x46,0x3e,0x3e,0xae,0x6a,0x68,0xae,0x3f,0x3f,0x48,0x5,0xb0,0xfc,0x26,0x41,0x78,0x2e,0x2f,0x37,0x38,0x2e,0x2e,0x78,0x41,0x3,0xda,0xfc,0x26,0x66,0xb3,0x42,0x43,0x4c,0x4d,0x43,0x42,0xb2,0x66,0x0,0x1,0x0,0x47,0x0,0x0,0x4,0x7f,0x5,0xb0,0x0,0x8,0x0,0x0,0x61,0x33,0x1,0x23,0x1,0x7,0x27,0x1,0x23,0x2,0x13,0xa1,0x1,0xcb,0xc5,0xfe,0xbe,0x16,0x15,0xfe,0xc0,0xc6,0x5,0xb0,0xfb,0xc3,0x49,0x47,0x4,0x3f,0x0,0x1,0x0,0x49,0x0,0x0,0x4,0x9e,0x5,0xb0,0x0,0x12,0x0,0x0,0x73,0x33,0x13,0x37,0x17,0x13,0x33,0x13,0x23,0x3,0x7,0x27,0x3,0x23,0x3,0x7,0x27,0x3,0x23,0xfa,0xbe,0xb2,0xb,0xa,0xb1,0xbd,0xb1,0xaf,0x69,0x6,0xb,0xb1,0xa1,0xb0,0xb,0x6,0x69,0xb0,0x4,0xb,0x3e,0x3d,0xfb,0xf4,0x5,0xb0,0xfc,0x16,0x3c,0x3b,0x3,0xeb,0xfc,0x16,0x3c,0x3a,0x3,0xec,0x0,0x1,0x0,0x57,0x0,0x0,0x4,0x8f,0x5,0xb0,0x0,0xb,0x0,0x0,0x41,0x1,0x23,0x1,0x1,0x33,0x1,0x1,0x33,0x1,0x1,0x23,0x2,0x71,0xfe,0xca,0xd9,0x1,0xa7,0xfe,0x4e,0xdb,0x1,0x43,0x1,0x42,0xd8,0xfe,0x4f,0x1,0xa7,0xda,0x3,0x75,0x2,0x3b,0xfd,0x2e,0xfd,0x22,0x2,0x46,0xfd,0xba,0x2,0xde,0x2,0xd2,0x0,0x1,0x0,0x3d,0x0,0x0,0x4,0x79,0x5,0xb0,0x0,0x8,0x0,0x0,0x41,0x1,0x23,0x1,0x13,0x33,0x13,0x1,0x23,0x2,0x5b,0xfe,0xb5,0xd3,0x1,0xc5,0x3,0xac,0x3,0x1,0xc5,0xd2,0x2,0xd5,0x2,0xdb,0xfc,0x6f,0xfd,0xe1,0x2,0x1f,0x3,0x91,0x0,0x1,0x0,0x72,0x0,0x0,0x4,0x37,0x5,0xb0,0x0,0x9,0x0,0x0,0x65,0x1,0x27,0x21,0x15,0x21,0x1,0x17,0x21,0x35,0x1,0x45,0x2,0xd7,0x2,0xfc,0x65,0x2,0xc8,0xfd,0x2b,0x2,0x3,0xc3,0x9d,0x4,0x86,0x8d,0x9e,0xfb,0x7e,0x90,0x9d,0x0,0x0,0x2,0x0,0x9c,0xff,0xec,0x4,0x36,0x4,0x4e,0x0,0x35,0x0,0x49,0x0,0x0,0x61,0x33,0x35,0x26,0x26,0x35,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x25,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x15,0x6,0x6,0x7,0x6,0x6,0x3,0x75,0xc1,0x12,0x14,0x42,0x39,0x3a,0x9e,0x5c,0x65,0x9f,0x37,0x38,0x3b,0x1,0xba,0x21,0x1e,0x1e,0x57,0x37,0x3b,0x5f,0x21,0x21,0x24,0xca,0x71,0xb7,0x41,0x41,0x47,0x35,0x31,0x30,0x8b,0x56,0x35,0x5e,0x2a,0x29,0x45,0x1c,0x3,0xd,0xfe,0xc4,0x36,0x52,0x1b,0x1b,0x1b,0x1f,0x1e,0x2a,0x8f,0x60,0xac,0x10,0x38,0x26,0x27,0x5e,0x10,0x2d,0x79,0x36,0x1,0xf7,0x5b,0x88,0x2e,0x2d,0x2d,0x38,0x2d,0x2e,0x72,0x3b,0x22,0x3f,0x17,0x17,0x1c,0x1e,0x1b,0x1c,0x4e,0x31,0x55,0x2c,0x2c,0x2d,0x86,0x59,0x44,0x75,0x2a,0x2b,0x32,0x16,0x13,0x13,0x32,0x1c,0x22,0x3f,0x78,0x1c,0x19,0x18,0x44,0x28,0x2a,0x42,0x18,0x22,0x21,0xdb,0x20,0x3b,0x17,0x17,0x1c,0x0,0x0,0x2,0x0,0xaf,0xff,0xec,0x4,0x43,0x6,0x0,0x0,0x23,0x0,0x43,0x0,0x0,0x41,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x11,0x23,0x11,0x33,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x27,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x4,0x43,0x1c,0x1b,0x1a,0x44,0x2b,0x30,0x76,0x46,0x38,0x60,0x28,0x20,0x38,0x17,0xb9,0xaa,0x9,0x12,0x28,0x16,0x2e,0x73,0x46,0x3d,0x69,0x2c,0x3d,0x57,0x1b,0x14,0x15,0xb9,0xc,0xd,0x10,0x36,0x28,0x1e,0x4c,0x2e,0x30,0x50,0x20,0x20,0x31,0x12,0x11,0x31,0x20,0x1f,0x50,0x30,0x2c,0x48,0x1d,0x2a,0x3a,0x12,0xd,0xd,0x2,0x11,0x15,0x55,0x99,0x3f,0x38,0x5b,0x20,0x22,0x26,0x16,0x15,0x11,0x2f,0x1d,0x2,0x3a,0xfa,0x0,0x7b,0x17,0x26,0x10,0x20,0x22,0x1e,0x1b,0x27,0x77,0x4b,0x39,0x83,0x5c,0x15,0x30,0x5c,0x28,0x35,0x56,0x1c,0x16,0x17,0x19,0x17,0x17,0x3d,0x24,0x1,0xd9,0x24,0x3d,0x17,0x16,0x19,0x14,0x12,0x19,0x58,0x35,0x2b,0x61,0x0,0x1,0x0,0x8f,0xff,0xec,0x4,0x33,0x4,0x4e,0x0,0x33,0x0,0x0,0x65,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x23,0x6,0x6,0x7,0x6,0x6,0x2,0x7b,0x57,0x75,0x23,0x24,0x1f,0x1f,0x24,0x24,0x75,0x56,0x38,0x61,0x23,0x23,0x29,0x1,0xaf,0x42,0x3a,0x3b,0xa1,0x60,0x7b,0xb8,0x3d,0x3e,0x3e,0x3e,0x3e,0x3d,0xb8,0x7b,0x56,0x9e,0x3d,0x3d,0x49,0x1,0xaf,0x1,0x2d,0x25,0x25,0x5f,0x82,0x45,0x38,0x37,0x8b,0x47,0x2a,0x46,0x8a,0x38,0x37,0x45,0x26,0x21,0x21,0x57,0x31,0x52,0x90,0x35,0x34,0x3d,0x58,0x4a,0x4b,0xc4,0x6b,0x2a,0x6c,0xc3,0x4a,0x4b,0x58,0x3b,0x32,0x31,0x83,0x48,0x2d,0x4d,0x1c,0x1d,0x20,0x0,0x0,0x2,0x0,0x8b,0xff,0xec,0x4,0x1c,0x6,0x0,0x0,0x17,0x0,0x2b,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x17,0x33,0x11,0x23,0x11,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x11,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x8b,0x3e,0x38,0x38,0x9f,0x62,0x64,0x96,0x36,0x8,0xaa,0xb9,0x35,0x91,0x61,0x63,0xa0,0x38,0x39,0x3d,0xb9,0x22,0x24,0x23,0x6f,0x4e,0x5b,0x7a,0x24,0x24,0x7a,0x5d,0x4d,0x6e,0x23,0x24,0x22,0x2,0x26,0x15,0x74,0xc9,0x4a,0x4a,0x54,0x44,0x42,0x72,0x6,0x0,0xfd,0xcf,0x3e,0x41,0x52,0x49,0x49,0xcb,0x8e,0x15,0x4f,0x8f,0x37,0x36,0x40,0x55,0x42,0xfe,0xa,0x47,0x54,0x3f,0x36,0x36,0x8e,0x0,0x0,0x2,0x0,0x87,0xff,0xec,0x4,0x45,0x4,0x4e,0x0,0x22,0x0,0x30,0x0,0x0,0x45,0x32,0x36,0x37,0x27,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x35,0x21,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x13,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x21,0x36,0x36,0x37,0x36,0x36,0x2,0x8c,0x9e,0xd7,0x36,0x71,0x33,0x9a,0x63,0x4b,0x7c,0x2c,0x2b,0x31,0x7,0x3,0x5,0x39,0x3a,0x3a,0xaf,0x75,0x5d,0xb1,0x45,0x46,0x54,0x4c,0x44,0x44,0xbf,0x5a,0x47,0x67,0x22,0x22,0x26,0xfd,0xba,0xb,0x37,0x28,0x28,0x64,0x14,0x7f,0x52,0x58,0x42,0x50,0x38,0x31,0x2e,0x78,0x4f,0x7,0x53,0x71,0xc2,0x48,0x47,0x51,0x4c,0x47,0x48,0xcf,0x83,0x2a,0x71,0xc0,0x46,0x46,0x4e,0x3,0xca,0x34,0x2a,0x2a,0x73,0x32,0x9,0x4b,0x73,0x28,0x27,0x29,0x0,0x0,0x1,0x0,0x98,0x0,0x0,0x4,0x6b,0x6,0x2b,0x0,0x20,0x0,0x0,0x61,0x33,0x11,0x21,0x35,0x21,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x37,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x21,0x15,0x21,0x1,0xc2,0xba,0x1,0xa1,0xfe,0x5f,0x23,0x22,0x20,0x61,0x3f,0x3e,0x6d,0x29,0x16,0x1a,0x32,0x19,0x26,0x4e,0x28,0x60,0x9c,0x37,0x38,0x3d,0xfe,0xd6,0x1,0x2a,0x3,0xab,0x8f,0x4c,0x44,0x66,0x20,0x1f,0x1f,0x15,0xe,0x99,0x7,0xb,0x5,0x7,0x9,0x36,0x35,0x35,0x9d,0x68,0x4c,0x8f,0x0,0x2,0x0,0x8c,0xfe,0x56,0x4,0x1d,0x4,0x4e,0x0,0x35,0x0,0x4f,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x23,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x8c,0x3c,0x38,0x37,0xa0,0x63,0x3b,0x66,0x2a,0x1b,0x2f,0x15,0x28,0x25,0x26,0x6a,0x42,0x25,0x4a,0x25,0x25,0x48,0x22,0x60,0x25,0x67,0x38,0x37,0x6c,0x2a,0x66,0xa8,0x3d,0x3c,0x43,0xa8,0x9,0x13,0x2b,0x18,0x2c,0x6d,0x41,0x65,0xa0,0x38,0x38,0x3b,0xb9,0x21,0x24,0x23,0x6f,0x4e,0x2e,0x4c,0x1f,0x1f,0x30,0x12,0x12,0x30,0x1e,0x1f,0x4d,0x30,0x4d,0x6e,0x23,0x24,0x21,0x2,0x26,0x15,0x74,0xc9,0x4a,0x4a,0x54,0x19,0x17,0xf,0x28,0x18,0x5d,0x46,0x6c,0x24,0x25,0x26,0xf,0x11,0x11,0x39,0x29,0x6f,0x35,0x48,0x15,0x16,0x13,0x3c,0x3a,0x3a,0xa6,0x6b,0x4,0x23,0x76,0x18,0x28,0xf,0x1d,0x1e,0x52,0x49,0x49,0xcb,0x8e,0x15,0x4f,0x8f,0x37,0x36,0x40,0x17,0x14,0x15,0x38,0x22,0xfe,0x10,0x23,0x3a,0x15,0x15,0x17,0x3f,0x36,0x36,0x8e,0x0,0x0,0x1,0x0,0xae,0x0,0x0,0x4,0x2c,0x6,0x0,0x0,0x1f,0x0,0x0,0x41,0x11,0x23,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x36,0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,0x6,0x6,0x1,0x67,0xb9,0xb9,0x14,0x33,0x1e,0x26,0x5a,0x32,0x3d,0x5e,0x1f,0x1d,0x1e,0xb9,0x35,0x31,0x31,0x8b,0x55,0x41,0x73,0x30,0x1e,0x36,0x3,0x99,0x2,0x67,0xfa,0x0,0x3,0x12,0x20,0x35,0x14,0x1a,0x1c,0x1,0x23,0x23,0x20,0x61,0x40,0xfd,0x55,0x2,0xa9,0x6d,0x9f,0x34,0x34,0x31,0x1,0x24,0x23,0x15,0x37,0x0,0x0,0x2,0x0,0xcb,0x0,0x0,0x4,0x55,0x5,0xc3,0x0,0x9,0x0,0x1b,0x0,0x0,0x53,0x15,0x21,0x11,0x21,0x15,0x21,0x35,0x21,0x11,0x3,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0xcb,0x1,0x70,0xfe,0x90,0x3,0x8a,0xfe,0x9f,0xd1,0x37,0x38,0x37,0x38,0x10,0x10,0xd,0x28,0x1a,0x1a,0x29,0xd,0x10,0xf,0x4,0x3a,0xa1,0xfd,0x7,0xa0,0xa0,0x3,0x9a,0x1,0x1c,0x2d,0x3c,0x3c,0x2d,0x19,0x2a,0xe,0xd,0xf,0xf,0xd,0xf,0x2a,0x0,0x2,0x0,0xd3,0xfe,0x4b,0x3,0x58,0x5,0xc3,0x0,0x1d,0x0,0x29,0x0,0x0,0x41,0x15,0x21,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x3,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x1,0x2b,0x1,0x69,0x27,0x22,0x22,0x5c,0x34,0xe,0x31,0x1a,0x1b,0x34,0x11,0xd,0x19,0x2e,0x17,0x1c,0x3a,0x1f,0x64,0x9d,0x37,0x36,0x39,0xd3,0x36,0x38,0x38,0x38,0x38,0x38,0x38,0x36,0x4,0x3a,0xa1,0xfc,0x60,0x4d,0x69,0x20,0x20,0x1b,0x1,0x2,0x1,0x5,0x3,0x98,0x4,0x7,0x2,0x2,0x2,0x39,0x37,0x36,0xa0,0x68,0x4,0x41,0x1,0x1d,0x2d,0x3d,0x3d,0x2d,0x2d,0x3f,0x3f,0x0,0x0,0x1,0x0,0xb0,0x0,0x0,0x4,0x6a,0x6,0x0,0x0,0xc,0x0,0x0,0x41,0x1,0x33,0x1,0x1,0x23,0x1,0x7,0x11,0x23,0x11,0x33,0x11,0x1,0xf2,0x1,0x8d,0xeb,0xfe,0x7,0x1,0xb6,0xe1,0xfe,0x9d,0x79,0xba,0xba,0x1,0xf9,0xfe,0x7,0x2,0x77,0x1,0xc3,0xfe,0x9c,0x82,0x3,0xac,0xfa,0x0,0x1,0x76,0x0,0x0,0x1,0x0,0xcb,0x0,0x0,0x4,0x55,0x6,0x0,0x0,0x9,0x0,0x0,0x53,0x15,0x21,0x11,0x21,0x15,0x21,0x35,0x21,0x11,0xcb,0x1,0x70,0xfe,0x90,0x3,0x8a,0xfe,0x9f,0x6,0x0,0xa1,0xfb,0x41,0xa0,0xa0,0x5,0x60,0x0,0x1,0x0,0x5d,0x0,0x0,0x4,0x72,0x4,0x4e,0x0,0x3a,0x0,0x0,0x41,0x23,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x34,0x35,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,0x6,0x6,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,0x1,0x3,0xa6,0xb0,0x6,0x13,0xd,0x11,0x31,0x21,0x1e,0x2d,0xf,0x10,0xf,0xb0,0x3,0x12,0x10,0x10,0x30,0x21,0x1f,0x2f,0x10,0xf,0x10,0xb0,0x24,0x22,0x1f,0x5a,0x38,0x29,0x45,0x1c,0x16,0x26,0xe,0xb,0x1f,0x13,0x1a,0x45,0x2b,0x4c,0x6b,0x21,0x4,0x3a,0xfb,0xc6,0x3,0x5d,0x10,0x1c,0xb,0xe,0xf,0xf,0x10,0x11,0x34,0x22,0xfc,0xd5,0x3,0x2a,0x6,0x9,0x5,0x19,0x29,0x10,0xf,0x12,0x10,0x10,0x11,0x34,0x22,0xfc,0xd6,0x3,0x28,0x4e,0x73,0x24,0x20,0x21,0x1,0x14,0x11,0xf,0x28,0x17,0x19,0x28,0xe,0x12,0x13,0x1,0x40,0x39,0x0,0x0,0x1,0x0,0xae,0x0,0x0,0x4,0x29,0x4,0x4e,0x0,0x1f,0x0,0x0,0x73,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,0x6,0x6,0x7,0x27,0x23,0xae,0xb9,0x13,0x33,0x1e,0x25,0x58,0x33,0x3b,0x5b,0x20,0x1f,0x20,0xb9,0x35,0x31,0x31,0x8b,0x55,0x3f,0x71,0x30,0x20,0x39,0x18,0xd,0xa6,0x3,0x8,0x23,0x3a,0x16,0x19,0x1d,0x1c,0x1f,0x1f,0x64,0x48,0xfd,0x55,0x2,0xaf,0x6c,0x9d,0x33,0x33,0x30,0x1,0x23,0x20,0x15,0x39,0x22,0xa0,0x0,0x0,0x2,0x0,0x7a,0xff,0xec,0x4,0x52,0x4,0x4e,0x0,0x19,0x0,0x33,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x7a,0x44,0x40,0x3f,0xb7,0x73,0x72,0xb6,0x40,0x3f,0x44,0x44,0x3f,0x40,0xb7,0x73,0x72,0xb6,0x3f,0x40,0x44,0xb9,0x26,0x27,0x26,0x72,0x4d,0x4d,0x73,0x27,0x26,0x27,0x26,0x26,0x27,0x73,0x4c,0x4d,0x74,0x26,0x27,0x26,0x2,0x27,0x16,0x75,0xc8,0x4a,0x4a,0x54,0x54,0x4a,0x4a,0xc8,0x75,0x16,0x75,0xc9,0x4a,0x4a,0x55,0x55,0x4a,0x4a,0xc9,0x8b,0x16,0x4f,0x91,0x37,0x37,0x41,0x41,0x37,0x37,0x91,0x4f,0x16,0x50,0x91,0x37,0x37,0x40,0x40,0x37,0x37,0x91,0x0,0x0,0x2,0x0,0xad,0xfe,0x60,0x4,0x3f,0x4,0x4e,0x0,0x1d,0x0,0x37,0x0,0x0,0x53,0x33,0x11,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x27,0x23,0x1,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0xad,0xb9,0x14,0x2e,0x1a,0x2b,0x6b,0x3e,0x66,0x9f,0x36,0x36,0x38,0x38,0x36,0x36,0xa0,0x68,0x3b,0x67,0x2a,0x1e,0x34,0x16,0x9,0xa9,0x2,0xd9,0x23,0x24,0x24,0x70,0x4d,0x30,0x4f,0x20,0x1c,0x2c,0x11,0x13,0x32,0x20,0x1d,0x49,0x2b,0x4e,0x70,0x25,0x24,0x23,0xfe,0x60,0x2,0x8,0x16,0x25,0xf,0x18,0x1a,0x54,0x4a,0x4a,0xc9,0x74,0x15,0x79,0xcb,0x49,0x49,0x52,0x19,0x18,0x10,0x2d,0x1c,0x76,0xfd,0xec,0x15,0x4f,0x90,0x37,0x37,0x41,0x18,0x15,0x12,0x34,0x1e,0x2,0x9,0x22,0x38,0x13,0x13,0x14,0x40,0x36,0x37,0x8f,0x0,0x2,0x0,0x8c,0xfe,0x60,0x4,0x1c,0x4,0x4e,0x0,0x1d,0x0,0x37,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x11,0x33,0x11,0x23,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x8c,0x3b,0x38,0x38,0xa1,0x67,0x35,0x5c,0x27,0x1f,0x35,0x18,0xb9,0xaa,0x8,0x15,0x30,0x1b,0x2a,0x65,0x3a,0x68,0xa3,0x38,0x38,0x3a,0xb9,0x23,0x25,0x24,0x70,0x4d,0x2b,0x49,0x1f,0x1e,0x31,0x13,0x14,0x32,0x20,0x1e,0x48,0x2b,0x4d,0x6f,0x24,0x24,0x23,0x2,0x26,0x15,0x74,0xc9,0x4a,0x4a,0x54,0x14,0x13,0xe,0x28,0x19,0xfd,0xfe,0x5,0xda,0x6b,0x18,0x28,0xf,0x18,0x18,0x52,0x49,0x49,0xcb,0x8e,0x15,0x4f,0x90,0x38,0x37,0x42,0x15,0x13,0x13,0x33,0x1f,0xfd,0xea,0x21,0x37,0x13,0x11,0x14,0x41,0x37,0x37,0x90,0x0,0x0,0x1,0x1,0x49,0x0,0x0,0x4,0x31,0x4,0x4e,0x0,0x15,0x0,0x0,0x41,0x22,0x6,0x7,0x27,0x27,0x23,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x37,0x26,0x26,0x3,0x73,0x76,0xb9,0x42,0x1,0x8,0xb0,0xba,0x12,0x37,0x25,0x29,0x6e,0x44,0x35,0x61,0x36,0x19,0x1c,0x6f,0x4,0x4e,0x67,0x59,0x1b,0x91,0xfb,0xc6,0x2,0xb6,0x32,0x51,0x1c,0x20,0x21,0xb,0xc,0xb5,0xc,0xe,0x0,0x0,0x1,0x0,0xaf,0xff,0xec,0x4,0x36,0x4,0x4e,0x0,0x49,0x0,0x0,0x41,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x3,0x7d,0x14,0x13,0x1f,0x6e,0x4a,0x2f,0x60,0x27,0x28,0x35,0x4,0xb9,0x3f,0x3c,0x3b,0xac,0x6e,0x60,0xa2,0x3a,0x3a,0x41,0x39,0x36,0x36,0x9e,0x64,0x4c,0x63,0x1d,0x1e,0x18,0x1e,0x1e,0x1d,0x59,0x3b,0x39,0x5b,0x20,0x20,0x24,0xb9,0x3d,0x38,0x38,0xa0,0x64,0x5d,0x9b,0x38,0x38,0x3e,0x3c,0x37,0x36,0x99,0x5d,0x4c,0x66,0x1f,0x1f,0x1a,0x1,0x1f,0x1a,0x2e,0x13,0x1f,0x23,0x14,0x18,0x18,0x4e,0x39,0x45,0x80,0x30,0x31,0x3b,0x2e,0x2a,0x2a,0x76,0x48,0x43,0x66,0x27,0x26,0x37,0x15,0xf,0x20,0x14,0x14,0x32,0x20,0x1f,0x3a,0x16,0x16,0x1a,0x20,0x1a,0x1a,0x43,0x23,0x47,0x7b,0x2e,0x2e,0x34,0x32,0x2b,0x2b,0x73,0x42,0x43,0x65,0x25,0x26,0x36,0x13,0xf,0x25,0x16,0x16,0x35,0x0,0x1,0x0,0x8e,0xff,0xec,0x4,0x29,0x5,0x40,0x0,0x23,0x0,0x0,0x41,0x23,0x11,0x21,0x15,0x21,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x21,0x35,0x21,0x2,0x64,0xba,0xfe,0xe4,0x1,0x1c,0x35,0x2e,0x2e,0x7d,0x48,0x2b,0x57,0x27,0x27,0x42,0x17,0x1a,0x11,0x35,0x1e,0x1f,0x40,0x1e,0x29,0x49,0x1c,0x1c,0x20,0x1,0x9c,0xfe,0x64,0x5,0x40,0xfe,0xfa,0x8f,0xfd,0xb4,0x64,0x8d,0x2c,0x2d,0x29,0x8,0x8,0x7,0x15,0xe,0x83,0x4,0xb,0x5,0x5,0x7,0x14,0x19,0x18,0x52,0x3f,0x2,0x4c,0x8f,0x0,0x0,0x1,0x0,0xb4,0xff,0xec,0x4,0x1f,0x4,0x3a,0x0,0x1c,0x0,0x0,0x61,0x33,0x11,0x23,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x3,0x77,0xa8,0xba,0xf,0x2d,0x1e,0x24,0x62,0x3e,0x35,0x51,0x1c,0x1c,0x1c,0xb9,0x35,0x31,0x31,0x8a,0x55,0x6a,0xa2,0x36,0x4,0x3a,0xfc,0xf8,0x23,0x3b,0x15,0x1a,0x1d,0x1c,0x23,0x22,0x74,0x58,0x2,0x85,0xfd,0x7d,0x79,0xad,0x38,0x38,0x35,0x59,0x50,0x0,0x1,0x0,0x62,0x0,0x0,0x4,0x65,0x4,0x3a,0x0,0x8,0x0,0x0,0x61,0x33,0x1,0x23,0x1,0x7,0x27,0x1,0x23,0x2,0x1f,0x8d,0x1,0xb9,0xbd,0xfe,0xd1,0x12,0x11,0xfe,0xca,0xbe,0x4,0x3a,0xfc,0xd0,0x43,0x43,0x3,0x30,0x0,0x1,0x0,0x30,0x0,0x0,0x4,0xa7,0x4,0x3a,0x0,0x12,0x0,0x0,0x61,0x33,0x13,0x37,0x17,0x13,0x33,0x13,0x23,0x3,0x7,0x27,0x3,0x23,0x3,0x7,0x27,0x3,0x23,0x1,0x16,0x92,0xa7,0x1b,0x1c,0xa9,0x92,0xe6,0xa4,0x78,0x1b,0x1d,0xac,0x77,0xad,0x1b,0x16,0x7e,0xa4,0x2,0x97,0xa8,0xa8,0xfd,0x69,0x4,0x3a,0xfd,0x4e,0xaa,0xaa,0x2,0xb2,0xfd,0x4e,0x9b,0x9b,0x2,0xb2,0x0,0x0,0x1,0x0,0x6e,0x0,0x0,0x4,0x72,0x4,0x3a,0x0,0xb,0x0,0x0,0x41,0x1,0x23,0x1,0x1,0x33,0x1,0x1,0x33,0x1,0x1,0x23,0x2,0x6d,0xfe,0xe2,0xd6,0x1,0x93,0xfe,0x62,0xd8,0x1,0x2b,0x1,0x2b,0xd6,0xfe,0x62,0x1,0x93,0xd9,0x2,0xa9,0x1,0x91,0xfd,0xe9,0xfd,0xdd,0x1,0x9c,0xfe,0x64,0x2,0x23,0x2,0x17,0x0,0x1,0x0,0x44,0xfe,0x4b,0x4,0x85,0x4,0x3a,0x0,0x1b,0x0,0x0,0x41,0x32,0x36,0x37,0x36,0x36,0x37,0x1,0x23,0x1,0x7,0x27,0x1,0x23,0x1,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x7,0x16,0x16,0x1,0x5,0x49,0x70,0x2a,0x2a,0x3b,0x13,0x2,0x25,0xcf,0xfe,0xe9,0x33,0x30,0xfe,0xd7,0xcf,0x1,0xd2,0x4a,0xa,0x23,0x18,0x19,0x3f,0x26,0xe,0x31,0x19,0x1e,0x12,0x46,0xfe,0x4b,0x36,0x28,0x28,0x5e,0x2a,0x4,0xe1,0xfd,0x42,0x7f,0x83,0x2,0xba,0xfb,0xf9,0x90,0x14,0x3e,0x1d,0x1d,0x2a,0x3,0x2,0x97,0x4,0xc,0x0,0x0,0x1,0x0,0xa0,0x0,0x0,0x4,0x3d,0x4,0x3a,0x0,0x9,0x0,0x0,0x65,0x1,0x35,0x21,0x15,0x21,0x1,0x15,0x21,0x35,0x1,0x8c,0x2,0x8d,0xfc,0x90,0x2,0x7d,0xfd,0x7a,0x3,0x9d,0x97,0x3,0x20,0x83,0x99,0xfc,0xe7,0x88,0x97,0x0,0x0,0x3,0x0,0x91,0xff,0xec,0x4,0x40,0x5,0xc5,0x0,0x19,0x0,0x2a,0x0,0x3b,0x0,0x0,0x41,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x25,0x34,0x34,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x13,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x1,0x14,0x14,0x15,0x4,0x40,0x40,0x3c,0x3d,0xaf,0x70,0x6f,0xaf,0x3c,0x3d,0x40,0x40,0x3d,0x3d,0xb0,0x6f,0x70,0xae,0x3c,0x3c,0x40,0xfd,0xb,0x29,0x2a,0x23,0x65,0x42,0x41,0x63,0x22,0x23,0x29,0x8,0x4,0x2b,0x2e,0x22,0x62,0x3f,0x3c,0x60,0x22,0x25,0x2e,0x9,0x2,0x36,0x2,0x2d,0x1,0x55,0x8b,0xd7,0x4a,0x4a,0x4d,0x4d,0x4a,0x4a,0xd7,0x8b,0xfe,0xab,0x8b,0xd7,0x49,0x4b,0x4b,0x4c,0x4a,0x49,0xd7,0xb0,0x1a,0x32,0x19,0xf4,0x66,0x9b,0x31,0x27,0x29,0x26,0x26,0x25,0x6f,0x48,0xfe,0x1,0x6b,0x9e,0x31,0x24,0x26,0x23,0x22,0x24,0x6f,0x49,0x1,0xb1,0x1c,0x55,0xf,0x0,0x1,0x0,0xd0,0x0,0x0,0x3,0x6,0x5,0xb0,0x0,0x6,0x0,0x0,0x61,0x11,0x23,0x5,0x15,0x25,0x11,0x3,0x6,0xf,0xfd,0xd9,0x1,0x7d,0x5,0xb0,0xd4,0xa9,0x91,0xfb,0x3c,0x0,0x0,0x1,0x0,0x55,0x0,0x0,0x4,0x2b,0x5,0xc4,0x0,0x2a,0x0,0x0,0x61,0x35,0x21,0x1,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x1,0x15,0x4,0x2b,0xfd,0x25,0x1,0x87,0x37,0x63,0x26,0x25,0x2c,0x3d,0x39,0x39,0xa5,0x67,0x70,0xaf,0x3c,0x3d,0x40,0xba,0x23,0x24,0x23,0x6b,0x49,0x3c,0x5f,0x22,0x21,0x23,0x16,0x1a,0x1a,0x56,0x40,0xfe,0x23,0x97,0x1,0xa8,0x3c,0x79,0x3e,0x3e,0x7f,0x41,0x57,0x94,0x36,0x36,0x3d,0x48,0x3d,0x3d,0xa3,0x5c,0x44,0x6e,0x27,0x26,0x2a,0x29,0x23,0x23,0x5f,0x36,0x2c,0x53,0x2e,0x2f,0x6e,0x47,0xfd,0xee,0x85,0x0,0x1,0x0,0x5e,0xff,0xec,0x3,0xf9,0x5,0xc4,0x0,0x4c,0x0,0x0,0x41,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x1,0x86,0x84,0x45,0x73,0x29,0x28,0x2d,0x27,0x24,0x24,0x66,0x3f,0x3f,0x67,0x24,0x24,0x27,0xb9,0x49,0x3e,0x3e,0xa9,0x60,0x62,0xa9,0x3e,0x3e,0x46,0x17,0x1c,0x1d,0x5f,0x47,0x3b,0x55,0x1b,0x1b,0x1a,0x40,0x3a,0x3a,0xa2,0x62,0x65,0xa5,0x3b,0x3b,0x41,0xba,0x26,0x23,0x22,0x61,0x3b,0x3d,0x5f,0x20,0x21,0x22,0x26,0x24,0x25,0x6b,0x46,0x3,0x31,0x96,0x20,0x21,0x21,0x63,0x44,0x45,0x65,0x22,0x22,0x21,0x24,0x21,0x21,0x5e,0x39,0x60,0x96,0x34,0x34,0x36,0x39,0x37,0x36,0x9e,0x66,0x32,0x66,0x2e,0x2e,0x4a,0x17,0x19,0x4b,0x2b,0x2a,0x5a,0x2a,0x65,0x9a,0x34,0x34,0x35,0x3f,0x36,0x37,0x93,0x53,0x39,0x5c,0x21,0x21,0x23,0x1f,0x1f,0x20,0x61,0x41,0x37,0x5c,0x21,0x21,0x26,0x0,0x0,0x2,0x0,0x4b,0x0,0x0,0x4,0x67,0x5,0xb0,0x0,0xa,0x0,0xe,0x0,0x0,0x41,0x11,0x23,0x1,0x15,0x21,0x11,0x33,0x11,0x33,0x35,0x21,0x1,0x37,0x11,0x3,0x9c,0xc5,0xfd,0x74,0x2,0x98,0xb9,0xcb,0xfc,0xb1,0x1,0xad,0x1e,0x1,0xe9,0x3,0xc7,0xfc,0xf,0x6d,0xfe,0xae,0x1,0x52,0x97,0x2,0x99,0x38,0xfd,0x2f,0x0,0x1,0x0,0xbb,0xff,0xec,0x4,0x4f,0x5,0xb0,0x0,0x30,0x0,0x0,0x53,0x17,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x23,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x13,0x21,0x35,0x21,0xf0,0x94,0x19,0x2f,0x1b,0x1b,0x43,0x2e,0x46,0x6c,0x25,0x25,0x27,0x23,0x22,0x23,0x66,0x42,0x75,0x95,0x11,0xb0,0xa,0x4f,0x3e,0x3d,0x9e,0x59,0x74,0xac,0x39,0x38,0x38,0x3c,0x38,0x38,0xa0,0x65,0x4f,0x78,0x2b,0x29,0x2,0x4f,0xfd,0x15,0x2,0xda,0x26,0x16,0x22,0xc,0xc,0xd,0x32,0x2b,0x2c,0x76,0x44,0x4b,0x7a,0x2b,0x2c,0x2f,0x80,0x7c,0x65,0x98,0x32,0x32,0x32,0x49,0x41,0x40,0xb2,0x68,0x6e,0xb4,0x40,0x3f,0x46,0x26,0x19,0x1,0x84,0xb4,0x0,0x0,0x2,0x0,0x8d,0xff,0xec,0x4,0x25,0x5,0xb1,0x0,0x27,0x0,0x40,0x0,0x0,0x41,0x23,0x22,0x6,0x7,0x6,0x2,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x36,0x36,0x37,0x36,0x36,0x33,0x33,0x3,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x36,0x36,0x37,0x36,0x36,0x3,0x58,0x10,0x9c,0xf6,0x56,0x7d,0x56,0x40,0x41,0x3a,0xaa,0x70,0x6f,0xa9,0x39,0x39,0x39,0x30,0x33,0x33,0x9e,0x6d,0x32,0x5b,0x27,0x28,0x44,0x1a,0x6,0x41,0x3f,0x3c,0xb8,0x84,0x10,0xf2,0x43,0x64,0x21,0x21,0x20,0x23,0x22,0x23,0x64,0x41,0x38,0x66,0x27,0x27,0x2e,0x11,0x3a,0x26,0x26,0x58,0x5,0xb1,0x57,0x56,0x7d,0xfe,0xa0,0xb6,0x57,0x6a,0xd3,0x4f,0x48,0x5a,0x4e,0x44,0x43,0xb4,0x66,0x59,0xac,0x44,0x44,0x53,0x17,0x13,0x14,0x35,0x1f,0x60,0xb6,0x42,0x3f,0x4b,0xfe,0x16,0x38,0x2f,0x2f,0x79,0x40,0x48,0x7b,0x2c,0x2c,0x32,0x35,0x33,0x33,0x95,0x60,0x3e,0x2e,0x4c,0x1b,0x1b,0x1e,0x0,0x0,0x1,0x0,0x70,0x0,0x0,0x4,0x48,0x5,0xb0,0x0,0x6,0x0,0x0,0x41,0x35,0x21,0x15,0x21,0x1,0x33,0x4,0x48,0xfc,0x28,0x3,0x14,0xfd,0xa7,0xc2,0x5,0x48,0x68,0xa2,0xfa,0xf2,0x0,0x3,0x0,0xb1,0xff,0xec,0x4,0x4f,0x5,0xc4,0x0,0x2f,0x0,0x47,0x0,0x5f,0x0,0x0,0x41,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x4,0x2e,0x42,0x3a,0x3a,0x9e,0x5c,0x5d,0x9d,0x38,0x39,0x40,0x1e,0x1b,0x1b,0x4e,0x30,0x38,0x5a,0x20,0x20,0x22,0x48,0x3f,0x3e,0xa9,0x62,0x60,0xa8,0x3f,0x3e,0x49,0x23,0x20,0x21,0x5b,0x38,0x20,0x38,0x17,0x30,0x36,0x97,0x29,0x24,0x25,0x66,0x3d,0x40,0x67,0x24,0x24,0x27,0x27,0x24,0x24,0x66,0x3f,0x3d,0x67,0x25,0x25,0x29,0x22,0x24,0x20,0x21,0x5a,0x35,0x36,0x59,0x20,0x21,0x23,0x23,0x20,0x20,0x58,0x36,0x36,0x5a,0x21,0x20,0x25,0x4,0x34,0x5f,0x95,0x33,0x33,0x36,0x36,0x33,0x33,0x95,0x5f,0x36,0x62,0x29,0x2a,0x43,0x18,0x18,0x48,0x2d,0x2e,0x6d,0x3d,0x64,0x9a,0x34,0x35,0x36,0x37,0x35,0x34,0x9a,0x63,0x3d,0x6c,0x2e,0x2e,0x47,0x18,0x10,0x28,0x17,0x30,0x7f,0xfd,0xa2,0x3f,0x63,0x22,0x22,0x24,0x24,0x22,0x22,0x63,0x3f,0x3d,0x66,0x25,0x24,0x28,0x28,0x24,0x25,0x66,0x2,0x67,0x38,0x5c,0x20,0x21,0x23,0x23,0x21,0x20,0x5b,0x39,0x39,0x5d,0x21,0x21,0x23,0x25,0x21,0x22,0x5c,0x0,0x0,0x2,0x0,0x95,0xff,0xff,0x4,0x29,0x5,0xc4,0x0,0x28,0x0,0x41,0x0,0x0,0x65,0x23,0x15,0x33,0x32,0x36,0x37,0x36,0x12,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x15,0x6,0x6,0x7,0x6,0x6,0x13,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x6,0x6,0x7,0x6,0x6,0x1,0x75,0x13,0x13,0xb4,0xfb,0x47,0x76,0x48,0x42,0x42,0x38,0xa5,0x70,0x70,0xa9,0x38,0x39,0x39,0x30,0x33,0x33,0x9d,0x6c,0x38,0x5f,0x27,0x27,0x3e,0x18,0x5,0x30,0x45,0x39,0xbb,0x51,0x43,0x63,0x20,0x21,0x20,0x24,0x23,0x22,0x64,0x41,0x39,0x65,0x27,0x26,0x2d,0x11,0x3b,0x25,0x26,0x59,0xa4,0xa5,0x63,0x50,0x84,0x1,0x55,0xa9,0x43,0x77,0xef,0x50,0x44,0x53,0x51,0x44,0x45,0xb7,0x67,0x58,0xae,0x45,0x45,0x55,0x17,0x14,0x14,0x35,0x1e,0x2,0x5c,0xac,0x4b,0x3d,0x43,0x1,0xdc,0x3b,0x30,0x30,0x7b,0x40,0x48,0x7d,0x2e,0x2d,0x34,0x38,0x34,0x35,0x98,0x61,0x3c,0x2f,0x4d,0x1c,0x1d,0x1f,0x0,0x1,0x1,0x82,0x2,0x99,0x2,0xf6,0x5,0xae,0x0,0x6,0x0,0x0,0x41,0x11,0x23,0x5,0x15,0x37,0x11,0x2,0xf6,0x12,0xfe,0x9e,0xd7,0x2,0x99,0x3,0x15,0x75,0x80,0x39,0xfd,0xa7,0x0,0x1,0x1,0x3c,0x2,0x9b,0x3,0xa6,0x5,0xbb,0x0,0x2a,0x0,0x0,0x41,0x35,0x21,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x1,0x15,0x3,0xa6,0xfe,0x71,0xaf,0x2b,0x47,0x1a,0x19,0x1b,0x28,0x25,0x25,0x6a,0x42,0x45,0x6f,0x27,0x27,0x2a,0x9e,0x12,0x12,0x12,0x37,0x25,0x1d,0x2f,0x10,0x10,0x10,0x13,0x15,0xe,0x29,0x1a,0xfe,0xe0,0x2,0x9b,0x80,0x91,0x27,0x47,0x23,0x22,0x47,0x28,0x37,0x57,0x1f,0x1f,0x21,0x29,0x23,0x24,0x60,0x36,0x1d,0x31,0x11,0x12,0x14,0x10,0xf,0xf,0x28,0x18,0x15,0x2f,0x1c,0x13,0x2b,0x18,0xfe,0xf1,0x6c,0x0,0x1,0x1,0x43,0x2,0x8f,0x3,0x9f,0x5,0xba,0x0,0x4c,0x0,0x0,0x41,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x2,0xe,0x54,0x2d,0x45,0x14,0xc,0xd,0x10,0x10,0x12,0x39,0x24,0x23,0x39,0x13,0x10,0x12,0x9e,0x33,0x2a,0x29,0x6b,0x39,0x40,0x70,0x2a,0x29,0x2f,0x14,0x15,0x12,0x37,0x24,0x1b,0x2c,0x10,0x18,0x19,0x2b,0x27,0x27,0x6c,0x40,0x3c,0x68,0x26,0x27,0x2d,0x9d,0xd,0xb,0x11,0x38,0x23,0x20,0x31,0x11,0x11,0x12,0x17,0x17,0x12,0x33,0x1f,0x4,0x65,0x74,0x14,0x16,0xd,0x24,0x18,0x18,0x27,0xe,0x10,0x12,0x12,0x10,0xe,0x24,0x15,0x3d,0x58,0x1c,0x1d,0x1b,0x1f,0x1d,0x1d,0x56,0x38,0x25,0x3d,0x17,0x15,0x20,0xa,0xa,0x1c,0x11,0x18,0x3b,0x21,0x37,0x54,0x1d,0x1c,0x1d,0x1f,0x1c,0x1d,0x52,0x33,0x11,0x1d,0xa,0x12,0x12,0xe,0xd,0xe,0x27,0x17,0x1c,0x2c,0xe,0xb,0xc,0x0,0x0,0x2,0x1,0x1c,0x2,0xb3,0x3,0xb1,0x5,0xc4,0x0,0x34,0x0,0x48,0x0,0x0,0x41,0x33,0x26,0x26,0x35,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x17,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x15,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x36,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x27,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x15,0x6,0x6,0x7,0x6,0x6,0x3,0xc,0xa5,0xe,0xc,0x2a,0x25,0x26,0x6b,0x41,0x45,0x72,0x28,0x29,0x2d,0x1,0xa1,0x12,0x10,0x13,0x3b,0x25,0x1f,0x2e,0x10,0x10,0x10,0x1,0x8d,0x4d,0x7b,0x2a,0x2b,0x2e,0x20,0x1f,0x20,0x5e,0x3c,0x30,0x4e,0x1e,0x16,0x23,0xd,0x3,0xb,0xc9,0x23,0x33,0x10,0xc,0xc,0x12,0x12,0x15,0x45,0x2c,0x8c,0x8,0x27,0x19,0x1a,0x3b,0x2,0xc1,0x2d,0x58,0x30,0x1,0x3a,0x44,0x68,0x23,0x22,0x23,0x22,0x1f,0x1f,0x56,0x33,0xc,0x17,0x25,0xd,0x10,0x10,0x11,0x10,0x11,0x34,0x21,0x34,0x1d,0x1c,0x1d,0x58,0x39,0x34,0x53,0x1d,0x1e,0x21,0x1,0x18,0x13,0xe,0x23,0x12,0x1a,0x31,0x65,0x10,0xf,0xb,0x20,0x14,0x16,0x26,0xf,0x12,0x16,0x6d,0x12,0x24,0xe,0xf,0x11,0x0,0x0,0x2,0x1,0x10,0x2,0xb2,0x3,0xbc,0x5,0xc4,0x0,0x19,0x0,0x33,0x0,0x0,0x41,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x1,0x10,0x30,0x2d,0x2c,0x7f,0x50,0x4f,0x7e,0x2c,0x2c,0x2f,0x2f,0x2c,0x2d,0x7f,0x4f,0x4f,0x7e,0x2c,0x2d,0x30,0xa3,0x16,0x17,0x16,0x43,0x2d,0x2d,0x43,0x17,0x16,0x17,0x17,0x16,0x16,0x43,0x2c,0x2e,0x44,0x16,0x17,0x16,0x4,0x75,0x75,0x48,0x7b,0x2c,0x2d,0x32,0x32,0x2d,0x2c,0x7b,0x48,0x75,0x49,0x7b,0x2d,0x2c,0x32,0x32,0x2c,0x2d,0x7b,0xbe,0x75,0x29,0x47,0x1b,0x1a,0x1e,0x1e,0x1a,0x1b,0x47,0x29,0x75,0x2a,0x47,0x1a,0x1a,0x1e,0x1e,0x1a,0x1a,0x47,0x0,0x3,0x0,0x24,0x0,0x0,0x4,0x96,0x5,0xb1,0x0,0x6,0x0,0x31,0x0,0x35,0x0,0x0,0x41,0x11,0x23,0x5,0x15,0x37,0x11,0x1,0x35,0x21,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x33,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x5,0x15,0x25,0x1,0x27,0x1,0x1,0x73,0x10,0xfe,0xc1,0xc2,0x3,0xb0,0xfe,0x99,0x9d,0x27,0x40,0x17,0x17,0x18,0x24,0x21,0x22,0x5f,0x3b,0x3e,0x64,0x23,0x24,0x25,0x8e,0x1,0x10,0x11,0x10,0x31,0x20,0x1a,0x29,0xe,0xf,0x10,0xe,0xf,0xd,0x28,0x1b,0xfe,0xfd,0xfe,0xdb,0x2,0x2,0x72,0xfd,0xff,0x2,0xeb,0x2,0xc6,0x69,0x73,0x33,0xfd,0xe3,0xfd,0x15,0x73,0x83,0x23,0x40,0x1f,0x1f,0x40,0x24,0x31,0x4f,0x1b,0x1c,0x1e,0x25,0x1f,0x21,0x56,0x31,0x1b,0x2c,0x11,0xf,0x11,0xe,0xc,0xe,0x25,0x16,0x11,0x25,0x16,0x13,0x2c,0x19,0xf4,0x61,0xdd,0x3,0xba,0x42,0xfc,0x46,0x0,0x0,0x4,0x0,0x30,0x0,0x0,0x4,0x8c,0x5,0xb5,0x0,0x6,0x0,0x11,0x0,0x15,0x0,0x19,0x0,0x0,0x41,0x11,0x23,0x5,0x15,0x37,0x11,0x1,0x11,0x23,0x1,0x17,0x21,0x15,0x33,0x35,0x33,0x35,0x21,0x37,0x37,0x11,0x5,0x1,0x27,0x1,0x1,0x7f,0x10,0xfe,0xc1,0xc2,0x3,0x3a,0x91,0xfe,0xad,0x5,0x1,0x52,0x8d,0x60,0xfe,0x4a,0xba,0xf,0xfd,0xf3,0x2,0x2,0x72,0xfd,0xff,0x2,0xef,0x2,0xc6,0x69,0x73,0x33,0xfd,0xe3,0xfe,0x1e,0x1,0xb9,0xfe,0x2e,0x5c,0x98,0x98,0x75,0xeb,0x19,0xfe,0xfc,0x30,0x3,0xba,0x42,0xfc,0x46,0x0,0x4,0x0,0x26,0x0,0x0,0x4,0xad,0x5,0xb8,0x0,0xa,0x0,0xe,0x0,0x5b,0x0,0x5f,0x0,0x0,0x41,0x11,0x23,0x1,0x17,0x21,0x15,0x33,0x35,0x33,0x35,0x21,0x37,0x37,0x11,0x1,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x13,0x1,0x27,0x1,0x4,0x4d,0x91,0xfe,0xad,0x5,0x1,0x52,0x8d,0x60,0xfe,0x4a,0xba,0xf,0xfd,0x1d,0x4b,0x22,0x37,0x13,0x11,0x12,0xf,0xe,0x12,0x31,0x20,0x22,0x34,0x11,0xe,0xe,0x8e,0x2e,0x26,0x24,0x61,0x33,0x3a,0x64,0x26,0x25,0x2a,0x15,0x16,0x10,0x2e,0x1e,0x19,0x27,0x10,0x14,0x17,0x27,0x23,0x23,0x61,0x3a,0x36,0x5d,0x23,0x23,0x28,0x8d,0xe,0xc,0x10,0x30,0x1d,0x1f,0x2f,0xf,0xd,0xe,0x13,0x12,0x11,0x2f,0x1f,0xad,0x2,0x2,0x72,0xfd,0xff,0x1,0xd,0x1,0xb9,0xfe,0x2e,0x5c,0x98,0x98,0x75,0xeb,0x19,0xfe,0xfc,0x3,0x78,0x68,0xd,0xd,0xc,0x27,0x1b,0x15,0x24,0xd,0xe,0x10,0x12,0x10,0xb,0x20,0x12,0x37,0x4f,0x19,0x1b,0x18,0x1c,0x1a,0x1a,0x4e,0x32,0x24,0x3b,0x15,0x10,0x1a,0x8,0x9,0x19,0xf,0x16,0x35,0x1e,0x31,0x4c,0x1a,0x19,0x1a,0x1c,0x19,0x1a,0x4a,0x2e,0x11,0x1c,0xb,0xd,0xe,0xf,0xe,0xc,0x21,0x13,0x17,0x26,0xd,0xb,0xd,0xfc,0x57,0x3,0xba,0x42,0xfc,0x46,0x0,0x0,0x2,0x0,0x20,0x0,0x0,0x4,0xab,0x5,0xb0,0x0,0xf,0x0,0x12,0x0,0x0,0x61,0x35,0x21,0x3,0x21,0x35,0x21,0x3,0x21,0x35,0x21,0x1,0x33,0x13,0x21,0x13,0x3,0x13,0x13,0x4,0xab,0xfe,0x9b,0x1,0x1,0x2e,0xfe,0xd2,0x2,0x1,0x51,0xfd,0xbc,0xfd,0xd0,0xc6,0x7b,0x1,0x36,0x1,0xfa,0xf7,0x2,0x97,0x2,0x13,0x97,0x1,0xd7,0x98,0xfa,0x50,0x1,0x61,0xfe,0x9f,0x2,0xf,0x2,0xc2,0xfd,0x3e,0x0,0x3,0x0,0x2b,0xff,0xec,0x4,0xa9,0x4,0x4e,0x0,0x57,0x0,0x70,0x0,0x82,0x0,0x0,0x45,0x32,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x23,0x6,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x21,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x17,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x25,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x14,0x16,0x15,0x14,0x14,0x15,0x6,0x6,0x7,0x6,0x6,0x1,0x21,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x3,0x80,0x3b,0x5d,0x23,0x22,0x2e,0xd,0x2e,0x10,0x26,0x17,0x18,0x3b,0x26,0x3c,0x57,0x1c,0x15,0x1a,0x6,0x7,0x9,0x1,0xf9,0x2b,0x2a,0x2a,0x7b,0x51,0x2f,0x52,0x22,0x14,0x25,0x10,0x10,0x27,0x16,0x23,0x55,0x32,0x48,0x76,0x29,0x2a,0x2d,0xb3,0x13,0x12,0x13,0x35,0x20,0x1f,0x2e,0x10,0x13,0x12,0x3f,0x65,0x9a,0x33,0x31,0x32,0x27,0x25,0x25,0x6c,0x47,0x30,0x50,0x21,0x21,0x33,0x13,0x11,0x2b,0x19,0x2a,0x6a,0xfe,0x33,0x24,0x37,0x12,0x13,0x13,0x1f,0x1d,0x1d,0x54,0x35,0x3d,0x1,0xd,0x1e,0x10,0x14,0x2a,0x2,0x72,0xfe,0xb7,0x9,0x8,0xa,0x1d,0x17,0x11,0x31,0x1d,0x25,0x3a,0x14,0x14,0x14,0x14,0x13,0xd,0xd,0x1d,0xa,0x88,0xb,0x18,0xa,0xb,0xe,0x1,0x21,0x1b,0x14,0x30,0x1a,0x1c,0x40,0x24,0x56,0xea,0x54,0x89,0x31,0x30,0x35,0x16,0x16,0xc,0x20,0x13,0x15,0x23,0xc,0x14,0x13,0x2b,0x27,0x28,0x6f,0x45,0x8,0x25,0x3a,0x14,0x15,0x16,0x13,0x12,0x16,0x42,0x2a,0x94,0x31,0x2e,0x2d,0x81,0x51,0x45,0x71,0x27,0x28,0x2c,0x18,0x14,0x14,0x35,0x1d,0x1b,0x2c,0x12,0x1c,0x1d,0x96,0x18,0x15,0x14,0x37,0x1f,0x2b,0x4d,0x1e,0x1d,0x23,0x41,0x42,0x3f,0x2b,0x27,0x11,0xd,0x18,0xa,0xb,0xe,0x1,0xfe,0x45,0x1e,0x3a,0x1a,0x1e,0x2d,0x15,0xf,0x10,0x1f,0x19,0x1a,0x41,0x23,0x0,0x2,0x0,0x4f,0xff,0xec,0x4,0xa6,0x5,0xc4,0x0,0x1d,0x0,0x31,0x0,0x0,0x61,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x21,0x35,0x21,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x25,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x11,0x6,0x6,0x4,0xa6,0xfe,0x69,0x1,0x58,0xfe,0xa8,0x1,0x8d,0xfe,0x5e,0x3e,0x86,0x45,0x61,0x9b,0x36,0x36,0x3a,0x3b,0x37,0x36,0x9b,0x61,0x45,0x84,0x3e,0xfe,0xf9,0x39,0x58,0x1e,0x1e,0x1e,0x1e,0x1d,0x1d,0x58,0x39,0x1a,0x32,0x19,0x19,0x31,0x97,0x2,0xd,0x98,0x1,0xdc,0x98,0x8,0xc,0x44,0x42,0x42,0xc3,0x80,0xfe,0x3d,0x80,0xc3,0x42,0x42,0x43,0xd,0x7,0x83,0x25,0x2b,0x2b,0x8f,0x69,0x1,0xc5,0x69,0x8d,0x2b,0x2b,0x25,0x2,0x2,0xfb,0x5e,0x1,0x2,0x0,0x0,0x3,0x0,0x2e,0xff,0xec,0x4,0xb0,0x4,0x4e,0x0,0x43,0x0,0x63,0x0,0x75,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x21,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x13,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x1,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x21,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x2e,0x2d,0x2c,0x2c,0x80,0x53,0x34,0x59,0x25,0x15,0x27,0x10,0xf,0x24,0x14,0x26,0x61,0x39,0x30,0x4c,0x1e,0x1e,0x2d,0x11,0x37,0x10,0x24,0x17,0x17,0x3a,0x23,0x1d,0x2e,0x12,0x13,0x1e,0xa,0x8,0x5,0x1,0xca,0x26,0x27,0x28,0x79,0x53,0x2b,0x50,0x22,0x16,0x27,0x11,0xf,0x24,0x15,0x25,0x5c,0x37,0x52,0x80,0x2b,0x2c,0x2d,0xba,0x12,0x13,0x12,0x3b,0x2a,0x2a,0x3d,0x13,0x9,0xe,0x5,0x4,0x5,0x9,0x6,0x5,0x1d,0x18,0xe,0x2c,0x1a,0x2b,0x3c,0x13,0x13,0x11,0x2,0x87,0x25,0x33,0x11,0x10,0xf,0xfe,0xef,0x6,0x4,0x7,0x1f,0x15,0xf,0x22,0x2,0x7f,0xc6,0x69,0xaa,0x3c,0x3c,0x42,0x1a,0x19,0xf,0x26,0x17,0x15,0x24,0xe,0x1c,0x1c,0x10,0xd,0xd,0x22,0x12,0x7e,0xe,0x18,0xa,0xa,0xc,0x13,0x13,0x14,0x3e,0x29,0x1f,0x47,0x27,0x40,0xb5,0x5b,0x9c,0x39,0x39,0x40,0x19,0x19,0xf,0x28,0x18,0x16,0x25,0xe,0x1b,0x1d,0x42,0x3d,0x3d,0xaa,0xfe,0xd1,0xc6,0x43,0x73,0x29,0x29,0x2f,0x2e,0x29,0x14,0x31,0x1b,0x1c,0x41,0x23,0xc6,0x2c,0x50,0x22,0x1d,0x3f,0x1a,0x10,0x13,0x2e,0x29,0x29,0x73,0x2,0x41,0x25,0x1e,0x1f,0x4e,0x2a,0x55,0x4,0x22,0x3f,0x1b,0x2d,0x4e,0x16,0xf,0xf,0x0,0x2,0x0,0x49,0xff,0xec,0x4,0x2a,0x5,0xf1,0x0,0x2b,0x0,0x47,0x0,0x0,0x41,0x37,0x27,0x7,0x26,0x26,0x27,0x7,0x16,0x16,0x17,0x7,0x17,0x25,0x16,0x16,0x17,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x2,0x1,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x14,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x3,0x4d,0xd3,0x49,0xe6,0x3f,0x8f,0x50,0x39,0x2e,0x57,0x29,0xef,0x49,0x1,0xa,0x3e,0x5a,0x17,0x39,0x99,0x58,0x69,0xb3,0x41,0x42,0x49,0x48,0x42,0x41,0xb5,0x6c,0x47,0x80,0x37,0x3f,0x62,0x22,0x19,0x1b,0x75,0xfe,0x84,0x4a,0x73,0x27,0x28,0x2a,0x2a,0x28,0x27,0x70,0x45,0x7d,0xa0,0x22,0x1,0x12,0x10,0x15,0x3d,0x27,0x21,0x4f,0x5,0x6,0x79,0x64,0x84,0x33,0x49,0x16,0x9f,0x10,0x29,0x1b,0x89,0x63,0x98,0x3f,0xa8,0x6e,0x38,0x44,0x49,0x43,0x43,0xbc,0x73,0x66,0xb2,0x42,0x42,0x4b,0x23,0x21,0x27,0x78,0x4c,0x3d,0x91,0x52,0x3e,0xce,0x1,0x49,0xfb,0xf2,0x3b,0x30,0x2f,0x79,0x3e,0x49,0x82,0x31,0x31,0x39,0x56,0x36,0xd,0x18,0xd,0x40,0x3e,0x70,0x2f,0x3a,0x56,0x1b,0x18,0x19,0x0,0x2,0x0,0xa8,0x0,0x0,0x4,0x5e,0x5,0xb0,0x0,0x12,0x0,0x21,0x0,0x0,0x41,0x23,0x11,0x33,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x21,0x15,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x21,0x1,0x61,0xb9,0xb9,0x1,0x15,0x75,0xb5,0x3f,0x3e,0x41,0x41,0x3e,0x3f,0xb5,0x75,0xfe,0xeb,0x1,0x15,0x4e,0x73,0x25,0x25,0x24,0x24,0x25,0x26,0x72,0x4e,0xfe,0xeb,0x5,0xb0,0xfa,0x50,0x1,0x39,0x3f,0x39,0x38,0x9c,0x5d,0x5d,0x9c,0x39,0x38,0x3f,0x98,0x2d,0x26,0x27,0x63,0x36,0x35,0x62,0x25,0x26,0x2d,0x0,0x0,0x2,0x0,0xad,0xfe,0x60,0x4,0x3f,0x6,0x16,0x0,0x1d,0x0,0x37,0x0,0x0,0x41,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x11,0x23,0x11,0x33,0x11,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x27,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x4,0x3f,0x36,0x35,0x35,0x9e,0x68,0x3a,0x65,0x2a,0x1e,0x35,0x17,0xb9,0xb9,0x17,0x35,0x1e,0x2b,0x66,0x3b,0x66,0x9c,0x36,0x35,0x36,0xb9,0x22,0x23,0x23,0x6e,0x4c,0x32,0x52,0x20,0x1c,0x2c,0x12,0x12,0x2f,0x1e,0x1f,0x4f,0x2f,0x4d,0x6e,0x24,0x23,0x22,0x2,0x11,0x15,0x79,0xcb,0x49,0x49,0x52,0x17,0x17,0x10,0x2b,0x1b,0x2,0x4c,0xf8,0x4a,0x2,0xb,0x1a,0x29,0xf,0x16,0x17,0x54,0x4a,0x4a,0xc9,0x89,0x15,0x4f,0x90,0x37,0x37,0x41,0x19,0x16,0x13,0x33,0x1e,0x2,0x6,0x20,0x36,0x13,0x15,0x17,0x40,0x36,0x37,0x8f,0x0,0x1,0x0,0xba,0x0,0x0,0x4,0x72,0x4,0x3a,0x0,0xc,0x0,0x0,0x41,0x1,0x33,0x1,0x1,0x23,0x1,0x7,0x11,0x23,0x11,0x33,0x11,0x2,0x9,0x1,0x7f,0xea,0xfe,0x14,0x1,0xc8,0xdf,0xfe,0x72,0x6e,0xb9,0xb9,0x1,0xdd,0xfe,0x23,0x2,0x5b,0x1,0xdf,0xfe,0x65,0x78,0x2,0x13,0xfb,0xc6,0x1,0x58,0x0,0x0,0x1,0x0,0xa9,0xff,0xeb,0x4,0x4c,0x6,0x16,0x0,0x51,0x0,0x0,0x61,0x11,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x1,0x61,0x1,0x77,0x63,0x20,0x3f,0x19,0x18,0x1e,0x14,0xf,0x10,0x24,0xf,0x10,0x14,0x2e,0x22,0x22,0x50,0x22,0x22,0x2d,0x15,0x16,0x16,0x44,0x2f,0x22,0x45,0x1f,0x20,0x35,0x12,0x2a,0x14,0x44,0x29,0x28,0x58,0x29,0x4c,0x7f,0x2e,0x2e,0x33,0x2d,0x22,0x22,0x50,0x22,0x22,0x2d,0x27,0x18,0x18,0x28,0x38,0x31,0x31,0x82,0x4b,0x55,0x90,0x34,0x35,0x3b,0x4,0x3f,0x9b,0xa4,0x1a,0x19,0x1a,0x4b,0x32,0x26,0x3f,0x1d,0x1e,0x37,0x1d,0x1e,0x42,0x27,0x44,0x67,0x29,0x2a,0x47,0x22,0x23,0x4d,0x2f,0x26,0x40,0x18,0x18,0x1b,0xf,0xc,0xb,0x1b,0xb,0x9b,0x10,0x1a,0x9,0xa,0xb,0x2a,0x2a,0x2a,0x7e,0x55,0x41,0x64,0x29,0x29,0x46,0x23,0x23,0x4a,0x2e,0x32,0x4d,0x2a,0x2a,0x6b,0x4f,0x56,0x7f,0x2a,0x2a,0x29,0x3f,0x3c,0x3c,0xb0,0x70,0xfb,0xc1,0x0,0x0,0x2,0x0,0xb1,0xff,0xec,0x4,0x5f,0x4,0x4f,0x0,0x2a,0x0,0x38,0x0,0x0,0x41,0x22,0x6,0x7,0x6,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x14,0x16,0x15,0x21,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x16,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x3,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x21,0x6,0x6,0x7,0x6,0x6,0x2,0x61,0x4b,0x7d,0x31,0x32,0x4b,0x1b,0x49,0x19,0x3d,0x24,0x2a,0x67,0x3d,0x4e,0x76,0x29,0x25,0x2c,0x5,0x1,0xfd,0xc,0x38,0x39,0x39,0xad,0x75,0x60,0xaf,0x43,0x42,0x4e,0x47,0x42,0x42,0xbd,0x5a,0x47,0x68,0x21,0x22,0x21,0x2,0x35,0xb,0x32,0x25,0x26,0x61,0x4,0x4f,0x17,0x13,0x13,0x30,0x19,0x7d,0x15,0x25,0xe,0x11,0x13,0x3a,0x32,0x2f,0x7b,0x46,0x5,0xa,0x5,0x79,0x69,0xb1,0x40,0x40,0x48,0x1,0x50,0x48,0x47,0xc6,0x75,0x2c,0x75,0xc6,0x49,0x48,0x51,0xfc,0x35,0x2d,0x26,0x26,0x64,0x36,0x1a,0x40,0x6e,0x28,0x29,0x2e,0x0,0x1,0x0,0xa2,0xff,0x30,0x4,0x45,0x6,0x9c,0x0,0x4f,0x0,0x0,0x41,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x17,0x15,0x33,0x35,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x26,0x26,0x27,0x26,0x26,0x27,0x35,0x23,0x15,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x3,0x8b,0x27,0x24,0x24,0x68,0x41,0x33,0x64,0x27,0x28,0x32,0xb9,0x42,0x37,0x37,0x8f,0x4e,0x95,0x57,0x8f,0x32,0x32,0x37,0x37,0x34,0x34,0x96,0x5e,0x4d,0x6d,0x22,0x23,0x20,0x1d,0x1c,0x1e,0x5f,0x40,0x3b,0x5c,0x20,0x1f,0x21,0xb8,0x1,0x3c,0x39,0x2c,0x78,0x49,0x95,0x51,0x85,0x2e,0x2f,0x33,0x3a,0x36,0x35,0x96,0x5d,0x4a,0x6c,0x22,0x22,0x1f,0x1,0x77,0x37,0x57,0x1e,0x1f,0x20,0x1c,0x21,0x21,0x6f,0x54,0x71,0xa2,0x35,0x36,0x38,0x8,0xbf,0xc0,0x9,0x3c,0x32,0x31,0x8a,0x57,0x59,0x86,0x33,0x33,0x4c,0x1f,0x1a,0x37,0x20,0x20,0x4e,0x32,0x33,0x53,0x1e,0x21,0x24,0x2e,0x28,0x29,0x71,0x43,0x73,0xb1,0x3c,0x2d,0x39,0xa,0xdc,0xdc,0xa,0x3e,0x32,0x33,0x88,0x54,0x59,0x88,0x34,0x35,0x4c,0x1d,0x18,0x39,0x21,0x21,0x4d,0x0,0x1,0x0,0x93,0xff,0xb,0x4,0x37,0x5,0x26,0x0,0x39,0x0,0x0,0x65,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x34,0x26,0x27,0x26,0x26,0x27,0x35,0x23,0x15,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x15,0x33,0x35,0x36,0x36,0x37,0x36,0x36,0x37,0x23,0x6,0x6,0x7,0x6,0x6,0x2,0x7f,0x57,0x75,0x23,0x24,0x1f,0x1f,0x24,0x24,0x75,0x56,0x38,0x61,0x23,0x23,0x29,0x1,0xaf,0x35,0x30,0x30,0x84,0x50,0xb9,0x60,0x91,0x30,0x30,0x31,0x31,0x30,0x30,0x91,0x60,0xb9,0x49,0x83,0x31,0x31,0x3a,0x1,0xaf,0x1,0x2d,0x25,0x25,0x5f,0x82,0x45,0x38,0x37,0x8b,0x47,0x2a,0x46,0x8a,0x38,0x37,0x45,0x26,0x21,0x21,0x57,0x31,0x49,0x82,0x33,0x33,0x45,0xc,0xde,0xe2,0x12,0x63,0x47,0x48,0xaf,0x5f,0x2a,0x5f,0xb0,0x47,0x47,0x63,0x12,0xeb,0xe8,0xc,0x42,0x30,0x2f,0x75,0x40,0x2d,0x4d,0x1c,0x1d,0x20,0x0,0x0,0x1,0x0,0x71,0x0,0x0,0x4,0x7c,0x5,0xc4,0x0,0x33,0x0,0x0,0x41,0x21,0x35,0x21,0x3,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x13,0x23,0x15,0x33,0x17,0x14,0x6,0x7,0x6,0x6,0x7,0x23,0x15,0x21,0x37,0x21,0x36,0x36,0x37,0x36,0x36,0x35,0x1,0xcf,0x1,0x3b,0xfe,0xc0,0x8,0x25,0x20,0x20,0x59,0x33,0x30,0x57,0x22,0x21,0x27,0xba,0x38,0x34,0x35,0x98,0x60,0x60,0xa4,0x3b,0x3b,0x43,0x9,0xa0,0xa5,0x8,0x8,0xb,0xb,0x25,0x1b,0x4b,0x4,0x6,0x1,0xfd,0x1e,0xd,0x13,0x7,0xb,0xb,0x2,0x72,0x98,0x1,0x5,0x43,0x6b,0x25,0x24,0x27,0x1b,0x1c,0x1d,0x59,0x3f,0x57,0x8e,0x33,0x33,0x38,0x3c,0x38,0x39,0xa2,0x66,0xfe,0xfb,0x98,0xe2,0x20,0x51,0x24,0x25,0x38,0x7,0x97,0x97,0x13,0x2c,0x18,0x25,0x53,0x2a,0x0,0x0,0x1,0x0,0x21,0x0,0x0,0x4,0xab,0x5,0xb0,0x0,0x19,0x0,0x0,0x61,0x33,0x11,0x21,0x35,0x21,0x35,0x21,0x35,0x21,0x1,0x23,0x1,0x7,0x23,0x27,0x1,0x23,0x1,0x21,0x15,0x21,0x15,0x21,0x15,0x21,0x2,0x6,0xb9,0x1,0x85,0xfe,0x7b,0x1,0x85,0xfe,0xc2,0x1,0xa5,0xd4,0xfe,0xbe,0x2e,0x2,0x2e,0xfe,0xbe,0xd4,0x1,0xa5,0xfe,0xc4,0x1,0x7c,0xfe,0x84,0x1,0x7c,0x1,0x46,0x78,0xa9,0x79,0x2,0xd0,0xfd,0xb1,0x55,0x56,0x2,0x4e,0xfd,0x30,0x79,0xa9,0x78,0x0,0x1,0x0,0xa0,0xfe,0x4b,0x4,0x4a,0x6,0x2b,0x0,0x2f,0x0,0x0,0x41,0x35,0x23,0x27,0x34,0x36,0x37,0x36,0x36,0x37,0x32,0x16,0x17,0x37,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x23,0x15,0x33,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x7,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x3,0x7f,0xd4,0x1,0x1e,0x20,0x1f,0x62,0x41,0x28,0x47,0x1a,0x17,0x2f,0x59,0x2f,0x60,0x9a,0x36,0x37,0x3a,0xb1,0xb1,0x1,0x21,0x20,0x15,0x39,0x22,0x16,0x5f,0x1d,0xe,0x27,0x50,0x29,0x55,0x87,0x2f,0x2e,0x32,0x3,0xab,0x8f,0x63,0x3a,0x5a,0x1e,0x1f,0x1f,0x1,0x10,0xd,0x93,0x11,0x16,0x34,0x32,0x33,0x95,0x60,0x63,0x8f,0xfc,0x21,0x41,0x62,0x1e,0x13,0x15,0x10,0x10,0x94,0x14,0x10,0x33,0x31,0x30,0x90,0x5d,0x3,0xdf,0xff,0xff,0x0,0x11,0x0,0x0,0x4,0x3d,0x5,0xb0,0x6,0x26,0x0,0x7,0x0,0x0,0x0,0x7,0x2,0x6a,0xfe,0xdc,0xfe,0x7f,0x0,0x1,0x0,0x69,0x0,0x0,0x4,0x76,0x5,0xc4,0x0,0x3b,0x0,0x0,0x41,0x35,0x21,0x27,0x21,0x35,0x21,0x27,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x17,0x23,0x15,0x33,0x17,0x23,0x15,0x33,0x17,0x14,0x6,0x7,0x6,0x6,0x7,0x23,0x15,0x21,0x37,0x21,0x36,0x36,0x37,0x36,0x36,0x35,0x27,0x3,0x22,0xfe,0xa7,0x4,0x1,0x5d,0xfe,0x9f,0x6,0x25,0x20,0x20,0x59,0x33,0x30,0x57,0x22,0x21,0x28,0xb9,0x38,0x34,0x35,0x98,0x60,0x60,0xa3,0x3b,0x3c,0x42,0x6,0x9f,0xa3,0x5,0xa8,0xac,0x3,0x9,0xb,0xb,0x24,0x1b,0x4b,0x4,0x6,0x1,0xfd,0x1e,0xe,0x16,0x7,0x9,0x8,0x3,0x1,0xd7,0x7a,0x8a,0x7b,0xb9,0x43,0x6b,0x25,0x24,0x27,0x1b,0x1c,0x1d,0x59,0x3f,0x57,0x8e,0x33,0x33,0x38,0x3c,0x38,0x39,0xa2,0x66,0xb9,0x7b,0x8a,0x7a,0x47,0x20,0x51,0x24,0x25,0x38,0x7,0x97,0x97,0x16,0x34,0x1d,0x22,0x4b,0x25,0x47,0x0,0x0,0x2,0x0,0x7f,0xff,0xec,0x4,0xb3,0x5,0xb0,0x0,0x2d,0x0,0x3c,0x0,0x0,0x41,0x35,0x23,0x11,0x23,0x11,0x23,0x26,0x26,0x27,0x26,0x26,0x23,0x23,0x11,0x33,0x11,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x33,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x5,0x11,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x4,0x9e,0xb0,0xb9,0x59,0x8,0x36,0x2c,0x2c,0x7b,0x4e,0xfe,0xb9,0x45,0x4e,0x7b,0x2d,0x2c,0x35,0x8,0x59,0x23,0x20,0x1f,0x56,0x34,0x2a,0x51,0x17,0x19,0xc,0x2b,0x14,0x15,0x24,0xc,0xd,0xf,0xfd,0x4a,0x45,0x2d,0x41,0x14,0x14,0x13,0x13,0x14,0x15,0x40,0x2d,0x3,0xab,0x8f,0x1,0x6,0xfe,0xfa,0x52,0x89,0x32,0x31,0x38,0xfa,0x50,0x2,0x35,0x37,0x32,0x31,0x8a,0x52,0xfd,0x7d,0x53,0x78,0x26,0x27,0x24,0x16,0x11,0x84,0x4,0xa,0x11,0x13,0x12,0x3c,0x2c,0x2,0x84,0xdf,0x2,0x4c,0x32,0x29,0x2a,0x6b,0x38,0x38,0x68,0x29,0x29,0x32,0x0,0x0,0x2,0x0,0x67,0xff,0xe5,0x4,0x92,0x4,0x38,0x0,0x23,0x0,0x3b,0x0,0x0,0x65,0x17,0x37,0x27,0x36,0x36,0x35,0x34,0x26,0x27,0x37,0x27,0x7,0x26,0x26,0x23,0x22,0x6,0x7,0x27,0x7,0x17,0x6,0x6,0x15,0x14,0x16,0x17,0x7,0x17,0x37,0x16,0x16,0x33,0x32,0x36,0x1,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x3,0xa3,0x6b,0x84,0x74,0x24,0x28,0x2c,0x28,0x7c,0x84,0x78,0x3c,0x90,0x50,0x50,0x8f,0x3c,0x75,0x83,0x78,0x2a,0x2c,0x28,0x26,0x70,0x83,0x68,0x3e,0x95,0x55,0x55,0x96,0xfd,0xd0,0x32,0x2c,0x2b,0x77,0x45,0x45,0x76,0x2c,0x2b,0x31,0x31,0x2b,0x2c,0x76,0x45,0x45,0x77,0x2b,0x2c,0x32,0x54,0x6f,0x88,0x77,0x3e,0x91,0x50,0x55,0x98,0x40,0x80,0x88,0x7d,0x2d,0x31,0x30,0x2c,0x7a,0x87,0x7c,0x41,0x9a,0x56,0x51,0x93,0x3f,0x73,0x87,0x6c,0x30,0x36,0x36,0x1,0xe1,0x4a,0x84,0x32,0x31,0x3a,0x3a,0x31,0x32,0x84,0x4a,0x4a,0x84,0x31,0x32,0x3b,0x3b,0x32,0x31,0x84,0x0,0x2,0x1,0xe6,0xff,0xf5,0x2,0xcc,0x5,0xb0,0x0,0x3,0x0,0xf,0x0,0x0,0x41,0x11,0x23,0x11,0x3,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x2,0xb2,0xba,0x12,0x39,0x39,0x39,0x3b,0x3b,0x39,0x39,0x39,0x1,0xd7,0x3,0xd9,0xfc,0x27,0xfe,0x8a,0x2e,0x3e,0x3e,0x2e,0x30,0x40,0x40,0x0,0x0,0x2,0x1,0xf2,0xfe,0x8c,0x2,0xd8,0x4,0x4f,0x0,0x3,0x0,0xf,0x0,0x0,0x41,0x11,0x33,0x11,0x13,0x34,0x26,0x23,0x22,0x6,0x15,0x14,0x16,0x33,0x32,0x36,0x2,0xa,0xb9,0x15,0x3b,0x38,0x39,0x3a,0x3a,0x39,0x38,0x3b,0x2,0x63,0xfc,0x29,0x3,0xd7,0x1,0x7b,0x30,0x41,0x41,0x30,0x2e,0x3f,0x3f,0x0,0x0,0x2,0x0,0xbf,0xff,0xf5,0x4,0x1b,0x5,0xc4,0x0,0x31,0x0,0x3d,0x0,0x0,0x41,0x33,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x3,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x1,0xff,0xb9,0x4,0x8,0x8,0x21,0x1e,0x2f,0x61,0x27,0x27,0x32,0x3a,0x37,0x37,0x9f,0x65,0x5b,0x9d,0x39,0x3a,0x44,0x1,0xb9,0x2a,0x23,0x22,0x59,0x2f,0x3d,0x5e,0x1f,0x1c,0x1d,0x26,0x1d,0x1e,0x47,0x22,0x32,0x3c,0x10,0x10,0xa,0x16,0x39,0x39,0x39,0x3b,0x3b,0x39,0x39,0x39,0x1,0x9a,0x27,0x3d,0x1b,0x1b,0x34,0x1d,0x2a,0x62,0x39,0x38,0x7f,0x48,0x5a,0x8c,0x31,0x31,0x33,0x31,0x2e,0x2f,0x86,0x54,0x34,0x4b,0x19,0x18,0x17,0x20,0x1f,0x1c,0x51,0x34,0x32,0x5a,0x28,0x29,0x4a,0x23,0x2e,0x43,0x24,0x25,0x5d,0xfe,0x7f,0x2e,0x3e,0x3e,0x2e,0x30,0x40,0x40,0x0,0x2,0x0,0xcc,0xfe,0x78,0x4,0x0,0x4,0x4d,0x0,0x31,0x0,0x3d,0x0,0x0,0x41,0x23,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x23,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x3,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x2,0xd4,0xb9,0x3,0x7,0x8,0x20,0x1d,0x2d,0x5b,0x24,0x25,0x2f,0x37,0x35,0x34,0x99,0x61,0x57,0x95,0x37,0x37,0x3f,0x1,0xb9,0x26,0x1f,0x20,0x51,0x2b,0x38,0x57,0x1c,0x1b,0x1b,0x23,0x1c,0x1b,0x42,0x1f,0x31,0x3b,0xf,0xf,0x9,0xd6,0x3a,0x39,0x39,0x3a,0x3a,0x39,0x39,0x3a,0x2,0xa1,0x27,0x3c,0x1a,0x1b,0x32,0x1d,0x2b,0x63,0x38,0x39,0x80,0x48,0x5a,0x8c,0x31,0x31,0x33,0x31,0x2f,0x2e,0x86,0x54,0x34,0x4b,0x18,0x19,0x17,0x1f,0x1e,0x1c,0x52,0x35,0x33,0x5a,0x29,0x29,0x4b,0x23,0x2d,0x43,0x24,0x24,0x5c,0x1,0x82,0x2e,0x3f,0x3f,0x2e,0x30,0x41,0x41,0x0,0x1,0x1,0x62,0xfe,0xb0,0x2,0x83,0x0,0xdb,0x0,0x9,0x0,0x0,0x65,0x35,0x23,0x15,0x14,0x6,0x7,0x17,0x36,0x36,0x2,0x83,0xc9,0x28,0x30,0x73,0x50,0x5e,0x2b,0xb0,0xb3,0x55,0x9e,0x46,0x3f,0x47,0xd0,0x0,0x0,0x1,0x1,0xf0,0xff,0xed,0x3,0x14,0x1,0x7,0x0,0xb,0x0,0x0,0x65,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x1,0xf0,0x49,0x48,0x47,0x4c,0x4b,0x48,0x49,0x48,0x78,0x3a,0x51,0x50,0x3b,0x3c,0x53,0x54,0xff,0xff,0x2,0x22,0xff,0xed,0x3,0x46,0x4,0x73,0x4,0x26,0x0,0x60,0x32,0x0,0x0,0x7,0x0,0x60,0x0,0x32,0x3,0x6c,0xff,0xff,0x1,0xe6,0xfe,0xb0,0x3,0x3d,0x4,0x73,0x4,0x27,0x0,0x60,0x0,0x29,0x3,0x6c,0x0,0x7,0x0,0x5f,0x0,0x84,0x0,0x0,0xff,0xff,0x1,0x9,0xff,0xed,0x5,0x26,0x1,0x7,0x4,0x27,0x0,0x60,0xff,0x19,0x0,0x0,0x0,0x27,0x0,0x60,0x0,0x9c,0x0,0x0,0x0,0x7,0x0,0x60,0x2,0x12,0x0,0x0,0x0,0x1,0x1,0xf8,0x2,0x6b,0x2,0xde,0x3,0x49,0x0,0xb,0x0,0x0,0x41,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x1,0xf8,0x3a,0x39,0x38,0x3b,0x3b,0x38,0x39,0x3a,0x2,0xd9,0x2f,0x3f,0x3f,0x2f,0x30,0x40,0x40,0x0,0x0,0x1,0x1,0x9a,0x2,0x17,0x3,0x31,0x3,0xdc,0x0,0x19,0x0,0x0,0x41,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x1,0x9a,0x1d,0x1b,0x1a,0x4b,0x2f,0x2f,0x4b,0x1b,0x1a,0x1c,0x1c,0x1a,0x1b,0x4c,0x2f,0x2f,0x4b,0x1a,0x1a,0x1d,0x3,0x16,0x3a,0x2b,0x48,0x1a,0x1b,0x1d,0x1d,0x1b,0x1a,0x48,0x2b,0x3a,0x2b,0x49,0x1a,0x1a,0x1e,0x1e,0x1a,0x1a,0x49,0x0,0x0,0x1,0x0,0x9b,0xff,0x69,0x4,0x30,0x0,0x0,0x0,0x3,0x0,0x0,0x45,0x35,0x21,0x15,0x4,0x30,0xfc,0x6b,0x97,0x97,0x97,0x0,0x0,0x1,0x0,0xda,0x2,0x31,0x3,0xd7,0x2,0xc9,0x0,0x3,0x0,0x0,0x41,0x35,0x21,0x15,0x3,0xd7,0xfd,0x3,0x2,0x31,0x98,0x98,0x0,0x1,0x0,0x4a,0x2,0x8b,0x4,0x87,0x3,0x22,0x0,0x3,0x0,0x0,0x41,0x35,0x21,0x15,0x4,0x87,0xfb,0xc3,0x2,0x8b,0x97,0x97,0x0,0x1,0x0,0x4f,0x2,0x8b,0x4,0x8c,0x3,0x22,0x0,0x3,0x0,0x0,0x41,0x35,0x21,0x15,0x4,0x8c,0xfb,0xc3,0x2,0x8b,0x97,0x97,0x0,0x1,0x1,0xee,0x4,0x21,0x2,0x8d,0x6,0x0,0x0,0x5,0x0,0x0,0x41,0x35,0x23,0x15,0x3,0x33,0x2,0x8d,0x9e,0x1,0x8a,0x5,0x91,0x6f,0x7f,0xfe,0xa0,0x0,0x0,0x2,0x1,0x62,0x4,0x21,0x3,0x5f,0x6,0x0,0x0,0x5,0x0,0xb,0x0,0x0,0x41,0x35,0x23,0x15,0x3,0x33,0x1,0x37,0x23,0x15,0x3,0x33,0x1,0xf9,0x96,0x1,0x82,0x1,0x7a,0x1,0x96,0x1,0x81,0x5,0x93,0x6d,0x7d,0xfe,0x9e,0x1,0x72,0x6d,0x7d,0xfe,0x9e,0x0,0x0,0x1,0x1,0xec,0x4,0xf,0x2,0xff,0x6,0x1d,0x0,0xc,0x0,0x0,0x41,0x15,0x33,0x35,0x34,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x1,0xec,0xb5,0x2f,0x2f,0x65,0x2a,0x40,0x16,0x17,0x17,0x4,0xa1,0x92,0x95,0x56,0x94,0x47,0x48,0x24,0x5c,0x32,0x33,0x68,0x0,0x0,0x1,0x1,0xcd,0x4,0x7,0x2,0xe0,0x6,0x16,0x0,0xc,0x0,0x0,0x41,0x35,0x23,0x15,0x14,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x2,0xe0,0xb5,0x2f,0x2f,0x65,0x2a,0x40,0x17,0x16,0x17,0x5,0x83,0x93,0x96,0x56,0x94,0x47,0x48,0x24,0x5c,0x33,0x32,0x68,0x0,0x0,0x1,0x1,0xbc,0xfe,0xd1,0x2,0xd3,0x0,0xe1,0x0,0xc,0x0,0x0,0x65,0x35,0x23,0x15,0x14,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x2,0xd3,0xb9,0x2f,0x2f,0x69,0x2a,0x40,0x17,0x16,0x17,0x4c,0x95,0x97,0x56,0x94,0x46,0x49,0x24,0x5d,0x32,0x32,0x67,0xff,0xff,0x1,0x49,0x4,0xf,0x3,0xa1,0x6,0x1d,0x4,0x27,0x0,0x6c,0xff,0x5d,0x0,0x0,0x0,0x7,0x0,0x6c,0x0,0xa2,0x0,0x0,0xff,0xff,0x1,0x2d,0x4,0x7,0x3,0x8c,0x6,0x16,0x4,0x27,0x0,0x6d,0xff,0x60,0x0,0x0,0x0,0x7,0x0,0x6d,0x0,0xac,0x0,0x0,0x0,0x2,0x1,0x2f,0xfe,0xcf,0x3,0x68,0x0,0xdf,0x0,0xc,0x0,0x19,0x0,0x0,0x65,0x35,0x23,0x15,0x14,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x25,0x35,0x23,0x15,0x14,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x2,0x46,0xb9,0x2f,0x2f,0x69,0x2a,0x40,0x17,0x16,0x17,0x1,0x22,0xb9,0x2f,0x2f,0x69,0x2a,0x40,0x17,0x16,0x17,0x4b,0x94,0x97,0x56,0x94,0x46,0x49,0x24,0x5d,0x32,0x32,0x68,0x2f,0x94,0x97,0x56,0x94,0x46,0x49,0x24,0x5d,0x32,0x32,0x68,0xff,0xff,0x1,0xee,0x4,0x21,0x2,0x8d,0x6,0x0,0x6,0x6,0x0,0x6a,0x0,0x0,0xff,0xff,0x1,0x62,0x4,0x21,0x3,0x5f,0x6,0x0,0x6,0x6,0x0,0x6b,0x0,0x0,0x0,0x1,0x1,0x65,0xfe,0x2a,0x3,0x75,0x6,0x6b,0x0,0x27,0x0,0x0,0x41,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x37,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x1,0x65,0x2d,0x26,0x25,0x63,0x37,0x36,0x6f,0x32,0x27,0x29,0x51,0x26,0x25,0x44,0x1a,0x18,0x1c,0x1e,0x1b,0x1c,0x54,0x2e,0x1f,0x41,0x20,0x27,0x32,0x6e,0x36,0x37,0x63,0x26,0x26,0x2d,0x2,0x4f,0xa,0x8f,0xfc,0x6b,0x6c,0xb1,0x45,0x46,0x61,0x1c,0x71,0x21,0x5d,0x3c,0x3f,0x9f,0x5d,0x5c,0xda,0x7d,0xe,0x82,0xe2,0x5e,0x68,0xaf,0x41,0x2a,0x44,0x18,0x7a,0x1c,0x62,0x45,0x45,0xb2,0x6b,0x6c,0xfc,0x0,0x0,0x1,0x1,0x40,0xfe,0x2a,0x3,0x51,0x6,0x6b,0x0,0x27,0x0,0x0,0x41,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x3,0x51,0x2f,0x24,0x25,0x62,0x38,0x36,0x70,0x32,0x27,0x21,0x46,0x21,0x2b,0x52,0x1d,0x14,0x21,0x19,0x17,0x16,0x45,0x25,0x27,0x56,0x2a,0x27,0x32,0x6f,0x37,0x36,0x63,0x26,0x26,0x2d,0x2,0x45,0xa,0x99,0xf5,0x69,0x6d,0xae,0x47,0x45,0x62,0x1c,0x71,0x1b,0x4d,0x33,0x41,0xaf,0x6e,0x4d,0xdc,0x87,0xe,0x77,0xd1,0x5a,0x61,0xa3,0x41,0x40,0x62,0x1f,0x71,0x1c,0x61,0x46,0x45,0xb1,0x6c,0x6b,0xfc,0x0,0x0,0x1,0x1,0xaa,0xfe,0xc8,0x3,0x36,0x6,0x80,0x0,0x7,0x0,0x0,0x41,0x35,0x21,0x11,0x21,0x35,0x23,0x11,0x3,0x36,0xfe,0x74,0x1,0x8c,0xdd,0x5,0xe8,0x98,0xf8,0x48,0x98,0x6,0x88,0x0,0x0,0x1,0x1,0x95,0xfe,0xc8,0x3,0x22,0x6,0x80,0x0,0x7,0x0,0x0,0x41,0x15,0x33,0x11,0x23,0x15,0x21,0x11,0x1,0x95,0xde,0xde,0x1,0x8d,0x6,0x80,0x98,0xf9,0x78,0x98,0x7,0xb8,0x0,0x1,0x1,0x43,0xfe,0x92,0x3,0xe7,0x6,0x3d,0x0,0x2a,0x0,0x0,0x41,0x37,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x26,0x26,0x27,0x36,0x36,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x6,0x23,0x15,0x16,0x16,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x3,0xd2,0x15,0x3e,0x51,0x18,0x19,0x14,0x1,0x6e,0x74,0x74,0x6f,0xc,0x16,0x15,0x55,0x48,0x15,0x65,0x8e,0x2c,0x2f,0x2b,0x89,0x8d,0x8d,0x89,0x2e,0x2d,0x2f,0x8e,0xfe,0x92,0x73,0x2,0x40,0x32,0x31,0x7b,0x3e,0xa9,0x77,0xb5,0x2e,0x2f,0xb5,0x78,0xaa,0x3d,0x7c,0x32,0x31,0x40,0x2,0x73,0x3,0x51,0x40,0x43,0xa9,0x51,0xaa,0x91,0x81,0x91,0x1,0x82,0x90,0xa9,0x50,0xa3,0x42,0x45,0x54,0x0,0x1,0x1,0x43,0xfe,0x92,0x3,0xe7,0x6,0x3d,0x0,0x36,0x0,0x0,0x45,0x17,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x35,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x1,0x43,0x15,0x62,0x8e,0x2f,0x2e,0x2c,0x20,0x21,0x22,0x6b,0x48,0x52,0x75,0x21,0x17,0x17,0x2d,0x33,0x2d,0x8b,0x61,0x14,0x48,0x54,0x16,0x15,0xd,0x2e,0x30,0x19,0x43,0x28,0x27,0x41,0x1a,0x31,0x2f,0x15,0x18,0x19,0x52,0xfb,0x73,0x2,0x56,0x43,0x43,0xa3,0x50,0xa9,0x46,0x66,0x22,0x23,0x21,0x1,0x91,0x2b,0x2f,0x21,0x5b,0x3c,0xaa,0x54,0xac,0x45,0x3d,0x4c,0x3,0x73,0x2,0x40,0x31,0x32,0x7c,0x3d,0xaa,0x4e,0x85,0x32,0x1b,0x2c,0x10,0x10,0x2a,0x1a,0x31,0x86,0x4f,0xa9,0x3e,0x7b,0x31,0x32,0x40,0x0,0x1,0x1,0x8c,0x0,0x99,0x3,0x40,0x3,0xb5,0x0,0x6,0x0,0x0,0x41,0x1,0x23,0x1,0x15,0x1,0x33,0x2,0x3e,0x1,0x2,0x8d,0xfe,0xd9,0x1,0x27,0x8d,0x2,0x26,0x1,0x8f,0xfe,0x7b,0x13,0xfe,0x7c,0x0,0x1,0x1,0x8c,0x0,0x98,0x3,0x40,0x3,0xb5,0x0,0x6,0x0,0x0,0x41,0x23,0x1,0x1,0x33,0x1,0x35,0x2,0x1a,0x8e,0x1,0x2,0xfe,0xfe,0x8e,0x1,0x26,0x3,0xb5,0xfe,0x71,0xfe,0x72,0x1,0x85,0x13,0x0,0x1,0x0,0x77,0x0,0x92,0x4,0x5d,0x4,0xb6,0x0,0xb,0x0,0x0,0x41,0x11,0x23,0x11,0x21,0x15,0x21,0x11,0x33,0x11,0x21,0x35,0x2,0xc6,0xb9,0xfe,0x6a,0x1,0x96,0xb9,0x1,0x97,0x3,0xd,0x1,0xa9,0xfe,0x57,0xb8,0xfe,0x3d,0x1,0xc3,0xb8,0x0,0x1,0x0,0xa9,0x2,0x8b,0x3,0xec,0x3,0x22,0x0,0x3,0x0,0x0,0x41,0x35,0x21,0x15,0x3,0xec,0xfc,0xbd,0x2,0x8b,0x97,0x97,0x0,0x2,0x0,0x9c,0x0,0x1,0x4,0x30,0x4,0xf3,0x0,0xb,0x0,0xf,0x0,0x0,0x41,0x11,0x23,0x11,0x21,0x15,0x21,0x11,0x33,0x11,0x21,0x35,0x3,0x35,0x21,0x15,0x2,0xc5,0xa8,0xfe,0x7f,0x1,0x81,0xa8,0x1,0x6b,0x2a,0xfc,0xbd,0x3,0x57,0x1,0x9c,0xfe,0x64,0x98,0xfe,0x62,0x1,0x9e,0x98,0xfc,0xaa,0x97,0x97,0x0,0x0,0x1,0x0,0xb5,0x0,0xce,0x4,0x3a,0x4,0x63,0x0,0xb,0x0,0x0,0x53,0x17,0x1,0x1,0x37,0x1,0x1,0x27,0x1,0x1,0x7,0x1,0xb5,0x77,0x1,0x4b,0x1,0x4c,0x77,0xfe,0xb5,0x1,0x48,0x77,0xfe,0xb7,0xfe,0xb8,0x77,0x1,0x47,0x1,0x49,0x7b,0x1,0x51,0xfe,0xaf,0x7b,0x1,0x51,0x1,0x4e,0x7b,0xfe,0xb1,0x1,0x4f,0x7b,0xfe,0xb2,0x0,0x0,0x3,0x0,0x73,0x0,0xb1,0x4,0x59,0x4,0xb4,0x0,0x3,0x0,0xf,0x0,0x1b,0x0,0x0,0x41,0x35,0x21,0x15,0x1,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x3,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x4,0x59,0xfc,0x1a,0x1,0x88,0x37,0x36,0x36,0x38,0x38,0x36,0x36,0x37,0x2,0x37,0x36,0x36,0x38,0x38,0x36,0x36,0x37,0x2,0x58,0xb8,0xb8,0x1,0xf1,0x2d,0x3c,0x3c,0x2d,0x2d,0x3e,0x3e,0xfc,0xa4,0x2c,0x3d,0x3d,0x2c,0x2d,0x3e,0x3e,0x0,0x0,0x2,0x0,0xad,0x1,0x6d,0x4,0x2a,0x3,0xad,0x0,0x3,0x0,0x7,0x0,0x0,0x41,0x35,0x21,0x15,0x1,0x35,0x21,0x15,0x4,0x2a,0xfc,0x83,0x3,0x7d,0xfc,0x83,0x3,0xc,0xa1,0xa1,0xfe,0x61,0xa0,0xa0,0x0,0x1,0x0,0xa9,0x0,0xb5,0x4,0x26,0x4,0x41,0x0,0x13,0x0,0x0,0x41,0x35,0x21,0x37,0x21,0x35,0x23,0x37,0x27,0x7,0x21,0x15,0x21,0x7,0x21,0x15,0x21,0x7,0x17,0x37,0x4,0x26,0xfe,0x4c,0x80,0x1,0x34,0xe4,0x31,0x4d,0x4a,0xfd,0xcd,0x1,0xe2,0x80,0xfe,0x9e,0x1,0x11,0x42,0x4e,0x5c,0x1,0x6d,0xa0,0xff,0xa1,0x61,0x33,0x94,0xa1,0xff,0xa0,0x85,0x33,0xb8,0x0,0x0,0x2,0x0,0x8d,0x1,0x14,0x4,0x3e,0x3,0xff,0x0,0x19,0x0,0x33,0x0,0x0,0x53,0x17,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x3,0x17,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x97,0xa,0x2f,0x7a,0x43,0x38,0x4f,0x43,0x45,0x7e,0x38,0x42,0x7a,0x30,0xa,0x2f,0x7a,0x43,0x2c,0x64,0x38,0x44,0x79,0x3f,0x43,0x7a,0x3a,0xa,0x2f,0x7a,0x43,0x39,0x49,0x51,0x51,0x6a,0x37,0x42,0x7a,0x30,0xa,0x2f,0x7a,0x43,0x35,0x6d,0x41,0x49,0x5f,0x39,0x43,0x7a,0x3,0x69,0xab,0x44,0x4f,0x18,0x24,0x25,0x2e,0x4f,0x43,0xab,0x44,0x4e,0x1d,0x20,0x27,0x2a,0x4e,0xfe,0x12,0xab,0x44,0x4e,0x17,0x28,0x28,0x27,0x4e,0x44,0xab,0x44,0x4f,0x27,0x25,0x2a,0x19,0x4f,0x0,0x1,0x0,0xaa,0x0,0xc4,0x3,0xfa,0x4,0x4b,0x0,0x8,0x0,0x0,0x65,0x35,0x25,0x27,0x37,0x25,0x35,0x1,0x15,0x3,0xfa,0xfd,0x9c,0x35,0x35,0x2,0x64,0xfc,0xb0,0xc4,0xc4,0xec,0x12,0x11,0xf0,0xc4,0xfe,0x86,0x92,0x0,0x0,0x1,0x0,0xb2,0x0,0xc5,0x4,0x25,0x4,0x4c,0x0,0x8,0x0,0x0,0x77,0x1,0x35,0x1,0x15,0x5,0x17,0x7,0x5,0xb2,0x3,0x73,0xfc,0x8d,0x2,0x87,0x3c,0x3c,0xfd,0x79,0xc5,0x1,0x7b,0x92,0x1,0x7a,0xbf,0xf0,0x13,0x11,0xf4,0x0,0x0,0x2,0x0,0xbb,0x0,0x9,0x4,0xd,0x4,0x99,0x0,0x8,0x0,0xc,0x0,0x0,0x41,0x35,0x25,0x27,0x37,0x25,0x35,0x1,0x15,0x1,0x35,0x21,0x15,0x4,0xd,0xfd,0x9c,0x35,0x35,0x2,0x64,0xfc,0xb0,0x3,0x41,0xfc,0xbd,0x1,0x6c,0xb1,0xd4,0x10,0x10,0xd8,0xb0,0xfe,0xac,0x83,0xfd,0x47,0x97,0x97,0x0,0x2,0x0,0xc2,0x0,0x7,0x4,0x35,0x4,0xad,0x0,0x8,0x0,0xc,0x0,0x0,0x53,0x1,0x35,0x1,0x15,0x5,0x17,0x7,0x5,0x1,0x35,0x21,0x15,0xc2,0x3,0x73,0xfc,0x8d,0x2,0x87,0x3c,0x3c,0xfd,0x79,0x3,0x44,0xfc,0xbd,0x1,0x80,0x1,0x55,0x84,0x1,0x54,0xac,0xd8,0x11,0xf,0xdc,0xfd,0xda,0x97,0x97,0x0,0x1,0x0,0xbd,0x1,0x77,0x3,0xfb,0x3,0x20,0x0,0x5,0x0,0x0,0x41,0x11,0x21,0x15,0x21,0x11,0x3,0xfb,0xfc,0xc2,0x2,0x85,0x1,0x77,0x1,0xa9,0xa1,0xfe,0xf8,0x0,0x0,0x1,0x0,0xfc,0xff,0x83,0x4,0x1,0x5,0xb0,0x0,0x3,0x0,0x0,0x45,0x1,0x23,0x1,0x1,0xa2,0x2,0x5f,0xa5,0xfd,0xa0,0x7d,0x6,0x2d,0xf9,0xd3,0x0,0x1,0x0,0xe7,0xff,0x83,0x3,0xee,0x5,0xb0,0x0,0x3,0x0,0x0,0x53,0x1,0x33,0x1,0xe7,0x2,0x60,0xa7,0xfd,0xa0,0x5,0xb0,0xf9,0xd3,0x6,0x2d,0x0,0x1,0x1,0x2b,0x0,0xd5,0x3,0x9e,0x4,0xd1,0x0,0x3,0x0,0x0,0x65,0x1,0x27,0x1,0x1,0x9c,0x2,0x2,0x72,0xfd,0xff,0xd5,0x3,0xba,0x42,0xfc,0x46,0x0,0x0,0x5,0x0,0x2c,0xff,0xeb,0x4,0x9e,0x5,0xc5,0x0,0x19,0x0,0x33,0x0,0x4d,0x0,0x67,0x0,0x6b,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x1,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x5,0x1,0x27,0x1,0x2c,0x23,0x22,0x22,0x65,0x41,0x41,0x64,0x22,0x21,0x23,0x23,0x21,0x22,0x65,0x42,0x41,0x64,0x21,0x22,0x23,0x8a,0xe,0x10,0xf,0x31,0x23,0x24,0x31,0x10,0xf,0xf,0xf,0xf,0xf,0x31,0x23,0x24,0x31,0x10,0x10,0xe,0x1,0xcf,0x23,0x22,0x22,0x65,0x42,0x41,0x63,0x22,0x22,0x23,0x23,0x22,0x22,0x64,0x42,0x41,0x64,0x22,0x22,0x23,0x8a,0xe,0x10,0xf,0x31,0x24,0x23,0x32,0x10,0xf,0xe,0xe,0xf,0xf,0x31,0x23,0x24,0x32,0xf,0x10,0xf,0xfe,0x7f,0x2,0x37,0x6f,0xfd,0xc9,0x4,0xaa,0x4d,0x39,0x66,0x26,0x27,0x2d,0x2d,0x27,0x26,0x66,0x39,0x4d,0x39,0x67,0x27,0x27,0x2d,0x2d,0x27,0x27,0x67,0x86,0x4d,0x1f,0x3b,0x17,0x16,0x1b,0x1b,0x16,0x17,0x3b,0x1f,0x4d,0x1f,0x39,0x16,0x17,0x1b,0x1b,0x17,0x16,0x39,0xfd,0x14,0x4e,0x39,0x66,0x26,0x27,0x2d,0x2d,0x27,0x26,0x66,0x39,0x4e,0x39,0x66,0x27,0x27,0x2d,0x2d,0x27,0x27,0x66,0x87,0x4e,0x1f,0x3a,0x17,0x16,0x1b,0x1b,0x16,0x17,0x3a,0x1f,0x4e,0x1f,0x3a,0x16,0x17,0x1b,0x1b,0x17,0x16,0x3a,0x29,0x4,0xd,0x3e,0xfb,0xf3,0x0,0x6,0x0,0x36,0xff,0xeb,0x4,0xa0,0x5,0xc5,0x0,0x31,0x0,0x4b,0x0,0x65,0x0,0x7f,0x0,0x99,0x0,0x9d,0x0,0x0,0x41,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x1,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x1,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x1,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x1,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x25,0x1,0x27,0x1,0x1,0x56,0x1f,0x1f,0x1f,0x5c,0x3d,0x24,0x3e,0x19,0xf,0x1a,0xb,0xa,0x17,0xd,0x1b,0x42,0x27,0x3c,0x5b,0x1f,0x1e,0x1f,0x1f,0x1f,0x1f,0x5b,0x3d,0x23,0x3c,0x19,0x10,0x1c,0xc,0xd,0x20,0x12,0x18,0x39,0x21,0x3c,0x5b,0x1f,0x1f,0x1f,0xfe,0xe0,0x20,0x1f,0x1f,0x5c,0x3c,0x3c,0x5a,0x1f,0x1e,0x20,0x1f,0x1f,0x1f,0x5b,0x3d,0x3c,0x5b,0x1f,0x1f,0x1f,0x1,0xab,0xb,0xd,0xc,0x28,0x1d,0x1e,0x28,0xd,0xc,0xb,0xb,0xc,0xc,0x28,0x1d,0x1e,0x29,0xc,0xd,0xb,0xfe,0xe0,0xb,0xd,0xc,0x28,0x1d,0x1e,0x28,0xd,0xc,0xb,0xb,0xc,0xd,0x28,0x1c,0x1e,0x28,0xd,0xd,0xb,0x2,0x80,0xb,0xd,0xc,0x28,0x1e,0x1d,0x29,0xd,0xc,0xb,0xb,0xc,0xc,0x28,0x1d,0x1e,0x29,0xd,0xd,0xb,0xfd,0x6e,0x3,0x10,0x44,0xfc,0xf0,0x1,0x2f,0x2c,0x38,0x66,0x26,0x27,0x2d,0x11,0xf,0x9,0x16,0xd,0xb,0x15,0x8,0x11,0x13,0x2d,0x27,0x26,0x66,0x38,0x2c,0x38,0x65,0x27,0x26,0x2e,0x10,0xe,0xa,0x17,0xe,0xf,0x19,0xa,0xd,0xe,0x2e,0x26,0x27,0x65,0x3,0x45,0x2c,0x38,0x65,0x26,0x26,0x2e,0x2e,0x26,0x26,0x65,0x38,0x2c,0x38,0x66,0x27,0x26,0x2e,0x2e,0x26,0x27,0x66,0xfc,0x1f,0x2c,0x1e,0x39,0x17,0x16,0x1c,0x1c,0x16,0x17,0x39,0x1e,0x2c,0x1e,0x3a,0x16,0x17,0x1b,0x1b,0x17,0x16,0x3a,0x3,0x9b,0x2c,0x1e,0x39,0x17,0x16,0x1c,0x1c,0x16,0x17,0x39,0x1e,0x2c,0x1e,0x39,0x16,0x17,0x1b,0x1b,0x17,0x16,0x39,0xfc,0xa1,0x2c,0x1e,0x39,0x17,0x16,0x1c,0x1c,0x16,0x17,0x39,0x1e,0x2c,0x1e,0x3a,0x16,0x17,0x1b,0x1b,0x17,0x16,0x3a,0xda,0x2,0x81,0x54,0xfd,0x7f,0x0,0x1,0x2,0x1c,0xfe,0x72,0x2,0xb1,0x5,0xb0,0x0,0x3,0x0,0x0,0x41,0x11,0x23,0x11,0x2,0xb1,0x95,0xfe,0x72,0x7,0x3e,0xf8,0xc2,0x0,0x0,0x2,0x1,0xff,0xfe,0xf2,0x2,0xb8,0x5,0xb0,0x0,0x3,0x0,0x7,0x0,0x0,0x41,0x33,0x11,0x23,0x37,0x11,0x23,0x11,0x1,0xff,0xb9,0xb9,0xb9,0xb9,0xfe,0xf2,0x3,0x17,0xb1,0x2,0xf6,0xfd,0xa,0x0,0x0,0x1,0x0,0x77,0x0,0x0,0x4,0x55,0x5,0xb0,0x0,0xb,0x0,0x0,0x41,0x35,0x21,0x11,0x23,0x11,0x21,0x15,0x21,0x11,0x33,0x11,0x4,0x55,0xfe,0x6b,0xb9,0xfe,0x70,0x1,0x90,0xb9,0x3,0xa1,0x99,0x1,0x76,0xfe,0x8a,0x99,0xfc,0x5f,0x3,0xa1,0x0,0x1,0x0,0x79,0xfe,0x60,0x4,0x56,0x5,0xb0,0x0,0x13,0x0,0x0,0x61,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x23,0x11,0x21,0x15,0x21,0x11,0x21,0x15,0x21,0x11,0x33,0x11,0x4,0x56,0xfe,0x69,0x1,0x97,0xfe,0x69,0xb9,0xfe,0x73,0x1,0x8d,0xfe,0x73,0x1,0x8d,0xb9,0x97,0x3,0xa,0x99,0x1,0x76,0xfe,0x8a,0x99,0xfc,0xf6,0x97,0xfe,0x60,0x1,0xa0,0x0,0x3,0x0,0x5a,0xff,0xeb,0x4,0x83,0x4,0x4e,0x0,0x33,0x0,0x4b,0x0,0x63,0x0,0x0,0x41,0x23,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x25,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x3,0x5e,0x6e,0x10,0x10,0x10,0x36,0x25,0x26,0x39,0x13,0x13,0x12,0x12,0x13,0x13,0x39,0x26,0x25,0x36,0x11,0x10,0x10,0x6e,0x1e,0x1c,0x20,0x61,0x3f,0x3e,0x60,0x21,0x21,0x24,0x24,0x21,0x21,0x60,0x3e,0x3e,0x60,0x20,0x1d,0x1e,0xfd,0x53,0x44,0x3c,0x3c,0xa3,0x5f,0x5e,0xa3,0x3c,0x3c,0x44,0x44,0x3c,0x3c,0xa3,0x5e,0x5f,0xa3,0x3c,0x3c,0x44,0x57,0x52,0x48,0x47,0xc3,0x71,0x71,0xc2,0x48,0x47,0x52,0x52,0x47,0x48,0xc2,0x71,0x6b,0xc2,0x48,0x49,0x56,0x1,0xbb,0x23,0x33,0x11,0x12,0x11,0x1e,0x1a,0x1a,0x46,0x29,0x58,0x28,0x47,0x1a,0x19,0x1e,0x11,0x12,0x11,0x33,0x22,0x36,0x54,0x1e,0x21,0x22,0x2c,0x27,0x27,0x6b,0x3e,0x57,0x3f,0x6a,0x26,0x27,0x2c,0x21,0x20,0x1d,0x56,0x9a,0x61,0xab,0x40,0x40,0x49,0x49,0x40,0x40,0xab,0x61,0x62,0xac,0x40,0x41,0x4b,0x4a,0x41,0x40,0xad,0x62,0x75,0xcd,0x4c,0x4d,0x58,0x58,0x4d,0x4c,0xcd,0x75,0x75,0xcc,0x4c,0x4b,0x58,0x53,0x4a,0x4a,0xcf,0x0,0x4,0x0,0x57,0xff,0xeb,0x4,0x80,0x4,0x4d,0x0,0x17,0x0,0x2f,0x0,0x3d,0x0,0x49,0x0,0x0,0x53,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x25,0x33,0x17,0x33,0x3,0x36,0x36,0x35,0x34,0x26,0x23,0x23,0x11,0x33,0x11,0x35,0x33,0x32,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x57,0x52,0x48,0x47,0xc3,0x71,0x71,0xc2,0x48,0x47,0x52,0x52,0x47,0x48,0xc2,0x71,0x71,0xc3,0x47,0x48,0x52,0x57,0x44,0x3c,0x3c,0xa3,0x5f,0x5e,0xa3,0x3c,0x3c,0x44,0x44,0x3c,0x3c,0xa3,0x5e,0x5f,0xa3,0x3c,0x3c,0x44,0x1,0x4e,0x7d,0x78,0x6e,0x93,0x42,0x46,0x83,0x6d,0xd3,0x6b,0x68,0x49,0x3c,0x13,0xf,0x10,0x2c,0x18,0x2,0x1c,0x75,0xcd,0x4b,0x4c,0x58,0x58,0x4c,0x4b,0xcd,0x75,0x75,0xcd,0x4c,0x4c,0x57,0x57,0x4c,0x4c,0xcd,0x75,0x62,0xac,0x40,0x3f,0x49,0x49,0x3f,0x40,0xac,0x62,0x62,0xab,0x40,0x40,0x4a,0x4a,0x40,0x40,0xab,0x2b,0xfd,0x1,0x1f,0x16,0x4e,0x38,0x61,0x5f,0xfd,0x85,0x1,0x5e,0xbc,0x2c,0x37,0x15,0x20,0xc,0xb,0xc,0x1,0x0,0x0,0x2,0x0,0x67,0x3,0x97,0x4,0x37,0x5,0xb0,0x0,0xc,0x0,0x14,0x0,0x0,0x41,0x11,0x33,0x11,0x23,0x3,0x3,0x23,0x11,0x33,0x11,0x13,0x33,0x1,0x35,0x21,0x15,0x33,0x11,0x33,0x11,0x3,0xdd,0x5a,0x70,0x90,0x8f,0x70,0x5a,0x8b,0x34,0xfe,0x98,0xfe,0x7e,0x93,0x5b,0x5,0x21,0xfe,0x76,0x2,0x19,0xfe,0x71,0x1,0x8f,0xfd,0xe7,0x1,0x89,0xfe,0x77,0x1,0xc8,0x51,0x51,0xfe,0x38,0x1,0xc8,0x0,0x0,0x2,0x1,0x69,0x3,0xc0,0x3,0x62,0x5,0xc4,0x0,0x17,0x0,0x2f,0x0,0x0,0x41,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x1,0x69,0x29,0x23,0x22,0x5d,0x34,0x33,0x5b,0x22,0x22,0x28,0x28,0x22,0x22,0x5b,0x33,0x34,0x5d,0x22,0x23,0x29,0x7c,0x15,0x12,0x11,0x30,0x1b,0x1b,0x2e,0x12,0x11,0x13,0x13,0x11,0x12,0x2e,0x1b,0x1b,0x30,0x11,0x12,0x15,0x4,0xc0,0x36,0x5d,0x22,0x23,0x28,0x28,0x23,0x22,0x5e,0x35,0x35,0x5f,0x24,0x23,0x29,0x29,0x23,0x24,0x5f,0x35,0x1c,0x31,0x12,0x12,0x14,0x14,0x12,0x12,0x31,0x1c,0x1b,0x2f,0x11,0x12,0x13,0x13,0x12,0x11,0x2f,0x0,0x1,0x0,0xa0,0x1,0xd9,0x4,0x60,0x5,0xb0,0x0,0xe,0x0,0x0,0x41,0x1,0x17,0x13,0x13,0x37,0x1,0x25,0x27,0x5,0x13,0x23,0x13,0x25,0x7,0x2,0x19,0xfe,0xfb,0x92,0xd4,0xd6,0x92,0xff,0x0,0x1,0x7e,0x36,0xfe,0x95,0x1d,0xb2,0x19,0xfe,0x93,0x36,0x3,0x93,0xfe,0xb9,0x6a,0x1,0x62,0xfe,0x95,0x6e,0x1,0x44,0x5e,0xb2,0x96,0x1,0xab,0xfe,0x5b,0x97,0xaf,0x0,0x0,0x2,0x0,0x3d,0x0,0x0,0x4,0x99,0x5,0xb0,0x0,0x1b,0x0,0x1f,0x0,0x0,0x41,0x3,0x33,0x13,0x33,0x35,0x23,0x13,0x33,0x35,0x23,0x13,0x23,0x3,0x21,0x13,0x23,0x3,0x21,0x15,0x21,0x3,0x21,0x15,0x33,0x3,0x33,0x13,0x37,0x13,0x21,0x3,0x2,0xc3,0x50,0x8f,0x50,0xfc,0xe2,0x45,0xe8,0xcd,0x52,0x8f,0x52,0xfe,0xf8,0x52,0x8f,0x52,0xfe,0xe3,0x1,0x2,0x45,0xfe,0xf7,0xef,0x50,0x8f,0x50,0x1a,0x45,0x1,0x8,0x45,0x1,0x9a,0xfe,0x66,0x1,0x9a,0x89,0x1,0x62,0x8b,0x1,0xa0,0xfe,0x60,0x1,0xa0,0xfe,0x60,0x8b,0xfe,0x9e,0x89,0xfe,0x66,0x1,0x9a,0x89,0x1,0x62,0xfe,0x9e,0x0,0x0,0x3,0x0,0x6b,0xff,0xec,0x4,0xa9,0x5,0xc5,0x0,0x36,0x0,0x4a,0x0,0x63,0x0,0x0,0x53,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x17,0x33,0x27,0x36,0x36,0x35,0x23,0x6,0x6,0x7,0x1,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x7,0x6,0x6,0x7,0x6,0x6,0x1,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x37,0x1,0x6,0x6,0x7,0x6,0x6,0x3,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x7,0x26,0x26,0x27,0x26,0x26,0x6b,0x3d,0x38,0x38,0xa0,0x63,0x3d,0x73,0x35,0x20,0x3d,0x1c,0x53,0xdd,0xb5,0x46,0x49,0xa7,0x1,0x28,0x23,0xfe,0xcd,0x5e,0x2c,0x4c,0x1c,0x1b,0x1f,0x2c,0x28,0x29,0x74,0x47,0x52,0x84,0x2f,0x2f,0x33,0x11,0xf,0x13,0x3a,0x25,0x24,0x31,0x51,0x1f,0x24,0x28,0x1,0xb0,0x3d,0x5c,0x1f,0x1f,0x20,0xb,0x11,0x10,0x3e,0x32,0x1c,0x1,0x43,0x18,0x33,0x1b,0x25,0x50,0xa0,0x16,0x16,0x15,0x41,0x2b,0x21,0x34,0x13,0x12,0x13,0x9,0xb,0xb,0x28,0x1f,0x75,0x19,0x26,0xc,0xa,0xa,0x1,0x75,0x56,0x91,0x34,0x34,0x3a,0x1a,0x19,0xf,0x28,0x18,0x6e,0xed,0x58,0xdb,0x80,0x58,0x98,0x40,0x1,0x93,0x50,0x21,0x44,0x26,0x26,0x57,0x35,0x3e,0x70,0x2b,0x2a,0x32,0x2e,0x2c,0x2d,0x83,0x55,0x28,0x4c,0x25,0x2d,0x5d,0x32,0x1a,0x25,0x4c,0x2a,0x32,0x72,0xfe,0xca,0x26,0x21,0x21,0x58,0x33,0x13,0x39,0x23,0x22,0x4e,0x29,0x18,0xfe,0x51,0x14,0x21,0xc,0x11,0x12,0x3,0xe6,0x28,0x47,0x1b,0x1b,0x20,0x1b,0x15,0x16,0x39,0x1e,0x17,0x30,0x17,0x18,0x2e,0x15,0x5d,0x24,0x44,0x21,0x19,0x33,0x0,0x2,0x0,0x40,0xff,0xf8,0x4,0x8b,0x5,0xb2,0x0,0x5e,0x0,0x75,0x0,0x0,0x41,0x36,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x2,0x7,0x6,0x12,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x37,0x13,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x5,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x3,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x4,0x87,0x4,0x40,0x40,0x41,0xbe,0x7a,0x7d,0xcf,0x4c,0x50,0x5f,0x6,0x5,0x3b,0x43,0x42,0xd3,0x93,0x20,0x48,0x23,0x23,0x40,0x19,0x20,0x16,0x36,0x1e,0x1e,0x3e,0x1e,0x70,0xa5,0x35,0x35,0x30,0x5,0x4,0x4a,0x43,0x3f,0x9f,0x61,0x60,0x96,0x34,0x33,0x32,0x4,0x1,0x14,0x13,0x13,0x39,0x25,0x10,0x1c,0x9,0xa,0xa,0x3,0x2c,0x1a,0x58,0x43,0x47,0x76,0x2c,0x2d,0x38,0x9,0x6,0x11,0x17,0x16,0x48,0x31,0x22,0x3e,0x1b,0x16,0x27,0x10,0x7,0x16,0xf,0x15,0x3a,0x24,0x4a,0x66,0x21,0x20,0x20,0xfd,0x52,0x8,0x21,0x1b,0x1b,0x4f,0x35,0xf,0x1d,0xe,0x26,0x1,0xb,0x1a,0xe,0x17,0x37,0x1e,0x18,0x23,0xb,0xb,0x8,0x3,0x15,0x97,0xf7,0x58,0x58,0x5f,0x72,0x64,0x69,0xfe,0xe0,0xa0,0x99,0xfe,0xff,0x5d,0x5d,0x67,0x9,0xa,0x9,0x1c,0x13,0x75,0xf,0x18,0x8,0x9,0x9,0x4d,0x4a,0x49,0xd4,0x88,0x91,0xf3,0x56,0x50,0x57,0x4a,0x46,0x46,0xca,0x7f,0x49,0x82,0x30,0x31,0x39,0xa,0xf,0xe,0x33,0x29,0x1,0xf8,0x24,0x35,0x43,0x3e,0x3f,0xb3,0x6f,0x4e,0x82,0x2f,0x2f,0x34,0x14,0x12,0x10,0x2a,0x19,0x18,0x27,0xf,0x15,0x16,0x56,0x44,0x44,0xa7,0x23,0x52,0x85,0x2f,0x2e,0x33,0x6,0x7,0xfe,0x4d,0xa,0x18,0x25,0xe,0x16,0x14,0x1d,0x1c,0x1b,0x51,0x0,0x0,0x2,0x0,0x57,0xfe,0x11,0x4,0x74,0x5,0xc4,0x0,0x6a,0x0,0x8b,0x0,0x0,0x41,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x7,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x1,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x4,0x74,0x41,0x3d,0x1f,0x4a,0x2b,0x2b,0x61,0x36,0x2f,0x4f,0x21,0x24,0x3a,0x15,0x29,0x22,0x26,0x27,0x26,0x71,0x4b,0x49,0x73,0x27,0x27,0x29,0xb9,0x45,0x3f,0x40,0xb6,0x72,0x6d,0xb4,0x40,0x40,0x47,0x1e,0x1d,0x10,0x27,0x17,0x1e,0x35,0x14,0x26,0x29,0x42,0x3d,0x21,0x53,0x2f,0x3b,0x8c,0x3c,0x3f,0x5e,0x20,0x2a,0x26,0x2a,0x27,0x28,0x70,0x46,0x3c,0x78,0x30,0x30,0x3c,0xb9,0x5a,0x49,0x49,0xbb,0x62,0x6d,0xb3,0x41,0x40,0x47,0x19,0x18,0x11,0x2f,0x1d,0x1d,0x33,0x15,0x29,0x2c,0xfd,0xe2,0x34,0x57,0x24,0x1e,0x32,0x14,0x2b,0x28,0x1,0x1c,0x1a,0x14,0x37,0x21,0x25,0x50,0x2c,0x3e,0x64,0x26,0x55,0x45,0x1a,0x1a,0x13,0x35,0x21,0x25,0x51,0x1,0xaf,0x5e,0x85,0x30,0x18,0x29,0x12,0x12,0x20,0xf,0xd,0x18,0xc,0xe,0x1c,0xf,0x1c,0x48,0x34,0x2d,0x4e,0x1d,0x1c,0x21,0x2c,0x25,0x26,0x67,0x3a,0x68,0xa1,0x37,0x36,0x39,0x33,0x30,0x30,0x87,0x54,0x41,0x66,0x29,0x15,0x27,0x11,0xf,0x24,0x15,0x28,0x65,0x3d,0x5f,0x86,0x31,0x1b,0x2c,0x13,0x18,0x27,0x14,0x15,0x28,0x16,0x1d,0x46,0x30,0x2f,0x4e,0x1c,0x1c,0x20,0x1d,0x22,0x21,0x6b,0x4e,0x2,0x78,0xa5,0x32,0x33,0x2d,0x31,0x2f,0x2f,0x88,0x58,0x3a,0x5e,0x25,0x1c,0x2f,0x14,0xd,0x22,0x13,0x28,0x68,0x1,0x45,0x10,0x1d,0xf,0xc,0x1a,0xe,0x1e,0x49,0x30,0x28,0x43,0x19,0x14,0x1d,0x9,0xe,0x18,0xd,0x11,0x20,0x11,0x25,0x58,0x49,0x29,0x44,0x1a,0x13,0x1b,0x8,0xe,0x19,0x0,0x0,0x1,0x0,0xd3,0x0,0x0,0x3,0xd0,0x5,0xb0,0x0,0x10,0x0,0x0,0x61,0x33,0x11,0x21,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x33,0x3,0x16,0xba,0xfe,0xef,0x76,0xb7,0x3f,0x3f,0x41,0x41,0x3f,0x3f,0xb7,0x76,0x57,0x5,0xb0,0x47,0x3e,0x3f,0xab,0x65,0x66,0xac,0x3e,0x3e,0x46,0x0,0x0,0x1,0x0,0xe7,0x2,0xa5,0x3,0xe5,0x5,0xb0,0x0,0x8,0x0,0x0,0x53,0x33,0x13,0x37,0x17,0x13,0x33,0x1,0x23,0xe7,0xac,0xc3,0xf,0xf,0xc6,0xab,0xfe,0xc1,0x7f,0x2,0xa5,0x1,0xe6,0x44,0x44,0xfe,0x1a,0x3,0xb,0x0,0x0,0x1,0x0,0x30,0x1,0x92,0x4,0x9c,0x3,0x22,0x0,0x31,0x0,0x0,0x41,0x27,0x14,0x6,0x7,0x6,0x6,0x23,0x6,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x17,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x4,0x9c,0x86,0x1a,0x16,0x17,0x3d,0x23,0x1e,0x38,0x1b,0x17,0x30,0x1a,0x27,0x4b,0x27,0x27,0x53,0x2e,0x43,0x6e,0x27,0x28,0x2c,0x86,0x1a,0x16,0x16,0x3d,0x23,0x17,0x2b,0x15,0x1e,0x3d,0x21,0x28,0x4b,0x27,0x26,0x51,0x2f,0x43,0x6e,0x28,0x28,0x2c,0x2,0xe4,0x12,0x26,0x46,0x1a,0x1b,0x20,0x1,0xf,0xf,0xc,0x23,0x16,0x20,0x34,0x12,0x12,0x13,0x35,0x2d,0x2d,0x78,0x42,0x11,0x26,0x43,0x19,0x18,0x1d,0x8,0x9,0xc,0x29,0x1b,0x22,0x34,0x12,0x12,0x12,0x38,0x2f,0x2f,0x7a,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x7,0x20,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x85,0x1,0x57,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x7,0x4a,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x5f,0x0,0xf,0x1,0x98,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x7,0x48,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x87,0x1,0x5b,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x7,0x20,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x61,0x0,0xf,0x1,0x5b,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x7,0x23,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x99,0x1,0x5a,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x6,0xfa,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x5e,0x0,0x13,0x1,0x4a,0x0,0x2,0x0,0x51,0xfe,0x4f,0x4,0x90,0x5,0xb0,0x0,0x23,0x0,0x26,0x0,0x0,0x41,0x23,0x1,0x33,0x13,0x21,0x13,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x33,0x1,0x13,0x13,0x2,0xc2,0x9b,0xfe,0x2a,0xb9,0x75,0x1,0xe6,0x6b,0x1e,0x34,0x14,0x27,0x30,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0x1d,0x1b,0x16,0x3b,0x23,0x30,0xfd,0x21,0xc3,0xc0,0x5,0xb0,0xfa,0x50,0x1,0x79,0xfe,0xa0,0x12,0x27,0x18,0x2e,0x5e,0x2f,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x24,0x43,0x1d,0x18,0x2c,0x13,0x2,0x1a,0x2,0x78,0xfd,0x88,0x0,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x7,0x8b,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x62,0x0,0xe,0x1,0xa4,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x8,0x18,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x2,0x6b,0xff,0xfc,0x1,0xa6,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x7,0x52,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x93,0x1,0x61,0xff,0xff,0x0,0x20,0x0,0x0,0x4,0xab,0x7,0x20,0x6,0x26,0x0,0x48,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0xd7,0x1,0x57,0xff,0xff,0x0,0x6b,0xff,0xec,0x4,0x5d,0x7,0x35,0x6,0x26,0x0,0x4,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0xaa,0x1,0x6c,0xff,0xff,0x0,0x6b,0xff,0xec,0x4,0x5d,0x7,0x5e,0x6,0x26,0x0,0x4,0x0,0x0,0x0,0x7,0x1,0x64,0x0,0x35,0x1,0x71,0xff,0xff,0x0,0x6b,0xfe,0x4d,0x4,0x5d,0x5,0xc4,0x6,0x26,0x0,0x4,0x0,0x0,0x0,0x6,0x1,0x66,0x36,0x0,0xff,0xff,0x0,0x6b,0xff,0xec,0x4,0x5d,0x7,0x5d,0x6,0x26,0x0,0x4,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0xac,0x1,0x70,0xff,0xff,0x0,0x9b,0x0,0x0,0x4,0x70,0x7,0x49,0x6,0x26,0x0,0x5,0x0,0x0,0x0,0x7,0x1,0x64,0xff,0xda,0x1,0x5c,0x0,0x2,0xff,0xc5,0x0,0x0,0x4,0x7f,0x5,0xb0,0x0,0x13,0x0,0x27,0x0,0x0,0x73,0x21,0x36,0x36,0x37,0x36,0x36,0x37,0x35,0x26,0x26,0x27,0x26,0x26,0x27,0x21,0x11,0x23,0x15,0x33,0x21,0x35,0x23,0x11,0x33,0x16,0x16,0x17,0x16,0x16,0x17,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x23,0x11,0xaa,0x1,0x51,0x98,0xef,0x53,0x52,0x57,0x1,0x1,0x57,0x52,0x53,0xef,0x98,0xfe,0xaf,0xe5,0xe5,0x1,0x98,0xdc,0x95,0x76,0xac,0x38,0x38,0x38,0x1,0x1,0x37,0x38,0x39,0xac,0x76,0x95,0x1,0x63,0x59,0x58,0xf7,0x96,0x6b,0x96,0xf7,0x59,0x58,0x63,0x2,0xfd,0x81,0x97,0x97,0x1,0xe7,0x2,0x50,0x45,0x46,0xbd,0x6f,0x6d,0x6f,0xbe,0x46,0x46,0x51,0x1,0x2,0x3,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0x20,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x7b,0x1,0x57,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0x4a,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x5f,0x0,0x5,0x1,0x98,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0x49,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x64,0x0,0x6,0x1,0x5c,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0x48,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x7d,0x1,0x5b,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0x20,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x61,0x0,0x5,0x1,0x5b,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0x19,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x60,0x0,0x5,0x1,0x5b,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0x23,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x8f,0x1,0x5a,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x6,0xfa,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x5e,0x0,0x9,0x1,0x4a,0x0,0x1,0x0,0xaf,0xfe,0x4b,0x4,0x1d,0x5,0xb0,0x0,0x1d,0x0,0x0,0x41,0x23,0x11,0x1,0x27,0x23,0x11,0x33,0x11,0x1,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x7,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x4,0x1c,0xb9,0xfe,0x8,0x3,0xb9,0xb9,0x1,0xfb,0x19,0x18,0x10,0x29,0x1a,0x12,0x3a,0x14,0xe,0x1d,0x33,0x1e,0x4c,0x76,0x29,0x28,0x2b,0x5,0xb0,0xfb,0xd5,0x4,0x25,0x6,0xfa,0x50,0x4,0x2d,0xfb,0xd5,0x5b,0x35,0x53,0x1a,0x10,0x12,0x7,0x6,0x93,0xa,0x8,0x2f,0x2d,0x2d,0x81,0x52,0x0,0x1,0x0,0xb6,0xfe,0x4f,0x4,0x34,0x5,0xb0,0x0,0x28,0x0,0x0,0x41,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x21,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x33,0x35,0x21,0x11,0x3,0xcf,0xfd,0xa0,0x2,0xbc,0xfc,0x8b,0x2,0x75,0x1b,0x2f,0x11,0x1e,0x1f,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0x1e,0x1b,0x16,0x3a,0x23,0x54,0xfd,0x3b,0x2,0xa1,0x9d,0x1,0xd4,0x9e,0xfa,0x50,0x14,0x2c,0x17,0x25,0x50,0x27,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x24,0x44,0x1d,0x18,0x2b,0x13,0x9d,0x2,0x4,0x0,0x2,0xff,0xc5,0x0,0x0,0x4,0x7f,0x5,0xb0,0x0,0x13,0x0,0x27,0x0,0x0,0x73,0x21,0x36,0x36,0x37,0x36,0x36,0x37,0x35,0x26,0x26,0x27,0x26,0x26,0x27,0x21,0x11,0x23,0x15,0x33,0x21,0x35,0x23,0x11,0x33,0x16,0x16,0x17,0x16,0x16,0x17,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x23,0x11,0xaa,0x1,0x51,0x98,0xef,0x53,0x52,0x57,0x1,0x1,0x57,0x52,0x53,0xef,0x98,0xfe,0xaf,0xe5,0xe5,0x1,0x98,0xdc,0x95,0x76,0xac,0x38,0x38,0x38,0x1,0x1,0x37,0x38,0x39,0xac,0x76,0x95,0x1,0x63,0x59,0x58,0xf7,0x96,0x6b,0x96,0xf7,0x59,0x58,0x63,0x2,0xfd,0x81,0x97,0x97,0x1,0xe7,0x2,0x50,0x45,0x46,0xbd,0x6f,0x6d,0x6f,0xbe,0x46,0x46,0x51,0x1,0x2,0x3,0xff,0xff,0x0,0x64,0xff,0xeb,0x4,0x5c,0x7,0x5f,0x6,0x26,0x0,0x8,0x0,0x0,0x0,0x7,0x1,0x5f,0x0,0x19,0x1,0xad,0xff,0xff,0x0,0x64,0xff,0xeb,0x4,0x5c,0x7,0x5d,0x6,0x26,0x0,0x8,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x91,0x1,0x70,0xff,0xff,0x0,0x64,0xfe,0x25,0x4,0x5c,0x5,0xc4,0x6,0x26,0x0,0x8,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0xb1,0xfe,0xcf,0x0,0x2,0x0,0x18,0x0,0x0,0x4,0xbc,0x5,0xb0,0x0,0x13,0x0,0x17,0x0,0x0,0x41,0x11,0x23,0x11,0x21,0x11,0x23,0x11,0x23,0x15,0x33,0x11,0x33,0x11,0x21,0x11,0x33,0x11,0x33,0x35,0x1,0x35,0x21,0x15,0x4,0x3c,0xaf,0xfd,0xab,0xae,0x72,0x72,0xae,0x2,0x55,0xaf,0x80,0xfc,0x7c,0x2,0x55,0x4,0x8f,0x1,0x21,0xfe,0xdf,0x1,0x21,0xfe,0xdf,0x8f,0xfc,0x0,0x2,0xa1,0xfd,0x5f,0x4,0x0,0x8f,0xfe,0xaf,0xc2,0xc2,0x0,0xff,0xff,0x0,0x8d,0x0,0x0,0x4,0x3f,0x7,0x48,0x6,0x26,0x0,0x9,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x71,0x1,0x5b,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x7,0x20,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x47,0x1,0x57,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x7,0x4a,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x5f,0xff,0xd2,0x1,0x98,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x7,0x48,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x49,0x1,0x5b,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x7,0x20,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x61,0xff,0xd2,0x1,0x5b,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x7,0x19,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x60,0xff,0xd2,0x1,0x5b,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x7,0x23,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x5b,0x1,0x5a,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x6,0xfa,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x5e,0xff,0xd6,0x1,0x4a,0x0,0x1,0x0,0xae,0xfe,0x4f,0x4,0x1e,0x5,0xb0,0x0,0x28,0x0,0x0,0x53,0x15,0x21,0x11,0x21,0x15,0x21,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x21,0x35,0x21,0x11,0x21,0x35,0xae,0x1,0x55,0xfe,0xab,0x1,0x97,0x19,0x2a,0x11,0x21,0x23,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0x1f,0x1d,0x15,0x39,0x22,0x1,0x24,0xfe,0xa3,0x1,0x5d,0x5,0xb0,0xa1,0xfb,0x91,0xa0,0x12,0x27,0x15,0x27,0x55,0x29,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x25,0x45,0x1e,0x17,0x2a,0x12,0xa0,0x4,0x6f,0xa1,0x0,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x7,0x52,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x55,0x1,0x61,0xff,0xff,0x0,0x62,0xff,0xec,0x4,0xdf,0x7,0x3b,0x6,0x26,0x0,0xb,0x0,0x0,0x0,0x7,0x1,0x5c,0x1,0xc1,0x1,0x4e,0xff,0xff,0x0,0xac,0xfe,0x3e,0x4,0xa4,0x5,0xb0,0x6,0x26,0x0,0xc,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0xb6,0xfe,0xe8,0xff,0xff,0x0,0xc6,0x0,0x0,0x4,0x47,0x7,0x0,0x6,0x26,0x0,0xd,0x0,0x0,0x0,0x7,0x1,0x5b,0xff,0x36,0x1,0x37,0xff,0xff,0x0,0xc6,0x0,0x0,0x4,0x47,0x5,0xb0,0x6,0x26,0x0,0xd,0x0,0x0,0x0,0x7,0x0,0x6d,0x0,0xf2,0xff,0x9a,0xff,0xff,0x0,0xc6,0xfe,0x38,0x4,0x47,0x5,0xb0,0x6,0x26,0x0,0xd,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0xb7,0xfe,0xe2,0xff,0xff,0x0,0xc6,0x0,0x0,0x4,0x47,0x5,0xb0,0x6,0x26,0x0,0xd,0x0,0x0,0x0,0x7,0x1,0x60,0x0,0x74,0xfd,0xc5,0x0,0x1,0x0,0x3a,0x0,0x0,0x4,0x4b,0x5,0xb0,0x0,0xd,0x0,0x0,0x41,0x11,0x23,0x11,0x7,0x15,0x37,0x11,0x21,0x35,0x21,0x11,0x25,0x35,0x1,0x83,0xb9,0x90,0x90,0x3,0x81,0xfd,0x38,0x1,0x6,0x3,0x4d,0x2,0x63,0xfd,0x62,0x2d,0xa2,0x2d,0xfd,0x90,0x9d,0x2,0xe,0x53,0xa2,0x0,0xff,0xff,0x0,0x8f,0x0,0x0,0x4,0x3e,0x7,0x20,0x6,0x26,0x0,0xf,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x5e,0x1,0x57,0xff,0xff,0x0,0x8f,0x0,0x0,0x4,0x3e,0x7,0x49,0x6,0x26,0x0,0xf,0x0,0x0,0x0,0x7,0x1,0x64,0xff,0xea,0x1,0x5c,0xff,0xff,0x0,0x8f,0xfe,0x38,0x4,0x3e,0x5,0xb0,0x6,0x26,0x0,0xf,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0x84,0xfe,0xe2,0xff,0xff,0x0,0x8f,0x0,0x0,0x4,0x3e,0x7,0x52,0x6,0x26,0x0,0xf,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x6c,0x1,0x61,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x7,0x35,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x89,0x1,0x6c,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x7,0x5f,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x1,0x5f,0x0,0x13,0x1,0xad,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x7,0x5d,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x8b,0x1,0x70,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x7,0x35,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x1,0x61,0x0,0x13,0x1,0x70,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x7,0x38,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x9d,0x1,0x6f,0x0,0x2,0x0,0x63,0xff,0xec,0x4,0xc6,0x5,0xfa,0x0,0x29,0x0,0x43,0x0,0x0,0x41,0x35,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x27,0x23,0x6,0x6,0x7,0x6,0x6,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x2,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x3,0x15,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x4,0x5a,0x2,0x28,0x2c,0x28,0x42,0x18,0x1f,0x21,0x1,0xa7,0x1,0xe,0xe,0xd,0x26,0x19,0x1d,0x43,0x27,0x2c,0x68,0x3c,0x71,0xaa,0x3e,0x50,0x52,0x3e,0x3b,0x3c,0xc1,0x87,0x85,0xbb,0x40,0x3e,0x3a,0xb5,0x2,0x21,0x27,0x25,0x7c,0x58,0x58,0x78,0x23,0x2d,0x27,0x2c,0x39,0x24,0x6f,0x4d,0x4f,0x76,0x26,0x30,0x2a,0x2,0x84,0xa6,0x64,0xca,0x58,0xf,0x31,0x20,0x2c,0x76,0x48,0x2c,0x49,0x1b,0x18,0x21,0x8,0x21,0x37,0x14,0x17,0x18,0x55,0x49,0x5e,0xfe,0xed,0x8b,0xa6,0x75,0xeb,0x5f,0x61,0x78,0x73,0x5f,0x5b,0xf5,0x1,0x1e,0xa8,0x54,0xbf,0x48,0x45,0x55,0x52,0x3e,0x4e,0xc2,0x55,0xa8,0x5b,0xd4,0x4f,0x35,0x40,0x49,0x3a,0x49,0xc5,0x0,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x6f,0x7,0x5f,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x1,0x63,0x0,0x99,0x1,0x70,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x7,0xf,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x1,0x5e,0x0,0x17,0x1,0x5f,0x0,0x3,0x0,0x47,0xff,0xa3,0x4,0x8c,0x5,0xec,0x0,0x25,0x0,0x39,0x0,0x47,0x0,0x0,0x41,0x37,0x36,0x26,0x27,0x13,0x23,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x3,0x33,0x37,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x25,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x1,0x26,0x26,0x27,0x26,0x26,0x25,0x15,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x1,0x16,0x16,0x4,0x58,0x1,0x1,0x37,0x38,0xa1,0x8e,0x63,0x18,0x37,0x1f,0x2c,0x68,0x3c,0x82,0xbc,0x3b,0x43,0x3d,0x2,0x10,0x11,0x10,0x32,0x22,0xa0,0x8e,0x68,0x39,0x8e,0x5b,0x7c,0xb8,0x3d,0x46,0x42,0xfc,0xc0,0x23,0x29,0x25,0x79,0x5b,0x2a,0x46,0x1d,0x1a,0x2a,0x11,0xfe,0xe,0xb,0x11,0x6,0xa,0x9,0x2,0x8a,0x2,0x25,0x3c,0x26,0x6d,0x4d,0x42,0x64,0x25,0x1,0xeb,0x13,0xf,0x2,0x84,0xa6,0x6f,0xe4,0x5f,0x1,0x10,0xa8,0x18,0x29,0x10,0x16,0x19,0x71,0x58,0x5e,0xf9,0x7a,0xa6,0x3d,0x7d,0x3c,0x3c,0x70,0x31,0xfe,0xf2,0xb0,0x30,0x37,0x6a,0x55,0x60,0xfd,0x7c,0xa8,0x50,0xbb,0x4d,0x40,0x5b,0x13,0x12,0xf,0x29,0x19,0xfc,0xb5,0x1a,0x39,0x1c,0x2e,0x5e,0xd3,0xa8,0x5f,0xcf,0x53,0x34,0x40,0x2f,0x29,0x3,0x3e,0x3e,0x81,0x0,0xff,0xff,0x0,0x47,0xff,0xa3,0x4,0x8c,0x7,0x5e,0x6,0x26,0x0,0xdb,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x7b,0x1,0x95,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x7,0x67,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x97,0x1,0x76,0xff,0xff,0x0,0xb5,0x0,0x0,0x4,0x72,0x7,0x14,0x6,0x26,0x0,0x13,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x78,0x1,0x4b,0xff,0xff,0x0,0xb5,0x0,0x0,0x4,0x72,0x7,0x3d,0x6,0x26,0x0,0x13,0x0,0x0,0x0,0x7,0x1,0x64,0x0,0x3,0x1,0x50,0xff,0xff,0x0,0xb5,0xfe,0x38,0x4,0x72,0x5,0xb0,0x6,0x26,0x0,0x13,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0x9c,0xfe,0xe2,0xff,0xff,0x0,0x76,0xff,0xec,0x4,0x69,0x7,0x35,0x6,0x26,0x0,0x14,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x82,0x1,0x6c,0xff,0xff,0x0,0x76,0xff,0xec,0x4,0x69,0x7,0x5e,0x6,0x26,0x0,0x14,0x0,0x0,0x0,0x7,0x1,0x64,0x0,0xd,0x1,0x71,0xff,0xff,0x0,0x76,0xfe,0x44,0x4,0x69,0x5,0xc4,0x6,0x26,0x0,0x14,0x0,0x0,0x0,0x6,0x1,0x66,0x51,0xf7,0xff,0xff,0x0,0x76,0xff,0xec,0x4,0x69,0x7,0x5d,0x6,0x26,0x0,0x14,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x84,0x1,0x70,0x0,0x1,0x0,0x4c,0x0,0x0,0x4,0x84,0x5,0xb0,0x0,0xf,0x0,0x0,0x41,0x35,0x23,0x11,0x21,0x35,0x21,0x15,0x21,0x11,0x23,0x15,0x33,0x11,0x33,0x11,0x3,0xad,0xeb,0x1,0xc2,0xfb,0xc8,0x1,0xc2,0xde,0xde,0xb4,0x3,0x37,0x97,0x1,0x44,0x9e,0x9e,0xfe,0xbc,0x97,0xfc,0xc9,0x3,0x37,0xff,0xff,0x0,0x4c,0x0,0x0,0x4,0x84,0x7,0x3d,0x6,0x26,0x0,0x15,0x0,0x0,0x0,0x7,0x1,0x64,0x0,0xd,0x1,0x50,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x42,0x7,0x14,0x6,0x26,0x0,0x16,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0xa3,0x1,0x4b,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x42,0x7,0x3e,0x6,0x26,0x0,0x16,0x0,0x0,0x0,0x7,0x1,0x5f,0x0,0x2d,0x1,0x8c,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x42,0x7,0x3c,0x6,0x26,0x0,0x16,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0xa5,0x1,0x4f,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x42,0x7,0x14,0x6,0x26,0x0,0x16,0x0,0x0,0x0,0x7,0x1,0x61,0x0,0x2d,0x1,0x4f,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x42,0x7,0x17,0x6,0x26,0x0,0x16,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0xb7,0x1,0x4e,0x0,0x1,0x0,0x8b,0xff,0xec,0x5,0x83,0x5,0xe8,0x0,0x2b,0x0,0x0,0x41,0x23,0x3,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x3,0x23,0x3,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x3,0x36,0x36,0x37,0x36,0x36,0x35,0x23,0x14,0x6,0x7,0x6,0x6,0x7,0x4,0x40,0xb3,0x3,0x2,0x26,0x24,0x25,0x6c,0x47,0x47,0x6d,0x24,0x25,0x27,0x1,0x4,0xb0,0x2,0x1,0x46,0x3e,0x3e,0xae,0x6a,0x68,0xae,0x3f,0x3f,0x48,0x1,0x50,0x78,0x27,0x2a,0x29,0xa7,0xf,0x12,0x12,0x3c,0x2d,0x5,0xb0,0xfc,0x26,0x41,0x78,0x2e,0x2f,0x37,0x38,0x2e,0x2e,0x78,0x41,0x3,0xda,0xfc,0x26,0x66,0xb3,0x42,0x43,0x4c,0x4d,0x43,0x42,0xb2,0x66,0x2,0x9a,0x5,0x31,0x2b,0x2f,0x8b,0x5d,0x38,0x55,0x1d,0x1e,0x22,0x6,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x89,0x7,0x3e,0x6,0x26,0x0,0x16,0x0,0x0,0x0,0x7,0x1,0x63,0x0,0xb3,0x1,0x4f,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x42,0x6,0xee,0x6,0x26,0x0,0x16,0x0,0x0,0x0,0x7,0x1,0x5e,0x0,0x31,0x1,0x3e,0x0,0x1,0x0,0x8b,0xfe,0x7e,0x4,0x42,0x5,0xb0,0x0,0x3c,0x0,0x0,0x41,0x23,0x3,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x3,0x23,0x3,0x16,0x16,0x17,0x16,0x16,0x17,0x32,0x32,0x33,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x4,0x40,0xb3,0x3,0x2,0x26,0x24,0x25,0x6c,0x47,0x47,0x6d,0x24,0x25,0x27,0x1,0x4,0xb0,0x2,0x1,0x44,0x3d,0x3b,0xa6,0x67,0x1,0x3,0x1,0xe,0x18,0x9,0xf,0x10,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0xe,0xd,0x12,0x36,0x23,0x3d,0x64,0x23,0x23,0x28,0x5,0xb0,0xfc,0x26,0x41,0x78,0x2e,0x2f,0x37,0x38,0x2e,0x2e,0x78,0x41,0x3,0xda,0xfc,0x26,0x65,0xb0,0x42,0x41,0x4e,0x3,0x10,0x20,0x11,0x1b,0x39,0x1c,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x19,0x30,0x16,0x1c,0x33,0x17,0x1d,0x5a,0x3a,0x3a,0x88,0x4a,0x0,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x42,0x7,0x7f,0x6,0x26,0x0,0x16,0x0,0x0,0x0,0x7,0x1,0x62,0x0,0x2c,0x1,0x98,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x42,0x7,0x46,0x6,0x26,0x0,0x16,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0xb1,0x1,0x55,0xff,0xff,0x0,0x49,0x0,0x0,0x4,0x9e,0x7,0x20,0x6,0x26,0x0,0x18,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x7d,0x1,0x57,0xff,0xff,0x0,0x49,0x0,0x0,0x4,0x9e,0x7,0x48,0x6,0x26,0x0,0x18,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x7f,0x1,0x5b,0xff,0xff,0x0,0x49,0x0,0x0,0x4,0x9e,0x7,0x20,0x6,0x26,0x0,0x18,0x0,0x0,0x0,0x7,0x1,0x61,0x0,0x7,0x1,0x5b,0xff,0xff,0x0,0x49,0x0,0x0,0x4,0x9e,0x7,0x23,0x6,0x26,0x0,0x18,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x91,0x1,0x5a,0xff,0xff,0x0,0x3d,0x0,0x0,0x4,0x79,0x7,0x1f,0x6,0x26,0x0,0x1a,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x71,0x1,0x56,0xff,0xff,0x0,0x3d,0x0,0x0,0x4,0x79,0x7,0x47,0x6,0x26,0x0,0x1a,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x73,0x1,0x5a,0xff,0xff,0x0,0x3d,0x0,0x0,0x4,0x79,0x7,0x1f,0x6,0x26,0x0,0x1a,0x0,0x0,0x0,0x7,0x1,0x61,0xff,0xfc,0x1,0x5a,0xff,0xff,0x0,0x3d,0x0,0x0,0x4,0x79,0x7,0x22,0x6,0x26,0x0,0x1a,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x85,0x1,0x59,0xff,0xff,0x0,0x72,0x0,0x0,0x4,0x37,0x7,0x14,0x6,0x26,0x0,0x1b,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x9d,0x1,0x4b,0xff,0xff,0x0,0x72,0x0,0x0,0x4,0x37,0x7,0x3d,0x6,0x26,0x0,0x1b,0x0,0x0,0x0,0x7,0x1,0x64,0x0,0x28,0x1,0x50,0xff,0xff,0x0,0x72,0x0,0x0,0x4,0x37,0x7,0xd,0x6,0x26,0x0,0x1b,0x0,0x0,0x0,0x7,0x1,0x60,0x0,0x27,0x1,0x4f,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x5,0xde,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x81,0x0,0x15,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x6,0x8,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x1,0x5f,0xb,0x56,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x6,0x6,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x83,0x0,0x19,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x5,0xde,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x1,0x61,0xb,0x19,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x5,0xe1,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x1,0x5a,0x95,0x18,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x5,0xb8,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x1,0x5e,0xf,0x8,0x0,0x2,0x0,0x9c,0xfe,0x4f,0x4,0x36,0x4,0x4e,0x0,0x51,0x0,0x65,0x0,0x0,0x65,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x33,0x35,0x26,0x26,0x35,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x25,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x15,0x6,0x6,0x7,0x6,0x6,0x3,0x6f,0x21,0x37,0x15,0x1e,0x21,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0x14,0x13,0x16,0x44,0x2b,0x26,0x12,0x14,0x42,0x39,0x3a,0x9e,0x5c,0x65,0x9f,0x37,0x38,0x3b,0x1,0xba,0x21,0x1e,0x1e,0x57,0x37,0x3b,0x5f,0x21,0x21,0x24,0xca,0x71,0xb7,0x41,0x41,0x47,0x35,0x31,0x30,0x8b,0x56,0x35,0x5e,0x2a,0x29,0x45,0x1c,0x3,0xa,0xfe,0xc7,0x36,0x52,0x1b,0x1b,0x1b,0x1e,0x1d,0x2a,0x90,0x61,0xac,0x10,0x38,0x26,0x27,0x5e,0xe,0x16,0x31,0x1b,0x25,0x52,0x28,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x1e,0x38,0x19,0x1f,0x36,0x17,0x10,0x2d,0x79,0x36,0x1,0xf7,0x5b,0x88,0x2e,0x2d,0x2d,0x38,0x2d,0x2e,0x72,0x3b,0x22,0x3f,0x17,0x17,0x1c,0x1e,0x1b,0x1c,0x4e,0x31,0x55,0x2c,0x2c,0x2d,0x86,0x59,0x44,0x75,0x2a,0x2b,0x32,0x16,0x13,0x13,0x32,0x1c,0x1d,0x36,0x6a,0x1c,0x19,0x18,0x44,0x28,0x2a,0x41,0x17,0x23,0x22,0xdb,0x20,0x3b,0x17,0x17,0x1c,0x0,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x6,0x49,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x1,0x62,0xa,0x62,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x6,0xd6,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x2,0x6b,0xf8,0x64,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x6,0x10,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x8f,0x0,0x1f,0xff,0xff,0x0,0x2b,0xff,0xec,0x4,0xa9,0x5,0xdf,0x6,0x26,0x0,0x49,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x98,0x0,0x16,0xff,0xff,0x0,0x8f,0xff,0xec,0x4,0x33,0x5,0xde,0x6,0x26,0x0,0x1e,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x93,0x0,0x15,0xff,0xff,0x0,0x8f,0xff,0xec,0x4,0x33,0x6,0x7,0x6,0x26,0x0,0x1e,0x0,0x0,0x0,0x6,0x1,0x64,0x1e,0x1a,0xff,0xff,0x0,0x8f,0xfe,0x4d,0x4,0x33,0x4,0x4e,0x6,0x26,0x0,0x1e,0x0,0x0,0x0,0x6,0x1,0x66,0x4b,0x0,0xff,0xff,0x0,0x8f,0xff,0xec,0x4,0x33,0x6,0x6,0x6,0x26,0x0,0x1e,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x95,0x0,0x19,0xff,0xff,0x0,0x64,0xff,0xec,0x5,0xbf,0x6,0x16,0x4,0x26,0x0,0x1f,0xd9,0x0,0x0,0x7,0x0,0x6d,0x2,0xdf,0x0,0x0,0x0,0x2,0x0,0x7c,0xff,0xec,0x4,0xd2,0x6,0x0,0x0,0x25,0x0,0x3f,0x0,0x0,0x41,0x35,0x23,0x35,0x23,0x15,0x23,0x15,0x33,0x11,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x17,0x33,0x11,0x1,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x4,0xd2,0xc5,0xb9,0xff,0xff,0x14,0x2d,0x1a,0x2a,0x66,0x3c,0x63,0xa0,0x38,0x39,0x3d,0x3e,0x38,0x38,0x9f,0x62,0x37,0x5f,0x28,0x21,0x39,0x18,0x8,0xaa,0xfd,0x28,0x22,0x24,0x23,0x6f,0x4e,0x29,0x47,0x1d,0x22,0x36,0x14,0x12,0x30,0x1f,0x1f,0x4c,0x2f,0x4d,0x6e,0x23,0x24,0x22,0x4,0xd2,0x97,0x97,0x97,0x97,0xfe,0xfd,0x17,0x27,0xf,0x19,0x19,0x52,0x49,0x49,0xcb,0x79,0x15,0x74,0xc9,0x4a,0x4a,0x54,0x15,0x14,0x11,0x2e,0x1e,0x72,0x4,0xd2,0xfd,0x3f,0x15,0x4f,0x8f,0x37,0x36,0x40,0x13,0x10,0x14,0x3c,0x24,0xfe,0xa,0x23,0x39,0x14,0x15,0x16,0x3f,0x36,0x36,0x8e,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x5,0xdf,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x1,0x5b,0x7c,0x16,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x6,0x9,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x1,0x5f,0x6,0x57,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x6,0x8,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x1,0x64,0x7,0x1b,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x6,0x7,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x1,0x5c,0x7e,0x1a,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x5,0xdf,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x1,0x61,0x6,0x1a,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x5,0xd8,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x1,0x60,0x6,0x1a,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x5,0xe2,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x1,0x5a,0x90,0x19,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x5,0xb9,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x1,0x5e,0xa,0x9,0x0,0x1,0x0,0xb8,0xfe,0x4b,0x4,0x17,0x4,0x4e,0x0,0x32,0x0,0x0,0x73,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x7,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x27,0x27,0x23,0xb8,0xb9,0x10,0x29,0x19,0x21,0x58,0x36,0x3e,0x5b,0x1d,0x1b,0x1b,0x19,0x19,0x10,0x2d,0x1b,0x13,0x3c,0x15,0xe,0x1e,0x36,0x1e,0x49,0x74,0x28,0x2e,0x30,0x32,0x2f,0x2f,0x88,0x56,0x44,0x72,0x2e,0x1a,0x2d,0x14,0x1,0xb,0xa6,0x3,0x2a,0x1a,0x2d,0x11,0x17,0x18,0x20,0x23,0x20,0x64,0x44,0xfd,0x1,0x35,0x4e,0x17,0x10,0x10,0x7,0x6,0x9d,0xa,0x8,0x2a,0x27,0x2c,0x87,0x58,0x3,0x3,0x6c,0x9f,0x34,0x33,0x32,0x27,0x23,0x14,0x33,0x1d,0xa,0x90,0x0,0x2,0x0,0x87,0xfe,0x61,0x4,0x45,0x4,0x4e,0x0,0x3e,0x0,0x4c,0x0,0x0,0x53,0x14,0x16,0x17,0x16,0x16,0x17,0x32,0x32,0x33,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x21,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x1,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x21,0x36,0x36,0x37,0x36,0x36,0x87,0x49,0x43,0x41,0xb6,0x6e,0x1,0x3,0x1,0x33,0x37,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0x20,0x1c,0x16,0x39,0x21,0x45,0x70,0x22,0x71,0x33,0x9a,0x63,0x4b,0x7d,0x2b,0x31,0x32,0x3,0x5,0x39,0x3a,0x3a,0xaf,0x75,0x5d,0xb1,0x45,0x46,0x54,0x1,0xed,0x47,0x66,0x23,0x1f,0x29,0xfd,0xba,0xb,0x37,0x28,0x28,0x64,0x1,0xf7,0x6f,0xbd,0x45,0x45,0x50,0x4,0x30,0x69,0x35,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x26,0x45,0x1e,0x17,0x29,0x12,0x19,0x5f,0x33,0x58,0x42,0x50,0x39,0x2f,0x35,0x8b,0x3c,0x1,0x53,0x71,0xc2,0x48,0x47,0x51,0x4c,0x47,0x48,0xcf,0x83,0x1,0x95,0x34,0x2a,0x26,0x74,0x37,0x7,0x4b,0x73,0x28,0x27,0x29,0x0,0xff,0xff,0x0,0x8c,0xfe,0x56,0x4,0x1d,0x6,0x8,0x6,0x26,0x0,0x22,0x0,0x0,0x0,0x6,0x1,0x5f,0xf6,0x56,0xff,0xff,0x0,0x8c,0xfe,0x56,0x4,0x1d,0x6,0x6,0x6,0x26,0x0,0x22,0x0,0x0,0x0,0x6,0x1,0x5c,0x6d,0x19,0xff,0xff,0x0,0x8c,0xfe,0x56,0x4,0x1d,0x6,0x93,0x6,0x26,0x0,0x22,0x0,0x0,0x0,0x6,0x2,0x4e,0x7,0x58,0x0,0x1,0x0,0xb,0x0,0x0,0x4,0x3b,0x6,0x0,0x0,0x27,0x0,0x0,0x41,0x35,0x21,0x35,0x23,0x15,0x23,0x15,0x33,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x36,0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,0x6,0x6,0x7,0x11,0x2,0x88,0xfe,0xee,0xb9,0xb2,0xb2,0xb9,0x14,0x32,0x1e,0x26,0x5b,0x32,0x3b,0x5d,0x1f,0x1e,0x20,0xb9,0x35,0x31,0x31,0x8b,0x55,0x38,0x65,0x2c,0x27,0x43,0x1b,0x4,0xd2,0x97,0x97,0x97,0x97,0xfb,0x2e,0x3,0x12,0x20,0x35,0x14,0x1a,0x1c,0x1,0x21,0x21,0x20,0x63,0x42,0xfd,0x55,0x2,0xa9,0x6d,0x9f,0x34,0x34,0x31,0x1,0x1b,0x1a,0x17,0x40,0x28,0x1,0x39,0x0,0xff,0xff,0xff,0xe7,0x0,0x0,0x4,0x2c,0x7,0x6f,0x6,0x26,0x0,0x23,0x0,0x0,0x0,0x7,0x1,0x5c,0xff,0x26,0x1,0x82,0xff,0xff,0x0,0xcb,0x0,0x0,0x4,0x55,0x5,0xc9,0x6,0x26,0x1,0x6d,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0xaa,0x0,0x0,0xff,0xff,0x0,0xcb,0x0,0x0,0x4,0x55,0x5,0xf3,0x6,0x26,0x1,0x6d,0x0,0x0,0x0,0x6,0x1,0x5f,0x34,0x41,0xff,0xff,0x0,0xcb,0x0,0x0,0x4,0x55,0x5,0xf1,0x6,0x26,0x1,0x6d,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0xac,0x0,0x4,0xff,0xff,0x0,0xcb,0x0,0x0,0x4,0x55,0x5,0xc9,0x6,0x26,0x1,0x6d,0x0,0x0,0x0,0x6,0x1,0x61,0x34,0x4,0xff,0xff,0x0,0xcb,0x0,0x0,0x4,0x55,0x5,0xcc,0x6,0x26,0x1,0x6d,0x0,0x0,0x0,0x6,0x1,0x5a,0xbe,0x3,0xff,0xff,0x0,0xcb,0x0,0x0,0x4,0x55,0x5,0xa4,0x6,0x26,0x1,0x6d,0x0,0x0,0x0,0x6,0x1,0x5e,0x38,0xf4,0x0,0x2,0x0,0xcb,0xfe,0x4f,0x4,0x55,0x5,0xc3,0x0,0x26,0x0,0x32,0x0,0x0,0x53,0x15,0x21,0x11,0x21,0x15,0x21,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x21,0x35,0x21,0x11,0x3,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0xcb,0x1,0x70,0xfe,0x90,0x1,0x74,0x17,0x29,0x10,0x23,0x25,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0x1c,0x19,0x16,0x3c,0x25,0x1,0x61,0xfe,0x9f,0xd1,0x37,0x38,0x37,0x38,0x38,0x37,0x38,0x37,0x4,0x3a,0xa1,0xfd,0x7,0xa0,0x11,0x25,0x14,0x28,0x56,0x2b,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x23,0x41,0x1c,0x1a,0x2d,0x14,0xa0,0x3,0x9a,0x1,0x1c,0x2d,0x3c,0x3c,0x2d,0x2e,0x3f,0x3f,0xff,0xff,0x0,0xcb,0x0,0x0,0x4,0x55,0x5,0xfb,0x6,0x26,0x1,0x6d,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0xb8,0x0,0xa,0xff,0xff,0x0,0xb0,0xfe,0x4b,0x3,0xf5,0x5,0xe8,0x6,0x26,0x1,0x71,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0xd7,0xff,0xfb,0xff,0xff,0x0,0xb0,0xfe,0x40,0x4,0x6a,0x6,0x0,0x6,0x26,0x0,0x26,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0x62,0xfe,0xea,0xff,0xff,0x0,0xcb,0x0,0x0,0x4,0x55,0x7,0x66,0x6,0x26,0x0,0x27,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0xa2,0x1,0x9d,0xff,0xff,0x0,0x99,0x0,0x0,0x4,0xaf,0x6,0x4,0x4,0x26,0x0,0x27,0xce,0x0,0x0,0x7,0x0,0x6d,0x1,0xcf,0xff,0xee,0xff,0xff,0x0,0xcb,0xfe,0x39,0x4,0x55,0x6,0x0,0x6,0x26,0x0,0x27,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0xd2,0xfe,0xe3,0xff,0xff,0x0,0x85,0x0,0x1,0x4,0x12,0x6,0x1,0x4,0x26,0x0,0x27,0xba,0x1,0x0,0x7,0x1,0x60,0x1,0x3a,0xfd,0xe7,0x0,0x1,0x0,0xcb,0x0,0x0,0x4,0x55,0x6,0x0,0x0,0x11,0x0,0x0,0x41,0x11,0x21,0x15,0x21,0x11,0x5,0x15,0x25,0x11,0x21,0x15,0x21,0x35,0x21,0x11,0x25,0x37,0x2,0xf4,0xfd,0xd7,0x1,0x70,0xfe,0xad,0x1,0x53,0xfe,0x90,0x3,0x8a,0xfe,0x9f,0x1,0x21,0x1,0x3,0xcd,0x2,0x33,0xa1,0xfe,0x19,0x9a,0xa2,0x9a,0xfd,0xca,0xa0,0xa0,0x2,0x8b,0x84,0xa2,0x0,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x29,0x5,0xde,0x6,0x26,0x0,0x29,0x0,0x0,0x0,0x6,0x1,0x5b,0x6d,0x15,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x29,0x6,0x7,0x6,0x26,0x0,0x29,0x0,0x0,0x0,0x6,0x1,0x64,0xf9,0x1a,0xff,0xff,0x0,0xae,0xfe,0x38,0x4,0x29,0x4,0x4e,0x6,0x26,0x0,0x29,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0x93,0xfe,0xe2,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x29,0x6,0x10,0x6,0x26,0x0,0x29,0x0,0x0,0x0,0x6,0x1,0x5d,0x7b,0x1f,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x5,0xde,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x1,0x5b,0x76,0x15,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x6,0x8,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x1,0x5f,0x0,0x56,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x6,0x6,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x1,0x5c,0x78,0x19,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x5,0xde,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x1,0x61,0x0,0x19,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x5,0xe1,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x1,0x5a,0x8a,0x18,0x0,0x2,0x0,0x77,0xff,0xec,0x4,0xae,0x4,0xaa,0x0,0x26,0x0,0x40,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x37,0x23,0x14,0x6,0x7,0x6,0x6,0x7,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x77,0x44,0x40,0x3f,0xb7,0x73,0x72,0xb6,0x40,0x3f,0x44,0x2a,0x29,0x28,0x3e,0x17,0x19,0x1b,0x1,0xa8,0xd,0xe,0xd,0x27,0x1a,0x3d,0x9e,0x60,0x72,0xb6,0x3f,0x40,0x44,0xb9,0x26,0x27,0x26,0x72,0x4d,0x4d,0x73,0x27,0x26,0x27,0x26,0x26,0x27,0x73,0x4c,0x4d,0x74,0x26,0x27,0x26,0x2,0x27,0x16,0x75,0xc8,0x4a,0x4a,0x54,0x54,0x4a,0x4a,0xc8,0x75,0x16,0x5c,0xa4,0x44,0x11,0x34,0x24,0x29,0x6c,0x41,0x2b,0x45,0x1a,0x18,0x22,0x8,0x35,0x3b,0x55,0x4a,0x4a,0xc9,0x8b,0x16,0x4f,0x91,0x37,0x37,0x41,0x41,0x37,0x37,0x91,0x4f,0x16,0x50,0x91,0x37,0x37,0x40,0x40,0x37,0x37,0x91,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x5c,0x6,0x8,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x7,0x1,0x63,0x0,0x86,0x0,0x19,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x5,0xb8,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x1,0x5e,0x4,0x8,0x0,0x3,0x0,0x7a,0xff,0x79,0x4,0x52,0x4,0xb9,0x0,0x22,0x0,0x30,0x0,0x41,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x7,0x33,0x37,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x37,0x23,0x7,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x1,0x26,0x26,0x25,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x1,0x16,0x16,0x17,0x16,0x16,0x7a,0x6a,0x63,0x65,0x7b,0x4a,0x2b,0x5f,0x36,0x72,0xb6,0x40,0x3f,0x44,0x1d,0x1b,0x18,0x47,0x2c,0x65,0x7b,0x49,0x2d,0x65,0x39,0x72,0xb6,0x3f,0x40,0x44,0xb9,0x26,0x27,0x26,0x72,0x4d,0x26,0x41,0x1d,0xfe,0xaa,0x30,0x30,0x2,0x66,0x26,0x26,0x27,0x73,0x4c,0x22,0x3d,0x1c,0x1,0x54,0x12,0x1c,0xb,0x10,0x10,0x2,0x27,0x16,0x94,0xee,0x49,0xcd,0x97,0x11,0x13,0x54,0x4a,0x4a,0xc8,0x75,0x16,0x4c,0x8b,0x3b,0x35,0x5b,0x23,0xcd,0x94,0x14,0x15,0x55,0x4a,0x4a,0xc9,0x8b,0x16,0x4f,0x91,0x37,0x37,0x41,0x11,0xf,0xfd,0x4a,0x39,0x9d,0x71,0x16,0x50,0x91,0x37,0x37,0x40,0xd,0xd,0x2,0xb1,0x16,0x34,0x1c,0x2b,0x61,0x0,0xff,0xff,0x0,0x7a,0xff,0x79,0x4,0x52,0x5,0xdd,0x6,0x26,0x1,0x38,0x0,0x0,0x0,0x6,0x1,0x5b,0x50,0x14,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x6,0x10,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x84,0x0,0x1f,0xff,0xff,0x1,0x49,0x0,0x0,0x4,0x31,0x5,0xde,0x6,0x26,0x0,0x2d,0x0,0x0,0x0,0x6,0x1,0x5b,0x58,0x15,0xff,0xff,0x1,0x14,0x0,0x0,0x4,0x31,0x6,0x7,0x6,0x26,0x0,0x2d,0x0,0x0,0x0,0x6,0x1,0x64,0xe4,0x1a,0xff,0xff,0x1,0x10,0xfe,0x38,0x4,0x31,0x4,0x4e,0x6,0x26,0x0,0x2d,0x0,0x0,0x0,0x7,0x1,0x68,0xff,0xe2,0xfe,0xe2,0xff,0xff,0x0,0xaf,0xff,0xec,0x4,0x36,0x5,0xde,0x6,0x26,0x0,0x2e,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x84,0x0,0x15,0xff,0xff,0x0,0xaf,0xff,0xec,0x4,0x36,0x6,0x7,0x6,0x26,0x0,0x2e,0x0,0x0,0x0,0x6,0x1,0x64,0xf,0x1a,0xff,0xff,0x0,0xaf,0xfe,0x45,0x4,0x36,0x4,0x4e,0x6,0x26,0x0,0x2e,0x0,0x0,0x0,0x6,0x1,0x66,0x44,0xf8,0xff,0xff,0x0,0xaf,0xff,0xec,0x4,0x36,0x6,0x6,0x6,0x26,0x0,0x2e,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x86,0x0,0x19,0x0,0x1,0x0,0x8e,0xff,0xec,0x4,0x29,0x5,0x40,0x0,0x2b,0x0,0x0,0x41,0x23,0x11,0x21,0x15,0x21,0x15,0x23,0x15,0x33,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x33,0x35,0x23,0x35,0x21,0x35,0x21,0x2,0x64,0xba,0xfe,0xe4,0x1,0x1c,0xd9,0xd9,0x35,0x2e,0x2e,0x7d,0x48,0x2b,0x57,0x27,0x27,0x42,0x17,0x1a,0x11,0x35,0x1e,0x1f,0x40,0x1e,0x29,0x49,0x1c,0x1c,0x20,0xea,0xea,0x1,0x9c,0xfe,0x64,0x5,0x40,0xfe,0xfa,0x8f,0xba,0x97,0xfb,0x64,0x8d,0x2c,0x2d,0x29,0x8,0x8,0x7,0x15,0xe,0x83,0x4,0xb,0x5,0x5,0x7,0x14,0x19,0x18,0x52,0x3f,0xfb,0x97,0xba,0x8f,0x0,0xff,0xff,0x0,0x7f,0xff,0xec,0x4,0x81,0x6,0xb3,0x4,0x26,0x0,0x2f,0xf1,0x0,0x0,0x7,0x0,0x6d,0x1,0xa1,0x0,0x9d,0xff,0xff,0x0,0xb4,0xff,0xec,0x4,0x1f,0x5,0xca,0x6,0x26,0x0,0x30,0x0,0x0,0x0,0x6,0x1,0x5b,0x75,0x1,0xff,0xff,0x0,0xb4,0xff,0xec,0x4,0x1f,0x5,0xf4,0x6,0x26,0x0,0x30,0x0,0x0,0x0,0x6,0x1,0x5f,0x0,0x42,0xff,0xff,0x0,0xb4,0xff,0xec,0x4,0x1f,0x5,0xf2,0x6,0x26,0x0,0x30,0x0,0x0,0x0,0x6,0x1,0x5c,0x77,0x5,0xff,0xff,0x0,0xb4,0xff,0xec,0x4,0x1f,0x5,0xca,0x6,0x26,0x0,0x30,0x0,0x0,0x0,0x6,0x1,0x61,0x0,0x5,0xff,0xff,0x0,0xb4,0xff,0xec,0x4,0x1f,0x5,0xcd,0x6,0x26,0x0,0x30,0x0,0x0,0x0,0x6,0x1,0x5a,0x89,0x4,0x0,0x1,0x0,0xb4,0xff,0xec,0x5,0x3f,0x4,0x93,0x0,0x27,0x0,0x0,0x41,0x23,0x14,0x6,0x7,0x6,0x6,0x7,0x35,0x23,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x17,0x33,0x11,0x36,0x36,0x5,0x3f,0xa8,0xd,0x10,0xe,0x2d,0x20,0xba,0xc,0x1f,0x14,0x26,0x6f,0x4a,0x35,0x51,0x1c,0x1c,0x1c,0xb9,0x35,0x31,0x31,0x8a,0x55,0x6a,0xa2,0x36,0xb,0xa8,0x93,0x8c,0x4,0x93,0x35,0x52,0x1c,0x19,0x22,0x8,0x8d,0xfc,0xf8,0x1b,0x2f,0x13,0x24,0x29,0x1c,0x23,0x22,0x74,0x58,0x2,0x85,0xfd,0x7d,0x79,0xad,0x38,0x38,0x35,0x59,0x50,0x95,0x3,0x22,0x13,0xb4,0xff,0xff,0x0,0xb4,0xff,0xec,0x4,0x5b,0x5,0xf4,0x6,0x26,0x0,0x30,0x0,0x0,0x0,0x7,0x1,0x63,0x0,0x85,0x0,0x5,0xff,0xff,0x0,0xb4,0xff,0xec,0x4,0x1f,0x5,0xa5,0x6,0x26,0x0,0x30,0x0,0x0,0x0,0x6,0x1,0x5e,0x3,0xf5,0x0,0x1,0x0,0xb4,0xfe,0x4f,0x4,0x44,0x4,0x3a,0x0,0x38,0x0,0x0,0x61,0x33,0x11,0x23,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x17,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x4,0x1e,0x1,0xba,0xf,0x2c,0x1d,0x25,0x62,0x3f,0x35,0x51,0x1c,0x1c,0x1c,0xb9,0x35,0x31,0x31,0x8a,0x55,0x6a,0xa2,0x36,0xa,0x19,0x2b,0x12,0x26,0x29,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0x17,0x15,0x16,0x42,0x4,0x3a,0xfc,0xf8,0x23,0x3a,0x15,0x1b,0x1d,0x1c,0x23,0x22,0x74,0x58,0x2,0x85,0xfd,0x7d,0x79,0xad,0x38,0x38,0x35,0x59,0x50,0x8c,0x11,0x25,0x14,0x2a,0x5b,0x2d,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x20,0x3b,0x1b,0x1c,0x33,0x0,0xff,0xff,0x0,0xb4,0xff,0xec,0x4,0x1f,0x6,0x35,0x6,0x26,0x0,0x30,0x0,0x0,0x0,0x6,0x1,0x62,0xff,0x4e,0xff,0xff,0x0,0xb4,0xff,0xec,0x4,0x1f,0x5,0xfc,0x6,0x26,0x0,0x30,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x83,0x0,0xb,0xff,0xff,0x0,0x30,0x0,0x0,0x4,0xa7,0x5,0xca,0x6,0x26,0x0,0x32,0x0,0x0,0x0,0x6,0x1,0x5b,0x7c,0x1,0xff,0xff,0x0,0x30,0x0,0x0,0x4,0xa7,0x5,0xf2,0x6,0x26,0x0,0x32,0x0,0x0,0x0,0x6,0x1,0x5c,0x7e,0x5,0xff,0xff,0x0,0x30,0x0,0x0,0x4,0xa7,0x5,0xca,0x6,0x26,0x0,0x32,0x0,0x0,0x0,0x6,0x1,0x61,0x6,0x5,0xff,0xff,0x0,0x30,0x0,0x0,0x4,0xa7,0x5,0xcd,0x6,0x26,0x0,0x32,0x0,0x0,0x0,0x6,0x1,0x5a,0x90,0x4,0xff,0xff,0x0,0x44,0xfe,0x4b,0x4,0x85,0x5,0xca,0x6,0x26,0x0,0x34,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x89,0x0,0x1,0xff,0xff,0x0,0x44,0xfe,0x4b,0x4,0x85,0x5,0xf2,0x6,0x26,0x0,0x34,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x8b,0x0,0x5,0xff,0xff,0x0,0x44,0xfe,0x4b,0x4,0x85,0x5,0xca,0x6,0x26,0x0,0x34,0x0,0x0,0x0,0x6,0x1,0x61,0x13,0x5,0xff,0xff,0x0,0x44,0xfe,0x4b,0x4,0x85,0x5,0xcd,0x6,0x26,0x0,0x34,0x0,0x0,0x0,0x6,0x1,0x5a,0x9d,0x4,0xff,0xff,0x0,0xa0,0x0,0x0,0x4,0x3d,0x5,0xca,0x6,0x26,0x0,0x35,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x9a,0x0,0x1,0xff,0xff,0x0,0xa0,0x0,0x0,0x4,0x3d,0x5,0xf3,0x6,0x26,0x0,0x35,0x0,0x0,0x0,0x6,0x1,0x64,0x25,0x6,0xff,0xff,0x0,0xa0,0x0,0x0,0x4,0x3d,0x5,0xc3,0x6,0x26,0x0,0x35,0x0,0x0,0x0,0x6,0x1,0x60,0x24,0x5,0x0,0x1,0x1,0x9f,0x4,0xbf,0x3,0x2d,0x5,0xc9,0x0,0x3,0x0,0x0,0x41,0x3,0x23,0x13,0x3,0x2d,0xaf,0xdf,0xf8,0x4,0xbf,0x1,0xa,0xfe,0xf6,0x0,0x0,0x1,0x1,0x9a,0x4,0xbf,0x3,0x32,0x5,0xc9,0x0,0x3,0x0,0x0,0x41,0x3,0x33,0x1,0x2,0x52,0xb8,0x8c,0x1,0xc,0x5,0xc9,0xfe,0xf6,0x1,0xa,0x0,0x1,0x0,0xc1,0x4,0xe4,0x3,0x1e,0x5,0xed,0x0,0x8,0x0,0x0,0x41,0x27,0x23,0x7,0x15,0x33,0x37,0x17,0x33,0x3,0x1e,0xf8,0x70,0xf5,0x98,0x95,0x96,0x9a,0x4,0xfd,0xf0,0xef,0x1a,0x97,0x97,0x0,0x0,0x1,0x0,0x8a,0x4,0xe3,0x3,0x3a,0x5,0xf1,0x0,0x25,0x0,0x0,0x41,0x27,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x17,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x3,0x3a,0x67,0x11,0xd,0xe,0x26,0x15,0x27,0x41,0x1f,0x20,0x43,0x2a,0x2e,0x4b,0x1b,0x1b,0x1f,0x68,0x1,0x39,0x2c,0x1b,0x2c,0x14,0x13,0x26,0x16,0x15,0x34,0x21,0x2d,0x4c,0x1b,0x1b,0x1f,0x5,0xd3,0x1e,0x17,0x29,0xf,0xf,0x12,0x1e,0x12,0x11,0x1e,0x26,0x1f,0x20,0x53,0x2d,0x18,0x2e,0x41,0xe,0xa,0xb,0x19,0xa,0xb,0xe,0x24,0x1f,0x1e,0x52,0x0,0x1,0x1,0x1,0x5,0x21,0x3,0xcb,0x5,0xb0,0x0,0x3,0x0,0x0,0x41,0x35,0x21,0x15,0x3,0xcb,0xfd,0x36,0x5,0x21,0x8f,0x8f,0x0,0x1,0x1,0x3b,0x4,0xa7,0x3,0x91,0x5,0xb2,0x0,0x19,0x0,0x0,0x41,0x23,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x3,0x91,0x96,0x12,0x12,0x12,0x37,0x27,0x28,0x38,0x12,0x12,0x12,0x96,0x2b,0x27,0x27,0x6e,0x45,0x44,0x6e,0x27,0x27,0x2a,0x5,0xb2,0x1e,0x37,0x14,0x14,0x18,0x18,0x14,0x14,0x37,0x1e,0x3b,0x63,0x23,0x23,0x27,0x27,0x23,0x23,0x63,0x0,0x0,0x1,0x1,0xf2,0x4,0xe1,0x2,0xd8,0x5,0xbe,0x0,0xb,0x0,0x0,0x41,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x1,0xf2,0x3a,0x39,0x39,0x3a,0x3a,0x39,0x39,0x3a,0x5,0x4e,0x2e,0x3f,0x3f,0x2e,0x30,0x40,0x40,0x0,0x0,0x2,0x1,0x1f,0x4,0xf0,0x3,0xa8,0x5,0xc5,0x0,0xb,0x0,0x17,0x0,0x0,0x41,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x5,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x1,0x1f,0x37,0x36,0x36,0x38,0x38,0x36,0x36,0x37,0x1,0xae,0x37,0x36,0x36,0x38,0x38,0x36,0x36,0x37,0x5,0x5b,0x2d,0x3c,0x3c,0x2d,0x2d,0x3d,0x3d,0x2f,0x2c,0x3d,0x3d,0x2c,0x2d,0x3e,0x3e,0x0,0x0,0x2,0x1,0x9a,0x4,0x5e,0x3,0x31,0x5,0xe7,0x0,0x17,0x0,0x2f,0x0,0x0,0x41,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x1,0x9a,0x21,0x1c,0x1b,0x4b,0x2a,0x2a,0x49,0x1c,0x1b,0x20,0x20,0x1b,0x1c,0x49,0x2a,0x2a,0x4b,0x1b,0x1c,0x21,0x63,0x12,0xf,0xe,0x26,0x15,0x16,0x25,0xe,0xe,0x10,0x10,0xe,0xe,0x25,0x16,0x16,0x26,0xe,0xf,0x11,0x5,0x20,0x2b,0x48,0x19,0x1a,0x1c,0x1c,0x1a,0x19,0x48,0x2b,0x2b,0x49,0x1b,0x1a,0x1e,0x1e,0x1a,0x1b,0x49,0x2b,0x19,0x29,0xf,0xd,0xf,0xf,0xe,0xf,0x29,0x18,0x17,0x26,0xe,0xe,0x10,0x10,0xf,0xe,0x26,0x0,0x2,0x0,0xf6,0x4,0xe2,0x3,0xd6,0x5,0xef,0x0,0x3,0x0,0x7,0x0,0x0,0x41,0x3,0x33,0x1,0x21,0x3,0x33,0x13,0x2,0xf5,0xf9,0xa9,0x1,0x31,0xfd,0xdc,0xbc,0x96,0xf5,0x5,0xef,0xfe,0xf3,0x1,0xd,0xfe,0xf3,0x1,0xd,0x0,0x0,0x1,0x1,0x30,0x4,0xe3,0x3,0x9b,0x5,0xed,0x0,0x8,0x0,0x0,0x41,0x27,0x23,0x15,0x17,0x33,0x37,0x35,0x23,0x2,0x64,0x97,0x9d,0xfb,0x72,0xfe,0xa0,0x5,0x55,0x98,0x15,0xf5,0xf8,0x12,0x0,0x1,0xfd,0x27,0xfe,0xa8,0xfe,0xd,0xff,0x85,0x0,0xb,0x0,0x0,0x45,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0xfd,0x27,0x3a,0x39,0x39,0x3a,0x3a,0x39,0x39,0x3a,0xeb,0x2e,0x3f,0x3f,0x2e,0x30,0x40,0x40,0x0,0x1,0x1,0xcd,0xfe,0x4d,0x3,0x3,0x0,0x0,0x0,0x1b,0x0,0x0,0x61,0x23,0x7,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x17,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x2,0x76,0x85,0x1f,0x28,0x3c,0x15,0x14,0x14,0x1b,0x16,0x17,0x3c,0x22,0x7,0x3d,0x65,0x25,0x32,0x36,0x1a,0x15,0x16,0x37,0x1d,0x86,0x3,0xc,0xa,0xb,0x22,0x19,0x1b,0x25,0xc,0xc,0xb,0x6b,0x16,0x13,0x1b,0x56,0x38,0x2b,0x3d,0x14,0x14,0x18,0x5,0x0,0x0,0x1,0x1,0x8e,0xfe,0x4f,0x3,0x1,0x0,0x38,0x0,0x1c,0x0,0x0,0x61,0x27,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x2,0xdb,0x57,0x38,0x5b,0x20,0x20,0x23,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0x20,0x1d,0x15,0x39,0x38,0x1b,0x46,0x27,0x27,0x53,0x29,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x26,0x45,0x1f,0x16,0x29,0x0,0x1,0x1,0x2e,0xff,0x56,0x2,0x28,0x0,0xef,0x0,0x9,0x0,0x0,0x65,0x35,0x23,0x15,0x14,0x6,0x7,0x17,0x36,0x36,0x2,0x28,0xb0,0x25,0x25,0x69,0x47,0x4a,0xa9,0x46,0x49,0x4b,0x7f,0x3e,0x48,0x3e,0xb7,0x0,0xff,0xff,0x0,0xd4,0x0,0x76,0x3,0xd7,0x3,0x92,0x4,0x27,0x0,0x7a,0xff,0x48,0xff,0xdd,0x0,0x7,0x0,0x7a,0x0,0x97,0xff,0xdd,0x0,0x1,0x0,0xbc,0xfe,0x60,0x4,0x10,0x4,0x3a,0x0,0x1e,0x0,0x0,0x41,0x23,0x11,0x33,0x11,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x17,0x33,0x11,0x23,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x1,0x75,0xb9,0xb9,0x29,0x72,0x49,0x34,0x57,0x24,0x19,0x2c,0x13,0x9,0xa7,0xba,0xb,0x20,0x16,0x21,0x62,0x41,0x30,0x51,0x1d,0x1e,0x20,0x4,0x3a,0xfa,0x26,0x1,0xd5,0x24,0x25,0x18,0x17,0x11,0x2d,0x1b,0x74,0x4,0x3a,0xfc,0xe1,0x1c,0x2e,0x13,0x1d,0x1f,0x1c,0x25,0x25,0x80,0x64,0xff,0xff,0x0,0xf1,0x0,0x98,0x3,0xfe,0x3,0xb5,0x4,0x27,0x0,0x7b,0xff,0x65,0x0,0x0,0x0,0x7,0x0,0x7b,0x0,0xbe,0x0,0x0,0x0,0x1,0x0,0xcb,0x0,0x0,0x4,0x55,0x4,0x3a,0x0,0x9,0x0,0x0,0x53,0x15,0x21,0x11,0x21,0x15,0x21,0x35,0x21,0x11,0xcb,0x1,0x70,0xfe,0x90,0x3,0x8a,0xfe,0x9f,0x4,0x3a,0xa1,0xfd,0x7,0xa0,0xa0,0x3,0x9a,0x0,0x2,0x0,0x80,0xff,0xed,0x4,0x4c,0x5,0xb0,0x0,0x3,0x0,0x1c,0x0,0x0,0x61,0x11,0x23,0x11,0x1,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x1,0x39,0xb9,0x3,0x13,0xf,0x12,0x12,0x3c,0x2e,0x44,0x50,0xba,0x32,0x2c,0x2c,0x7b,0x49,0x57,0x81,0x2b,0x2a,0x29,0x5,0xb0,0xfa,0x50,0x5,0xb0,0xfb,0x93,0x2c,0x47,0x18,0x19,0x1b,0x5a,0x63,0x57,0x80,0x2a,0x2a,0x29,0x2e,0x2c,0x2c,0x7f,0x51,0x4,0x6d,0x0,0x0,0x4,0x0,0x50,0xfe,0x4e,0x4,0x4f,0x5,0xbf,0x0,0x1d,0x0,0x27,0x0,0x33,0x0,0x3f,0x0,0x0,0x41,0x15,0x33,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x21,0x15,0x33,0x11,0x23,0x15,0x21,0x35,0x23,0x11,0x3,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x5,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x2,0xae,0xde,0x27,0x22,0x22,0x5c,0x34,0xe,0x30,0x1b,0x1b,0x34,0x11,0xd,0x17,0x2c,0x15,0x1e,0x3c,0x21,0x64,0x9d,0x37,0x36,0x39,0xfc,0x10,0xea,0xef,0x2,0x88,0xdf,0xca,0x37,0x38,0x37,0x38,0x38,0x37,0x38,0x37,0x2,0x42,0x36,0x38,0x38,0x38,0x38,0x38,0x38,0x36,0x4,0x3a,0xa1,0xfc,0x62,0x4d,0x67,0x1e,0x1f,0x19,0x1,0x2,0x1,0x5,0x3,0x9e,0x4,0x6,0x2,0x3,0x2,0x38,0x37,0x37,0x9f,0x68,0x4,0x3f,0xa1,0xfd,0x7,0xa0,0xa0,0x3,0x9a,0x1,0x18,0x2d,0x3d,0x3d,0x2d,0x2d,0x3f,0x3f,0x2c,0x2d,0x3d,0x3d,0x2d,0x2d,0x3f,0x3f,0x0,0x1,0x1,0xc8,0x0,0x0,0x4,0xb,0x6,0x2b,0x0,0x15,0x0,0x0,0x61,0x33,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x37,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x1,0xc8,0xba,0x24,0x23,0x23,0x67,0x44,0x1d,0x2e,0x12,0x17,0x25,0x47,0x25,0x64,0xa0,0x38,0x39,0x3d,0x4,0x66,0x45,0x70,0x27,0x27,0x2a,0x6,0x5,0x8e,0x9,0xc,0x3c,0x39,0x3a,0xa9,0x6d,0x0,0x0,0x1,0x0,0xb0,0xfe,0x4b,0x3,0x2a,0x4,0x3a,0x0,0x1d,0x0,0x0,0x41,0x15,0x21,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x1,0x4,0x1,0x6c,0x27,0x22,0x22,0x5b,0x34,0xe,0x31,0x1b,0x1b,0x33,0x11,0xd,0x18,0x2c,0x16,0x1d,0x3b,0x21,0x64,0x9d,0x37,0x36,0x39,0x4,0x3a,0xa1,0xfc,0x60,0x4d,0x69,0x20,0x20,0x1b,0x1,0x2,0x1,0x5,0x3,0x98,0x4,0x6,0x2,0x3,0x2,0x39,0x37,0x36,0xa0,0x68,0x4,0x41,0x0,0x0,0x2,0x1,0xad,0xfe,0x86,0x2,0xdd,0xff,0xab,0x0,0x17,0x0,0x23,0x0,0x0,0x45,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x36,0x36,0x33,0x32,0x16,0x15,0x14,0x6,0x23,0x22,0x26,0x1,0xad,0x18,0x15,0x15,0x38,0x20,0x1f,0x36,0x15,0x14,0x18,0x18,0x14,0x15,0x36,0x1f,0x20,0x38,0x15,0x15,0x18,0x56,0x1,0x27,0x1c,0x1a,0x26,0x26,0x1a,0x1c,0x27,0xe9,0x20,0x36,0x13,0x13,0x15,0x15,0x13,0x13,0x36,0x20,0x20,0x37,0x14,0x13,0x16,0x16,0x13,0x14,0x37,0x20,0x1d,0x27,0x27,0x1d,0x1c,0x25,0x26,0x0,0x1,0xfc,0xca,0x4,0xbc,0xfd,0xfb,0x6,0x16,0x0,0x3,0x0,0x0,0x41,0x3,0x23,0x13,0xfd,0xfb,0x7f,0xb2,0xb3,0x4,0xbc,0x1,0x5a,0xfe,0xa6,0x0,0x0,0x1,0xfd,0x68,0x4,0xbc,0xfe,0x96,0x6,0x17,0x0,0x3,0x0,0x0,0x41,0x3,0x33,0x13,0xfd,0xea,0x82,0x74,0xba,0x6,0x17,0xfe,0xa5,0x1,0x5b,0x0,0xff,0xff,0xfc,0x88,0x4,0xe3,0xff,0x38,0x5,0xf1,0x4,0x7,0x1,0x5d,0xfb,0xfe,0x0,0x0,0x0,0x1,0xfd,0x59,0x4,0xd9,0xfe,0x8f,0x6,0x74,0x0,0x1b,0x0,0x0,0x41,0x33,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x7,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0xfd,0x6f,0x84,0x1,0x1c,0x38,0x16,0x16,0x1b,0x31,0x2e,0x26,0x69,0x41,0x7,0x21,0x3c,0x17,0x17,0x1b,0x15,0x15,0x12,0x34,0x21,0x4,0xd9,0x47,0x4,0x14,0x12,0x12,0x36,0x26,0x30,0x4b,0x18,0x14,0x15,0x6a,0x8,0x9,0x9,0x1e,0x16,0x16,0x1b,0x8,0x7,0x8,0x2,0x0,0x0,0x2,0xfc,0x5,0x4,0xe4,0xfe,0xe5,0x5,0xee,0x0,0x3,0x0,0x7,0x0,0x0,0x41,0x3,0x23,0x1,0x21,0x3,0x23,0x13,0xfd,0xe0,0xfa,0xe1,0x1,0x32,0x1,0xae,0xbd,0xcf,0xf6,0x4,0xe4,0x1,0xa,0xfe,0xf6,0x1,0xa,0xfe,0xf6,0x0,0x0,0x1,0x2,0x29,0x4,0xf7,0x3,0x2d,0x6,0x7a,0x0,0x3,0x0,0x0,0x41,0x3,0x33,0x13,0x2,0x6a,0x41,0x5a,0xaa,0x6,0x7a,0xfe,0x7d,0x1,0x83,0x0,0x0,0x3,0x1,0x13,0x4,0xe2,0x3,0xf3,0x6,0xbf,0x0,0x3,0x0,0xf,0x0,0x1b,0x0,0x0,0x41,0x3,0x33,0x13,0x1,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x5,0x14,0x16,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x2,0x74,0x30,0x87,0x76,0xfd,0xd2,0x39,0x39,0x39,0x3a,0x3a,0x39,0x39,0x39,0x1,0xfb,0x39,0x39,0x39,0x3a,0x3a,0x39,0x39,0x39,0x6,0xbf,0xfe,0xf8,0x1,0x8,0xfe,0x91,0x2e,0x40,0x40,0x2e,0x30,0x40,0x40,0x30,0x2e,0x40,0x40,0x2e,0x30,0x40,0x40,0xff,0xff,0x2,0x30,0x2,0x6b,0x3,0x16,0x3,0x49,0x4,0x6,0x0,0x64,0x38,0x0,0x0,0x1,0x0,0xb5,0x0,0x0,0x4,0x30,0x5,0xb0,0x0,0x5,0x0,0x0,0x41,0x35,0x21,0x11,0x33,0x11,0x4,0x30,0xfc,0x85,0xba,0x5,0x18,0x98,0xfa,0x50,0x5,0x18,0x0,0x2,0x0,0x2e,0x0,0x0,0x4,0xb4,0x5,0xb0,0x0,0x3,0x0,0x8,0x0,0x0,0x41,0x1,0x21,0x9,0x2,0x37,0x17,0x1,0x2,0x34,0xfd,0xfa,0x4,0x86,0xfe,0x20,0xfe,0x4a,0x1,0x45,0x1e,0x1b,0x1,0x2b,0x5,0xb0,0xfa,0x50,0x5,0xb0,0xfa,0xe7,0x3,0xc3,0x59,0x5a,0xfc,0x3e,0x0,0x3,0x0,0x6a,0xff,0xec,0x4,0x61,0x5,0xc4,0x0,0x3,0x0,0x1d,0x0,0x37,0x0,0x0,0x41,0x35,0x21,0x15,0x5,0x35,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x3,0x15,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x3,0x4d,0xfe,0x30,0x2,0xe4,0x2,0x39,0x3f,0x3f,0xbe,0x85,0x79,0xb4,0x41,0x49,0x42,0x2,0x2,0x40,0x42,0x3f,0xb9,0x81,0x84,0xc0,0x3b,0x40,0x3b,0xb7,0x2,0x21,0x2b,0x26,0x77,0x58,0x57,0x77,0x24,0x2d,0x28,0x25,0x2e,0x26,0x75,0x57,0x55,0x77,0x23,0x30,0x24,0x2,0x94,0x97,0x97,0x10,0xa6,0x76,0xf0,0x60,0x60,0x74,0x61,0x5a,0x65,0xf9,0x81,0xa6,0x7a,0xf6,0x61,0x59,0x6e,0x75,0x5b,0x5f,0xf2,0x1,0x1f,0xa8,0x56,0xc2,0x49,0x44,0x50,0x52,0x3c,0x4d,0xc5,0x55,0xa8,0x54,0xc1,0x4f,0x3d,0x52,0x4e,0x3a,0x50,0xc4,0x0,0x1,0x0,0x36,0x0,0x0,0x4,0xa0,0x5,0xb0,0x0,0x6,0x0,0x0,0x41,0x1,0x33,0x1,0x23,0x1,0x33,0x2,0x6a,0x1,0x79,0xbd,0xfe,0x1b,0xa1,0xfe,0x1c,0xbd,0x4,0x9c,0xfb,0x64,0x5,0xb0,0xfa,0x50,0x0,0x3,0x0,0x91,0x0,0x0,0x4,0x37,0x5,0xb0,0x0,0x3,0x0,0x7,0x0,0xb,0x0,0x0,0x77,0x15,0x21,0x35,0x1,0x15,0x21,0x35,0x1,0x15,0x21,0x35,0x91,0x3,0xa6,0xfc,0xaf,0x2,0xf2,0xfc,0xbb,0x3,0x96,0x97,0x97,0x97,0x2,0xa7,0x98,0x98,0x2,0x72,0x98,0x98,0x0,0x1,0x0,0xa2,0x0,0x0,0x4,0x2a,0x5,0xb0,0x0,0x7,0x0,0x0,0x61,0x11,0x21,0x11,0x33,0x11,0x21,0x11,0x4,0x2a,0xfc,0x78,0xb9,0x2,0x16,0x5,0xb0,0xfa,0x50,0x5,0x18,0xfa,0xe8,0x0,0x0,0x1,0x0,0x70,0x0,0x0,0x4,0x6f,0x5,0xb0,0x0,0xc,0x0,0x0,0x41,0x35,0x1,0x21,0x35,0x21,0x15,0x1,0x1,0x15,0x21,0x35,0x21,0x3,0x19,0xfe,0x3d,0x2,0xe7,0xfc,0x33,0x1,0xe5,0xfe,0x1b,0x3,0xff,0xfc,0xe6,0x2,0xcd,0x19,0x2,0x32,0x98,0x90,0xfd,0xb9,0xfd,0xb7,0x90,0x98,0x0,0x3,0x0,0x45,0x0,0x0,0x4,0x87,0x5,0xb0,0x0,0x1d,0x0,0x2a,0x0,0x37,0x0,0x0,0x41,0x35,0x23,0x15,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x15,0x33,0x35,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x1,0x34,0x36,0x37,0x36,0x36,0x37,0x11,0x26,0x26,0x27,0x26,0x26,0x25,0x14,0x6,0x7,0x6,0x6,0x7,0x11,0x16,0x16,0x17,0x16,0x16,0x2,0xc3,0xb9,0x62,0xa5,0x3d,0x3d,0x44,0x44,0x3d,0x3d,0xa5,0x62,0xb9,0x61,0xa5,0x3d,0x3c,0x45,0x45,0x3c,0x3d,0xa5,0xfd,0xd8,0x24,0x23,0x22,0x64,0x41,0x41,0x64,0x22,0x23,0x24,0x2,0xd3,0x24,0x22,0x23,0x63,0x40,0x40,0x63,0x23,0x22,0x24,0x4,0xe2,0xce,0xce,0x7,0x53,0x45,0x45,0xbc,0x6f,0x70,0xbc,0x45,0x45,0x52,0x7,0xc4,0xc4,0x7,0x54,0x46,0x45,0xbb,0x70,0x6f,0xba,0x45,0x45,0x52,0xfd,0xf9,0x4f,0x84,0x31,0x31,0x3b,0x7,0xfd,0x12,0x6,0x3b,0x31,0x30,0x85,0x52,0x50,0x85,0x31,0x31,0x3b,0x7,0x2,0xee,0x7,0x3b,0x30,0x31,0x83,0x0,0x0,0x1,0x0,0x65,0x0,0x0,0x4,0x72,0x5,0xb0,0x0,0x23,0x0,0x0,0x41,0x11,0x23,0x11,0x26,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x16,0x17,0x16,0x16,0x17,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x35,0x11,0x23,0x11,0x14,0x6,0x7,0x6,0x6,0x2,0xc7,0xb9,0x36,0x59,0x1f,0x20,0x22,0xb9,0x3e,0x38,0x38,0x9c,0x5f,0xb9,0x5e,0x9e,0x38,0x38,0x3f,0xb9,0x23,0x1f,0x20,0x59,0x1,0xdf,0x3,0xd1,0xfc,0x30,0xc,0x38,0x2d,0x2d,0x7c,0x50,0x2,0x66,0xfd,0x9a,0x76,0xb7,0x41,0x41,0x4c,0xb,0xfe,0xbc,0x1,0x44,0xb,0x4c,0x41,0x41,0xb7,0x76,0x2,0x66,0xfd,0x9a,0x50,0x7d,0x2d,0x2d,0x38,0x0,0x1,0x0,0x61,0x0,0x0,0x4,0x6c,0x5,0xc4,0x0,0x3b,0x0,0x0,0x65,0x15,0x21,0x35,0x21,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x21,0x15,0x21,0x35,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x2,0xa8,0x1,0xc4,0xfe,0xf6,0x3e,0x62,0x22,0x21,0x24,0x4a,0x43,0x44,0xbf,0x75,0x75,0xbe,0x43,0x44,0x49,0x24,0x23,0x22,0x63,0x3e,0xfe,0xfa,0x1,0xc4,0x4e,0x73,0x21,0x16,0x17,0x2e,0x2b,0x2a,0x7a,0x4d,0x4e,0x7c,0x2b,0x2a,0x2d,0x16,0x15,0x21,0x6f,0xc1,0xc1,0x97,0x2f,0x87,0x50,0x50,0xb1,0x59,0x4f,0x8b,0xeb,0x55,0x54,0x5f,0x5f,0x54,0x55,0xeb,0x8b,0x4f,0x59,0xb0,0x50,0x51,0x87,0x2f,0x97,0xc1,0x12,0x77,0x63,0x41,0xa6,0x63,0x51,0x75,0xb5,0x3e,0x3d,0x40,0x40,0x3d,0x3e,0xb5,0x75,0x51,0x63,0xa7,0x42,0x62,0x77,0x0,0x0,0x2,0x0,0x81,0xff,0xeb,0x4,0x8a,0x4,0x4e,0x0,0x2f,0x0,0x4c,0x0,0x0,0x41,0x23,0x7,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x25,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x11,0x14,0x14,0x15,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x3,0xef,0x70,0x2e,0x3,0x14,0x30,0x1b,0x2d,0x6c,0x41,0x63,0x97,0x33,0x33,0x34,0x34,0x33,0x33,0x96,0x62,0x40,0x6c,0x2c,0x1b,0x30,0x14,0x9,0x19,0x10,0x1b,0x4a,0x2f,0x20,0x3b,0x1f,0x17,0xa,0x1b,0xf,0x12,0x1d,0xa,0xb,0xc,0xfd,0x4b,0x1c,0x20,0x1f,0x65,0x48,0x2b,0x49,0x1f,0x1e,0x30,0x13,0xe,0x21,0x14,0x22,0x59,0x38,0x47,0x64,0x1f,0x20,0x1c,0x4,0x3a,0x77,0x8,0x1b,0x2d,0x11,0x1c,0x1e,0x58,0x4d,0x4e,0xd5,0x7d,0x15,0x70,0xbf,0x45,0x46,0x4f,0x1c,0x1b,0x11,0x2b,0x1a,0x1c,0x2c,0x10,0x1b,0x1a,0xd,0x15,0x8a,0x2,0x4,0xd,0xf,0xf,0x33,0x26,0xdf,0x15,0x55,0x9b,0x3c,0x3b,0x46,0x15,0x13,0x13,0x34,0x1f,0xfe,0x20,0x13,0x13,0xd,0x18,0x2a,0x11,0x1e,0x22,0x3c,0x33,0x32,0x86,0x0,0x2,0x0,0xae,0xfe,0x80,0x4,0x5b,0x5,0xc4,0x0,0x26,0x0,0x4e,0x0,0x0,0x41,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x33,0x11,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x3,0x23,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x2,0x6b,0x5c,0xa1,0x3c,0x3d,0x47,0xba,0x1f,0x48,0x26,0x27,0x51,0x28,0x62,0xa6,0x3d,0x3d,0x44,0x38,0x35,0x1d,0x49,0x2b,0x20,0x37,0x16,0x25,0x28,0x3d,0x38,0x38,0x9e,0x65,0x54,0x8f,0x3d,0x5f,0x21,0x21,0x22,0x28,0x25,0x25,0x6b,0x43,0x32,0x58,0x24,0x21,0x36,0x15,0x28,0x23,0x22,0x5f,0x37,0x3a,0x5b,0x1f,0x1f,0x20,0x1d,0x1e,0x1e,0x5e,0x5,0xc4,0x40,0x37,0x37,0x93,0x52,0xfa,0x4f,0x1,0xcb,0x19,0x25,0xb,0xc,0xb,0x3b,0x39,0x39,0xa5,0x6b,0x55,0x8e,0x34,0x1d,0x2d,0x10,0x11,0x2b,0x19,0x2a,0x69,0x3a,0x57,0x90,0x35,0x34,0x39,0xfd,0x96,0x98,0x32,0x28,0x29,0x66,0x35,0x3f,0x6b,0x26,0x27,0x2b,0x13,0x10,0xf,0x29,0x19,0x3,0x3b,0x35,0x5c,0x22,0x22,0x27,0x28,0x21,0x21,0x56,0x2e,0x33,0x54,0x1e,0x1e,0x22,0x0,0x1,0x0,0x47,0xfe,0x60,0x4,0x96,0x4,0x3a,0x0,0xb,0x0,0x0,0x41,0x1,0x7,0x23,0x27,0x1,0x23,0x1,0x11,0x33,0x11,0x1,0x3,0xd8,0xfe,0xb3,0x19,0x1,0x18,0xfe,0xac,0xbe,0x1,0xcb,0xba,0x1,0xca,0x4,0x3a,0xfc,0xf0,0x62,0x62,0x3,0x10,0xfb,0xfc,0xfe,0x2a,0x1,0xcf,0x4,0xb,0x0,0x0,0x2,0x0,0x78,0xff,0xec,0x4,0x66,0x6,0x1c,0x0,0x39,0x0,0x53,0x0,0x0,0x41,0x14,0x16,0x17,0x16,0x16,0x17,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x2,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x37,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x13,0x35,0x34,0x36,0x37,0x36,0x36,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x1,0x7,0x1e,0x1b,0x1b,0x4c,0x2f,0x4,0x48,0x7f,0x2e,0x2f,0x36,0x44,0x41,0x41,0xbb,0x78,0x76,0xba,0x41,0x40,0x44,0xdf,0xdc,0x43,0x59,0x1b,0x1b,0x17,0x1c,0x19,0x19,0x45,0x2a,0x28,0x4e,0x24,0x24,0x3f,0x17,0x29,0x4b,0x9f,0x50,0x56,0x8c,0x31,0x32,0x36,0x2b,0x28,0x28,0x28,0x78,0x51,0x47,0x73,0x29,0x29,0x2d,0x26,0x27,0x27,0x76,0x51,0x52,0x78,0x27,0x28,0x26,0x4,0xf5,0x2f,0x51,0x22,0x23,0x36,0x13,0xb,0x11,0x52,0x3c,0x3c,0x98,0x57,0x15,0x71,0xc1,0x47,0x47,0x51,0x51,0x47,0x47,0xc1,0x71,0x15,0xcf,0x1,0x14,0x49,0x17,0x30,0x18,0x18,0x2f,0x16,0x1f,0x33,0x12,0x12,0x14,0xd,0x9,0xa,0x16,0x9,0x82,0x26,0x2f,0x28,0x26,0x26,0x6e,0xfc,0xc3,0x15,0x4c,0x8b,0x35,0x34,0x3d,0x1,0xc,0x4b,0x34,0x35,0x7d,0x3f,0x15,0x4d,0x8a,0x33,0x34,0x3d,0x3d,0x34,0x33,0x8a,0x0,0x1,0x0,0x8b,0xff,0xec,0x4,0x60,0x4,0x4d,0x0,0x52,0x0,0x0,0x53,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x23,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x33,0x35,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x8b,0x48,0x42,0x41,0xb4,0x6c,0x61,0xae,0x46,0x3e,0x56,0x1,0xb9,0x2e,0x28,0x29,0x70,0x42,0x4a,0x72,0x26,0x27,0x28,0x1c,0x1c,0x15,0x39,0x23,0x1b,0x3e,0x23,0xf3,0xf3,0x26,0x40,0x1a,0x19,0x2a,0x10,0x21,0x1e,0x21,0x23,0x23,0x6c,0x4b,0x3a,0x68,0x27,0x27,0x2f,0xb9,0x1,0x4c,0x40,0x41,0xab,0x5f,0x6c,0xaf,0x3d,0x3e,0x42,0x22,0x20,0x19,0x44,0x29,0x2a,0x46,0x1a,0x28,0x29,0x1,0x30,0x4e,0x78,0x29,0x2a,0x2b,0x2c,0x2a,0x25,0x82,0x57,0x27,0x45,0x1a,0x1b,0x1e,0x1b,0x18,0x17,0x40,0x25,0x28,0x3d,0x15,0xf,0x16,0x6,0x5,0x4,0x94,0x6,0x5,0x6,0x10,0xa,0x15,0x3b,0x25,0x22,0x3c,0x17,0x16,0x1a,0x1a,0x16,0x17,0x3f,0x25,0x4b,0x77,0x2a,0x29,0x2c,0x28,0x27,0x28,0x75,0x4e,0x2a,0x4d,0x1f,0x19,0x29,0xf,0xc,0x23,0x17,0x21,0x5c,0x0,0x1,0x0,0x75,0xfe,0x81,0x4,0x2f,0x5,0xb0,0x0,0x38,0x0,0x0,0x41,0x21,0x15,0x21,0x1,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x37,0x34,0x26,0x27,0x26,0x26,0x27,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x1,0x4,0x2f,0xfc,0x46,0x2,0xd4,0xfe,0xce,0x5c,0x86,0x2b,0x2c,0x2a,0x26,0x29,0x28,0x7f,0x59,0xb5,0x29,0x3c,0x13,0x12,0x11,0x10,0x10,0xc,0x22,0x15,0x62,0x1c,0x3f,0x1a,0x1a,0x23,0x1,0x29,0x23,0x23,0x60,0x36,0xdd,0x2c,0x44,0x17,0x17,0x18,0x29,0x27,0x26,0x6e,0x45,0x1,0x99,0x5,0xb0,0x98,0xfe,0xc4,0x57,0xa4,0x4c,0x4c,0x87,0x39,0x51,0x7a,0x2c,0x2d,0x3b,0x10,0x23,0x8,0x18,0xe,0xd,0x1f,0x11,0x19,0x30,0x19,0x13,0x2a,0x18,0x54,0x16,0x45,0x28,0x27,0x56,0x27,0x3e,0x4b,0x17,0x17,0x1a,0xc,0x32,0x9,0x1f,0x19,0x1a,0x4a,0x32,0x4e,0x82,0x3c,0x3c,0x75,0x42,0x1,0xab,0x0,0x0,0x1,0x0,0xa4,0xfe,0x61,0x4,0x2b,0x4,0x4e,0x0,0x20,0x0,0x0,0x73,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,0x6,0x6,0x7,0x27,0x27,0x23,0xa4,0xba,0x13,0x34,0x20,0x23,0x56,0x34,0x3f,0x5f,0x1f,0x21,0x21,0xba,0x36,0x32,0x32,0x8e,0x5a,0x41,0x71,0x2f,0x21,0x38,0x17,0x1,0xc,0xa7,0x3,0x28,0x20,0x33,0x13,0x13,0x15,0x1d,0x1f,0x20,0x68,0x49,0xfb,0xb8,0x4,0x4c,0x73,0x9f,0x32,0x31,0x2c,0x1,0x21,0x1f,0x16,0x3a,0x23,0xe,0x92,0x0,0x3,0x0,0xb9,0xff,0xec,0x4,0x18,0x5,0xc5,0x0,0x19,0x0,0x28,0x0,0x37,0x0,0x0,0x45,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x14,0x16,0x17,0x16,0x16,0x37,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x21,0x15,0x14,0x6,0x7,0x6,0x6,0x1,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x2,0x6a,0x67,0xa0,0x37,0x37,0x39,0x3a,0x37,0x37,0xa1,0x67,0x66,0xa1,0x37,0x37,0x3a,0x3b,0x38,0x37,0xa1,0x66,0x40,0x5e,0x1f,0x1e,0x1d,0x1,0xed,0x1f,0x21,0x1e,0x5a,0xfe,0xcb,0x23,0x24,0x1e,0x58,0x39,0x39,0x57,0x1e,0x25,0x24,0x14,0x4d,0x4a,0x49,0xd7,0x8a,0x1,0x55,0x8a,0xd7,0x4b,0x4a,0x4d,0x4d,0x4a,0x4b,0xd7,0x8a,0xfe,0xab,0x8a,0xd7,0x49,0x4a,0x4d,0x96,0x34,0x32,0x31,0x91,0x5c,0x8d,0x8d,0x61,0x95,0x31,0x2e,0x2f,0x2,0xa8,0x81,0x66,0x9a,0x31,0x28,0x29,0x29,0x27,0x30,0x9b,0x67,0x81,0x0,0x0,0x1,0x0,0xb8,0xff,0xec,0x4,0x3a,0x4,0x3a,0x0,0x1a,0x0,0x0,0x53,0x15,0x21,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x3,0xb8,0x1,0x60,0x2a,0x28,0x27,0x71,0x48,0x25,0x48,0x23,0x17,0x30,0x19,0x29,0x1d,0x4e,0x2d,0x21,0x3c,0x17,0x18,0x1b,0x1,0x4,0x3a,0xa1,0xfd,0xb3,0x65,0x87,0x29,0x29,0x22,0x8,0xc,0x8,0x18,0x12,0x82,0x11,0x1c,0xa,0x13,0x12,0x4b,0x41,0x2,0xf8,0x0,0x1,0x0,0x39,0xff,0xef,0x4,0x5c,0x5,0xee,0x0,0x2d,0x0,0x0,0x61,0x13,0x37,0x17,0x13,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x37,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x1,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x17,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x17,0x1,0x1,0x7,0xf6,0x1d,0x2d,0xa7,0x18,0x39,0x25,0x24,0x5c,0x3b,0xc,0x24,0xb,0x2,0xc,0x11,0x11,0x18,0x2a,0x11,0x11,0x1c,0xb,0xfe,0x96,0xf,0x31,0x25,0x26,0x6a,0x48,0x19,0x3c,0x12,0x1,0xd,0x28,0xd,0x22,0x37,0x16,0x16,0x22,0xe,0x37,0xfe,0x75,0x2,0xae,0x77,0x76,0xfe,0x4b,0x42,0x64,0x21,0x22,0x22,0x9,0x6,0x97,0x3,0x2,0x18,0x15,0x14,0x36,0x23,0x3,0xb6,0x28,0x5f,0x29,0x28,0x36,0xa,0x5,0x8e,0x1,0x4,0x21,0x1b,0x1b,0x45,0x23,0x8f,0xfb,0xf8,0x0,0x1,0x0,0xaf,0xfe,0x77,0x4,0x2e,0x5,0xc4,0x0,0x5a,0x0,0x0,0x41,0x37,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x37,0x34,0x26,0x27,0x26,0x26,0x27,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x33,0x35,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x3,0xf7,0x1a,0x30,0x8c,0x47,0x7e,0xc8,0x46,0x47,0x4b,0x26,0x24,0x23,0x66,0x41,0x4f,0x7e,0x2c,0x2d,0x2f,0x48,0x42,0x42,0xba,0x72,0x3a,0x2b,0x3f,0x13,0xf,0x10,0xd,0xc,0xd,0x24,0x18,0x61,0x1b,0x3e,0x1b,0x1a,0x23,0x1,0x29,0x23,0x24,0x5f,0x36,0x6f,0x43,0x7b,0x2e,0x2f,0x37,0x1f,0x1e,0x16,0x3f,0x28,0x33,0x84,0x4f,0x8e,0x8e,0x54,0x80,0x2d,0x21,0x30,0xe,0x10,0xe,0x29,0x2c,0x2b,0x87,0x5f,0x3d,0x71,0x5,0x8,0x95,0x11,0x16,0x2d,0x2c,0x2c,0x80,0x53,0x31,0x57,0x25,0x25,0x3b,0x15,0x16,0x48,0x31,0x31,0x7e,0x4c,0x70,0x9a,0x33,0x34,0x41,0x16,0xd,0xa,0x14,0xf,0xb,0x1d,0x13,0x1d,0x2d,0x14,0x15,0x2a,0x1b,0x54,0x16,0x44,0x28,0x27,0x54,0x27,0x3d,0x4a,0x17,0x16,0x19,0xd,0x19,0xc,0x2e,0x25,0x25,0x66,0x44,0x3c,0x62,0x25,0x1c,0x2b,0x10,0x14,0x13,0x98,0x14,0x14,0xd,0x25,0x17,0x16,0x36,0x1e,0x27,0x44,0x1a,0x19,0x1e,0x15,0x0,0x0,0x1,0x0,0x59,0xff,0xed,0x4,0xa9,0x4,0x3a,0x0,0x1d,0x0,0x0,0x41,0x35,0x21,0x15,0x33,0x11,0x33,0x11,0x21,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x4,0x4c,0xfc,0xd,0x84,0xb9,0x1,0x6e,0x20,0x1f,0x1e,0x5a,0x39,0x2f,0x57,0x2f,0x29,0x11,0x31,0x1a,0x16,0x25,0xe,0xe,0x10,0x3,0xa1,0x99,0x99,0xfc,0x5f,0x3,0xa1,0xfd,0x75,0x54,0x72,0x22,0x23,0x1e,0x13,0x20,0x82,0x9,0x10,0x8,0xe,0xe,0x33,0x2c,0x2,0x95,0x0,0x2,0x0,0xa5,0xfe,0x60,0x4,0x46,0x4,0x4e,0x0,0x1b,0x0,0x35,0x0,0x0,0x41,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x33,0x11,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x27,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x4,0x46,0x39,0x39,0x3a,0xaf,0x75,0x59,0x9c,0x40,0x44,0x58,0xb9,0x16,0x31,0x1b,0x30,0x73,0x43,0x66,0x9b,0x35,0x34,0x36,0xb9,0x20,0x22,0x23,0x6d,0x4c,0x33,0x54,0x21,0x22,0x34,0x13,0x37,0x34,0x22,0x57,0x34,0x4d,0x6a,0x21,0x21,0x1e,0x1,0xf4,0x15,0x7e,0xd4,0x4e,0x4d,0x58,0x39,0x3b,0x3e,0xc5,0x95,0xfc,0x1e,0x2,0x10,0x17,0x28,0xf,0x1a,0x1c,0x4e,0x46,0x45,0xbf,0x85,0x15,0x4b,0x86,0x33,0x33,0x3b,0x17,0x15,0x14,0x39,0x21,0x1,0x25,0x5a,0xa0,0x34,0x21,0x26,0x46,0x3b,0x3b,0x9c,0x0,0x0,0x1,0x0,0x78,0xfe,0x59,0x4,0x30,0x4,0x4e,0x0,0x3f,0x0,0x0,0x41,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x7,0x14,0x6,0x7,0x6,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x37,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x2,0x66,0x77,0xb7,0x3f,0x3f,0x42,0x43,0x42,0x41,0xc4,0x82,0x36,0x52,0x1c,0x1b,0x1d,0x1,0x20,0x17,0x18,0x36,0x16,0x4d,0x2d,0x5a,0x25,0x24,0x2e,0x1,0x34,0x31,0x31,0x8a,0x56,0x5c,0x88,0x2c,0x2d,0x2b,0x23,0x26,0x25,0x75,0x51,0x47,0x6a,0x23,0x23,0x24,0xaf,0x45,0x3c,0x3d,0xa8,0x4,0x4e,0x58,0x4a,0x4b,0xc3,0x6c,0x2a,0x69,0xaf,0x42,0x43,0x58,0x13,0x7,0x12,0xd,0xd,0x25,0x1a,0x28,0x3c,0x16,0x17,0x1f,0xa,0x7b,0x14,0x3c,0x28,0x28,0x63,0x3b,0x42,0x57,0x1c,0x1c,0x21,0xc,0xd,0x45,0x31,0x31,0x7b,0x44,0x2a,0x46,0x8a,0x38,0x37,0x45,0x26,0x20,0x21,0x58,0x32,0x5d,0x92,0x33,0x32,0x35,0x0,0x2,0x0,0x6d,0xff,0xec,0x4,0x86,0x4,0x3a,0x0,0x1c,0x0,0x36,0x0,0x0,0x41,0x35,0x21,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x1,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x4,0x86,0xfd,0xc9,0x72,0xb3,0x3e,0x3e,0x41,0x41,0x3e,0x3e,0xb4,0x73,0x72,0xb4,0x3e,0x3d,0x41,0x23,0x22,0x19,0x42,0x28,0xfd,0xbb,0x24,0x25,0x24,0x70,0x4c,0x4d,0x71,0x25,0x24,0x24,0x23,0x25,0x25,0x70,0x4c,0x4d,0x71,0x24,0x25,0x24,0x3,0xa1,0x99,0x52,0x47,0x47,0xc3,0x70,0x16,0x75,0xc8,0x4a,0x4a,0x54,0x56,0x47,0x47,0xb8,0x63,0x17,0x4d,0x89,0x39,0x2a,0x48,0x1e,0xfe,0x70,0x16,0x4c,0x89,0x34,0x34,0x3d,0x3d,0x34,0x34,0x89,0x4c,0x16,0x50,0x91,0x37,0x37,0x40,0x40,0x37,0x37,0x91,0x0,0x1,0x0,0xad,0xff,0xeb,0x4,0x32,0x4,0x3a,0x0,0x1c,0x0,0x0,0x41,0x35,0x21,0x15,0x21,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x13,0x4,0x32,0xfc,0x7b,0x1,0x68,0x28,0x27,0x26,0x6f,0x48,0x1e,0x3b,0x1d,0x1d,0x3b,0x1e,0x29,0x1b,0x4d,0x2c,0x21,0x3a,0x16,0x16,0x1b,0x1,0x3,0x9c,0x9e,0x9e,0xfd,0xb2,0x65,0x87,0x29,0x2a,0x24,0x6,0x8,0x7,0x1b,0x16,0x83,0x11,0x1b,0xb,0x13,0x13,0x4b,0x40,0x2,0x58,0x0,0x1,0x0,0x9e,0xff,0xec,0x4,0x3f,0x4,0x3a,0x0,0x24,0x0,0x0,0x41,0x23,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x23,0x16,0x12,0x17,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x1,0x57,0xb9,0x3e,0x3b,0x3b,0xab,0x6e,0x7e,0xb2,0x38,0x38,0x34,0x12,0x10,0x10,0x29,0x17,0xc3,0x34,0x45,0x3,0x22,0x23,0x24,0x6e,0x4d,0x3c,0x63,0x23,0x23,0x26,0x4,0x3a,0xfd,0x97,0x7d,0xb7,0x3b,0x3c,0x3a,0x60,0x51,0x50,0xd3,0x72,0x52,0x93,0x41,0x41,0x71,0x30,0x7d,0xfe,0xfb,0x86,0x4e,0x9a,0x3d,0x3e,0x4d,0x25,0x29,0x28,0x7e,0x59,0x0,0x0,0x2,0x0,0x6e,0xfe,0x22,0x4,0x77,0x4,0x3a,0x0,0x2e,0x0,0x41,0x0,0x0,0x45,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x26,0x26,0x27,0x26,0x26,0x35,0x36,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x25,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x14,0x6,0x7,0x6,0x6,0x2,0xd,0xb9,0x75,0xa4,0x34,0x34,0x30,0x39,0x32,0x32,0x86,0x4e,0x40,0x5e,0x1e,0x1f,0x1e,0x3f,0x58,0x1b,0x1b,0x19,0x2,0x13,0x14,0x13,0x3e,0x2d,0x65,0x37,0x57,0x1e,0x28,0x27,0x2d,0x32,0x32,0x9d,0x1,0x2a,0xa,0xb,0x7,0x16,0xe,0x2e,0x44,0x17,0x16,0x17,0x2,0x1b,0x1e,0x1e,0x5e,0xe,0xfe,0x30,0x1,0xcf,0xf,0x67,0x4c,0x4c,0xbc,0x65,0x70,0xc5,0x49,0x48,0x54,0x29,0x22,0x23,0x59,0x30,0xfd,0x4c,0x12,0x53,0x37,0x36,0x80,0x40,0x34,0x6c,0x35,0x34,0x62,0x29,0x85,0x27,0x62,0x38,0x49,0xae,0x60,0x66,0xbd,0x4b,0x4c,0x67,0x8c,0x2,0xbd,0x17,0x23,0xc,0x8,0x9,0x44,0x36,0x37,0x8a,0x46,0x3f,0x81,0x37,0x38,0x52,0x0,0x0,0x1,0x0,0x61,0xfe,0x28,0x4,0x80,0x4,0x3a,0x0,0x27,0x0,0x0,0x41,0x23,0x11,0x26,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x16,0x17,0x16,0x16,0x17,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x2,0x27,0x23,0x16,0x12,0x17,0x14,0x6,0x7,0x6,0x6,0x7,0x2,0xbc,0xb9,0x35,0x56,0x1e,0x1f,0x21,0xb9,0x38,0x36,0x36,0x9b,0x63,0xb9,0x7d,0xac,0x36,0x35,0x30,0x2f,0x20,0xc3,0x26,0x31,0x2,0x1d,0x1f,0x20,0x66,0x49,0x4,0x3a,0xfc,0x54,0xf,0x43,0x38,0x37,0x9c,0x67,0x1,0xe8,0xfe,0x1a,0x8c,0xd7,0x4c,0x4c,0x58,0xe,0xfe,0x35,0x1,0xc9,0xe,0x69,0x4f,0x4f,0xc6,0x6b,0xa4,0x1,0x0,0x5f,0x7d,0xff,0x0,0x86,0x44,0x8a,0x3a,0x3b,0x56,0x12,0x0,0x0,0x1,0x0,0x4f,0xff,0xec,0x4,0x89,0x4,0x3a,0x0,0x52,0x0,0x0,0x41,0x23,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x23,0x16,0x12,0x17,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x36,0x12,0x1,0x71,0xc2,0x17,0x26,0xd,0xb,0xb,0x1e,0x23,0x23,0x72,0x53,0x39,0x5c,0x21,0x13,0x1f,0xc,0xc,0x1e,0x13,0x22,0x5b,0x3a,0x38,0x59,0x21,0x28,0x32,0xc,0x9,0x8,0xe,0xc,0xd,0x24,0x15,0xc2,0x2d,0x3a,0x2,0x4,0x5,0x6,0x17,0x10,0xd,0x22,0x15,0x1b,0x2d,0x11,0x10,0x17,0x6,0x4,0x3,0xba,0x4,0x3,0x6,0x18,0x11,0x11,0x2d,0x1a,0x22,0x2e,0xe,0xf,0xc,0x2,0x3a,0x4,0x3a,0x37,0x82,0x4c,0x3a,0x83,0x48,0x6f,0xd1,0x51,0x51,0x62,0x2d,0x2b,0x18,0x3e,0x25,0x25,0x3e,0x18,0x2b,0x2d,0x2e,0x29,0x31,0x89,0x51,0x35,0x73,0x3a,0x4f,0x8e,0x3e,0x44,0x78,0x33,0x7e,0xfe,0xfb,0x87,0x35,0x66,0x2d,0x36,0x5b,0x20,0x19,0x1c,0x1b,0x1b,0x1a,0x4e,0x34,0x1d,0x41,0x25,0x1,0x2b,0xfe,0xd5,0x26,0x44,0x1d,0x34,0x4d,0x19,0x1a,0x1a,0x47,0x3c,0x3c,0x9b,0x54,0x87,0x1,0x5,0x0,0x2,0x0,0x98,0xff,0xec,0x4,0x99,0x5,0xc6,0x0,0x37,0x0,0x4b,0x0,0x0,0x41,0x27,0x6,0x6,0x7,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x15,0x14,0x6,0x7,0x6,0x6,0x27,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x7,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x36,0x36,0x1,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x26,0x26,0x27,0x26,0x26,0x4,0x99,0x9,0x20,0x44,0x23,0x2e,0x2b,0x2b,0x7e,0x4f,0x4a,0x7a,0x2c,0x2c,0x32,0x46,0x40,0x3f,0xb3,0x6e,0x1f,0x1e,0x1f,0x5e,0x3c,0x3e,0x62,0x22,0x22,0x24,0xba,0x41,0x3b,0x3a,0xa6,0x66,0x62,0x9f,0x38,0x38,0x3e,0x27,0x48,0xfd,0xac,0x15,0x13,0x13,0x37,0x22,0x27,0x39,0x12,0x13,0x13,0x47,0x70,0x26,0x27,0x28,0x2,0x73,0x95,0x8,0xd,0x3,0x1,0x61,0x58,0x8a,0x30,0x30,0x33,0x2f,0x2d,0x2d,0x81,0x51,0xf,0x64,0xae,0x43,0x44,0x5a,0x10,0xa6,0x49,0x70,0x25,0x26,0x27,0x1,0x29,0x27,0x26,0x6f,0x45,0x1,0x50,0x2,0xfe,0xb2,0x67,0xa8,0x3b,0x3c,0x41,0x3c,0x3a,0x3a,0xaa,0x6d,0xa0,0x4,0x10,0x1,0xf3,0x11,0x32,0x47,0x17,0x17,0x16,0x1a,0x19,0x1b,0x52,0x37,0xfe,0xaa,0x10,0x42,0x2e,0x2e,0x72,0x0,0x1,0x0,0x36,0x0,0x0,0x4,0xa4,0x5,0xbb,0x0,0x2e,0x0,0x0,0x41,0x3,0x7,0x27,0x3,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x17,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x1,0x11,0x33,0x11,0x1,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x37,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x3,0x39,0xb4,0x18,0x18,0xb3,0x1a,0x39,0x1f,0x20,0x46,0x27,0x1d,0x35,0x1b,0x17,0x7,0x16,0xe,0x13,0x23,0xf,0xd,0x16,0x8,0x1,0x2a,0xb8,0x1,0x28,0x6,0x10,0x9,0x11,0x29,0x17,0xf,0x16,0x7,0x16,0x1b,0x35,0x1c,0x28,0x46,0x1f,0x20,0x38,0x4,0xd7,0xfe,0x69,0x58,0x58,0x1,0x97,0x3f,0x58,0x1b,0x1b,0x17,0x7,0x11,0x95,0x5,0x4,0xb,0xb,0xa,0x1c,0x12,0xfd,0x77,0xfd,0xc0,0x2,0x44,0x2,0x85,0xe,0x17,0x9,0x10,0x10,0x4,0x5,0x95,0x11,0x7,0x17,0x1b,0x1b,0x58,0x0,0x2,0x0,0x2e,0xff,0xec,0x4,0x96,0x4,0x3a,0x0,0x2b,0x0,0x59,0x0,0x0,0x41,0x35,0x21,0x15,0x33,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x3,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x23,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x36,0x36,0x37,0x21,0x16,0x16,0x4,0x96,0xfb,0x98,0x69,0x21,0x29,0x3,0x4,0x9,0x35,0x2c,0x1f,0x53,0x34,0x39,0x5a,0x22,0x13,0x1f,0xc,0xc,0x22,0x15,0x21,0x59,0x37,0x4e,0x6b,0x21,0x10,0x18,0x7,0x7,0x7,0xa,0xa,0xa,0x1c,0x10,0x70,0x3,0x3,0x3,0x8,0x5,0xc,0x27,0x1d,0x1a,0x2c,0x11,0x10,0x17,0x6,0x5,0x4,0xba,0x5,0x4,0x6,0x13,0xd,0x11,0x30,0x1d,0x10,0x1b,0xa,0x13,0x15,0x6,0x2,0x2,0x2,0x2f,0x26,0x1,0xf3,0x26,0x2f,0x3,0xa1,0x99,0x99,0x6a,0xfb,0x8c,0x1f,0x3d,0x1e,0x52,0x8a,0x2c,0x1f,0x23,0x2c,0x2b,0x18,0x3f,0x26,0x28,0x42,0x19,0x28,0x29,0x4b,0x3f,0x20,0x4b,0x29,0x27,0x54,0x2b,0x44,0x82,0x3c,0x40,0x78,0x37,0xfe,0xe,0x22,0x42,0x1d,0x17,0x29,0x12,0x29,0x31,0x18,0x19,0x18,0x49,0x30,0x1f,0x4a,0x2a,0xfb,0xfb,0x2b,0x4b,0x20,0x29,0x41,0x17,0x1f,0x1f,0x10,0xe,0x18,0x58,0x36,0x18,0x36,0x1b,0x7c,0xfd,0x79,0x79,0xfd,0x0,0x0,0x1,0x0,0x2a,0xff,0xf5,0x4,0x7c,0x5,0xb0,0x0,0x27,0x0,0x0,0x41,0x35,0x21,0x15,0x21,0x11,0x33,0x11,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x14,0x6,0x7,0x6,0x6,0x23,0x17,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x11,0x4,0x3d,0xfb,0xed,0x1,0x5b,0xb8,0x1e,0x3c,0x20,0x3f,0x5f,0x20,0x27,0x25,0x1,0x16,0x18,0x19,0x51,0x3a,0x2,0x5b,0x8f,0x31,0x37,0x38,0x3c,0x3a,0x3a,0xa9,0x6c,0x1f,0x3d,0x1e,0x5,0x18,0x98,0x98,0xfa,0xe8,0x2,0xaf,0x2,0x4,0x22,0x20,0x26,0x76,0x4b,0x3c,0x61,0x22,0x22,0x25,0x91,0x30,0x2e,0x33,0x9e,0x68,0x6a,0xab,0x3b,0x3b,0x40,0x4,0x2,0x1,0xc7,0x0,0x1,0x0,0x81,0xff,0xec,0x4,0x6b,0x5,0xc5,0x0,0x37,0x0,0x0,0x41,0x23,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x21,0x35,0x21,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x4,0x6b,0xb9,0xa,0x2b,0x25,0x26,0x6d,0x4b,0x4f,0x77,0x28,0x29,0x29,0x2,0x3b,0xfd,0xc5,0x29,0x29,0x28,0x77,0x4f,0x4b,0x6d,0x25,0x25,0x2c,0xa,0xb9,0xa,0x48,0x3e,0x3f,0xb0,0x72,0x75,0xbb,0x41,0x42,0x46,0x46,0x42,0x41,0xbb,0x75,0x72,0xb0,0x3f,0x3e,0x48,0x1,0xb7,0x4d,0x73,0x26,0x27,0x27,0x43,0x3b,0x3b,0xa1,0x5f,0x58,0x98,0x4b,0x5e,0xa1,0x3b,0x3a,0x43,0x2a,0x28,0x28,0x76,0x4b,0x6e,0xad,0x3c,0x3c,0x3f,0x57,0x4e,0x4e,0xda,0x83,0xfe,0xc7,0x83,0xd9,0x4e,0x4f,0x57,0x43,0x3d,0x3d,0xa9,0x0,0x0,0x2,0x0,0x1e,0x0,0x0,0x4,0x9d,0x5,0xb0,0x0,0x2e,0x0,0x3d,0x0,0x0,0x41,0x21,0x3,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x23,0x15,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x13,0x33,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x2,0xeb,0xfd,0xcc,0x3,0x3,0x3,0x3,0xa,0x7,0x7,0x11,0xb,0xd,0x22,0x14,0x16,0x20,0x38,0x59,0x22,0x1a,0x28,0xe,0xd,0x11,0x5,0x4,0x4,0x1,0xc5,0x1,0x14,0x54,0x81,0x2b,0x2b,0x2c,0x2c,0x2b,0x2b,0x81,0x54,0x5b,0x5b,0x2b,0x3d,0x13,0x13,0x11,0x11,0x12,0x13,0x3d,0x2c,0x5b,0x5,0xb0,0xfd,0x54,0x45,0x7c,0x36,0x3d,0x68,0x29,0x26,0x3b,0x14,0x19,0x1a,0x97,0x2e,0x2c,0x22,0x62,0x3c,0x34,0x79,0x45,0x38,0x7d,0x43,0x2,0x14,0xfa,0xe8,0x44,0x3c,0x3b,0xa2,0x5e,0x5e,0xa2,0x3c,0x3b,0x45,0x98,0x32,0x29,0x29,0x68,0x36,0x37,0x69,0x29,0x2a,0x33,0x0,0x2,0x0,0x83,0x0,0x0,0x4,0x8b,0x5,0xb0,0x0,0x18,0x0,0x27,0x0,0x0,0x73,0x33,0x11,0x33,0x11,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x11,0x23,0x11,0x23,0x11,0x23,0x1,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x83,0xb8,0xfa,0xe9,0x5b,0x89,0x2e,0x2d,0x2e,0x2e,0x2d,0x2e,0x89,0x5b,0x31,0xb8,0xfa,0xb8,0x2,0x6a,0x31,0x33,0x45,0x15,0x15,0x13,0x12,0x15,0x16,0x45,0x33,0x31,0x2,0xa1,0xfd,0x5f,0x41,0x39,0x39,0x9b,0x5a,0x5a,0x98,0x38,0x37,0x3e,0x2,0x69,0xfd,0x89,0x2,0x77,0xfc,0xff,0x2c,0x24,0x24,0x5e,0x33,0x33,0x5f,0x25,0x25,0x2d,0x0,0x1,0x0,0x43,0x0,0x0,0x4,0x68,0x5,0xb0,0x0,0x1d,0x0,0x0,0x41,0x35,0x21,0x15,0x21,0x11,0x33,0x11,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x26,0x6,0x7,0x11,0x4,0x40,0xfc,0x3,0x1,0x5a,0xb9,0x1a,0x36,0x1c,0x3d,0x59,0x1e,0x1d,0x1c,0xb9,0x3a,0x36,0x36,0x9d,0x63,0x1a,0x36,0x1c,0x5,0x18,0x98,0x98,0xfa,0xe8,0x2,0xbd,0x3,0x3,0x1b,0x1e,0x1e,0x5f,0x44,0xfe,0x37,0x1,0xc9,0x6a,0x98,0x31,0x31,0x2e,0x1,0x4,0x4,0x1,0xc4,0x0,0x0,0x1,0x0,0xa2,0xfe,0x99,0x4,0x2a,0x5,0xb0,0x0,0xb,0x0,0x0,0x53,0x11,0x21,0x11,0x33,0x11,0x21,0x11,0x23,0x11,0x21,0x11,0xa2,0x1,0x6c,0xb9,0x1,0x63,0xb9,0xfd,0xea,0x5,0xb0,0xfa,0x50,0xfe,0x99,0x1,0x67,0x5,0xb0,0xfa,0xe7,0x5,0x19,0x0,0x0,0x2,0x0,0xa2,0x0,0x0,0x4,0x4c,0x5,0xb0,0x0,0x12,0x0,0x21,0x0,0x0,0x41,0x35,0x21,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x21,0x11,0x11,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x21,0x4,0x1d,0xfc,0x85,0x1,0xc4,0x74,0xb5,0x3e,0x3e,0x41,0x41,0x3e,0x3e,0xb5,0x74,0xfe,0xf6,0x1,0xa,0x4e,0x71,0x25,0x25,0x23,0x23,0x25,0x25,0x71,0x4e,0xfe,0xf6,0x5,0x18,0x98,0xfa,0x50,0x3f,0x39,0x39,0xa0,0x60,0x61,0x9c,0x38,0x37,0x3c,0x1,0xbf,0xfd,0xaa,0x2b,0x24,0x25,0x63,0x38,0x39,0x67,0x27,0x27,0x2e,0x0,0x0,0x2,0x0,0x46,0xfe,0x99,0x4,0x78,0x5,0xb0,0x0,0x14,0x0,0x21,0x0,0x0,0x41,0x13,0x23,0x11,0x21,0x3,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x23,0x13,0x33,0x11,0x21,0x11,0x1,0x13,0x21,0x11,0x21,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x4,0x66,0x12,0x7f,0xfd,0x77,0x20,0x2,0x9,0x7,0x8,0x15,0xd,0x19,0x46,0x2e,0x41,0x1b,0x9d,0x2,0xc1,0xfe,0x4c,0x16,0x1,0x1f,0xfe,0x40,0x1a,0x2a,0x10,0xf,0x15,0x7,0x4,0x6,0xfe,0x9b,0x1,0xfc,0x5,0x19,0xfd,0xb7,0x4b,0x84,0x39,0x42,0x71,0x2e,0x58,0x71,0x1e,0xfe,0x2,0x1,0x67,0xfe,0x9b,0x4,0xcc,0x1,0xb1,0xfb,0x7f,0x2f,0x76,0x46,0x3e,0x91,0x50,0x2e,0x64,0x0,0x0,0x1,0x0,0x1d,0x0,0x0,0x4,0xae,0x5,0xb0,0x0,0x15,0x0,0x0,0x41,0x13,0x33,0x1,0x13,0x23,0x3,0x23,0x11,0x23,0x11,0x23,0x3,0x23,0x13,0x1,0x33,0x13,0x33,0x11,0x33,0x11,0x2,0xfb,0xce,0xe5,0xfe,0xf2,0xe8,0xd8,0xad,0x3e,0xb7,0x45,0xae,0xd7,0xe6,0xfe,0xf3,0xe6,0xcd,0x3e,0xb7,0x2,0x8b,0xfd,0x75,0x2,0xd9,0x2,0xd7,0xfd,0x73,0x2,0x8d,0xfd,0x73,0x2,0x8d,0xfd,0x27,0xfd,0x29,0x2,0x8b,0xfd,0x75,0x2,0x8b,0x0,0x0,0x1,0x0,0x59,0xff,0xeb,0x4,0x70,0x5,0xc4,0x0,0x52,0x0,0x0,0x53,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x37,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x23,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x59,0x5a,0x48,0x48,0xb7,0x5f,0x73,0xc4,0x48,0x47,0x51,0x30,0x2e,0x20,0x53,0x33,0x27,0x43,0x1b,0x32,0x36,0x1,0x4a,0x43,0x44,0xbd,0x73,0x63,0xb2,0x43,0x44,0x4f,0xb9,0x31,0x29,0x29,0x70,0x3f,0x52,0x7a,0x29,0x29,0x29,0x21,0x21,0x12,0x2f,0x1c,0x20,0x4d,0x2d,0xb7,0xb7,0x33,0x59,0x24,0x26,0x3a,0x15,0x15,0x15,0x30,0x2d,0x2e,0x81,0x51,0x48,0x78,0x2b,0x2b,0x30,0x1,0x94,0x6f,0xa1,0x34,0x34,0x31,0x38,0x37,0x36,0x9f,0x67,0x4d,0x7a,0x2e,0x1f,0x30,0x11,0x11,0x2b,0x19,0x2e,0x75,0x43,0x66,0x9c,0x34,0x34,0x34,0x38,0x33,0x34,0x95,0x5d,0x36,0x5c,0x22,0x21,0x25,0x28,0x23,0x23,0x5e,0x37,0x34,0x57,0x1f,0x12,0x1b,0xa,0xb,0xb,0x1,0x98,0xd,0xd,0xd,0x29,0x1e,0x1d,0x4d,0x30,0x3c,0x64,0x24,0x24,0x28,0x2b,0x25,0x25,0x64,0x39,0x0,0x1,0x0,0xa2,0x0,0x0,0x4,0x2a,0x5,0xb0,0x0,0x9,0x0,0x0,0x41,0x1,0x13,0x23,0x11,0x33,0x1,0x3,0x33,0x11,0x3,0x71,0xfd,0xe9,0x1,0xb9,0xb9,0x2,0x17,0x1,0xb9,0x5,0xb0,0xfb,0xd0,0x4,0x30,0xfa,0x50,0x4,0x31,0xfb,0xcf,0x5,0xb0,0x0,0x0,0x1,0x0,0x2f,0x0,0x0,0x4,0x2b,0x5,0xb0,0x0,0x1e,0x0,0x0,0x41,0x21,0x3,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x23,0x15,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x13,0x21,0x11,0x33,0x4,0x2b,0xfc,0xeb,0x4,0x3,0x3,0x5,0x16,0x11,0x16,0x44,0x2f,0x28,0x33,0x39,0x5e,0x26,0x2c,0x41,0x15,0xf,0x12,0x5,0x2,0x2,0x2,0x1,0xa5,0xb9,0x5,0xb0,0xfc,0xf8,0x31,0x59,0x28,0x4b,0x78,0x2b,0x38,0x39,0x97,0x1e,0x1d,0x24,0x6f,0x4c,0x37,0x83,0x4a,0x21,0x45,0x24,0x2,0x70,0xfa,0xe8,0x0,0x0,0x1,0x0,0x2b,0xff,0xeb,0x4,0xb5,0x5,0xb0,0x0,0x1b,0x0,0x0,0x77,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x1,0x23,0x1,0x7,0x27,0x1,0x23,0x1,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x67,0x1a,0x69,0x44,0x53,0x77,0x2a,0x2a,0x3b,0x17,0x2,0x17,0xd7,0xfe,0xe0,0x48,0x47,0xfe,0xcc,0xd0,0x1,0xf2,0x2a,0xd,0x24,0x1a,0x1a,0x46,0x2e,0x27,0x5a,0x1a,0xe,0xb,0x18,0x2a,0x24,0x24,0x5f,0x34,0x4,0xc0,0xfd,0x3b,0xb3,0xbf,0x2,0xb9,0xfb,0xc2,0x55,0x1c,0x38,0x16,0x16,0x1b,0x12,0x7,0x0,0x1,0x0,0xa6,0xfe,0xa1,0x4,0xb4,0x5,0xb0,0x0,0xb,0x0,0x0,0x53,0x11,0x21,0x11,0x33,0x13,0x23,0x11,0x23,0x11,0x21,0x11,0xa6,0x3,0x56,0xa6,0x12,0x93,0xb9,0xfd,0xf7,0x5,0xb0,0xfa,0x50,0xfe,0xa1,0x1,0xfb,0x5,0x14,0xfa,0xe7,0x5,0x19,0x0,0x0,0x1,0x0,0xab,0x0,0x0,0x4,0x27,0x5,0xb0,0x0,0x19,0x0,0x0,0x41,0x23,0x11,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x11,0x33,0x4,0x27,0xb9,0x48,0x90,0x53,0x39,0x54,0x1b,0x1c,0x1b,0xb9,0x37,0x34,0x34,0x98,0x61,0x5f,0x89,0x43,0xb9,0x5,0xb0,0xfd,0x45,0x18,0x1d,0x1d,0x23,0x22,0x71,0x55,0x1,0xc8,0xfe,0x38,0x79,0xaa,0x36,0x36,0x31,0x1b,0x18,0xfd,0xa5,0x0,0x0,0x1,0x0,0x7d,0x0,0x0,0x4,0x50,0x5,0xb0,0x0,0xb,0x0,0x0,0x41,0x23,0x11,0x21,0x11,0x23,0x11,0x23,0x11,0x23,0x11,0x23,0x1,0x36,0xb9,0x3,0xd3,0xb8,0xd5,0xb8,0xd5,0x5,0xb0,0xfa,0x50,0x5,0xb0,0xfa,0xe7,0x5,0x19,0xfa,0xe7,0x0,0x0,0x1,0x0,0x7d,0xfe,0xa1,0x4,0xaa,0x5,0xb0,0x0,0xf,0x0,0x0,0x41,0x23,0x11,0x21,0x11,0x33,0x13,0x23,0x11,0x23,0x11,0x23,0x11,0x23,0x11,0x23,0x1,0x36,0xb9,0x3,0x76,0xa5,0x12,0x5a,0xb8,0xd5,0xb8,0xd5,0x5,0xb0,0xfa,0x50,0xfe,0xa1,0x1,0xf7,0x5,0x18,0xfa,0xe7,0x5,0x19,0xfa,0xe7,0x0,0x2,0x0,0x32,0x0,0x0,0x4,0x79,0x5,0xb0,0x0,0x12,0x0,0x21,0x0,0x0,0x53,0x15,0x21,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x11,0x11,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x32,0x1,0x31,0x1,0x49,0x6f,0xac,0x3b,0x3a,0x3d,0x3d,0x3a,0x3b,0xac,0x6f,0x90,0x90,0x49,0x68,0x22,0x21,0x1f,0x1f,0x21,0x22,0x68,0x49,0x90,0x5,0xb0,0x98,0xfa,0xe8,0x40,0x3a,0x39,0x9f,0x5f,0x60,0x9c,0x38,0x37,0x3d,0x2,0x57,0xfd,0x12,0x2b,0x25,0x25,0x63,0x37,0x38,0x67,0x27,0x27,0x2f,0x0,0x0,0x3,0x0,0x90,0x0,0x0,0x4,0x4b,0x5,0xb0,0x0,0x10,0x0,0x14,0x0,0x23,0x0,0x0,0x41,0x11,0x23,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x1,0x11,0x23,0x11,0x1,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x1,0x49,0xb9,0x1,0x15,0x5f,0x91,0x32,0x31,0x32,0x32,0x31,0x32,0x91,0x5f,0x2,0xa6,0xb9,0xfd,0xb7,0x5c,0x37,0x4d,0x19,0x18,0x16,0x16,0x18,0x18,0x4e,0x37,0x5c,0x3,0x59,0x2,0x57,0xfa,0x50,0x40,0x3a,0x39,0x9f,0x5f,0x5f,0x9d,0x38,0x37,0x3d,0xfc,0xa7,0x5,0xb0,0xfa,0x50,0x2,0xc2,0x2c,0x25,0x25,0x62,0x37,0x38,0x66,0x27,0x28,0x2f,0x0,0x2,0x0,0xa8,0x0,0x0,0x4,0x51,0x5,0xb0,0x0,0x10,0x0,0x1f,0x0,0x0,0x41,0x11,0x23,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x5,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x21,0x1,0x61,0xb9,0x1,0xc3,0x74,0xb5,0x3e,0x3e,0x41,0x41,0x3e,0x3e,0xb5,0x74,0xfe,0xf6,0x1,0xa,0x4e,0x71,0x25,0x25,0x23,0x23,0x25,0x25,0x71,0x4e,0xfe,0xf6,0x3,0x59,0x2,0x57,0xfa,0x50,0x3f,0x39,0x39,0xa0,0x60,0x61,0x9c,0x38,0x37,0x3c,0x97,0x2b,0x24,0x25,0x63,0x38,0x39,0x67,0x27,0x27,0x2e,0x0,0x1,0x0,0x72,0xff,0xec,0x4,0x53,0x5,0xc5,0x0,0x37,0x0,0x0,0x41,0x23,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x33,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x21,0x15,0x21,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x1,0x2b,0xb9,0x1,0x43,0x3f,0x3e,0xb0,0x6e,0x75,0xbe,0x43,0x43,0x49,0x49,0x43,0x43,0xbe,0x75,0x6e,0xb0,0x3e,0x3f,0x43,0x1,0xb9,0x1,0x27,0x25,0x25,0x6d,0x47,0x4f,0x7a,0x2a,0x2a,0x2c,0xfe,0x1c,0x1,0xe4,0x2d,0x2a,0x2a,0x7a,0x4e,0x47,0x6d,0x25,0x25,0x27,0x1,0xd1,0x6e,0xb3,0x3f,0x40,0x45,0x54,0x4d,0x4c,0xd6,0x83,0x1,0x4c,0x83,0xd7,0x4d,0x4c,0x54,0x4c,0x42,0x42,0xb2,0x65,0x4c,0x7d,0x2c,0x2b,0x30,0x40,0x39,0x39,0x9f,0x5e,0x5d,0x97,0x5a,0x5e,0x9e,0x39,0x39,0x40,0x30,0x2c,0x2b,0x7b,0x0,0x0,0x2,0x0,0x77,0xff,0xec,0x4,0x6a,0x5,0xc4,0x0,0x21,0x0,0x3b,0x0,0x0,0x41,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x23,0x11,0x23,0x11,0x33,0x11,0x33,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x3,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x4,0x6a,0x2e,0x2e,0x2e,0x89,0x5b,0x56,0x82,0x2b,0x2c,0x2b,0x72,0xb9,0xb9,0x72,0x2c,0x2c,0x2b,0x82,0x56,0x5a,0x89,0x2e,0x2e,0x2e,0xb9,0x13,0x15,0x15,0x45,0x32,0x2e,0x3e,0x13,0x13,0x10,0x10,0x13,0x13,0x3e,0x2d,0x2b,0x40,0x15,0x1c,0x19,0x2,0x3,0x1,0xa9,0x7f,0xc7,0x45,0x45,0x48,0x48,0x45,0x45,0xc7,0x7f,0x98,0x2,0x9c,0xfa,0x50,0x2,0x7d,0x7a,0x7f,0xc7,0x44,0x45,0x48,0x48,0x45,0x44,0xc7,0x2,0x2a,0xfe,0x55,0x5f,0x8e,0x2f,0x2f,0x2f,0x2f,0x2f,0x2f,0x8e,0x5f,0x1,0xab,0x5e,0x8d,0x2f,0x2f,0x2f,0x23,0x22,0x2e,0x9a,0x0,0x0,0x2,0x0,0x41,0x0,0x0,0x4,0x26,0x5,0xb0,0x0,0x13,0x0,0x22,0x0,0x0,0x61,0x33,0x11,0x21,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x1,0x33,0x1,0x21,0x1,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x11,0x23,0x22,0x26,0x27,0x26,0x26,0x3,0x6d,0xb9,0xfe,0x4e,0x75,0xbd,0x42,0x43,0x47,0x33,0x32,0x23,0x5e,0x3a,0xfe,0xab,0xc5,0x1,0x31,0x1,0x36,0xfd,0xc2,0x2a,0x29,0x29,0x79,0x50,0xf9,0xff,0x4e,0x78,0x28,0x28,0x29,0x5,0xb0,0x38,0x35,0x36,0x9d,0x64,0x52,0x84,0x33,0x23,0x39,0x15,0xfd,0x6e,0x2,0x5f,0x1,0xaf,0x3d,0x63,0x23,0x22,0x25,0xfd,0xe0,0x2a,0x26,0x25,0x66,0x0,0x0,0x2,0x0,0x81,0xff,0xec,0x4,0x47,0x6,0x11,0x0,0x35,0x0,0x4f,0x0,0x0,0x41,0x22,0x6,0x7,0x6,0x6,0x7,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x23,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x7,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x2,0x86,0x38,0x66,0x2d,0x2d,0x4e,0x20,0xf,0x42,0x30,0x30,0x7a,0x46,0x63,0x6d,0x2d,0x33,0x39,0x98,0x26,0x21,0x22,0x5b,0x35,0x6f,0xb5,0x3f,0x1f,0x30,0x11,0x12,0x13,0x42,0x3e,0x3e,0xb4,0x72,0x72,0xb3,0x3e,0x3e,0x41,0x3d,0x3a,0x3a,0xa6,0x8d,0x4c,0x71,0x25,0x25,0x24,0x24,0x25,0x25,0x6f,0x4c,0x4d,0x71,0x24,0x25,0x24,0x24,0x25,0x24,0x70,0x3,0xfc,0x19,0x16,0x17,0x3f,0x25,0x5c,0x83,0x2d,0x2d,0x35,0xf,0x15,0x1e,0x1e,0x22,0x72,0x5d,0x29,0x35,0x11,0x12,0x17,0xa,0x15,0x73,0x60,0x2f,0x70,0x41,0x46,0xa5,0x5e,0x63,0x71,0xc0,0x47,0x47,0x50,0x50,0x47,0x47,0xc0,0x71,0x17,0x69,0xb3,0x42,0x41,0x4b,0x98,0x37,0x2e,0x2f,0x7a,0x44,0x17,0x4c,0x89,0x33,0x34,0x3d,0x3d,0x34,0x33,0x89,0x4c,0x17,0x44,0x7a,0x2f,0x2e,0x37,0x0,0x0,0x3,0x0,0xa4,0x0,0x0,0x4,0x30,0x4,0x3a,0x0,0x1b,0x0,0x2a,0x0,0x39,0x0,0x0,0x73,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x21,0x13,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x21,0x11,0x11,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0xa4,0x1,0xee,0x5f,0x99,0x36,0x36,0x3a,0x1c,0x1b,0x1b,0x4b,0x32,0x8,0x1f,0x34,0x14,0x24,0x25,0x3f,0x3a,0x3b,0xa4,0x64,0xfe,0x57,0xba,0x1,0x34,0x38,0x56,0x1d,0x1c,0x1d,0x1a,0x19,0x1d,0x59,0x3b,0xfe,0xcc,0xef,0x3d,0x61,0x20,0x22,0x23,0x16,0x14,0x20,0x6c,0x4b,0x26,0x27,0x26,0x73,0x4d,0x2c,0x50,0x21,0x20,0x2f,0xd,0x2,0xc,0x1e,0x13,0x20,0x55,0x31,0x4d,0x70,0x24,0x24,0x24,0xfd,0xa1,0x16,0x15,0x14,0x3c,0x27,0x26,0x3b,0x14,0x17,0x18,0x1,0xda,0x1,0x35,0x12,0x13,0x13,0x3c,0x29,0x1f,0x31,0x12,0x1c,0x1a,0x0,0x0,0x1,0x0,0xb7,0x0,0x0,0x4,0x2a,0x4,0x3a,0x0,0x5,0x0,0x0,0x41,0x35,0x21,0x11,0x33,0x11,0x4,0x2a,0xfc,0x8d,0xba,0x3,0xa1,0x99,0xfb,0xc6,0x3,0xa1,0x0,0x2,0x0,0x36,0xfe,0xc2,0x4,0x9a,0x4,0x3a,0x0,0x11,0x0,0x1b,0x0,0x0,0x77,0x23,0x13,0x33,0x11,0x21,0x11,0x33,0x13,0x23,0x11,0x21,0x3,0x6,0x6,0x7,0x6,0x6,0x1,0x37,0x21,0x11,0x21,0x36,0x36,0x37,0x36,0x36,0x9c,0x66,0x12,0xa6,0x2,0xf3,0xa7,0x12,0x8b,0xfd,0x47,0x10,0x7,0x17,0x13,0x13,0x3b,0x1,0x38,0x9,0x1,0x4e,0xfe,0x46,0x18,0x21,0xb,0xb,0xf,0x97,0xfe,0x2b,0x1,0x3e,0xfe,0xc2,0x1,0xd5,0x3,0xa3,0xfe,0x6a,0x74,0xbc,0x44,0x44,0x4f,0x2,0x7,0xeb,0xfd,0x8,0x2c,0x70,0x43,0x42,0x98,0x0,0x0,0x1,0x0,0x11,0x0,0x0,0x4,0xac,0x4,0x3a,0x0,0x15,0x0,0x0,0x41,0x13,0x33,0x1,0x1,0x23,0x3,0x23,0x11,0x23,0x11,0x23,0x3,0x23,0x1,0x1,0x33,0x13,0x33,0x11,0x33,0x11,0x2,0xf5,0xd7,0xe0,0xfe,0xd6,0x1,0x8,0xd6,0xbe,0x3b,0xb9,0x3b,0xbd,0xd6,0x1,0x6,0xfe,0xd7,0xdf,0xd7,0x3b,0xb9,0x1,0xd6,0xfe,0x2a,0x2,0x33,0x2,0x7,0xfe,0x40,0x1,0xc0,0xfe,0x40,0x1,0xc0,0xfd,0xf9,0xfd,0xcd,0x1,0xd6,0xfe,0x2a,0x1,0xd6,0x0,0x0,0x1,0x0,0x87,0xff,0xed,0x4,0x4a,0x4,0x4d,0x0,0x52,0x0,0x0,0x53,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x23,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x87,0x4b,0x3b,0x46,0xbc,0x62,0x64,0xac,0x40,0x40,0x49,0x23,0x21,0x1c,0x4b,0x2f,0x21,0x3a,0x16,0x28,0x2c,0x42,0x3c,0x3c,0xa6,0x64,0x5f,0xab,0x40,0x41,0x4d,0x1,0xb9,0x2f,0x28,0x27,0x68,0x3a,0x41,0x64,0x22,0x21,0x23,0x1a,0x19,0x12,0x2f,0x1d,0x17,0x38,0x20,0xf1,0xf1,0x1f,0x3a,0x19,0x19,0x2c,0x12,0x24,0x26,0x29,0x25,0x26,0x6a,0x40,0x41,0x70,0x29,0x29,0x2e,0x1,0x40,0x51,0x7b,0x28,0x31,0x2e,0x2a,0x2a,0x29,0x78,0x4e,0x34,0x55,0x21,0x1b,0x29,0xe,0xd,0x21,0x13,0x22,0x54,0x30,0x4e,0x75,0x28,0x27,0x28,0x2c,0x29,0x2a,0x77,0x4b,0x25,0x3f,0x17,0x16,0x1a,0x1a,0x16,0x17,0x3c,0x22,0x22,0x36,0x13,0xd,0x14,0x6,0x5,0x5,0x9c,0x4,0x5,0x5,0xe,0xa,0x15,0x41,0x2e,0x25,0x40,0x18,0x18,0x1b,0x1f,0x1b,0x1a,0x45,0x27,0x0,0x0,0x1,0x0,0xa5,0x0,0x0,0x4,0x27,0x4,0x3a,0x0,0x9,0x0,0x0,0x41,0x1,0x11,0x23,0x11,0x33,0x1,0x11,0x33,0x11,0x3,0x6e,0xfd,0xef,0xb8,0xb8,0x2,0x11,0xb9,0x4,0x3a,0xfc,0xe1,0x3,0x1f,0xfb,0xc6,0x3,0x1e,0xfc,0xe2,0x4,0x3a,0x0,0x0,0x1,0x0,0xa4,0x0,0x0,0x4,0x95,0x4,0x3a,0x0,0xc,0x0,0x0,0x41,0x1,0x33,0x1,0x1,0x23,0x1,0x23,0x11,0x23,0x11,0x33,0x11,0x2,0xd,0x1,0x9d,0xeb,0xfe,0xc,0x1,0xd0,0xe1,0xfe,0x6d,0xa0,0xb9,0xb9,0x1,0xcd,0xfe,0x33,0x2,0x31,0x2,0x9,0xfe,0x36,0x1,0xca,0xfb,0xc6,0x1,0xcd,0x0,0x1,0x0,0x37,0x0,0x0,0x4,0x26,0x4,0x3a,0x0,0x1b,0x0,0x0,0x41,0x21,0x3,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x7,0x7,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x13,0x21,0x11,0x33,0x4,0x26,0xfc,0xff,0x2,0x3,0x3,0x5,0x10,0xb,0x16,0x4b,0x39,0x29,0x3,0x36,0x6a,0x8e,0x2a,0x1a,0x22,0x8,0x5,0x5,0x1,0x1,0x8e,0xba,0x4,0x3a,0xfe,0x31,0x32,0x59,0x27,0x31,0x51,0x1f,0x39,0x39,0x1,0xa5,0x53,0x4f,0x31,0x80,0x4c,0x2e,0x67,0x37,0x1,0x36,0xfc,0x5f,0x0,0x1,0x0,0x89,0x0,0x0,0x4,0x29,0x4,0x3a,0x0,0xc,0x0,0x0,0x65,0x3,0x23,0x11,0x33,0x11,0x13,0x33,0x13,0x11,0x33,0x11,0x23,0x2,0x5c,0xe4,0xef,0xb9,0xda,0x80,0xd4,0xb9,0xe7,0xf5,0x3,0x45,0xfb,0xc6,0x2,0xb3,0xfd,0x4d,0x2,0x9b,0xfd,0x65,0x4,0x3a,0x0,0x1,0x0,0xa5,0x0,0x0,0x4,0x27,0x4,0x3a,0x0,0xb,0x0,0x0,0x61,0x11,0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x4,0x27,0xb9,0xfd,0xf0,0xb9,0xb9,0x2,0x10,0x4,0x3a,0xfe,0x2b,0x1,0xd5,0xfb,0xc6,0x1,0xce,0xfe,0x32,0x0,0x0,0x1,0x0,0xa5,0x0,0x0,0x4,0x27,0x4,0x3a,0x0,0x7,0x0,0x0,0x61,0x11,0x21,0x11,0x33,0x11,0x21,0x11,0x4,0x27,0xfc,0x7e,0xb9,0x2,0x10,0x4,0x3a,0xfb,0xc6,0x3,0xa1,0xfc,0x5f,0x0,0x0,0x1,0x0,0x68,0x0,0x0,0x4,0x7b,0x4,0x3a,0x0,0x7,0x0,0x0,0x41,0x35,0x21,0x15,0x21,0x11,0x33,0x11,0x4,0x7b,0xfb,0xed,0x1,0xa9,0xba,0x3,0xa4,0x96,0x96,0xfc,0x5c,0x3,0xa4,0x0,0x0,0x3,0x0,0x7a,0xfe,0x60,0x4,0x52,0x6,0x0,0x0,0x1f,0x0,0x2d,0x0,0x3b,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x11,0x23,0x11,0x6,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x11,0x26,0x26,0x27,0x26,0x26,0x25,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x11,0x16,0x16,0x17,0x16,0x16,0x7a,0x36,0x34,0x33,0x94,0x5d,0xb9,0x5e,0x95,0x34,0x33,0x37,0x36,0x34,0x34,0x95,0x5e,0xb9,0x5d,0x94,0x33,0x34,0x36,0xb9,0x1b,0x1b,0x1a,0x50,0x35,0x36,0x50,0x1a,0x1b,0x1a,0x2,0x66,0x1b,0x1b,0x1b,0x51,0x36,0x36,0x51,0x1b,0x1b,0x1b,0x2,0x27,0x16,0x68,0xb7,0x47,0x47,0x5f,0x10,0xfe,0x6b,0x1,0x94,0xf,0x5f,0x48,0x47,0xb7,0x69,0x16,0x68,0xb8,0x48,0x47,0x60,0x10,0x1,0xba,0xfe,0x46,0x11,0x5f,0x47,0x48,0xb8,0x7e,0x16,0x42,0x7b,0x33,0x33,0x4b,0x12,0xfc,0xea,0x12,0x4a,0x33,0x33,0x7b,0x59,0x16,0x44,0x7c,0x33,0x33,0x4a,0x12,0x3,0x18,0x12,0x4a,0x33,0x33,0x7c,0x0,0x0,0x1,0x0,0xaa,0xfe,0xbf,0x4,0x90,0x4,0x3a,0x0,0xb,0x0,0x0,0x53,0x11,0x21,0x11,0x33,0x13,0x23,0x11,0x23,0x11,0x21,0x11,0xaa,0x3,0x2e,0xa6,0x12,0x81,0xba,0xfe,0xe,0x4,0x3a,0xfb,0xc6,0xfe,0xbf,0x1,0xd8,0x3,0xa3,0xfc,0x5d,0x3,0xa3,0x0,0x0,0x1,0x0,0x8d,0x0,0x0,0x4,0x27,0x4,0x3a,0x0,0x1c,0x0,0x0,0x61,0x11,0x23,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x11,0x4,0x27,0xb9,0x1e,0x3d,0x1f,0x2a,0x58,0x2e,0x41,0x64,0x20,0x1b,0x1e,0xb9,0x3e,0x3a,0x39,0xa2,0x64,0x55,0x91,0x44,0x4,0x3a,0xfd,0xe9,0x7,0xc,0x4,0x6,0x6,0x22,0x24,0x1f,0x5c,0x3e,0x1,0x3b,0xfe,0xc5,0x67,0x99,0x32,0x33,0x32,0x12,0x11,0xfe,0x75,0x0,0x0,0x1,0x0,0x81,0x0,0x0,0x4,0x4c,0x4,0x3a,0x0,0xb,0x0,0x0,0x41,0x23,0x11,0x21,0x11,0x23,0x11,0x23,0x11,0x23,0x11,0x23,0x1,0x3a,0xb9,0x3,0xcb,0xb9,0xd0,0xb9,0xd0,0x4,0x3a,0xfb,0xc6,0x4,0x3a,0xfc,0x5d,0x3,0xa3,0xfc,0x5d,0x0,0x0,0x1,0x0,0x76,0xfe,0xbf,0x4,0x98,0x4,0x3a,0x0,0xf,0x0,0x0,0x41,0x23,0x11,0x21,0x11,0x33,0x13,0x23,0x11,0x23,0x11,0x7,0x11,0x23,0x11,0x23,0x1,0x2f,0xb9,0x3,0x6b,0xa5,0x12,0x57,0xb9,0xd0,0xb9,0xd0,0x4,0x3a,0xfb,0xc6,0xfe,0xbf,0x1,0xd9,0x3,0xa2,0xfc,0x5e,0x1,0x3,0xa3,0xfc,0x5d,0x0,0x0,0x2,0x0,0x39,0x0,0x0,0x4,0x77,0x4,0x3a,0x0,0x12,0x0,0x21,0x0,0x0,0x61,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x11,0x21,0x15,0x21,0x13,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x1,0x65,0x1,0x81,0x60,0x96,0x33,0x33,0x35,0x35,0x33,0x33,0x96,0x60,0xc8,0xfe,0x1b,0x1,0x2c,0xb9,0xc8,0x39,0x52,0x1a,0x1a,0x18,0x18,0x1a,0x1a,0x51,0x3a,0xc8,0x35,0x2e,0x2d,0x7c,0x48,0x48,0x7a,0x2c,0x2c,0x32,0x1,0x9a,0x98,0xfe,0x67,0x22,0x1a,0x1b,0x43,0x22,0x23,0x42,0x19,0x1a,0x1e,0x0,0x0,0x3,0x0,0x90,0x0,0x0,0x4,0x3f,0x4,0x3a,0x0,0x10,0x0,0x14,0x0,0x23,0x0,0x0,0x41,0x11,0x23,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x1,0x11,0x23,0x11,0x1,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x1,0x49,0xb9,0x1,0x1c,0x58,0x86,0x2e,0x2d,0x2f,0x2f,0x2d,0x2e,0x87,0x57,0x2,0x93,0xb9,0xfd,0xc3,0x63,0x2f,0x42,0x15,0x14,0x13,0x13,0x14,0x15,0x42,0x2f,0x63,0x2,0xa0,0x1,0x9a,0xfb,0xc6,0x35,0x2e,0x2e,0x7c,0x47,0x47,0x7a,0x2d,0x2c,0x32,0xfd,0x60,0x4,0x3a,0xfb,0xc6,0x2,0x9,0x22,0x1b,0x1b,0x43,0x21,0x23,0x41,0x19,0x1a,0x1f,0x0,0x2,0x0,0xa5,0x0,0x0,0x4,0x40,0x4,0x3a,0x0,0x10,0x0,0x1f,0x0,0x0,0x41,0x11,0x23,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x5,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x21,0x1,0x5e,0xb9,0x2,0x4,0x61,0x98,0x34,0x34,0x36,0x37,0x34,0x34,0x97,0x61,0xfe,0xb5,0x1,0x4b,0x3a,0x53,0x1b,0x1b,0x1a,0x19,0x1b,0x1b,0x54,0x3a,0xfe,0xb5,0x2,0xa0,0x1,0x9a,0xfb,0xc6,0x34,0x2e,0x2d,0x7d,0x48,0x49,0x7a,0x2c,0x2c,0x31,0x97,0x21,0x1a,0x1b,0x43,0x23,0x24,0x42,0x19,0x19,0x1e,0x0,0x1,0x0,0x81,0xff,0xec,0x4,0x3a,0x4,0x4e,0x0,0x35,0x0,0x0,0x41,0x32,0x16,0x17,0x16,0x16,0x17,0x21,0x15,0x21,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x33,0x34,0x36,0x37,0x36,0x36,0x2,0x3c,0x51,0x74,0x26,0x26,0x2a,0x6,0xfe,0x55,0x1,0xad,0x5,0x27,0x26,0x27,0x76,0x54,0x38,0x61,0x24,0x24,0x2a,0xb0,0x43,0x3b,0x3b,0xa2,0x60,0x7f,0xbf,0x40,0x40,0x40,0x40,0x3f,0x40,0xc0,0x7f,0x56,0xa0,0x3d,0x3e,0x4a,0xb0,0x2e,0x26,0x25,0x60,0x3,0xb6,0x36,0x2d,0x2d,0x74,0x3f,0x98,0x41,0x7c,0x30,0x31,0x3b,0x26,0x21,0x20,0x58,0x32,0x53,0x8f,0x34,0x35,0x3c,0x57,0x4b,0x4a,0xc4,0x6c,0x2a,0x6c,0xc4,0x4a,0x4a,0x58,0x3b,0x32,0x32,0x84,0x49,0x2e,0x4d,0x1d,0x1c,0x20,0x0,0x0,0x2,0x0,0x71,0xff,0xec,0x4,0x81,0x4,0x4e,0x0,0x1f,0x0,0x39,0x0,0x0,0x41,0x11,0x23,0x11,0x33,0x11,0x33,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x1,0x2a,0xb9,0xb9,0x81,0x6,0x31,0x2d,0x2d,0x83,0x57,0x5d,0x89,0x2d,0x2c,0x2c,0x2c,0x2d,0x2d,0x8a,0x5d,0x55,0x80,0x2d,0x2d,0x32,0x7,0xb8,0x10,0x14,0x14,0x44,0x34,0x35,0x45,0x15,0x14,0x11,0x11,0x14,0x14,0x45,0x34,0x35,0x44,0x14,0x15,0x10,0x2,0x6f,0x1,0xcb,0xfb,0xc6,0x1,0xd7,0x68,0xb4,0x42,0x42,0x4b,0x56,0x4a,0x4a,0xc9,0x72,0x16,0x72,0xc9,0x4b,0x4b,0x56,0x49,0x40,0x41,0xaf,0x66,0x5e,0x16,0x4e,0x90,0x38,0x37,0x42,0x42,0x37,0x38,0x90,0x4e,0x16,0x4e,0x91,0x37,0x37,0x42,0x42,0x37,0x37,0x91,0x0,0x0,0x2,0x0,0x4f,0x0,0x0,0x4,0x21,0x4,0x3a,0x0,0x10,0x0,0x1f,0x0,0x0,0x41,0x21,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x1,0x33,0x1,0x21,0x11,0x33,0x1,0x34,0x36,0x37,0x36,0x36,0x33,0x21,0x11,0x21,0x22,0x26,0x27,0x26,0x26,0x4,0x21,0xfe,0x4,0x60,0x9a,0x35,0x35,0x39,0x70,0x68,0xfe,0xef,0xc8,0x1,0x1,0x1,0x50,0xb9,0xfd,0x21,0x1c,0x1c,0x1c,0x56,0x39,0x1,0x43,0xfe,0xa6,0x35,0x4c,0x19,0x1a,0x18,0x4,0x3a,0x32,0x2b,0x2c,0x79,0x48,0x6a,0x9f,0x26,0xfe,0x3f,0x1,0xa5,0xfe,0x5b,0x2,0xee,0x23,0x41,0x1a,0x19,0x1f,0xfe,0x99,0x1e,0x19,0x18,0x40,0x0,0x1,0xff,0xe9,0xfe,0x4b,0x4,0x25,0x6,0x0,0x0,0x39,0x0,0x0,0x41,0x35,0x21,0x35,0x23,0x15,0x23,0x15,0x33,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x36,0x16,0x17,0x16,0x16,0x15,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x7,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x3,0x34,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,0x6,0x6,0x7,0x11,0x2,0x66,0xfe,0xf9,0xb9,0xbd,0xbd,0xb9,0x17,0x3e,0x24,0x23,0x50,0x2b,0x3d,0x5d,0x1f,0x1e,0x1e,0x16,0x15,0x11,0x30,0x1d,0x10,0x42,0x13,0xf,0x1e,0x36,0x20,0x4c,0x78,0x29,0x2a,0x2c,0x1,0x35,0x31,0x31,0x8b,0x55,0x3b,0x69,0x2c,0x25,0x3f,0x1a,0x4,0xb9,0x97,0xb0,0xb0,0x97,0xfb,0x47,0x3,0x12,0x25,0x3c,0x15,0x13,0x16,0x1,0x22,0x23,0x20,0x61,0x41,0xfc,0xfc,0x33,0x4e,0x1a,0x14,0x15,0x7,0x6,0x94,0xa,0x7,0x2c,0x2b,0x2c,0x84,0x55,0x3,0x2,0x6d,0x9f,0x34,0x34,0x31,0x1,0x1e,0x1b,0x17,0x3e,0x26,0x1,0x20,0x0,0x0,0x1,0x0,0x8f,0xff,0xec,0x4,0x33,0x4,0x4e,0x0,0x35,0x0,0x0,0x65,0x22,0x26,0x27,0x26,0x26,0x27,0x21,0x35,0x21,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x23,0x6,0x6,0x7,0x6,0x6,0x2,0x7b,0x4e,0x6f,0x24,0x24,0x26,0x5,0x1,0x9a,0xfe,0x66,0x5,0x26,0x25,0x24,0x6e,0x4e,0x38,0x61,0x23,0x23,0x29,0x1,0xaf,0x42,0x3a,0x3b,0xa1,0x60,0x7b,0xb8,0x3d,0x3e,0x3e,0x3e,0x3e,0x3d,0xb8,0x7b,0x56,0x9e,0x3d,0x3d,0x49,0x1,0xaf,0x1,0x2d,0x25,0x25,0x5f,0x82,0x38,0x2f,0x2e,0x79,0x40,0x98,0x3f,0x79,0x2f,0x2e,0x39,0x26,0x21,0x21,0x57,0x31,0x52,0x90,0x35,0x34,0x3d,0x58,0x4a,0x4b,0xc4,0x6b,0x2a,0x6c,0xc3,0x4a,0x4b,0x58,0x3b,0x32,0x31,0x83,0x48,0x2d,0x4d,0x1c,0x1d,0x20,0x0,0x0,0x2,0x0,0x26,0x0,0x0,0x4,0xb0,0x4,0x3a,0x0,0x28,0x0,0x37,0x0,0x0,0x41,0x21,0x11,0x14,0x6,0x15,0x6,0x6,0x7,0x6,0x6,0x23,0x7,0x7,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x11,0x33,0x11,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x13,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x11,0x33,0x32,0x16,0x17,0x16,0x16,0x3,0x8,0xfd,0xcc,0x1,0x2,0xe,0xc,0x10,0x36,0x29,0x1e,0x4,0x2d,0x5a,0x78,0x25,0x1d,0x20,0x4,0x1,0x1,0xc2,0xfb,0x57,0x86,0x2d,0x2d,0x2f,0x2f,0x2d,0x2d,0x86,0x57,0x42,0xed,0x12,0x14,0x15,0x41,0x2f,0x42,0x42,0x2f,0x41,0x15,0x14,0x12,0x4,0x3a,0xfe,0x31,0x19,0x30,0x16,0x4e,0x7c,0x2e,0x3b,0x3d,0x1,0x9b,0x54,0x50,0x41,0xb1,0x6e,0x18,0x34,0x1b,0x1,0x36,0xfc,0x5f,0x35,0x2e,0x2d,0x7b,0x47,0x48,0x79,0x2d,0x2c,0x32,0xfe,0xb6,0x22,0x44,0x1b,0x1b,0x23,0x1,0x71,0x1f,0x19,0x19,0x40,0x0,0x0,0x2,0x0,0x82,0x0,0x0,0x4,0x92,0x4,0x3a,0x0,0x18,0x0,0x27,0x0,0x0,0x41,0x11,0x23,0x11,0x33,0x11,0x33,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x11,0x23,0x11,0x17,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x1,0x3b,0xb9,0xb9,0xf9,0x1,0xc,0x52,0x7f,0x2b,0x2a,0x2c,0x2c,0x2a,0x2b,0x7f,0x52,0x53,0xb9,0xb9,0x53,0x2a,0x3a,0x12,0x12,0x10,0x10,0x12,0x12,0x3a,0x2a,0x53,0x2,0xa1,0x1,0x99,0xfb,0xc6,0x2,0xa,0xfd,0xf6,0x35,0x2e,0x2d,0x7b,0x47,0x47,0x79,0x2d,0x2c,0x32,0x1,0x9d,0xfe,0x67,0x9b,0x1f,0x19,0x19,0x40,0x21,0x22,0x44,0x1b,0x1b,0x23,0x0,0x0,0x1,0x0,0x1c,0x0,0x0,0x4,0x2b,0x6,0x0,0x0,0x27,0x0,0x0,0x41,0x35,0x21,0x35,0x23,0x15,0x23,0x15,0x33,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x36,0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,0x6,0x6,0x7,0x11,0x2,0x99,0xfe,0xcd,0xb9,0x91,0x91,0xb9,0x18,0x42,0x27,0x21,0x4c,0x29,0x3b,0x5c,0x1f,0x1f,0x20,0xb9,0x35,0x31,0x31,0x8b,0x55,0x3c,0x6c,0x2e,0x23,0x3c,0x19,0x4,0xbe,0x97,0xab,0xab,0x97,0xfb,0x42,0x3,0x12,0x27,0x3e,0x15,0x12,0x13,0x1,0x20,0x21,0x20,0x64,0x42,0xfd,0x55,0x2,0xa9,0x6d,0x9f,0x34,0x34,0x31,0x1,0x1f,0x1e,0x16,0x3c,0x25,0x1,0x25,0x0,0x0,0x1,0x0,0xa5,0xfe,0x9c,0x4,0x27,0x4,0x3a,0x0,0xb,0x0,0x0,0x41,0x23,0x11,0x21,0x11,0x33,0x11,0x21,0x11,0x23,0x11,0x21,0x1,0x5e,0xb9,0x1,0x67,0xb9,0x1,0x62,0xb9,0xfd,0xf0,0x4,0x3a,0xfb,0xc6,0xfe,0x9c,0x1,0x64,0x4,0x3a,0xfc,0x5d,0x0,0x0,0x1,0x0,0x6b,0xff,0xec,0x4,0x7f,0x5,0xb0,0x0,0x38,0x0,0x0,0x41,0x23,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x3,0x23,0x3,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x4,0x7e,0xb8,0x1,0x10,0x10,0xe,0x27,0x19,0x19,0x2a,0x10,0x17,0x18,0xbf,0x1,0x19,0x17,0xf,0x2a,0x18,0x17,0x27,0xd,0x12,0x12,0x1,0xb8,0x1,0x2b,0x27,0x27,0x6d,0x43,0x2a,0x4b,0x1e,0x18,0x28,0xe,0xc,0x20,0x14,0x20,0x52,0x30,0x42,0x6d,0x27,0x27,0x2b,0x5,0xb0,0xfb,0x8e,0x2e,0x49,0x18,0x16,0x17,0x12,0x10,0x18,0x4e,0x34,0x4,0x72,0xfb,0x8e,0x34,0x4f,0x18,0x10,0x11,0x15,0x13,0x18,0x4b,0x31,0x4,0x72,0xfb,0x8e,0x52,0x7e,0x2b,0x2b,0x2c,0x17,0x16,0x13,0x33,0x20,0x1c,0x2d,0x12,0x1c,0x1c,0x2c,0x2b,0x2b,0x7e,0x52,0x0,0x1,0x0,0x5f,0xff,0xeb,0x4,0x7a,0x4,0x3b,0x0,0x38,0x0,0x0,0x41,0x23,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x3,0x23,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x3,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x4,0x7a,0xb9,0xf,0xe,0xf,0x2a,0x1b,0x1a,0x2a,0x10,0x17,0x18,0x1,0xbf,0x16,0x13,0x11,0x2e,0x1b,0x19,0x28,0xe,0x11,0x11,0xb9,0x1,0x2c,0x27,0x27,0x6e,0x43,0x29,0x47,0x1d,0x1a,0x2c,0xf,0xd,0x24,0x15,0x1f,0x50,0x2f,0x42,0x6e,0x28,0x27,0x2b,0x4,0x3b,0xfd,0x1,0x2b,0x45,0x17,0x19,0x1a,0x12,0x11,0x17,0x4d,0x33,0x2,0xff,0xfd,0x1,0x30,0x49,0x18,0x14,0x15,0x16,0x15,0x18,0x48,0x2f,0x2,0xff,0xfd,0x1,0x52,0x7e,0x2a,0x2b,0x2c,0x14,0x14,0x13,0x35,0x23,0x1d,0x30,0x11,0x1b,0x1a,0x2c,0x2b,0x2a,0x7e,0x52,0x0,0x2,0x0,0x1c,0x0,0x0,0x4,0x3c,0x6,0x18,0x0,0x18,0x0,0x27,0x0,0x0,0x41,0x35,0x21,0x11,0x23,0x11,0x23,0x15,0x33,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x21,0x11,0x11,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x21,0x2,0xd7,0xfe,0xbe,0xb9,0xc0,0xc0,0x1,0xcc,0x61,0x96,0x34,0x33,0x36,0x36,0x33,0x34,0x96,0x61,0xfe,0xed,0x1,0x13,0x3a,0x52,0x1b,0x1a,0x19,0x19,0x1a,0x1b,0x52,0x3a,0xfe,0xed,0x4,0x34,0x98,0x1,0x4c,0xfe,0xb4,0x98,0xfb,0xcc,0x34,0x2e,0x2e,0x7c,0x48,0x48,0x7a,0x2d,0x2c,0x31,0x1,0x94,0xfd,0xd5,0x21,0x1a,0x1b,0x44,0x22,0x24,0x41,0x19,0x1a,0x1e,0x0,0x0,0x1,0x0,0x7d,0xff,0xed,0x4,0x94,0x5,0xc5,0x0,0x54,0x0,0x0,0x41,0x11,0x23,0x11,0x33,0x11,0x33,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x23,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x21,0x35,0x21,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x33,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x1,0x35,0xb8,0xb8,0x96,0xe,0xd,0xf,0x30,0x20,0x2e,0x7d,0x4c,0x35,0x5a,0x24,0x2e,0x42,0x16,0xc,0xf,0x4,0xa7,0x3,0x9,0x6,0xa,0x22,0x15,0x12,0x2f,0x1d,0x23,0x39,0x14,0x14,0x1d,0x8,0x8,0x7,0x1,0x1a,0xfe,0xe6,0x7,0x7,0xa,0x20,0x18,0x14,0x34,0x20,0x23,0x36,0x13,0x10,0x19,0x9,0x7,0x9,0x3,0xa7,0x7,0x31,0x2a,0x2b,0x7a,0x51,0x3d,0x69,0x2a,0x2e,0x47,0x13,0xc,0xd,0x3,0x40,0x2,0x70,0xfa,0x50,0x2,0xa9,0x9b,0x43,0x78,0x33,0x3c,0x62,0x25,0x35,0x3b,0x1b,0x1a,0x1f,0x65,0x3f,0x25,0x53,0x2c,0x1f,0x38,0x19,0x28,0x3c,0x13,0xf,0x10,0x20,0x1b,0x1c,0x4b,0x2f,0x27,0x5e,0x35,0x9b,0x97,0x65,0x34,0x5b,0x27,0x35,0x51,0x1d,0x17,0x19,0x18,0x17,0x14,0x32,0x20,0x1a,0x3c,0x22,0x60,0x9c,0x37,0x36,0x3b,0x25,0x24,0x26,0x7c,0x51,0x32,0x74,0x40,0x63,0x0,0x0,0x1,0x0,0x9b,0xff,0xec,0x4,0x89,0x4,0x4e,0x0,0x49,0x0,0x0,0x41,0x35,0x21,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x23,0x11,0x23,0x11,0x33,0x11,0x33,0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x23,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x35,0x3,0xc7,0xfe,0xd5,0x1,0x7,0x7,0xa,0x23,0x19,0x13,0x2f,0x1c,0x21,0x33,0x12,0x12,0x13,0xaf,0x2d,0x29,0x29,0x74,0x47,0x3c,0x65,0x28,0x31,0x44,0x14,0xc,0xd,0x1,0x8f,0xb9,0xb9,0x8f,0x1,0xd,0xb,0x16,0x52,0x3a,0x24,0x59,0x34,0x40,0x73,0x2b,0x2a,0x32,0xaf,0x1,0x15,0x12,0x13,0x32,0x1e,0x1b,0x2d,0x12,0x1a,0x24,0xc,0x6,0x8,0x1,0x1,0xd0,0x97,0x25,0x49,0x22,0x2f,0x4f,0x19,0x13,0x15,0x21,0x1c,0x1c,0x4a,0x28,0x4a,0x81,0x30,0x30,0x38,0x24,0x20,0x29,0x74,0x48,0x2b,0x60,0x33,0x1,0xd3,0xfb,0xc6,0x1,0xd0,0x2,0x31,0x5c,0x2a,0x50,0x82,0x26,0x19,0x1a,0x35,0x2d,0x2d,0x75,0x40,0x24,0x3f,0x18,0x18,0x1b,0x12,0x11,0x1a,0x52,0x32,0x20,0x47,0x24,0x2,0x0,0x2,0x0,0x27,0x0,0x0,0x4,0xb2,0x5,0xb0,0x0,0xb,0x0,0x10,0x0,0x0,0x41,0x13,0x33,0x1,0x23,0x1,0x33,0x13,0x33,0x11,0x33,0x11,0x25,0x13,0x37,0x17,0x13,0x3,0x65,0x90,0xbd,0xfe,0xf,0xa0,0xfe,0x6,0xbd,0x93,0x94,0xb9,0xfe,0xe8,0xb9,0xb,0xa,0xb6,0x1,0xb8,0xfe,0x48,0x5,0xb0,0xfa,0x50,0x1,0xb8,0xfe,0x48,0x1,0xb8,0xa1,0x2,0x2c,0x1f,0x20,0xfd,0xd5,0x0,0x0,0x2,0x0,0x57,0x0,0x0,0x4,0x81,0x4,0x3a,0x0,0xb,0x0,0x10,0x0,0x0,0x41,0x13,0x33,0x1,0x23,0x1,0x33,0x13,0x33,0x11,0x33,0x11,0x25,0x13,0x37,0x17,0x13,0x3,0x4a,0x79,0xbe,0xfe,0x39,0x9f,0xfe,0x3c,0xbd,0x76,0x87,0xb9,0xfe,0xfd,0x89,0x19,0x18,0x8b,0x1,0x29,0xfe,0xd7,0x4,0x3a,0xfb,0xc6,0x1,0x29,0xfe,0xd7,0x1,0x29,0x98,0x1,0x57,0x52,0x52,0xfe,0xa9,0x0,0x0,0x2,0x0,0x71,0x0,0x0,0x4,0xbc,0x5,0xb0,0x0,0x13,0x0,0x18,0x0,0x0,0x41,0x13,0x33,0x1,0x23,0x3,0x23,0x11,0x23,0x11,0x33,0x11,0x33,0x3,0x33,0x13,0x33,0x11,0x33,0x11,0x27,0x13,0x37,0x17,0x13,0x3,0xa1,0x5f,0xbc,0xfe,0xae,0x9f,0xd0,0xd1,0xb9,0xb9,0xa8,0x75,0xbd,0x68,0x45,0x94,0xb6,0x6b,0x8,0x7,0x61,0x1,0xd4,0xfe,0x2c,0x5,0xb0,0xfc,0xc5,0x3,0x3b,0xfa,0x50,0x1,0xd4,0xfe,0x2c,0x1,0xd4,0xfe,0x2c,0x1,0xd4,0xa1,0x1,0xe0,0x24,0x24,0xfe,0x20,0x0,0x2,0x0,0x70,0x0,0x0,0x4,0xbd,0x4,0x3a,0x0,0x13,0x0,0x18,0x0,0x0,0x41,0x13,0x33,0x1,0x23,0x3,0x23,0x11,0x23,0x11,0x33,0x11,0x33,0x3,0x33,0x13,0x33,0x11,0x33,0x11,0x27,0x13,0x37,0x17,0x13,0x3,0xab,0x55,0xbd,0xfe,0xad,0x9f,0xd5,0xcd,0xb9,0xb9,0x97,0x63,0xbd,0x5d,0x4f,0x9d,0xb9,0x66,0x8,0x8,0x5d,0x1,0x25,0xfe,0xdb,0x4,0x3a,0xfd,0x8c,0x2,0x74,0xfb,0xc6,0x1,0x25,0xfe,0xdb,0x1,0x25,0xfe,0xdb,0x1,0x25,0xa1,0x1,0x41,0x1b,0x1b,0xfe,0xbf,0x0,0x2,0x0,0x55,0x0,0x0,0x4,0x85,0x5,0xb0,0x0,0x27,0x0,0x2c,0x0,0x0,0x73,0x33,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x11,0x33,0x11,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x27,0x23,0x1,0x21,0x1,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x1,0x3,0x7,0x27,0x3,0x56,0xb9,0x15,0x16,0x15,0x43,0x2e,0x53,0xb9,0x4d,0x2e,0x43,0x16,0x16,0x16,0xb9,0x30,0x2e,0x2f,0x86,0x56,0x1,0x1,0x36,0xfc,0x21,0x1,0x51,0x3,0x56,0x87,0x2e,0x2f,0x31,0x2,0xe7,0xca,0x2,0x2,0xe0,0x1,0xab,0x3d,0x52,0x19,0x19,0x16,0xfd,0x7e,0x2,0x82,0x16,0x19,0x19,0x52,0x3d,0xfe,0x55,0x1,0xab,0x62,0x8a,0x2d,0x2c,0x29,0x1,0x2,0x96,0xfd,0x6a,0x29,0x2c,0x2d,0x8b,0x62,0x3,0x6d,0xfe,0x29,0x3,0x3,0x1,0xd7,0x0,0x2,0x0,0x69,0x0,0x0,0x4,0x59,0x4,0x3a,0x0,0x29,0x0,0x2f,0x0,0x0,0x73,0x33,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x17,0x11,0x33,0x11,0x37,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x17,0x33,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x23,0x1,0x21,0x1,0x23,0x6,0x6,0x7,0x6,0x6,0x15,0x1,0x3,0x7,0x23,0x27,0x3,0x69,0xb9,0x14,0x14,0x14,0x3d,0x2a,0x3d,0x5,0xba,0x8,0x33,0x2a,0x3d,0x14,0x14,0x14,0x1,0xb9,0x2a,0x28,0x28,0x72,0x47,0x3,0x1,0x1c,0xfc,0x50,0x1,0x1b,0x3,0x49,0x77,0x29,0x2a,0x2b,0x2,0xb2,0xae,0x4,0x5,0x4,0xaf,0xdb,0x43,0x59,0x1b,0x1b,0x17,0x9,0xfe,0x45,0x1,0xbb,0x9,0x17,0x1b,0x1b,0x59,0x43,0xdb,0xdb,0x61,0x8c,0x2f,0x2e,0x30,0x5,0x1,0xe0,0xfe,0x21,0x3,0x2f,0x2e,0x2e,0x8f,0x63,0x2,0xc7,0xfe,0xc1,0x7,0x7,0x1,0x3f,0x0,0x0,0x2,0x0,0x50,0x0,0x0,0x4,0x87,0x5,0xb0,0x0,0x2d,0x0,0x32,0x0,0x0,0x61,0x33,0x11,0x34,0x36,0x37,0x36,0x36,0x37,0x33,0x11,0x33,0x11,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x13,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x13,0x21,0x13,0x21,0x11,0x23,0x11,0x33,0x11,0x33,0x6,0x6,0x7,0x6,0x6,0x15,0x1,0x3,0x7,0x27,0x3,0x1,0x83,0x99,0xb,0xb,0xd,0x29,0x1e,0x34,0x99,0x2a,0x1c,0x29,0xe,0xf,0xe,0x1,0x99,0x21,0x22,0x26,0x61,0x2d,0x1,0xeb,0xfd,0x17,0xeb,0xfe,0x7f,0xab,0xab,0x9b,0x5,0x7,0x2,0x3,0x3,0x2,0x5,0x7f,0x2,0x2,0x7f,0x1,0xf4,0x23,0x33,0x10,0x13,0x12,0x1,0xfd,0x80,0x2,0x80,0xd,0xf,0x10,0x38,0x28,0xfe,0xc,0x1,0xf4,0x4d,0x6d,0x22,0x26,0x22,0x2,0x98,0xfd,0x68,0x2,0x98,0xfa,0x50,0x2,0x80,0xe,0x1d,0x10,0x12,0x29,0x16,0x3,0x24,0xfe,0x6c,0x7,0x7,0x1,0x94,0x0,0x0,0x2,0x0,0x51,0x0,0x0,0x4,0x86,0x4,0x3a,0x0,0x2f,0x0,0x34,0x0,0x0,0x73,0x33,0x11,0x33,0x6,0x6,0x7,0x6,0x6,0x15,0x13,0x33,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x17,0x11,0x33,0x11,0x37,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x13,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x27,0x23,0x13,0x21,0x13,0x21,0x11,0x23,0x5,0x3,0x7,0x27,0x3,0x51,0xab,0x9c,0x4,0x8,0x2,0x4,0x3,0x1,0x99,0xc,0xc,0xe,0x2b,0x1e,0x26,0x8,0x9a,0x7,0x1d,0x20,0x2c,0xe,0xd,0xd,0x1,0x99,0x22,0x21,0x1b,0x4e,0x30,0x3,0xd3,0xfd,0x22,0xd2,0xfe,0x8e,0xab,0x3,0x36,0x7b,0x1,0x1,0x7b,0x1,0xbb,0xd,0x1d,0xf,0x13,0x29,0x17,0xfe,0xd1,0x1,0x2f,0x23,0x33,0x11,0x13,0x12,0x5,0xfe,0x4a,0x1,0xb7,0x4,0xf,0x11,0x10,0x36,0x26,0xfe,0xd1,0x1,0x2f,0x4c,0x6e,0x23,0x1e,0x21,0x5,0x1,0xea,0xfe,0x19,0x1,0xe7,0x8f,0xfe,0xc3,0x2,0x2,0x1,0x3d,0x0,0x2,0x0,0xca,0xfe,0x46,0x4,0x24,0x7,0x74,0x0,0x5c,0x0,0x65,0x0,0x0,0x41,0x23,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x37,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x21,0x15,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x3,0x27,0x23,0x15,0x17,0x33,0x37,0x35,0x23,0x2,0x1c,0x8d,0x8d,0x4f,0x7c,0x2b,0x2b,0x2d,0xf,0xf,0xe,0x27,0x18,0x25,0x5f,0x37,0x2e,0x4b,0x7a,0x2b,0x2c,0x30,0x1,0x2f,0x26,0x25,0x5d,0x2f,0x4a,0x17,0x37,0x19,0x19,0x21,0xf,0x10,0x12,0x3b,0x29,0x35,0x57,0x98,0x3c,0x21,0x38,0x16,0x22,0x24,0x30,0x2d,0x21,0x5a,0x36,0x39,0x5c,0x20,0x20,0x23,0x21,0x1f,0x1e,0x55,0x35,0x35,0x7d,0x44,0xfe,0xce,0x1,0x32,0x48,0x6d,0x25,0x25,0x25,0xe,0xe,0x11,0x41,0x2c,0x20,0x4f,0xf,0x97,0x9d,0xfb,0x72,0xfe,0xa0,0x3,0x37,0x97,0x21,0x21,0x21,0x66,0x45,0x23,0x40,0x1c,0x1a,0x2c,0x12,0x1a,0x1d,0x1e,0x1f,0x1f,0x60,0x43,0x3c,0x64,0x28,0x28,0x3b,0x14,0x7c,0xa,0x1f,0x16,0x16,0x3d,0x28,0x18,0x28,0xf,0x10,0x12,0x28,0x26,0x15,0x36,0x1f,0x31,0x79,0x47,0x4c,0x7a,0x2d,0x22,0x32,0x11,0x16,0x40,0x28,0x28,0x5e,0x35,0x3e,0x6b,0x2c,0x2a,0x45,0x16,0x17,0x18,0x98,0x24,0x20,0x20,0x57,0x32,0x23,0x3c,0x1a,0x21,0x32,0x10,0xb,0xc,0x3,0xa4,0x98,0x15,0xf5,0xf8,0x12,0x0,0x2,0x0,0xde,0xfe,0x46,0x4,0x9,0x6,0x1e,0x0,0x62,0x0,0x6b,0x0,0x0,0x41,0x23,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x37,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x21,0x15,0x21,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x3,0x27,0x23,0x15,0x17,0x33,0x37,0x35,0x23,0x2,0x2c,0x8d,0x8d,0x29,0x49,0x1e,0x25,0x37,0x12,0x13,0x13,0xc,0xc,0x13,0x3e,0x28,0x18,0x36,0x1d,0x29,0x4b,0x7b,0x2b,0x2c,0x30,0x1,0x30,0x26,0x25,0x5d,0x2e,0x4b,0x17,0x37,0x19,0x19,0x21,0xe,0x10,0x12,0x3b,0x2a,0x30,0x30,0x5b,0x28,0x45,0x6e,0x20,0x17,0x18,0x23,0x21,0x1b,0x4c,0x2e,0x27,0x40,0x18,0x21,0x23,0x1b,0x1b,0x22,0x6e,0x48,0x26,0x54,0x2b,0xfe,0xd4,0x1,0x2c,0x23,0x3f,0x1a,0x29,0x38,0xe,0x7,0x7,0x1f,0x21,0xf,0x27,0x17,0x1b,0x40,0xd,0x97,0x9d,0xfb,0x72,0xfe,0xa0,0x2,0x69,0x97,0x8,0x7,0x9,0x1a,0x14,0x12,0x31,0x1d,0x15,0x27,0x11,0x1b,0x28,0xb,0x6,0x7,0x1e,0x1f,0x1f,0x60,0x43,0x3c,0x64,0x28,0x28,0x3b,0x14,0x7c,0xa,0x1f,0x16,0x16,0x3d,0x28,0x18,0x27,0xf,0x11,0x12,0xc,0xc,0x13,0x48,0x31,0x21,0x50,0x2e,0x31,0x51,0x1f,0x1a,0x28,0xe,0xf,0x27,0x17,0x1f,0x4d,0x2b,0x2f,0x51,0x21,0x2c,0x44,0x11,0x9,0xa,0x99,0x8,0x8,0xd,0x28,0x1b,0xc,0x1d,0xf,0x25,0x3c,0x14,0xa,0xf,0x5,0x7,0x6,0x3,0x1d,0x98,0x15,0xf5,0xf8,0x12,0x0,0x3,0x0,0x63,0xff,0xec,0x4,0x5a,0x5,0xc4,0x0,0x25,0x0,0x3a,0x0,0x4f,0x0,0x0,0x41,0x35,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x25,0x35,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x1d,0x2,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x35,0x4,0x5a,0x1,0x19,0x1a,0x1b,0x51,0x38,0x38,0x92,0x5a,0x5a,0x91,0x38,0x38,0x51,0x1a,0x1b,0x19,0x1,0x1,0x1a,0x1b,0x1a,0x52,0x38,0x38,0x91,0x5a,0x5a,0x91,0x38,0x38,0x51,0x1a,0x1a,0x19,0xfc,0xc0,0x1,0xd,0xf,0xe,0x30,0x24,0x24,0x62,0x40,0x41,0x62,0x24,0x24,0x30,0xf,0xe,0xc,0x1,0x1,0xb,0xe,0xf,0x2f,0x23,0x24,0x63,0x41,0x41,0x62,0x24,0x24,0x30,0xf,0xf,0xd,0x1,0x2,0x84,0xa6,0x4e,0xa0,0x4a,0x4a,0x81,0x30,0x30,0x37,0x37,0x30,0x31,0x81,0x4a,0x4a,0x9f,0x4e,0xa6,0x4e,0x9e,0x4a,0x4a,0x81,0x30,0x30,0x37,0x37,0x30,0x30,0x80,0x4a,0x4a,0x9f,0xeb,0xb,0x33,0x71,0x38,0x37,0x65,0x27,0x26,0x2e,0x2d,0x26,0x27,0x65,0x37,0x38,0x71,0x34,0xb,0x98,0x5,0x34,0x72,0x37,0x38,0x65,0x26,0x27,0x2e,0x2e,0x27,0x26,0x66,0x38,0x37,0x72,0x33,0x5,0x0,0x0,0x3,0x0,0x5d,0xff,0xec,0x4,0x35,0x4,0x4e,0x0,0x19,0x0,0x26,0x0,0x33,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x1,0x32,0x16,0x17,0x16,0x16,0x17,0x21,0x36,0x36,0x37,0x36,0x36,0x13,0x22,0x26,0x27,0x26,0x26,0x27,0x21,0x6,0x6,0x7,0x6,0x6,0x5d,0x44,0x40,0x3f,0xb7,0x73,0x72,0xb6,0x40,0x3f,0x44,0x44,0x3f,0x40,0xb7,0x73,0x72,0xb6,0x3f,0x40,0x44,0x1,0xeb,0x44,0x6b,0x26,0x26,0x2d,0x8,0xfd,0xa1,0x7,0x2e,0x26,0x26,0x6a,0x46,0x46,0x6b,0x26,0x27,0x2c,0x7,0x2,0x60,0x7,0x2c,0x26,0x26,0x6b,0x2,0x27,0x16,0x75,0xc8,0x4a,0x4a,0x54,0x54,0x4a,0x4a,0xc8,0x75,0x16,0x75,0xc9,0x4a,0x4a,0x55,0x55,0x4a,0x4a,0xc9,0x1,0x1a,0x34,0x2d,0x2d,0x79,0x44,0x44,0x79,0x2d,0x2d,0x34,0xfc,0xcc,0x35,0x2e,0x2e,0x7b,0x46,0x46,0x7b,0x2e,0x2e,0x35,0x0,0x0,0x1,0x0,0x1a,0x0,0x0,0x4,0xe1,0x5,0xc3,0x0,0x16,0x0,0x0,0x41,0x1,0x23,0x1,0x33,0x1,0x36,0x36,0x37,0x36,0x36,0x33,0x33,0x37,0x27,0x22,0x6,0x7,0x6,0x6,0x7,0x1,0x7,0x2,0x47,0xfe,0xa4,0xd1,0x1,0xfa,0xaa,0x1,0x83,0xe,0x1c,0x12,0x11,0x2a,0x1b,0xd,0x1,0x2e,0x38,0x58,0x23,0x23,0x38,0x18,0xfe,0xfe,0x22,0x1,0x76,0x4,0x3a,0xfa,0x50,0x4,0x87,0x26,0x37,0x12,0x11,0x10,0xab,0x1,0x22,0x24,0x24,0x6e,0x4d,0xfc,0xd7,0x81,0x0,0x1,0x0,0x51,0x0,0x0,0x4,0x60,0x4,0x4d,0x0,0x1a,0x0,0x0,0x61,0x33,0x1,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x37,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x3,0x7,0x27,0x1,0x23,0x1,0xeb,0x8d,0x1,0x3d,0x8,0x19,0x10,0xe,0x1d,0xf,0xe,0x17,0x6,0x15,0x1a,0x34,0x1c,0x20,0x3d,0x1b,0x27,0x42,0x19,0xb0,0x19,0x18,0xfe,0xf4,0xbe,0x3,0x4c,0x16,0x25,0xd,0xa,0xb,0x5,0x3,0x94,0x11,0x7,0x12,0x13,0x1c,0x65,0x4c,0xfd,0xe1,0x65,0x65,0x2,0xfe,0x0,0x3,0x0,0x45,0xfe,0x51,0x4,0xba,0x5,0xc4,0x0,0x19,0x0,0x33,0x0,0x4f,0x0,0x0,0x41,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x3,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x13,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x13,0x23,0x3,0x7,0x27,0x3,0x23,0x13,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x2,0x8a,0x27,0x26,0x27,0x70,0x49,0x45,0x69,0x23,0x24,0x23,0x23,0x24,0x23,0x69,0x45,0x49,0x71,0x26,0x26,0x27,0xb9,0xc,0xd,0xe,0x2c,0x21,0x20,0x2b,0xd,0xd,0xc,0xc,0xd,0xd,0x2b,0x20,0x20,0x2d,0xe,0xd,0xc,0xb1,0x10,0x38,0x14,0x39,0x50,0x1c,0x1b,0x22,0x9,0xf1,0xa4,0x62,0x7,0x4,0x49,0xa4,0x9f,0x18,0x5,0x11,0xd,0xe,0x29,0x1d,0xc,0x2e,0xc,0x1,0xe7,0x1,0xe1,0x73,0xbc,0x43,0x42,0x48,0x48,0x42,0x43,0xbc,0x73,0xfe,0x1f,0x73,0xbb,0x42,0x43,0x48,0x48,0x43,0x42,0xbb,0x2,0x7b,0xfd,0xd3,0x48,0x74,0x28,0x29,0x2c,0x2c,0x29,0x28,0x74,0x48,0x2,0x2d,0x48,0x73,0x29,0x28,0x2b,0x2b,0x28,0x29,0x73,0xfa,0x2a,0x5,0xb,0x35,0x28,0x27,0x5c,0x27,0x4,0xe2,0xfd,0xc5,0x2f,0x2f,0x2,0x3b,0xfb,0xc5,0x5e,0x15,0x3e,0x1d,0x1d,0x29,0x4,0x2,0x0,0x3,0x0,0x37,0xfe,0x51,0x4,0xbb,0x4,0x4e,0x0,0x19,0x0,0x33,0x0,0x4f,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x1,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x13,0x23,0x3,0x7,0x27,0x3,0x23,0x13,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x37,0x24,0x26,0x26,0x79,0x56,0x55,0x79,0x27,0x26,0x24,0x24,0x26,0x27,0x7a,0x56,0x55,0x78,0x26,0x27,0x23,0xb9,0x8,0xe,0xd,0x35,0x2c,0x2d,0x36,0xe,0xe,0x8,0x8,0xd,0xe,0x35,0x2d,0x2d,0x35,0xe,0xe,0x8,0x1,0x93,0xe,0x3a,0x14,0x39,0x50,0x1c,0x1b,0x23,0x8,0xf1,0xa4,0x4e,0x1e,0xd,0x3d,0xa4,0x9f,0x18,0x5,0x11,0xd,0xe,0x29,0x1d,0xc,0x2e,0xc,0x2,0x28,0x17,0x75,0xc9,0x49,0x4a,0x54,0x54,0x4a,0x49,0xc9,0x75,0x17,0x75,0xc9,0x4a,0x4a,0x54,0x54,0x4a,0x4a,0xc9,0x8c,0x17,0x4e,0x90,0x37,0x37,0x42,0x42,0x37,0x37,0x90,0x4e,0x17,0x50,0x90,0x37,0x37,0x41,0x41,0x37,0x37,0x90,0xfc,0xa0,0x4,0xc,0x35,0x28,0x27,0x5c,0x27,0x4,0xe2,0xfe,0x37,0xb1,0xb3,0x1,0xc7,0xfb,0xc5,0x5e,0x15,0x3e,0x1d,0x1d,0x29,0x4,0x2,0x0,0x0,0x4,0x0,0x6a,0xff,0x73,0x4,0x61,0x6,0x35,0x0,0x3,0x0,0x7,0x0,0x2d,0x0,0x53,0x0,0x0,0x41,0x11,0x23,0x11,0x13,0x11,0x23,0x11,0x1,0x35,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x27,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x35,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x2,0xc2,0xb9,0xb9,0xb9,0x2,0x58,0x1,0x19,0x1a,0x1b,0x51,0x38,0x38,0x92,0x5a,0x5a,0x91,0x38,0x38,0x51,0x1a,0x1b,0x19,0x1,0x1,0x1a,0x1b,0x1a,0x52,0x38,0x38,0x91,0x5a,0x5a,0x91,0x38,0x38,0x51,0x1a,0x1a,0x19,0xb6,0x1,0xb,0xe,0xf,0x2f,0x23,0x24,0x63,0x41,0x41,0x62,0x24,0x24,0x30,0xf,0xf,0xd,0x1,0x1,0xd,0xf,0xe,0x30,0x24,0x24,0x62,0x40,0x41,0x62,0x24,0x24,0x30,0xf,0xe,0xc,0x4,0xb3,0x1,0x82,0xfe,0x7e,0xfa,0xc0,0x1,0x8b,0xfe,0x75,0x3,0x11,0xa6,0x4e,0xa0,0x4a,0x4a,0x81,0x30,0x30,0x37,0x37,0x30,0x31,0x81,0x4a,0x4a,0x9f,0x4e,0xa6,0x4e,0x9e,0x4a,0x4a,0x81,0x30,0x30,0x37,0x37,0x30,0x30,0x80,0x4a,0x4a,0x9f,0xf6,0xa8,0x34,0x72,0x37,0x38,0x65,0x26,0x27,0x2e,0x2e,0x27,0x26,0x66,0x38,0x37,0x72,0x33,0xa8,0x33,0x71,0x38,0x37,0x65,0x27,0x26,0x2e,0x2d,0x26,0x27,0x65,0x37,0x38,0x71,0x0,0x0,0x4,0x0,0x7a,0xff,0x61,0x4,0x52,0x4,0xcb,0x0,0x3,0x0,0x7,0x0,0x21,0x0,0x3b,0x0,0x0,0x41,0x11,0x23,0x11,0x13,0x11,0x23,0x11,0x1,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x2,0xc4,0xba,0xba,0xba,0xfe,0x70,0x44,0x40,0x3f,0xb7,0x73,0x72,0xb6,0x40,0x3f,0x44,0x44,0x3f,0x40,0xb7,0x73,0x72,0xb6,0x3f,0x40,0x44,0xb9,0x26,0x27,0x26,0x72,0x4d,0x4d,0x73,0x27,0x26,0x27,0x26,0x26,0x27,0x73,0x4c,0x4d,0x74,0x26,0x27,0x26,0x3,0x46,0x1,0x85,0xfe,0x7b,0xfc,0x1b,0x1,0x97,0xfe,0x69,0x2,0xc6,0x16,0x75,0xc8,0x4a,0x4a,0x54,0x54,0x4a,0x4a,0xc8,0x75,0x16,0x75,0xc9,0x4a,0x4a,0x55,0x55,0x4a,0x4a,0xc9,0x8b,0x16,0x4f,0x91,0x37,0x37,0x41,0x41,0x37,0x37,0x91,0x4f,0x16,0x50,0x91,0x37,0x37,0x40,0x40,0x37,0x37,0x91,0x0,0x0,0x3,0x0,0x4d,0xff,0xeb,0x4,0x83,0x7,0x51,0x0,0x62,0x0,0x86,0x0,0x93,0x0,0x0,0x41,0x15,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x35,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x13,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x33,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x33,0x5,0x17,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x23,0x15,0x14,0x6,0x3,0x22,0x1f,0x33,0x15,0xe,0x18,0x8,0x9,0x9,0x1,0x1,0x17,0x15,0x11,0x2b,0x1a,0x1b,0x2d,0x11,0xc,0x12,0x5,0x3,0x3,0xba,0x3,0x4,0x6,0x15,0xf,0x10,0x29,0x18,0x1d,0x2e,0x11,0x12,0x14,0x5,0x6,0x7,0x1a,0x12,0x14,0x36,0x1f,0x4f,0x82,0x2e,0x15,0x21,0xc,0x10,0x10,0x2e,0x2a,0x29,0x74,0x47,0x2f,0x52,0x20,0x12,0x20,0xc,0xb,0x1e,0x12,0x20,0x53,0x31,0x46,0x75,0x2a,0x29,0x2e,0xf,0xe,0xc,0x23,0x16,0x2f,0x82,0x6d,0x28,0x2d,0x4d,0x22,0x22,0x3e,0x1e,0x1f,0x3f,0x22,0x39,0x5a,0x1e,0x1a,0x1c,0x7f,0x1,0x1,0xb,0x9,0xd,0x2b,0x1e,0x14,0x28,0x15,0x14,0x2b,0x17,0x30,0x74,0x49,0x2a,0xfe,0x20,0x4c,0x19,0x2f,0x12,0x12,0x16,0x8b,0x22,0x5,0xaf,0x97,0x15,0x14,0xe,0x27,0x18,0x1a,0x3f,0x24,0xfd,0x2b,0x37,0x54,0x1a,0x14,0x15,0x15,0x14,0xf,0x2a,0x1a,0xf,0x20,0x11,0x1,0xfc,0xfe,0x4,0x13,0x23,0xf,0x1c,0x2c,0xf,0xf,0x11,0x19,0x18,0x1a,0x50,0x33,0x2,0xd5,0x1c,0x32,0x16,0x20,0x33,0x12,0x14,0x15,0x1,0x97,0x33,0x32,0x16,0x36,0x1f,0x27,0x5d,0x36,0xfd,0x2b,0x57,0x85,0x2d,0x2d,0x2f,0x1d,0x1c,0x11,0x2a,0x1a,0x19,0x2a,0x10,0x1d,0x1e,0x2f,0x2d,0x2d,0x85,0x57,0x2,0xd5,0x33,0x59,0x25,0x22,0x3a,0x18,0x32,0x33,0x1,0x24,0x13,0xe,0xe,0x21,0xe,0xd,0x13,0x1e,0x1e,0x1b,0x4f,0x34,0x24,0x12,0x18,0x25,0xd,0x13,0x10,0xb,0x9,0x9,0x16,0xb,0x18,0x28,0xf1,0x38,0xd,0x2d,0x1b,0x1a,0x3b,0x1d,0x66,0x60,0x26,0x47,0x0,0x0,0x3,0x0,0x67,0xff,0xeb,0x4,0x7c,0x5,0xde,0x0,0x56,0x0,0x7a,0x0,0x87,0x0,0x0,0x41,0x15,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x35,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x34,0x26,0x27,0x26,0x26,0x25,0x33,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x33,0x35,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x13,0x17,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x23,0x15,0x14,0x6,0x3,0x2d,0x1b,0x2f,0x12,0x1c,0x1e,0x12,0x10,0xf,0x28,0x19,0x18,0x29,0x10,0xf,0x15,0x6,0x3,0x4,0xba,0x4,0x3,0x6,0x19,0x12,0xf,0x26,0x16,0x18,0x27,0xe,0x11,0x13,0x1d,0x1b,0x13,0x2e,0x1c,0x4b,0x7b,0x2c,0x2c,0x31,0x2b,0x28,0x27,0x6e,0x43,0x2a,0x4a,0x1f,0x17,0x27,0xf,0xb,0x1a,0xf,0x21,0x56,0x34,0x43,0x6e,0x28,0x27,0x2b,0x31,0x2c,0x2d,0x7b,0xfd,0xca,0x7f,0x1,0x1,0xe,0xc,0xe,0x28,0x1b,0x27,0x51,0x31,0x15,0x2d,0x19,0x20,0x49,0x2a,0x2b,0x28,0x27,0x45,0x1f,0x16,0x2a,0x14,0x30,0x5b,0x34,0x3a,0x5b,0x1e,0x1a,0x1b,0xc9,0x4c,0x19,0x2f,0x12,0x12,0x16,0x8b,0x22,0x4,0x4d,0x97,0x14,0x13,0x1d,0x65,0x47,0xfe,0x86,0x34,0x4f,0x1a,0x16,0x17,0x10,0x10,0xe,0x28,0x1a,0x10,0x24,0x14,0x1,0xd,0xfe,0xf3,0x12,0x21,0xf,0x1f,0x2e,0xf,0xd,0xd,0x15,0x14,0x1a,0x51,0x36,0x1,0x7a,0x47,0x64,0x1d,0x14,0x14,0x97,0x32,0x31,0x32,0x92,0x60,0xfe,0x86,0x57,0x84,0x2c,0x2d,0x2d,0x16,0x15,0x12,0x30,0x1f,0x16,0x26,0x10,0x20,0x20,0x2d,0x2d,0x2c,0x84,0x57,0x1,0x7a,0x60,0x92,0x32,0x31,0x32,0x93,0x12,0x1a,0x27,0xd,0x10,0xf,0x27,0x17,0xa,0x15,0x8,0xb,0xe,0x7f,0xe,0xc,0x8,0x14,0xa,0x17,0x27,0x1e,0x1f,0x1b,0x4e,0x33,0xfe,0xea,0x38,0xd,0x2d,0x1b,0x1a,0x3b,0x1d,0x66,0x60,0x26,0x47,0x0,0x2,0x0,0x71,0xff,0xec,0x4,0x85,0x7,0x4,0x0,0x7,0x0,0x46,0x0,0x0,0x41,0x15,0x21,0x15,0x33,0x35,0x21,0x27,0x13,0x23,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x3,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x3,0x23,0x3,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x1,0x1b,0x1,0xc,0xa8,0x1,0x1d,0x1,0x99,0xb8,0x1,0x11,0x10,0xe,0x27,0x18,0x1d,0x2e,0x11,0xb,0x11,0x4,0x3,0x3,0xbf,0x1,0x3,0x4,0x5,0x14,0xe,0x10,0x2a,0x19,0x1c,0x2b,0xf,0xc,0xd,0x1,0xb8,0x1,0x2b,0x27,0x27,0x6d,0x43,0x2e,0x50,0x1f,0x15,0x22,0xd,0xc,0x1e,0x13,0x20,0x53,0x32,0x42,0x6d,0x27,0x27,0x2b,0x7,0x4,0x6c,0x7d,0x7d,0x6c,0xfe,0xac,0xfb,0x8e,0x2f,0x4a,0x18,0x15,0x16,0x17,0x16,0xf,0x28,0x18,0xf,0x20,0x11,0x4,0x72,0xfb,0x8e,0x13,0x23,0xf,0x1b,0x2a,0xf,0x11,0x12,0x1d,0x1c,0x18,0x42,0x29,0x4,0x72,0xfb,0x8e,0x52,0x7e,0x2b,0x2b,0x2c,0x1b,0x1b,0x11,0x2f,0x1d,0x1b,0x2c,0x11,0x1d,0x1e,0x2c,0x2b,0x2b,0x7e,0x52,0x0,0x0,0x2,0x0,0x5f,0xff,0xeb,0x4,0x7a,0x5,0xb0,0x0,0x7,0x0,0x40,0x0,0x0,0x41,0x15,0x21,0x15,0x33,0x35,0x21,0x27,0x13,0x23,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x3,0x23,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x3,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x1,0x4,0x1,0xf,0xa8,0x1,0x20,0x1,0xa0,0xb9,0x17,0x16,0xd,0x23,0x14,0x2f,0x40,0xc,0x4,0x4,0x1,0xbf,0x4,0x4,0xd,0x40,0x2e,0x1a,0x2a,0xe,0xf,0x10,0xb9,0x1,0x2c,0x27,0x27,0x6e,0x43,0x36,0x5a,0x21,0xf,0x18,0xa,0xb,0x1c,0x10,0x21,0x58,0x34,0x42,0x6e,0x28,0x27,0x2b,0x5,0xb0,0x6c,0x7f,0x7f,0x6c,0xfe,0x8b,0xfd,0x1,0x36,0x4f,0x17,0xf,0xf,0x3b,0x36,0x10,0x25,0x14,0x2,0xff,0xfd,0x1,0x15,0x25,0x11,0x35,0x3a,0x18,0x18,0x17,0x46,0x2d,0x2,0xff,0xfd,0x1,0x52,0x7e,0x2a,0x2b,0x2c,0x24,0x24,0xf,0x26,0x16,0x18,0x29,0x10,0x21,0x21,0x2c,0x2b,0x2a,0x7e,0x52,0x0,0x0,0x1,0x0,0x97,0xfe,0x82,0x4,0x65,0x5,0xc5,0x0,0x2a,0x0,0x0,0x41,0x11,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x11,0x3,0x2a,0x6d,0x58,0x88,0x2e,0x2f,0x30,0x29,0x28,0x28,0x75,0x4b,0x47,0x6c,0x25,0x24,0x26,0x1,0xb9,0x43,0x3d,0x3e,0xb0,0x6e,0x72,0xb8,0x41,0x41,0x46,0x42,0x3e,0x3d,0xaf,0x6e,0xfe,0x82,0x2,0x0,0x4d,0x42,0x41,0xac,0x5f,0xf9,0x5e,0xab,0x41,0x40,0x4d,0x30,0x2b,0x2c,0x7c,0x4b,0x6e,0xb3,0x40,0x40,0x45,0x61,0x54,0x55,0xe4,0x83,0xf7,0x79,0xd5,0x52,0x53,0x6b,0xe,0xfe,0x91,0x0,0x0,0x1,0x0,0xbf,0xfe,0x82,0x4,0x3b,0x4,0x4e,0x0,0x2d,0x0,0x0,0x41,0x11,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x11,0x2,0xfd,0x66,0x4d,0x6c,0x23,0x23,0x20,0x21,0x23,0x23,0x6c,0x4c,0x34,0x5a,0x21,0x20,0x26,0xaf,0x3f,0x38,0x38,0x9a,0x5b,0x46,0x7a,0x32,0x36,0x53,0x1c,0x20,0x21,0x33,0x31,0x31,0x91,0x5f,0xfe,0x82,0x2,0x0,0x45,0x38,0x37,0x8b,0x47,0x2a,0x45,0x8b,0x38,0x37,0x45,0x26,0x21,0x21,0x58,0x31,0x53,0x8f,0x35,0x35,0x3d,0x23,0x1f,0x21,0x5f,0x39,0x3f,0x94,0x4e,0x2a,0x62,0xb3,0x48,0x48,0x61,0x10,0xfe,0x90,0x0,0x0,0x1,0x0,0x76,0x0,0x0,0x4,0x92,0x5,0x3e,0x0,0x13,0x0,0x0,0x41,0x13,0x5,0x37,0x25,0x13,0x23,0x3,0x25,0x7,0x5,0x3,0x25,0x7,0x5,0x3,0x33,0x13,0x5,0x37,0x2,0x5a,0xd0,0x1,0x20,0x48,0xfe,0xdb,0xe7,0xa5,0xbc,0xfe,0xdd,0x46,0x1,0x22,0xcd,0xfe,0xdb,0x44,0x1,0x21,0xe1,0xa8,0xb6,0x1,0x23,0x44,0x1,0xbe,0x1,0x6d,0xaa,0x7a,0xab,0x1,0x98,0xfe,0xb5,0xab,0x7d,0xab,0xfe,0x93,0xab,0x7b,0xab,0xfe,0x72,0x1,0x41,0xaa,0x7b,0x0,0x0,0x1,0x0,0xd1,0x4,0xa6,0x3,0x91,0x5,0xfc,0x0,0x7,0x0,0x0,0x41,0x21,0x35,0x27,0x17,0x21,0x7,0x17,0x1,0x77,0x2,0x1a,0xa5,0x1,0xfd,0xe5,0x1,0xa6,0x5,0x23,0xd8,0x1,0x6c,0xe9,0x1,0x0,0x0,0x1,0x0,0xfc,0x5,0x17,0x3,0xf0,0x6,0x15,0x0,0x23,0x0,0x0,0x41,0x23,0x15,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x33,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x1,0x26,0x2a,0x2c,0x3d,0x68,0x2d,0x24,0x43,0x1e,0x22,0x3e,0x1f,0x1b,0x2d,0xf,0xd,0xe,0x80,0x1c,0x1b,0x1f,0x5d,0x3b,0x28,0x48,0x23,0x24,0x48,0x27,0x28,0x5a,0x5,0x96,0x7e,0x15,0x10,0xd,0x1d,0xd,0xe,0x13,0xf,0xf,0xd,0x27,0x1a,0x12,0x24,0x33,0x4e,0x1b,0x1f,0x1f,0x13,0xe,0xe,0x21,0xe,0xe,0x13,0x0,0x0,0x1,0x1,0xc3,0x5,0x16,0x2,0xb2,0x6,0x57,0x0,0x5,0x0,0x0,0x41,0x17,0x37,0x27,0x37,0x23,0x1,0xc3,0xa1,0x4e,0x3c,0x1,0xb4,0x5,0xdc,0xc6,0x41,0x74,0x8c,0x0,0x0,0x1,0x2,0x3c,0x5,0x16,0x3,0x2a,0x6,0x57,0x0,0x5,0x0,0x0,0x41,0x37,0x35,0x23,0x15,0x7,0x2,0x88,0xa2,0xb4,0x3a,0x5,0x16,0xc6,0x7b,0x8c,0x74,0x0,0x0,0x8,0xfe,0xab,0xfe,0xc4,0x6,0x47,0x5,0xaf,0x0,0x13,0x0,0x27,0x0,0x3b,0x0,0x4f,0x0,0x63,0x0,0x77,0x0,0x8b,0x0,0x9f,0x0,0x0,0x41,0x33,0x34,0x36,0x33,0x32,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x1,0x33,0x34,0x36,0x33,0x32,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x13,0x33,0x34,0x36,0x33,0x32,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x3,0x33,0x34,0x36,0x33,0x32,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x1,0x33,0x34,0x36,0x33,0x32,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x1,0x33,0x34,0x36,0x33,0x32,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x3,0x33,0x34,0x36,0x33,0x32,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x13,0x33,0x34,0x36,0x33,0x32,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x1,0x98,0x71,0x2a,0x37,0x36,0x2d,0x70,0x1e,0x1b,0x1c,0x4e,0x30,0x30,0x4e,0x1b,0x1c,0x1d,0x2,0x4f,0x72,0x2b,0x35,0x36,0x2d,0x71,0x1e,0x1c,0x1c,0x4e,0x30,0x30,0x4e,0x1b,0x1b,0x1e,0xbb,0x71,0x2c,0x35,0x36,0x2d,0x70,0x1e,0x1b,0x1c,0x4e,0x30,0x30,0x4e,0x1b,0x1b,0x1e,0xc5,0x71,0x2c,0x35,0x36,0x2d,0x70,0x1e,0x1b,0x1c,0x4e,0x30,0x30,0x4e,0x1b,0x1b,0x1e,0xfd,0xc0,0x71,0x2c,0x35,0x36,0x2d,0x70,0x1e,0x1b,0x1c,0x4e,0x30,0x30,0x4e,0x1b,0x1c,0x1d,0xfd,0xbe,0x72,0x2a,0x37,0x36,0x2d,0x70,0x1e,0x1b,0x1c,0x4e,0x30,0x30,0x4e,0x1b,0x1c,0x1e,0xb0,0x71,0x2d,0x34,0x36,0x2d,0x70,0x1e,0x1b,0x1c,0x4e,0x30,0x30,0x4d,0x1b,0x1c,0x1e,0xa6,0x72,0x2c,0x34,0x36,0x2d,0x71,0x1e,0x1c,0x1c,0x4e,0x30,0x30,0x4d,0x1b,0x1c,0x1e,0x4,0xf3,0x27,0x3e,0x3d,0x28,0x29,0x45,0x19,0x19,0x1c,0x1c,0x19,0x19,0x45,0xfe,0xc2,0x27,0x3e,0x3d,0x28,0x29,0x45,0x19,0x19,0x1c,0x1c,0x19,0x19,0x45,0xfd,0xe0,0x27,0x3e,0x3d,0x28,0x29,0x45,0x19,0x19,0x1c,0x1c,0x19,0x19,0x45,0xfd,0xd0,0x27,0x3e,0x3d,0x28,0x29,0x45,0x19,0x19,0x1c,0x1c,0x19,0x19,0x45,0xfe,0xbb,0x27,0x3e,0x3d,0x28,0x2a,0x45,0x19,0x18,0x1c,0x1c,0x18,0x19,0x45,0x4,0xf0,0x27,0x3e,0x3d,0x28,0x29,0x45,0x19,0x19,0x1c,0x1c,0x19,0x19,0x45,0xfd,0xe0,0x28,0x3d,0x3d,0x28,0x29,0x45,0x19,0x19,0x1c,0x1c,0x19,0x19,0x45,0xfd,0xd0,0x28,0x3d,0x3d,0x28,0x29,0x45,0x19,0x19,0x1c,0x1c,0x19,0x19,0x45,0x0,0x8,0xfe,0xb4,0xfe,0x63,0x5,0xf4,0x5,0xc6,0x0,0x4,0x0,0x9,0x0,0xe,0x0,0x13,0x0,0x18,0x0,0x1d,0x0,0x22,0x0,0x27,0x0,0x0,0x45,0x23,0x3,0x33,0x13,0x3,0x33,0x13,0x23,0x3,0x1,0x15,0x5,0x35,0x25,0x5,0x35,0x25,0x15,0x5,0x1,0x17,0x25,0x27,0x5,0x1,0x27,0x5,0x17,0x25,0x3,0x37,0x3,0x7,0x13,0x1,0x7,0x13,0x37,0x3,0x2,0xb7,0x89,0x46,0x60,0x7a,0xce,0x88,0x46,0x60,0x7a,0x2,0xb2,0x1,0x5a,0xfe,0xb3,0xfb,0x67,0xfe,0xa6,0x1,0x4d,0x3,0xa9,0x61,0x1,0x26,0x44,0xfe,0xbf,0xfd,0x52,0x61,0xfe,0xda,0x45,0x1,0x40,0x8a,0x62,0xc6,0x41,0x94,0x3,0xd3,0x61,0xc5,0x42,0x95,0x3c,0xfe,0x9f,0x1,0x53,0x4,0xb0,0x1,0x60,0xfe,0xae,0xfe,0x3,0x8b,0x47,0x62,0x7c,0xd2,0x8b,0x47,0x62,0x7c,0x2,0x45,0x63,0xc8,0x44,0x99,0xfc,0x1b,0x63,0xc8,0x45,0x99,0x3,0x58,0x62,0x1,0x2b,0x45,0xfe,0xba,0xfd,0x43,0x63,0xfe,0xd5,0x47,0x1,0x45,0x0,0x3,0x0,0xbf,0x0,0x0,0x4,0x79,0x5,0xb0,0x0,0x3,0x0,0x14,0x0,0x23,0x0,0x0,0x41,0x1,0x7,0x1,0x25,0x21,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x21,0x11,0x33,0x11,0x11,0x21,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x4,0x31,0xfe,0x94,0x83,0x1,0x6b,0xfd,0xcb,0x1,0x1f,0x62,0xaf,0x42,0x42,0x4d,0x4d,0x42,0x42,0xaf,0x62,0xfe,0x28,0xb9,0x1,0x1f,0x40,0x6d,0x28,0x27,0x2d,0x2d,0x28,0x28,0x6c,0x40,0x1,0xd3,0x1,0xec,0x46,0xfe,0x14,0xbb,0x1,0x3a,0x37,0x37,0xa1,0x69,0x69,0xa2,0x37,0x37,0x3a,0x2,0xfa,0x50,0x2,0xe0,0x2,0x38,0x1,0x28,0x25,0x25,0x6a,0x42,0x42,0x67,0x24,0x24,0x27,0x1,0x0,0x3,0x0,0xad,0xfe,0x60,0x4,0x3f,0x4,0x4e,0x0,0x3,0x0,0x21,0x0,0x3b,0x0,0x0,0x65,0x1,0x7,0x1,0x13,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x27,0x23,0x11,0x33,0x11,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x27,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x4,0x36,0xfe,0x96,0x71,0x1,0x6b,0x79,0x38,0x36,0x36,0xa0,0x68,0x3c,0x68,0x2a,0x1d,0x33,0x16,0x9,0xa9,0xb9,0x14,0x2f,0x1a,0x2c,0x69,0x3e,0x66,0x9f,0x36,0x36,0x38,0xb9,0x1d,0x1e,0x25,0x74,0x54,0x2c,0x48,0x1e,0x20,0x33,0x13,0x13,0x32,0x1f,0x1e,0x49,0x2b,0x4e,0x70,0x25,0x24,0x23,0x2,0x1,0x76,0x5e,0xfe,0x8b,0x2,0x6c,0x15,0x79,0xcb,0x49,0x49,0x52,0x19,0x19,0x11,0x2c,0x1b,0x76,0xfa,0x26,0x2,0x8,0x17,0x25,0xf,0x18,0x19,0x54,0x4a,0x4a,0xc9,0x89,0x15,0x48,0x86,0x34,0x3f,0x4d,0x13,0x11,0x13,0x38,0x22,0x2,0x9,0x22,0x38,0x13,0x12,0x15,0x40,0x36,0x37,0x8f,0x0,0x1,0x0,0xb6,0x0,0x0,0x4,0x47,0x6,0xff,0x0,0x7,0x0,0x0,0x41,0x11,0x23,0x11,0x21,0x11,0x33,0x11,0x4,0x47,0xb9,0xfd,0x28,0xba,0x5,0x18,0x1,0xe7,0xfe,0xb1,0xfa,0x50,0x5,0x18,0x0,0x1,0x0,0xb6,0x0,0x0,0x4,0x31,0x5,0x77,0x0,0x7,0x0,0x0,0x41,0x11,0x23,0x11,0x21,0x11,0x33,0x11,0x4,0x31,0xba,0xfd,0x3f,0xba,0x3,0xa1,0x1,0xd6,0xfe,0xc3,0xfb,0xc6,0x3,0xa1,0x0,0x1,0x0,0xb9,0xfe,0xe0,0x4,0x7f,0x5,0xb0,0x0,0x21,0x0,0x0,0x41,0x35,0x21,0x11,0x33,0x11,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x14,0x6,0x7,0x6,0x6,0x23,0x17,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x11,0x4,0x34,0xfc,0x85,0xba,0xb8,0x60,0x93,0x32,0x3a,0x3b,0x1,0x1e,0x22,0x22,0x6f,0x51,0x2,0x73,0xb1,0x3c,0x3c,0x3d,0x50,0x4c,0x4d,0xdd,0x8e,0xb8,0x5,0x18,0x98,0xfa,0x50,0x2,0xa0,0x30,0x2d,0x35,0xa3,0x6a,0x5a,0x93,0x34,0x34,0x39,0x93,0x49,0x45,0x45,0xcb,0x83,0x86,0xd6,0x4b,0x4a,0x50,0x1,0xd6,0x0,0x0,0x1,0x0,0xb8,0xfe,0xe4,0x4,0x52,0x4,0x3a,0x0,0x21,0x0,0x0,0x41,0x35,0x21,0x11,0x33,0x11,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x11,0x4,0x2b,0xfc,0x8d,0xba,0xda,0x47,0x79,0x2d,0x2d,0x33,0x1c,0x1e,0x1e,0x60,0x44,0x30,0x67,0x94,0x2f,0x2f,0x2c,0x4f,0x45,0x46,0xbd,0x6f,0xda,0x3,0xa1,0x99,0xfb,0xc6,0x1,0xe4,0x29,0x27,0x28,0x76,0x4c,0x38,0x60,0x27,0x28,0x3b,0x12,0x92,0x13,0x67,0x42,0x42,0x8e,0x3a,0x71,0xb1,0x3d,0x3c,0x41,0x1,0x1b,0x0,0x1,0x0,0xae,0x0,0x0,0x4,0xc4,0x5,0xb0,0x0,0x14,0x0,0x0,0x41,0x23,0x1,0x23,0x11,0x23,0x11,0x23,0x11,0x23,0x11,0x33,0x11,0x33,0x15,0x33,0x35,0x33,0x1,0x33,0x1,0x4,0x98,0xd8,0xfe,0xd7,0x36,0x95,0x65,0xb9,0xb9,0x65,0x95,0x36,0x1,0x46,0xe7,0xfe,0x85,0x5,0xb0,0xfd,0x7b,0x1,0x1,0xfe,0xff,0x2,0x85,0xfa,0x50,0x2,0x94,0xf5,0xf5,0xfd,0x6c,0x3,0x1,0x0,0x0,0x1,0x0,0xa3,0x0,0x0,0x4,0x7e,0x4,0x3a,0x0,0x14,0x0,0x0,0x41,0x23,0x1,0x23,0x35,0x23,0x15,0x23,0x11,0x23,0x11,0x33,0x11,0x33,0x15,0x33,0x35,0x33,0x1,0x33,0x1,0x4,0x59,0xdf,0xfe,0xfd,0x2c,0x94,0x5a,0xba,0xba,0x5a,0x94,0x33,0x1,0x16,0xea,0xfe,0x89,0x4,0x3a,0xfe,0x36,0xd5,0xd5,0x1,0xca,0xfb,0xc6,0x1,0xcd,0xc2,0xc2,0xfe,0x33,0x2,0x38,0x0,0x0,0x1,0x0,0x2d,0x0,0x0,0x4,0xa6,0x5,0xb0,0x0,0xe,0x0,0x0,0x41,0x1,0x33,0x1,0x1,0x23,0x1,0x23,0x11,0x21,0x15,0x21,0x11,0x33,0x11,0x2,0x95,0x1,0x2f,0xe2,0xfe,0x93,0x1,0x45,0xd3,0xfe,0xe2,0x62,0xfe,0x2,0x1,0x46,0xb8,0x2,0x93,0xfd,0x6d,0x2,0xef,0x2,0xc1,0xfd,0x7a,0x2,0x86,0x98,0xfa,0xe8,0x2,0x93,0x0,0x1,0x0,0x38,0x0,0x0,0x4,0xb1,0x4,0x3a,0x0,0xe,0x0,0x0,0x41,0x1,0x33,0x1,0x1,0x23,0x3,0x23,0x11,0x21,0x15,0x21,0x11,0x33,0x11,0x2,0xbc,0x1,0xb,0xea,0xfe,0x94,0x1,0x49,0xe0,0xf9,0x7f,0xfe,0x2,0x1,0x45,0xb9,0x1,0xcd,0xfe,0x33,0x2,0x38,0x2,0x2,0xfe,0x36,0x1,0xca,0x99,0xfc,0x5f,0x1,0xcd,0x0,0x0,0x1,0x0,0x72,0x0,0x0,0x4,0x9a,0x5,0xb0,0x0,0xd,0x0,0x0,0x41,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x33,0x11,0x21,0x35,0x21,0x11,0x1,0x2b,0xb9,0xb9,0x1,0x73,0xb8,0x1,0x44,0xfe,0x4,0x3,0x1f,0x2,0x91,0xfa,0x50,0x2,0x87,0xfd,0x79,0x5,0x18,0x98,0xfd,0x6f,0x0,0x1,0x0,0x6e,0x0,0x0,0x4,0x9c,0x4,0x3a,0x0,0xd,0x0,0x0,0x41,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x33,0x11,0x21,0x35,0x21,0x11,0x1,0x27,0xb9,0xb9,0x1,0x7c,0xb9,0x1,0x40,0xfe,0x7,0x2,0x65,0x1,0xd5,0xfb,0xc6,0x1,0xce,0xfe,0x32,0x3,0xa1,0x99,0xfe,0x2b,0x0,0x1,0x0,0x6d,0xfe,0xdf,0x4,0x9a,0x5,0xb0,0x0,0x2f,0x0,0x0,0x41,0x11,0x21,0x11,0x33,0x11,0x21,0x11,0x33,0x11,0x33,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x17,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x2,0xe1,0xfd,0x8c,0xb8,0x1,0x3,0xb9,0x3,0x26,0x46,0x1b,0x21,0x30,0xe,0xb,0xb,0x1,0x8,0x9,0xc,0x26,0x1e,0x14,0x35,0x20,0x2,0x36,0x5e,0x27,0x3d,0x54,0x16,0x10,0xf,0x18,0x18,0x19,0x4a,0x32,0x31,0x7c,0x45,0x3,0x41,0x2,0x6f,0xfa,0x50,0x5,0x18,0xfa,0xe8,0x2,0x9e,0x1,0x18,0x16,0x1a,0x55,0x37,0x2b,0x65,0x39,0x39,0x69,0x2b,0x36,0x4f,0x18,0x12,0x12,0x93,0x17,0x18,0x25,0x79,0x54,0x36,0x81,0x49,0x54,0x95,0x3e,0x41,0x68,0x24,0x25,0x27,0x1,0x0,0x1,0x0,0x74,0xfe,0xe5,0x4,0x7c,0x4,0x3a,0x0,0x23,0x0,0x0,0x73,0x33,0x11,0x33,0x11,0x33,0x11,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x14,0x6,0x7,0x6,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x37,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x11,0x21,0x74,0xb9,0xe7,0xb9,0x8,0x36,0x57,0x1f,0x1f,0x22,0x1,0x14,0x17,0x18,0x4d,0x39,0x30,0x55,0x7b,0x2a,0x2d,0x29,0x2,0x3e,0x38,0x38,0x9c,0x5d,0x8,0xfd,0xa7,0x3,0xa1,0xfc,0x5f,0x1,0xe3,0x2b,0x28,0x28,0x75,0x49,0x36,0x60,0x27,0x28,0x3c,0x12,0x92,0x12,0x5e,0x3c,0x45,0x97,0x3d,0x6d,0xb0,0x3e,0x3e,0x42,0x1,0xb5,0x0,0x2,0x0,0x68,0xff,0xe2,0x4,0x50,0x5,0xc5,0x0,0x4d,0x0,0x67,0x0,0x0,0x45,0x35,0x22,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x37,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x11,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x27,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x11,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x16,0x16,0x1,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x14,0x6,0x7,0x6,0x6,0x7,0x26,0x26,0x27,0x26,0x26,0x4,0x50,0x2c,0x4e,0x23,0x1a,0x2c,0x11,0x1c,0x1e,0x1,0x2b,0x28,0x28,0x73,0x48,0x48,0x73,0x28,0x28,0x2b,0x1b,0x1a,0x18,0x44,0x2b,0x10,0x20,0x11,0x2e,0x4f,0x21,0x26,0x3b,0x13,0x10,0x11,0x7,0x8,0xb,0x21,0x17,0xf,0x23,0x14,0x1,0x32,0x56,0x24,0x2e,0x44,0x14,0xf,0xf,0x18,0x17,0x1e,0x62,0x41,0x35,0x7f,0x48,0x3c,0x6d,0x30,0x3f,0x92,0xfe,0x94,0xf,0x10,0x10,0x2e,0x20,0x1f,0x2f,0x10,0xf,0xf,0x13,0x13,0xd,0x23,0x15,0x1f,0x32,0x12,0x15,0x16,0x1e,0x9d,0xd,0xc,0x21,0x4c,0x29,0x46,0xa1,0x58,0x1,0x68,0x68,0xb4,0x43,0x42,0x4c,0x4e,0x43,0x43,0xb4,0x65,0xfe,0xad,0x51,0x94,0x40,0x3b,0x67,0x2b,0x4,0x4,0x1e,0x1c,0x21,0x61,0x3c,0x34,0x78,0x41,0x1,0x19,0x37,0x65,0x2c,0x3a,0x5d,0x1d,0x11,0x14,0x9e,0x26,0x22,0x2a,0x84,0x50,0x38,0x7f,0x44,0xfe,0xe9,0x4e,0x92,0x41,0x54,0x8d,0x2f,0x26,0x2b,0x1d,0x1b,0x1f,0x21,0x2,0x9d,0x1,0x58,0x43,0x78,0x2e,0x2d,0x36,0x33,0x2d,0x2d,0x7a,0x45,0xfe,0x95,0x45,0x80,0x37,0x24,0x41,0x1b,0x1f,0x4c,0x2c,0x35,0x7d,0x0,0x0,0x2,0x0,0x5c,0xff,0xeb,0x4,0x8b,0x4,0x4f,0x0,0x4d,0x0,0x6d,0x0,0x0,0x45,0x35,0x22,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x35,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x16,0x16,0x1,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x26,0x26,0x27,0x26,0x26,0x4,0x8b,0x30,0x58,0x28,0x16,0x25,0xf,0x1a,0x1c,0x11,0x11,0x13,0x37,0x26,0x23,0x57,0x32,0x32,0x5d,0x1d,0x25,0x31,0x12,0x14,0x15,0x26,0x24,0x17,0x3d,0x25,0x16,0x2d,0x18,0x48,0x72,0x27,0x27,0x2a,0x16,0x15,0x15,0x3e,0x28,0x3f,0x6d,0x2a,0x1f,0x32,0x11,0x14,0x14,0x21,0x1e,0x1d,0x55,0x33,0x37,0x85,0x4c,0x4a,0x83,0x39,0x45,0x9e,0xfe,0x69,0x8,0x8,0x8,0x1b,0x14,0xc,0x1e,0x12,0x14,0x21,0xd,0x13,0x1c,0x8,0x6,0x6,0x1,0x12,0x11,0xd,0x23,0x16,0x26,0x3b,0x13,0x15,0x15,0xc,0x9d,0xb,0xa,0x1b,0x3b,0x20,0x3b,0x86,0x49,0x69,0x3a,0x6d,0x30,0x36,0x58,0x1d,0x1e,0x20,0x1f,0x1a,0x21,0x43,0x2b,0x30,0x74,0x3f,0x68,0x4e,0x8e,0x3d,0x28,0x48,0x1f,0x6,0x6,0x43,0x3b,0x3a,0x9e,0x5b,0x3c,0x42,0x73,0x2b,0x2a,0x31,0x9e,0x2f,0x2a,0x1f,0x50,0x2d,0x33,0x74,0x3f,0x3a,0x54,0x9a,0x41,0x3f,0x68,0x25,0x28,0x2b,0x23,0x20,0x1c,0x1d,0x2,0x45,0x6c,0x28,0x49,0x1f,0x21,0x35,0x10,0xb,0xb,0x10,0xf,0x13,0x43,0x27,0x1e,0x43,0x23,0x6c,0x36,0x63,0x2b,0x20,0x39,0x18,0x1c,0x45,0x29,0x29,0x61,0x0,0x1,0x0,0x39,0xfe,0xa1,0x4,0xb6,0x5,0xb0,0x0,0xf,0x0,0x0,0x41,0x11,0x21,0x11,0x33,0x13,0x23,0x11,0x23,0x11,0x21,0x11,0x33,0x35,0x21,0x15,0x1,0x46,0x2,0xb9,0xa5,0x12,0x91,0xb9,0xfe,0x93,0xee,0xfd,0x4c,0x5,0x18,0xfa,0xe8,0xfe,0xa1,0x1,0xfb,0x5,0x14,0xfa,0xe7,0x4,0x81,0x97,0x97,0x0,0x0,0x1,0x0,0x34,0xfe,0xbf,0x4,0x8b,0x4,0x3a,0x0,0xf,0x0,0x0,0x41,0x11,0x21,0x11,0x33,0x13,0x23,0x11,0x23,0x11,0x21,0x11,0x33,0x35,0x21,0x15,0x1,0x1c,0x2,0xb7,0xa6,0x12,0x80,0xb9,0xfe,0x83,0xe4,0xfd,0x7b,0x3,0xa3,0xfc,0x5d,0xfe,0xbf,0x1,0xd8,0x3,0xa3,0xfc,0x5d,0x3,0xc,0x97,0x97,0x0,0x0,0x2,0x0,0xab,0x0,0x0,0x4,0x27,0x5,0xb0,0x0,0x3,0x0,0x23,0x0,0x0,0x41,0x11,0x23,0x11,0x1,0x23,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x11,0x33,0x2,0xa6,0x95,0x2,0x16,0xb9,0x20,0x41,0x21,0x27,0x54,0x2e,0x39,0x54,0x1b,0x1c,0x1b,0xb9,0x37,0x34,0x34,0x98,0x61,0x30,0x51,0x24,0x23,0x42,0x21,0xb9,0x1,0x35,0x2,0xbc,0xfd,0x44,0x4,0x7b,0xfd,0x45,0xb,0x12,0x7,0x8,0x9,0x1d,0x23,0x22,0x71,0x55,0x1,0xc8,0xfe,0x38,0x79,0xaa,0x36,0x36,0x31,0x7,0x7,0x7,0x12,0xc,0xfd,0xa5,0x0,0x2,0x0,0x92,0x0,0x0,0x4,0x2c,0x4,0x3a,0x0,0x3,0x0,0x20,0x0,0x0,0x65,0x11,0x23,0x11,0x5,0x11,0x23,0x11,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x11,0x2,0xaf,0x96,0x2,0x13,0xb9,0x1a,0x35,0x1b,0x2d,0x60,0x33,0x40,0x61,0x20,0x1e,0x1f,0xb9,0x3e,0x3a,0x39,0xa2,0x64,0x55,0x91,0x44,0xd3,0x2,0x36,0xfd,0xca,0xd3,0x4,0x3a,0xfd,0xe9,0x6,0xb,0x4,0x7,0x7,0x20,0x22,0x1f,0x5e,0x40,0x1,0x3b,0xfe,0xc5,0x67,0x99,0x32,0x33,0x32,0x12,0x11,0xfe,0x75,0x0,0x1,0x0,0xe3,0x0,0x0,0x4,0x5f,0x5,0xb0,0x0,0x19,0x0,0x0,0x73,0x33,0x11,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x13,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x11,0x23,0xe3,0xb9,0x47,0x90,0x53,0x39,0x54,0x1c,0x1b,0x1b,0xb9,0x1,0x37,0x34,0x35,0x98,0x61,0x61,0x88,0x41,0xb9,0x2,0xba,0x18,0x1d,0x1d,0x22,0x23,0x71,0x55,0xfe,0x39,0x1,0xc7,0x79,0xaa,0x36,0x36,0x31,0x1c,0x18,0x2,0x5d,0x0,0x0,0x2,0x0,0x26,0xff,0xea,0x4,0x89,0x5,0xc3,0x0,0x39,0x0,0x4e,0x0,0x0,0x53,0x14,0x16,0x17,0x16,0x16,0x17,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x21,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x26,0x26,0x27,0x26,0x26,0x27,0x5,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x26,0x21,0x21,0x20,0x61,0x41,0x43,0x41,0x41,0xbf,0x7c,0x6f,0xa4,0x24,0x2f,0x16,0x35,0x20,0x21,0x4d,0x2f,0x58,0x7c,0x27,0x28,0x24,0x2,0xa6,0x10,0x10,0x15,0x45,0x31,0x2e,0x79,0x49,0x3f,0x74,0x31,0x32,0x50,0x1d,0x1f,0x22,0x17,0x25,0xd,0x13,0x12,0x1,0x1,0x28,0x17,0x15,0x10,0x2b,0x1b,0x1d,0x44,0x28,0x29,0x40,0x18,0x1e,0x27,0xc,0x8,0x8,0x4,0x39,0x4b,0x7e,0x2f,0x30,0x3f,0xc,0x90,0x80,0xd7,0x4e,0x4f,0x58,0x42,0x22,0x88,0xe,0x1e,0xd,0xd,0x10,0x46,0x3c,0x3b,0x9f,0x5a,0x88,0xbc,0x53,0x90,0x3c,0x4b,0x72,0x26,0x23,0x24,0x27,0x24,0x24,0x69,0x41,0x45,0xa9,0x63,0x5,0xa,0x20,0x15,0x1f,0x55,0x32,0xf7,0x10,0x5b,0x97,0x39,0x29,0x40,0x16,0x17,0x18,0x17,0x15,0x1a,0x50,0x32,0x27,0x5a,0x30,0x70,0x0,0x2,0x0,0x26,0xff,0xec,0x4,0x85,0x4,0x4e,0x0,0x2c,0x0,0x3a,0x0,0x0,0x45,0x32,0x36,0x37,0x27,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x35,0x21,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x26,0x26,0x27,0x23,0x14,0x16,0x17,0x16,0x16,0x17,0x15,0x14,0x16,0x17,0x16,0x16,0x13,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x21,0x36,0x36,0x37,0x36,0x36,0x2,0xfe,0x89,0xb0,0x30,0x4a,0x30,0x8b,0x64,0x45,0x69,0x24,0x24,0x26,0x3,0x2,0xa6,0x33,0x34,0x34,0x9f,0x6b,0x50,0x91,0x3a,0x3a,0x50,0xf,0x3b,0x36,0x1,0x94,0x1b,0x1b,0x20,0x64,0x45,0x42,0x3d,0x3d,0xaf,0x50,0x3d,0x59,0x1d,0x1d,0x1c,0xfe,0x19,0x9,0x2c,0x20,0x20,0x54,0x14,0x55,0x32,0x7c,0x2e,0x3f,0x3a,0x32,0x32,0x86,0x49,0x2,0x78,0x69,0xb2,0x41,0x40,0x49,0x40,0x3a,0x3b,0xa3,0x61,0x15,0x6b,0x4d,0x42,0x6e,0x2b,0x31,0x40,0xc,0x1,0x75,0xc6,0x48,0x49,0x51,0x3,0xca,0x2e,0x26,0x27,0x64,0x36,0x18,0x40,0x6e,0x29,0x28,0x2e,0x0,0x1,0x0,0xc8,0xfe,0xda,0x4,0x8c,0x5,0xb0,0x0,0x26,0x0,0x0,0x41,0x1,0x23,0x1,0x23,0x11,0x23,0x11,0x33,0x11,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x17,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x2,0xc9,0x1,0xb8,0xd7,0xfe,0x65,0x8e,0xb9,0xb9,0xe0,0x5d,0x8b,0x2e,0x2d,0x2e,0x1,0xc,0xd,0xe,0x31,0x23,0x1f,0x51,0x33,0x2,0x73,0xaf,0x3b,0x3b,0x3d,0x3c,0x39,0x39,0xa8,0x6a,0x3,0x35,0x2,0x7b,0xfd,0x8c,0x2,0x74,0xfa,0x50,0x2,0x9a,0x38,0x35,0x35,0x9a,0x63,0x3a,0x67,0x2b,0x31,0x4a,0x1a,0x16,0x18,0x92,0x49,0x46,0x45,0xca,0x83,0x77,0xc5,0x49,0x49,0x5d,0xf,0x0,0x1,0x0,0xb4,0xfe,0xfe,0x4,0x3c,0x4,0x3a,0x0,0x22,0x0,0x0,0x41,0x1,0x23,0x1,0x23,0x11,0x23,0x11,0x33,0x11,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x2,0xaf,0x1,0x8d,0xe0,0xfe,0x88,0x77,0xb9,0xb9,0xc7,0x47,0x77,0x2c,0x2b,0x32,0x19,0x1c,0x1c,0x57,0x3f,0x31,0x61,0x8b,0x2c,0x2c,0x2a,0x39,0x33,0x33,0x8f,0x2,0x64,0x1,0xd6,0xfe,0x36,0x1,0xca,0xfb,0xc6,0x1,0xcd,0x20,0x22,0x23,0x6d,0x4c,0x33,0x5b,0x24,0x25,0x38,0x10,0x92,0x12,0x62,0x3f,0x3e,0x88,0x38,0x60,0x96,0x37,0x36,0x44,0x0,0x0,0x1,0x0,0xb6,0xfe,0x4b,0x4,0x19,0x5,0xb0,0x0,0x1d,0x0,0x0,0x41,0x23,0x11,0x33,0x11,0x21,0x11,0x14,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x23,0x11,0x21,0x1,0x6f,0xb9,0xb9,0x1,0xf1,0x43,0x41,0x6,0x1a,0xe,0xf,0x1b,0x8,0xe,0x1d,0x34,0x1d,0x4c,0x76,0x29,0x28,0x2a,0xb9,0xfe,0xf,0x5,0xb0,0xfa,0x50,0x2,0x85,0xfd,0x22,0x57,0x6d,0x2,0x2,0x1,0x5,0x3,0x93,0xa,0x8,0x2f,0x2d,0x2d,0x81,0x52,0x6,0x9,0xfd,0x6c,0x0,0x0,0x1,0x0,0xb3,0xfe,0x4b,0x4,0x16,0x4,0x3a,0x0,0x1d,0x0,0x0,0x41,0x23,0x11,0x33,0x11,0x21,0x11,0x14,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x11,0x23,0x11,0x21,0x1,0x6c,0xb9,0xb9,0x1,0xf1,0x47,0x42,0x7,0x1a,0xe,0xf,0x1c,0x8,0xe,0x1d,0x35,0x1e,0x4c,0x78,0x29,0x29,0x2c,0xb9,0xfe,0xf,0x4,0x3a,0xfb,0xc6,0x1,0xce,0xfd,0xd9,0x5a,0x6a,0x2,0x2,0x1,0x5,0x3,0x93,0xa,0x8,0x2f,0x2d,0x2c,0x81,0x53,0x4,0x93,0xfe,0x2b,0x0,0x0,0x2,0x0,0x5a,0xff,0xeb,0x4,0x57,0x5,0xc4,0x0,0x34,0x0,0x48,0x0,0x0,0x41,0x22,0x6,0x7,0x6,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x21,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x16,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x3,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x21,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x2,0x3e,0x48,0x72,0x2b,0x2c,0x3b,0x11,0x2f,0x19,0x3d,0x25,0x25,0x59,0x35,0x36,0x5b,0x24,0x2d,0x40,0x14,0x16,0x14,0xfc,0xbc,0x11,0x12,0x1a,0x62,0x43,0x37,0x8b,0x53,0x46,0x81,0x37,0x46,0x6d,0x23,0x18,0x1a,0x1e,0x1e,0x21,0x62,0x40,0x3a,0x8e,0x3f,0x3c,0x5e,0x24,0x28,0x3a,0xd,0x9,0x8,0x2,0x8b,0x1,0x12,0x12,0x15,0x42,0x2d,0x22,0x52,0x5,0xc4,0x16,0x10,0x10,0x23,0xc,0x88,0xe,0x1f,0xd,0xc,0x10,0x1a,0x18,0x1c,0x5a,0x33,0x38,0x85,0x47,0x5d,0xa6,0x49,0x83,0x39,0x59,0x8c,0x2b,0x24,0x26,0x1,0x28,0x25,0x2e,0x91,0x5b,0x40,0x93,0x4f,0xda,0x5a,0xa2,0x45,0x4b,0x76,0x29,0x24,0x27,0xfa,0xbe,0x1d,0x1b,0x21,0x60,0x3a,0x24,0x50,0x2a,0x5a,0x3f,0x79,0x34,0x40,0x67,0x22,0x1a,0x1c,0x0,0x1,0x0,0x94,0xff,0xeb,0x4,0x52,0x5,0xb0,0x0,0x2d,0x0,0x0,0x41,0x1,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x1,0x27,0x21,0x15,0x3,0x4a,0xfe,0x7a,0x8f,0x53,0x7e,0x29,0x25,0x27,0x2a,0x27,0x27,0x71,0x47,0x3f,0x69,0x25,0x25,0x2a,0xb9,0x51,0x42,0x42,0xa9,0x57,0x6a,0xb3,0x42,0x41,0x49,0x3b,0x3d,0x4e,0xc0,0x42,0x1,0x1,0x9b,0x1,0xfc,0x9b,0x5,0x18,0xfe,0x3b,0x97,0x26,0x27,0x24,0x6e,0x4b,0x3b,0x64,0x24,0x24,0x29,0x2b,0x26,0x25,0x63,0x39,0x6f,0xa0,0x34,0x34,0x32,0x39,0x37,0x37,0x9e,0x66,0x64,0xa1,0x36,0x45,0x38,0x1,0xec,0x76,0x98,0x0,0x0,0x1,0x0,0x89,0xfe,0x75,0x4,0x48,0x4,0x3a,0x0,0x2d,0x0,0x0,0x41,0x1,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x1,0x27,0x21,0x15,0x3,0x2c,0xfe,0x8c,0x8d,0x56,0x82,0x29,0x24,0x25,0x2a,0x27,0x27,0x71,0x48,0x3f,0x68,0x25,0x26,0x29,0xba,0x52,0x42,0x42,0xa8,0x57,0x6a,0xb4,0x42,0x41,0x49,0x3b,0x3a,0x43,0xc3,0x40,0x1,0x1,0x8e,0x1,0xfc,0x9b,0x3,0xa1,0xfe,0x3b,0x97,0x28,0x2a,0x24,0x6c,0x48,0x3b,0x63,0x24,0x24,0x28,0x2b,0x25,0x25,0x63,0x38,0x6e,0xa0,0x34,0x34,0x32,0x39,0x37,0x37,0x9e,0x65,0x62,0x9b,0x39,0x41,0x3f,0x1,0xef,0x76,0x99,0x0,0xff,0xff,0x0,0x42,0xfe,0x4b,0x4,0x7b,0x5,0xb0,0x4,0x26,0x1,0x7b,0x4b,0x0,0x0,0x27,0x2,0x6a,0xff,0xd,0x0,0x3f,0x0,0x7,0x2,0x6f,0xff,0x4f,0x0,0x0,0xff,0xff,0x0,0x74,0xfe,0x4b,0x4,0x7c,0x4,0x3a,0x4,0x26,0x1,0xb5,0x52,0x0,0x0,0x27,0x2,0x6a,0xff,0x3f,0xff,0x64,0x0,0x7,0x2,0x6f,0xff,0x44,0x0,0x0,0x0,0x2,0x0,0x61,0x0,0x0,0x4,0x30,0x5,0xb0,0x0,0x10,0x0,0x1f,0x0,0x0,0x41,0x21,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x21,0x11,0x23,0x11,0x21,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x21,0x3,0x77,0xfe,0xd1,0x75,0xb5,0x3e,0x3e,0x41,0x41,0x3e,0x3e,0xb5,0x75,0x1,0xe8,0xb9,0xfe,0xd1,0x4e,0x72,0x25,0x25,0x23,0x23,0x25,0x25,0x72,0x4e,0x1,0x2f,0x3,0x6d,0x3f,0x39,0x39,0xa0,0x61,0x60,0xa3,0x3b,0x3b,0x42,0x5,0xb0,0xfa,0xe7,0x31,0x29,0x29,0x6a,0x39,0x38,0x66,0x27,0x26,0x2e,0x0,0x0,0x2,0x0,0x4d,0x0,0x0,0x4,0x8d,0x5,0xb0,0x0,0x24,0x0,0x33,0x0,0x0,0x61,0x21,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x23,0x16,0x16,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x7,0x11,0x23,0x11,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x37,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x1,0xcf,0x1,0x5c,0x47,0x7f,0x30,0x2f,0x39,0x2,0x2,0x28,0x1b,0xb3,0x1d,0x20,0x2,0x1,0x16,0x15,0x15,0x3d,0x29,0x31,0xb9,0x72,0x5e,0x90,0x31,0x31,0x32,0x32,0x31,0x31,0x90,0xd0,0x72,0x36,0x4d,0x18,0x18,0x16,0x16,0x18,0x18,0x4d,0x36,0x72,0x3c,0x3c,0x3c,0xb2,0x76,0x60,0xc0,0x5b,0x5b,0xc5,0x5b,0x48,0x77,0x2b,0x2b,0x2f,0x1,0x1,0x5,0x1a,0xfd,0xbd,0x40,0x39,0x3a,0xa0,0x5f,0x5f,0xa2,0x3b,0x3c,0x43,0x97,0x32,0x29,0x29,0x6a,0x38,0x37,0x66,0x27,0x27,0x2e,0x0,0x0,0x2,0x0,0x65,0xff,0xea,0x4,0x93,0x6,0x18,0x0,0x4f,0x0,0x72,0x0,0x0,0x53,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x37,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x17,0x16,0x16,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x37,0x11,0x23,0x11,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x25,0x11,0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x27,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x65,0xa,0x9,0x11,0x3f,0x2a,0x20,0x50,0x2f,0x2f,0x4d,0x20,0x10,0x1c,0xd,0xd,0x21,0x14,0x20,0x55,0x34,0x34,0x5b,0x28,0x28,0x2f,0x12,0xf,0x11,0x1,0x1,0xf,0xe,0x8,0x13,0xb,0xb2,0xb,0x13,0x7,0xb,0xb,0x1,0x1,0x7,0x7,0x9,0x18,0x11,0xe,0x23,0x15,0xe,0x18,0xa,0xd,0x13,0x6,0x3,0x4,0x1,0xb9,0xb,0x19,0xe,0x19,0x3c,0x22,0x38,0x5d,0x23,0x1f,0x2d,0xf,0xd,0xe,0x1,0xd7,0x1,0x4,0x3,0x9,0x15,0xd,0x12,0x2c,0x1c,0x1a,0x2a,0x10,0x1b,0x21,0x8,0x5,0x4,0x6,0x7,0x7,0x1b,0x11,0x13,0x31,0x1f,0x1c,0x2d,0x12,0x9,0x10,0x2,0x40,0x83,0x32,0x5d,0x2a,0x47,0x76,0x23,0x1b,0x1e,0x1e,0x1c,0xf,0x25,0x15,0x19,0x2a,0xf,0x19,0x19,0x1,0x29,0x2b,0x2c,0x61,0x40,0x37,0x83,0x4b,0x40,0x7f,0x3d,0x26,0x4c,0x25,0x1,0x27,0x4f,0x28,0x3c,0x7b,0x3d,0x39,0x66,0x2c,0x30,0x4d,0x1a,0x15,0x17,0x1,0xb,0xa,0xd,0x29,0x19,0x12,0x27,0x15,0x4,0xe4,0xfd,0xed,0xc,0x15,0x8,0xf,0x11,0x2e,0x2a,0x25,0x64,0x3a,0x36,0x7b,0xe6,0xfd,0xcc,0x17,0x2a,0x14,0x10,0x1c,0xa,0x10,0x12,0x1,0x11,0xf,0x17,0x53,0x31,0x1c,0x3e,0x20,0x83,0x2e,0x58,0x27,0x2a,0x49,0x1a,0x1a,0x1d,0x13,0x10,0x8,0x13,0x0,0x1,0x0,0x37,0xff,0xea,0x4,0x8a,0x5,0xb0,0x0,0x53,0x0,0x0,0x41,0x15,0x16,0x16,0x17,0x16,0x16,0x37,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x23,0x16,0x16,0x17,0x16,0x16,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x1,0xf7,0x3,0x1f,0x1d,0x25,0x75,0x4e,0x4a,0x83,0x31,0x1b,0x2a,0xe,0xb,0xd,0x1,0x2,0x2a,0x1a,0xb3,0x10,0x19,0x7,0x6,0x6,0x1,0x7,0x6,0x6,0x10,0xb,0x16,0x41,0x2b,0x1b,0x29,0xe,0xe,0xe,0x13,0x16,0x16,0x45,0x31,0x1d,0x33,0x15,0x2b,0x2f,0x39,0x36,0x36,0x9b,0x62,0xe1,0xe1,0x3b,0x57,0x1d,0x1d,0x1d,0x1e,0x1f,0x1e,0x5d,0x40,0x52,0x85,0x2a,0x45,0x19,0x18,0x1b,0x1,0x72,0x67,0x41,0x64,0x23,0x2e,0x2b,0x1,0x47,0x46,0x26,0x62,0x3b,0x2e,0x6c,0x3c,0x67,0xca,0x62,0x38,0x71,0x38,0x2c,0x5a,0x2c,0x2d,0x53,0x25,0x22,0x3d,0x1a,0x35,0x3b,0x1,0x16,0x13,0x12,0x32,0x1c,0x69,0x3b,0x6a,0x2c,0x2c,0x43,0x15,0xf,0x27,0x17,0x31,0x81,0x4d,0x64,0x9a,0x34,0x33,0x36,0x98,0x24,0x21,0x22,0x5f,0x3b,0x40,0x63,0x21,0x1f,0x21,0x98,0x27,0x23,0x23,0x62,0x0,0x1,0x0,0x50,0xff,0xe4,0x4,0x7c,0x4,0x3a,0x0,0x50,0x0,0x0,0x41,0x34,0x26,0x27,0x26,0x26,0x23,0x23,0x17,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x17,0x33,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x37,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x26,0x26,0x27,0x23,0x16,0x16,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x2,0xdd,0x39,0x36,0x37,0x9e,0x64,0xe5,0x6,0xdf,0x42,0x5e,0x1d,0x19,0x18,0x13,0x13,0x1b,0x62,0x47,0x95,0x2,0xad,0x37,0x52,0x1a,0x15,0x17,0x1e,0x1d,0x22,0x6e,0x49,0x32,0x5c,0x27,0x1a,0x31,0x12,0x16,0x1c,0x1,0x1,0x9,0x8,0xa,0x1b,0xe,0xb4,0x1e,0x21,0x2,0x1,0x12,0x11,0x12,0x33,0x22,0x18,0x22,0xa,0xb,0xc,0x1d,0x20,0x16,0x3e,0x29,0x27,0x3f,0x17,0x1f,0x20,0x2,0xf8,0x4c,0x78,0x29,0x29,0x2c,0x96,0x1e,0x1b,0x17,0x3e,0x24,0x1f,0x34,0x14,0x1c,0x1f,0x96,0x1,0x18,0x18,0x12,0x35,0x21,0x43,0x3b,0x59,0x1f,0x24,0x23,0x2,0x21,0x20,0x16,0x40,0x28,0x32,0x7f,0x4d,0x25,0x4a,0x25,0x2b,0x56,0x2a,0x4e,0xa3,0x4e,0x42,0x6c,0x26,0x27,0x2b,0xa,0xa,0xb,0x23,0x16,0x4d,0x33,0x57,0x21,0x16,0x23,0xb,0xf,0x26,0x17,0x1e,0x4d,0x0,0x0,0x1,0x0,0xb3,0xfe,0xa5,0x4,0x52,0x5,0xb0,0x0,0x45,0x0,0x0,0x41,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x33,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x23,0x26,0x34,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x21,0x15,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x1,0x10,0xdb,0x3c,0x61,0x23,0x22,0x26,0x3,0x6,0x6,0x19,0x17,0x56,0xa,0xb,0xa,0x22,0x16,0x73,0x2a,0x40,0x17,0x16,0x17,0xa5,0x1,0x19,0x1b,0x1b,0x56,0x3e,0x28,0x44,0x1b,0x2f,0x31,0x42,0x3e,0x3f,0xb6,0x74,0xfe,0xec,0x1,0x14,0x4e,0x73,0x26,0x25,0x24,0x20,0x21,0x27,0x81,0x5b,0xa3,0x2,0x79,0x25,0x22,0x23,0x62,0x3c,0x84,0x13,0x3f,0x22,0x23,0x41,0x15,0x1,0x22,0x48,0x24,0x24,0x48,0x21,0x3f,0x24,0x5c,0x33,0x32,0x67,0x2f,0xb0,0x7,0xd,0x7,0x88,0x3d,0x6c,0x2c,0x2c,0x42,0x14,0x12,0x2c,0x1a,0x2e,0x78,0x4a,0x66,0x9b,0x34,0x34,0x35,0x98,0x24,0x21,0x22,0x61,0x3c,0x3c,0x5c,0x20,0x25,0x26,0x0,0x1,0x0,0xd0,0xfe,0x92,0x4,0x30,0x4,0x3a,0x0,0x49,0x0,0x0,0x41,0x33,0x16,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x33,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x17,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x22,0x22,0x23,0x34,0x34,0x35,0x34,0x34,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x21,0x7,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x23,0x1,0x19,0xf1,0x34,0x50,0x1b,0x19,0x1b,0x2,0x5,0x5,0x16,0x14,0x54,0xb,0xc,0xb,0x20,0x16,0x73,0x2a,0x40,0x17,0x16,0x17,0x33,0x4c,0x1a,0x15,0x17,0x17,0x49,0x34,0x28,0x40,0x18,0x1f,0x21,0x3a,0x37,0x37,0x9e,0x64,0xfe,0xe4,0x1,0x1,0x1d,0x41,0x5f,0x1d,0x1a,0x19,0x1b,0x1d,0x1d,0x5c,0x3f,0xd4,0x1,0xb9,0x1,0x18,0x17,0x16,0x3f,0x28,0x5f,0xd,0x2f,0x19,0x1a,0x30,0xe,0x2,0x27,0x54,0x29,0x24,0x45,0x20,0x3f,0x24,0x5c,0x33,0x32,0x67,0x2f,0xb0,0x15,0x13,0x11,0x4,0xc,0x7,0x2e,0x51,0x21,0x21,0x32,0xf,0xf,0x26,0x17,0x1f,0x4f,0x30,0x4d,0x77,0x29,0x29,0x2b,0x96,0x1c,0x1a,0x17,0x3e,0x26,0x26,0x3d,0x15,0x15,0x17,0x0,0x0,0x1,0x0,0x14,0xff,0xea,0x4,0xa4,0x5,0xb0,0x0,0x4e,0x0,0x0,0x41,0x3,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x37,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x7,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x3,0x21,0x3,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x23,0x15,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x3,0x2,0x63,0x1,0x2,0x12,0x11,0x10,0x2e,0x1d,0x1b,0x41,0x26,0x42,0x73,0x2b,0x1c,0x29,0xb,0x7,0x7,0x1,0x1,0x6,0x6,0x6,0x13,0xb,0xb3,0x14,0x15,0x1,0x4,0x3,0x4,0xd,0x9,0x11,0x31,0x22,0xc,0x13,0x8,0x9,0xc,0x5,0x4,0x3,0x1,0xfd,0xc7,0x1,0x2,0x1,0x4,0x11,0xf,0xb,0x1e,0x14,0x11,0x29,0x18,0x17,0x22,0x3a,0x5e,0x25,0x1b,0x2e,0x12,0x1d,0x22,0x7,0x3,0x3,0x1,0x5,0x18,0xfb,0xf7,0x35,0x57,0x21,0x20,0x2e,0xf,0xe,0xd,0x1,0x48,0x46,0x2d,0x75,0x47,0x28,0x57,0x30,0x30,0x5f,0x2e,0x36,0x6b,0x35,0x1,0x64,0xca,0x64,0x25,0x46,0x20,0x2a,0x4a,0x1e,0x35,0x3c,0x1,0x9,0x8,0xb,0x1c,0x10,0x10,0x23,0x12,0x4,0xa1,0xfd,0x50,0x2e,0x56,0x27,0x5b,0x91,0x36,0x2a,0x3d,0x13,0x11,0x11,0x97,0x21,0x21,0x19,0x43,0x2a,0x45,0xb8,0x70,0x2f,0x66,0x36,0x2,0x18,0x0,0x1,0x0,0x2f,0xff,0xea,0x4,0x85,0x4,0x3a,0x0,0x4b,0x0,0x0,0x41,0x21,0x11,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x7,0x7,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x11,0x33,0x11,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x37,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x23,0x16,0x16,0x17,0x16,0x16,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x2,0xfa,0xfd,0xc9,0x3,0x4,0x3,0x8,0x6,0xe,0x30,0x24,0x17,0x3,0x26,0x32,0x51,0x1f,0x21,0x30,0x11,0xb,0xf,0x4,0x2,0x3,0xc5,0x12,0xe,0xf,0x2d,0x1d,0x1c,0x45,0x28,0x30,0x57,0x25,0x25,0x3c,0x13,0xe,0x11,0x1,0x2,0x28,0x1b,0xb3,0xe,0x17,0x7,0x8,0x8,0x1,0x1,0x6,0x7,0x8,0x1b,0x12,0xe,0x22,0x14,0xb,0x12,0x7,0xb,0xf,0x4,0x4,0x3,0x4,0x3a,0xfe,0x34,0x40,0x70,0x2e,0x22,0x3b,0x18,0x3a,0x3b,0x1,0xa5,0x1e,0x1d,0x1f,0x5d,0x40,0x2c,0x68,0x3b,0x27,0x54,0x2d,0x1,0x33,0xfd,0x80,0x34,0x56,0x22,0x24,0x36,0x11,0x10,0x10,0x1,0x23,0x21,0x22,0x65,0x41,0x32,0x77,0x44,0x61,0xbf,0x5d,0x2e,0x5d,0x2f,0x30,0x62,0x31,0x2f,0x56,0x25,0x2f,0x4d,0x15,0x13,0x13,0x1,0x9,0x8,0xb,0x22,0x18,0x10,0x25,0x14,0x0,0x0,0x1,0x0,0x6f,0xff,0xea,0x4,0x94,0x5,0xb0,0x0,0x38,0x0,0x0,0x41,0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x37,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x26,0x26,0x27,0x7,0x16,0x16,0x7,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x3,0xc,0xb9,0xfe,0xd5,0xb9,0xb9,0x1,0x2b,0x1,0x10,0xd,0x12,0x27,0x1c,0x1c,0x48,0x2a,0x43,0x73,0x2b,0x18,0x26,0xc,0x9,0xa,0x1,0x1,0x9,0x9,0x9,0x1a,0xe,0xb2,0x1c,0x20,0x2,0x4,0x4,0x4,0xd,0x9,0x10,0x31,0x22,0xa,0x10,0x7,0xc,0xf,0x5,0x4,0x3,0x5,0xb0,0xfd,0x6c,0x2,0x94,0xfa,0x50,0x2,0x85,0xfe,0xaf,0x36,0x5f,0x1e,0x2b,0x33,0x13,0x13,0x13,0x1,0x48,0x46,0x28,0x66,0x3d,0x2e,0x66,0x39,0x30,0x60,0x2f,0x35,0x6b,0x34,0x1,0x64,0xca,0x64,0x26,0x49,0x20,0x29,0x47,0x1d,0x36,0x3c,0x1,0x8,0x7,0xc,0x26,0x19,0x14,0x2c,0x18,0x0,0x1,0x0,0x75,0xff,0xea,0x4,0x7e,0x4,0x3a,0x0,0x35,0x0,0x0,0x41,0x15,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x37,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x23,0x16,0x16,0x7,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x11,0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x2,0x3b,0x2,0xe,0xd,0x12,0x3d,0x2a,0x1b,0x3e,0x24,0x3f,0x6d,0x29,0x16,0x22,0xc,0x9,0xb,0x1,0x2,0x1e,0x14,0xb2,0x14,0x16,0x1,0x4,0x4,0x4,0xb,0x7,0xe,0x2c,0x1d,0xe,0x18,0x9,0xb,0x10,0x5,0x6,0x5,0xb9,0xfe,0xf3,0xb9,0xb9,0x1,0xcd,0xac,0x2f,0x50,0x20,0x30,0x41,0x11,0xb,0xb,0x1,0x41,0x40,0x23,0x58,0x35,0x2c,0x64,0x38,0x61,0xbf,0x5d,0x5e,0xc0,0x5f,0x25,0x45,0x1f,0x21,0x3b,0x19,0x2f,0x34,0x1,0xa,0x9,0xa,0x1a,0x10,0x12,0x2c,0x1a,0x3,0x19,0xfe,0x2a,0x1,0xd6,0xfb,0xc6,0x1,0xcd,0x0,0x0,0x1,0x0,0x8e,0xff,0xeb,0x4,0x76,0x5,0xc5,0x0,0x3c,0x0,0x0,0x45,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x23,0x16,0x16,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x37,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x11,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x2,0x94,0x60,0xad,0x42,0x41,0x4e,0x2,0x2,0x26,0x14,0xb3,0x17,0x1d,0x2,0x1,0x26,0x24,0x25,0x6f,0x48,0x4f,0x7c,0x2a,0x2b,0x2d,0x11,0x11,0x14,0x43,0x2c,0x23,0x54,0x31,0x56,0x8f,0x41,0x3b,0x43,0xae,0x70,0x44,0x7b,0x34,0x4b,0x6f,0x23,0x1a,0x1c,0x20,0x1d,0x1f,0x5e,0x3b,0x39,0x8a,0x15,0x37,0x38,0x37,0xa8,0x70,0x59,0xb7,0x59,0x5a,0xb5,0x5a,0x42,0x6b,0x26,0x28,0x2b,0x1,0x4a,0x40,0x40,0xaa,0x5f,0x1,0x8,0x3a,0x6e,0x31,0x3c,0x64,0x20,0x1a,0x1d,0x23,0x21,0x84,0x2c,0x2c,0x21,0x1f,0x2b,0x89,0x53,0x40,0x93,0x50,0xfe,0xfa,0x55,0x9c,0x43,0x47,0x75,0x27,0x28,0x2b,0x0,0x0,0x1,0x0,0xa0,0xff,0xeb,0x4,0x50,0x4,0x4e,0x0,0x36,0x0,0x0,0x65,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x37,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x34,0x26,0x27,0x23,0x16,0x16,0x15,0x6,0x6,0x7,0x6,0x6,0x2,0xb4,0x5b,0x83,0x2a,0x2a,0x28,0x25,0x28,0x28,0x7a,0x56,0x51,0x8c,0x36,0x2c,0x1c,0x48,0x2a,0x26,0x59,0x32,0x7b,0xbe,0x41,0x41,0x44,0x47,0x44,0x43,0xc6,0x80,0x57,0x95,0x37,0x37,0x40,0x2,0x10,0xb,0xb2,0xe,0x6,0x1,0x18,0x19,0x1b,0x58,0x82,0x45,0x38,0x37,0x8b,0x47,0x2a,0x46,0x8a,0x38,0x37,0x45,0x1e,0x1c,0x90,0x11,0x1a,0x8,0x7,0x8,0x59,0x4a,0x4a,0xc3,0x6c,0x2a,0x6c,0xc4,0x4a,0x4a,0x59,0x29,0x2a,0x2a,0x80,0x57,0x36,0x6e,0x36,0x36,0x6f,0x35,0x2c,0x44,0x18,0x1a,0x1a,0x0,0x1,0x0,0x4c,0xff,0xea,0x4,0x95,0x5,0xb0,0x0,0x31,0x0,0x0,0x41,0x11,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x37,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x7,0x16,0x16,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x11,0x21,0x35,0x21,0x15,0x1,0xb5,0x2,0xe,0xb,0x14,0x3f,0x2c,0x25,0x5a,0x35,0x52,0x90,0x36,0x1d,0x2d,0xf,0xe,0xf,0x1,0x3,0x2a,0x1b,0xb3,0x1d,0x21,0x2,0x1,0x9,0x8,0x7,0x12,0xc,0x1b,0x4f,0x35,0x16,0x25,0x10,0x15,0x20,0xa,0x5,0x6,0x1,0x86,0xfc,0x58,0x5,0x18,0xfc,0x41,0x30,0x52,0x23,0x37,0x53,0x17,0x15,0x14,0x1,0x47,0x46,0x25,0x5c,0x37,0x31,0x71,0x3f,0x67,0xca,0x62,0x1,0x64,0xca,0x64,0x30,0x57,0x26,0x20,0x39,0x18,0x35,0x3b,0x1,0xc,0xc,0xf,0x34,0x21,0x15,0x2e,0x18,0x3,0xbf,0x98,0x98,0x0,0x0,0x1,0x0,0x49,0xff,0xea,0x4,0x6a,0x4,0x3a,0x0,0x28,0x0,0x0,0x41,0x11,0x16,0x16,0x17,0x16,0x16,0x37,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x26,0x27,0x26,0x26,0x27,0x23,0x16,0x16,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x22,0x26,0x27,0x26,0x26,0x35,0x11,0x21,0x35,0x21,0x15,0x1,0x9a,0x4,0x2f,0x2a,0x2a,0x7c,0x4e,0x4e,0x89,0x34,0x34,0x3d,0x2,0x1,0xb,0x9,0xa,0x19,0xd,0xb2,0x1d,0x21,0x2,0x2,0x19,0x19,0x19,0x48,0x30,0x25,0x38,0x13,0x14,0x13,0x1,0x7a,0xfc,0x7b,0x3,0xa4,0xfd,0xb5,0x5e,0x8b,0x2d,0x2e,0x2b,0x1,0x39,0x39,0x38,0xa7,0x6e,0x29,0x52,0x29,0x29,0x51,0x27,0x4e,0xa8,0x4f,0x42,0x6c,0x27,0x27,0x2b,0x1,0x21,0x1d,0x1d,0x4e,0x2e,0x2,0x4b,0x96,0x96,0x0,0x0,0x1,0x0,0x6c,0xff,0xec,0x4,0x6f,0x5,0xc5,0x0,0x4c,0x0,0x0,0x53,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x23,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x33,0x35,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x6d,0x51,0x48,0x47,0xc3,0x73,0x5b,0xb0,0x46,0x45,0x56,0xb9,0x1,0x2d,0x28,0x29,0x70,0x44,0x51,0x81,0x2d,0x2d,0x31,0x2d,0x2b,0x2b,0x7d,0x4f,0xb6,0xb6,0x50,0x76,0x26,0x27,0x26,0x29,0x29,0x28,0x7b,0x52,0x3c,0x68,0x27,0x26,0x2d,0x1,0xb9,0x4c,0x40,0x41,0xac,0x5f,0x73,0xbd,0x43,0x44,0x4a,0x21,0x1f,0x1e,0x58,0x37,0x34,0x55,0x1f,0x2c,0x2f,0x1,0x96,0x67,0x9f,0x36,0x36,0x38,0x31,0x34,0x34,0xa0,0x6f,0x39,0x64,0x25,0x25,0x2b,0x28,0x24,0x24,0x64,0x3c,0x45,0x63,0x21,0x20,0x1f,0x98,0x24,0x21,0x20,0x5b,0x38,0x37,0x5e,0x23,0x23,0x28,0x26,0x21,0x21,0x5c,0x36,0x5d,0x95,0x34,0x34,0x38,0x35,0x34,0x35,0x9b,0x66,0x33,0x5e,0x28,0x29,0x42,0x17,0x11,0x33,0x20,0x2d,0x79,0xff,0xff,0x0,0xa6,0xfe,0x6a,0x4,0x3b,0x0,0x0,0x4,0x27,0x0,0x66,0x0,0xb,0xff,0x1,0x0,0x6,0x0,0x66,0xb,0x0,0x0,0x1,0x1,0xcf,0x4,0x7,0x2,0xe2,0x6,0x16,0x0,0xc,0x0,0x0,0x41,0x35,0x33,0x15,0x14,0x16,0x17,0x7,0x26,0x26,0x27,0x26,0x26,0x1,0xcf,0xb5,0x2f,0x2f,0x65,0x2a,0x40,0x16,0x17,0x17,0x5,0x83,0x93,0x96,0x56,0x94,0x47,0x48,0x24,0x5c,0x33,0x32,0x68,0x0,0xff,0xff,0x1,0x5c,0xff,0xed,0x4,0x3a,0x1,0x7,0x4,0x27,0x0,0x60,0xff,0x6c,0x0,0x0,0x0,0x7,0x0,0x60,0x1,0x26,0x0,0x0,0x0,0x2,0x1,0xf,0x2,0x38,0x4,0x18,0x5,0xc3,0x0,0xa,0x0,0xe,0x0,0x0,0x41,0x11,0x23,0x1,0x17,0x21,0x15,0x33,0x35,0x33,0x35,0x21,0x1,0x37,0x11,0x3,0x81,0xa9,0xfe,0x37,0x3,0x1,0xcc,0xa3,0x97,0xfd,0xac,0x1,0x4,0x16,0x3,0x6f,0x2,0x54,0xfd,0x8c,0x5e,0xb9,0xb9,0x7e,0x1,0x5c,0x2c,0xfe,0x78,0x0,0x0,0x1,0x1,0x4b,0x2,0x8b,0x3,0xc9,0x5,0xba,0x0,0x1f,0x0,0x0,0x41,0x23,0x11,0x33,0x11,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x11,0x33,0x11,0x34,0x26,0x27,0x26,0x26,0x23,0x6,0x6,0x7,0x6,0x6,0x7,0x1,0xcc,0x81,0xaa,0x9,0x1a,0x11,0x14,0x33,0x1f,0x21,0x34,0x13,0x13,0x15,0xaa,0x24,0x22,0x22,0x5f,0x3c,0x2a,0x49,0x1e,0x17,0x26,0xf,0x5,0xab,0xfc,0xe0,0x2,0x32,0x17,0x26,0xe,0x10,0x12,0x14,0x16,0x17,0x4c,0x36,0xfe,0x24,0x1,0xfc,0x50,0x74,0x26,0x25,0x24,0x1,0x19,0x16,0x11,0x2e,0x1b,0x0,0x1,0x0,0x7f,0xff,0xeb,0x4,0x39,0x5,0xc4,0x0,0x37,0x0,0x0,0x41,0x35,0x21,0x35,0x21,0x35,0x21,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x37,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x23,0x15,0x33,0x15,0x23,0x15,0x33,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x3,0x6e,0xfe,0x7e,0x1,0x82,0xfe,0x7e,0x36,0x2d,0x2d,0x7e,0x4e,0x3c,0x6f,0x34,0x12,0x3d,0x75,0x3f,0x74,0xc0,0x46,0x45,0x57,0xb3,0xb3,0xb3,0xb3,0x56,0x44,0x46,0xc3,0x75,0x3f,0x78,0x38,0x12,0x34,0x6e,0x3b,0x4f,0x80,0x2d,0x2b,0x37,0x2,0x1f,0x7a,0x8a,0x7b,0x1,0x56,0xa4,0x31,0x31,0x32,0x13,0x10,0x9b,0xe,0x11,0x46,0x45,0x44,0xde,0x77,0x2,0x7b,0x8a,0x7a,0x5,0x80,0xdc,0x44,0x47,0x48,0x10,0xf,0x9a,0x11,0x11,0x34,0x34,0x31,0xa2,0x5d,0x5,0x0,0x4,0x0,0x49,0xff,0xeb,0x4,0x94,0x5,0xc5,0x0,0x33,0x0,0x4d,0x0,0x67,0x0,0x6b,0x0,0x0,0x41,0x23,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x13,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x5,0x1,0x27,0x1,0x2,0x4c,0x8a,0xf,0xe,0xf,0x2b,0x1e,0x1f,0x2d,0xf,0xf,0xf,0xf,0xf,0xe,0x2d,0x1e,0x1e,0x2c,0xf,0xf,0xf,0x8a,0x24,0x21,0x21,0x5f,0x3c,0x3d,0x60,0x21,0x21,0x23,0x23,0x22,0x21,0x61,0x3d,0x3b,0x5f,0x21,0x21,0x23,0x42,0x23,0x22,0x21,0x61,0x3d,0x3d,0x60,0x21,0x21,0x23,0x23,0x21,0x22,0x60,0x3d,0x3d,0x60,0x21,0x22,0x23,0x8b,0xe,0xf,0xf,0x2d,0x1f,0x1f,0x2d,0xf,0xf,0xe,0xe,0xf,0xf,0x2d,0x1e,0x1f,0x2e,0xf,0xf,0xe,0xfe,0x9c,0x2,0x2,0x72,0xfd,0xff,0x4,0x1e,0x18,0x30,0x13,0x13,0x18,0x1f,0x19,0x19,0x40,0x22,0x4d,0x22,0x42,0x19,0x19,0x1f,0x16,0x13,0x13,0x32,0x1b,0x35,0x5d,0x23,0x23,0x29,0x30,0x29,0x2a,0x6d,0x3d,0x4d,0x3c,0x6d,0x29,0x29,0x30,0x28,0x23,0x22,0x5d,0xfd,0x7b,0x4e,0x3d,0x6d,0x29,0x29,0x30,0x30,0x29,0x29,0x6d,0x3d,0x4e,0x3d,0x6d,0x29,0x29,0x30,0x30,0x29,0x29,0x6d,0x8b,0x4e,0x22,0x41,0x1a,0x19,0x1e,0x1e,0x19,0x1a,0x41,0x22,0x4e,0x23,0x40,0x19,0x1a,0x1e,0x1e,0x1a,0x19,0x40,0x1f,0x3,0xba,0x42,0xfc,0x46,0x0,0x0,0x2,0x0,0xdd,0xff,0xeb,0x3,0xf3,0x5,0xc9,0x0,0x2c,0x0,0x40,0x0,0x0,0x45,0x35,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x11,0x6,0x6,0x23,0x15,0x32,0x36,0x37,0x15,0x14,0x16,0x17,0x16,0x16,0x3,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x3,0x54,0x44,0x5a,0x1c,0x1c,0x17,0x60,0x93,0x33,0x32,0x34,0x27,0x24,0x24,0x64,0x3c,0x3f,0x67,0x26,0x1a,0x27,0xe,0xd,0xe,0x2f,0x68,0x3a,0x38,0x68,0x31,0x33,0x35,0x34,0x9e,0x81,0x14,0x15,0xf,0x2a,0x1b,0x15,0x22,0xa,0xa,0xb,0x1a,0x1a,0x1a,0x4f,0x15,0x9d,0x29,0x27,0x26,0x6d,0x44,0x57,0x34,0x91,0x52,0x51,0xa9,0x4d,0x29,0x48,0x74,0x2a,0x29,0x2d,0x27,0x24,0x19,0x40,0x26,0x26,0x59,0x32,0xfe,0x21,0xd,0xe,0xb0,0xd,0xc,0xe,0x65,0xa6,0x3b,0x3c,0x42,0x2,0xdc,0x1,0x87,0x3e,0x5c,0x1c,0x13,0x14,0x16,0x15,0x14,0x3a,0x25,0x2b,0x38,0x71,0x35,0x36,0x60,0x0,0x4,0x0,0x79,0x0,0x0,0x4,0x76,0x5,0xc0,0x0,0x9,0x0,0x23,0x0,0x3d,0x0,0x41,0x0,0x0,0x61,0x11,0x23,0x13,0x1,0x23,0x11,0x33,0x3,0x1,0x1,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x13,0x35,0x21,0x15,0x2,0xe3,0xb0,0x1,0xfe,0xf4,0xaf,0xb0,0x1,0x1,0xb,0x1,0x3,0x15,0x15,0x14,0x3b,0x27,0x27,0x3c,0x14,0x14,0x15,0x15,0x14,0x14,0x3d,0x27,0x26,0x3c,0x14,0x14,0x15,0x65,0x5,0x6,0x6,0x17,0x12,0x13,0x17,0x7,0x6,0x5,0x4,0x6,0x7,0x17,0x13,0x13,0x17,0x6,0x7,0x4,0xd9,0xfe,0xcd,0x5,0xb0,0xfc,0x71,0x3,0x8f,0xfa,0x50,0x3,0x93,0xfc,0x6d,0x4,0xfb,0xce,0x28,0x47,0x1a,0x1b,0x1f,0x1f,0x1b,0x1a,0x47,0x28,0xce,0x28,0x48,0x1b,0x1b,0x1f,0x1f,0x1b,0x1b,0x48,0xed,0xbc,0x16,0x28,0xf,0xe,0x11,0x11,0xe,0xf,0x28,0x16,0xbc,0x17,0x27,0xe,0xf,0x11,0x11,0xf,0xe,0x27,0xfe,0xa8,0x5f,0x5f,0x0,0x2,0x0,0x99,0xff,0xec,0x4,0x94,0x4,0x4e,0x0,0x21,0x0,0x2a,0x0,0x0,0x65,0x27,0x6,0x6,0x27,0x22,0x26,0x27,0x11,0x21,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x1,0x32,0x16,0x17,0x11,0x21,0x11,0x36,0x36,0x4,0x17,0x2,0x59,0xb9,0x5e,0x4e,0x8c,0x37,0x3,0x0,0x4e,0x42,0x43,0xb5,0x67,0x42,0x81,0x3a,0x3b,0x63,0x24,0x24,0x29,0x52,0x47,0x46,0xbf,0x6e,0x63,0xba,0xfe,0xe3,0x4d,0x88,0x36,0xfd,0xe4,0x39,0x8c,0x5e,0x68,0x3f,0x3c,0x1,0x3b,0x33,0x1,0x48,0x2f,0x73,0xc6,0x49,0x49,0x52,0x29,0x25,0x25,0x67,0x3e,0x3e,0x8f,0x4c,0x73,0xcc,0x4c,0x4d,0x59,0x3d,0x3,0xc7,0x3e,0x33,0xfe,0xe2,0x1,0x15,0x38,0x42,0x0,0x5,0x0,0x50,0xff,0xf6,0x4,0xb9,0x5,0xae,0x0,0x6,0x0,0x36,0x0,0x4e,0x0,0x66,0x0,0x6a,0x0,0x0,0x41,0x11,0x23,0x5,0x15,0x37,0x11,0x5,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x1,0x1,0x27,0x1,0x1,0x9f,0x10,0xfe,0xc1,0xc2,0x3,0x96,0x26,0x21,0x21,0x5c,0x35,0x36,0x5b,0x22,0x21,0x25,0x15,0x14,0xc,0x23,0x13,0x17,0x29,0xf,0x15,0x19,0x2a,0x24,0x24,0x62,0x38,0x37,0x62,0x24,0x23,0x29,0x1d,0x1a,0xe,0x24,0x14,0x13,0x20,0xd,0x15,0x16,0x7a,0x13,0x11,0x11,0x2d,0x1b,0x1f,0x32,0x11,0xd,0xf,0x12,0x10,0x10,0x2f,0x1c,0x1b,0x2e,0x11,0x10,0x14,0x13,0xf,0xd,0xf,0x27,0x18,0x1b,0x29,0xe,0xd,0xd,0xe,0xd,0xe,0x28,0x1a,0x17,0x27,0xd,0x10,0x10,0xfd,0x7a,0x2,0x2,0x72,0xfd,0xff,0x2,0xe8,0x2,0xc6,0x69,0x73,0x33,0xfd,0xe3,0xdf,0x31,0x4a,0x19,0x19,0x1a,0x1a,0x19,0x19,0x4a,0x31,0x1f,0x36,0x16,0xe,0x19,0xa,0x9,0x1b,0x10,0x17,0x3c,0x24,0x33,0x4c,0x1a,0x1a,0x19,0x19,0x1a,0x1a,0x4c,0x33,0x27,0x41,0x18,0xd,0x16,0x8,0x9,0x17,0xd,0x16,0x38,0xfe,0xe5,0x18,0x25,0xd,0xc,0xe,0x10,0xf,0xd,0x23,0x15,0x18,0x25,0xc,0xd,0xd,0xd,0xd,0xc,0x25,0x1,0x1c,0x15,0x22,0xc,0xb,0xe,0xf,0xd,0xc,0x20,0x14,0x15,0x21,0xc,0xc,0xd,0xc,0xb,0xb,0x23,0xfe,0xbe,0x3,0xba,0x42,0xfc,0x46,0x0,0x5,0x0,0x33,0xff,0xf6,0x4,0xc1,0x5,0xba,0x0,0x4c,0x0,0x7c,0x0,0x94,0x0,0xac,0x0,0xb0,0x0,0x0,0x53,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x33,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x1,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x1,0x1,0x27,0x1,0xea,0x4b,0x22,0x37,0x13,0x11,0x12,0xf,0xe,0x12,0x31,0x20,0x22,0x34,0x11,0xe,0xe,0x8e,0x2e,0x26,0x24,0x61,0x33,0x3a,0x64,0x26,0x25,0x2a,0x15,0x16,0x10,0x2e,0x1e,0x19,0x27,0x10,0x14,0x17,0x27,0x23,0x23,0x61,0x3a,0x36,0x5d,0x23,0x23,0x28,0x8d,0xe,0xc,0x10,0x30,0x1d,0x1f,0x2f,0xf,0xd,0xe,0x13,0x12,0x11,0x2f,0x1f,0x3,0x7b,0x26,0x21,0x21,0x5c,0x35,0x36,0x5b,0x22,0x21,0x25,0x15,0x14,0xc,0x23,0x13,0x17,0x29,0xf,0x15,0x19,0x2a,0x24,0x24,0x62,0x38,0x37,0x62,0x24,0x23,0x29,0x1d,0x1a,0xe,0x24,0x14,0x13,0x20,0xd,0x15,0x16,0x7a,0x13,0x11,0x11,0x2d,0x1b,0x1f,0x32,0x11,0xd,0xf,0x12,0x10,0x10,0x2f,0x1c,0x1b,0x2e,0x11,0x10,0x14,0x13,0xf,0xd,0xf,0x27,0x18,0x1b,0x29,0xe,0xd,0xd,0xe,0xd,0xe,0x28,0x1a,0x17,0x27,0xd,0x10,0x10,0xfd,0x99,0x2,0x2,0x72,0xfd,0xff,0x4,0x87,0x68,0xd,0xd,0xc,0x27,0x1b,0x15,0x24,0xd,0xe,0x10,0x12,0x10,0xb,0x20,0x12,0x37,0x4f,0x19,0x1b,0x18,0x1c,0x1a,0x1a,0x4e,0x32,0x24,0x3b,0x15,0x10,0x1a,0x8,0x9,0x19,0xf,0x16,0x35,0x1e,0x31,0x4c,0x1a,0x19,0x1a,0x1c,0x19,0x1a,0x4a,0x2e,0x11,0x1c,0xb,0xd,0xe,0xf,0xe,0xc,0x21,0x13,0x17,0x26,0xd,0xb,0xd,0xfd,0x82,0x31,0x4a,0x19,0x19,0x1a,0x1a,0x19,0x19,0x4a,0x31,0x1f,0x36,0x16,0xe,0x19,0xa,0x9,0x1b,0x10,0x17,0x3c,0x24,0x33,0x4c,0x1a,0x1a,0x19,0x19,0x1a,0x1a,0x4c,0x33,0x27,0x41,0x18,0xd,0x16,0x8,0x9,0x17,0xd,0x16,0x38,0xfe,0xe5,0x18,0x25,0xd,0xc,0xe,0x10,0xf,0xd,0x23,0x15,0x18,0x25,0xc,0xd,0xd,0xd,0xd,0xc,0x25,0x1,0x1c,0x15,0x22,0xc,0xb,0xe,0xf,0xd,0xc,0x20,0x14,0x15,0x21,0xc,0xc,0xd,0xc,0xb,0xb,0x23,0xfe,0xb5,0x3,0xba,0x42,0xfc,0x46,0x0,0x0,0x5,0x0,0x24,0xff,0xfa,0x4,0xad,0x5,0xb1,0x0,0x2d,0x0,0x5d,0x0,0x75,0x0,0x8d,0x0,0x91,0x0,0x0,0x53,0x17,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x23,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x37,0x21,0x35,0x21,0x1,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x1,0x1,0x27,0x1,0x37,0x70,0xb,0x16,0xe,0xe,0x24,0x17,0x41,0x48,0xe,0x10,0xf,0x2e,0x20,0x35,0x43,0x5,0x8c,0x3,0x2d,0x24,0x25,0x5d,0x33,0x42,0x64,0x21,0x21,0x20,0x21,0x20,0x1f,0x5b,0x39,0x28,0x43,0x12,0x14,0x1,0x3a,0xfe,0x52,0x4,0x38,0x26,0x21,0x21,0x5c,0x35,0x36,0x5b,0x22,0x21,0x25,0x15,0x14,0xc,0x23,0x13,0x17,0x29,0xf,0x15,0x19,0x2a,0x24,0x24,0x62,0x38,0x37,0x62,0x24,0x23,0x29,0x1d,0x1a,0xe,0x24,0x14,0x13,0x20,0xd,0x15,0x16,0x7a,0x13,0x11,0x11,0x2d,0x1b,0x1f,0x32,0x11,0xd,0xf,0x12,0x10,0x10,0x2f,0x1c,0x1b,0x2e,0x11,0x10,0x14,0x13,0xf,0xd,0xf,0x27,0x18,0x1b,0x29,0xe,0xd,0xd,0xe,0xd,0xe,0x28,0x1a,0x17,0x27,0xd,0x10,0x10,0xfd,0x96,0x2,0x2,0x72,0xfd,0xff,0x4,0x47,0x1c,0x8,0xd,0x6,0x5,0x7,0x44,0x39,0x1c,0x2f,0x11,0x12,0x13,0x2c,0x2d,0x30,0x4c,0x1a,0x1b,0x1b,0x27,0x21,0x21,0x59,0x30,0x36,0x57,0x1e,0x1e,0x1f,0x12,0x8,0x99,0x77,0xfc,0x5c,0x31,0x4a,0x19,0x19,0x1a,0x1a,0x19,0x19,0x4a,0x31,0x1f,0x36,0x16,0xe,0x19,0xa,0x9,0x1b,0x10,0x17,0x3c,0x24,0x33,0x4c,0x1a,0x1a,0x19,0x19,0x1a,0x1a,0x4c,0x33,0x27,0x41,0x18,0xd,0x16,0x8,0x9,0x17,0xd,0x16,0x38,0xfe,0xe5,0x18,0x25,0xd,0xc,0xe,0x10,0xf,0xd,0x23,0x15,0x18,0x25,0xc,0xd,0xd,0xd,0xd,0xc,0x25,0x1,0x1c,0x15,0x22,0xc,0xb,0xe,0xf,0xd,0xc,0x20,0x14,0x15,0x21,0xc,0xc,0xd,0xc,0xb,0xb,0x23,0xfe,0xba,0x3,0xba,0x42,0xfc,0x46,0x0,0x5,0x0,0x41,0xff,0xf6,0x4,0xa7,0x5,0xb1,0x0,0x6,0x0,0x36,0x0,0x4e,0x0,0x66,0x0,0x6a,0x0,0x0,0x41,0x35,0x21,0x15,0x21,0x1,0x33,0x5,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x3,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x1,0x1,0x27,0x1,0x2,0x6e,0xfd,0xd3,0x1,0x97,0xfe,0xc5,0x96,0x3,0x63,0x26,0x21,0x21,0x5c,0x35,0x36,0x5b,0x22,0x21,0x25,0x15,0x14,0xc,0x23,0x13,0x17,0x29,0xf,0x15,0x19,0x2a,0x24,0x24,0x62,0x38,0x37,0x62,0x24,0x23,0x29,0x1d,0x1a,0xe,0x24,0x14,0x13,0x20,0xd,0x15,0x16,0x7a,0x13,0x11,0x11,0x2d,0x1b,0x1f,0x32,0x11,0xd,0xf,0x12,0x10,0x10,0x2f,0x1c,0x1b,0x2e,0x11,0x10,0x14,0x13,0xf,0xd,0xf,0x27,0x18,0x1b,0x29,0xe,0xd,0xd,0xe,0xd,0xe,0x28,0x1a,0x17,0x27,0xd,0x10,0x10,0xfd,0x67,0x2,0x2,0x72,0xfd,0xff,0x5,0x60,0x51,0x75,0xfd,0xaf,0xe2,0x31,0x4a,0x19,0x19,0x1a,0x1a,0x19,0x19,0x4a,0x31,0x1f,0x36,0x16,0xe,0x19,0xa,0x9,0x1b,0x10,0x17,0x3c,0x24,0x33,0x4c,0x1a,0x1a,0x19,0x19,0x1a,0x1a,0x4c,0x33,0x27,0x41,0x18,0xd,0x16,0x8,0x9,0x17,0xd,0x16,0x38,0xfe,0xe5,0x18,0x25,0xd,0xc,0xe,0x10,0xf,0xd,0x23,0x15,0x18,0x25,0xc,0xd,0xd,0xd,0xd,0xc,0x25,0x1,0x1c,0x15,0x22,0xc,0xb,0xe,0xf,0xd,0xc,0x20,0x14,0x15,0x21,0xc,0xc,0xd,0xc,0xb,0xb,0x23,0xfe,0xbe,0x3,0xba,0x42,0xfc,0x46,0x0,0x2,0x0,0x7e,0xff,0xeb,0x4,0x46,0x5,0xec,0x0,0x2c,0x0,0x49,0x0,0x0,0x41,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x35,0x34,0x2,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x17,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x26,0x26,0x7,0x32,0x16,0x17,0x16,0x16,0x17,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x2,0x50,0x6e,0xad,0x3c,0x3c,0x3f,0x41,0x3e,0x3e,0xb3,0x72,0x4d,0x83,0x36,0x3f,0x60,0x1a,0x13,0x14,0x41,0x43,0x44,0xcf,0x8f,0x75,0x8e,0x39,0x10,0x47,0x87,0x4e,0x4a,0x82,0x32,0x32,0x42,0xb,0x3c,0xa6,0x49,0x4a,0x6b,0x24,0x24,0x28,0x6,0xc,0xc,0x12,0x3b,0x29,0x20,0x4f,0x30,0x4c,0x70,0x24,0x25,0x24,0x24,0x25,0x25,0x70,0x3,0xfe,0x4b,0x42,0x42,0xb4,0x69,0x17,0x71,0xc1,0x46,0x47,0x51,0x2d,0x29,0x31,0x94,0x5b,0x3e,0x8d,0x4a,0x3b,0xb4,0x1,0x2f,0x6e,0x6e,0x7c,0x2c,0x19,0x97,0x1b,0x20,0x47,0x3f,0x3f,0xb0,0x69,0x45,0x4c,0x98,0x2d,0x20,0x21,0x49,0x1c,0x42,0x39,0x69,0x2f,0x41,0x68,0x20,0x19,0x1c,0x3d,0x34,0x33,0x89,0x4c,0x17,0x44,0x7b,0x2f,0x2f,0x37,0x0,0x1,0x0,0xa7,0xff,0x2b,0x4,0x25,0x5,0xb0,0x0,0x7,0x0,0x0,0x45,0x11,0x21,0x11,0x33,0x11,0x21,0x11,0x4,0x25,0xfc,0x82,0xb9,0x2,0xc,0xd5,0x6,0x85,0xf9,0x7b,0x5,0xed,0xfa,0x13,0x0,0x1,0x0,0x33,0xfe,0xf3,0x4,0x98,0x5,0xb0,0x0,0xc,0x0,0x0,0x41,0x35,0x1,0x21,0x35,0x21,0x15,0x1,0x1,0x15,0x21,0x35,0x21,0x3,0x58,0xfd,0xbb,0x3,0x39,0xfb,0xe7,0x2,0x60,0xfd,0xa0,0x4,0x65,0xfc,0x7c,0x2,0x41,0x19,0x2,0xbe,0x98,0x90,0xfd,0x2e,0xfd,0x34,0x8f,0x98,0x0,0x1,0x0,0x39,0x0,0x0,0x4,0x92,0x5,0xb0,0x0,0xa,0x0,0x0,0x41,0x3,0x21,0x15,0x33,0x13,0x33,0x1,0x23,0x1,0x7,0x2,0x18,0xa4,0xfe,0xc5,0xb9,0xf5,0x8d,0x2,0x1e,0xbd,0xfe,0x72,0x19,0x1,0x51,0x1,0xbd,0x9a,0xfd,0x8c,0x5,0xb0,0xfb,0xa1,0x69,0x0,0x0,0x3,0x0,0x35,0x0,0xe0,0x4,0x9a,0x3,0xdd,0x0,0x40,0x0,0x66,0x0,0x8c,0x0,0x0,0x41,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x27,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x35,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x5,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x4,0x9a,0x11,0x11,0xd,0x23,0x14,0x22,0x5b,0x38,0x22,0x3b,0x1a,0x22,0x38,0x15,0xf,0x19,0xa,0x13,0x34,0x22,0x23,0x57,0x34,0x31,0x51,0x20,0x26,0x35,0xe,0x8,0x8,0xc,0xc,0x10,0x35,0x22,0x1f,0x4f,0x2f,0x34,0x56,0x23,0x22,0x34,0x13,0x13,0x35,0x23,0x22,0x56,0x34,0x30,0x4c,0x23,0x29,0x33,0xf,0x9,0x9,0x7c,0x5,0x5,0x7,0x1c,0x16,0x11,0x2e,0x1e,0x1e,0x35,0x17,0x17,0x24,0xe,0xe,0x11,0x3,0x3,0x11,0xe,0xe,0x25,0x17,0x16,0x36,0x1e,0x1f,0x31,0x12,0x11,0x16,0x6,0x9,0x7,0xfc,0x93,0x5,0x6,0x7,0x1a,0x13,0x12,0x2f,0x1f,0x1e,0x36,0x17,0x16,0x25,0xe,0xd,0x11,0x3,0x3,0x11,0xd,0xe,0x25,0x16,0x17,0x35,0x1e,0x1e,0x2e,0x12,0x13,0x1b,0x8,0x6,0x6,0x2,0x4a,0x2a,0x30,0x5e,0x29,0x1e,0x37,0x14,0x22,0x27,0x13,0x10,0x15,0x3d,0x22,0x16,0x2e,0x17,0x2a,0x56,0x23,0x23,0x2c,0x1d,0x1a,0x20,0x5b,0x36,0x1e,0x42,0x21,0x2a,0x29,0x50,0x24,0x2f,0x50,0x1b,0x18,0x1b,0x2c,0x23,0x23,0x56,0x2a,0x2a,0x56,0x23,0x23,0x2c,0x1b,0x1a,0x1f,0x58,0x34,0x20,0x46,0x4e,0x2a,0x1b,0x34,0x18,0x21,0x39,0x12,0xf,0x11,0x1d,0x17,0x16,0x38,0x1c,0x1b,0x31,0xf,0x1d,0xf,0x31,0x1c,0x1b,0x38,0x17,0x17,0x1c,0x14,0x12,0xf,0x2b,0x17,0x1b,0x3f,0x4b,0x2a,0x1c,0x35,0x18,0x1e,0x34,0x13,0x11,0x13,0x1c,0x17,0x17,0x38,0x1b,0x1c,0x31,0xf,0x1d,0x10,0x30,0x1b,0x1c,0x38,0x16,0x17,0x1d,0x11,0xf,0x11,0x34,0x20,0x19,0x38,0x0,0x0,0x1,0x0,0xf8,0xfe,0x4b,0x3,0xd3,0x6,0x2b,0x0,0x28,0x0,0x0,0x45,0x31,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x37,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x7,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x2,0xaa,0x1a,0x19,0x16,0x42,0x2b,0x1d,0x2d,0x11,0x18,0x25,0x46,0x25,0x4f,0x7e,0x2b,0x2c,0x2e,0x1a,0x19,0x10,0x2c,0x1a,0xe,0x44,0x10,0xe,0x1d,0x35,0x1e,0x49,0x74,0x29,0x2d,0x2f,0x59,0x5,0x1b,0x33,0x50,0x1b,0x19,0x1a,0x6,0x5,0x8e,0x9,0xc,0x31,0x2e,0x2e,0x86,0x56,0xfa,0xe5,0x36,0x53,0x19,0x10,0x12,0x7,0x6,0x93,0xa,0x8,0x29,0x28,0x2c,0x87,0x0,0x0,0x2,0x0,0x8e,0x0,0x0,0x4,0x3f,0x5,0xb0,0x0,0x5,0x0,0xd,0x0,0x0,0x49,0x2,0x33,0x1,0x1,0x7,0x17,0x1,0x1,0x7,0x27,0x1,0x1,0x2,0x1e,0xfe,0x70,0x1,0x93,0x8d,0x1,0x91,0xfe,0x6c,0x48,0x11,0x1,0xc,0xfe,0xfa,0x12,0x10,0xfe,0xf4,0x1,0x6,0x5,0xb0,0xfd,0x27,0xfd,0x29,0x2,0xd7,0x2,0xd9,0x9c,0x33,0xfd,0xf6,0xfd,0xf7,0x33,0x33,0x2,0x9,0x2,0xa,0x0,0x16,0x0,0x5c,0x0,0xa,0x4,0x87,0x4,0x6,0x0,0xd,0x0,0x1c,0x0,0x2a,0x0,0x3a,0x0,0x40,0x0,0x46,0x0,0x4c,0x0,0x52,0x0,0x5b,0x0,0x5f,0x0,0x63,0x0,0x67,0x0,0x6b,0x0,0x6f,0x0,0x73,0x0,0x7c,0x0,0x80,0x0,0x84,0x0,0x88,0x0,0x8c,0x0,0x90,0x0,0x94,0x0,0x0,0x41,0x15,0x14,0x6,0x23,0x22,0x26,0x35,0x35,0x34,0x36,0x33,0x32,0x16,0x17,0x23,0x11,0x33,0x32,0x16,0x15,0x14,0x6,0x7,0x16,0x16,0x15,0x14,0x6,0x25,0x35,0x34,0x26,0x23,0x22,0x6,0x15,0x15,0x14,0x16,0x33,0x32,0x36,0x25,0x35,0x33,0x15,0x14,0x6,0x23,0x22,0x26,0x35,0x33,0x14,0x16,0x33,0x32,0x36,0x1,0x33,0x35,0x23,0x35,0x23,0x5,0x33,0x35,0x23,0x15,0x23,0x1,0x33,0x35,0x33,0x35,0x23,0x5,0x33,0x15,0x33,0x35,0x23,0x1,0x23,0x15,0x33,0x32,0x36,0x35,0x34,0x26,0x3,0x33,0x35,0x23,0x17,0x33,0x35,0x23,0x5,0x33,0x35,0x23,0x13,0x33,0x35,0x23,0x17,0x33,0x35,0x23,0x5,0x33,0x35,0x23,0x13,0x15,0x33,0x32,0x36,0x35,0x34,0x26,0x23,0x5,0x35,0x23,0x15,0x17,0x35,0x23,0x15,0x13,0x35,0x23,0x15,0x5,0x35,0x23,0x15,0x17,0x35,0x23,0x15,0x13,0x35,0x23,0x15,0x1,0xf0,0x45,0x39,0x39,0x47,0x46,0x39,0x39,0x46,0x9f,0x7a,0x67,0x37,0x3e,0x17,0x17,0x1c,0x1c,0x39,0xfe,0xfb,0x29,0x23,0x23,0x29,0x29,0x24,0x23,0x28,0x2,0xe,0x32,0x3a,0x2d,0x30,0x3c,0x33,0x1f,0x1a,0x17,0x1e,0xfc,0x91,0xaa,0x6c,0x3e,0x3,0x81,0xaa,0x3d,0x6d,0xfc,0x7f,0x3e,0x6c,0xaa,0x3,0x81,0x6d,0x3d,0xaa,0xfe,0xb2,0x46,0x46,0x1d,0x1b,0x1b,0x87,0x99,0x99,0xdc,0x99,0x99,0xfe,0x49,0x98,0x98,0xdb,0x99,0x99,0xdc,0x99,0x99,0xfe,0x49,0x98,0x98,0xff,0x33,0x21,0x20,0x20,0x21,0xfe,0x1e,0x3e,0x3e,0x3e,0x3e,0x3e,0x4,0x2b,0x3d,0x3d,0x3d,0x3d,0x3d,0x2,0x25,0x3e,0x36,0x42,0x42,0x36,0x3e,0x36,0x42,0x42,0xeb,0x1,0x2f,0x28,0x2b,0x15,0x22,0x9,0x8,0x27,0x17,0x2b,0x2b,0x77,0x3e,0x26,0x2b,0x2b,0x26,0x3e,0x26,0x2b,0x2b,0xf,0xd0,0xd0,0x2d,0x32,0x2d,0x2e,0x1a,0x18,0x1e,0xfe,0x52,0x3f,0x6f,0xae,0xae,0x6f,0x3,0x20,0x5d,0x40,0x40,0x5d,0x9d,0xfd,0xf1,0x5d,0x18,0x15,0x16,0x1a,0x1,0xcf,0x40,0x40,0x40,0x40,0x40,0xfc,0x4,0x3f,0x3f,0x3f,0x3f,0x3f,0x2,0x27,0x53,0x16,0x16,0x17,0x10,0xa5,0x8a,0x8a,0xcf,0x89,0x89,0x1,0x9f,0x89,0x89,0xd0,0x8a,0x8a,0xcf,0x89,0x89,0x1,0x9f,0x89,0x89,0x0,0x5,0x0,0xf,0xfd,0xd5,0x4,0xaf,0x8,0x62,0x0,0x3,0x0,0x2f,0x0,0x33,0x0,0x37,0x0,0x3b,0x0,0x0,0x49,0x3,0x5,0x23,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x23,0x22,0x6,0x7,0x23,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x7,0x6,0x6,0x15,0x15,0x23,0x35,0x13,0x15,0x33,0x35,0x3,0x15,0x33,0x35,0x2,0x62,0xfd,0xad,0x2,0x53,0x2,0x4d,0xfe,0x1a,0xca,0x8,0xb,0xa,0x23,0x1d,0xa,0x1b,0xc,0xc,0x11,0x20,0x25,0x18,0x29,0x2,0xcb,0x1,0x2b,0x25,0x24,0x61,0x38,0x40,0x66,0x23,0x22,0x25,0x17,0x12,0x12,0x2d,0x16,0xb,0x11,0x6,0x6,0x6,0xca,0x5e,0x4,0x6,0x4,0x6,0x52,0xfc,0x31,0xfc,0x31,0x3,0xcf,0xfb,0x30,0x32,0x13,0x13,0x28,0x24,0xd,0x27,0x18,0x17,0x33,0x1a,0x34,0x40,0x30,0x37,0x46,0x65,0x21,0x20,0x1e,0x27,0x24,0x25,0x67,0x40,0x29,0x40,0x1c,0x1d,0x37,0x1f,0x10,0x1d,0xf,0x10,0x27,0x74,0xaa,0xaa,0xfc,0xac,0x4,0x4,0xa,0x89,0x4,0x4,0x0,0x2,0x1,0x11,0x4,0xe4,0x3,0xef,0x6,0xf9,0x0,0x6,0x0,0x2c,0x0,0x0,0x41,0x1,0x23,0x1,0x33,0x37,0x17,0x13,0x27,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x17,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x3,0xef,0xfe,0xdb,0x95,0xfe,0xdc,0xaa,0xc4,0xc5,0x40,0x4d,0xe,0xb,0xc,0x1e,0x10,0x1d,0x30,0x17,0x17,0x32,0x1f,0x22,0x3a,0x15,0x16,0x19,0x4d,0xf,0xc,0xb,0x1d,0x10,0x1e,0x2c,0x16,0x15,0x32,0x25,0x22,0x3a,0x16,0x15,0x19,0x4,0xe4,0x1,0x6,0xfe,0xfa,0xb0,0xb0,0x1,0xfe,0x17,0x11,0x21,0xd,0xd,0x10,0x16,0xd,0xd,0x16,0x1f,0x19,0x19,0x41,0x21,0x13,0x11,0x21,0xe,0xd,0x11,0x17,0xd,0xe,0x16,0x1e,0x19,0x18,0x3f,0x0,0x0,0x2,0x0,0xfc,0x4,0xe4,0x4,0xba,0x6,0xcf,0x0,0x6,0x0,0x22,0x0,0x0,0x41,0x1,0x23,0x1,0x33,0x37,0x17,0x37,0x33,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x7,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x3,0xdd,0xfe,0xed,0xbc,0xfe,0xee,0xaa,0xc6,0xc6,0x8e,0x72,0x1,0x19,0x31,0x13,0x13,0x17,0x30,0x2c,0x21,0x56,0x34,0x6,0x1c,0x34,0x14,0x13,0x18,0x13,0x12,0xf,0x2d,0x1c,0x4,0xe4,0x1,0x6,0xfe,0xfa,0xba,0xba,0x8a,0x3c,0x3,0x12,0x10,0xf,0x2f,0x21,0x2b,0x43,0x14,0xf,0x10,0x5c,0x7,0x8,0x8,0x19,0x13,0x13,0x17,0x7,0x5,0x7,0x2,0x0,0x2,0x0,0x10,0x4,0xe4,0x3,0xf9,0x6,0x95,0x0,0x6,0x0,0xa,0x0,0x0,0x41,0x1,0x23,0x1,0x33,0x37,0x17,0x25,0x3,0x23,0x13,0x3,0xf9,0xfe,0xdd,0x98,0xfe,0xde,0xc4,0xaa,0xaa,0xfe,0x31,0x8d,0xc8,0xc9,0x4,0xe4,0x1,0x6,0xfe,0xfa,0x9e,0x9e,0xae,0x1,0x3,0xfe,0xfd,0x0,0x0,0x2,0x1,0xb,0x4,0xe4,0x4,0xf4,0x6,0x95,0x0,0x6,0x0,0xa,0x0,0x0,0x41,0x1,0x33,0x37,0x17,0x33,0x1,0x25,0x3,0x33,0x13,0x2,0x2f,0xfe,0xdc,0xc6,0xaa,0xa9,0xc5,0xfe,0xdd,0x1,0x67,0x8e,0x8d,0xc8,0x5,0xea,0xfe,0xfa,0x9e,0x9e,0x1,0x6,0xab,0xfe,0xfd,0x1,0x3,0x0,0x0,0x2,0x1,0x3e,0x4,0xdf,0x3,0x9c,0x6,0x8a,0x0,0x3,0x0,0x1d,0x0,0x0,0x41,0x27,0x23,0x17,0x5,0x23,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x2,0xa6,0x71,0x99,0xa4,0x1,0x5c,0x99,0x1,0x13,0x14,0x12,0x36,0x25,0x28,0x39,0x12,0x13,0x12,0x98,0x2c,0x28,0x27,0x70,0x45,0x44,0x6f,0x28,0x27,0x2c,0x5,0xc4,0xc6,0xc6,0x14,0x19,0x2c,0x10,0xe,0x11,0x12,0x10,0xf,0x2b,0x18,0x2f,0x4d,0x1b,0x1c,0x1e,0x1e,0x1c,0x1b,0x4d,0x0,0x1,0x1,0xf9,0x4,0x8e,0x2,0xf0,0x6,0x3b,0x0,0x9,0x0,0x0,0x41,0x15,0x33,0x35,0x34,0x36,0x37,0x27,0x6,0x6,0x1,0xf9,0xb9,0x1b,0x23,0x6b,0x30,0x5c,0x5,0xf,0x81,0x78,0x3d,0x6a,0x3b,0x53,0x2a,0xab,0x0,0x2,0x0,0x36,0x0,0x0,0x4,0x8e,0x4,0x8d,0x0,0x7,0x0,0xc,0x0,0x0,0x41,0x13,0x33,0x1,0x23,0x1,0x33,0x13,0x37,0x13,0x37,0x17,0x13,0x3,0x66,0x6d,0xbb,0xfe,0x2a,0xa5,0xfe,0x23,0xbc,0x6e,0x3c,0xaa,0x1e,0x1f,0xa8,0x1,0x17,0xfe,0xe9,0x4,0x8d,0xfb,0x73,0x1,0x17,0x97,0x1,0xae,0x4d,0x4f,0xfe,0x54,0x0,0x3,0x0,0xd0,0x0,0x0,0x4,0x46,0x4,0x8d,0x0,0x1a,0x0,0x29,0x0,0x38,0x0,0x0,0x73,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x21,0x13,0x21,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x21,0x11,0x11,0x33,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0xd0,0x1,0xc7,0x57,0xa9,0x3d,0x35,0x3d,0x24,0x1e,0x1f,0x54,0x31,0x28,0x47,0x1b,0x1a,0x20,0x51,0x41,0x3c,0x9e,0x4b,0xfe,0x63,0xbb,0x1,0x15,0x2f,0x56,0x21,0x20,0x26,0x2b,0x23,0x23,0x58,0x2c,0xfe,0xf4,0xe3,0x2b,0x5a,0x25,0x25,0x2e,0x2b,0x21,0x21,0x52,0x28,0x2d,0x2e,0x2a,0x75,0x53,0x37,0x5b,0x23,0x22,0x2e,0xc,0xe,0x2b,0x1e,0x1d,0x4d,0x30,0x5d,0x79,0x26,0x23,0x1f,0xfd,0x85,0x1,0x17,0x17,0x18,0x49,0x34,0x33,0x45,0x15,0x16,0x13,0x1,0x2,0x8,0x1,0x55,0x1,0xf,0x13,0x13,0x43,0x34,0x2f,0x40,0x13,0x14,0x11,0x1,0x0,0x1,0x0,0x6e,0xff,0xf0,0x4,0x36,0x4,0x9d,0x0,0x33,0x0,0x0,0x41,0x23,0x6,0x6,0x7,0x6,0x6,0x27,0x22,0x26,0x27,0x26,0x26,0x27,0x35,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x4,0x36,0xb9,0xa,0x27,0x1e,0x24,0x6a,0x47,0x54,0x75,0x24,0x24,0x20,0x1,0x1,0x23,0x26,0x26,0x78,0x55,0x40,0x61,0x23,0x21,0x2a,0xa,0xb9,0xc,0x4e,0x3c,0x3d,0xa1,0x5e,0x77,0xb9,0x40,0x41,0x44,0x1,0x1,0x42,0x3f,0x3e,0xb6,0x75,0x5e,0xa3,0x3f,0x3f,0x52,0x1,0x79,0x37,0x55,0x1e,0x24,0x25,0x1,0x45,0x38,0x38,0x8e,0x49,0x66,0x4b,0x8f,0x38,0x37,0x43,0x22,0x21,0x1f,0x5a,0x3a,0x5e,0x94,0x33,0x33,0x36,0x57,0x4b,0x4b,0xc7,0x71,0x65,0x6f,0xc6,0x4b,0x4b,0x58,0x33,0x32,0x32,0x92,0x0,0x0,0x2,0x0,0xb7,0x0,0x0,0x4,0x53,0x4,0x8d,0x0,0xf,0x0,0x1f,0x0,0x0,0x73,0x21,0x36,0x36,0x37,0x36,0x36,0x37,0x35,0x26,0x26,0x27,0x26,0x26,0x27,0x21,0x17,0x33,0x16,0x16,0x17,0x16,0x16,0x17,0x15,0x6,0x6,0x7,0x6,0x6,0x7,0x23,0xb7,0x1,0x5f,0x7b,0xd0,0x4d,0x4c,0x58,0x1,0x1,0x55,0x4a,0x4b,0xcd,0x79,0xfe,0x95,0xba,0xb1,0x5b,0x8c,0x30,0x2f,0x31,0x1,0x1,0x35,0x31,0x32,0x8f,0x5c,0xa5,0x1,0x4e,0x48,0x47,0xca,0x7e,0x3f,0x7b,0xca,0x49,0x48,0x50,0x2,0x99,0x1,0x3a,0x34,0x35,0x91,0x58,0x41,0x5a,0x93,0x34,0x34,0x39,0x1,0x0,0x0,0x1,0x0,0xc8,0x0,0x0,0x4,0x23,0x4,0x8d,0x0,0xb,0x0,0x0,0x41,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x3,0xc5,0xfd,0xc0,0x2,0x98,0xfc,0xab,0x3,0x5b,0xfd,0x62,0x2,0xe,0x98,0x1,0x4e,0x99,0xfb,0x73,0x97,0x1,0x77,0x0,0x0,0x1,0x0,0xe7,0x0,0x0,0x4,0x3d,0x4,0x8d,0x0,0x9,0x0,0x0,0x41,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x33,0x11,0x3,0xe4,0xfd,0xc3,0x2,0x96,0xfc,0xaa,0xc0,0x1,0xf3,0x99,0x1,0x68,0x99,0xfb,0x73,0x1,0xf3,0x0,0x0,0x1,0x0,0x7c,0xff,0xf0,0x4,0x41,0x4,0x9d,0x0,0x37,0x0,0x0,0x65,0x11,0x21,0x15,0x21,0x7,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x35,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x4,0x41,0xfe,0x34,0x1,0x15,0x1,0x19,0x3e,0x21,0x22,0x46,0x21,0x57,0x7e,0x29,0x2a,0x28,0x1,0x1,0x21,0x26,0x25,0x79,0x57,0x3e,0x62,0x24,0x1e,0x29,0xb,0xb7,0xe,0x51,0x3d,0x3d,0x9d,0x59,0x7a,0xbb,0x3f,0x3f,0x42,0x1,0x1,0x49,0x43,0x43,0xc0,0x79,0x3c,0x7c,0x3a,0x3a,0x67,0x96,0x1,0xb9,0x90,0xee,0x18,0x1d,0x8,0x8,0x5,0x45,0x38,0x38,0x92,0x4e,0x56,0x4c,0x91,0x39,0x39,0x44,0x21,0x21,0x1b,0x4c,0x30,0x5b,0x8b,0x2e,0x2e,0x2f,0x57,0x4b,0x4c,0xcb,0x74,0x54,0x74,0xca,0x4b,0x4c,0x57,0xf,0x13,0x13,0x40,0x0,0x0,0x1,0x0,0x9b,0x0,0x0,0x3,0xf9,0x4,0x8d,0x0,0xb,0x0,0x0,0x61,0x11,0x23,0x11,0x21,0x11,0x23,0x11,0x33,0x11,0x21,0x11,0x3,0xf9,0xb2,0xfe,0x6,0xb2,0xb2,0x1,0xfa,0x4,0x8d,0xfd,0xfd,0x2,0x3,0xfb,0x73,0x1,0xf2,0xfe,0xe,0x0,0x0,0x1,0x0,0xd9,0x0,0x0,0x4,0x10,0x4,0x8c,0x0,0xb,0x0,0x0,0x53,0x15,0x21,0x11,0x21,0x15,0x21,0x35,0x21,0x11,0x21,0x35,0xd9,0x1,0x3b,0xfe,0xc5,0x3,0x37,0xfe,0xbd,0x1,0x43,0x4,0x8c,0xa1,0xfc,0xb5,0xa0,0xa0,0x3,0x4b,0xa1,0x0,0x0,0x1,0x0,0x96,0xff,0xf0,0x3,0xe6,0x4,0x8d,0x0,0x1b,0x0,0x0,0x41,0x13,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x13,0x3,0x28,0x1,0x2,0x23,0x1e,0x1e,0x50,0x2f,0x31,0x58,0x22,0x22,0x28,0xbe,0x8,0x49,0x3a,0x39,0x98,0x57,0x50,0x94,0x39,0x38,0x44,0x2,0x2,0x4,0x8d,0xfc,0xea,0x39,0x59,0x1e,0x1f,0x21,0x19,0x1c,0x1c,0x59,0x3e,0x65,0x91,0x2e,0x2f,0x2c,0x33,0x32,0x31,0x92,0x5f,0x3,0x16,0x0,0x1,0x0,0xb4,0x0,0x0,0x4,0x80,0x4,0x8d,0x0,0xc,0x0,0x0,0x41,0x1,0x33,0x1,0x1,0x23,0x1,0x7,0x11,0x23,0x11,0x33,0x11,0x2,0x0,0x1,0x9f,0xe1,0xfe,0x0,0x1,0xde,0xe3,0xfe,0x74,0x82,0xb9,0xb9,0x2,0x7,0xfd,0xf9,0x2,0x86,0x2,0x7,0xfe,0x65,0x8f,0x2,0x2a,0xfb,0x73,0x1,0x79,0x0,0x0,0x1,0x0,0xd1,0x0,0x0,0x4,0x52,0x4,0x8d,0x0,0x5,0x0,0x0,0x65,0x11,0x23,0x11,0x21,0x35,0x1,0x95,0xc4,0x3,0x81,0x97,0x3,0xf6,0xfb,0x73,0x97,0x0,0x0,0x1,0x0,0x9b,0x0,0x0,0x4,0x3a,0x4,0x8d,0x0,0xc,0x0,0x0,0x41,0x3,0x23,0x11,0x33,0x11,0x13,0x33,0x13,0x11,0x33,0x11,0x23,0x2,0x6d,0xda,0xf8,0xb0,0xe2,0x83,0xda,0xb0,0xf1,0x2,0x58,0x2,0x35,0xfb,0x73,0x3,0xb1,0xfd,0x8d,0x2,0x81,0xfc,0x41,0x4,0x8d,0x0,0x0,0x1,0x0,0xc2,0x0,0x0,0x4,0xf,0x4,0x8d,0x0,0x9,0x0,0x0,0x61,0x11,0x23,0x13,0x1,0x23,0x11,0x33,0x3,0x1,0x4,0xf,0xb0,0x6,0xfe,0xb,0xae,0xb1,0x5,0x1,0xf5,0x4,0x8d,0xfc,0x93,0x3,0x6d,0xfb,0x73,0x3,0x6c,0xfc,0x94,0x0,0x0,0x2,0x0,0x82,0xff,0xf0,0x4,0x4a,0x4,0x9d,0x0,0x19,0x0,0x33,0x0,0x0,0x41,0x35,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x27,0x15,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x35,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x4,0x4a,0x1,0x3d,0x3c,0x3d,0xb5,0x78,0x77,0xb4,0x3d,0x3d,0x3e,0x1,0x1,0x3f,0x3d,0x3d,0xb4,0x77,0x78,0xb4,0x3d,0x3c,0x3d,0xb6,0x1,0x1e,0x22,0x23,0x73,0x55,0x54,0x72,0x23,0x24,0x20,0x1,0x1,0x1f,0x24,0x23,0x72,0x54,0x54,0x73,0x23,0x23,0x1f,0x2,0x24,0x43,0x6e,0xcd,0x4f,0x4e,0x5e,0x5f,0x4f,0x4f,0xcc,0x6d,0x43,0x6d,0xcc,0x4e,0x4f,0x5e,0x5e,0x4e,0x4e,0xcc,0xb3,0x45,0x47,0x92,0x3b,0x3b,0x4b,0x4b,0x3c,0x3b,0x91,0x47,0x45,0x46,0x91,0x3b,0x3b,0x4b,0x4a,0x3a,0x3b,0x92,0x0,0x2,0x0,0x5e,0xff,0x36,0x4,0x67,0x4,0x9d,0x0,0x1f,0x0,0x39,0x0,0x0,0x41,0x35,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x7,0x15,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x5,0x37,0x27,0x36,0x36,0x37,0x36,0x36,0x27,0x15,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x35,0x36,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x4,0x65,0x1,0x46,0x42,0x42,0xbf,0x7a,0x7a,0xbe,0x42,0x42,0x46,0x1,0x1,0x47,0x42,0x42,0xbf,0x7a,0x20,0x3f,0x1e,0x1,0xa,0x7d,0xdf,0x35,0x52,0x1c,0x1c,0x1d,0xb7,0x1,0x25,0x28,0x28,0x7c,0x58,0x57,0x7d,0x28,0x29,0x27,0x1,0x1,0x27,0x28,0x28,0x7c,0x57,0x58,0x7d,0x28,0x28,0x26,0x2,0x24,0x43,0x74,0xce,0x4d,0x4d,0x5a,0x5b,0x4d,0x4e,0xcd,0x73,0x43,0x73,0xcd,0x4d,0x4d,0x5a,0x7,0x7,0xc8,0x6f,0xa3,0x26,0x66,0x3e,0x3d,0x8b,0x8f,0x45,0x4e,0x94,0x39,0x39,0x46,0x46,0x3a,0x3a,0x93,0x4d,0x45,0x4c,0x93,0x3a,0x39,0x46,0x45,0x39,0x39,0x93,0x0,0x0,0x2,0x0,0x90,0x0,0x0,0x4,0x2c,0x4,0x8d,0x0,0x14,0x0,0x23,0x0,0x0,0x41,0x1,0x33,0x35,0x1,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x21,0x11,0x33,0x11,0x35,0x11,0x33,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x2,0x61,0x1,0x4,0xc7,0xfe,0xde,0x32,0x57,0x20,0x20,0x24,0x4b,0x3e,0x3f,0xa1,0x54,0xfe,0x56,0xb9,0xf1,0x32,0x5e,0x24,0x24,0x2b,0x2d,0x23,0x24,0x5b,0x2f,0x1,0xc1,0xfe,0x3f,0xa,0x1,0xe6,0x16,0x39,0x26,0x25,0x60,0x3f,0x5f,0x86,0x2b,0x2b,0x28,0x1,0xfb,0x73,0x1,0xc1,0x97,0x1,0x9c,0x1,0x18,0x19,0x19,0x4f,0x38,0x35,0x4b,0x18,0x19,0x18,0x1,0x0,0x0,0x1,0x0,0x8a,0xff,0xf0,0x4,0x39,0x4,0x9d,0x0,0x4c,0x0,0x0,0x41,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x23,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x3,0x7f,0x1,0x35,0x27,0x28,0x5d,0x28,0x36,0x6a,0x2b,0x2b,0x37,0x2,0xbc,0x3,0x1f,0x19,0x15,0x36,0x1f,0x45,0xab,0x56,0x4c,0xa5,0x46,0x3b,0x52,0x4c,0x3c,0x3c,0x92,0x46,0x30,0x8a,0x31,0x1e,0x27,0x32,0x26,0x26,0x5a,0x28,0x32,0x60,0x26,0x26,0x2f,0x2,0xbb,0x6,0x51,0x3f,0x3f,0x9f,0x54,0x45,0x97,0x3c,0x48,0x5b,0x53,0x41,0x40,0x99,0x45,0x31,0x83,0x28,0x21,0x1d,0x1,0x2a,0x32,0x40,0x12,0x13,0xe,0x15,0x1a,0x19,0x53,0x3d,0x34,0x59,0x25,0x1e,0x32,0x14,0x2d,0x2a,0x25,0x27,0x24,0x77,0x55,0x55,0x79,0x2b,0x2a,0x37,0x12,0xb,0x29,0x1e,0x12,0x39,0x28,0x31,0x41,0x14,0x13,0x10,0x16,0x19,0x19,0x4e,0x37,0x5a,0x86,0x2d,0x2c,0x2b,0x22,0x21,0x27,0x7e,0x59,0x56,0x78,0x29,0x29,0x33,0x11,0xd,0x26,0x20,0x1b,0x37,0x0,0x0,0x1,0x0,0x5d,0x0,0x0,0x4,0x69,0x4,0x8d,0x0,0x7,0x0,0x0,0x41,0x35,0x21,0x15,0x21,0x11,0x33,0x11,0x4,0x69,0xfb,0xf4,0x1,0xa7,0xbc,0x3,0xf4,0x99,0x99,0xfc,0xc,0x3,0xf4,0x0,0x0,0x1,0x0,0xb5,0xff,0xf0,0x4,0x2b,0x4,0x8d,0x0,0x1d,0x0,0x0,0x41,0x23,0x3,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x3,0x23,0x3,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x4,0x2a,0xb7,0x1,0x1,0x25,0x21,0x22,0x5f,0x3b,0x3b,0x5f,0x21,0x22,0x25,0x1,0x1,0xb5,0x1,0x1,0x46,0x3c,0x3b,0xa0,0x5c,0x5b,0xa0,0x3c,0x3c,0x47,0x2,0x4,0x8d,0xfc,0xf4,0x3b,0x5d,0x20,0x20,0x22,0x22,0x20,0x20,0x5d,0x3b,0x3,0xc,0xfc,0xf4,0x60,0x95,0x33,0x33,0x36,0x36,0x34,0x34,0x94,0x5f,0x0,0x0,0x1,0x0,0x56,0x0,0x0,0x4,0x83,0x4,0x8d,0x0,0x8,0x0,0x0,0x41,0x1,0x23,0x1,0x33,0x1,0x23,0x1,0x7,0x2,0x50,0xfe,0xce,0xc8,0x1,0xbf,0xae,0x1,0xc0,0xc9,0xfe,0xcf,0x1d,0x1,0x36,0x3,0x57,0xfb,0x73,0x4,0x8d,0xfc,0xa8,0x6a,0x0,0x1,0x0,0x2f,0x0,0x0,0x4,0xbb,0x4,0x8d,0x0,0x12,0x0,0x0,0x61,0x33,0x13,0x37,0x17,0x13,0x33,0x13,0x23,0x3,0x7,0x27,0x3,0x23,0x3,0x7,0x27,0x3,0x23,0x1,0x17,0x9f,0xb3,0xe,0xd,0xaf,0x9f,0xe9,0xac,0x8c,0xb,0xd,0xa7,0x9a,0xab,0xd,0xb,0x8d,0xab,0x3,0x3,0x3b,0x3b,0xfc,0xfd,0x4,0x8d,0xfd,0x3,0x3d,0x3d,0x2,0xfd,0xfd,0x2,0x3c,0x3d,0x2,0xfd,0x0,0x0,0x1,0x0,0x60,0x0,0x0,0x4,0x66,0x4,0x8d,0x0,0xb,0x0,0x0,0x41,0x1,0x23,0x1,0x1,0x33,0x1,0x1,0x33,0x1,0x1,0x23,0x2,0x5f,0xfe,0xe5,0xdb,0x1,0x8b,0xfe,0x6c,0xdc,0x1,0x26,0x1,0x28,0xdc,0xfe,0x69,0x1,0x88,0xdb,0x2,0xda,0x1,0xb3,0xfd,0xbe,0xfd,0xb5,0x1,0xbb,0xfe,0x45,0x2,0x4b,0x2,0x42,0x0,0x1,0x0,0x4d,0x0,0x0,0x4,0x81,0x4,0x8d,0x0,0xa,0x0,0x0,0x61,0x33,0x11,0x1,0x23,0x1,0x7,0x27,0x1,0x23,0x1,0x2,0x6,0xbb,0x1,0xc0,0xd4,0xfe,0xbe,0x5,0x5,0xfe,0xc0,0xd4,0x1,0xb9,0x1,0x95,0x2,0xf8,0xfd,0xc0,0x9,0x9,0x2,0x40,0xfd,0x14,0x0,0x1,0x0,0xb9,0x0,0x0,0x4,0x42,0x4,0x8d,0x0,0x9,0x0,0x0,0x65,0x1,0x27,0x21,0x15,0x21,0x1,0x15,0x21,0x35,0x1,0x9f,0x2,0x8b,0x1,0xfc,0x99,0x2,0x82,0xfd,0x75,0x3,0x89,0x97,0x3,0x7d,0x79,0x99,0xfc,0x88,0x7c,0x97,0x0,0x2,0x1,0x52,0x4,0xe0,0x3,0x9a,0x7,0x3,0x0,0x19,0x0,0x35,0x0,0x0,0x41,0x23,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x25,0x33,0x27,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x7,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x3,0x9a,0x92,0x11,0x10,0x12,0x38,0x26,0x26,0x37,0x12,0x12,0x12,0x1,0x91,0x2a,0x27,0x26,0x6c,0x42,0x42,0x6c,0x26,0x25,0x2a,0xfe,0x9c,0x7f,0x3,0x1b,0x36,0x15,0x15,0x1a,0x31,0x2f,0x25,0x63,0x3d,0x7,0x20,0x3a,0x16,0x16,0x1b,0x12,0x12,0x12,0x34,0x22,0x5,0xb0,0x17,0x29,0xf,0x11,0x13,0x12,0xf,0xf,0x2b,0x18,0x2f,0x4c,0x1b,0x1c,0x1e,0x1e,0x1c,0x1b,0x4c,0x40,0x3e,0x3,0x10,0xe,0xd,0x29,0x1d,0x26,0x3b,0x12,0xe,0xf,0x52,0x6,0x6,0x7,0x17,0x11,0x10,0x14,0x6,0x6,0x7,0x2,0x0,0x2,0x1,0x42,0x4,0xdf,0x3,0xa0,0x6,0x8a,0x0,0x19,0x0,0x1d,0x0,0x0,0x41,0x23,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x3,0x7,0x33,0x37,0x3,0xa0,0x99,0x1,0x13,0x14,0x12,0x36,0x25,0x28,0x39,0x12,0x13,0x12,0x98,0x2c,0x28,0x27,0x70,0x45,0x44,0x6f,0x28,0x27,0x2c,0xf8,0x71,0x66,0xa4,0x5,0xb0,0x19,0x2c,0x10,0xe,0x11,0x12,0x10,0xf,0x2b,0x18,0x2f,0x4d,0x1b,0x1c,0x1e,0x1e,0x1c,0x1b,0x4d,0x1,0x9,0xc6,0xc6,0x0,0x1,0x1,0x35,0x2,0x8b,0x3,0xb2,0x3,0x22,0x0,0x3,0x0,0x0,0x41,0x35,0x21,0x15,0x3,0xb2,0xfd,0x83,0x2,0x8b,0x97,0x97,0x0,0x3,0x1,0xd1,0x4,0x40,0x3,0xa8,0x6,0x72,0x0,0x3,0x0,0x1b,0x0,0x27,0x0,0x0,0x41,0x7,0x33,0x37,0x1,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x17,0x36,0x36,0x33,0x32,0x16,0x15,0x6,0x6,0x23,0x22,0x26,0x2,0xe2,0x92,0x7c,0xdc,0xfe,0x29,0x1c,0x18,0x17,0x3e,0x23,0x22,0x3e,0x17,0x16,0x1b,0x1b,0x16,0x17,0x3e,0x22,0x23,0x3e,0x17,0x18,0x1c,0x55,0x1,0x32,0x24,0x23,0x31,0x1,0x30,0x23,0x24,0x32,0x6,0x72,0xb8,0xb8,0xfe,0x71,0x24,0x3c,0x15,0x16,0x18,0x18,0x16,0x15,0x3c,0x24,0x24,0x3e,0x16,0x16,0x19,0x19,0x16,0x16,0x3e,0x24,0x26,0x32,0x32,0x26,0x23,0x32,0x32,0x0,0x0,0x2,0x1,0xf5,0x4,0x82,0x3,0xb7,0x5,0xc4,0x0,0x5,0x0,0x15,0x0,0x0,0x41,0x15,0x33,0x13,0x35,0x23,0x5,0x15,0x33,0x35,0x36,0x36,0x37,0x36,0x36,0x37,0x27,0x6,0x6,0x7,0x6,0x6,0x2,0xaf,0x50,0xb8,0xa8,0xfe,0xe6,0x7b,0x1,0x7,0x6,0x6,0x15,0xd,0x48,0x18,0x25,0xd,0xb,0x10,0x4,0x9e,0x1a,0x1,0x2b,0x15,0xb6,0x8c,0x86,0x18,0x2d,0x16,0x19,0x2f,0x16,0x3,0x10,0x2a,0x19,0x16,0x32,0x0,0x0,0x2,0x1,0x74,0x4,0xd9,0x3,0xc2,0x6,0xd0,0x0,0x19,0x0,0x33,0x0,0x0,0x41,0x23,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x35,0x23,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x3,0x27,0x14,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x15,0x17,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x3,0xc2,0x95,0x11,0x12,0x12,0x37,0x26,0x27,0x37,0x12,0x11,0x11,0x95,0x2a,0x27,0x26,0x6d,0x43,0x43,0x6d,0x27,0x26,0x2a,0x9,0x53,0x30,0x22,0x20,0x34,0x19,0x1a,0x35,0x21,0x48,0x5e,0x54,0x1,0x2e,0x23,0x21,0x2f,0x18,0x17,0x36,0x28,0x47,0x5e,0x5,0xae,0x18,0x2b,0x10,0x10,0x13,0x13,0x10,0x10,0x2b,0x18,0x2f,0x4f,0x1c,0x1c,0x1f,0x1f,0x1c,0x1c,0x4f,0x1,0x39,0x18,0x26,0x33,0x17,0xf,0xe,0x17,0x6f,0x47,0x15,0x26,0x33,0x17,0xe,0xf,0x17,0x6a,0x0,0x1,0x2,0x6,0xfe,0x99,0x2,0xbf,0x0,0x9a,0x0,0x3,0x0,0x0,0x41,0x11,0x23,0x11,0x2,0xbf,0xb9,0xfe,0x99,0x2,0x1,0xfd,0xff,0x0,0x0,0x1,0x1,0x60,0xfe,0x4b,0x3,0x12,0x0,0x97,0x0,0x15,0x0,0x0,0x65,0x23,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x7,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x3,0x12,0xb9,0x11,0x10,0x12,0x34,0x22,0xe,0x42,0x12,0xe,0x1d,0x35,0x1e,0x55,0x81,0x28,0x21,0x23,0x97,0xf0,0x2c,0x44,0x18,0x18,0x1a,0x7,0x6,0x9d,0xa,0x8,0x38,0x35,0x2b,0x79,0x4b,0x0,0x0,0x2,0x0,0xcc,0x0,0x0,0x4,0x4b,0x4,0x8d,0x0,0x10,0x0,0x1f,0x0,0x0,0x41,0x21,0x36,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x21,0x11,0x33,0x11,0x11,0x21,0x16,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x7,0x1,0x84,0x1,0x12,0x54,0x9e,0x3d,0x3c,0x4a,0x4a,0x3d,0x3d,0x9d,0x54,0xfe,0x36,0xb8,0x1,0x12,0x31,0x5c,0x23,0x22,0x2a,0x2a,0x22,0x23,0x5c,0x31,0x1,0xb6,0x1,0x2a,0x2c,0x2b,0x87,0x5f,0x5c,0x89,0x2e,0x2d,0x2e,0x1,0xfb,0x73,0x2,0x4e,0x1,0xa6,0x1,0x1c,0x1a,0x1b,0x50,0x36,0x37,0x4d,0x19,0x19,0x17,0x1,0x0,0x0,0x1,0x0,0xa9,0x0,0x0,0x4,0xb6,0x5,0xb0,0x0,0xc,0x0,0x0,0x41,0x1,0x33,0x1,0x1,0x23,0x1,0x23,0x11,0x23,0x11,0x33,0x11,0x2,0xd,0x1,0xc6,0xe3,0xfd,0xe8,0x1,0xef,0xd4,0xfe,0x45,0x9c,0xb9,0xb9,0x2,0x93,0xfd,0x6d,0x2,0xef,0x2,0xc1,0xfd,0x7a,0x2,0x86,0xfa,0x50,0x2,0x93,0x0,0x1,0x0,0xd2,0xff,0xec,0x4,0x41,0x4,0x9d,0x0,0x3e,0x0,0x0,0x65,0x7,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x23,0x1,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x11,0x33,0x11,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x3,0x15,0x33,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x2,0xb,0x35,0x37,0x6f,0x39,0x57,0x91,0x35,0x34,0x3b,0x31,0x2d,0x2e,0x81,0x51,0x1,0x1,0x12,0x27,0x57,0x31,0x32,0x70,0x41,0x63,0x95,0x31,0x34,0x33,0xb8,0x15,0x19,0x18,0x53,0x3f,0x24,0x39,0x17,0x12,0x1d,0xd,0xed,0x54,0x4c,0x6d,0x22,0x1a,0x1a,0x1d,0x1b,0x1b,0x4e,0x32,0x36,0x54,0xb5,0x98,0x1a,0x17,0x32,0x30,0x30,0x8c,0x5a,0x46,0x6d,0x28,0x27,0x2f,0x7,0x1,0x4a,0x26,0x43,0x19,0x18,0x1d,0x33,0x32,0x35,0xa4,0x6e,0xfd,0xf,0x2,0xf1,0x38,0x65,0x26,0x25,0x2c,0xe,0xa,0x8,0x14,0xa,0xfe,0xd9,0x89,0x1a,0x1c,0x15,0x41,0x2b,0x31,0x51,0x1d,0x1e,0x21,0x1f,0xff,0xff,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x6,0x0,0x1,0x0,0x0,0xff,0xff,0x0,0xda,0x2,0x31,0x3,0xd7,0x2,0xc9,0x6,0x6,0x0,0x67,0x0,0x0,0xff,0xff,0x0,0x6b,0xff,0xec,0x4,0x5d,0x7,0x2e,0x6,0x26,0x0,0x4,0x0,0x0,0x0,0x7,0x1,0x60,0x0,0x34,0x1,0x70,0xff,0xff,0x0,0x8f,0xff,0xec,0x4,0x33,0x5,0xd7,0x6,0x26,0x0,0x1e,0x0,0x0,0x0,0x6,0x1,0x60,0x1d,0x19,0xff,0xff,0x0,0x64,0xff,0xeb,0x4,0x5c,0x7,0x2e,0x6,0x26,0x0,0x8,0x0,0x0,0x0,0x7,0x1,0x60,0x0,0x19,0x1,0x70,0xff,0xff,0x0,0x8c,0xfe,0x56,0x4,0x1d,0x5,0xd7,0x6,0x26,0x0,0x22,0x0,0x0,0x0,0x6,0x1,0x60,0xf6,0x19,0xff,0xff,0xff,0xba,0x0,0x0,0x4,0x29,0x6,0x16,0x6,0x26,0x0,0x29,0x0,0x0,0x0,0x7,0x0,0x6d,0xfd,0xed,0x0,0x0,0xff,0xff,0x0,0x76,0xfe,0x24,0x4,0x69,0x5,0xc4,0x6,0x26,0x0,0x14,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0xb5,0xfe,0xce,0xff,0xff,0x0,0xaf,0xfe,0x25,0x4,0x36,0x4,0x4e,0x6,0x26,0x0,0x2e,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0xa8,0xfe,0xcf,0xff,0xff,0x0,0x4c,0xfe,0x2e,0x4,0x84,0x5,0xb0,0x6,0x26,0x0,0x15,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0xa3,0xfe,0xd8,0xff,0xff,0x0,0x8e,0xfe,0x2e,0x4,0x29,0x5,0x40,0x6,0x26,0x0,0x2f,0x0,0x0,0x0,0x7,0x1,0x68,0x1,0x5,0xfe,0xd8,0xff,0xff,0x0,0x4c,0xfe,0x4d,0x4,0x84,0x5,0xb0,0x6,0x26,0x0,0x15,0x0,0x0,0x0,0x6,0x1,0x66,0x3f,0x0,0xff,0xff,0x0,0x5d,0xfe,0x4f,0x4,0x69,0x4,0x8d,0x6,0x26,0x2,0x61,0x0,0x0,0x0,0x6,0x1,0x66,0x30,0x2,0xff,0xff,0x0,0x8e,0xfe,0x4d,0x4,0x29,0x5,0x40,0x6,0x26,0x0,0x2f,0x0,0x0,0x0,0x7,0x1,0x66,0x0,0xa1,0x0,0x0,0xff,0xff,0xff,0xe7,0x0,0x0,0x4,0x53,0x4,0x8d,0x6,0x26,0x2,0x52,0x0,0x0,0x0,0x7,0x2,0x6a,0xfe,0xb2,0xff,0x78,0xff,0xff,0xff,0xe7,0x0,0x0,0x4,0x53,0x4,0x8d,0x6,0x26,0x2,0x52,0x0,0x0,0x0,0x7,0x2,0x6a,0xfe,0xb2,0xff,0x78,0xff,0xff,0x0,0x5d,0x0,0x0,0x4,0x69,0x4,0x8d,0x6,0x26,0x2,0x61,0x0,0x0,0x0,0x6,0x2,0x6a,0xf3,0xe0,0xff,0xff,0x0,0x36,0x0,0x0,0x4,0x8e,0x5,0xff,0x6,0x26,0x2,0x4f,0x0,0x0,0x0,0x6,0x1,0x5a,0x8b,0x36,0xff,0xff,0x0,0x36,0x0,0x0,0x4,0x8e,0x5,0xfc,0x6,0x26,0x2,0x4f,0x0,0x0,0x0,0x6,0x1,0x5b,0x77,0x33,0xff,0xff,0x0,0x36,0x0,0x0,0x4,0x8e,0x6,0x24,0x6,0x26,0x2,0x4f,0x0,0x0,0x0,0x6,0x1,0x5c,0x79,0x37,0xff,0xff,0x0,0x36,0x0,0x0,0x4,0x8e,0x6,0x2e,0x6,0x26,0x2,0x4f,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x85,0x0,0x3d,0xff,0xff,0x0,0x36,0x0,0x0,0x4,0x8e,0x5,0xfc,0x6,0x26,0x2,0x4f,0x0,0x0,0x0,0x6,0x1,0x61,0x1,0x37,0xff,0xff,0x0,0x36,0x0,0x0,0x4,0x8e,0x6,0x67,0x6,0x26,0x2,0x4f,0x0,0x0,0x0,0x7,0x1,0x62,0x0,0x0,0x0,0x80,0xff,0xff,0x0,0x36,0x0,0x0,0x4,0x8e,0x6,0xf4,0x6,0x26,0x2,0x4f,0x0,0x0,0x0,0x7,0x2,0x6b,0xff,0xee,0x0,0x82,0xff,0xff,0x0,0x6e,0xfe,0x4a,0x4,0x36,0x4,0x9d,0x6,0x26,0x2,0x51,0x0,0x0,0x0,0x6,0x1,0x66,0x2a,0xfd,0xff,0xff,0x0,0xc8,0x0,0x0,0x4,0x23,0x5,0xff,0x6,0x26,0x2,0x53,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x6d,0x0,0x36,0xff,0xff,0x0,0xc8,0x0,0x0,0x4,0x23,0x5,0xfc,0x6,0x26,0x2,0x53,0x0,0x0,0x0,0x6,0x1,0x5b,0x59,0x33,0xff,0xff,0x0,0xc8,0x0,0x0,0x4,0x23,0x6,0x24,0x6,0x26,0x2,0x53,0x0,0x0,0x0,0x6,0x1,0x5c,0x5b,0x37,0xff,0xff,0x0,0xc8,0x0,0x0,0x4,0x23,0x5,0xfc,0x6,0x26,0x2,0x53,0x0,0x0,0x0,0x6,0x1,0x61,0xe4,0x37,0xff,0xff,0x0,0xd9,0x0,0x0,0x4,0x10,0x5,0xe3,0x6,0x26,0x2,0x57,0x0,0x0,0x0,0x6,0x1,0x5a,0xa6,0x1a,0xff,0xff,0x0,0xd9,0x0,0x0,0x4,0x10,0x5,0xe0,0x6,0x26,0x2,0x57,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x92,0x0,0x17,0xff,0xff,0x0,0xd9,0x0,0x0,0x4,0x10,0x6,0x8,0x6,0x26,0x2,0x57,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x94,0x0,0x1b,0xff,0xff,0x0,0xd9,0x0,0x0,0x4,0x10,0x5,0xe0,0x6,0x26,0x2,0x57,0x0,0x0,0x0,0x6,0x1,0x61,0x1c,0x1b,0xff,0xff,0x0,0xc2,0x0,0x0,0x4,0x16,0x6,0x2e,0x6,0x26,0x2,0x5c,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0xdc,0x0,0x3d,0xff,0xff,0x0,0x82,0xff,0xf0,0x4,0x4a,0x5,0xff,0x6,0x26,0x2,0x5d,0x0,0x0,0x0,0x6,0x1,0x5a,0xad,0x36,0xff,0xff,0x0,0x82,0xff,0xf0,0x4,0x4a,0x5,0xfc,0x6,0x26,0x2,0x5d,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x99,0x0,0x33,0xff,0xff,0x0,0x82,0xff,0xf0,0x4,0x4a,0x6,0x24,0x6,0x26,0x2,0x5d,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x9b,0x0,0x37,0xff,0xff,0x0,0x82,0xff,0xf0,0x4,0x4a,0x6,0x2e,0x6,0x26,0x2,0x5d,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0xa7,0x0,0x3d,0xff,0xff,0x0,0x82,0xff,0xf0,0x4,0x4a,0x5,0xfc,0x6,0x26,0x2,0x5d,0x0,0x0,0x0,0x6,0x1,0x61,0x23,0x37,0xff,0xff,0x0,0xb5,0xff,0xf0,0x4,0x2b,0x5,0xff,0x6,0x26,0x2,0x62,0x0,0x0,0x0,0x6,0x1,0x5a,0xa9,0x36,0xff,0xff,0x0,0xb5,0xff,0xf0,0x4,0x2b,0x5,0xfc,0x6,0x26,0x2,0x62,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x95,0x0,0x33,0xff,0xff,0x0,0xb5,0xff,0xf0,0x4,0x2b,0x6,0x24,0x6,0x26,0x2,0x62,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x97,0x0,0x37,0xff,0xff,0x0,0xb5,0xff,0xf0,0x4,0x2b,0x5,0xfc,0x6,0x26,0x2,0x62,0x0,0x0,0x0,0x6,0x1,0x61,0x1f,0x37,0xff,0xff,0x0,0x4d,0x0,0x0,0x4,0x81,0x5,0xfc,0x6,0x26,0x2,0x66,0x0,0x0,0x0,0x6,0x1,0x5b,0x62,0x33,0xff,0xff,0x0,0x36,0x0,0x0,0x4,0x8e,0x5,0xd6,0x6,0x26,0x2,0x4f,0x0,0x0,0x0,0x6,0x1,0x5e,0x5,0x26,0xff,0xff,0x0,0x36,0x0,0x0,0x4,0x8e,0x6,0x26,0x6,0x26,0x2,0x4f,0x0,0x0,0x0,0x6,0x1,0x5f,0x1,0x74,0x0,0x2,0x0,0x36,0xfe,0x4f,0x4,0x91,0x4,0x8d,0x0,0x23,0x0,0x28,0x0,0x0,0x41,0x23,0x1,0x33,0x13,0x21,0x13,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x33,0x1,0x13,0x37,0x17,0x13,0x2,0xb8,0xa5,0xfe,0x23,0xbc,0x6e,0x2,0x6,0x67,0x1e,0x33,0x15,0x23,0x26,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0x1c,0x1a,0x16,0x3c,0x24,0x23,0xfd,0xe,0xb0,0x18,0x18,0xaf,0x4,0x8d,0xfb,0x73,0x1,0x17,0xfe,0xf8,0x14,0x2c,0x17,0x28,0x57,0x2c,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x24,0x41,0x1d,0x19,0x2d,0x13,0x1,0xae,0x1,0xbf,0x3c,0x3d,0xfe,0x42,0x0,0xff,0xff,0x0,0x6e,0xff,0xf0,0x4,0x36,0x5,0xfc,0x6,0x26,0x2,0x51,0x0,0x0,0x0,0x6,0x1,0x5b,0x68,0x33,0xff,0xff,0x0,0x6e,0xff,0xf0,0x4,0x36,0x6,0x24,0x6,0x26,0x2,0x51,0x0,0x0,0x0,0x6,0x1,0x5c,0x6a,0x37,0xff,0xff,0x0,0x6e,0xff,0xf0,0x4,0x36,0x6,0x25,0x6,0x26,0x2,0x51,0x0,0x0,0x0,0x6,0x1,0x64,0xf4,0x38,0xff,0xff,0x0,0xb7,0x0,0x0,0x4,0x53,0x6,0x25,0x6,0x26,0x2,0x52,0x0,0x0,0x0,0x6,0x1,0x64,0xbb,0x38,0xff,0xff,0x0,0xc8,0x0,0x0,0x4,0x23,0x5,0xd6,0x6,0x26,0x2,0x53,0x0,0x0,0x0,0x6,0x1,0x5e,0xe8,0x26,0xff,0xff,0x0,0xc8,0x0,0x0,0x4,0x23,0x6,0x26,0x6,0x26,0x2,0x53,0x0,0x0,0x0,0x6,0x1,0x5f,0xe4,0x74,0xff,0xff,0x0,0xc8,0x0,0x0,0x4,0x23,0x5,0xf5,0x6,0x26,0x2,0x53,0x0,0x0,0x0,0x6,0x1,0x60,0xe4,0x37,0x0,0x1,0x0,0xc8,0xfe,0x4f,0x4,0x23,0x4,0x8d,0x0,0x28,0x0,0x0,0x41,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x21,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x33,0x35,0x21,0x11,0x3,0xc5,0xfd,0xc0,0x2,0x98,0xfc,0xab,0x2,0x1f,0x18,0x28,0x11,0x22,0x25,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0x1d,0x1a,0x16,0x3b,0x24,0x87,0xfd,0x62,0x2,0xe,0x98,0x1,0x4e,0x99,0xfb,0x73,0x11,0x26,0x13,0x28,0x57,0x2a,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x24,0x42,0x1d,0x19,0x2c,0x13,0x97,0x1,0x77,0xff,0xff,0x0,0xc8,0x0,0x0,0x4,0x23,0x6,0x25,0x6,0x26,0x2,0x53,0x0,0x0,0x0,0x6,0x1,0x64,0xe5,0x38,0xff,0xff,0x0,0x7c,0xff,0xf0,0x4,0x41,0x6,0x24,0x6,0x26,0x2,0x55,0x0,0x0,0x0,0x6,0x1,0x5c,0x74,0x37,0xff,0xff,0x0,0x7c,0xff,0xf0,0x4,0x41,0x6,0x26,0x6,0x26,0x2,0x55,0x0,0x0,0x0,0x6,0x1,0x5f,0xfd,0x74,0xff,0xff,0x0,0x7c,0xfe,0x2b,0x4,0x41,0x4,0x9d,0x6,0x26,0x2,0x55,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0x9d,0xfe,0xd5,0xff,0xff,0x0,0x9b,0x0,0x0,0x3,0xf9,0x6,0x24,0x6,0x26,0x2,0x56,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x9e,0x0,0x37,0xff,0xff,0x0,0xd9,0x0,0x0,0x4,0x10,0x6,0x12,0x6,0x26,0x2,0x57,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0xa0,0x0,0x21,0xff,0xff,0x0,0xd9,0x0,0x0,0x4,0x10,0x5,0xba,0x6,0x26,0x2,0x57,0x0,0x0,0x0,0x6,0x1,0x5e,0x20,0xa,0xff,0xff,0x0,0xd9,0x0,0x0,0x4,0x10,0x6,0xa,0x6,0x26,0x2,0x57,0x0,0x0,0x0,0x6,0x1,0x5f,0x1c,0x58,0x0,0x1,0x0,0xd9,0xfe,0x4f,0x4,0x10,0x4,0x8c,0x0,0x28,0x0,0x0,0x53,0x15,0x21,0x11,0x21,0x15,0x21,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x21,0x35,0x21,0x11,0x21,0x35,0xd9,0x1,0x3b,0xfe,0xc5,0x1,0x6c,0x1d,0x30,0x13,0x1b,0x1d,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0x1f,0x1c,0x15,0x3a,0x22,0x1,0x16,0xfe,0xbd,0x1,0x43,0x4,0x8c,0xa1,0xfc,0xb5,0xa0,0x15,0x2f,0x19,0x24,0x4c,0x26,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x25,0x44,0x1e,0x17,0x2b,0x12,0xa0,0x3,0x4b,0xa1,0x0,0xff,0xff,0x0,0xd9,0x0,0x0,0x4,0x10,0x5,0xd9,0x6,0x26,0x2,0x57,0x0,0x0,0x0,0x6,0x1,0x60,0x1c,0x1b,0xff,0xff,0x0,0x96,0xff,0xf0,0x4,0x77,0x6,0x24,0x6,0x26,0x2,0x58,0x0,0x0,0x0,0x7,0x1,0x5c,0x1,0x59,0x0,0x37,0xff,0xff,0x0,0xb4,0xfe,0x34,0x4,0x80,0x4,0x8d,0x6,0x26,0x2,0x59,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0x6b,0xfe,0xde,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x52,0x5,0xfc,0x6,0x26,0x2,0x5a,0x0,0x0,0x0,0x7,0x1,0x5b,0xff,0x1c,0x0,0x33,0xff,0xff,0x0,0xd1,0xfe,0x36,0x4,0x52,0x4,0x8d,0x6,0x26,0x2,0x5a,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0x68,0xfe,0xe0,0xff,0xff,0x0,0xd1,0x0,0x0,0x4,0x52,0x4,0x8d,0x6,0x26,0x2,0x5a,0x0,0x0,0x0,0x7,0x0,0x6d,0x0,0x94,0xfe,0x77,0xff,0xff,0x0,0xd1,0x0,0x0,0x4,0x52,0x4,0x8d,0x6,0x26,0x2,0x5a,0x0,0x0,0x0,0x7,0x1,0x60,0x0,0x19,0xfd,0x37,0xff,0xff,0x0,0xc2,0x0,0x0,0x4,0xf,0x5,0xfc,0x6,0x26,0x2,0x5c,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0xce,0x0,0x33,0xff,0xff,0x0,0xc2,0xfe,0x32,0x4,0xf,0x4,0x8d,0x6,0x26,0x2,0x5c,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0xef,0xfe,0xdc,0xff,0xff,0x0,0xc2,0x0,0x0,0x4,0xf,0x6,0x25,0x6,0x26,0x2,0x5c,0x0,0x0,0x0,0x6,0x1,0x64,0x59,0x38,0xff,0xff,0x0,0x82,0xff,0xf0,0x4,0x4a,0x5,0xd6,0x6,0x26,0x2,0x5d,0x0,0x0,0x0,0x6,0x1,0x5e,0x27,0x26,0xff,0xff,0x0,0x82,0xff,0xf0,0x4,0x4a,0x6,0x26,0x6,0x26,0x2,0x5d,0x0,0x0,0x0,0x6,0x1,0x5f,0x23,0x74,0xff,0xff,0x0,0x82,0xff,0xf0,0x4,0x7f,0x6,0x26,0x6,0x26,0x2,0x5d,0x0,0x0,0x0,0x7,0x1,0x63,0x0,0xa9,0x0,0x37,0xff,0xff,0x0,0x90,0x0,0x0,0x4,0x2c,0x5,0xfc,0x6,0x26,0x2,0x5f,0x0,0x0,0x0,0x6,0x1,0x5b,0x1e,0x33,0xff,0xff,0x0,0x90,0xfe,0x36,0x4,0x2c,0x4,0x8d,0x6,0x26,0x2,0x5f,0x0,0x0,0x0,0x7,0x1,0x68,0x0,0x45,0xfe,0xe0,0xff,0xff,0x0,0x90,0x0,0x0,0x4,0x2c,0x6,0x25,0x6,0x26,0x2,0x5f,0x0,0x0,0x0,0x6,0x1,0x64,0xaa,0x38,0xff,0xff,0x0,0x8a,0xff,0xf0,0x4,0x39,0x5,0xfc,0x6,0x26,0x2,0x60,0x0,0x0,0x0,0x6,0x1,0x5b,0x71,0x33,0xff,0xff,0x0,0x8a,0xff,0xf0,0x4,0x39,0x6,0x24,0x6,0x26,0x2,0x60,0x0,0x0,0x0,0x6,0x1,0x5c,0x73,0x37,0xff,0xff,0x0,0x8a,0xfe,0x4d,0x4,0x39,0x4,0x9d,0x6,0x26,0x2,0x60,0x0,0x0,0x0,0x6,0x1,0x66,0x3d,0x0,0xff,0xff,0x0,0x8a,0xff,0xf0,0x4,0x39,0x6,0x25,0x6,0x26,0x2,0x60,0x0,0x0,0x0,0x6,0x1,0x64,0xfd,0x38,0xff,0xff,0x0,0x5d,0x0,0x0,0x4,0x69,0x6,0x25,0x6,0x26,0x2,0x61,0x0,0x0,0x0,0x6,0x1,0x64,0xf9,0x38,0xff,0xff,0x0,0xb5,0xff,0xf0,0x4,0x2b,0x6,0x2e,0x6,0x26,0x2,0x62,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0xa3,0x0,0x3d,0xff,0xff,0x0,0xb5,0xff,0xf0,0x4,0x2b,0x5,0xd6,0x6,0x26,0x2,0x62,0x0,0x0,0x0,0x6,0x1,0x5e,0x23,0x26,0xff,0xff,0x0,0xb5,0xff,0xf0,0x4,0x2b,0x6,0x26,0x6,0x26,0x2,0x62,0x0,0x0,0x0,0x6,0x1,0x5f,0x1f,0x74,0xff,0xff,0x0,0xb5,0xff,0xf0,0x4,0x2b,0x6,0x67,0x6,0x26,0x2,0x62,0x0,0x0,0x0,0x7,0x1,0x62,0x0,0x1e,0x0,0x80,0xff,0xff,0x0,0xb5,0xff,0xf0,0x4,0x7b,0x6,0x26,0x6,0x26,0x2,0x62,0x0,0x0,0x0,0x7,0x1,0x63,0x0,0xa5,0x0,0x37,0x0,0x1,0x0,0xb5,0xfe,0x8c,0x4,0x2b,0x4,0x8d,0x0,0x39,0x0,0x0,0x41,0x23,0x3,0x6,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x3,0x23,0x3,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x32,0x33,0x6,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x27,0x6,0x6,0x27,0x22,0x26,0x35,0x34,0x36,0x37,0x36,0x36,0x37,0x36,0x36,0x35,0x4,0x2a,0xb7,0x1,0x1,0x25,0x21,0x22,0x5f,0x3b,0x3b,0x5f,0x21,0x22,0x25,0x1,0x1,0xb5,0x1,0x1,0x46,0x3c,0x3b,0xa0,0x5c,0x1,0x2,0x1,0xb,0x13,0x8,0xf,0x10,0x1e,0x1a,0x1a,0x46,0x29,0x41,0x55,0x1c,0x1f,0x10,0x35,0x20,0x2a,0x24,0xc,0xc,0xf,0x30,0x20,0x66,0x7f,0x4,0x8d,0xfc,0xf4,0x3b,0x5d,0x20,0x20,0x22,0x22,0x20,0x20,0x5d,0x3b,0x3,0xc,0xfc,0xf4,0x60,0x95,0x33,0x33,0x36,0xe,0x1b,0xe,0x1b,0x38,0x1c,0x2f,0x47,0x18,0x18,0x18,0x1c,0x10,0x79,0x8,0x13,0x1,0x29,0x22,0x18,0x2c,0x15,0x1b,0x31,0x15,0x2b,0xc1,0x79,0x0,0xff,0xff,0x0,0x2f,0x0,0x0,0x4,0xbb,0x6,0x24,0x6,0x26,0x2,0x64,0x0,0x0,0x0,0x7,0x1,0x5c,0x0,0x8a,0x0,0x37,0xff,0xff,0x0,0x4d,0x0,0x0,0x4,0x81,0x6,0x24,0x6,0x26,0x2,0x66,0x0,0x0,0x0,0x6,0x1,0x5c,0x64,0x37,0xff,0xff,0x0,0x4d,0x0,0x0,0x4,0x81,0x5,0xfc,0x6,0x26,0x2,0x66,0x0,0x0,0x0,0x6,0x1,0x61,0xed,0x37,0xff,0xff,0x0,0xb9,0x0,0x0,0x4,0x42,0x5,0xfc,0x6,0x26,0x2,0x67,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0xa0,0x0,0x33,0xff,0xff,0x0,0xb9,0x0,0x0,0x4,0x42,0x5,0xf5,0x6,0x26,0x2,0x67,0x0,0x0,0x0,0x6,0x1,0x60,0x2a,0x37,0xff,0xff,0x0,0xb9,0x0,0x0,0x4,0x42,0x6,0x25,0x6,0x26,0x2,0x67,0x0,0x0,0x0,0x6,0x1,0x64,0x2b,0x38,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x6,0x7a,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x78,0xfe,0xc0,0x0,0x0,0xff,0xff,0xff,0xdd,0x0,0x0,0x4,0x66,0x6,0x7a,0x4,0x26,0x0,0x6,0x32,0x0,0x0,0x7,0x1,0x78,0xfd,0xb4,0x0,0x0,0xff,0xff,0xff,0xcb,0x0,0x0,0x4,0x71,0x6,0x7c,0x4,0x26,0x0,0x9,0x32,0x0,0x0,0x7,0x1,0x78,0xfd,0xa2,0x0,0x2,0xff,0xff,0xff,0xba,0x0,0x0,0x4,0x50,0x6,0x7b,0x4,0x26,0x0,0xa,0x32,0x0,0x0,0x7,0x1,0x78,0xfd,0x91,0x0,0x1,0xff,0xff,0xff,0xff,0xff,0xec,0x4,0x6b,0x6,0x7a,0x4,0x26,0x0,0x10,0xa,0x0,0x0,0x7,0x1,0x78,0xfd,0xd6,0x0,0x0,0xff,0xff,0xff,0x80,0x0,0x0,0x4,0xab,0x6,0x7a,0x4,0x26,0x0,0x1a,0x32,0x0,0x0,0x7,0x1,0x78,0xfd,0x57,0x0,0x0,0xff,0xff,0xff,0xfb,0x0,0x0,0x4,0x76,0x6,0x7a,0x4,0x26,0x1,0x84,0xa,0x0,0x0,0x7,0x1,0x78,0xfd,0xd2,0x0,0x0,0xff,0xff,0x0,0xb8,0xff,0xec,0x4,0x3a,0x6,0x7a,0x6,0x26,0x1,0x8d,0x0,0x0,0x0,0x6,0x1,0x79,0xe4,0xbb,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x5,0xb0,0x6,0x6,0x0,0x2,0x0,0x0,0xff,0xff,0x0,0xac,0x0,0x0,0x4,0x60,0x5,0xb0,0x6,0x6,0x0,0x3,0x0,0x0,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x5,0xb0,0x6,0x6,0x0,0x6,0x0,0x0,0xff,0xff,0x0,0x72,0x0,0x0,0x4,0x37,0x5,0xb0,0x6,0x6,0x0,0x1b,0x0,0x0,0xff,0xff,0x0,0x8d,0x0,0x0,0x4,0x3f,0x5,0xb0,0x6,0x6,0x0,0x9,0x0,0x0,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x5,0xb0,0x6,0x6,0x0,0xa,0x0,0x0,0xff,0xff,0x0,0xac,0x0,0x0,0x4,0xa4,0x5,0xb0,0x6,0x6,0x0,0xc,0x0,0x0,0xff,0xff,0x0,0x94,0x0,0x0,0x4,0x4c,0x5,0xb0,0x6,0x6,0x0,0xe,0x0,0x0,0xff,0xff,0x0,0x8f,0x0,0x0,0x4,0x3e,0x5,0xb0,0x6,0x6,0x0,0xf,0x0,0x0,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x5,0xc4,0x6,0x6,0x0,0x10,0x0,0x0,0xff,0xff,0x0,0xbf,0x0,0x0,0x4,0x79,0x5,0xb0,0x6,0x6,0x0,0x11,0x0,0x0,0xff,0xff,0x0,0x4c,0x0,0x0,0x4,0x84,0x5,0xb0,0x6,0x6,0x0,0x15,0x0,0x0,0xff,0xff,0x0,0x3d,0x0,0x0,0x4,0x79,0x5,0xb0,0x6,0x6,0x0,0x1a,0x0,0x0,0xff,0xff,0x0,0x57,0x0,0x0,0x4,0x8f,0x5,0xb0,0x6,0x6,0x0,0x19,0x0,0x0,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x7,0x20,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x61,0xff,0xd2,0x1,0x5b,0xff,0xff,0x0,0x3d,0x0,0x0,0x4,0x79,0x7,0x1f,0x6,0x26,0x0,0x1a,0x0,0x0,0x0,0x7,0x1,0x61,0xff,0xfc,0x1,0x5a,0xff,0xff,0x0,0x81,0xff,0xeb,0x4,0x8a,0x6,0x7e,0x6,0x26,0x1,0x85,0x0,0x0,0x0,0x6,0x1,0x78,0xf,0x4,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x60,0x6,0x7d,0x6,0x26,0x1,0x89,0x0,0x0,0x0,0x6,0x1,0x78,0x14,0x3,0xff,0xff,0x0,0xa4,0xfe,0x61,0x4,0x2b,0x6,0x7e,0x6,0x26,0x1,0x8b,0x0,0x0,0x0,0x6,0x1,0x78,0x1c,0x4,0xff,0xff,0x0,0xb8,0xff,0xec,0x4,0x3a,0x6,0x6a,0x6,0x26,0x1,0x8d,0x0,0x0,0x0,0x6,0x1,0x78,0xe,0xf0,0xff,0xff,0x0,0x9e,0xff,0xec,0x4,0x3f,0x6,0x7a,0x6,0x26,0x1,0x95,0x0,0x0,0x0,0x6,0x1,0x79,0xc0,0xbb,0xff,0xff,0x0,0xba,0x0,0x0,0x4,0x72,0x4,0x3a,0x6,0x6,0x0,0x4f,0x0,0x0,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x4,0x4e,0x6,0x6,0x0,0x2a,0x0,0x0,0xff,0xff,0x0,0xbc,0xfe,0x60,0x4,0x10,0x4,0x3a,0x6,0x6,0x1,0x6b,0x0,0x0,0xff,0xff,0x0,0x62,0x0,0x0,0x4,0x65,0x4,0x3a,0x6,0x6,0x0,0x31,0x0,0x0,0xff,0xff,0x0,0x6e,0x0,0x0,0x4,0x72,0x4,0x3a,0x6,0x6,0x0,0x33,0x0,0x0,0xff,0xff,0x0,0xb8,0xff,0xec,0x4,0x3a,0x5,0xc9,0x6,0x26,0x1,0x8d,0x0,0x0,0x0,0x6,0x1,0x61,0x5,0x4,0xff,0xff,0x0,0x9e,0xff,0xec,0x4,0x3f,0x5,0xc9,0x6,0x26,0x1,0x95,0x0,0x0,0x0,0x6,0x1,0x61,0xe2,0x4,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x6,0x7e,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x1,0x78,0x9,0x4,0xff,0xff,0x0,0x9e,0xff,0xec,0x4,0x3f,0x6,0x6a,0x6,0x26,0x1,0x95,0x0,0x0,0x0,0x6,0x1,0x78,0xeb,0xf0,0xff,0xff,0x0,0x4f,0xff,0xec,0x4,0x89,0x6,0x6a,0x6,0x26,0x1,0x98,0x0,0x0,0x0,0x6,0x1,0x78,0x15,0xf0,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0x20,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x61,0x0,0x5,0x1,0x5b,0xff,0xff,0x0,0xb5,0x0,0x0,0x4,0x30,0x7,0x20,0x6,0x26,0x1,0x7b,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x80,0x1,0x57,0x0,0x1,0x0,0x76,0xff,0xec,0x4,0x69,0x5,0xc4,0x0,0x4f,0x0,0x0,0x41,0x14,0x6,0x7,0x6,0x6,0x23,0x22,0x26,0x27,0x26,0x26,0x27,0x23,0x16,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x26,0x26,0x27,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x26,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x14,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x17,0x16,0x16,0x3,0xa8,0x34,0x29,0x29,0x69,0x36,0x44,0x73,0x2c,0x2c,0x38,0x9,0xbd,0x3,0x5c,0x4a,0x49,0xba,0x61,0x57,0xae,0x45,0x45,0x57,0x25,0x21,0x21,0x58,0x33,0x33,0x6e,0x36,0x31,0x6f,0x2f,0x30,0x3e,0x1,0x2f,0x28,0x27,0x65,0x35,0x42,0x69,0x26,0x26,0x2e,0x8,0xbe,0x2,0x52,0x44,0x44,0xb0,0x5f,0x56,0xaa,0x43,0x43,0x53,0x53,0x42,0x41,0x9f,0x4d,0x35,0x73,0x30,0x1c,0x2e,0xe,0xa,0xb,0x1,0x70,0x3c,0x57,0x1c,0x1d,0x1b,0x25,0x25,0x24,0x69,0x44,0x68,0xa3,0x38,0x39,0x3c,0x31,0x31,0x30,0x92,0x62,0x41,0x6b,0x2d,0x2c,0x46,0x1c,0x1c,0x2b,0x11,0xf,0x28,0x1e,0x1e,0x57,0x3f,0x3a,0x58,0x1e,0x1e,0x1e,0x29,0x25,0x25,0x67,0x3f,0x64,0xa2,0x39,0x39,0x3f,0x35,0x33,0x33,0x94,0x5e,0x5e,0x8b,0x33,0x33,0x46,0x19,0x11,0x2a,0x1f,0x13,0x2f,0x1e,0x14,0x30,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x5,0xb0,0x6,0x6,0x0,0xa,0x0,0x0,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x7,0x20,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x61,0xff,0xd2,0x1,0x5b,0xff,0xff,0x0,0x62,0xff,0xec,0x4,0x16,0x5,0xb0,0x6,0x6,0x0,0xb,0x0,0x0,0xff,0xff,0x0,0xa9,0x0,0x0,0x4,0xb6,0x5,0xb0,0x6,0x6,0x2,0x71,0x0,0x0,0xff,0xff,0x0,0xac,0x0,0x0,0x4,0xa4,0x7,0xe,0x6,0x26,0x0,0xc,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x7e,0x1,0x45,0xff,0xff,0x0,0x2b,0xff,0xeb,0x4,0xb5,0x7,0x4a,0x6,0x26,0x1,0xa8,0x0,0x0,0x0,0x7,0x1,0x5f,0x0,0x21,0x1,0x98,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x5,0xb0,0x6,0x6,0x0,0x2,0x0,0x0,0xff,0xff,0x0,0xac,0x0,0x0,0x4,0x60,0x5,0xb0,0x6,0x6,0x0,0x3,0x0,0x0,0xff,0xff,0x0,0xb5,0x0,0x0,0x4,0x30,0x5,0xb0,0x6,0x6,0x1,0x7b,0x0,0x0,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x5,0xb0,0x6,0x6,0x0,0x6,0x0,0x0,0xff,0xff,0x0,0xa2,0x0,0x0,0x4,0x2a,0x7,0x3e,0x6,0x26,0x1,0xa6,0x0,0x0,0x0,0x7,0x1,0x5f,0xff,0xf9,0x1,0x8c,0xff,0xff,0x0,0x94,0x0,0x0,0x4,0x4c,0x5,0xb0,0x6,0x6,0x0,0xe,0x0,0x0,0xff,0xff,0x0,0x8d,0x0,0x0,0x4,0x3f,0x5,0xb0,0x6,0x6,0x0,0x9,0x0,0x0,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x5,0xc4,0x6,0x6,0x0,0x10,0x0,0x0,0xff,0xff,0x0,0xa2,0x0,0x0,0x4,0x2a,0x5,0xb0,0x6,0x6,0x1,0x80,0x0,0x0,0xff,0xff,0x0,0xbf,0x0,0x0,0x4,0x79,0x5,0xb0,0x6,0x6,0x0,0x11,0x0,0x0,0xff,0xff,0x0,0x6b,0xff,0xec,0x4,0x5d,0x5,0xc4,0x6,0x6,0x0,0x4,0x0,0x0,0xff,0xff,0x0,0x4c,0x0,0x0,0x4,0x84,0x5,0xb0,0x6,0x6,0x0,0x15,0x0,0x0,0xff,0xff,0x0,0x45,0x0,0x0,0x4,0x87,0x5,0xb0,0x6,0x6,0x1,0x82,0x0,0x0,0xff,0xff,0x0,0x57,0x0,0x0,0x4,0x8f,0x5,0xb0,0x6,0x6,0x0,0x19,0x0,0x0,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x4,0x4e,0x6,0x6,0x0,0x1c,0x0,0x0,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x4,0x4e,0x6,0x6,0x0,0x20,0x0,0x0,0xff,0xff,0x0,0xa5,0x0,0x0,0x4,0x27,0x5,0xf3,0x6,0x26,0x1,0xb9,0x0,0x0,0x0,0x6,0x1,0x5f,0xf4,0x41,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x4,0x4e,0x6,0x6,0x0,0x2a,0x0,0x0,0xff,0xff,0x0,0xad,0xfe,0x60,0x4,0x3f,0x4,0x4e,0x6,0x6,0x0,0x2b,0x0,0x0,0x0,0x1,0x0,0x8f,0xff,0xec,0x4,0x33,0x4,0x4e,0x0,0x33,0x0,0x0,0x65,0x22,0x26,0x27,0x26,0x26,0x35,0x35,0x34,0x36,0x37,0x36,0x36,0x33,0x32,0x16,0x17,0x16,0x16,0x17,0x33,0x34,0x26,0x27,0x26,0x26,0x23,0x22,0x6,0x7,0x6,0x6,0x15,0x15,0x14,0x16,0x17,0x16,0x16,0x33,0x32,0x36,0x37,0x36,0x36,0x37,0x23,0x6,0x6,0x7,0x6,0x6,0x2,0x7b,0x57,0x75,0x23,0x24,0x1f,0x1f,0x24,0x24,0x75,0x56,0x38,0x61,0x23,0x23,0x29,0x1,0xaf,0x42,0x3a,0x3b,0xa1,0x60,0x7b,0xb8,0x3d,0x3e,0x3e,0x3e,0x3e,0x3d,0xb8,0x7b,0x56,0x9e,0x3d,0x3d,0x49,0x1,0xaf,0x1,0x2d,0x25,0x25,0x5f,0x82,0x45,0x38,0x37,0x8b,0x47,0x2a,0x46,0x8a,0x38,0x37,0x45,0x26,0x21,0x21,0x57,0x31,0x52,0x90,0x35,0x34,0x3d,0x58,0x4a,0x4b,0xc4,0x6b,0x2a,0x6c,0xc3,0x4a,0x4b,0x58,0x3b,0x32,0x31,0x83,0x48,0x2d,0x4d,0x1c,0x1d,0x20,0x0,0xff,0xff,0x0,0x44,0xfe,0x4b,0x4,0x85,0x4,0x3a,0x6,0x6,0x0,0x34,0x0,0x0,0xff,0xff,0x0,0x6e,0x0,0x0,0x4,0x72,0x4,0x3a,0x6,0x6,0x0,0x33,0x0,0x0,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x5,0xdf,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x1,0x61,0x6,0x1a,0xff,0xff,0x0,0xb7,0x0,0x0,0x4,0x2a,0x5,0xc9,0x6,0x26,0x1,0xb5,0x0,0x0,0x0,0x6,0x1,0x5b,0x73,0x0,0xff,0xff,0x0,0xaf,0xff,0xec,0x4,0x36,0x4,0x4e,0x6,0x6,0x0,0x2e,0x0,0x0,0xff,0xff,0x0,0xcb,0x0,0x0,0x4,0x55,0x5,0xc3,0x6,0x6,0x0,0x24,0x0,0x0,0xff,0xff,0x0,0xcb,0x0,0x0,0x4,0x55,0x5,0xc9,0x6,0x26,0x1,0x6d,0x0,0x0,0x0,0x6,0x1,0x61,0x34,0x4,0xff,0xff,0x0,0xd3,0xfe,0x4b,0x3,0x58,0x5,0xc3,0x6,0x6,0x0,0x25,0x0,0x0,0xff,0xff,0x0,0xa4,0x0,0x0,0x4,0x95,0x5,0xc9,0x6,0x26,0x1,0xba,0x0,0x0,0x0,0x6,0x1,0x5b,0x27,0x0,0xff,0xff,0x0,0x44,0xfe,0x4b,0x4,0x85,0x5,0xf4,0x6,0x26,0x0,0x34,0x0,0x0,0x0,0x6,0x1,0x5f,0x13,0x42,0xff,0xff,0x0,0x68,0xff,0xf5,0x4,0x66,0x5,0xb0,0x4,0x27,0x0,0x5b,0xfe,0x82,0x0,0x0,0x0,0x7,0x0,0x5b,0x1,0x9a,0x0,0x0,0xff,0xff,0x0,0xb0,0xfe,0x4b,0x3,0xfb,0x5,0xe9,0x6,0x26,0x1,0x71,0x0,0x0,0x0,0x6,0x1,0x64,0x60,0xfc,0xff,0xff,0x1,0xcd,0x4,0x7,0x2,0xe0,0x6,0x16,0x6,0x6,0x0,0x6d,0x0,0x0,0xff,0xff,0x0,0x94,0x0,0x0,0x4,0x4c,0x7,0x20,0x6,0x26,0x0,0xe,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x75,0x1,0x57,0xff,0xff,0x0,0x5d,0x0,0x0,0x4,0x72,0x5,0xde,0x6,0x26,0x0,0x28,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x9c,0x0,0x15,0xff,0xff,0x0,0x51,0xfe,0x86,0x4,0x90,0x5,0xb0,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x6,0x1,0x72,0x25,0x0,0xff,0xff,0x0,0x9c,0xfe,0x86,0x4,0x36,0x4,0x4e,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x1,0x72,0xed,0x0,0xff,0xff,0xff,0x89,0xff,0xec,0x4,0x61,0x6,0x56,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x2,0x6c,0xfd,0x94,0x0,0x92,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0x23,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x8f,0x1,0x5a,0xff,0xff,0x0,0xa2,0x0,0x0,0x4,0x2a,0x7,0x17,0x6,0x26,0x1,0xa6,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x82,0x1,0x4e,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x5,0xe2,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x1,0x5a,0x90,0x19,0xff,0xff,0x0,0xa5,0x0,0x0,0x4,0x27,0x5,0xcc,0x6,0x26,0x1,0xb9,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x7d,0x0,0x3,0xff,0xff,0x0,0x65,0x0,0x0,0x4,0x72,0x5,0xb0,0x6,0x6,0x1,0x83,0x0,0x0,0xff,0xff,0x0,0x61,0xfe,0x28,0x4,0x80,0x4,0x3a,0x6,0x6,0x1,0x97,0x0,0x0,0xff,0xff,0x0,0x1a,0x0,0x0,0x4,0xe1,0x7,0x42,0x6,0x26,0x1,0xe2,0x0,0x0,0x0,0x7,0x1,0x77,0x4,0x59,0x1,0x54,0xff,0xff,0x0,0x40,0x0,0x0,0x4,0x60,0x6,0x19,0x6,0x26,0x1,0xe3,0x0,0x0,0x0,0x7,0x1,0x77,0x4,0x3b,0x0,0x2b,0xff,0xff,0x0,0x59,0xfe,0x2f,0x4,0x70,0x5,0xc4,0x6,0x26,0x1,0xa5,0x0,0x0,0x0,0x6,0x2,0x6e,0xf1,0x96,0xff,0xff,0x0,0x87,0xfe,0x39,0x4,0x4a,0x4,0x4d,0x6,0x26,0x1,0xb8,0x0,0x0,0x0,0x6,0x2,0x6e,0x8,0xa0,0xff,0xff,0x0,0x6b,0xfe,0x39,0x4,0x5d,0x5,0xc4,0x6,0x26,0x0,0x4,0x0,0x0,0x0,0x6,0x2,0x6e,0xff,0xa0,0xff,0xff,0x0,0x8f,0xfe,0x39,0x4,0x33,0x4,0x4e,0x6,0x26,0x0,0x1e,0x0,0x0,0x0,0x6,0x2,0x6e,0x13,0xa0,0xff,0xff,0x0,0x3d,0x0,0x0,0x4,0x79,0x5,0xb0,0x6,0x6,0x0,0x1a,0x0,0x0,0xff,0xff,0x0,0x47,0xfe,0x60,0x4,0x96,0x4,0x3a,0x6,0x6,0x1,0x87,0x0,0x0,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x5,0xb0,0x6,0x6,0x0,0xa,0x0,0x0,0xff,0xff,0x0,0x1d,0x0,0x0,0x4,0xae,0x7,0x4a,0x6,0x26,0x1,0xa4,0x0,0x0,0x0,0x7,0x1,0x5f,0x0,0xd,0x1,0x98,0xff,0xff,0x0,0x11,0x0,0x0,0x4,0xac,0x5,0xf3,0x6,0x26,0x1,0xb7,0x0,0x0,0x0,0x6,0x1,0x5f,0xf4,0x41,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x5,0xb0,0x6,0x6,0x0,0xa,0x0,0x0,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x7,0x4a,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x5f,0x0,0xf,0x1,0x98,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x6,0x8,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x1,0x5f,0xb,0x56,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x7,0x20,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x61,0x0,0xf,0x1,0x5b,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x5,0xde,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x1,0x61,0xb,0x19,0xff,0xff,0x0,0x20,0x0,0x0,0x4,0xab,0x5,0xb0,0x6,0x6,0x0,0x48,0x0,0x0,0xff,0xff,0x0,0x2b,0xff,0xec,0x4,0xa9,0x4,0x4e,0x6,0x6,0x0,0x49,0x0,0x0,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0x4a,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x5f,0x0,0x5,0x1,0x98,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x6,0x9,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x1,0x5f,0x6,0x57,0xff,0xff,0x0,0x5a,0xff,0xeb,0x4,0x57,0x6,0xf2,0x6,0x26,0x2,0x10,0x0,0x0,0x0,0x7,0x1,0x61,0xff,0xfb,0x1,0x2d,0xff,0xff,0x0,0xb1,0xff,0xec,0x4,0x5f,0x4,0x4f,0x6,0x6,0x0,0x51,0x0,0x0,0xff,0xff,0x0,0xb1,0xff,0xec,0x4,0x5f,0x5,0xdf,0x6,0x26,0x0,0x51,0x0,0x0,0x0,0x6,0x1,0x61,0x28,0x1a,0xff,0xff,0x0,0x1d,0x0,0x0,0x4,0xae,0x7,0x20,0x6,0x26,0x1,0xa4,0x0,0x0,0x0,0x7,0x1,0x61,0x0,0xd,0x1,0x5b,0xff,0xff,0x0,0x11,0x0,0x0,0x4,0xac,0x5,0xc9,0x6,0x26,0x1,0xb7,0x0,0x0,0x0,0x6,0x1,0x61,0xf4,0x4,0xff,0xff,0x0,0x59,0xff,0xeb,0x4,0x70,0x7,0x35,0x6,0x26,0x1,0xa5,0x0,0x0,0x0,0x7,0x1,0x61,0xff,0xfc,0x1,0x70,0xff,0xff,0x0,0x87,0xff,0xed,0x4,0x4a,0x5,0xdd,0x6,0x26,0x1,0xb8,0x0,0x0,0x0,0x6,0x1,0x61,0xa,0x18,0xff,0xff,0x0,0xa2,0x0,0x0,0x4,0x2a,0x6,0xee,0x6,0x26,0x1,0xa6,0x0,0x0,0x0,0x7,0x1,0x5e,0xff,0xfd,0x1,0x3e,0xff,0xff,0x0,0xa5,0x0,0x0,0x4,0x27,0x5,0xa4,0x6,0x26,0x1,0xb9,0x0,0x0,0x0,0x6,0x1,0x5e,0xf8,0xf4,0xff,0xff,0x0,0xa2,0x0,0x0,0x4,0x2a,0x7,0x14,0x6,0x26,0x1,0xa6,0x0,0x0,0x0,0x7,0x1,0x61,0xff,0xf9,0x1,0x4f,0xff,0xff,0x0,0xa5,0x0,0x0,0x4,0x27,0x5,0xc9,0x6,0x26,0x1,0xb9,0x0,0x0,0x0,0x6,0x1,0x61,0xf4,0x4,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x7,0x35,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x1,0x61,0x0,0x13,0x1,0x70,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x5,0xde,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x1,0x61,0x0,0x19,0xff,0xff,0x0,0x63,0xff,0xec,0x4,0x5a,0x5,0xc4,0x6,0x6,0x1,0xe0,0x0,0x0,0xff,0xff,0x0,0x5d,0xff,0xec,0x4,0x35,0x4,0x4e,0x6,0x6,0x1,0xe1,0x0,0x0,0xff,0xff,0x0,0x63,0xff,0xec,0x4,0x5a,0x7,0x1b,0x6,0x26,0x1,0xe0,0x0,0x0,0x0,0x7,0x1,0x61,0x0,0x14,0x1,0x56,0xff,0xff,0x0,0x5d,0xff,0xec,0x4,0x35,0x5,0xfa,0x6,0x26,0x1,0xe1,0x0,0x0,0x0,0x6,0x1,0x61,0xd0,0x35,0xff,0xff,0x0,0x72,0xff,0xec,0x4,0x53,0x7,0x36,0x6,0x26,0x1,0xb0,0x0,0x0,0x0,0x7,0x1,0x61,0xff,0xf1,0x1,0x71,0xff,0xff,0x0,0x81,0xff,0xec,0x4,0x3a,0x5,0xde,0x6,0x26,0x1,0xc8,0x0,0x0,0x0,0x6,0x1,0x61,0xed,0x19,0xff,0xff,0x0,0x2b,0xff,0xeb,0x4,0xb5,0x6,0xfa,0x6,0x26,0x1,0xa8,0x0,0x0,0x0,0x7,0x1,0x5e,0x0,0x25,0x1,0x4a,0xff,0xff,0x0,0x44,0xfe,0x4b,0x4,0x85,0x5,0xa5,0x6,0x26,0x0,0x34,0x0,0x0,0x0,0x6,0x1,0x5e,0x17,0xf5,0xff,0xff,0x0,0x2b,0xff,0xeb,0x4,0xb5,0x7,0x20,0x6,0x26,0x1,0xa8,0x0,0x0,0x0,0x7,0x1,0x61,0x0,0x21,0x1,0x5b,0xff,0xff,0x0,0x44,0xfe,0x4b,0x4,0x85,0x5,0xca,0x6,0x26,0x0,0x34,0x0,0x0,0x0,0x6,0x1,0x61,0x13,0x5,0xff,0xff,0x0,0x2b,0xff,0xeb,0x4,0xb5,0x7,0x4a,0x6,0x26,0x1,0xa8,0x0,0x0,0x0,0x7,0x1,0x63,0x0,0xa7,0x1,0x5b,0xff,0xff,0x0,0x44,0xfe,0x4b,0x4,0x85,0x5,0xf4,0x6,0x26,0x0,0x34,0x0,0x0,0x0,0x7,0x1,0x63,0x0,0x99,0x0,0x5,0xff,0xff,0x0,0xab,0x0,0x0,0x4,0x27,0x7,0x20,0x6,0x26,0x1,0xaa,0x0,0x0,0x0,0x7,0x1,0x61,0xff,0xb3,0x1,0x5b,0xff,0xff,0x0,0x8d,0x0,0x0,0x4,0x27,0x5,0xc9,0x6,0x26,0x1,0xc2,0x0,0x0,0x0,0x6,0x1,0x61,0x1b,0x4,0xff,0xff,0x0,0x90,0x0,0x0,0x4,0x4b,0x7,0x20,0x6,0x26,0x1,0xae,0x0,0x0,0x0,0x7,0x1,0x61,0xff,0xe1,0x1,0x5b,0xff,0xff,0x0,0x90,0x0,0x0,0x4,0x3f,0x5,0xc9,0x6,0x26,0x1,0xc6,0x0,0x0,0x0,0x6,0x1,0x61,0x43,0x4,0xff,0xff,0x0,0x57,0xfe,0x4b,0x5,0x16,0x5,0xb0,0x6,0x26,0x0,0x19,0x0,0x0,0x0,0x7,0x2,0x6f,0x2,0x4,0x0,0x0,0xff,0xff,0x0,0x6e,0xfe,0x4b,0x4,0xa5,0x4,0x3a,0x6,0x26,0x0,0x33,0x0,0x0,0x0,0x7,0x2,0x6f,0x1,0x93,0x0,0x0,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x1c,0x6,0x0,0x6,0x6,0x0,0x1f,0x0,0x0,0xff,0xff,0x0,0x2f,0xfe,0x4b,0x4,0xe3,0x5,0xb0,0x6,0x26,0x1,0xa7,0x0,0x0,0x0,0x7,0x2,0x6f,0x1,0xd1,0x0,0x0,0xff,0xff,0x0,0x37,0xfe,0x4b,0x4,0xde,0x4,0x3a,0x6,0x26,0x1,0xbb,0x0,0x0,0x0,0x7,0x2,0x6f,0x1,0xcc,0x0,0x0,0xff,0xff,0x0,0x51,0xfe,0xa8,0x4,0x90,0x5,0xb0,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0xdf,0x0,0x0,0xff,0xff,0x0,0x9c,0xfe,0xa8,0x4,0x36,0x4,0x4e,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0xa3,0x0,0x0,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x7,0xc6,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xc8,0x1,0x52,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x6,0x84,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xc4,0x0,0x10,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0xe9,0x7,0xee,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x2,0x4c,0xff,0xf5,0x1,0x59,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0xe5,0x6,0xac,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x2,0x4c,0xf1,0x17,0xff,0xff,0xff,0xfc,0x0,0x0,0x4,0x90,0x7,0xdd,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x2,0x4b,0xff,0xec,0x1,0x48,0xff,0xff,0xff,0xf8,0xff,0xec,0x4,0x36,0x6,0x9b,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x2,0x4b,0xe8,0x6,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0xbb,0x8,0x4,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x2,0x4a,0x0,0x1,0x1,0x35,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0xb8,0x6,0xc3,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x2,0x4a,0xfe,0xf4,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x8,0x2f,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x2,0x49,0xff,0xf3,0x1,0x36,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x6,0xee,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x2,0x49,0xef,0xf5,0xff,0xff,0x0,0x51,0xfe,0xa8,0x4,0x90,0x7,0x48,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x27,0x1,0x5c,0x0,0x87,0x1,0x5b,0x0,0x7,0x1,0x65,0x4,0xdf,0x0,0x0,0xff,0xff,0x0,0x9c,0xfe,0xa8,0x4,0x36,0x6,0x6,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x27,0x1,0x5c,0x0,0x83,0x0,0x19,0x0,0x7,0x1,0x65,0x4,0xa3,0x0,0x0,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x7,0xde,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x2,0x69,0x0,0x0,0x1,0x54,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x6,0x9c,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x2,0x69,0xfc,0x12,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x8,0x4,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x2,0x4d,0x0,0x3,0x1,0x7a,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x6,0xc2,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x2,0x4d,0x0,0x38,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x8,0x4c,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x2,0x68,0xff,0xf4,0x1,0x49,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x7,0xa,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x2,0x68,0xf0,0x7,0xff,0xff,0x0,0x51,0x0,0x0,0x4,0x90,0x8,0x21,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x7,0x2,0x6d,0xff,0xd4,0x1,0x51,0xff,0xff,0x0,0x9c,0xff,0xec,0x4,0x36,0x6,0xdf,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x6,0x2,0x6d,0xd0,0xf,0xff,0xff,0x0,0x51,0xfe,0xa8,0x4,0x90,0x7,0x4a,0x6,0x26,0x0,0x2,0x0,0x0,0x0,0x27,0x1,0x5f,0x0,0xf,0x1,0x98,0x0,0x7,0x1,0x65,0x4,0xdf,0x0,0x0,0xff,0xff,0x0,0x9c,0xfe,0xa8,0x4,0x36,0x6,0x8,0x6,0x26,0x0,0x1c,0x0,0x0,0x0,0x26,0x1,0x5f,0xb,0x56,0x0,0x7,0x1,0x65,0x4,0xa3,0x0,0x0,0xff,0xff,0x0,0xb6,0xfe,0xb2,0x4,0x34,0x5,0xb0,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0xd2,0x0,0xa,0xff,0xff,0x0,0x87,0xfe,0xa8,0x4,0x45,0x4,0x4e,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0xe3,0x0,0x0,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0xc6,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xbe,0x1,0x52,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x6,0x85,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xbf,0x0,0x11,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x7,0x52,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x89,0x1,0x61,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x6,0x11,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x8a,0x0,0x20,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0xdf,0x7,0xee,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x2,0x4c,0xff,0xeb,0x1,0x59,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0xe0,0x6,0xad,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x2,0x4c,0xec,0x18,0xff,0xff,0xff,0xf2,0x0,0x0,0x4,0x34,0x7,0xdd,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x2,0x4b,0xff,0xe2,0x1,0x48,0xff,0xff,0xff,0xf3,0xff,0xec,0x4,0x45,0x6,0x9c,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x2,0x4b,0xe3,0x7,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0xb2,0x8,0x4,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x2,0x4a,0xff,0xf8,0x1,0x35,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0xb3,0x6,0xc4,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x2,0x4a,0xf9,0xf5,0xff,0xff,0x0,0xb6,0x0,0x0,0x4,0x34,0x8,0x2f,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x7,0x2,0x49,0xff,0xe9,0x1,0x36,0xff,0xff,0x0,0x87,0xff,0xec,0x4,0x45,0x6,0xef,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x6,0x2,0x49,0xea,0xf6,0xff,0xff,0x0,0xb6,0xfe,0xb2,0x4,0x34,0x7,0x48,0x6,0x26,0x0,0x6,0x0,0x0,0x0,0x27,0x1,0x5c,0x0,0x7d,0x1,0x5b,0x0,0x7,0x1,0x65,0x4,0xd2,0x0,0xa,0xff,0xff,0x0,0x87,0xfe,0xa8,0x4,0x45,0x6,0x7,0x6,0x26,0x0,0x20,0x0,0x0,0x0,0x26,0x1,0x5c,0x7e,0x1a,0x0,0x7,0x1,0x65,0x4,0xe3,0x0,0x0,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x1e,0x7,0xc6,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0x8a,0x1,0x52,0xff,0xff,0x0,0xcb,0x0,0x0,0x4,0x55,0x6,0x70,0x6,0x26,0x1,0x6d,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xed,0xff,0xfc,0xff,0xff,0x0,0xae,0xfe,0xb2,0x4,0x1e,0x5,0xb0,0x6,0x26,0x0,0xa,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0x9e,0x0,0xa,0xff,0xff,0x0,0xcb,0xfe,0xb2,0x4,0x55,0x5,0xc3,0x6,0x26,0x0,0x24,0x0,0x0,0x0,0x7,0x1,0x65,0x5,0x6,0x0,0xa,0xff,0xff,0x0,0x6a,0xfe,0xa0,0x4,0x61,0x5,0xc4,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0xdf,0xff,0xf8,0xff,0xff,0x0,0x7a,0xfe,0x9f,0x4,0x52,0x4,0x4e,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0xcd,0xff,0xf7,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x7,0xdb,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xcc,0x1,0x67,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x6,0x84,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xb9,0x0,0x10,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0xed,0x8,0x3,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x2,0x4c,0xff,0xf9,0x1,0x6e,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0xda,0x6,0xac,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x2,0x4c,0xe6,0x17,0xff,0xff,0x0,0x0,0xff,0xec,0x4,0x61,0x7,0xf2,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x2,0x4b,0xff,0xf0,0x1,0x5d,0xff,0xff,0xff,0xed,0xff,0xec,0x4,0x52,0x6,0x9b,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x2,0x4b,0xdd,0x6,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0xbf,0x8,0x19,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x2,0x4a,0x0,0x5,0x1,0x4a,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0xad,0x6,0xc3,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x2,0x4a,0xf3,0xf4,0xff,0xff,0x0,0x6a,0xff,0xec,0x4,0x61,0x8,0x44,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x7,0x2,0x49,0xff,0xf7,0x1,0x4b,0xff,0xff,0x0,0x7a,0xff,0xec,0x4,0x52,0x6,0xee,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x6,0x2,0x49,0xe4,0xf5,0xff,0xff,0x0,0x6a,0xfe,0xa0,0x4,0x61,0x7,0x5d,0x6,0x26,0x0,0x10,0x0,0x0,0x0,0x27,0x1,0x5c,0x0,0x8b,0x1,0x70,0x0,0x7,0x1,0x65,0x4,0xdf,0xff,0xf8,0xff,0xff,0x0,0x7a,0xfe,0x9f,0x4,0x52,0x6,0x6,0x6,0x26,0x0,0x2a,0x0,0x0,0x0,0x26,0x1,0x5c,0x78,0x19,0x0,0x7,0x1,0x65,0x4,0xcd,0xff,0xf7,0xff,0xff,0x0,0x63,0xff,0xec,0x4,0xc6,0x7,0x20,0x6,0x26,0x0,0xd8,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x84,0x1,0x57,0xff,0xff,0x0,0x77,0xff,0xec,0x4,0xae,0x5,0xde,0x6,0x26,0x1,0x35,0x0,0x0,0x0,0x6,0x1,0x5b,0x7c,0x15,0xff,0xff,0x0,0x63,0xff,0xec,0x4,0xc6,0x7,0x23,0x6,0x26,0x0,0xd8,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x98,0x1,0x5a,0xff,0xff,0x0,0x77,0xff,0xec,0x4,0xae,0x5,0xe1,0x6,0x26,0x1,0x35,0x0,0x0,0x0,0x6,0x1,0x5a,0x90,0x18,0xff,0xff,0x0,0x63,0xff,0xec,0x4,0xc6,0x7,0xc6,0x6,0x26,0x0,0xd8,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xc7,0x1,0x52,0xff,0xff,0x0,0x77,0xff,0xec,0x4,0xae,0x6,0x84,0x6,0x26,0x1,0x35,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xbf,0x0,0x10,0xff,0xff,0x0,0x63,0xff,0xec,0x4,0xc6,0x7,0x52,0x6,0x26,0x0,0xd8,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x92,0x1,0x61,0xff,0xff,0x0,0x77,0xff,0xec,0x4,0xae,0x6,0x10,0x6,0x26,0x1,0x35,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x8a,0x0,0x1f,0xff,0xff,0x0,0x63,0xfe,0xa8,0x4,0xc6,0x5,0xfa,0x6,0x26,0x0,0xd8,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0xd3,0x0,0x0,0xff,0xff,0x0,0x77,0xfe,0x9f,0x4,0xae,0x4,0xaa,0x6,0x26,0x1,0x35,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0xcb,0xff,0xf7,0xff,0xff,0x0,0x8b,0xfe,0xa8,0x4,0x42,0x5,0xb0,0x6,0x26,0x0,0x16,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0xc8,0x0,0x0,0xff,0xff,0x0,0xb4,0xfe,0xa8,0x4,0x1f,0x4,0x3a,0x6,0x26,0x0,0x30,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0x9e,0x0,0x0,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x42,0x7,0xba,0x6,0x26,0x0,0x16,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xe6,0x1,0x46,0xff,0xff,0x0,0xb4,0xff,0xec,0x4,0x1f,0x6,0x71,0x6,0x26,0x0,0x30,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xb8,0xff,0xfd,0xff,0xff,0x0,0x8b,0xff,0xec,0x5,0x83,0x7,0x20,0x6,0x26,0x0,0xec,0x0,0x0,0x0,0x7,0x1,0x5b,0x0,0x74,0x1,0x57,0xff,0xff,0x0,0xb4,0xff,0xec,0x5,0x3f,0x5,0xc9,0x6,0x26,0x1,0x49,0x0,0x0,0x0,0x6,0x1,0x5b,0x76,0x0,0xff,0xff,0x0,0x8b,0xff,0xec,0x5,0x83,0x7,0x23,0x6,0x26,0x0,0xec,0x0,0x0,0x0,0x7,0x1,0x5a,0xff,0x88,0x1,0x5a,0xff,0xff,0x0,0xb4,0xff,0xec,0x5,0x3f,0x5,0xcc,0x6,0x26,0x1,0x49,0x0,0x0,0x0,0x6,0x1,0x5a,0x8a,0x3,0xff,0xff,0x0,0x8b,0xff,0xec,0x5,0x83,0x7,0xc6,0x6,0x26,0x0,0xec,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xb7,0x1,0x52,0xff,0xff,0x0,0xb4,0xff,0xec,0x5,0x3f,0x6,0x70,0x6,0x26,0x1,0x49,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xb9,0xff,0xfc,0xff,0xff,0x0,0x8b,0xff,0xec,0x5,0x83,0x7,0x52,0x6,0x26,0x0,0xec,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x82,0x1,0x61,0xff,0xff,0x0,0xb4,0xff,0xec,0x5,0x3f,0x5,0xfb,0x6,0x26,0x1,0x49,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x84,0x0,0xa,0xff,0xff,0x0,0x8b,0xfe,0xa0,0x5,0x83,0x5,0xe8,0x6,0x26,0x0,0xec,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0xcd,0xff,0xf8,0xff,0xff,0x0,0xb4,0xfe,0xa8,0x5,0x3f,0x4,0x93,0x6,0x26,0x1,0x49,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0x90,0x0,0x0,0xff,0xff,0x0,0x3d,0xfe,0xb2,0x4,0x79,0x5,0xb0,0x6,0x26,0x0,0x1a,0x0,0x0,0x0,0x7,0x1,0x65,0x4,0xc3,0x0,0xa,0xff,0xff,0x0,0x44,0xfe,0xb,0x4,0x85,0x4,0x3a,0x6,0x26,0x0,0x34,0x0,0x0,0x0,0x7,0x1,0x65,0x5,0xa7,0xff,0x63,0xff,0xff,0x0,0x3d,0x0,0x0,0x4,0x79,0x7,0xc5,0x6,0x26,0x0,0x1a,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xb4,0x1,0x51,0xff,0xff,0x0,0x44,0xfe,0x4b,0x4,0x85,0x6,0x71,0x6,0x26,0x0,0x34,0x0,0x0,0x0,0x7,0x1,0x76,0x4,0xcc,0xff,0xfd,0xff,0xff,0x0,0x3d,0x0,0x0,0x4,0x79,0x7,0x51,0x6,0x26,0x0,0x1a,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x7f,0x1,0x60,0xff,0xff,0x0,0x44,0xfe,0x4b,0x4,0x85,0x5,0xfc,0x6,0x26,0x0,0x34,0x0,0x0,0x0,0x7,0x1,0x5d,0x0,0x97,0x0,0xb,0xff,0xff,0x0,0x7c,0xfe,0xed,0x4,0xe1,0x6,0x0,0x4,0x26,0x0,0x1f,0xf1,0x0,0x0,0x27,0x2,0x6a,0x1,0x2f,0x2,0x47,0x0,0x6,0x0,0x66,0x21,0x84,0xff,0xff,0x0,0xa9,0xfe,0xa0,0x4,0xdf,0x5,0xb0,0x6,0x26,0x2,0x71,0x0,0x0,0x0,0x7,0x2,0x6e,0x2,0x20,0x0,0x7,0xff,0xff,0x0,0xa4,0xfe,0x99,0x4,0xba,0x4,0x3a,0x6,0x26,0x1,0xba,0x0,0x0,0x0,0x7,0x2,0x6e,0x1,0xfb,0x0,0x0,0xff,0xff,0x0,0x8d,0xfe,0x99,0x4,0xa8,0x5,0xb0,0x6,0x26,0x0,0x9,0x0,0x0,0x0,0x7,0x2,0x6e,0x1,0xe9,0x0,0x0,0xff,0xff,0x0,0xa5,0xfe,0x99,0x4,0xb0,0x4,0x3a,0x6,0x26,0x1,0xbd,0x0,0x0,0x0,0x7,0x2,0x6e,0x1,0xf1,0x0,0x0,0xff,0xff,0x0,0x4c,0xfe,0x99,0x4,0x84,0x5,0xb0,0x6,0x26,0x0,0x15,0x0,0x0,0x0,0x7,0x2,0x6e,0x0,0x8c,0x0,0x0,0xff,0xff,0x0,0x68,0xfe,0x99,0x4,0x7b,0x4,0x3a,0x6,0x26,0x1,0xbf,0x0,0x0,0x0,0x7,0x2,0x6e,0x0,0x95,0x0,0x0,0xff,0xff,0x0,0x57,0xfe,0x99,0x4,0xe7,0x5,0xb0,0x6,0x26,0x0,0x19,0x0,0x0,0x0,0x7,0x2,0x6e,0x2,0x28,0x0,0x0,0xff,0xff,0x0,0x6e,0xfe,0x99,0x4,0x76,0x4,0x3a,0x6,0x26,0x0,0x33,0x0,0x0,0x0,0x7,0x2,0x6e,0x1,0xb7,0x0,0x0,0xff,0xff,0x0,0xab,0xfe,0x99,0x4,0xb0,0x5,0xb0,0x6,0x26,0x1,0xaa,0x0,0x0,0x0,0x7,0x2,0x6e,0x1,0xf1,0x0,0x0,0xff,0xff,0x0,0x8d,0xfe,0x99,0x4,0xb0,0x4,0x3a,0x6,0x26,0x1,0xc2,0x0,0x0,0x0,0x7,0x2,0x6e,0x1,0xf1,0x0,0x0,0xff,0xff,0x0,0xab,0xfe,0x99,0x4,0x27,0x5,0xb0,0x6,0x26,0x1,0xaa,0x0,0x0,0x0,0x7,0x2,0x6e,0x0,0xde,0x0,0x0,0xff,0xff,0x0,0x8d,0xfe,0x99,0x4,0x27,0x4,0x3a,0x6,0x26,0x1,0xc2,0x0,0x0,0x0,0x7,0x2,0x6e,0x0,0xdd,0x0,0x0,0xff,0xff,0x0,0xb5,0xfe,0x99,0x4,0x30,0x5,0xb0,0x6,0x26,0x1,0x7b,0x0,0x0,0x0,0x7,0x2,0x6e,0xff,0x3a,0x0,0x0,0xff,0xff,0x0,0xb7,0xfe,0x99,0x4,0x2a,0x4,0x3a,0x6,0x26,0x1,0xb5,0x0,0x0,0x0,0x7,0x2,0x6e,0xff,0xb,0x0,0x0,0xff,0xff,0x0,0x1d,0xfe,0x99,0x4,0xfb,0x5,0xb0,0x6,0x26,0x1,0xa4,0x0,0x0,0x0,0x7,0x2,0x6e,0x2,0x3c,0x0,0x0,0xff,0xff,0x0,0x11,0xfe,0x99,0x4,0xef,0x4,0x3a,0x6,0x26,0x1,0xb7,0x0,0x0,0x0,0x7,0x2,0x6e,0x2,0x30,0x0,0x0,0xff,0xff,0x0,0x26,0xfe,0x3b,0x4,0x89,0x5,0xc3,0x6,0x26,0x2,0xa,0x0,0x0,0x0,0x7,0x2,0x6e,0x0,0xbf,0xff,0xa2,0xff,0xff,0x0,0x26,0xfe,0x3b,0x4,0x85,0x4,0x4e,0x6,0x26,0x2,0xb,0x0,0x0,0x0,0x7,0x2,0x6e,0x0,0x9b,0xff,0xa2,0xff,0xff,0x0,0xae,0x0,0x0,0x4,0x2c,0x6,0x0,0x6,0x6,0x0,0x23,0x0,0x0,0x0,0x2,0x0,0x12,0x0,0x0,0x4,0x40,0x4,0x3a,0x0,0x18,0x0,0x27,0x0,0x0,0x41,0x35,0x21,0x35,0x23,0x15,0x23,0x15,0x33,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x21,0x35,0x11,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x21,0x2,0x8f,0xfe,0xcf,0xb9,0x93,0x93,0x2,0x4,0x61,0x98,0x34,0x34,0x36,0x37,0x34,0x34,0x97,0x61,0xfe,0xb5,0x1,0x4b,0x3a,0x53,0x1b,0x1b,0x1a,0x19,0x1b,0x1b,0x54,0x3a,0xfe,0xb5,0x3,0x23,0x97,0x80,0x80,0x97,0xfc,0xdd,0x34,0x2e,0x2d,0x7d,0x48,0x49,0x7a,0x2c,0x2c,0x31,0x83,0xfe,0xe6,0x21,0x1a,0x1b,0x43,0x23,0x24,0x42,0x19,0x19,0x1e,0x0,0x2,0xff,0xd4,0x0,0x0,0x4,0x51,0x5,0xb0,0x0,0x18,0x0,0x27,0x0,0x0,0x41,0x35,0x23,0x35,0x23,0x15,0x23,0x15,0x33,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x21,0x35,0x11,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x21,0x2,0x51,0xf0,0xb9,0xd4,0xd4,0x1,0xc3,0x74,0xb5,0x3e,0x3e,0x41,0x41,0x3e,0x3e,0xb5,0x74,0xfe,0xf6,0x1,0xa,0x4e,0x71,0x25,0x25,0x23,0x23,0x25,0x25,0x71,0x4e,0xfe,0xf6,0x4,0x50,0x97,0xc9,0xc9,0x97,0xfb,0xb0,0x3f,0x39,0x39,0xa0,0x60,0x61,0x9c,0x38,0x37,0x3c,0xf7,0xfe,0x72,0x2b,0x24,0x25,0x63,0x38,0x39,0x67,0x27,0x27,0x2e,0x0,0x0,0x2,0xff,0xd4,0x0,0x0,0x4,0x51,0x5,0xb0,0x0,0x18,0x0,0x27,0x0,0x0,0x41,0x35,0x23,0x35,0x23,0x15,0x23,0x15,0x33,0x11,0x21,0x32,0x36,0x37,0x36,0x36,0x35,0x34,0x26,0x27,0x26,0x26,0x23,0x21,0x35,0x11,0x21,0x32,0x16,0x17,0x16,0x16,0x15,0x14,0x6,0x7,0x6,0x6,0x23,0x21,0x2,0x51,0xf0,0xb9,0xd4,0xd4,0x1,0xc3,0x74,0xb5,0x3e,0x3e,0x41,0x41,0x3e,0x3e,0xb5,0x74,0xfe,0xf6,0x1,0xa,0x4e,0x71,0x25,0x25,0x23,0x23,0x25,0x25,0x71,0x4e,0xfe,0xf6,0x4,0x50,0x97,0xc9,0xc9,0x97,0xfb,0xb0,0x3f,0x39,0x39,0xa0,0x60,0x61,0x9c,0x38,0x37,0x3c,0xf7,0xfe,0x72,0x2b,0x24,0x25,0x63,0x38,0x39,0x67,0x27,0x27,0x2e,0x0,0x0,0x1,0xff,0xfd,0x0,0x0,0x4,0x30,0x5,0xb0,0x0,0xd,0x0,0x0,0x41,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x23,0x15,0x33,0x11,0x33,0x11,0x2,0x7a,0xfe,0xf5,0x2,0xc1,0xfc,0x85,0xb8,0xb8,0xba,0x2,0xac,0x97,0x1,0xd5,0x98,0xfd,0x93,0x97,0xfd,0x54,0x2,0xac,0x0,0x1,0xff,0xfb,0x0,0x0,0x4,0x2a,0x4,0x3a,0x0,0xd,0x0,0x0,0x41,0x35,0x21,0x11,0x21,0x35,0x21,0x11,0x23,0x15,0x33,0x11,0x33,0x11,0x2,0x78,0xfe,0xf9,0x2,0xb9,0xfc,0x8d,0xbc,0xbc,0xba,0x1,0xdf,0x97,0x1,0x2b,0x99,0xfe,0x3c,0x97,0xfe,0x21,0x1,0xdf,0x0,0x1,0xff,0xff,0x0,0x0,0x4,0xc0,0x5,0xb0,0x0,0x14,0x0,0x0,0x41,0x1,0x33,0x1,0x1,0x23,0x1,0x23,0x11,0x21,0x35,0x21,0x35,0x23,0x15,0x23,0x15,0x33,0x11,0x33,0x11,0x2,0x17,0x1,0xc6,0xe3,0xfd,0xe8,0x1,0xef,0xd4,0xfe,0x45,0x9c,0x1,0x10,0xfe,0xf0,0xb9,0xb4,0xb4,0xb9,0x2,0x93,0xfd,0x6d,0x2,0xef,0x2,0xc1,0xfd,0x7a,0x1,0x3f,0x97,0xb0,0xb0,0x97,0xfb,0x97,0x2,0x93,0x0,0x1,0xff,0xe9,0x0,0x0,0x4,0x74,0x6,0x0,0x0,0x14,0x0,0x0,0x73,0x33,0x11,0x37,0x1,0x33,0x1,0x1,0x23,0x1,0x7,0x11,0x33,0x35,0x23,0x35,0x23,0x15,0x23,0x15,0x33,0xba,0xba,0x88,0x1,0x8d,0xeb,0xfe,0x7,0x1,0xb6,0xe1,0xfe,0x9d,0x79,0xf2,0xf2,0xba,0xd1,0xd1,0x1,0x76,0x83,0xfe,0x7,0x2,0x77,0x1,0xc3,0xfe,0x9c,0x82,0x2,0x6d,0x97,0xa8,0xa8,0x97,0xff,0xff,0x0,0xa2,0xfe,0x8a,0x4,0xe3,0x7,0x3e,0x6,0x26,0x1,0xa6,0x0,0x0,0x0,0x27,0x1,0x5f,0xff,0xf9,0x1,0x8c,0x0,0x7,0x0,0x5f,0x2,0x60,0xff,0xda,0xff,0xff,0x0,0xa5,0xfe,0x8a,0x4,0xe0,0x5,0xf3,0x6,0x26,0x1,0xb9,0x0,0x0,0x0,0x26,0x1,0x5f,0xf4,0x41,0x0,0x7,0x0,0x5f,0x2,0x5d,0xff,0xda,0xff,0xff,0x0,0x8d,0xfe,0x8a,0x4,0xd8,0x5,0xb0,0x6,0x26,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x5f,0x2,0x55,0xff,0xda,0xff,0xff,0x0,0xa5,0xfe,0x8a,0x4,0xe0,0x4,0x3a,0x6,0x26,0x1,0xbd,0x0,0x0,0x0,0x7,0x0,0x5f,0x2,0x5d,0xff,0xda,0xff,0xff,0x0,0x94,0xfe,0x8a,0x5,0x2,0x5,0xb0,0x6,0x26,0x0,0xe,0x0,0x0,0x0,0x7,0x0,0x5f,0x2,0x7f,0xff,0xda,0xff,0xff,0x0,0x89,0xfe,0x8a,0x4,0xe4,0x4,0x3a,0x6,0x26,0x1,0xbc,0x0,0x0,0x0,0x7,0x0,0x5f,0x2,0x61,0xff,0xda,0xff,0xff,0x0,0x2f,0xfe,0x8a,0x4,0xe4,0x5,0xb0,0x6,0x26,0x1,0xa7,0x0,0x0,0x0,0x7,0x0,0x5f,0x2,0x61,0xff,0xda,0xff,0xff,0x0,0x37,0xfe,0x8a,0x4,0xdf,0x4,0x3a,0x6,0x26,0x1,0xbb,0x0,0x0,0x0,0x7,0x0,0x5f,0x2,0x5c,0xff,0xda,0x0,0x1,0x0,0x3d,0x0,0x0,0x4,0x79,0x5,0xb0,0x0,0x11,0x0,0x0,0x41,0x35,0x23,0x1,0x23,0x1,0x23,0x1,0x23,0x1,0x23,0x15,0x33,0x17,0x13,0x33,0x13,0x37,0x3,0x9b,0xa3,0x1,0x81,0xd2,0xfe,0xb5,0x2,0xfe,0xb6,0xd3,0x1,0x80,0x9f,0xe2,0x2,0x3,0xac,0x3,0x2,0x2,0x12,0x97,0x3,0x7,0xfd,0x25,0x2,0xdb,0xfc,0xf9,0x97,0x3,0xfd,0xf1,0x2,0x10,0x2,0x0,0x0,0x1,0x0,0x47,0xfe,0x60,0x4,0x96,0x4,0x3a,0x0,0x11,0x0,0x0,0x45,0x35,0x23,0x1,0x23,0x1,0x7,0x23,0x27,0x1,0x23,0x1,0x23,0x15,0x33,0x11,0x33,0x11,0x3,0xb1,0xbc,0x1,0xa1,0xbe,0xfe,0xb3,0x1a,0x1,0x17,0xfe,0xac,0xbe,0x1,0xa4,0xb7,0xde,0xba,0xb,0x97,0x3,0xae,0xfc,0xf0,0x62,0x62,0x3,0x10,0xfc,0x52,0x97,0xfe,0x6b,0x1,0x95,0x0,0x1,0x0,0x57,0x0,0x0,0x4,0x8f,0x5,0xb0,0x0,0x11,0x0,0x0,0x41,0x35,0x23,0x1,0x23,0x1,0x1,0x23,0x1,0x23,0x15,0x33,0x1,0x33,0x1,0x1,0x33,0x1,0x3,0xae,0x9d,0x1,0x74,0xda,0xfe,0xc6,0xfe,0xca,0xd9,0x1,0x74,0xa5,0xb2,0xfe,0x74,0xdb,0x1,0x43,0x1,0x42,0xd8,0xfe,0x75,0x2,0x9e,0x97,0x2,0x7b,0xfd,0xc5,0x2,0x3b,0xfd,0x85,0x97,0xfd,0x62,0x2,0x46,0xfd,0xba,0x2,0x9e,0x0,0x0,0x1,0x0,0x6e,0x0,0x0,0x4,0x72,0x4,0x3a,0x0,0x11,0x0,0x0,0x41,0x35,0x23,0x1,0x23,0x1,0x1,0x23,0x1,0x23,0x15,0x33,0x1,0x33,0x1,0x1,0x33,0x1,0x3,0xa2,0x8e,0x1,0x53,0xd9,0xfe,0xdf,0xfe,0xe2,0xd6,0x1,0x53,0xa7,0xb5,0xfe,0x94,0xd8,0x1,0x2b,0x1,0x2b,0xd6,0xfe,0x94,0x1,0xe1,0x97,0x1,0xc2,0xfe,0x6f,0x1,0x91,0xfe,0x3e,0x97,0xfe,0x1f,0x1,0x9c,0xfe,0x64,0x1,0xe1,0x0,0xff,0xff,0x0,0x8b,0xff,0xec,0x4,0x60,0x4,0x4d,0x6,0x6,0x1,0x89,0x0,0x0,0x0,0x1,0x0,0x4f,0x2,0x8b,0x4,0x8c,0x3,0x22,0x0,0x3,0x0,0x0,0x41,0x35,0x21,0x15,0x4,0x8c,0xfb,0xc3,0x2,0x8b,0x97,0x97
-};
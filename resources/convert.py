@@ -1,41 +1,108 @@
 import sys
 from pathlib import Path
 
-from PIL import Image
+# Pieces are drawn at most one third of a 720 pixel board
+PIECE_SIZE = 378
+
+# Characters the game draws, everything else is dropped from the font
+FONT_TEXT = "".join(chr(c) for c in range(0x20, 0x7f))
+
+
+def write_h(data: bytes, target_name: str, h_file: Path):
+    """Writes bytes as a C array, 16 per line"""
+    with open(h_file, "w") as fout:
+        print(f"static const unsigned char {target_name}[] = {{", file=fout)
+        for i in range(0, len(data), 16):
+            print(",".join(hex(b) for b in data[i:i + 16]) + ",", file=fout)
+        print("};", file=fout)
+    print(f"Successfully wrote {len(data)} bytes to {h_file}")
+
+
+def qoi_encode(width: int, height: int, rgba: bytes) -> bytes:
+    """Encodes RGBA pixels as QOI, see https://qoiformat.org"""
+    out = bytearray(b"qoif")
+    out += width.to_bytes(4, "big") + height.to_bytes(4, "big")
+    out += bytes([4, 0])
+    index = [(0, 0, 0, 0)] * 64
+    prev = (0, 0, 0, 255)
+    run = 0
+    total = width * height
+    for i in range(total):
+        px = tuple(rgba[i * 4:i * 4 + 4])
+        if px == prev:
+            run += 1
+            if run == 62 or i == total - 1:
+                out.append(0xc0 | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(0xc0 | (run - 1))
+            run = 0
+        slot = (px[0] * 3 + px[1] * 5 + px[2] * 7 + px[3] * 11) % 64
+        if index[slot] == px:
+            out.append(slot)
+        else:
+            index[slot] = px
+            if px[3] == prev[3]:
+                dr = (px[0] - prev[0] + 128) % 256 - 128
+                dg = (px[1] - prev[1] + 128) % 256 - 128
+                db = (px[2] - prev[2] + 128) % 256 - 128
+                dr_dg = dr - dg
+                db_dg = db - dg
+                if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                    out.append(0x40 | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2))
+                elif -32 <= dg <= 31 and -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                    out.append(0x80 | (dg + 32))
+                    out.append((dr_dg + 8) << 4 | (db_dg + 8))
+                else:
+                    out += bytes([0xfe, px[0], px[1], px[2]])
+            else:
+                out += bytes([0xff, px[0], px[1], px[2], px[3]])
+        prev = px
+    out += bytes([0, 0, 0, 0, 0, 0, 0, 1])
+    return bytes(out)
+
 
 def convert_png_to_h(png_file: Path):
-    """Converts a png image to include"""
+    """Converts a png image to a QOI include, scaled to PIECE_SIZE"""
+    from PIL import Image
+
     try:
-        img = Image.open(png_file)
-        bmp_file = png_file.with_suffix(".bmp")
-        img.save(bmp_file, "BMP")
-        print(f"Successfully converted {png_file} to {bmp_file}")
-
-        target_name = str(bmp_file.name).replace('.', '_').replace('-', '_')
-        h_file = png_file.with_name(target_name).with_suffix(".h")
-        with open(h_file, "w") as fout:
-            print(f"static const unsigned char {target_name}[] = {{", file=fout)
-            print(f"{','.join(hex(b) for b in open(bmp_file, 'rb').read())}", file=fout)
-            print("};", file=fout)
-            print(f"Successfully converted {png_file} to {h_file}")
-        bmp_file.unlink()
+        img = Image.open(png_file).convert("RGBA")
+        if img.size != (PIECE_SIZE, PIECE_SIZE):
+            img = img.resize((PIECE_SIZE, PIECE_SIZE), Image.LANCZOS)
+        data = qoi_encode(img.width, img.height, img.tobytes())
+
+        target_name = png_file.stem.replace('-', '_') + "_qoi"
+        write_h(data, target_name, png_file.with_name(target_name + ".h"))
     except Exception as exc:
         print(f"Error converting image: {exc}")
 
+
 def convert_ttf_to_h(ttf_file: Path):
-    """Converts a ttf image to include"""
+    """Converts a ttf font to include, subset to FONT_TEXT"""
+    from fontTools import subset
+
     try:
-        target_name = str(ttf_file.name).replace('.', '_').replace('-', '_')
-        h_file = ttf_file.with_name(target_name).with_suffix(".h")
-        with open(h_file, "w") as fout:
-            print(f"static const unsigned char {target_name}[] = {{", file=fout)
-            print(f"{','.join(hex(b) for b in open(ttf_file, 'rb').read())}", file=fout)
-            print("};", file=fout)
-            print(f"Successfully converted {ttf_file} to {h_file}")
-        #bmp_file.unlink()
+        options = subset.Options()
+        options.layout_features = []
+        options.name_IDs = []
+        options.hinting = False
+        options.notdef_outline = True
+        font = subset.load_font(str(ttf_file), options)
+        subsetter = subset.Subsetter(options)
+        subsetter.populate(text=FONT_TEXT)
+        subsetter.subset(font)
+        subset_file = ttf_file.with_name(ttf_file.stem + "-Subset.ttf")
+        subset.save_font(font, str(subset_file), options)
 
+        target_name = ttf_file.stem.replace('-', '_') + "_subset_ttf"
+        write_h(subset_file.read_bytes(), target_name,
+                ttf_file.with_name(target_name + ".h"))
+        subset_file.unlink()
     except Exception as exc:
-        print(f"Error converting image: {exc}")
+        print(f"Error converting font: {exc}")
+
 
 def main(file_path: Path):
     """!main"""
@@ -47,5 +114,6 @@ def main(file_path: Path):
         return 0
     return 1
 
+
 if __name__ == "__main__":
     main(Path(sys.argv[1]))
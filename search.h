@@ -0,0 +1,582 @@
+#ifndef SEARCH_H
+#define SEARCH_H
+
+#include "kboard.h"
+#include "ttable.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace ttt {
+
+const int WIN_SCORE = 1000000;
+const int MAX_SEARCH_PLY = 128;
+// Move lists are reserved for this many plies at a time.
+const int PLY_RESERVE = 16;
+
+// Scores beyond this are forced wins, WIN_SCORE - ply to the win.
+inline bool isWinScore(int score) {
+  return score > WIN_SCORE - MAX_SEARCH_PLY ||
+         score < -WIN_SCORE + MAX_SEARCH_PLY;
+}
+
+struct SearchLimits {
+  int maxDepth;       // plies, 0 searches to the end of the game
+  double maxSeconds;  // 0 is no time limit
+  uint64_t maxNodes;  // 0 is no node limit
+};
+
+struct SearchResult {
+  int move;
+  int score;
+  int depth;  // deepest completed iteration
+  uint64_t nodes;
+  double seconds;
+
+  double nodesPerSecond() const {
+    return seconds > 0 ? double(nodes) / seconds : 0.0;
+  }
+};
+
+// Iterative deepening negamax with alpha-beta over a KBoard. Moves are
+// ordered by transposition table move, immediate wins and blocks, line
+// potential and a history heuristic. On boards larger than 64 cells only
+// cells next to a stone are considered.
+//
+// Several searches can share one table and stop flag as helpers of a lazy
+// SMP search (see ParallelSearch); helpers start at alternating depths and
+// perturb their move order so they explore different subtrees.
+class Search {
+ public:
+  struct ScoredMove {
+    int move;
+    int order;
+  };
+
+ private:
+  typedef std::chrono::steady_clock Clock;
+
+  // One node of the negamax stack, the moves are d_plyMoves[ply].
+  struct Frame {
+    int depth;
+    int alpha;
+    int beta;
+    int alphaOrig;
+    Side side;
+    uint64_t hash;
+    int best;
+    int bestMove;
+    size_t next;  // next move to search
+    int move;     // on the board while its subtree is searched, else -1
+  };
+
+  TranspositionTable *d_tt;
+  Zobrist d_zobrist;
+  KBoard d_board;
+  std::vector<int> d_history;
+  std::vector<std::vector<ScoredMove> > d_plyMoves;
+  std::vector<Frame> d_frames;
+  int d_ply;  // top of d_frames, -1 between iterations
+  std::vector<uint32_t> d_mark;
+  uint32_t d_stamp;
+
+  SearchLimits d_limits;
+  Clock::time_point d_start;
+  uint64_t d_nodes;
+  bool d_stop;
+  int d_rootBest;
+  bool d_pause;
+  bool d_sliced;
+  Clock::time_point d_sliceEnd;
+  Side d_toMove;
+  uint64_t d_rootHash;
+  int d_depth;  // of the iteration under way
+  int d_maxDepth;
+  SearchResult d_result;
+  bool d_done;
+  std::atomic<bool> *d_sharedStop;
+  std::atomic<bool> *d_abort;
+  int d_helper;
+
+  static int runScore(int length, int open, int k) {
+    if (open == 0) {
+      return 0;
+    }
+    if (length >= k) {
+      length = k - 1;
+    }
+    int score = 1;
+    for (int i = 0; i < length; i++) {
+      score *= 8;
+    }
+    if (length == k - 1 && open == 2) {
+      score *= 4;  // cannot be blocked on both ends
+    }
+    return score * open;
+  }
+
+  // Sum of open runs of s, each counted once from its first stone.
+  int linePotential(Side s) const {
+    const int cols = d_board.cols();
+    const int rows = d_board.rows();
+    const int k = d_board.rules().k;
+    static const int DC[KBoard::NUM_DIRECTIONS] = {1, 0, 1, 1};
+    static const int DR[KBoard::NUM_DIRECTIONS] = {0, 1, 1, -1};
+    int total = 0;
+    for (int w = 0; w < d_board.words(); w++) {
+      for (uint64_t m = d_board.bits(s, w); m; m &= m - 1) {
+        const int idx = w * 64 + lowestBit64(m);
+        const int col = d_board.col(idx);
+        const int row = d_board.row(idx);
+        for (int dir = 0; dir < KBoard::NUM_DIRECTIONS; dir++) {
+          int c = col - DC[dir];
+          int r = row - DR[dir];
+          const bool inside = c >= 0 && r >= 0 && c < cols && r < rows;
+          if (inside && d_board.has(d_board.index(c, r), s)) {
+            continue;  // not the start of the run
+          }
+          int open = inside && d_board.isEmpty(d_board.index(c, r)) ? 1 : 0;
+          int length = 0;
+          c = col;
+          r = row;
+          while (c >= 0 && r >= 0 && c < cols && r < rows &&
+                 d_board.has(d_board.index(c, r), s) && length < k) {
+            length++;
+            c += DC[dir];
+            r += DR[dir];
+          }
+          if (c >= 0 && r >= 0 && c < cols && r < rows &&
+              d_board.isEmpty(d_board.index(c, r))) {
+            open++;
+          }
+          total += runScore(length, open, k);
+        }
+      }
+    }
+    return total;
+  }
+
+  int evaluate(Side s) const {
+    int score = linePotential(s) - linePotential(otherSide(s));
+    const int cap = WIN_SCORE / 4;
+    return score > cap ? cap : (score < -cap ? -cap : score);
+  }
+
+  int orderScore(int idx, Side s, int ttMove) const {
+    if (idx == ttMove) {
+      return 1 << 30;
+    }
+    int own = 0;
+    int their = 0;
+    for (int dir = 0; dir < KBoard::NUM_DIRECTIONS; dir++) {
+      const int o = d_board.runThrough(idx, s, dir).length;
+      const int t = d_board.runThrough(idx, otherSide(s), dir).length;
+      own = o > own ? o : own;
+      their = t > their ? t : their;
+    }
+    const int k = d_board.rules().k;
+    if (own >= k) {
+      return 1 << 29;
+    }
+    if (their >= k) {
+      return 1 << 28;
+    }
+    int noise = 0;
+    if (d_helper > 0) {
+      noise = int(((uint32_t(idx) + 1) * 2654435761u * uint32_t(d_helper)) >>
+                  23);
+    }
+    return (own * own + their * their) * 1024 + d_history[idx] + noise;
+  }
+
+  // Move lists for plies [0, plies) with room for every cell, grown
+  // PLY_RESERVE plies at a time when an iteration goes deeper than any
+  // before on this board: a search no deeper than earlier ones allocates
+  // nothing, and a 100x100 board does not pay for MAX_SEARCH_PLY lists.
+  void reservePlies(int plies) {
+    plies = std::min((plies + PLY_RESERVE - 1) / PLY_RESERVE * PLY_RESERVE,
+                     d_maxDepth + 1);
+    while (int(d_plyMoves.size()) < plies) {
+      d_plyMoves.emplace_back();
+      d_plyMoves.back().reserve(size_t(d_board.cells()));
+    }
+  }
+
+  void allEmptyMoves(Side s, int ttMove, std::vector<ScoredMove> *moves) {
+    for (int w = 0; w < d_board.words(); w++) {
+      for (uint64_t e = d_board.emptyWord(w); e; e &= e - 1) {
+        const int idx = w * 64 + lowestBit64(e);
+        moves->push_back({idx, orderScore(idx, s, ttMove)});
+      }
+    }
+  }
+
+  void generateMoves(Side s, int ttMove, std::vector<ScoredMove> *moves) {
+    moves->clear();
+    if (d_board.cells() <= 64) {
+      allEmptyMoves(s, ttMove, moves);
+    } else if (d_board.count() == 0) {
+      // empty large board, only the center is worth searching
+      moves->push_back({d_board.center(), 0});
+    } else {
+      // empty cells next to any stone, marked with a per-call stamp
+      d_stamp++;
+      const int cols = d_board.cols();
+      const int rows = d_board.rows();
+      for (int w = 0; w < d_board.words(); w++) {
+        uint64_t m = d_board.bits(SIDE_X, w) | d_board.bits(SIDE_O, w);
+        for (; m; m &= m - 1) {
+          const int idx = w * 64 + lowestBit64(m);
+          const int col = d_board.col(idx);
+          const int row = d_board.row(idx);
+          for (int dr = -1; dr <= 1; dr++) {
+            for (int dc = -1; dc <= 1; dc++) {
+              const int c = col + dc;
+              const int r = row + dr;
+              if (c < 0 || r < 0 || c >= cols || r >= rows) {
+                continue;
+              }
+              const int n = d_board.index(c, r);
+              if (d_mark[n] != d_stamp && d_board.isEmpty(n)) {
+                d_mark[n] = d_stamp;
+                moves->push_back({n, orderScore(n, s, ttMove)});
+              }
+            }
+          }
+        }
+      }
+      if (moves->empty()) {
+        // every stone is boxed in, the rest of the board is still open
+        allEmptyMoves(s, ttMove, moves);
+      }
+    }
+    // insertion sort, the lists are short and often nearly sorted
+    for (size_t i = 1; i < moves->size(); i++) {
+      const ScoredMove m = (*moves)[i];
+      size_t j = i;
+      while (j > 0 && (*moves)[j - 1].order < m.order) {
+        (*moves)[j] = (*moves)[j - 1];
+        j--;
+      }
+      (*moves)[j] = m;
+    }
+  }
+
+  void checkLimits() {
+    if (d_sharedStop && d_sharedStop->load(std::memory_order_relaxed)) {
+      d_stop = true;
+    }
+    if (d_abort && d_abort->load(std::memory_order_relaxed)) {
+      d_stop = true;
+    }
+    if (d_limits.maxNodes && d_nodes >= d_limits.maxNodes) {
+      d_stop = true;
+    }
+    if (d_limits.maxSeconds > 0 && (d_nodes & 1023) == 0 &&
+        elapsed() >= d_limits.maxSeconds) {
+      d_stop = true;
+    }
+    if (d_sliced && (d_nodes & 255) == 0 && Clock::now() >= d_sliceEnd) {
+      d_pause = true;
+    }
+  }
+
+  double elapsed() const {
+    return std::chrono::duration<double>(Clock::now() - d_start).count();
+  }
+
+  // Enters a node: true when its moves are to be searched, which pushes
+  // its frame, otherwise *score is its value.
+  bool enter(int ply, int depth, int alpha, int beta, Side s, uint64_t hash,
+             int *score) {
+    d_nodes++;
+    checkLimits();
+    *score = 0;
+    if (d_stop) {
+      return false;
+    }
+    if (d_board.isFull()) {
+      return false;
+    }
+    if (depth == 0) {
+      *score = evaluate(s);
+      return false;
+    }
+
+    int ttMove = -1;
+    TTData tt;
+    if (ply == 0) {
+      ttMove = d_rootBest;
+    } else if (d_tt->probe(hash, &tt)) {
+      ttMove = tt.move;
+      if (tt.depth >= depth) {
+        // win scores are stored relative to the node
+        int value = tt.score;
+        if (isWinScore(value)) {
+          value += value > 0 ? -ply : ply;
+        }
+        if (tt.bound == BOUND_EXACT ||
+            (tt.bound == BOUND_LOWER && value >= beta) ||
+            (tt.bound == BOUND_UPPER && value <= alpha)) {
+          *score = value;
+          return false;
+        }
+      }
+    }
+
+    std::vector<ScoredMove> &moves = d_plyMoves[ply];
+    generateMoves(s, ttMove, &moves);
+
+    Frame &f = d_frames[ply];
+    f.depth = depth;
+    f.alpha = alpha;
+    f.beta = beta;
+    f.alphaOrig = alpha;
+    f.side = s;
+    f.hash = hash;
+    f.best = -WIN_SCORE - 1;
+    f.bestMove = moves.front().move;
+    f.next = 0;
+    f.move = -1;
+    d_ply = ply;
+    return true;
+  }
+
+  // Takes back the move of the top frame and scores it.
+  void childDone(int score) {
+    Frame &f = d_frames[d_ply];
+    const int m = f.move;
+    d_board.undo(m, f.side);
+    f.move = -1;
+    if (score > f.best) {
+      f.best = score;
+      f.bestMove = m;
+      if (d_ply == 0) {
+        d_rootBest = m;
+      }
+    }
+    if (f.best > f.alpha) {
+      f.alpha = f.best;
+    }
+    if (f.alpha >= f.beta) {
+      d_history[m] += f.depth * f.depth;
+      f.next = d_plyMoves[d_ply].size();
+    }
+  }
+
+  // Stores the top frame, whose moves are all searched, and pops it.
+  int leave() {
+    const Frame &f = d_frames[d_ply];
+    TTData entry;
+    entry.move = f.bestMove;
+    entry.score = f.best;
+    if (isWinScore(f.best)) {
+      entry.score += f.best > 0 ? d_ply : -d_ply;
+    }
+    entry.depth = f.depth;
+    entry.bound = f.best <= f.alphaOrig
+                      ? BOUND_UPPER
+                      : (f.best >= f.beta ? BOUND_LOWER : BOUND_EXACT);
+    d_tt->store(f.hash, entry);
+    d_ply--;
+    return f.best;
+  }
+
+  // Takes back every move on the stack once the search has stopped.
+  void unwind() {
+    for (; d_ply >= 0; d_ply--) {
+      const Frame &f = d_frames[d_ply];
+      if (f.move >= 0) {
+        d_board.undo(f.move, f.side);
+      }
+    }
+  }
+
+  // Negamax with alpha-beta over the frames on the stack, from where the
+  // last call paused. True when the root frame is done or the search
+  // stopped, with the root score in *score; false when the slice is over.
+  bool advance(int *score) {
+    for (;;) {
+      Frame &f = d_frames[d_ply];
+      const std::vector<ScoredMove> &moves = d_plyMoves[d_ply];
+      int value;
+      if (f.next < moves.size()) {
+        if (d_pause) {
+          return false;  // between moves, where the stack is complete
+        }
+        const int m = moves[f.next++].move;
+        d_board.play(m, f.side);
+        f.move = m;
+        if (d_board.lineThrough(m, f.side, 0)) {
+          value = WIN_SCORE - (d_ply + 1);
+        } else {
+          int child;
+          if (enter(d_ply + 1, f.depth - 1, -f.beta, -f.alpha,
+                    otherSide(f.side),
+                    f.hash ^ d_zobrist.key(m, f.side) ^ d_zobrist.sideKey(),
+                    &child)) {
+            continue;
+          }
+          value = -child;
+        }
+      } else {
+        const int best = leave();
+        if (d_ply < 0) {
+          *score = best;
+          return true;
+        }
+        value = -best;
+      }
+      if (d_stop) {
+        unwind();
+        *score = 0;
+        return true;
+      }
+      childDone(value);
+    }
+  }
+
+ public:
+  explicit Search(TranspositionTable *tt)
+      : d_tt(tt),
+        d_ply(-1),
+        d_stamp(0),
+        d_limits(),
+        d_nodes(0),
+        d_stop(false),
+        d_rootBest(-1),
+        d_pause(false),
+        d_sliced(false),
+        d_toMove(SIDE_X),
+        d_rootHash(0),
+        d_depth(0),
+        d_maxDepth(0),
+        d_result(),
+        d_done(true),
+        d_sharedStop(0),
+        d_abort(0),
+        d_helper(0) {}
+
+  // Joins a parallel search: stop is polled every node, helper 0 is the
+  // main search and the caller ages the shared table once per move.
+  void setParallel(std::atomic<bool> *stop, int helper) {
+    d_sharedStop = stop;
+    d_helper = helper;
+  }
+
+  // Polled every node like the shared stop, but set from outside the
+  // search, by a caller that no longer wants the move.
+  void setAbort(std::atomic<bool> *abort) { d_abort = abort; }
+
+  SearchResult run(const KBoard &board, Side toMove,
+                   const SearchLimits &limits) {
+    start(board, toMove, limits);
+    step(0);
+    return d_result;
+  }
+
+  // Sets up a search that step() carries out, for callers that cannot
+  // block for a whole move: a single-threaded UI searches a slice per
+  // frame. The time limit is wall-clock from here, slices included.
+  void start(const KBoard &board, Side toMove, const SearchLimits &limits) {
+    d_start = Clock::now();
+    d_limits = limits;
+    d_nodes = 0;
+    d_stop = false;
+    d_rootBest = -1;
+    d_board = board;
+    d_zobrist.resize(board.cells());
+    d_history.assign(board.cells(), 0);
+    if (int(d_mark.size()) != board.cells()) {
+      d_mark.assign(board.cells(), 0);
+      d_stamp = 0;
+      // move lists are sized for the board as iterations need them
+      d_plyMoves.clear();
+      d_plyMoves.reserve(MAX_SEARCH_PLY);
+      d_frames.resize(MAX_SEARCH_PLY);
+    }
+    if (!d_sharedStop) {
+      d_tt->newSearch();
+    }
+
+    d_rootHash = toMove == SIDE_O ? d_zobrist.sideKey() : 0;
+    for (int w = 0; w < board.words(); w++) {
+      for (int s = SIDE_X; s <= SIDE_O; s++) {
+        for (uint64_t m = board.bits(Side(s), w); m; m &= m - 1) {
+          d_rootHash ^= d_zobrist.key(w * 64 + lowestBit64(m), Side(s));
+        }
+      }
+    }
+
+    d_maxDepth = board.emptyCount();
+    if (limits.maxDepth > 0 && limits.maxDepth < d_maxDepth) {
+      d_maxDepth = limits.maxDepth;
+    }
+    if (d_maxDepth > MAX_SEARCH_PLY - 1) {
+      d_maxDepth = MAX_SEARCH_PLY - 1;
+    }
+    reservePlies(1);
+    d_toMove = toMove;
+    d_depth = 1 + (d_helper & 1);
+    d_ply = -1;
+    d_result = SearchResult{-1, 0, 0, 0, 0.0};
+    d_done = false;
+  }
+
+  // Searches for about sliceSeconds more, or to the end with 0. True once
+  // the search is done and result() holds the move: the deepest iteration
+  // completed when a limit hit.
+  bool step(double sliceSeconds) {
+    if (d_done) {
+      return true;
+    }
+    d_pause = false;
+    d_sliced = sliceSeconds > 0;
+    if (d_sliced) {
+      d_sliceEnd = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                      std::chrono::duration<double>(
+                                          sliceSeconds));
+    }
+    for (; d_depth <= d_maxDepth; d_depth++) {
+      reservePlies(d_depth + 1);
+      int score;
+      if (d_ply < 0 && !enter(0, d_depth, -WIN_SCORE - 1, WIN_SCORE + 1,
+                              d_toMove, d_rootHash, &score)) {
+        // the root itself is a leaf or the search stopped on entering it
+      } else if (!advance(&score)) {
+        return false;
+      }
+      if (d_stop) {
+        break;
+      }
+      d_result.move = d_rootBest;
+      d_result.score = score;
+      d_result.depth = d_depth;
+      if (isWinScore(score)) {
+        break;
+      }
+    }
+    if (d_result.move < 0) {
+      // not even depth 1 finished, fall back to the best ordered move
+      generateMoves(d_toMove, d_rootBest, &d_plyMoves[0]);
+      d_result.move = d_plyMoves[0].front().move;
+    }
+    d_result.nodes = d_nodes;
+    d_result.seconds = elapsed();
+    d_sliced = false;
+    d_done = true;
+    return true;
+  }
+
+  bool done() const { return d_done; }
+
+  // Of the last finished search.
+  const SearchResult &result() const { return d_result; }
+};
+
+}  // namespace ttt
+
+#endif  // SEARCH_H
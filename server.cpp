@@ -0,0 +1,823 @@
+// Headless game server: many concurrent games against the engine over a
+// line protocol on a TCP or Unix socket, one epoll loop, no SDL. Linux
+// only. Requests, one per line:
+//
+//   new <3|15|19> <easy|hard|mcts> <me|ai>  ok <sid>, then the AI's move
+//                                           if it moves first
+//   play <sid> <cell>                       move <sid> <cell> from the AI,
+//                                           end <sid> <X|O|draw> once over
+//   quit <sid>                              bye <sid>
+//   resume <sid>                            resumed <sid> <cells>, a
+//                                           session from a snapshot
+//
+// Errors are "err <sid|-> <reason>". The client plays X and the AI O, as in
+// the SDL game. AI moves requested while handling one round of events are
+// computed together at the end of the round, spread over a thread pool
+// with one engine per thread.
+//
+// A 3x3 session is 24 bytes, its game packed into 4 of them, so millions
+// fit in memory. With --snapshot the server saves those games to a file
+// on exit and restores them on start; each then waits for a "resume" from
+// a new connection. Larger boards are not saved.
+//
+// With --broadcast one game at a time is featured for spectators: the
+// first to start while none is, published move by move into a broadcast
+// file (broadcast.h) that any number of local spectators map.
+
+#include "broadcast.h"
+#include "engine.h"
+#include "game.h"
+#include "log.h"
+#include "packedgame.h"
+#include "pool.h"
+#include "snapshot.h"
+#include "threadpool.h"
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+  int port;
+  std::string unixPath;  // instead of TCP when set
+  int threads;           // AI threads, the loop thread included
+  double moveSeconds;
+  size_t maxSessions;
+  uint64_t seed;
+  std::string snapshot;  // saved on exit, restored on start when set
+  std::string broadcast;  // featured games published there when set
+};
+
+// Below this many 3x3 AI moves per round the loop thread computes them
+// alone; a move on a larger board is a timed search and counts as many.
+const size_t PARALLEL_BATCH = 64;
+const int MAX_EVENTS = 256;
+const size_t READ_CHUNK = 64 << 10;
+// Lines longer than this close the connection.
+const size_t MAX_LINE = 256;
+const size_t ENGINE_TT_BYTES = 4 << 20;
+// Concurrent 15x15 and 19x19 sessions.
+const size_t MAX_BIG_SESSIONS = 1 << 16;
+// Deltas a spectator may fall behind before it rejoins from the keyframe.
+const uint32_t BROADCAST_CAPACITY = 1 << 16;
+
+volatile sig_atomic_t g_stop = 0;
+
+void onSignal(int) { g_stop = 1; }
+
+void usage() {
+  std::cerr << "usage: tic-tac-toe-server [options]\n"
+               "  --port N          TCP port on 127.0.0.1 (7878)\n"
+               "  --unix PATH       listen on a Unix socket instead\n"
+               "  --threads N       AI threads (all cores)\n"
+               "  --move-seconds S  search time per AI move on large\n"
+               "                    boards (0.05)\n"
+               "  --max-sessions N  concurrent sessions (1048576)\n"
+               "  --seed N          random seed (1)\n"
+               "  --snapshot PATH   save 3x3 sessions to PATH on exit,\n"
+               "                    restore them on start\n"
+               "  --broadcast PATH  publish featured games to spectators\n"
+               "                    through PATH\n";
+}
+
+bool parseArgs(int argc, char **argv, Options *o) {
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char *value = argv[++i];
+    if (arg == "--port") {
+      o->port = atoi(value);
+    } else if (arg == "--unix") {
+      o->unixPath = value;
+    } else if (arg == "--threads") {
+      o->threads = atoi(value);
+    } else if (arg == "--move-seconds") {
+      o->moveSeconds = atof(value);
+    } else if (arg == "--max-sessions") {
+      o->maxSessions = size_t(strtoull(value, 0, 10));
+    } else if (arg == "--seed") {
+      o->seed = strtoull(value, 0, 10);
+    } else if (arg == "--snapshot") {
+      o->snapshot = value;
+    } else if (arg == "--broadcast") {
+      o->broadcast = value;
+    } else {
+      return false;
+    }
+  }
+  return o->threads > 0;
+}
+
+bool parseLevel(const char *s, ttt::Level *out) {
+  if (strcmp(s, "easy") == 0) {
+    *out = ttt::LEVEL_EASY;
+    return true;
+  }
+  if (strcmp(s, "hard") == 0) {
+    *out = ttt::LEVEL_HARD;
+    return true;
+  }
+  if (strcmp(s, "mcts") == 0) {
+    *out = ttt::LEVEL_MCTS;
+    return true;
+  }
+  return false;
+}
+
+bool setNonBlocking(int fd) {
+  const int flags = ::fcntl(fd, F_GETFL, 0);
+  return flags >= 0 && ::fcntl(fd, F_SETFL, flags | O_NONBLOCK) == 0;
+}
+
+// Session::conn of sessions no connection owns.
+const int FREE = -1;
+const int DETACHED = -2;  // restored, waiting for a resume
+
+// One game: packed into state on 3x3, in d_bigGames with only the level
+// in state on larger boards. A connection links its sessions so closing
+// it frees them.
+struct Session {
+  ttt::PackedGame state;
+  uint32_t big;  // d_bigGames slot, Pool::NONE on 3x3
+  int conn;
+  uint32_t generation;
+  int32_t prev;  // sessions of the same connection
+  int32_t next;
+
+  Session()
+      : state(ttt::PackedGame::none()),
+        big(ttt::Pool<ttt::Game>::NONE),
+        conn(FREE),
+        generation(0),
+        prev(-1),
+        next(-1) {}
+};
+
+struct Connection {
+  int fd;  // -1 when closed
+  std::string in;
+  std::string out;
+  int32_t sessions;  // first of the list
+  bool queued;       // in the flush list
+  bool eof;          // the peer is done sending, closed once flushed
+
+  Connection()
+      : fd(-1), in(), out(), sessions(-1), queued(false), eof(false) {}
+};
+
+// An AI move to compute this round.
+struct Pending {
+  uint32_t sid;
+  uint32_t generation;
+  int move;
+};
+
+class Server {
+  Options d_options;
+  int d_listen;
+  int d_epoll;
+  std::vector<Connection> d_conns;  // by fd
+  std::vector<int> d_flush;
+  ttt::Pool<Session> d_sessions;
+  ttt::Pool<ttt::Game> d_bigGames;
+  std::vector<Pending> d_pending;
+  ttt::ThreadPool d_pool;
+  std::vector<std::unique_ptr<ttt::Engine> > d_engines;  // per batch chunk
+  std::vector<ttt::Game> d_unpacked;  // per batch chunk, 0 for the loop
+  uint64_t d_moves;
+  uint64_t d_games;
+  size_t d_largestBatch;
+  ttt::BroadcastWriter d_broadcast;
+  uint32_t d_featured;  // session published, Pool::NONE for none
+
+  void send(int fd, const char *line) {
+    Connection &c = d_conns[fd];
+    c.out += line;
+    if (!c.queued) {
+      c.queued = true;
+      d_flush.push_back(fd);
+    }
+  }
+
+  __attribute__((format(printf, 3, 4))) void sendf(int fd,
+                                                   const char *format, ...) {
+    char line[64];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(line, sizeof(line), format, args);
+    va_end(args);
+    send(fd, line);
+  }
+
+  // Writes what the socket takes; the rest waits for EPOLLOUT. Closes a
+  // connection at EOF once everything is written.
+  void flush(int fd) {
+    Connection &c = d_conns[fd];
+    size_t done = 0;
+    while (done < c.out.size()) {
+      const ssize_t n =
+          ::send(fd, c.out.data() + done, c.out.size() - done, MSG_NOSIGNAL);
+      if (n <= 0) {
+        break;
+      }
+      done += size_t(n);
+    }
+    c.out.erase(0, done);
+    if (c.eof && c.out.empty()) {
+      closeConnection(fd);
+      return;
+    }
+    epoll_event ev;
+    ev.events = c.eof ? 0u : uint32_t(EPOLLIN);
+    if (!c.out.empty()) {
+      ev.events |= EPOLLOUT;
+    }
+    ev.data.fd = fd;
+    ::epoll_ctl(d_epoll, EPOLL_CTL_MOD, fd, &ev);
+  }
+
+  // The game of sid: a larger board in place, a 3x3 one unpacked into
+  // *unpacked, to be stored back after a move.
+  ttt::Game &game(uint32_t sid, ttt::Game *unpacked) {
+    const Session &s = d_sessions[sid];
+    if (s.big != ttt::Pool<ttt::Game>::NONE) {
+      return d_bigGames[s.big];
+    }
+    ttt::unpackGame(s.state, unpacked);
+    return *unpacked;
+  }
+
+  void store(uint32_t sid, const ttt::Game &game) {
+    Session &s = d_sessions[sid];
+    if (s.big == ttt::Pool<ttt::Game>::NONE) {
+      s.state = ttt::packGame(game, s.state.level());
+    }
+  }
+
+  void attach(uint32_t sid, int fd) {
+    Session &s = d_sessions[sid];
+    Connection &c = d_conns[fd];
+    s.conn = fd;
+    s.prev = -1;
+    s.next = c.sessions;
+    if (c.sessions >= 0) {
+      d_sessions[c.sessions].prev = int32_t(sid);
+    }
+    c.sessions = int32_t(sid);
+  }
+
+  // A session of fd playing rules, or Pool::NONE when full.
+  uint32_t newSession(int fd, const ttt::Rules &rules, ttt::Level level,
+                      ttt::Side first) {
+    const uint32_t sid = d_sessions.allocate();
+    if (sid == ttt::Pool<Session>::NONE) {
+      return sid;
+    }
+    Session &s = d_sessions[sid];
+    s.big = ttt::Pool<ttt::Game>::NONE;
+    ttt::Game *g = &d_unpacked[0];
+    if (rules != ttt::RULES_3X3) {
+      s.big = d_bigGames.allocate();
+      if (s.big == ttt::Pool<ttt::Game>::NONE) {
+        d_sessions.release(sid);
+        return ttt::Pool<Session>::NONE;
+      }
+      g = &d_bigGames[s.big];
+    }
+    g->reset(rules, first);
+    s.state = ttt::packGame(*g, level);
+    attach(sid, fd);
+    if (d_featured == ttt::Pool<Session>::NONE && d_broadcast.game(rules)) {
+      d_featured = sid;
+    }
+    return sid;
+  }
+
+  void broadcastMove(uint32_t sid, int cell, ttt::Side s) {
+    if (sid == d_featured) {
+      d_broadcast.move(cell, s);
+    }
+  }
+
+  // Ends the featured game if sid plays it.
+  void broadcastEnd(uint32_t sid, ttt::Outcome outcome) {
+    if (sid == d_featured) {
+      d_broadcast.end(outcome);
+      d_featured = ttt::Pool<Session>::NONE;
+    }
+  }
+
+  void freeSession(uint32_t sid) {
+    broadcastEnd(sid, ttt::OUTCOME_NONE);  // abandoned
+    Session &s = d_sessions[sid];
+    if (s.conn >= 0) {
+      Connection &c = d_conns[s.conn];
+      if (s.prev >= 0) {
+        d_sessions[s.prev].next = s.next;
+      } else {
+        c.sessions = s.next;
+      }
+      if (s.next >= 0) {
+        d_sessions[s.next].prev = s.prev;
+      }
+    }
+    if (s.big != ttt::Pool<ttt::Game>::NONE) {
+      d_bigGames.release(s.big);
+    }
+    s.conn = FREE;
+    s.generation++;  // drops a pending AI move
+    d_sessions.release(sid);
+  }
+
+  // The session sid with conn owner, or Pool::NONE after reporting the
+  // error.
+  uint32_t findSession(int fd, const char *sidText, int owner) {
+    char *end;
+    const unsigned long sid = strtoul(sidText, &end, 10);
+    if (*end || sid >= d_sessions.size() ||
+        d_sessions[uint32_t(sid)].conn != owner) {
+      send(fd, "err - no_session\n");
+      return ttt::Pool<Session>::NONE;
+    }
+    return uint32_t(sid);
+  }
+
+  void queueAi(uint32_t sid) {
+    const Pending p = {sid, d_sessions[sid].generation, -1};
+    d_pending.push_back(p);
+  }
+
+  // Reports the end of a game and frees its session.
+  bool endIfFinished(uint32_t sid, const ttt::Game &game) {
+    if (!game.finished()) {
+      return false;
+    }
+    sendf(d_sessions[sid].conn, "end %u %s\n", sid,
+          ttt::outcomeName(game.outcome()));
+    broadcastEnd(sid, game.outcome());
+    d_games++;
+    freeSession(sid);
+    return true;
+  }
+
+  void request(int fd, char *line) {
+    char *words[5];
+    int n = 0;
+    for (char *save = 0, *w = strtok_r(line, " \r", &save); w && n < 5;
+         w = strtok_r(0, " \r", &save)) {
+      words[n++] = w;
+    }
+    if (n == 4 && strcmp(words[0], "new") == 0) {
+      const int size = atoi(words[1]);
+      const ttt::Rules rules =
+          size == 15 ? ttt::RULES_15X15
+                     : (size == 19 ? ttt::RULES_19X19 : ttt::RULES_3X3);
+      ttt::Level level;
+      const bool aiFirst = strcmp(words[3], "ai") == 0;
+      if ((size != 3 && size != 15 && size != 19) ||
+          !parseLevel(words[2], &level) ||
+          (!aiFirst && strcmp(words[3], "me") != 0)) {
+        send(fd, "err - bad_request\n");
+        return;
+      }
+      const uint32_t sid = newSession(fd, rules, level,
+                                      aiFirst ? ttt::SIDE_O : ttt::SIDE_X);
+      if (sid == ttt::Pool<Session>::NONE) {
+        send(fd, "err - full\n");
+        return;
+      }
+      sendf(fd, "ok %u\n", sid);
+      if (aiFirst) {
+        queueAi(sid);
+      }
+    } else if (n == 3 && strcmp(words[0], "play") == 0) {
+      const uint32_t sid = findSession(fd, words[1], fd);
+      if (sid == ttt::Pool<Session>::NONE) {
+        return;
+      }
+      ttt::Game &g = game(sid, &d_unpacked[0]);
+      const int cell = atoi(words[2]);
+      if (g.toMove() != ttt::SIDE_X || !g.play(cell)) {
+        sendf(fd, "err %u illegal\n", sid);
+        return;
+      }
+      d_moves++;
+      broadcastMove(sid, cell, ttt::SIDE_X);
+      store(sid, g);
+      if (!endIfFinished(sid, g)) {
+        queueAi(sid);
+      }
+    } else if (n == 2 && strcmp(words[0], "quit") == 0) {
+      const uint32_t sid = findSession(fd, words[1], fd);
+      if (sid != ttt::Pool<Session>::NONE) {
+        freeSession(sid);
+        sendf(fd, "bye %u\n", sid);
+      }
+    } else if (n == 2 && strcmp(words[0], "resume") == 0) {
+      const uint32_t sid = findSession(fd, words[1], DETACHED);
+      if (sid == ttt::Pool<Session>::NONE) {
+        return;
+      }
+      attach(sid, fd);
+      const ttt::Game &g = game(sid, &d_unpacked[0]);
+      char cells[ttt::BOARD_CELLS + 1];
+      for (int i = 0; i < ttt::BOARD_CELLS; i++) {
+        cells[i] = g.board().has(i, ttt::SIDE_X)
+                       ? 'X'
+                       : (g.board().has(i, ttt::SIDE_O) ? 'O' : '.');
+      }
+      cells[ttt::BOARD_CELLS] = '\0';
+      sendf(fd, "resumed %u %s\n", sid, cells);
+      if (g.toMove() == ttt::SIDE_O) {
+        queueAi(sid);
+      }
+    } else {
+      send(fd, "err - bad_request\n");
+    }
+  }
+
+  void closeConnection(int fd) {
+    Connection &c = d_conns[fd];
+    while (c.sessions >= 0) {
+      freeSession(uint32_t(c.sessions));
+    }
+    ::epoll_ctl(d_epoll, EPOLL_CTL_DEL, fd, 0);
+    ::close(fd);
+    c.fd = -1;
+    c.in.clear();
+    c.out.clear();
+  }
+
+  // Handles the complete lines received. At EOF the requests before it
+  // are still answered, then the connection closes.
+  void readable(int fd) {
+    Connection &c = d_conns[fd];
+    char buffer[READ_CHUNK];
+    for (;;) {
+      const ssize_t n = ::recv(fd, buffer, sizeof(buffer), 0);
+      if (n < 0 && errno != EAGAIN && errno != EINTR) {
+        closeConnection(fd);
+        return;
+      }
+      if (n <= 0) {
+        c.eof = n == 0;
+        break;
+      }
+      c.in.append(buffer, size_t(n));
+      size_t start = 0;
+      for (size_t nl; (nl = c.in.find('\n', start)) != std::string::npos;
+           start = nl + 1) {
+        c.in[nl] = '\0';
+        request(fd, &c.in[start]);
+      }
+      c.in.erase(0, start);
+      if (c.in.size() > MAX_LINE) {
+        closeConnection(fd);
+        return;
+      }
+    }
+    if (c.eof && !c.queued) {
+      c.queued = true;
+      d_flush.push_back(fd);
+    }
+  }
+
+  void accept() {
+    for (;;) {
+      const int fd = ::accept(d_listen, 0, 0);
+      if (fd < 0) {
+        return;
+      }
+      setNonBlocking(fd);
+      if (d_options.unixPath.empty()) {
+        const int one = 1;
+        ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+      }
+      if (size_t(fd) >= d_conns.size()) {
+        d_conns.resize(size_t(fd) + 1);
+      }
+      d_conns[fd] = Connection();
+      d_conns[fd].fd = fd;
+      epoll_event ev;
+      ev.events = EPOLLIN;
+      ev.data.fd = fd;
+      ::epoll_ctl(d_epoll, EPOLL_CTL_ADD, fd, &ev);
+    }
+  }
+
+  // Computes every AI move of the round, chunks in parallel, then plays
+  // them on the loop thread.
+  void runBatch() {
+    if (d_pending.empty()) {
+      return;
+    }
+    d_largestBatch =
+        d_pending.size() > d_largestBatch ? d_pending.size() : d_largestBatch;
+    size_t work = 0;
+    for (const Pending &p : d_pending) {
+      work += d_sessions[p.sid].big == ttt::Pool<ttt::Game>::NONE
+                  ? 1
+                  : PARALLEL_BATCH;
+    }
+    size_t chunks = work < PARALLEL_BATCH ? 1 : d_engines.size();
+    chunks = chunks < d_pending.size() ? chunks : d_pending.size();
+    const size_t per = (d_pending.size() + chunks - 1) / chunks;
+    ttt::ThreadPool::Group group;
+    for (size_t c = 0; c < chunks; c++) {
+      const size_t from = c * per;
+      const size_t to =
+          from + per < d_pending.size() ? from + per : d_pending.size();
+      auto task = [this, c, from, to]() {
+        ttt::Engine &engine = *d_engines[c];
+        for (size_t i = from; i < to; i++) {
+          Pending &p = d_pending[i];
+          const Session &s = d_sessions[p.sid];
+          if (s.generation == p.generation) {
+            const ttt::Game &g = game(p.sid, &d_unpacked[c]);
+            p.move = engine.move(g.board(), ttt::SIDE_O, s.state.level()).move;
+          }
+        }
+      };
+      if (chunks == 1) {
+        task();
+      } else {
+        d_pool.submit(&group, task);
+      }
+    }
+    if (chunks > 1) {
+      d_pool.wait(&group);
+    }
+
+    for (const Pending &p : d_pending) {
+      if (d_sessions[p.sid].generation != p.generation) {
+        continue;  // quit or disconnected meanwhile
+      }
+      ttt::Game &g = game(p.sid, &d_unpacked[0]);
+      if (!g.play(p.move)) {
+        continue;
+      }
+      d_moves++;
+      broadcastMove(p.sid, p.move, ttt::SIDE_O);
+      store(p.sid, g);
+      sendf(d_sessions[p.sid].conn, "move %u %d\n", p.sid, p.move);
+      endIfFinished(p.sid, g);
+    }
+    d_pending.clear();
+  }
+
+ public:
+  explicit Server(const Options &o)
+      : d_options(o),
+        d_listen(-1),
+        d_epoll(-1),
+        d_conns(),
+        d_flush(),
+        d_sessions(o.maxSessions),
+        d_bigGames(MAX_BIG_SESSIONS),
+        d_pending(),
+        d_pool(o.threads - 1),
+        d_engines(),
+        d_unpacked(size_t(o.threads)),
+        d_moves(0),
+        d_games(0),
+        d_largestBatch(0),
+        d_broadcast(),
+        d_featured(ttt::Pool<Session>::NONE) {
+    const ttt::SearchLimits limits = {0, o.moveSeconds, 0};
+    for (int i = 0; i < o.threads; i++) {
+      d_engines.emplace_back(
+          new ttt::Engine(ENGINE_TT_BYTES, o.seed + uint64_t(i), limits));
+    }
+  }
+
+  ~Server() {
+    for (size_t fd = 0; fd < d_conns.size(); fd++) {
+      if (d_conns[fd].fd >= 0) {
+        ::close(int(fd));
+      }
+    }
+    if (d_listen >= 0) {
+      ::close(d_listen);
+    }
+    if (d_epoll >= 0) {
+      ::close(d_epoll);
+    }
+    if (!d_options.unixPath.empty()) {
+      ::unlink(d_options.unixPath.c_str());
+    }
+  }
+
+  Server(const Server &) = delete;
+  Server &operator=(const Server &) = delete;
+
+  // Publishes featured games to spectators through a new broadcast file.
+  bool broadcast(const char *path) {
+    return d_broadcast.create(path, ttt::RULES_19X19.cells(),
+                              BROADCAST_CAPACITY);
+  }
+
+  // Restores the sessions of a snapshot, detached; false when there is
+  // none or it does not fit --max-sessions.
+  bool restore(const char *path) {
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point start = Clock::now();
+    ttt::SnapshotReader snapshot;
+    if (!snapshot.open(path) || !d_sessions.extend(snapshot.count())) {
+      return false;
+    }
+    const ttt::PackedGame *games = snapshot.games();
+    size_t restored = 0;
+    size_t skipped = 0;
+    // released from the top, so new sessions take the lowest free ids
+    for (size_t i = snapshot.count(); i-- > 0;) {
+      Session &s = d_sessions[uint32_t(i)];
+      if (!games[i].valid()) {
+        // empty slots, and games no server could have saved
+        skipped += games[i].isNone() ? 0 : 1;
+        d_sessions.release(uint32_t(i));
+        continue;
+      }
+      s.state = games[i];
+      s.conn = DETACHED;
+      restored++;
+    }
+    TTT_LOG_INFO(
+        "restore", {"sessions", restored}, {"invalid", skipped},
+        {"seconds",
+         std::chrono::duration<double>(Clock::now() - start).count()});
+    return true;
+  }
+
+  // Saves every 3x3 session, attached or not.
+  bool save(const char *path) {
+    typedef std::chrono::steady_clock Clock;
+    const Clock::time_point start = Clock::now();
+    std::vector<ttt::PackedGame> games(d_sessions.size(),
+                                       ttt::PackedGame::none());
+    size_t saved = 0;
+    for (uint32_t sid = 0; sid < d_sessions.size(); sid++) {
+      const Session &s = d_sessions[sid];
+      if (s.conn != FREE && s.big == ttt::Pool<ttt::Game>::NONE) {
+        games[sid] = s.state;
+        saved++;
+      }
+    }
+    const bool ok = ttt::writeSnapshot(path, games.data(), games.size());
+    TTT_LOG_INFO(
+        "snapshot", {"sessions", saved}, {"ok", ok},
+        {"seconds",
+         std::chrono::duration<double>(Clock::now() - start).count()});
+    return ok;
+  }
+
+  int listen() {
+    if (d_options.unixPath.empty()) {
+      d_listen = ::socket(AF_INET, SOCK_STREAM, 0);
+      const int one = 1;
+      ::setsockopt(d_listen, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+      sockaddr_in addr;
+      memset(&addr, 0, sizeof(addr));
+      addr.sin_family = AF_INET;
+      addr.sin_port = htons(uint16_t(d_options.port));
+      addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      if (::bind(d_listen, (sockaddr *)&addr, sizeof(addr)) != 0) {
+        return -1;
+      }
+    } else {
+      d_listen = ::socket(AF_UNIX, SOCK_STREAM, 0);
+      sockaddr_un addr;
+      memset(&addr, 0, sizeof(addr));
+      addr.sun_family = AF_UNIX;
+      strncpy(addr.sun_path, d_options.unixPath.c_str(),
+              sizeof(addr.sun_path) - 1);
+      ::unlink(addr.sun_path);
+      if (::bind(d_listen, (sockaddr *)&addr, sizeof(addr)) != 0) {
+        return -1;
+      }
+    }
+    if (::listen(d_listen, SOMAXCONN) != 0 || !setNonBlocking(d_listen)) {
+      return -1;
+    }
+    d_epoll = ::epoll_create1(0);
+    epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.fd = d_listen;
+    return ::epoll_ctl(d_epoll, EPOLL_CTL_ADD, d_listen, &ev);
+  }
+
+  void run() {
+    typedef std::chrono::steady_clock Clock;
+    Clock::time_point lastStats = Clock::now();
+    uint64_t lastMoves = 0;
+    epoll_event events[MAX_EVENTS];
+    while (!g_stop) {
+      const int n = ::epoll_wait(d_epoll, events, MAX_EVENTS, 1000);
+      for (int i = 0; i < n; i++) {
+        const int fd = events[i].data.fd;
+        if (fd == d_listen) {
+          accept();
+          continue;
+        }
+        if (d_conns[fd].fd < 0) {
+          continue;  // closed earlier this round
+        }
+        if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+          closeConnection(fd);
+          continue;
+        }
+        if (events[i].events & EPOLLIN) {
+          readable(fd);
+        }
+        if (d_conns[fd].fd >= 0 && (events[i].events & EPOLLOUT) &&
+            !d_conns[fd].queued) {
+          flush(fd);
+        }
+      }
+      runBatch();
+      for (int fd : d_flush) {
+        d_conns[fd].queued = false;
+        if (d_conns[fd].fd >= 0) {
+          flush(fd);
+        }
+      }
+      d_flush.clear();
+
+      const Clock::time_point now = Clock::now();
+      const double seconds =
+          std::chrono::duration<double>(now - lastStats).count();
+      if (seconds >= 1) {
+        TTT_LOG_INFO("stats", {"sessions", d_sessions.live()},
+                     {"moves_per_second", (d_moves - lastMoves) / seconds},
+                     {"games", d_games}, {"largest_batch", d_largestBatch});
+        lastStats = now;
+        lastMoves = d_moves;
+        d_largestBatch = 0;
+      }
+      ttt::logger().drain(std::cout);
+    }
+  }
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options o;
+  o.port = 7878;
+  o.threads = int(std::thread::hardware_concurrency());
+  o.threads = o.threads > 0 ? o.threads : 1;
+  o.moveSeconds = 0.05;
+  o.maxSessions = 1 << 20;
+  o.seed = 1;
+  if (!parseArgs(argc, argv, &o)) {
+    usage();
+    return 1;
+  }
+  ::signal(SIGINT, onSignal);
+  ::signal(SIGTERM, onSignal);
+  ::signal(SIGPIPE, SIG_IGN);
+
+  Server server(o);
+  if (!o.snapshot.empty()) {
+    server.restore(o.snapshot.c_str());
+  }
+  if (!o.broadcast.empty() && !server.broadcast(o.broadcast.c_str())) {
+    perror(o.broadcast.c_str());
+    return 1;
+  }
+  if (server.listen() != 0) {
+    perror("tic-tac-toe-server");
+    return 1;
+  }
+  if (o.unixPath.empty()) {
+    TTT_LOG_INFO("listen", {"port", o.port}, {"threads", o.threads});
+  } else {
+    TTT_LOG_INFO("listen", {"unix", o.unixPath.c_str()},
+                 {"threads", o.threads});
+  }
+  server.run();
+  const bool saved = o.snapshot.empty() || server.save(o.snapshot.c_str());
+  ttt::logger().drain(std::cout);
+  return saved ? 0 : 1;
+}
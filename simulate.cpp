@@ -0,0 +1,497 @@
+// Headless self-play: plays many games between two engine configurations on
+// all cores and reports throughput, per-move latency and results. With
+// --search-scaling it measures the parallel search instead. No SDL.
+
+#include "alloccount.h"
+#include "engine.h"
+#include "gamerecord.h"
+#include "histogram.h"
+#include "kboard.h"
+#include "log.h"
+#include "parallelsearch.h"
+#include "tablebase.h"
+#include "threadpool.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+  uint64_t games;
+  int threads;
+  ttt::Level level[2];  // per side, X then O
+  int first;            // SIDE_X, SIDE_O, or -1 to alternate
+  ttt::Rules rules;
+  double moveSeconds;
+  uint64_t mctsPlayouts;  // 0 uses moveSeconds
+  uint64_t seed;
+  bool verbose;
+  bool logJson;
+  int searchThreads;   // per game thread, caller included
+  int scalingDepth;    // > 0 runs the search scaling benchmark
+  bool allocCheck;
+  std::string recordPath;  // game records appended here when set
+  std::string tablebasePath;  // hard moves on its board read from it
+};
+
+struct Tally {
+  uint64_t games;
+  uint64_t moves;
+  uint64_t playouts;
+  double mctsSeconds;
+  uint64_t wins[2];
+  uint64_t draws;
+  uint64_t firstMoverWins;
+  ttt::Histogram moveNanos;
+
+  Tally()
+      : games(0),
+        moves(0),
+        playouts(0),
+        mctsSeconds(0),
+        wins(),
+        draws(0),
+        firstMoverWins(0) {}
+
+  void merge(const Tally &o) {
+    games += o.games;
+    moves += o.moves;
+    playouts += o.playouts;
+    mctsSeconds += o.mctsSeconds;
+    wins[ttt::SIDE_X] += o.wins[ttt::SIDE_X];
+    wins[ttt::SIDE_O] += o.wins[ttt::SIDE_O];
+    draws += o.draws;
+    firstMoverWins += o.firstMoverWins;
+    moveNanos.merge(o.moveNanos);
+  }
+};
+
+const char *levelName(ttt::Level l) {
+  switch (l) {
+    case ttt::LEVEL_HARD:
+      return "hard";
+    case ttt::LEVEL_MCTS:
+      return "mcts";
+    default:
+      return "easy";
+  }
+}
+
+const char *sideName(ttt::Side s) { return s == ttt::SIDE_X ? "X" : "O"; }
+
+void usage() {
+  std::cerr
+      << "usage: tic-tac-toe-sim [options]\n"
+         "  --games N          games to play (1000000)\n"
+         "  --threads N        worker threads (all cores)\n"
+         "  --x easy|hard|mcts X engine (hard)\n"
+         "  --o easy|hard|mcts O engine (easy)\n"
+         "  --first x|o|alt    who moves first (alt)\n"
+         "  --board 3|4|15|19  board variant (3)\n"
+         "  --move-seconds S   search time per move on large boards (0.05)\n"
+         "  --mcts-playouts N  MCTS playouts per move instead of time\n"
+         "  --seed N           random seed (1)\n"
+         "  --verbose          log every move to stdout\n"
+         "  --log-json         log as JSON lines\n"
+         "  --record PATH      append every game to a record file\n"
+         "  --tablebase PATH   perfect hard moves from a tablebase\n"
+         "  --alloc-check      verify that games after the first allocate\n"
+         "                     nothing, for every engine, no games\n"
+         "  --search-threads N search threads per game thread (1)\n"
+         "  --search-scaling D time-to-depth D for 1, 2, 4, ... search\n"
+         "                     threads up to --threads, no games\n";
+}
+
+bool parseLevel(const char *s, ttt::Level *out) {
+  if (strcmp(s, "easy") == 0) {
+    *out = ttt::LEVEL_EASY;
+    return true;
+  }
+  if (strcmp(s, "hard") == 0) {
+    *out = ttt::LEVEL_HARD;
+    return true;
+  }
+  if (strcmp(s, "mcts") == 0) {
+    *out = ttt::LEVEL_MCTS;
+    return true;
+  }
+  return false;
+}
+
+bool parseArgs(int argc, char **argv, Options *o) {
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (arg == "--verbose") {
+      o->verbose = true;
+      continue;
+    }
+    if (arg == "--log-json") {
+      o->logJson = true;
+      continue;
+    }
+    if (arg == "--alloc-check") {
+      o->allocCheck = true;
+      continue;
+    }
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char *value = argv[++i];
+    if (arg == "--games") {
+      o->games = strtoull(value, 0, 10);
+    } else if (arg == "--threads") {
+      o->threads = atoi(value);
+    } else if (arg == "--x") {
+      if (!parseLevel(value, &o->level[ttt::SIDE_X])) {
+        return false;
+      }
+    } else if (arg == "--o") {
+      if (!parseLevel(value, &o->level[ttt::SIDE_O])) {
+        return false;
+      }
+    } else if (arg == "--first") {
+      o->first = strcmp(value, "x") == 0
+                     ? ttt::SIDE_X
+                     : (strcmp(value, "o") == 0 ? ttt::SIDE_O : -1);
+    } else if (arg == "--board") {
+      const int n = atoi(value);
+      o->rules = n == 4    ? ttt::RULES_4X4
+                 : n == 15 ? ttt::RULES_15X15
+                 : n == 19 ? ttt::RULES_19X19
+                           : ttt::RULES_3X3;
+    } else if (arg == "--move-seconds") {
+      o->moveSeconds = atof(value);
+    } else if (arg == "--mcts-playouts") {
+      o->mctsPlayouts = strtoull(value, 0, 10);
+    } else if (arg == "--seed") {
+      o->seed = strtoull(value, 0, 10);
+    } else if (arg == "--search-threads") {
+      o->searchThreads = atoi(value);
+    } else if (arg == "--search-scaling") {
+      o->scalingDepth = atoi(value);
+    } else if (arg == "--record") {
+      o->recordPath = value;
+    } else if (arg == "--tablebase") {
+      o->tablebasePath = value;
+    } else {
+      return false;
+    }
+  }
+  return o->games > 0 && o->threads > 0 && o->searchThreads > 0;
+}
+
+void playGames(const Options &o, std::atomic<uint64_t> *next, int worker,
+               ttt::RecordLog *log, const ttt::Tablebase *tablebase,
+               Tally *tally) {
+  typedef std::chrono::steady_clock Clock;
+  const ttt::SearchLimits limits = {0, o.moveSeconds, 0};
+  const size_t ttBytes = o.rules == ttt::RULES_3X3 ? 1 << 20 : 16 << 20;
+  ttt::ThreadPool pool(o.searchThreads - 1);
+  const uint64_t seed = o.seed * 0x9e3779b97f4a7c15ull + worker;
+  ttt::Engine engine(ttBytes, seed, limits, &pool);
+  engine.setTablebase(tablebase);
+  std::unique_ptr<ttt::RecordWriter> record;
+  if (log->isOpen()) {
+    record.reset(new ttt::RecordWriter(log));
+  }
+  if (o.mctsPlayouts) {
+    engine.setMctsLimits(ttt::MctsLimits{0, o.mctsPlayouts});
+  }
+  ttt::KBoard board(o.rules);
+
+  const uint64_t BATCH = 256;
+  for (;;) {
+    const uint64_t begin = next->fetch_add(BATCH);
+    if (begin >= o.games) {
+      return;
+    }
+    const uint64_t end = begin + BATCH < o.games ? begin + BATCH : o.games;
+    for (uint64_t game = begin; game < end; game++) {
+      board.reset();
+      const ttt::Side first =
+          o.first < 0 ? ttt::Side(game & 1) : ttt::Side(o.first);
+      ttt::Side s = first;
+      int winner = -1;
+      if (record) {
+        record->begin(o.rules, first,
+                      ttt::recordEngine(o.level[ttt::SIDE_X]),
+                      ttt::recordEngine(o.level[ttt::SIDE_O]), seed,
+                      o.moveSeconds);
+      }
+      while (!board.isFull()) {
+        const Clock::time_point t0 = Clock::now();
+        const ttt::EngineMove m = engine.move(board, s, o.level[s]);
+        const uint64_t nanos = uint64_t(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() -
+                                                                 t0)
+                .count());
+        tally->moveNanos.record(nanos);
+        tally->moves++;
+        if (m.source == ttt::MOVE_MCTS) {
+          tally->playouts += engine.lastMcts().playouts;
+          tally->mctsSeconds += engine.lastMcts().seconds;
+        }
+        board.play(m.move, s);
+        if (record) {
+          record->move(m.move);
+        }
+        if (o.verbose) {
+          TTT_LOG_INFO("move", {"game", game}, {"side", sideName(s)},
+                       {"engine", levelName(o.level[s])}, {"cell", m.move},
+                       {"score", m.score}, {"nanos", nanos});
+        }
+        if (board.lineThrough(m.move, s, 0)) {
+          winner = s;
+          break;
+        }
+        s = ttt::otherSide(s);
+      }
+      tally->games++;
+      if (record) {
+        record->end(winner < 0 ? ttt::OUTCOME_DRAW
+                               : (winner == ttt::SIDE_X ? ttt::OUTCOME_X
+                                                        : ttt::OUTCOME_O));
+      }
+      if (winner < 0) {
+        tally->draws++;
+      } else {
+        tally->wins[winner]++;
+        if (winner == first) {
+          tally->firstMoverWins++;
+        }
+      }
+    }
+  }
+}
+
+// Plays one game between two engines of the same level; the winner or -1.
+int playGame(ttt::Engine *engine, ttt::KBoard *board, ttt::Level level) {
+  board->reset();
+  ttt::Side s = ttt::SIDE_X;
+  while (!board->isFull()) {
+    const int move = engine->move(*board, s, level).move;
+    board->play(move, s);
+    if (board->lineThrough(move, s, 0)) {
+      return s;
+    }
+    s = ttt::otherSide(s);
+  }
+  return -1;
+}
+
+// Whole games after a warm-up game must not allocate: engines size their
+// tables, move lists and arenas once per board.
+bool allocCheck(const Options &o) {
+  const ttt::Level LEVELS[] = {ttt::LEVEL_EASY, ttt::LEVEL_HARD,
+                               ttt::LEVEL_MCTS};
+  const ttt::SearchLimits limits = {0, o.moveSeconds, 0};
+  ttt::ThreadPool pool(0);
+  ttt::Engine engine(16 << 20, o.seed, limits, &pool);
+  engine.setMctsLimits(
+      ttt::MctsLimits{0, o.mctsPlayouts ? o.mctsPlayouts : 2000});
+  ttt::KBoard board(o.rules);
+
+  bool ok = true;
+  printf("board        %dx%d k=%d\n", o.rules.cols, o.rules.rows, o.rules.k);
+  for (ttt::Level level : LEVELS) {
+    playGame(&engine, &board, level);
+    const ttt::AllocationScope scope;
+    const int GAMES = 3;
+    for (int game = 0; game < GAMES; game++) {
+      playGame(&engine, &board, level);
+    }
+    printf("%-12s %llu allocations in %d games\n", levelName(level),
+           (unsigned long long)scope.count(), GAMES);
+    ok = ok && scope.count() == 0;
+  }
+  return ok;
+}
+
+// Openings of a few stones near the center, the same for every run.
+std::vector<ttt::KBoard> scalingPositions(const Options &o) {
+  const int NUM_POSITIONS = 8;
+  const int STONES = 6;
+  std::vector<ttt::KBoard> positions;
+  uint64_t rng = o.seed;
+  for (int p = 0; p < NUM_POSITIONS; p++) {
+    ttt::KBoard board(o.rules);
+    const int c = board.center();
+    ttt::Side s = ttt::SIDE_X;
+    while (board.count() < STONES && !board.isFull()) {
+      const int col = board.col(c) + int(ttt::splitMix64(&rng) % 5) - 2;
+      const int row = board.row(c) + int(ttt::splitMix64(&rng) % 5) - 2;
+      if (col < 0 || row < 0 || col >= board.cols() || row >= board.rows()) {
+        continue;
+      }
+      const int idx = board.index(col, row);
+      if (!board.isEmpty(idx)) {
+        continue;
+      }
+      board.play(idx, s);
+      s = ttt::otherSide(s);
+    }
+    positions.push_back(board);
+  }
+  return positions;
+}
+
+// Searches every opening to a fixed depth from a cleared table for 1, 2,
+// 4, ... threads and reports time-to-depth, nodes/sec and speedups.
+void searchScaling(const Options &o) {
+  const std::vector<ttt::KBoard> positions = scalingPositions(o);
+  ttt::ThreadPool pool(o.threads - 1);
+  ttt::TranspositionTable tt(64 << 20);
+  ttt::ParallelSearch search(&tt, &pool);
+  const ttt::SearchLimits limits = {o.scalingDepth, 0, 0};
+
+  printf("board        %dx%d k=%d\n", o.rules.cols, o.rules.rows, o.rules.k);
+  printf("positions    %d searched to depth %d\n", int(positions.size()),
+         o.scalingDepth);
+  printf("%8s %12s %14s %14s %10s %10s\n", "threads", "seconds", "nodes",
+         "nodes/s", "speedup", "nps x");
+  double baseSeconds = 0;
+  double baseNps = 0;
+  for (int threads = 1;; threads *= 2) {
+    threads = threads < o.threads ? threads : o.threads;
+    search.setThreads(threads);
+    double seconds = 0;
+    uint64_t nodes = 0;
+    for (const ttt::KBoard &board : positions) {
+      tt.clear();
+      const ttt::Side toMove = ttt::Side(board.count() & 1);
+      const ttt::SearchResult r = search.run(board, toMove, limits);
+      seconds += r.seconds;
+      nodes += r.nodes;
+    }
+    const double nps = seconds > 0 ? nodes / seconds : 0;
+    if (threads == 1) {
+      baseSeconds = seconds;
+      baseNps = nps;
+    }
+    printf("%8d %12.3f %14llu %14.0f %10.2f %10.2f\n", threads, seconds,
+           (unsigned long long)nodes, nps,
+           seconds > 0 ? baseSeconds / seconds : 0,
+           baseNps > 0 ? nps / baseNps : 0);
+    if (threads == o.threads) {
+      break;
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options o;
+  o.games = 1000000;
+  o.threads = int(std::thread::hardware_concurrency());
+  o.threads = o.threads > 0 ? o.threads : 1;
+  o.level[ttt::SIDE_X] = ttt::LEVEL_HARD;
+  o.level[ttt::SIDE_O] = ttt::LEVEL_EASY;
+  o.first = -1;
+  o.rules = ttt::RULES_3X3;
+  o.moveSeconds = 0.05;
+  o.mctsPlayouts = 0;
+  o.seed = 1;
+  o.verbose = false;
+  o.logJson = false;
+  o.searchThreads = 1;
+  o.scalingDepth = 0;
+  o.allocCheck = false;
+  if (!parseArgs(argc, argv, &o)) {
+    usage();
+    return 1;
+  }
+  if (o.allocCheck) {
+    return allocCheck(o) ? 0 : 1;
+  }
+  if (o.scalingDepth > 0) {
+    searchScaling(o);
+    return 0;
+  }
+
+  ttt::logger().setJson(o.logJson);
+  ttt::logger().setBlocking(true);
+  std::unique_ptr<ttt::LogDrainer> drainer;
+  if (o.verbose) {
+    drainer.reset(new ttt::LogDrainer(std::cout));
+  }
+
+  ttt::RecordLog log;
+  if (!o.recordPath.empty() && !log.open(o.recordPath.c_str())) {
+    perror(o.recordPath.c_str());
+    return 1;
+  }
+  ttt::Tablebase tablebase;
+  if (!o.tablebasePath.empty() &&
+      !tablebase.open(o.tablebasePath.c_str())) {
+    fprintf(stderr, "tic-tac-toe-sim: %s is not a tablebase\n",
+            o.tablebasePath.c_str());
+    return 1;
+  }
+  std::atomic<uint64_t> next(0);
+  std::vector<Tally> tallies(o.threads);
+  std::vector<std::thread> workers;
+  const std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  for (int t = 0; t < o.threads; t++) {
+    workers.emplace_back(playGames, std::cref(o), &next, t, &log,
+                         &tablebase, &tallies[t]);
+  }
+  Tally total;
+  for (int t = 0; t < o.threads; t++) {
+    workers[t].join();
+    total.merge(tallies[t]);
+  }
+  const double seconds =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+          .count();
+  drainer.reset();
+  if (ttt::logger().dropped()) {
+    printf("log          %llu events dropped\n",
+           (unsigned long long)ttt::logger().dropped());
+  }
+
+  const ttt::Histogram &h = total.moveNanos;
+  printf("board        %dx%d k=%d\n", o.rules.cols, o.rules.rows, o.rules.k);
+  printf("engines      X %s, O %s, first %s\n",
+         levelName(o.level[ttt::SIDE_X]), levelName(o.level[ttt::SIDE_O]),
+         o.first < 0 ? "alternate" : sideName(ttt::Side(o.first)));
+  printf("threads      %d, %d search threads each\n", o.threads,
+         o.searchThreads);
+  printf("games        %llu in %.3f s, %.0f games/s\n",
+         (unsigned long long)total.games, seconds, total.games / seconds);
+  printf("moves        %llu, %.0f moves/s\n", (unsigned long long)total.moves,
+         total.moves / seconds);
+  if (total.playouts) {
+    printf("playouts     %llu, %.0f playouts/s per thread\n",
+           (unsigned long long)total.playouts,
+           total.playouts / total.mctsSeconds);
+  }
+  printf("move ns      p50 %llu p90 %llu p99 %llu p99.9 %llu max %llu\n",
+         (unsigned long long)h.percentile(50),
+         (unsigned long long)h.percentile(90),
+         (unsigned long long)h.percentile(99),
+         (unsigned long long)h.percentile(99.9),
+         (unsigned long long)h.max());
+  printf("X wins       %llu (%.2f%%)\n",
+         (unsigned long long)total.wins[ttt::SIDE_X],
+         100.0 * total.wins[ttt::SIDE_X] / total.games);
+  printf("O wins       %llu (%.2f%%)\n",
+         (unsigned long long)total.wins[ttt::SIDE_O],
+         100.0 * total.wins[ttt::SIDE_O] / total.games);
+  printf("draws        %llu (%.2f%%)\n", (unsigned long long)total.draws,
+         100.0 * total.draws / total.games);
+  printf("first mover  %llu wins (%.2f%%)\n",
+         (unsigned long long)total.firstMoverWins,
+         100.0 * total.firstMoverWins / total.games);
+  return 0;
+}
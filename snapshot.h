@@ -0,0 +1,123 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "packedgame.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// Session snapshots: a header and then one PackedGame per session id,
+// PackedGame::none() for ids not in use, written and read through file
+// mappings. A restart maps the file and restores every session with a
+// page-in instead of replaying games. POSIX only.
+
+namespace ttt {
+
+struct SnapshotHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t count;
+};
+
+const uint32_t SNAPSHOT_MAGIC = 0x53545454;  // "TTTS"
+const uint32_t SNAPSHOT_VERSION = 1;
+
+// Writes games[0, count) to path, replacing it only once complete.
+inline bool writeSnapshot(const char *path, const PackedGame *games,
+                          size_t count) {
+  const std::string tmp = std::string(path) + ".tmp";
+  const int fd = ::open(tmp.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    return false;
+  }
+  const size_t bytes = sizeof(SnapshotHeader) + count * sizeof(PackedGame);
+  void *map = MAP_FAILED;
+  if (::ftruncate(fd, off_t(bytes)) == 0) {
+    map = ::mmap(0, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  bool ok = map != MAP_FAILED;
+  if (ok) {
+    const SnapshotHeader header = {SNAPSHOT_MAGIC, SNAPSHOT_VERSION,
+                                   uint64_t(count)};
+    unsigned char *p = static_cast<unsigned char *>(map);
+    memcpy(p, &header, sizeof(header));
+    memcpy(p + sizeof(header), games, count * sizeof(PackedGame));
+    ok = ::msync(map, bytes, MS_SYNC) == 0;
+    ::munmap(map, bytes);
+  }
+  ok = ::close(fd) == 0 && ok;
+  return ok && ::rename(tmp.c_str(), path) == 0;
+}
+
+// A snapshot mapped read-only; games() points into the mapping.
+class SnapshotReader {
+  void *d_map;
+  size_t d_bytes;
+  size_t d_count;
+
+ public:
+  SnapshotReader() : d_map(0), d_bytes(0), d_count(0) {}
+
+  ~SnapshotReader() { close(); }
+
+  SnapshotReader(const SnapshotReader &) = delete;
+  SnapshotReader &operator=(const SnapshotReader &) = delete;
+
+  // False when path is missing or not a snapshot of this version.
+  bool open(const char *path) {
+    close();
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || size_t(st.st_size) < sizeof(SnapshotHeader)) {
+      ::close(fd);
+      return false;
+    }
+    d_bytes = size_t(st.st_size);
+    void *map = ::mmap(0, d_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+      return false;
+    }
+    d_map = map;
+    SnapshotHeader header;
+    memcpy(&header, d_map, sizeof(header));
+    if (header.magic != SNAPSHOT_MAGIC ||
+        header.version != SNAPSHOT_VERSION ||
+        header.count > (d_bytes - sizeof(header)) / sizeof(PackedGame)) {
+      close();
+      return false;
+    }
+    d_count = size_t(header.count);
+    return true;
+  }
+
+  void close() {
+    if (d_map) {
+      ::munmap(d_map, d_bytes);
+    }
+    d_map = 0;
+    d_bytes = 0;
+    d_count = 0;
+  }
+
+  size_t count() const { return d_count; }
+
+  const PackedGame *games() const {
+    return reinterpret_cast<const PackedGame *>(
+        static_cast<const unsigned char *>(d_map) + sizeof(SnapshotHeader));
+  }
+};
+
+}  // namespace ttt
+
+#endif  // SNAPSHOT_H
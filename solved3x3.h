@@ -0,0 +1,181 @@
+#ifndef SOLVED3X3_H
+#define SOLVED3X3_H
+
+#include "bitboard.h"
+
+#include <cstdint>
+
+namespace ttt {
+
+// Perfect play for every 3x3 position, solved by the compiler. Positions are
+// seen from the side to move (mine/theirs) so one table serves both X and O
+// and either side moving first. Only one position per class of the eight
+// board symmetries is kept, in a small open addressing table.
+namespace solved3x3 {
+
+const int NUM_SYMMETRIES = 8;
+const int TABLE_BITS = 11;
+const int TABLE_SIZE = 1 << TABLE_BITS;
+
+// entry layout: key (18) | move (4) | value + 1 (2) | distance (4) | used (1)
+const uint32_t USED_BIT = 1u << 28;
+
+struct Tables {
+  // cell index of i after symmetry t, and back again
+  uint8_t forward[NUM_SYMMETRIES][BOARD_CELLS];
+  uint8_t inverse[NUM_SYMMETRIES][BOARD_CELLS];
+  // every 9-bit mask after symmetry t
+  Mask transform[NUM_SYMMETRIES][FULL_MASK + 1];
+  uint32_t entries[TABLE_SIZE];
+  int count;
+};
+
+constexpr uint32_t slotOf(uint32_t key) {
+  return (key * 2654435761u) >> (32 - TABLE_BITS);
+}
+
+constexpr uint32_t keyOf(Mask mine, Mask theirs) {
+  return uint32_t(mine) | (uint32_t(theirs) << 9);
+}
+
+// Smallest key over the symmetries, *sym receives the one that produced it.
+constexpr uint32_t canonical(const Tables &t, Mask mine, Mask theirs,
+                             int *sym) {
+  uint32_t best = 0xffffffffu;
+  for (int s = 0; s < NUM_SYMMETRIES; s++) {
+    const uint32_t key =
+        keyOf(t.transform[s][mine], t.transform[s][theirs]);
+    if (key < best) {
+      best = key;
+      *sym = s;
+    }
+  }
+  return best;
+}
+
+constexpr int findSlot(const Tables &t, uint32_t key) {
+  uint32_t slot = slotOf(key);
+  while ((t.entries[slot] & USED_BIT) != 0 &&
+         (t.entries[slot] & 0x3ffff) != key) {
+    slot = (slot + 1) & (TABLE_SIZE - 1);
+  }
+  return int(slot);
+}
+
+// Comparable score: quicker wins and slower losses are better.
+constexpr int scoreOf(int value, int distance) {
+  return value > 0 ? 100 - distance : (value < 0 ? -100 + distance : 0);
+}
+
+struct Outcome {
+  int value;  // +1 win, 0 draw, -1 loss for the side to move
+  int distance;  // plies until the game ends
+};
+
+constexpr Outcome solve(Tables &t, Mask mine, Mask theirs) {
+  if (hasLine(theirs)) {
+    return Outcome{-1, 0};
+  }
+  const Mask empty = Mask(~(mine | theirs) & FULL_MASK);
+  if (empty == 0) {
+    return Outcome{0, 0};
+  }
+  int sym = 0;
+  const uint32_t key = canonical(t, mine, theirs, &sym);
+  const int slot = findSlot(t, key);
+  if ((t.entries[slot] & USED_BIT) != 0) {
+    const uint32_t e = t.entries[slot];
+    return Outcome{int((e >> 22) & 3) - 1, int((e >> 24) & 15)};
+  }
+
+  Outcome best{-2, 0};
+  int bestMove = 0;
+  for (Mask e = empty; e; e = Mask(e & (e - 1))) {
+    const int m = __builtin_ctz(e);
+    const Outcome child = solve(t, theirs, Mask(mine | (1u << m)));
+    const Outcome outcome{-child.value, child.distance + 1};
+    if (best.value == -2 || scoreOf(outcome.value, outcome.distance) >
+                                scoreOf(best.value, best.distance)) {
+      best = outcome;
+      bestMove = m;
+    }
+  }
+
+  // the slot may have moved while the children were inserted
+  const int free = findSlot(t, key);
+  t.entries[free] = key | (uint32_t(t.forward[sym][bestMove]) << 18) |
+                    (uint32_t(best.value + 1) << 22) |
+                    (uint32_t(best.distance) << 24) | USED_BIT;
+  t.count++;
+  return best;
+}
+
+constexpr Tables build() {
+  Tables t{};
+  for (int s = 0; s < NUM_SYMMETRIES; s++) {
+    for (int i = 0; i < BOARD_CELLS; i++) {
+      const int c = i % 3;
+      const int r = i / 3;
+      // rotations by 0, 90, 180, 270 degrees, then their mirror images
+      int tc = c;
+      int tr = r;
+      for (int rot = 0; rot < s % 4; rot++) {
+        const int nc = 2 - tr;
+        tr = tc;
+        tc = nc;
+      }
+      if (s >= 4) {
+        tc = 2 - tc;
+      }
+      t.forward[s][i] = uint8_t(tc + 3 * tr);
+      t.inverse[s][tc + 3 * tr] = uint8_t(i);
+    }
+    for (int m = 0; m <= FULL_MASK; m++) {
+      Mask out = 0;
+      for (int i = 0; i < BOARD_CELLS; i++) {
+        if (m & (1 << i)) {
+          out |= Mask(1u << t.forward[s][i]);
+        }
+      }
+      t.transform[s][m] = out;
+    }
+  }
+  solve(t, 0, 0);
+  return t;
+}
+
+inline constexpr Tables TABLES = build();
+
+// 627 non-terminal positions up to symmetry, the empty board is a draw.
+static_assert(TABLES.count == 627, "unexpected number of 3x3 positions");
+static_assert(((TABLES.entries[findSlot(TABLES, 0)] >> 22) & 3) == 1,
+              "3x3 tic-tac-toe must be a draw");
+
+}  // namespace solved3x3
+
+struct SolvedMove {
+  int move;      // cell index, -1 when the game is over
+  int value;     // +1 win, 0 draw, -1 loss for the side to move
+  int distance;  // plies until the game ends with perfect play
+};
+
+// Perfect move for the side owning mine; 8 table transforms and one probe.
+inline SolvedMove solvedMove(Mask mine, Mask theirs) {
+  using namespace solved3x3;
+  const Tables &t = TABLES;
+  if (hasLine(mine) || hasLine(theirs) || (mine | theirs) == FULL_MASK) {
+    return SolvedMove{-1, hasLine(mine) ? 1 : (hasLine(theirs) ? -1 : 0), 0};
+  }
+  int sym = 0;
+  const uint32_t key = canonical(t, mine, theirs, &sym);
+  const uint32_t e = t.entries[findSlot(t, key)];
+  if ((e & USED_BIT) == 0) {
+    return SolvedMove{-1, 0, 0};  // not reachable by alternating play
+  }
+  return SolvedMove{t.inverse[sym][(e >> 18) & 15], int((e >> 22) & 3) - 1,
+                    int((e >> 24) & 15)};
+}
+
+}  // namespace ttt
+
+#endif  // SOLVED3X3_H
@@ -0,0 +1,340 @@
+// Solves every position of a small k-in-a-row board by retrograde analysis
+// and writes the tablebase that tablebase.h maps: the layers of n stones
+// from the full board down to the empty one, each from the layer after it,
+// the positions of a layer shared out to threads. Then measures probes of
+// the written file. No SDL.
+
+#include "histogram.h"
+#include "kboard.h"
+#include "tablebase.h"
+#include "ttable.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+struct Options {
+  ttt::Rules rules;
+  std::string out;
+  int threads;
+  uint64_t probes;
+  uint64_t seed;
+};
+
+// Occupied-cell sets a thread takes at a time.
+const uint64_t CHUNK_SETS = 256;
+// Positions the probe benchmark cycles through.
+const int PROBE_POSITIONS = 1 << 16;
+
+void usage() {
+  fprintf(stderr,
+          "usage: tic-tac-toe-tablebase [options]\n"
+          "  --cols N      board columns (4)\n"
+          "  --rows N      board rows (4)\n"
+          "  --k N         stones in a row to win (4)\n"
+          "  --out PATH    tablebase file (<cols>x<rows>k<k>.tttb)\n"
+          "  --threads N   threads (all cores)\n"
+          "  --probes N    probes timed after writing (10000000)\n"
+          "  --seed N      random seed of the probed positions (1)\n");
+}
+
+bool parseArgs(int argc, char **argv, Options *o) {
+  for (int i = 1; i < argc; i++) {
+    const std::string arg = argv[i];
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const char *value = argv[++i];
+    if (arg == "--cols") {
+      o->rules.cols = atoi(value);
+    } else if (arg == "--rows") {
+      o->rules.rows = atoi(value);
+    } else if (arg == "--k") {
+      o->rules.k = atoi(value);
+    } else if (arg == "--out") {
+      o->out = value;
+    } else if (arg == "--threads") {
+      o->threads = atoi(value);
+    } else if (arg == "--probes") {
+      o->probes = strtoull(value, 0, 10);
+    } else if (arg == "--seed") {
+      o->seed = strtoull(value, 0, 10);
+    } else {
+      return false;
+    }
+  }
+  const ttt::Rules &r = o->rules;
+  return o->threads > 0 && r.cols > 0 && r.rows > 0 && r.k > 0 &&
+         r.k <= std::max(r.cols, r.rows) &&
+         r.cells() <= ttt::TABLEBASE_MAX_CELLS;
+}
+
+// Next larger mask with as many bits; x must not be 0.
+uint32_t nextSubset(uint32_t x) {
+  const uint32_t c = x & (0u - x);
+  const uint32_t r = x + c;
+  return (((r ^ x) >> 2) / c) | r;
+}
+
+// The bits of within picked by the low bits of pick, lowest first.
+uint32_t deposit(uint32_t pick, uint32_t within) {
+  uint32_t out = 0;
+  for (; within; within &= within - 1, pick >>= 1) {
+    if (pick & 1) {
+      out |= within & (0u - within);
+    }
+  }
+  return out;
+}
+
+class Generator {
+  const ttt::Rules d_rules;
+  const ttt::TablebaseIndex d_index;
+  const std::vector<uint32_t> d_lines;
+  uint8_t *d_entries;
+
+  bool hasLine(uint32_t stones) const {
+    for (uint32_t line : d_lines) {
+      if ((stones & line) == line) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // The entry of a position of n stones; the layer of n + 1 is solved.
+  uint8_t solve(uint32_t mine, uint32_t theirs, int n) const {
+    if (hasLine(mine)) {
+      return ttt::tablebaseEntry(ttt::TB_UNREACHABLE, 0);
+    }
+    if (hasLine(theirs)) {
+      return ttt::tablebaseEntry(ttt::TB_LOSS, 0);
+    }
+    const int cells = d_rules.cells();
+    if (n == cells) {
+      return ttt::tablebaseEntry(ttt::TB_DRAW, 0);
+    }
+    int win = 1000;  // fastest win
+    int loss = 0;    // slowest loss
+    bool draw = false;
+    const uint32_t empty = ~(mine | theirs) & ((1u << cells) - 1);
+    for (uint32_t e = empty; e; e &= e - 1) {
+      const uint32_t bit = e & (0u - e);
+      const uint8_t child = d_entries[d_index.rank(theirs, mine | bit)];
+      const int distance = (child >> 2) + 1;
+      switch (child & 3) {
+        case ttt::TB_LOSS:
+          win = std::min(win, distance);
+          break;
+        case ttt::TB_DRAW:
+          draw = true;
+          break;
+        default:
+          loss = std::max(loss, distance);
+      }
+    }
+    if (win < 1000) {
+      return ttt::tablebaseEntry(ttt::TB_WIN, win);
+    }
+    if (draw) {
+      // nobody wins, so the board fills up
+      return ttt::tablebaseEntry(ttt::TB_DRAW, cells - n);
+    }
+    return ttt::tablebaseEntry(ttt::TB_LOSS, loss);
+  }
+
+  // Solves the positions of n stones whose occupied cells have colex ranks
+  // [from, to).
+  void solveSets(int n, uint64_t from, uint64_t to) const {
+    const int m = n / 2;
+    const uint64_t inner = d_index.binom(n, m);
+    uint32_t occupied = d_index.subsetUnrank(from, n);
+    uint64_t at = d_index.offset(n) + from * inner;
+    for (uint64_t r = from; r < to; r++) {
+      uint32_t pick = (1u << m) - 1;
+      for (uint64_t i = 0; i < inner; i++) {
+        const uint32_t mine = deposit(pick, occupied);
+        d_entries[at++] = solve(mine, occupied & ~mine, n);
+        if (m > 0) {
+          pick = nextSubset(pick);
+        }
+      }
+      if (n > 0) {
+        occupied = nextSubset(occupied);
+      }
+    }
+  }
+
+ public:
+  Generator(const ttt::Rules &rules, uint8_t *entries)
+      : d_rules(rules),
+        d_index(rules.cells()),
+        d_lines(ttt::tablebaseLines(rules)),
+        d_entries(entries) {}
+
+  // Solves the layer of n stones on threads threads.
+  void solveLayer(int n, int threads) const {
+    const uint64_t sets = d_index.binom(d_rules.cells(), n);
+    std::atomic<uint64_t> next(0);
+    auto work = [this, n, sets, &next]() {
+      for (uint64_t from; (from = next.fetch_add(CHUNK_SETS)) < sets;) {
+        solveSets(n, from, std::min(from + CHUNK_SETS, sets));
+      }
+    };
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++) {
+      workers.emplace_back(work);
+    }
+    work();
+    for (std::thread &w : workers) {
+      w.join();
+    }
+  }
+};
+
+const char *valueName(int v) {
+  static const char *const NAMES[] = {"draw", "win", "loss", "unreachable"};
+  return NAMES[v & 3];
+}
+
+// Positions of random games stopped before their end.
+void randomPositions(const Options &o, std::vector<uint32_t> *mine,
+                     std::vector<uint32_t> *theirs) {
+  const std::vector<uint32_t> lines = ttt::tablebaseLines(o.rules);
+  const int cells = o.rules.cells();
+  uint64_t rng = o.seed;
+  while (int(mine->size()) < PROBE_POSITIONS) {
+    uint32_t stones[2] = {0, 0};
+    const int moves = int(ttt::splitMix64(&rng) % uint64_t(cells));
+    int s = 0;
+    bool over = false;
+    for (int i = 0; i < moves && !over; i++, s ^= 1) {
+      int c;
+      do {
+        c = int(ttt::splitMix64(&rng) % uint64_t(cells));
+      } while ((stones[0] | stones[1]) >> c & 1);
+      stones[s] |= 1u << c;
+      for (uint32_t line : lines) {
+        over = over || (stones[s] & line) == line;
+      }
+    }
+    if (!over) {
+      mine->push_back(stones[s]);
+      theirs->push_back(stones[s ^ 1]);
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  Options o;
+  o.rules = {4, 4, 4};
+  o.threads = int(std::thread::hardware_concurrency());
+  o.threads = o.threads > 0 ? o.threads : 1;
+  o.probes = 10000000;
+  o.seed = 1;
+  if (!parseArgs(argc, argv, &o)) {
+    usage();
+    return 1;
+  }
+  if (o.out.empty()) {
+    o.out = std::to_string(o.rules.cols) + "x" + std::to_string(o.rules.rows) +
+            "k" + std::to_string(o.rules.k) + ".tttb";
+  }
+
+  // solved straight into the mapped file, renamed once complete
+  const ttt::TablebaseIndex index(o.rules.cells());
+  const size_t bytes = sizeof(ttt::TablebaseHeader) + index.size();
+  const std::string tmp = o.out + ".tmp";
+  const int fd = ::open(tmp.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  void *map = MAP_FAILED;
+  if (fd >= 0 && ::ftruncate(fd, off_t(bytes)) == 0) {
+    map = ::mmap(0, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  if (map == MAP_FAILED) {
+    perror(tmp.c_str());
+    return 1;
+  }
+  ttt::TablebaseHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = ttt::TABLEBASE_MAGIC;
+  header.version = ttt::TABLEBASE_VERSION;
+  header.cols = uint8_t(o.rules.cols);
+  header.rows = uint8_t(o.rules.rows);
+  header.k = uint8_t(o.rules.k);
+  header.count = index.size();
+  memcpy(map, &header, sizeof(header));
+  uint8_t *entries = static_cast<uint8_t *>(map) + sizeof(header);
+
+  printf("board        %dx%d k=%d, %llu positions\n", o.rules.cols,
+         o.rules.rows, o.rules.k, (unsigned long long)index.size());
+  const Generator generator(o.rules, entries);
+  const Clock::time_point start = Clock::now();
+  for (int n = o.rules.cells(); n >= 0; n--) {
+    generator.solveLayer(n, o.threads);
+  }
+  const double seconds =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  const bool written = ::msync(map, bytes, MS_SYNC) == 0;
+  ::munmap(map, bytes);
+  if (!written || ::close(fd) != 0 ||
+      ::rename(tmp.c_str(), o.out.c_str()) != 0) {
+    perror(o.out.c_str());
+    return 1;
+  }
+  printf("generated    %.3f s on %d threads, %.0f positions/s\n", seconds,
+         o.threads, index.size() / seconds);
+  printf("file         %s, %zu bytes\n", o.out.c_str(), bytes);
+
+  ttt::Tablebase tablebase;
+  if (!tablebase.open(o.out.c_str())) {
+    fprintf(stderr, "tic-tac-toe-tablebase: cannot map %s\n", o.out.c_str());
+    return 1;
+  }
+  const uint8_t root = tablebase.probe(0, 0);
+  printf("empty board  %s for the first mover in %d plies\n",
+         valueName(root), root >> 2);
+
+  std::vector<uint32_t> mine;
+  std::vector<uint32_t> theirs;
+  randomPositions(o, &mine, &theirs);
+  unsigned sink = 0;
+  Clock::time_point t0 = Clock::now();
+  for (uint64_t i = 0; i < o.probes; i++) {
+    const size_t p = size_t(i) & (PROBE_POSITIONS - 1);
+    sink += tablebase.probe(mine[p], theirs[p]);
+  }
+  const double probeNanos =
+      std::chrono::duration<double, std::nano>(Clock::now() - t0).count() /
+      double(o.probes);
+  ttt::Histogram moveNanos;
+  for (int p = 0; p < PROBE_POSITIONS; p++) {
+    t0 = Clock::now();
+    sink += unsigned(tablebase.bestMove(mine[p], theirs[p]).move);
+    moveNanos.record(uint64_t(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0)
+            .count()));
+  }
+  printf("probe        %.1f ns on average over %llu probes\n", probeNanos,
+         (unsigned long long)o.probes);
+  printf("best move ns p50 %llu p99 %llu max %llu (%u)\n",
+         (unsigned long long)moveNanos.percentile(50),
+         (unsigned long long)moveNanos.percentile(99),
+         (unsigned long long)moveNanos.max(), sink & 1);
+  return 0;
+}
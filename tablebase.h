@@ -0,0 +1,282 @@
+#ifndef TABLEBASE_H
+#define TABLEBASE_H
+
+#include "kboard.h"
+#include "solved3x3.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Perfect play on boards of up to 20 cells, such as 4x4 with 4 in a row,
+// from a file written by tic-tac-toe-tablebase. Positions are seen from the
+// side to move, which after alternating moves owns floor(n/2) of the n
+// stones, and are ranked by piece count: the layers of n stones follow each
+// other, and within one the colex rank of the occupied cells times
+// C(n, n/2) plus the colex rank of the mover's stones among them is the
+// index. That is a minimal perfect hash of the positions reachable by
+// alternating moves plus some unreachable ones, with no keys stored.
+//
+// Each position is a byte: bits 0-1 the value for the side to move, bits
+// 2-7 the plies to the end of the game with perfect play.
+
+namespace ttt {
+
+const int TABLEBASE_MAX_CELLS = 20;
+
+enum TablebaseValue {
+  TB_DRAW = 0,
+  TB_WIN = 1,
+  TB_LOSS = 2,
+  TB_UNREACHABLE = 3
+};
+
+inline uint8_t tablebaseEntry(TablebaseValue v, int distance) {
+  return uint8_t(v | distance << 2);
+}
+
+// Combinatorial ranking of the positions of one board size.
+class TablebaseIndex {
+  int d_cells;
+  uint64_t d_binom[TABLEBASE_MAX_CELLS + 1][TABLEBASE_MAX_CELLS + 2];
+  uint64_t d_offset[TABLEBASE_MAX_CELLS + 2];
+
+ public:
+  explicit TablebaseIndex(int cells) : d_cells(cells), d_binom(), d_offset() {
+    for (int n = 0; n <= TABLEBASE_MAX_CELLS; n++) {
+      d_binom[n][0] = 1;
+      for (int r = 1; r <= n; r++) {
+        d_binom[n][r] =
+            d_binom[n - 1][r - 1] + (r <= n - 1 ? d_binom[n - 1][r] : 0);
+      }
+    }
+    d_offset[0] = 0;
+    for (int n = 0; n <= cells; n++) {
+      d_offset[n + 1] = d_offset[n] + layerSize(n);
+    }
+  }
+
+  int cells() const { return d_cells; }
+
+  // C(n, r), 0 when r > n.
+  uint64_t binom(int n, int r) const { return r > n ? 0 : d_binom[n][r]; }
+
+  // Positions with n stones.
+  uint64_t layerSize(int n) const {
+    return binom(d_cells, n) * binom(n, n / 2);
+  }
+
+  uint64_t offset(int n) const { return d_offset[n]; }
+
+  uint64_t size() const { return d_offset[d_cells + 1]; }
+
+  // Colex rank of mask among masks of the same popcount.
+  uint64_t subsetRank(uint32_t mask) const {
+    uint64_t r = 0;
+    for (int i = 1; mask; mask &= mask - 1, i++) {
+      r += binom(__builtin_ctz(mask), i);
+    }
+    return r;
+  }
+
+  // The mask of n bits below d_cells with colex rank r.
+  uint32_t subsetUnrank(uint64_t r, int n) const {
+    uint32_t mask = 0;
+    for (int i = n, c = d_cells - 1; i > 0; i--) {
+      while (binom(c, i) > r) {
+        c--;
+      }
+      mask |= 1u << c;
+      r -= binom(c, i);
+      c--;
+    }
+    return mask;
+  }
+
+  // The index of a position with the mover owning floor(n/2) stones.
+  uint64_t rank(uint32_t mine, uint32_t theirs) const {
+    const uint32_t occupied = mine | theirs;
+    const int n = __builtin_popcount(occupied);
+    uint64_t inner = 0;
+    int j = 0;
+    int t = 0;
+    for (uint32_t o = occupied; o; o &= o - 1, j++) {
+      if (mine & o & (0u - o)) {
+        inner += binom(j, ++t);
+      }
+    }
+    return d_offset[n] + subsetRank(occupied) * binom(n, n / 2) + inner;
+  }
+};
+
+// The k-in-a-row lines of rules as cell masks.
+inline std::vector<uint32_t> tablebaseLines(const Rules &rules) {
+  std::vector<uint32_t> lines;
+  const int dc[4] = {1, 0, 1, 1};
+  const int dr[4] = {0, 1, 1, -1};
+  for (int d = 0; d < 4; d++) {
+    for (int row = 0; row < rules.rows; row++) {
+      for (int col = 0; col < rules.cols; col++) {
+        const int endCol = col + dc[d] * (rules.k - 1);
+        const int endRow = row + dr[d] * (rules.k - 1);
+        if (endCol >= rules.cols || endRow < 0 || endRow >= rules.rows) {
+          continue;
+        }
+        uint32_t line = 0;
+        for (int i = 0; i < rules.k; i++) {
+          line |= 1u << ((col + dc[d] * i) + rules.cols * (row + dr[d] * i));
+        }
+        lines.push_back(line);
+      }
+    }
+  }
+  return lines;
+}
+
+struct TablebaseHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint8_t cols;
+  uint8_t rows;
+  uint8_t k;
+  uint8_t reserved[5];
+  uint64_t count;
+  uint64_t reserved2;
+};
+
+const uint32_t TABLEBASE_MAGIC = 0x42545454;  // "TTTB"
+const uint32_t TABLEBASE_VERSION = 1;
+
+// A tablebase file mapped read-only; probes are a rank and one byte read.
+class Tablebase {
+  void *d_map;
+  size_t d_bytes;
+  Rules d_rules;
+  TablebaseIndex d_index;
+  const uint8_t *d_entries;
+
+ public:
+  Tablebase() : d_map(0), d_bytes(0), d_rules(), d_index(0), d_entries(0) {}
+
+  ~Tablebase() { close(); }
+
+  Tablebase(const Tablebase &) = delete;
+  Tablebase &operator=(const Tablebase &) = delete;
+
+  // False when path is missing or not a whole tablebase of this version.
+  bool open(const char *path) {
+    close();
+    const int fd = ::open(path, O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 ||
+        size_t(st.st_size) < sizeof(TablebaseHeader)) {
+      ::close(fd);
+      return false;
+    }
+    d_bytes = size_t(st.st_size);
+    void *map = ::mmap(0, d_bytes, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (map == MAP_FAILED) {
+      d_bytes = 0;
+      return false;
+    }
+    d_map = map;
+    TablebaseHeader h;
+    memcpy(&h, d_map, sizeof(h));
+    const Rules rules = {h.cols, h.rows, h.k};
+    if (h.magic != TABLEBASE_MAGIC || h.version != TABLEBASE_VERSION ||
+        rules.cells() > TABLEBASE_MAX_CELLS) {
+      close();
+      return false;
+    }
+    d_rules = rules;
+    d_index = TablebaseIndex(rules.cells());
+    if (h.count != d_index.size() ||
+        d_bytes < sizeof(h) + d_index.size()) {
+      close();
+      return false;
+    }
+    d_entries = static_cast<const uint8_t *>(d_map) + sizeof(h);
+    return true;
+  }
+
+  void close() {
+    if (d_map) {
+      ::munmap(d_map, d_bytes);
+    }
+    d_map = 0;
+    d_bytes = 0;
+    d_entries = 0;
+  }
+
+  bool isOpen() const { return d_entries != 0; }
+
+  const Rules &rules() const { return d_rules; }
+
+  uint8_t probe(uint32_t mine, uint32_t theirs) const {
+    return d_entries[d_index.rank(mine, theirs)];
+  }
+
+  // Perfect move for the side owning mine: the fastest win, else a draw,
+  // else the slowest loss. Move -1 when the game is over or the position
+  // is not one of alternating moves.
+  SolvedMove bestMove(uint32_t mine, uint32_t theirs) const {
+    SolvedMove best = {-1, 0, 0};
+    const int n = __builtin_popcount(mine | theirs);
+    if (__builtin_popcount(mine) != n / 2) {
+      return best;
+    }
+    const uint8_t e = probe(mine, theirs);
+    if ((e & 3) == TB_UNREACHABLE || (e >> 2) == 0) {
+      return best;
+    }
+    int bestKey = -1000;
+    for (int c = 0; c < d_rules.cells(); c++) {
+      const uint32_t bit = 1u << c;
+      if ((mine | theirs) & bit) {
+        continue;
+      }
+      // the child is seen from the opponent
+      const uint8_t child = probe(theirs, mine | bit);
+      const int distance = child >> 2;
+      int key;
+      int value;
+      if ((child & 3) == TB_LOSS) {
+        key = 200 - distance;
+        value = 1;
+      } else if ((child & 3) == TB_DRAW) {
+        key = 0;
+        value = 0;
+      } else {
+        key = -200 + distance;
+        value = -1;
+      }
+      if (key > bestKey) {
+        bestKey = key;
+        best.move = c;
+        best.value = value;
+        best.distance = distance + 1;
+      }
+    }
+    return best;
+  }
+
+  // bestMove() of side s on board, which must have rules().
+  SolvedMove bestMove(const KBoard &board, Side s) const {
+    return bestMove(uint32_t(board.bits(s, 0)),
+                    uint32_t(board.bits(otherSide(s), 0)));
+  }
+};
+
+}  // namespace ttt
+
+#endif  // TABLEBASE_H
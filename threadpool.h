@@ -0,0 +1,163 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ttt {
+
+// Work-stealing thread pool: every worker owns a deque, pops its own newest
+// task and steals the oldest task of another worker when it runs dry. Tasks
+// submitted from outside the pool are spread round robin. A pool of zero
+// workers is valid and never runs anything, which is what single-threaded
+// wasm builds get.
+class ThreadPool {
+ public:
+  typedef std::function<void()> Task;
+
+  // Completion counter for a set of tasks.
+  class Group {
+    friend class ThreadPool;
+    std::atomic<int> d_pending;
+
+   public:
+    Group() : d_pending(0) {}
+    bool done() const { return d_pending.load() == 0; }
+  };
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  std::vector<std::unique_ptr<Worker> > d_workers;
+  std::vector<std::thread> d_threads;
+  std::mutex d_sleepMutex;
+  std::condition_variable d_wake;
+  std::atomic<int> d_queued;
+  std::atomic<unsigned> d_next;
+  std::atomic<bool> d_shutdown;
+
+  static int &currentWorker() {
+    static thread_local int index = -1;
+    return index;
+  }
+
+  bool popOwn(int w, Task *task) {
+    Worker &worker = *d_workers[w];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    if (worker.tasks.empty()) {
+      return false;
+    }
+    *task = std::move(worker.tasks.back());
+    worker.tasks.pop_back();
+    return true;
+  }
+
+  bool steal(int thief, Task *task) {
+    const int n = int(d_workers.size());
+    const int start = thief < 0 ? 0 : thief + 1;
+    for (int i = 0; i < n; i++) {
+      Worker &victim = *d_workers[(start + i) % n];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.tasks.empty()) {
+        *task = std::move(victim.tasks.front());
+        victim.tasks.pop_front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool next(int w, Task *task) {
+    if ((w >= 0 && popOwn(w, task)) || steal(w, task)) {
+      d_queued--;
+      return true;
+    }
+    return false;
+  }
+
+  void run(int w) {
+    currentWorker() = w;
+    Task task;
+    while (!d_shutdown.load()) {
+      if (next(w, &task)) {
+        task();
+        task = Task();
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(d_sleepMutex);
+      d_wake.wait_for(lock, std::chrono::milliseconds(10), [this] {
+        return d_shutdown.load() || d_queued.load() > 0;
+      });
+    }
+  }
+
+ public:
+  explicit ThreadPool(int threads)
+      : d_queued(0), d_next(0), d_shutdown(false) {
+    for (int i = 0; i < threads; i++) {
+      d_workers.emplace_back(new Worker());
+    }
+    for (int i = 0; i < threads; i++) {
+      d_threads.emplace_back(&ThreadPool::run, this, i);
+    }
+  }
+
+  ~ThreadPool() {
+    d_shutdown = true;
+    d_wake.notify_all();
+    for (std::thread &t : d_threads) {
+      t.join();
+    }
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  int size() const { return int(d_workers.size()); }
+
+  void submit(Group *group, Task task) {
+    group->d_pending++;
+    Task wrapped = [group, task]() {
+      task();
+      group->d_pending--;
+    };
+    int w = currentWorker();
+    if (w < 0) {
+      w = int(d_next++ % d_workers.size());
+    }
+    {
+      std::lock_guard<std::mutex> lock(d_workers[w]->mutex);
+      d_workers[w]->tasks.push_back(std::move(wrapped));
+    }
+    d_queued++;
+    d_wake.notify_one();
+  }
+
+  // Blocks until every task of the group has run, running queued tasks on
+  // the calling thread meanwhile.
+  void wait(Group *group) {
+    Task task;
+    while (!group->done()) {
+      if (next(currentWorker(), &task)) {
+        task();
+        task = Task();
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }
+};
+
+}  // namespace ttt
+
+#endif  // THREADPOOL_H
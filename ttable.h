@@ -0,0 +1,162 @@
+#ifndef TTABLE_H
+#define TTABLE_H
+
+#include "bitboard.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ttt {
+
+inline uint64_t splitMix64(uint64_t *state) {
+  uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+// Zobrist keys per (cell, side) plus one for O to move. The seed is fixed so
+// every searcher of the same board size agrees on the hashes.
+class Zobrist {
+  std::vector<uint64_t> d_keys;
+  uint64_t d_sideKey;
+
+ public:
+  Zobrist() : d_sideKey(0) {}
+
+  void resize(int cells) {
+    if (int(d_keys.size()) == 2 * cells) {
+      return;
+    }
+    uint64_t state = 0x7474742d7a6f6272ull;
+    d_sideKey = splitMix64(&state);
+    d_keys.resize(2 * cells);
+    for (uint64_t &key : d_keys) {
+      key = splitMix64(&state);
+    }
+  }
+
+  uint64_t key(int idx, Side s) const { return d_keys[2 * idx + s]; }
+
+  uint64_t sideKey() const { return d_sideKey; }
+};
+
+enum Bound {
+  BOUND_NONE = 0,
+  BOUND_UPPER = 1,
+  BOUND_LOWER = 2,
+  BOUND_EXACT = 3
+};
+
+struct TTData {
+  int move;
+  int score;
+  int depth;
+  Bound bound;
+};
+
+// Single-slot, depth-preferred hash table sized by a memory budget, shared
+// lock-free between search threads. Each entry is two relaxed atomic words
+// with the key stored xor'ed with the data, so an entry torn by concurrent
+// writers never validates and is just a miss.
+class TranspositionTable {
+  struct Entry {
+    std::atomic<uint64_t> check;
+    std::atomic<uint64_t> data;
+  };
+
+  std::unique_ptr<Entry[]> d_entries;
+  size_t d_size;
+  uint64_t d_mask;
+  std::atomic<unsigned> d_generation;
+
+  // data layout: move + 1 (16) | score (32) | depth (8) | bound (2) | gen (6)
+  static uint64_t pack(const TTData &d, unsigned gen) {
+    return uint64_t(uint16_t(d.move + 1)) |
+           (uint64_t(uint32_t(d.score)) << 16) |
+           (uint64_t(uint8_t(d.depth)) << 48) |
+           (uint64_t(d.bound & 3) << 56) | (uint64_t(gen & 63) << 58);
+  }
+
+  static TTData unpack(uint64_t data) {
+    TTData d;
+    d.move = int(data & 0xffff) - 1;
+    d.score = int32_t(uint32_t(data >> 16));
+    d.depth = int(uint8_t(data >> 48));
+    d.bound = Bound((data >> 56) & 3);
+    return d;
+  }
+
+  static unsigned generation(uint64_t data) { return unsigned(data >> 58); }
+
+ public:
+  explicit TranspositionTable(size_t bytes = 1 << 20)
+      : d_size(0), d_mask(0), d_generation(0) {
+    resize(bytes);
+  }
+
+  // Rounds the budget down to a power of two number of entries. Not safe
+  // while a search is running.
+  void resize(size_t bytes) {
+    size_t entries = 1;
+    while (entries * 2 * sizeof(Entry) <= bytes) {
+      entries *= 2;
+    }
+    if (entries != d_size) {
+      d_entries.reset(new Entry[entries]);
+      d_size = entries;
+      d_mask = entries - 1;
+    }
+    clear();
+  }
+
+  void clear() {
+    for (size_t i = 0; i < d_size; i++) {
+      d_entries[i].check.store(0, std::memory_order_relaxed);
+      d_entries[i].data.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  // Ages the entries of previous searches so they are replaced first.
+  void newSearch() {
+    d_generation.store((d_generation.load() + 1) & 63,
+                       std::memory_order_relaxed);
+  }
+
+  size_t entries() const { return d_size; }
+
+  size_t bytes() const { return d_size * sizeof(Entry); }
+
+  bool probe(uint64_t key, TTData *out) const {
+    const Entry &e = d_entries[key & d_mask];
+    const uint64_t data = e.data.load(std::memory_order_relaxed);
+    const uint64_t check = e.check.load(std::memory_order_relaxed);
+    if ((check ^ data) != key || data == 0) {
+      return false;
+    }
+    *out = unpack(data);
+    return true;
+  }
+
+  void store(uint64_t key, const TTData &d) {
+    Entry &e = d_entries[key & d_mask];
+    const uint64_t oldData = e.data.load(std::memory_order_relaxed);
+    const uint64_t oldCheck = e.check.load(std::memory_order_relaxed);
+    const unsigned gen = d_generation.load(std::memory_order_relaxed);
+    const bool sameKey = (oldCheck ^ oldData) == key;
+    if (!sameKey && oldData != 0 && generation(oldData) == gen &&
+        unpack(oldData).depth > d.depth) {
+      return;
+    }
+    const uint64_t data = pack(d, gen);
+    e.data.store(data, std::memory_order_relaxed);
+    e.check.store(key ^ data, std::memory_order_relaxed);
+  }
+};
+
+}  // namespace ttt
+
+#endif  // TTABLE_H
@@ -0,0 +1,175 @@
+// The C API of tttapi.h over the header-only rules and engine.
+
+#include "tttapi.h"
+
+#include "batcheval.h"
+#include "engine.h"
+#include "kboard.h"
+#include "mcts.h"
+#include "search.h"
+#include "solved3x3.h"
+#include "tablebase.h"
+
+#include <cstdlib>
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#define TTT_EXPORT extern "C" EMSCRIPTEN_KEEPALIVE
+#else
+#define TTT_EXPORT extern "C" __attribute__((visibility("default")))
+#endif
+
+struct ttt_engine {
+  ttt::Engine engine;
+  ttt::Tablebase tablebase;
+  ttt::KBoard board;  // scratch, reused by every call
+
+  ttt_engine(size_t ttBytes, uint32_t seed, const ttt::SearchLimits &limits)
+      : engine(ttBytes, seed, limits), tablebase(), board() {}
+};
+
+namespace {
+
+// Largest board side the API takes.
+const int MAX_SIDE = 1000;
+
+bool validRules(int cols, int rows, int k) {
+  return cols > 0 && rows > 0 && cols <= MAX_SIDE && rows <= MAX_SIDE &&
+         k > 0 && k <= (cols > rows ? cols : rows);
+}
+
+// 3x3 masks of the side to move and the other one: within the board,
+// disjoint, and as many stones or one fewer, as in alternating play.
+bool validMasks(uint16_t mine, uint16_t theirs) {
+  const int m = __builtin_popcount(mine);
+  const int t = __builtin_popcount(theirs);
+  return ((mine | theirs) & ~ttt::FULL_MASK) == 0 && (mine & theirs) == 0 &&
+         (m == t || m + 1 == t);
+}
+
+void loadBoard(const uint8_t *cells, ttt::KBoard *board) {
+  board->reset();
+  for (int c = 0; c < board->cells(); c++) {
+    if (cells[c] == 1) {
+      board->play(c, ttt::SIDE_X);
+    } else if (cells[c] == 2) {
+      board->play(c, ttt::SIDE_O);
+    }
+  }
+}
+
+// Any k in a row through a stone of s.
+bool hasLine(const ttt::KBoard &board, ttt::Side s) {
+  for (int w = 0; w < board.words(); w++) {
+    for (uint64_t m = board.bits(s, w); m; m &= m - 1) {
+      if (board.lineThrough(w * 64 + ttt::lowestBit64(m), s, 0)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+uint8_t boardStatus(const ttt::KBoard &board) {
+  if (hasLine(board, ttt::SIDE_X)) {
+    return TTT_X_WON;
+  }
+  if (hasLine(board, ttt::SIDE_O)) {
+    return TTT_O_WON;
+  }
+  return board.isFull() ? TTT_DRAW : TTT_OPEN;
+}
+
+}  // namespace
+
+TTT_EXPORT void *ttt_alloc(size_t bytes) { return malloc(bytes); }
+
+TTT_EXPORT void ttt_free(void *p) { free(p); }
+
+TTT_EXPORT ttt_engine *ttt_engine_new(size_t ttBytes, uint32_t seed,
+                                      int maxDepth, double maxSeconds) {
+  const ttt::SearchLimits limits = {maxDepth, maxSeconds, 0};
+  ttt_engine *e = new ttt_engine(ttBytes, seed, limits);
+  const ttt::MctsLimits mcts = {maxSeconds > 0 ? maxSeconds : 1, 0};
+  e->engine.setMctsLimits(mcts);
+  return e;
+}
+
+TTT_EXPORT void ttt_engine_free(ttt_engine *engine) { delete engine; }
+
+TTT_EXPORT int ttt_engine_load_tablebase(ttt_engine *engine,
+                                         const char *path) {
+  if (!engine->tablebase.open(path)) {
+    return 0;
+  }
+  engine->engine.setTablebase(&engine->tablebase);
+  return 1;
+}
+
+TTT_EXPORT void ttt_evaluate_3x3(const uint16_t *x, const uint16_t *o,
+                                 int32_t n, uint8_t *status,
+                                 uint16_t *legal) {
+  ttt::evaluateBatch(x, o, size_t(n), status, legal);
+}
+
+TTT_EXPORT int ttt_solve_3x3(const uint16_t *mine, const uint16_t *theirs,
+                             int32_t n, int8_t *move, int8_t *value,
+                             uint8_t *distance) {
+  int rc = 0;
+  for (int32_t i = 0; i < n; i++) {
+    if (!validMasks(mine[i], theirs[i])) {
+      move[i] = -1;
+      value[i] = TTT_INVALID;
+      distance[i] = 0;
+      rc = -1;
+      continue;
+    }
+    const ttt::SolvedMove m = ttt::solvedMove(mine[i], theirs[i]);
+    move[i] = int8_t(m.move);
+    value[i] = int8_t(m.value);
+    distance[i] = uint8_t(m.distance);
+  }
+  return rc;
+}
+
+TTT_EXPORT int ttt_status(int cols, int rows, int k, const uint8_t *cells,
+                          int32_t n, uint8_t *status) {
+  if (!validRules(cols, rows, k)) {
+    return -1;
+  }
+  ttt::KBoard board(ttt::Rules{cols, rows, k});
+  const size_t cellCount = size_t(board.cells());
+  for (int32_t i = 0; i < n; i++) {
+    loadBoard(cells + size_t(i) * cellCount, &board);
+    status[i] = boardStatus(board);
+  }
+  return 0;
+}
+
+TTT_EXPORT int ttt_best_moves(ttt_engine *engine, int level, int cols,
+                              int rows, int k, const uint8_t *cells,
+                              const uint8_t *toMove, int32_t n, int32_t *move,
+                              int32_t *score) {
+  if (!validRules(cols, rows, k) || level < TTT_EASY || level > TTT_MCTS) {
+    return -1;
+  }
+  ttt::KBoard &board = engine->board;
+  const ttt::Rules rules = {cols, rows, k};
+  if (board.rules() != rules) {
+    board.reset(rules);
+  }
+  const size_t cellCount = size_t(board.cells());
+  for (int32_t i = 0; i < n; i++) {
+    loadBoard(cells + size_t(i) * cellCount, &board);
+    move[i] = -1;
+    score[i] = 0;
+    if (boardStatus(board) == TTT_OPEN) {
+      const ttt::Side s = toMove[i] == 2 ? ttt::SIDE_O : ttt::SIDE_X;
+      const ttt::EngineMove m =
+          engine->engine.move(board, s, ttt::Level(level));
+      move[i] = m.move;
+      score[i] = m.score;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,83 @@
+#ifndef TTTAPI_H
+#define TTTAPI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The rules and the engine as a C API over caller arrays, for bulk
+// analysis without the game: every call takes a batch of boards and writes
+// one result per board into arrays the caller owns. Under Emscripten the
+// functions are exported from dist/engine.js, so JS fills typed-array views
+// of the module's memory (see ttt_alloc()) and reads the results back in
+// place; natively the same functions link from the tic-tac-toe-engine
+// library. Calls on different engines may run on different threads.
+//
+// Boards of any size come as cols * rows bytes each, cell col + cols * row,
+// 0 empty, 1 X, 2 O. 3x3 boards can also come as two 9-bit masks.
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Board status, as ttt::BoardStatus.
+enum {
+  TTT_OPEN = 0,
+  TTT_X_WON = 1,
+  TTT_O_WON = 2,
+  TTT_DRAW = 3
+};
+
+// Engine levels, as ttt::Level.
+enum { TTT_EASY = 0, TTT_HARD = 1, TTT_MCTS = 2 };
+
+typedef struct ttt_engine ttt_engine;
+
+// Memory for arrays shared with JS; natively plain malloc() and free().
+void *ttt_alloc(size_t bytes);
+void ttt_free(void *p);
+
+// An engine with a transposition table of ttBytes. Hard moves outside the
+// solved tables search to maxDepth plies (0 to the end) for at most
+// maxSeconds (0 no limit); MCTS moves take maxSeconds, or 1 s if 0.
+ttt_engine *ttt_engine_new(size_t ttBytes, uint32_t seed, int maxDepth,
+                           double maxSeconds);
+void ttt_engine_free(ttt_engine *engine);
+
+// Perfect play on boards of its size from a tic-tac-toe-tablebase file; 0
+// when path is not one.
+int ttt_engine_load_tablebase(ttt_engine *engine, const char *path);
+
+// status[i] and legal[i], the empty cells while open, of the 3x3 boards
+// x[i], o[i], with SIMD where available.
+void ttt_evaluate_3x3(const uint16_t *x, const uint16_t *o, int32_t n,
+                      uint8_t *status, uint16_t *legal);
+
+// Value of ttt_solve_3x3() for a board it does not take.
+enum { TTT_INVALID = -2 };
+
+// Perfect play of the side owning mine[i] against theirs[i]: the move, -1
+// when the game is over, the value 1 win, 0 draw, -1 loss, and the plies
+// to the end of the game. Each pair must be 9-bit masks without common
+// cells, mine with as many stones as theirs or one fewer; any other gets
+// move -1, value TTT_INVALID and distance 0. 0 when every board was
+// valid, else -1.
+int ttt_solve_3x3(const uint16_t *mine, const uint16_t *theirs, int32_t n,
+                  int8_t *move, int8_t *value, uint8_t *distance);
+
+// status[i] of n boards of cols x rows with k in a row to win; X is
+// tested first. 0 on success, -1 when the rules are not valid.
+int ttt_status(int cols, int rows, int k, const uint8_t *cells, int32_t n,
+               uint8_t *status);
+
+// The move of the engine at level for toMove[i] (1 X, 2 O) on board i,
+// -1 when it is over, and its score: solved value, search score or MCTS
+// win rate in per mille. 0 on success, -1 when the rules are not valid.
+int ttt_best_moves(ttt_engine *engine, int level, int cols, int rows, int k,
+                   const uint8_t *cells, const uint8_t *toMove, int32_t n,
+                   int32_t *move, int32_t *score);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TTTAPI_H
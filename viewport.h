@@ -0,0 +1,195 @@
+#ifndef VIEWPORT_H
+#define VIEWPORT_H
+
+#include <algorithm>
+
+namespace ttt {
+
+// Pixel size of a cell below which the view does not zoom out; it bounds
+// the cells drawn per frame by the window size, not the board size.
+const int MIN_CELL_PIXELS = 6;
+// Cell size a new game starts at when the whole board would be smaller.
+const int DEFAULT_CELL_PIXELS = 36;
+// Cell size the view zooms in to at most, unless the board fits larger.
+const int MAX_CELL_PIXELS = 160;
+
+// The part of a cols x rows board shown in a window: a zoom and the screen
+// position of the board's top left corner. Cell rectangles are derived
+// from those, hit-testing is a division and the visible cells are a range,
+// so nothing here grows with the board. Integer pixels throughout.
+class Viewport {
+  int d_cols;
+  int d_rows;
+  int d_width;  // of the window
+  int d_height;
+  int d_fitWidth;  // of a cell with the whole board in the window
+  int d_fitHeight;
+  int d_zoom;  // percent of the fit size
+  int d_cellWidth;
+  int d_cellHeight;
+  int d_originX;
+  int d_originY;
+
+  static int floorDiv(int a, int b) {
+    return a >= 0 ? a / b : -((b - 1 - a) / b);
+  }
+
+  int minZoom() const {
+    const int fit = std::min(d_fitWidth, d_fitHeight);
+    return std::max(100, (MIN_CELL_PIXELS * 100 + fit - 1) / fit);
+  }
+
+  int maxZoom() const {
+    const int fit = std::min(d_fitWidth, d_fitHeight);
+    return std::max(minZoom(), MAX_CELL_PIXELS * 100 / fit);
+  }
+
+  // Centered on an axis where the board fits, else never past its edges.
+  static int clampOrigin(int origin, int board, int window) {
+    if (board <= window) {
+      return (window - board) / 2;
+    }
+    return std::min(0, std::max(window - board, origin));
+  }
+
+  void clamp() {
+    d_originX = clampOrigin(d_originX, d_cols * d_cellWidth, d_width);
+    d_originY = clampOrigin(d_originY, d_rows * d_cellHeight, d_height);
+  }
+
+  void fitWindow(int width, int height) {
+    d_width = std::max(1, width);
+    d_height = std::max(1, height);
+    d_fitWidth = std::max(1, d_width / d_cols);
+    d_fitHeight = std::max(1, d_height / d_rows);
+  }
+
+  void applyZoom(int zoom) {
+    d_zoom = std::max(minZoom(), std::min(maxZoom(), zoom));
+    d_cellWidth = std::max(1, d_fitWidth * d_zoom / 100);
+    d_cellHeight = std::max(1, d_fitHeight * d_zoom / 100);
+  }
+
+  // Sets the zoom keeping the board point under window pixel (x, y) there.
+  void setZoom(int zoom, int x, int y) {
+    const double bx = double(x - d_originX) / d_cellWidth;
+    const double by = double(y - d_originY) / d_cellHeight;
+    applyZoom(zoom);
+    d_originX = x - int(bx * d_cellWidth + 0.5);
+    d_originY = y - int(by * d_cellHeight + 0.5);
+    clamp();
+  }
+
+ public:
+  Viewport()
+      : d_cols(1),
+        d_rows(1),
+        d_width(1),
+        d_height(1),
+        d_fitWidth(1),
+        d_fitHeight(1),
+        d_zoom(100),
+        d_cellWidth(1),
+        d_cellHeight(1),
+        d_originX(0),
+        d_originY(0) {}
+
+  // A new board: all of it in view, or its center at DEFAULT_CELL_PIXELS
+  // when that would be smaller.
+  void reset(int cols, int rows, int width, int height) {
+    d_cols = cols;
+    d_rows = rows;
+    fitWindow(width, height);
+    applyZoom(100);
+    d_originX = 0;
+    d_originY = 0;
+    clamp();
+    const int fit = std::min(d_fitWidth, d_fitHeight);
+    if (fit < DEFAULT_CELL_PIXELS) {
+      const int zoom = (DEFAULT_CELL_PIXELS * 100 + fit - 1) / fit;
+      setZoom(zoom, d_width / 2, d_height / 2);
+    }
+  }
+
+  // A new window size, keeping the zoom and the board point at the center.
+  void resize(int width, int height) {
+    if (width == d_width && height == d_height) {
+      return;
+    }
+    const double bx = double(d_width / 2 - d_originX) / d_cellWidth;
+    const double by = double(d_height / 2 - d_originY) / d_cellHeight;
+    fitWindow(width, height);
+    applyZoom(d_zoom);
+    d_originX = d_width / 2 - int(bx * d_cellWidth + 0.5);
+    d_originY = d_height / 2 - int(by * d_cellHeight + 0.5);
+    clamp();
+  }
+
+  int cellWidth() const { return d_cellWidth; }
+  int cellHeight() const { return d_cellHeight; }
+  int cellX(int col) const { return d_originX + col * d_cellWidth; }
+  int cellY(int row) const { return d_originY + row * d_cellHeight; }
+
+  // The cell under window pixel (x, y); false off the board.
+  bool cellAt(int x, int y, int *col, int *row) const {
+    const int c = floorDiv(x - d_originX, d_cellWidth);
+    const int r = floorDiv(y - d_originY, d_cellHeight);
+    if (c < 0 || r < 0 || c >= d_cols || r >= d_rows) {
+      return false;
+    }
+    *col = c;
+    *row = r;
+    return true;
+  }
+
+  // Cells at least partly in the window: [*col0, *col1) x [*row0, *row1).
+  void visible(int *col0, int *row0, int *col1, int *row1) const {
+    *col0 = std::max(0, floorDiv(-d_originX, d_cellWidth));
+    *row0 = std::max(0, floorDiv(-d_originY, d_cellHeight));
+    const int lastCol = floorDiv(d_width - 1 - d_originX, d_cellWidth);
+    const int lastRow = floorDiv(d_height - 1 - d_originY, d_cellHeight);
+    *col1 = std::min(d_cols, lastCol + 1);
+    *row1 = std::min(d_rows, lastRow + 1);
+  }
+
+  // Moves the board by (dx, dy) pixels; false when it cannot move.
+  bool pan(int dx, int dy) {
+    const int x = d_originX;
+    const int y = d_originY;
+    d_originX += dx;
+    d_originY += dy;
+    clamp();
+    return x != d_originX || y != d_originY;
+  }
+
+  // Zooms in by steps of 25% (out when negative) around window pixel
+  // (x, y); false when already at the limit.
+  bool zoom(int steps, int x, int y) {
+    int z = d_zoom;
+    for (int i = 0; i < steps; i++) {
+      z = z * 5 / 4;
+    }
+    for (int i = 0; i > steps; i--) {
+      z = z * 4 / 5;
+    }
+    const int before = d_zoom;
+    setZoom(z, x, y);
+    return d_zoom != before;
+  }
+
+  // Pans so that the cell is wholly in view, centering it if it was not.
+  bool reveal(int col, int row) {
+    const int x = cellX(col);
+    const int y = cellY(row);
+    if (x >= 0 && y >= 0 && x + d_cellWidth <= d_width &&
+        y + d_cellHeight <= d_height) {
+      return false;
+    }
+    return pan(d_width / 2 - x - d_cellWidth / 2,
+               d_height / 2 - y - d_cellHeight / 2);
+  }
+};
+
+}  // namespace ttt
+
+#endif  // VIEWPORT_H
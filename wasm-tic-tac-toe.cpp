@@ -8,85 +8,277 @@
 #include <SDL_ttf.h>
 #endif
 
-#include "resources/RedO_bmp.h"
-#include "resources/RedX_bmp.h"
-#include "resources/RobotoMono_Regular_ttf.h"
+#include "resources/RedO_qoi.h"
+#include "resources/RedX_qoi.h"
+#include "resources/RobotoMono_Regular_subset_ttf.h"
 
+#ifdef TTT_ALLOC_CHECK
+#include "alloccount.h"
+#endif
+#include "aiworker.h"
+#include "broadcast.h"
+#include "engine.h"
+#include "frametiming.h"
+#include "game.h"
+#include "gamerecord.h"
+#include "kboard.h"
+#include "log.h"
+#include "qoi.h"
+#include "tablebase.h"
+#include "threadpool.h"
+#include "viewport.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 namespace {
-const int NUM_COLS = 3;
-const int NUM_ROWS = 3;
+struct BoardVariant {
+  ttt::Rules rules;
+  const char *name;
+};
+
+// Board variants cycled on the splash screen with [b].
+const BoardVariant BOARD_VARIANTS[] = {
+    {ttt::RULES_3X3, "Board 3x3 [b]"},
+    {ttt::RULES_4X4, "Board 4x4, 4 in a row [b]"},
+    {ttt::RULES_15X15, "Board 15x15, 5 in a row [b]"},
+    {ttt::RULES_19X19, "Board 19x19, 5 in a row [b]"},
+    {ttt::RULES_100X100, "Board 100x100, 5 in a row [b]"},
+};
+const int NUM_BOARD_VARIANTS = 5;
+
+// Memory budget of the search transposition table.
+const size_t TT_BYTES = 16 << 20;
+// Think time per computer move on boards the search cannot solve.
+const double MOVE_SECONDS = 0.5;
+// Deltas a spectator of --broadcast may fall behind before it rejoins.
+const uint32_t BROADCAST_CAPACITY = 1 << 12;
+// Think time per frame where there are no threads, the move then takes
+// MOVE_SECONDS of wall clock at a steady frame rate.
+const double THINK_SLICE_SECONDS = 0.008;
+// Upper bound on search threads, the caller included.
+const int MAX_SEARCH_THREADS = 8;
+// Longest native sleep waiting for input, bounds how late a resize that
+// came without an event is noticed.
+const int IDLE_WAIT_MS = 250;
+// Native wait for input while the computer thinks, bounds how late its
+// move is shown.
+const int THINKING_WAIT_MS = 10;
+
+// Helper threads for the parallel search: none on single-threaded wasm,
+// otherwise one less than the cores (the game thread searches too).
+int searchHelpers() {
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+  return 0;
+#else
+  int cores = static_cast<int>(std::thread::hardware_concurrency());
+  cores = cores < MAX_SEARCH_THREADS ? cores : MAX_SEARCH_THREADS;
+  return cores > 1 ? cores - 1 : 0;
+#endif
+}
 
 enum CellState { CELL_EMPTY = ' ', CELL_X = 'X', CELL_O = 'O' };
 
 CellState switchXO(CellState c) { return c == CELL_X ? CELL_O : CELL_X; }
 
-struct Cell {
-  int x;
-  int y;
-  int w;
-  int h;
-  CellState state;
+ttt::Side toSide(CellState c) {
+  return c == CELL_X ? ttt::SIDE_X : ttt::SIDE_O;
+}
+
+// Cells the arrow keys pan the board by.
+const int PAN_KEY_CELLS = 4;
+
+// Font size of all text, in points.
+const int FONT_SIZE = 36;
+// Font size of the frame timing HUD.
+const int HUD_FONT_SIZE = 14;
+// Rendered frames between HUD refreshes.
+const uint64_t HUD_REFRESH_FRAMES = 30;
+#ifdef TTT_FRAME_TIMING
+// HUD lines: a heading and one per frame phase.
+const int HUD_LINES = 1 + ttt::NUM_FRAME_PHASES;
+#endif
+// Text textures kept before the cache starts over.
+const size_t TEXT_CACHE_ENTRIES = 256;
+
+// Texture coordinates of one image in the piece atlas.
+struct AtlasRect {
+  float u0;
+  float v0;
+  float u1;
+  float v1;
+};
+
+// Rendered text textures keyed by string, color and font size, so steady
+// state text drawing neither rasterizes nor allocates. Owns the textures;
+// invalidate() when the renderer, the window size or the font changes.
+class TextCache {
+ public:
+  struct Text {
+    ::SDL_Texture *texture;
+    int w;
+    int h;
+  };
 
-  Cell() : x(0), y(0), w(0), h(0), state(CELL_EMPTY) {}
+ private:
+  struct Entry {
+    Text text;
+    std::string string;
+    ::SDL_Color color;
+    int fontSize;
+  };
 
-  void resize(int tx, int ty, int tw, int th) {
-    x = tx;
-    y = ty;
-    w = tw;
-    h = th;
+  std::unordered_map<uint64_t, Entry> d_entries;
+  uint64_t d_hits;
+  uint64_t d_misses;
+
+  static uint64_t hashOf(const char *s, const ::SDL_Color &c, int fontSize) {
+    // FNV-1a
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (; *s; s++) {
+      h = (h ^ static_cast<unsigned char>(*s)) * 0x100000001b3ull;
+    }
+    const uint64_t tail = (uint64_t(c.r) << 24 | uint64_t(c.g) << 16 |
+                           uint64_t(c.b) << 8 | uint64_t(c.a)) ^
+                          (uint64_t(fontSize) << 32);
+    return (h ^ tail) * 0x100000001b3ull;
   }
 
-  bool inRange(int mx, int my) {
-    return mx > x && mx < x + w && my > y && my < y + h;
+  static void destroy(Entry *e) {
+    if (e->text.texture) {
+      ::SDL_DestroyTexture(e->text.texture);
+      e->text.texture = 0;
+    }
   }
 
-  void reset() { state = CELL_EMPTY; }
+ public:
+  TextCache() : d_entries(), d_hits(0), d_misses(0) {}
+
+  ~TextCache() { invalidate(); }
+
+  TextCache(const TextCache &) = delete;
+  TextCache &operator=(const TextCache &) = delete;
+
+  uint64_t hits() const { return d_hits; }
+
+  uint64_t misses() const { return d_misses; }
+
+  size_t size() const { return d_entries.size(); }
+
+  void invalidate() {
+    for (auto &kv : d_entries) {
+      destroy(&kv.second);
+    }
+    d_entries.clear();
+  }
+
+  // The texture of text, rendered on a miss; texture is 0 if that failed.
+  Text get(::SDL_Renderer *renderer, ::TTF_Font *font, int fontSize,
+           const char *text, const ::SDL_Color &color) {
+    const uint64_t key = hashOf(text, color, fontSize);
+    std::unordered_map<uint64_t, Entry>::iterator it = d_entries.find(key);
+    if (it != d_entries.end()) {
+      const Entry &e = it->second;
+      if (e.string == text && e.fontSize == fontSize && e.color.r == color.r &&
+          e.color.g == color.g && e.color.b == color.b &&
+          e.color.a == color.a) {
+        d_hits++;
+        return e.text;
+      }
+      destroy(&it->second);
+      d_entries.erase(it);
+    }
+
+    d_misses++;
+    if (d_entries.size() >= TEXT_CACHE_ENTRIES) {
+      invalidate();
+    }
+    Entry e;
+    e.text.texture = 0;
+    e.text.w = 0;
+    e.text.h = 0;
+    e.string = text;
+    e.color = color;
+    e.fontSize = fontSize;
+    SDL_Surface *surf = ::TTF_RenderText_Solid(font, text, color);
+    if (surf) {
+      e.text.texture = ::SDL_CreateTextureFromSurface(renderer, surf);
+      e.text.w = surf->w;
+      e.text.h = surf->h;
+      ::SDL_FreeSurface(surf);
+    }
+    d_entries[key] = e;
+    return e.text;
+  }
 };
 
 class TicTacToe {
  private:
-  enum WinnerLine {
-    NONE,
-    VERTICAL_LEFT,
-    VERTICAL_MID,
-    VERTICAL_RIGHT,
-    HORIZONTAL_TOP,
-    HORIZONTAL_MID,
-    HORIZONTAL_BOTTOM,
-    DIAGONAL_TOPLEFT,
-    DIAGONAL_BOTTOMLEFT
-  };
-
   int d_display_width;
   int d_display_height;
 
   ::SDL_Window *d_window;
   ::SDL_Renderer *d_renderer;
 
-  ::SDL_Surface *d_RedX_Surface;
-  ::SDL_Texture *d_RedX_Texture;
-
-  ::SDL_Surface *d_RedO_Surface;
-  ::SDL_Texture *d_RedO_Texture;
+  // X, O and a solid white block in one texture, so the whole board is a
+  // single SDL_RenderGeometry call whatever its size
+  ::SDL_Texture *d_atlas;
+  AtlasRect d_atlasX;
+  AtlasRect d_atlasO;
+  AtlasRect d_atlasSolid;
+  std::vector<SDL_Vertex> d_vertices;
+  std::vector<int> d_indices;
 
   ::TTF_Font *d_ttf_font;
+  int d_fontSize;
+  TextCache d_textCache;
 
   ::SDL_Color d_textColor;
   ::SDL_Color d_background;
 
-  Cell d_board[3][3];
+  ttt::Viewport d_viewport;
+  ttt::Game d_game;
+  int d_boardVariant;
+  uint64_t d_seed;  // of the engine
+  ttt::RecordLog d_recordLog;
+  std::unique_ptr<ttt::RecordWriter> d_recordWriter;  // when recording
+  ttt::Tablebase d_tablebase;
+  ttt::BroadcastWriter d_broadcast;  // open when broadcasting
+  ttt::ThreadPool d_searchPool;
+  ttt::Engine d_engine;
+  ttt::AiWorker d_aiWorker;
+  ttt::AiReply d_aiReply;
+  uint64_t d_aiRequest;
 
   CellState d_firstMove;
   CellState d_computerPlays;
-  bool d_hardLevel;
-  CellState d_currentPlayer;
+  ttt::Level d_level;
+  bool d_thinking;
   bool d_gameInProgress;
-  bool d_gameFinished;
-  CellState d_gameWinner;
-  WinnerLine d_winnerLine;
+#ifdef TTT_FRAME_TIMING
+  ttt::FrameTiming d_frameTiming;
+  bool d_hudVisible;
+  ::TTF_Font *d_hudFont;
+  // formatted and rendered in place, so refreshes allocate nothing
+  struct HudLine {
+    char text[64];
+    TextCache::Text texture;
+  };
+  HudLine d_hudLines[HUD_LINES];
+#endif
+#ifdef TTT_ALLOC_CHECK
+  uint64_t d_frameAllocations;
+#endif
+  bool d_dirty;
 
  public:
   TicTacToe()
@@ -94,154 +286,151 @@ class TicTacToe {
         d_display_height(720),
         d_window(0),
         d_renderer(0),
-        d_RedX_Surface(0),
-        d_RedX_Texture(0),
-        d_RedO_Surface(0),
-        d_RedO_Texture(0),
+        d_atlas(0),
+        d_atlasX(),
+        d_atlasO(),
+        d_atlasSolid(),
+        d_vertices(),
+        d_indices(),
         d_ttf_font(0),
+        d_fontSize(FONT_SIZE),
+        d_textCache(),
         d_textColor(),
         d_background(),
-        d_board(),
+        d_viewport(),
+        d_game(BOARD_VARIANTS[0].rules),
+        d_boardVariant(0),
+        d_seed(static_cast<uint64_t>(time(0))),
+        d_recordLog(),
+        d_recordWriter(),
+        d_tablebase(),
+        d_broadcast(),
+        d_searchPool(searchHelpers()),
+        d_engine(TT_BYTES, d_seed, ttt::SearchLimits{0, MOVE_SECONDS, 0},
+                 &d_searchPool),
+        d_aiWorker(&d_engine),
+        d_aiReply(),
+        d_aiRequest(0),
         d_firstMove(CELL_O),
         d_computerPlays(CELL_O),
-        d_hardLevel(true),
-        d_currentPlayer(CELL_EMPTY),
+        d_level(ttt::LEVEL_HARD),
+        d_thinking(false),
         d_gameInProgress(false),
-        d_gameFinished(false),
-        d_winnerLine(NONE) {
+#ifdef TTT_FRAME_TIMING
+        d_frameTiming(),
+        d_hudVisible(false),
+        d_hudFont(0),
+        d_hudLines(),
+#endif
+#ifdef TTT_ALLOC_CHECK
+        d_frameAllocations(0),
+#endif
+        d_dirty(true) {
+    d_aiWorker.setSliceSeconds(THINK_SLICE_SECONDS);
     textColor();
     background();
-    setBoardSize(d_display_width, d_display_height);
 
     initGame();
   }
 
-  ~TicTacToe() { ::SDL_Quit(); }
-
-  WinnerLine getWinnerLine(CellState s) {
-    if ((cellState(0, 0) == s && cellState(0, 1) == s &&
-         cellState(0, 2) == s)) {
-      return VERTICAL_LEFT;
-    }
-    if ((cellState(1, 2) == s && cellState(1, 1) == s &&
-         cellState(1, 0) == s)) {
-      return VERTICAL_MID;
-    }
-    if ((cellState(2, 2) == s && cellState(2, 1) == s &&
-         cellState(2, 0) == s)) {
-      return VERTICAL_RIGHT;
-    }
-    if ((cellState(0, 0) == s && cellState(1, 0) == s &&
-         cellState(2, 0) == s)) {
-      return HORIZONTAL_TOP;
-    }
-    if ((cellState(0, 1) == s && cellState(1, 1) == s &&
-         cellState(2, 1) == s)) {
-      return HORIZONTAL_MID;
-    }
-    if ((cellState(0, 2) == s && cellState(1, 2) == s &&
-         cellState(2, 2) == s)) {
-      return HORIZONTAL_BOTTOM;
-    }
-    if ((cellState(0, 0) == s && cellState(1, 1) == s &&
-         cellState(2, 2) == s)) {
-      return DIAGONAL_TOPLEFT;
-    }
-    if ((cellState(0, 2) == s && cellState(1, 1) == s &&
-         cellState(2, 0) == s)) {
-      return DIAGONAL_BOTTOMLEFT;
-    }
-    return NONE;
+  ~TicTacToe() {
+    d_textCache.invalidate();
+#ifdef TTT_FRAME_TIMING
+    hudClear();
+#endif
+    ::SDL_Quit();
   }
 
-  int boardCount() {
-    int cnt = 0;
-    for (int col = 0; col < NUM_COLS; col++) {
-      for (int row = 0; row < NUM_ROWS; row++) {
-        if (cellState(col, row) != CELL_EMPTY) {
-          cnt++;
-        }
-      }
-    }
-    return cnt;
+  bool computerToMove() const {
+    return d_gameInProgress && !d_game.finished() &&
+           d_game.toMove() == toSide(d_computerPlays);
   }
 
-  bool isBoardFull() {
-    for (int col = 0; col < NUM_COLS; col++) {
-      for (int row = 0; row < NUM_ROWS; row++) {
-        if (cellState(col, row) == CELL_EMPTY) {
-          return false;
-        }
-      }
+  // Hands the position to the AI worker and plays its move once one is
+  // ready; frames keep coming meanwhile.
+  void makeComputerMove() {
+    if (!computerToMove()) {
+      return;
     }
-    return true;
-  }
-
-  void checkEndofGame() {
-    if (!d_gameFinished) {
-      WinnerLine winnerLine = getWinnerLine(CELL_X);
-      if (NONE != winnerLine) {
-        std::cout << "Winner X" << std::endl;
-        d_gameWinner = CELL_X;
-        d_winnerLine = winnerLine;
-        d_gameFinished = true;
-      } else {
-        WinnerLine winnerLine = getWinnerLine(CELL_O);
-        if (NONE != winnerLine) {
-          std::cout << "Winner O" << std::endl;
-          d_gameWinner = CELL_O;
-          d_winnerLine = winnerLine;
-          d_gameFinished = true;
-        } else if (isBoardFull()) {
-          std::cout << "No more moves" << std::endl;
-          d_gameWinner = CELL_EMPTY;
-          d_winnerLine = NONE;
-          d_gameFinished = true;
-        }
-      }
+    if (!d_thinking) {
+      d_aiRequest = d_aiWorker.submit(d_game.board(), d_game.toMove(),
+                                      d_level);
+      d_thinking = true;
+      d_dirty = true;
+      return;
+    }
+    if (!d_aiWorker.poll(&d_aiReply)) {
+      return;
     }
+    d_thinking = false;
+    d_dirty = true;
+    computerMove(d_aiReply);
   }
 
-  void makeComputerMove() {
-    if (d_gameInProgress && !d_gameFinished) {
-      if (d_currentPlayer == d_computerPlays) {
-        if (d_hardLevel) {
-          advancedMove(d_computerPlays);
-        } else {
-          randomMove(d_computerPlays);
-        }
-        d_currentPlayer = switchXO(d_computerPlays);
-      }
+  // Drops the move the computer is thinking about, if any.
+  void cancelThinking() {
+    if (d_thinking) {
+      TTT_LOG_INFO("move_cancelled", {"request", d_aiRequest});
+      d_aiWorker.cancel();
+      d_thinking = false;
     }
-
-    checkEndofGame();
   }
 
+  // The left button plays, the others drag the board.
   void mousePressed(const SDL_Event &event) {
     const int mouseX = event.button.x;
     const int mouseY = event.button.y;
-    if (d_gameInProgress && !d_gameFinished) {
+    if (event.button.button == SDL_BUTTON_LEFT && d_gameInProgress &&
+        !d_game.finished() && !computerToMove()) {
       cellClick(mouseX, mouseY);
     }
+  }
+
+  bool mouseMoved(const SDL_Event &event) {
+    if (!d_gameInProgress ||
+        !(event.motion.state & (SDL_BUTTON_RMASK | SDL_BUTTON_MMASK))) {
+      return false;
+    }
+    return d_viewport.pan(event.motion.xrel, event.motion.yrel);
+  }
 
-    checkEndofGame();
+  // Zooms around the mouse pointer.
+  bool mouseWheel(const SDL_Event &event) {
+    if (!d_gameInProgress || event.wheel.y == 0) {
+      return false;
+    }
+    int x = 0;
+    int y = 0;
+    ::SDL_GetMouseState(&x, &y);
+    return d_viewport.zoom(event.wheel.y > 0 ? 1 : -1, x, y);
   }
 
   void keyPressed(const SDL_Event &event) {
     const SDL_Keycode sym = event.key.keysym.sym;
 
+#ifdef TTT_FRAME_TIMING
+    if (sym == SDLK_t) {
+      d_hudVisible = !d_hudVisible;
+      return;
+    }
+    if (sym == SDLK_d) {
+      frameTimingDump();
+      return;
+    }
+#endif
+
     if (!d_gameInProgress) {
       if (sym == SDLK_SPACE) {
-        std::cout << "Start of game" << std::endl;
+        TTT_LOG_INFO("game_start",
+                     {"board", BOARD_VARIANTS[d_boardVariant].name});
         d_gameInProgress = true;
-        d_gameFinished = false;
         initGame();
         return;
       }
 
       if (sym == SDLK_c) {
         if (d_firstMove != d_computerPlays) {
-          std::cout << "Computer first" << std::endl;
+          TTT_LOG_INFO("first_move", {"player", "computer"});
         }
         d_firstMove = d_computerPlays;
         return;
@@ -249,392 +438,294 @@ class TicTacToe {
 
       if (sym == SDLK_p) {
         if (d_firstMove == d_computerPlays) {
-          std::cout << "Human first" << std::endl;
+          TTT_LOG_INFO("first_move", {"player", "human"});
         }
         d_firstMove = switchXO(d_computerPlays);
         return;
       }
 
       if (sym == SDLK_h) {
-        if (!d_hardLevel) {
-          std::cout << "Hard Level" << std::endl;
+        if (d_level != ttt::LEVEL_HARD) {
+          TTT_LOG_INFO("level", {"level", "hard"});
         }
-        d_hardLevel = true;
+        d_level = ttt::LEVEL_HARD;
         return;
       }
 
       if (sym == SDLK_e) {
-        if (d_hardLevel) {
-          std::cout << "Easy Level" << std::endl;
+        if (d_level != ttt::LEVEL_EASY) {
+          TTT_LOG_INFO("level", {"level", "easy"});
+        }
+        d_level = ttt::LEVEL_EASY;
+        return;
+      }
+
+      if (sym == SDLK_m) {
+        if (d_level != ttt::LEVEL_MCTS) {
+          TTT_LOG_INFO("level", {"level", "mcts"});
         }
-        d_hardLevel = false;
+        d_level = ttt::LEVEL_MCTS;
+        return;
+      }
+
+      if (sym == SDLK_b) {
+        d_boardVariant = (d_boardVariant + 1) % NUM_BOARD_VARIANTS;
+        initGame();
         return;
       }
     } else {
       if (sym == SDLK_n) {
-        std::cout << "New game" << std::endl;
+        TTT_LOG_INFO("game_start",
+                     {"board", BOARD_VARIANTS[d_boardVariant].name});
         d_gameInProgress = true;
-        d_gameFinished = false;
         initGame();
         return;
       }
       if (sym == SDLK_q) {
-        std::cout << "Quit game" << std::endl;
+        TTT_LOG_INFO("game_quit");
         d_gameInProgress = false;
-        d_gameFinished = false;
         initGame();
         return;
       }
+      const int panX = PAN_KEY_CELLS * d_viewport.cellWidth();
+      const int panY = PAN_KEY_CELLS * d_viewport.cellHeight();
+      if (sym == SDLK_LEFT) {
+        d_viewport.pan(panX, 0);
+      } else if (sym == SDLK_RIGHT) {
+        d_viewport.pan(-panX, 0);
+      } else if (sym == SDLK_UP) {
+        d_viewport.pan(0, panY);
+      } else if (sym == SDLK_DOWN) {
+        d_viewport.pan(0, -panY);
+      } else if (sym == SDLK_EQUALS || sym == SDLK_PLUS ||
+                 sym == SDLK_KP_PLUS) {
+        d_viewport.zoom(1, d_display_width / 2, d_display_height / 2);
+      } else if (sym == SDLK_MINUS || sym == SDLK_KP_MINUS) {
+        d_viewport.zoom(-1, d_display_width / 2, d_display_height / 2);
+      }
     }
   }
 
-  int boardIndex(int col, int row) { return col + NUM_ROWS * row; }
+  int boardIndex(int col, int row) { return d_game.board().index(col, row); }
 
-  void makeMove(int idx, CellState p) {
-    // 0[0,0], 1[1,0], 2[2,0]
-    // 3[0,1], 4[1,1], 5[2,1]
-    // 6[0,2], 7[1,2], 8[2,2]
-    switch (idx) {
-      case 0:
-        setCellState(0, 0, p);  // top left
-        break;
-      case 1:
-        setCellState(1, 0, p);
-        break;
-      case 2:
-        setCellState(2, 0, p);  // top right
-        break;
-      case 3:
-        setCellState(0, 1, p);
-        break;
-      case 4:
-        setCellState(1, 1, p);  // center
-        break;
-      case 5:
-        setCellState(2, 1, p);
-        break;
-      case 6:
-        setCellState(0, 2, p);  // bottom left
-        break;
-      case 7:
-        setCellState(1, 2, p);
-        break;
-      case 8:
-        setCellState(2, 2, p);  // bottom right
-        break;
+  // Appends every game from now on to the record file at path.
+  bool record(const char *path) {
+    if (!d_recordLog.open(path)) {
+      return false;
     }
+    d_recordWriter.reset(new ttt::RecordWriter(&d_recordLog));
+    recordBegin();
+    return true;
   }
 
-  void makeRandomMoveFromList(const std::vector<int> &a, CellState p) {
-    const int r = rand() % a.size();
-    makeMove(a[r], p);
-  }
-
-  bool pickCorner(const CellState &p, bool force) {
-    // Try to take one of the corners, if they are free and no moves
-    // 0[0,0], 1[1,0], 2[2,0]
-    // 3[0,1], 4[1,1], 5[2,1]
-    // 6[0,2], 7[1,2], 8[2,2]
-    std::vector<int> corners;
-    if (cellState(0, 0) == CELL_EMPTY) {
-      corners.push_back(boardIndex(0, 0));
-    }
-    if (cellState(2, 0) == CELL_EMPTY) {
-      corners.push_back(boardIndex(2, 0));
-    }
-    if (cellState(0, 2) == CELL_EMPTY) {
-      corners.push_back(boardIndex(0, 2));
-    }
-    if (cellState(2, 2) == CELL_EMPTY) {
-      corners.push_back(boardIndex(2, 2));
-    }
-    if (!force && 4 != corners.size()) {
-      return false;
-    }
-    if (corners.empty()) {
+  // Plays hard moves on the tablebase's board from the file at path.
+  bool tablebase(const char *path) {
+    if (!d_tablebase.open(path)) {
       return false;
     }
-    makeRandomMoveFromList(corners, p);
-    std::cout << "Take a corner" << std::endl;
+    d_engine.setTablebase(&d_tablebase);
     return true;
   }
 
-  bool pickCenter(const CellState &p) {
-    // Try to take the center, if it is free.
-    if (cellState(1, 1) == CELL_EMPTY) {
-      // make a move
-      setCellState(1, 1, p);
-      std::cout << "Take a center" << std::endl;
-      return true;
+  // Publishes every game from now on to spectators through a new broadcast
+  // file at path.
+  bool broadcast(const char *path) {
+    int cells = 0;
+    for (const BoardVariant &v : BOARD_VARIANTS) {
+      cells = std::max(cells, v.rules.cells());
     }
-    return false;
+    return d_broadcast.create(path, cells, BROADCAST_CAPACITY);
   }
 
-  bool pickSide(const CellState &p) {
-    // Move on one of the sides.
-    // 0[0,0], 1[1,0], 2[2,0]
-    // 3[0,1], 4[1,1], 5[2,1]
-    // 6[0,2], 7[1,2], 8[2,2]
-    std::vector<int> sides;
-    if (cellState(1, 0) == CELL_EMPTY) {
-      sides.push_back(boardIndex(1, 0));
-    }
-    if (cellState(0, 1) == CELL_EMPTY) {
-      sides.push_back(boardIndex(0, 1));
-    }
-    if (cellState(2, 1) == CELL_EMPTY) {
-      sides.push_back(boardIndex(2, 1));
-    }
-    if (cellState(1, 2) == CELL_EMPTY) {
-      sides.push_back(boardIndex(1, 2));
+  void recordBegin() {
+    if (d_recordWriter) {
+      const int computer = ttt::recordEngine(d_level);
+      const bool computerX = d_computerPlays == CELL_X;
+      d_recordWriter->begin(d_game.rules(), d_game.toMove(),
+                            computerX ? computer : ttt::RECORD_HUMAN,
+                            computerX ? ttt::RECORD_HUMAN : computer, d_seed,
+                            MOVE_SECONDS);
     }
-    if (sides.empty()) {
-      return false;
-    }
-    makeRandomMoveFromList(sides, p);
-    std::cout << "Choose random side" << std::endl;
-    return true;
   }
 
-  void advancedMove(const CellState &p) {
-    // First, check if we computer win in the next move
-    for (int col = 0; col < NUM_COLS; col++) {
-      for (int row = 0; row < NUM_ROWS; row++) {
-        if (cellState(col, row) == CELL_EMPTY) {
-          // make a move
-          setCellState(col, row, p);
-          if (NONE != getWinnerLine(p)) {
-            std::cout << "Make a winning move" << std::endl;
-            return;
-          }
-          // undo a move
-          setCellState(col, row, CELL_EMPTY);
-        }
-      }
+  void makeMove(int idx) {
+    const ttt::Side side = d_game.toMove();
+    if (!d_game.play(idx)) {
+      return;
     }
-
-    // Check if the player could win on their next move, and block them.
-    const CellState z = switchXO(p);
-    for (int col = 0; col < NUM_COLS; col++) {
-      for (int row = 0; row < NUM_ROWS; row++) {
-        if (cellState(col, row) == CELL_EMPTY) {
-          // make a move
-          setCellState(col, row, z);
-          if (NONE != getWinnerLine(z)) {
-            // undo a move
-            setCellState(col, row, CELL_EMPTY);
-            // make a move
-            setCellState(col, row, p);
-            std::cout << "Block a player" << std::endl;
-            return;
-          }
-          // undo a move
-          setCellState(col, row, CELL_EMPTY);
-        }
-      }
+    if (d_recordWriter) {
+      d_recordWriter->move(idx);
     }
-
-    if (!pickCorner(p, false)) {
-      if (!pickCenter(p)) {
-        if (!pickSide(p)) {
-          if (!pickCorner(p, true)) {
-            std::cout << "hmm, is the board full" << std::endl;
-          }
-        }
+    d_broadcast.move(idx, side);
+    if (d_game.finished()) {
+      d_broadcast.end(d_game.outcome());
+      TTT_LOG_INFO("game_end", {"winner", ttt::outcomeName(d_game.outcome())},
+                   {"moves", d_game.board().count()});
+      if (d_recordWriter) {
+        d_recordWriter->end(d_game.outcome());
       }
     }
-
-    return;
   }
 
-  void randomMove(CellState p) {
-    // Make a random move
-    std::vector<int> possibleMoves;
-    for (int col = 0; col < NUM_COLS; col++) {
-      for (int row = 0; row < NUM_ROWS; row++) {
-        if (cellState(col, row) == CELL_EMPTY) {
-          possibleMoves.push_back(boardIndex(col, row));
-        }
-      }
+  // Plays a move of the AI worker: random, solved table on 3x3, search or
+  // MCTS for MOVE_SECONDS.
+  void computerMove(const ttt::AiReply &reply) {
+    const ttt::EngineMove &m = reply.move;
+    makeMove(m.move);
+    d_viewport.reveal(d_game.board().col(m.move), d_game.board().row(m.move));
+    if (m.source == ttt::MOVE_SOLVED) {
+      TTT_LOG_INFO("move", {"cell", m.move}, {"source", "solved"},
+                   {"value", m.score});
+    } else if (m.source == ttt::MOVE_SEARCH) {
+      const ttt::SearchResult &r = reply.search;
+      TTT_LOG_INFO("move", {"cell", r.move}, {"source", "search"},
+                   {"score", r.score}, {"depth", r.depth}, {"nodes", r.nodes},
+                   {"seconds", r.seconds},
+                   {"threads", d_engine.searchThreads()});
+    } else if (m.source == ttt::MOVE_MCTS) {
+      const ttt::MctsResult &r = reply.mcts;
+      TTT_LOG_INFO("move", {"cell", r.move}, {"source", "mcts"},
+                   {"win_rate", r.winRate}, {"playouts", r.playouts},
+                   {"seconds", r.seconds}, {"arena_bytes", r.arenaBytes});
     }
-    const int r = rand() % possibleMoves.size();
-    makeMove(possibleMoves[r], p);
   }
 
-  void setBoardSize(int w, int h) {
-    int cell_width = w / NUM_COLS;
-    int cell_height = h / NUM_ROWS;
-    for (int col = 0; col < NUM_COLS; col++) {
-      for (int row = 0; row < NUM_ROWS; row++) {
-        Cell &cell = d_board[col][row];
+  CellState cellState(int col, int row) {
+    const int idx = boardIndex(col, row);
 
-        cell.resize(col * cell_width, row * cell_height, cell_width,
-                    cell_height);
-      }
+    if (d_game.board().has(idx, ttt::SIDE_X)) {
+      return CELL_X;
+    }
+    if (d_game.board().has(idx, ttt::SIDE_O)) {
+      return CELL_O;
     }
+    return CELL_EMPTY;
   }
 
-  void setCellState(int col, int row, CellState p) {
-    Cell &cell = d_board[col][row];
-
-    cell.state = p;
+  // The cell under the mouse is a division, not a search.
+  bool cellClick(int mx, int my) {
+    int col = 0;
+    int row = 0;
+    if (!d_viewport.cellAt(mx, my, &col, &row)) {
+      return false;
+    }
+    const int idx = boardIndex(col, row);
+    if (!d_game.isLegal(idx)) {
+      return false;
+    }
+    makeMove(idx);
+    return true;
   }
 
-  int cellState(int col, int row) {
-    const Cell &cell = d_board[col][row];
-
-    return cell.state;
+  // Appends a quad with corners p0..p3 (clockwise) to the board batch.
+  void batchQuad(const SDL_FPoint p[4], const AtlasRect &uv,
+                 const SDL_Color &color) {
+    const int base = static_cast<int>(d_vertices.size());
+    const float u[4] = {uv.u0, uv.u1, uv.u1, uv.u0};
+    const float v[4] = {uv.v0, uv.v0, uv.v1, uv.v1};
+    for (int i = 0; i < 4; i++) {
+      SDL_Vertex vertex;
+      vertex.position = p[i];
+      vertex.color = color;
+      vertex.tex_coord.x = u[i];
+      vertex.tex_coord.y = v[i];
+      d_vertices.push_back(vertex);
+    }
+    const int order[6] = {0, 1, 2, 0, 2, 3};
+    for (int i = 0; i < 6; i++) {
+      d_indices.push_back(base + order[i]);
+    }
   }
 
-  bool cellClick(int mx, int my) {
-    for (int col = 0; col < NUM_COLS; col++) {
-      for (int row = 0; row < NUM_ROWS; row++) {
-        Cell &cell = d_board[col][row];
-
-        if (cell.inRange(mx, my)) {
-          if (cell.state == CELL_EMPTY) {
-            cell.state = d_currentPlayer;
-            d_currentPlayer = switchXO(d_currentPlayer);
-            return true;
-          }
-        }
-      }
-    }
-    return false;
+  void batchRect(float x, float y, float w, float h, const AtlasRect &uv,
+                 const SDL_Color &color) {
+    const SDL_FPoint p[4] = {{x, y}, {x + w, y}, {x + w, y + h}, {x, y + h}};
+    batchQuad(p, uv, color);
   }
 
   void cellRender(int col, int row) {
-    const Cell &cell = d_board[col][row];
-
-    SDL_Rect rect;
-
-    rect.x = cell.x + 1;
-    rect.y = cell.y + 1;
-    rect.w = cell.w - 2;
-    rect.h = cell.h - 2;
-
-    ::SDL_SetRenderDrawColor(d_renderer, 32, 32, 32, 255);
-    ::SDL_RenderFillRect(d_renderer, &rect);
-
-    rect.x += 10;
-    rect.y += 10;
-    rect.w -= 20;
-    rect.h -= 20;
-
-    if (cell.state == CELL_O) {
-      ::SDL_RenderCopy(d_renderer, d_RedO_Texture, NULL, &rect);
-    } else if (cell.state == CELL_X) {
-      ::SDL_RenderCopy(d_renderer, d_RedX_Texture, NULL, &rect);
+    const CellState state = cellState(col, row);
+    const int cellWidth = d_viewport.cellWidth();
+
+    float x = d_viewport.cellX(col) + 1;
+    float y = d_viewport.cellY(row) + 1;
+    float w = cellWidth - 2;
+    float h = d_viewport.cellHeight() - 2;
+    const SDL_Color grey = {32, 32, 32, 255};
+    batchRect(x, y, w, h, d_atlasSolid, grey);
+
+    // 10 pixels on the 3x3 board, scaled down for larger ones
+    const int inset = cellWidth / 24;
+    x += inset;
+    y += inset;
+    w -= 2 * inset;
+    h -= 2 * inset;
+
+    const SDL_Color white = {255, 255, 255, 255};
+    if (state == CELL_O) {
+      batchRect(x, y, w, h, d_atlasO, white);
+    } else if (state == CELL_X) {
+      batchRect(x, y, w, h, d_atlasX, white);
     }
   }
 
+  // Three pixel wide line between the centers of both end cells.
+  void winnerLineRender() {
+    const ttt::KBoard &board = d_game.board();
+    const int from = d_game.winnerLine().from;
+    const int to = d_game.winnerLine().to;
+    const int halfWidth = d_viewport.cellWidth() / 2;
+    const int halfHeight = d_viewport.cellHeight() / 2;
+    const float x1 = d_viewport.cellX(board.col(from)) + halfWidth;
+    const float y1 = d_viewport.cellY(board.row(from)) + halfHeight;
+    const float x2 = d_viewport.cellX(board.col(to)) + halfWidth;
+    const float y2 = d_viewport.cellY(board.row(to)) + halfHeight;
+    const float dx = y1 == y2 ? 0 : 1.5f;
+    const float dy = y1 == y2 ? 1.5f : 0;
+    const SDL_FPoint p[4] = {{x1 - dx, y1 - dy},
+                             {x2 - dx, y2 - dy},
+                             {x2 + dx, y2 + dy},
+                             {x1 + dx, y1 + dy}};
+    const SDL_Color blue = {0, 0, 255, 255};
+    batchQuad(p, d_atlasSolid, blue);
+  }
+
+  // Visible cells, pieces and the winner line as one draw call; the cost
+  // follows the window and the zoom, not the board size.
   void boardRender() {
-    for (int col = 0; col < NUM_COLS; col++) {
-      for (int row = 0; row < NUM_ROWS; row++) {
+    d_vertices.clear();
+    d_indices.clear();
+    int col0 = 0;
+    int row0 = 0;
+    int col1 = 0;
+    int row1 = 0;
+    d_viewport.visible(&col0, &row0, &col1, &row1);
+    for (int row = row0; row < row1; row++) {
+      for (int col = col0; col < col1; col++) {
         cellRender(col, row);
       }
     }
+    if (d_game.outcome() == ttt::OUTCOME_X ||
+        d_game.outcome() == ttt::OUTCOME_O) {
+      winnerLineRender();
+    }
+    ::SDL_RenderGeometry(d_renderer, d_atlas, d_vertices.data(),
+                         static_cast<int>(d_vertices.size()),
+                         d_indices.data(),
+                         static_cast<int>(d_indices.size()));
   }
 
   void boardWinnerRender() {
-    const int x_step = d_display_width / 6;
-    const int y_step = d_display_height / 6;
-
-    if (d_gameFinished) {
-      SDL_Rect rect;
-      switch (d_winnerLine) {
-        case NONE:
-          // Draw
-          break;
-        case VERTICAL_LEFT:
-          // draw line
-          ::SDL_SetRenderDrawColor(d_renderer, 0, 0, 255, 255);
-          ::SDL_RenderDrawLine(d_renderer, x_step - 1, y_step, x_step - 1,
-                               y_step * 5);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step, x_step, y_step * 5);
-          ::SDL_RenderDrawLine(d_renderer, x_step + 1, y_step, x_step + 1,
-                               y_step * 5);
-          break;
-        case VERTICAL_MID:
-          // draw line
-          ::SDL_SetRenderDrawColor(d_renderer, 0, 0, 255, 255);
-          ::SDL_RenderDrawLine(d_renderer, x_step * 3 - 1, y_step,
-                               x_step * 3 - 1, y_step * 5);
-          ::SDL_RenderDrawLine(d_renderer, x_step * 3, y_step, x_step * 3,
-                               y_step * 5);
-          ::SDL_RenderDrawLine(d_renderer, x_step * 3 + 1, y_step,
-                               x_step * 3 + 1, y_step * 5);
-          break;
-        case VERTICAL_RIGHT:
-          // draw line
-          ::SDL_SetRenderDrawColor(d_renderer, 0, 0, 255, 255);
-          ::SDL_RenderDrawLine(d_renderer, x_step * 5 - 1, y_step,
-                               x_step * 5 - 1, y_step * 5);
-          ::SDL_RenderDrawLine(d_renderer, x_step * 5, y_step, x_step * 5,
-                               y_step * 5);
-          ::SDL_RenderDrawLine(d_renderer, x_step * 5 + 1, y_step,
-                               x_step * 5 + 1, y_step * 5);
-          break;
-        case HORIZONTAL_TOP:
-          // draw line
-          ::SDL_SetRenderDrawColor(d_renderer, 0, 0, 255, 255);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step - 1, x_step * 5,
-                               y_step - 1);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step, x_step * 5, y_step);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step + 1, x_step * 5,
-                               y_step + 1);
-          break;
-        case HORIZONTAL_MID:
-          // draw line
-          ::SDL_SetRenderDrawColor(d_renderer, 0, 0, 255, 255);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step * 3 - 1, x_step * 5,
-                               y_step * 3 - 1);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step * 3, x_step * 5,
-                               y_step * 3);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step * 3 + 1, x_step * 5,
-                               y_step * 3 + 1);
-          break;
-        case HORIZONTAL_BOTTOM:
-          // draw line
-          ::SDL_SetRenderDrawColor(d_renderer, 0, 0, 255, 255);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step * 5 - 1, x_step * 5,
-                               y_step * 5 - 1);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step * 5, x_step * 5,
-                               y_step * 5);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step * 5 + 1, x_step * 5,
-                               y_step * 5 + 1);
-          break;
-        case DIAGONAL_TOPLEFT:
-          // draw line
-          ::SDL_SetRenderDrawColor(d_renderer, 0, 0, 255, 255);
-          ::SDL_RenderDrawLine(d_renderer, x_step - 1, y_step - 1,
-                               x_step * 5 - 1, y_step * 5 - 1);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step, x_step * 5,
-                               y_step * 5);
-          ::SDL_RenderDrawLine(d_renderer, x_step + 1, y_step + 1,
-                               x_step * 5 + 1, y_step * 5 + 1);
-          break;
-        case DIAGONAL_BOTTOMLEFT:
-          // draw line
-          ::SDL_SetRenderDrawColor(d_renderer, 0, 0, 255, 255);
-          ::SDL_RenderDrawLine(d_renderer, x_step - 1, y_step * 5 - 1,
-                               x_step * 5 - 1, y_step - 1);
-          ::SDL_RenderDrawLine(d_renderer, x_step, y_step * 5, x_step * 5,
-                               y_step);
-          ::SDL_RenderDrawLine(d_renderer, x_step + 1, y_step * 5 + 1,
-                               x_step * 5 + 1, y_step + 1);
-          break;
-      }
-
-      if (d_gameWinner == CELL_X) {
+    if (d_game.finished()) {
+      if (d_game.outcome() == ttt::OUTCOME_X) {
         textColor(255, 255, 255);
         textCentered("X Won", d_display_width / 2, d_display_height / 2);
       }
-      if (d_gameWinner == CELL_O) {
+      if (d_game.outcome() == ttt::OUTCOME_O) {
         textColor(255, 255, 255);
         textCentered("O Won", d_display_width / 2, d_display_height / 2);
       }
-      if (d_gameWinner == CELL_EMPTY) {
+      if (d_game.outcome() == ttt::OUTCOME_DRAW) {
         textColor(255, 255, 255);
         textCentered("Draw", d_display_width / 2, d_display_height / 2);
       }
@@ -642,24 +733,96 @@ class TicTacToe {
       textColor(0, 255, 0, 0);
       textCentered("New Game [n] Quit[q]", d_display_width / 2,
                    d_display_height / 4);
+    } else if (d_thinking) {
+      textColor(0, 255, 255);
+      textCentered("Thinking... [n] [q]", d_display_width / 2,
+                   d_display_height - d_display_height / 8);
     }
   }
 
   void textCentered(const char *text, int x, int y) {
-    SDL_Surface *text_surf =
-        ::TTF_RenderText_Solid(d_ttf_font, text, d_textColor);
-    SDL_Texture *text_text =
-        ::SDL_CreateTextureFromSurface(d_renderer, text_surf);
+    const TextCache::Text t = d_textCache.get(d_renderer, d_ttf_font,
+                                              d_fontSize, text, d_textColor);
+    if (!t.texture) {
+      return;
+    }
 
     SDL_Rect dest;
-    dest.x = x - (text_surf->w / 2.0f);
+    dest.x = x - (t.w / 2.0f);
     dest.y = y;
-    dest.w = text_surf->w;
-    dest.h = text_surf->h;
-    ::SDL_RenderCopy(d_renderer, text_text, NULL, &dest);
+    dest.w = t.w;
+    dest.h = t.h;
+    ::SDL_RenderCopy(d_renderer, t.texture, NULL, &dest);
+  }
 
-    ::SDL_DestroyTexture(text_text);
-    ::SDL_FreeSurface(text_surf);
+#ifdef TTT_FRAME_TIMING
+  // Phase percentiles of the last FrameTiming::WINDOW frames, top left.
+  void hudClear() {
+    for (HudLine &line : d_hudLines) {
+      if (line.texture.texture) {
+        ::SDL_DestroyTexture(line.texture.texture);
+      }
+      line.texture = TextCache::Text();
+    }
+  }
+
+  // Not through a TextCache: the numbers change every refresh, and they
+  // would evict the game's text or allocate cache entries.
+  void hudRender() {
+    if (!d_hudLines[0].texture.texture ||
+        d_frameTiming.frames() % HUD_REFRESH_FRAMES == 0) {
+      hudClear();
+      snprintf(d_hudLines[0].text, sizeof(d_hudLines[0].text),
+               "phase     p50 us  p95 us  p99 us");
+      for (int p = 0; p < ttt::NUM_FRAME_PHASES; p++) {
+        const ttt::FramePhase phase = ttt::FramePhase(p);
+        snprintf(d_hudLines[1 + p].text, sizeof(d_hudLines[1 + p].text),
+                 "%-8s %7.1f %7.1f %7.1f", ttt::framePhaseName(phase),
+                 d_frameTiming.percentile(phase, 50) / 1000.0,
+                 d_frameTiming.percentile(phase, 95) / 1000.0,
+                 d_frameTiming.percentile(phase, 99) / 1000.0);
+      }
+      const SDL_Color yellow = {255, 255, 0, 255};
+      for (HudLine &line : d_hudLines) {
+        SDL_Surface *surf =
+            ::TTF_RenderText_Solid(d_hudFont, line.text, yellow);
+        if (surf) {
+          line.texture.texture =
+              ::SDL_CreateTextureFromSurface(d_renderer, surf);
+          line.texture.w = surf->w;
+          line.texture.h = surf->h;
+          ::SDL_FreeSurface(surf);
+        }
+      }
+    }
+
+    int y = 4;
+    for (const HudLine &line : d_hudLines) {
+      if (line.texture.texture) {
+        SDL_Rect dest = {4, y, line.texture.w, line.texture.h};
+        ::SDL_RenderCopy(d_renderer, line.texture.texture, NULL, &dest);
+        y += line.texture.h;
+      }
+    }
+  }
+
+  // JSON to the console, and natively to frame-timing.json as well; only
+  // on [d], so runs that never ask, such as the benchmarks, write nothing.
+  void frameTimingDump() {
+    d_frameTiming.writeJson(std::cout);
+    std::cout << std::endl;
+#ifndef __EMSCRIPTEN__
+    std::ofstream file("frame-timing.json");
+    d_frameTiming.writeJson(file);
+    file << std::endl;
+#endif
+  }
+#endif
+
+  void textCacheStats(const char *why) {
+    TTT_LOG_INFO("text_cache", {"why", why}, {"hits", d_textCache.hits()},
+                 {"misses", d_textCache.misses()},
+                 {"entries", d_textCache.size()});
   }
 
   void textColor(Uint8 r = 255, Uint8 g = 255, Uint8 b = 255, Uint8 a = 255) {
@@ -691,26 +854,30 @@ class TicTacToe {
     }
 
     textColor(255, 0, 255);
-    if (d_hardLevel) {
-      textCentered("Hard Level [h,e]", x_center, y_row * 4);
+    if (d_level == ttt::LEVEL_HARD) {
+      textCentered("Hard Level [h,e,m]", x_center, y_row * 4);
+    } else if (d_level == ttt::LEVEL_MCTS) {
+      textCentered("MCTS Level [h,e,m]", x_center, y_row * 4);
     } else {
-      textCentered("Easy Level [h,e]", x_center, y_row * 4);
+      textCentered("Easy Level [h,e,m]", x_center, y_row * 4);
     }
 
+    textColor(0, 255, 255);
+    textCentered(BOARD_VARIANTS[d_boardVariant].name, x_center, y_row * 5);
+
     textColor(255, 255, 255);
     textCentered("Press the SpaceBar to Play", x_center, y_row * 7);
   }
 
   void initGame() {
-    d_currentPlayer = d_firstMove;
-
-    for (int col = 0; col < NUM_COLS; col++) {
-      for (int row = 0; row < NUM_ROWS; row++) {
-        Cell &cell = d_board[col][row];
-
-        cell.reset();
-      }
-    }
+    cancelThinking();
+    const ttt::Rules &rules = BOARD_VARIANTS[d_boardVariant].rules;
+    d_game.reset(rules, toSide(d_firstMove));
+    d_viewport.reset(rules.cols, rules.rows, d_display_width,
+                     d_display_height);
+    recordBegin();
+    d_broadcast.end(ttt::OUTCOME_NONE);  // abandoned, if still going
+    d_broadcast.game(rules);
   }
 
   void gameResize() {
@@ -721,9 +888,12 @@ class TicTacToe {
     if (d_display_width != w || d_display_height != h) {
       d_display_width = w;
       d_display_height = h;
-      std::cout << "gameResize" << " width " << d_display_width << " height "
-                << d_display_height << std::endl;
-      setBoardSize(w, h);
+      TTT_LOG_INFO("resize", {"width", d_display_width},
+                   {"height", d_display_height});
+      d_viewport.resize(w, h);
+      textCacheStats("resize");
+      d_textCache.invalidate();
+      d_dirty = true;
     }
   }
 
@@ -741,94 +911,237 @@ class TicTacToe {
       return -1;
     }
 
-    d_renderer = ::SDL_CreateRenderer(d_window, -1, SDL_RENDERER_SOFTWARE);
+    // WebGL / OpenGL with vsync where available, software otherwise
+    d_renderer = ::SDL_CreateRenderer(
+        d_window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    if (d_renderer == 0) {
+      d_renderer = ::SDL_CreateRenderer(d_window, -1, SDL_RENDERER_SOFTWARE);
+    }
     if (d_renderer == 0) {
       return -1;
     }
+    SDL_RendererInfo info;
+    if (0 == ::SDL_GetRendererInfo(d_renderer, &info)) {
+      TTT_LOG_INFO("renderer", {"name", info.name});
+    }
 
+    const Uint64 start = ::SDL_GetPerformanceCounter();
     d_ttf_font = ::TTF_OpenFontRW(
-        ::SDL_RWFromMem(reinterpret_cast<void *>(const_cast<unsigned char *>(
-                            &RobotoMono_Regular_ttf[0])),
-                        sizeof(RobotoMono_Regular_ttf)),
-        1, 36);
-
-    d_RedX_Surface = ::SDL_LoadBMP_RW(
-        ::SDL_RWFromMem(
-            reinterpret_cast<void *>(const_cast<unsigned char *>(&RedX_bmp[0])),
-            sizeof(RedX_bmp)),
-        1);
-    d_RedX_Texture = ::SDL_CreateTextureFromSurface(d_renderer, d_RedX_Surface);
-
-    d_RedO_Surface = ::SDL_LoadBMP_RW(
-        ::SDL_RWFromMem(
-            reinterpret_cast<void *>(const_cast<unsigned char *>(&RedO_bmp[0])),
-            sizeof(RedO_bmp)),
-        1);
-    d_RedO_Texture = ::SDL_CreateTextureFromSurface(d_renderer, d_RedO_Surface);
+        ::SDL_RWFromConstMem(&RobotoMono_Regular_subset_ttf[0],
+                             sizeof(RobotoMono_Regular_subset_ttf)),
+        1, d_fontSize);
+    d_textCache.invalidate();
+#ifdef TTT_FRAME_TIMING
+    d_hudFont = ::TTF_OpenFontRW(
+        ::SDL_RWFromConstMem(&RobotoMono_Regular_subset_ttf[0],
+                             sizeof(RobotoMono_Regular_subset_ttf)),
+        1, HUD_FONT_SIZE);
+#endif
+
+    const int result = createAtlas();
+    TTT_LOG_INFO("assets",
+                 {"bytes", sizeof(RobotoMono_Regular_subset_ttf) +
+                               sizeof(RedX_qoi) + sizeof(RedO_qoi)},
+                 {"decode_ms", (::SDL_GetPerformanceCounter() - start) *
+                                   1000.0 / ::SDL_GetPerformanceFrequency()});
+    return result;
+  }
+
+  // Copies a decoded image into the atlas pixels at column x.
+  static void atlasBlit(const ttt::QoiImage &image, int x, int atlasWidth,
+                        std::vector<unsigned char> *pixels) {
+    for (int row = 0; row < image.height; row++) {
+      std::copy(image.pixels.begin() + row * image.width * 4,
+                image.pixels.begin() + (row + 1) * image.width * 4,
+                pixels->begin() + (row * atlasWidth + x) * 4);
+    }
+  }
+
+  // X and O side by side, then a white block sampled for solid fills,
+  // uploaded straight from the decoded pixels.
+  int createAtlas() {
+    ttt::QoiImage x;
+    ttt::QoiImage o;
+    if (!ttt::qoiDecode(RedX_qoi, sizeof(RedX_qoi), &x) ||
+        !ttt::qoiDecode(RedO_qoi, sizeof(RedO_qoi), &o)) {
+      return -1;
+    }
+    const int SOLID = 4;
+    const int w = x.width + o.width + SOLID;
+    const int h = std::max(std::max(x.height, o.height), SOLID);
+    std::vector<unsigned char> pixels(static_cast<size_t>(w) * h * 4, 0);
+    atlasBlit(x, 0, w, &pixels);
+    atlasBlit(o, x.width, w, &pixels);
+    for (int row = 0; row < SOLID; row++) {
+      std::fill(pixels.begin() + (row * w + w - SOLID) * 4,
+                pixels.begin() + (row * w + w) * 4, 255);
+    }
+
+    d_atlas = ::SDL_CreateTexture(d_renderer, SDL_PIXELFORMAT_RGBA32,
+                                  SDL_TEXTUREACCESS_STATIC, w, h);
+    if (d_atlas == 0) {
+      return -1;
+    }
+    ::SDL_UpdateTexture(d_atlas, NULL, pixels.data(), w * 4);
+    ::SDL_SetTextureBlendMode(d_atlas, SDL_BLENDMODE_BLEND);
+
+    const float fw = static_cast<float>(w);
+    const float fh = static_cast<float>(h);
+    d_atlasX = {0, 0, x.width / fw, x.height / fh};
+    d_atlasO = {x.width / fw, 0, (x.width + o.width) / fw, o.height / fh};
+    // the middle of the block, clear of filtering at its edges
+    d_atlasSolid = {(w - SOLID / 2) / fw, (SOLID / 2) / fh,
+                    (w - SOLID / 2) / fw, (SOLID / 2) / fh};
     return 0;
   }
 
   void finalize() {
-    if (d_RedX_Surface) {
-      ::SDL_FreeSurface(d_RedX_Surface);
-      d_RedX_Surface = 0;
-    }
-    if (d_RedX_Texture) {
-      ::SDL_DestroyTexture(d_RedX_Texture);
-      d_RedX_Texture = 0;
+    if (d_recordWriter) {
+      d_recordWriter->flush();
     }
-    if (d_RedO_Surface) {
-      ::SDL_FreeSurface(d_RedO_Surface);
-      d_RedO_Surface = 0;
+    textCacheStats("final");
+    d_textCache.invalidate();
+#ifdef TTT_FRAME_TIMING
+    hudClear();
+    if (d_hudFont) {
+      ::TTF_CloseFont(d_hudFont);
+      d_hudFont = 0;
     }
-    if (d_RedO_Texture) {
-      ::SDL_DestroyTexture(d_RedO_Texture);
-      d_RedO_Texture = 0;
+#endif
+    if (d_atlas) {
+      ::SDL_DestroyTexture(d_atlas);
+      d_atlas = 0;
     }
     if (d_ttf_font) {
       ::TTF_CloseFont(d_ttf_font);
       d_ttf_font = 0;
     }
+    ttt::logger().drain(std::cout);
+  }
+
+  // Reports allocations since the start of the loop iteration; a steady
+  // state frame, computer moves included, is expected to make none.
+  void frameAllocationCheck() {
+#ifdef TTT_ALLOC_CHECK
+    const uint64_t count = ttt::threadAllocations() - d_frameAllocations;
+    if (count) {
+      TTT_LOG_WARN("frame_allocations", {"count", count});
+    }
+#endif
   }
 
+  // Anything that can change what is on screen marks the frame dirty.
+  int handleEvent(const SDL_Event &event) {
+    switch (event.type) {
+      case SDL_QUIT:
+        return -1;
+      case SDL_KEYDOWN:
+        if (event.key.keysym.sym == SDLK_ESCAPE) {
+          return -1;
+        }
+        keyPressed(event);
+        d_dirty = true;
+        break;
+
+      case SDL_MOUSEBUTTONDOWN:
+        mousePressed(event);
+        d_dirty = true;
+        break;
+
+      case SDL_MOUSEMOTION:
+        if (mouseMoved(event)) {
+          d_dirty = true;
+        }
+        break;
+
+      case SDL_MOUSEWHEEL:
+        if (mouseWheel(event)) {
+          d_dirty = true;
+        }
+        break;
+
+      case SDL_WINDOWEVENT:
+        d_dirty = true;
+        break;
+    }
+    return 0;
+  }
+
+  // Redraws and presents only dirty frames, so an idle splash screen or
+  // finished board costs nothing per animation frame.
   int gameLoop() {
+    SDL_Event event;
+#ifndef __EMSCRIPTEN__
+    // native builds sleep until there is input rather than spin, waking
+    // regularly while the computer thinks to pick up its move
+    if (!d_dirty && (!computerToMove() || d_thinking) &&
+        ::SDL_WaitEventTimeout(&event,
+                               d_thinking ? THINKING_WAIT_MS : IDLE_WAIT_MS)) {
+      if (0 != handleEvent(event)) {
+        return -1;
+      }
+    }
+#endif
+    // log output is formatted here, between frames
+    ttt::logger().drain(std::cout);
+
+#ifdef TTT_ALLOC_CHECK
+    d_frameAllocations = ttt::threadAllocations();
+#endif
+    TTT_FRAME_BEGIN(d_frameTiming);
+    {
+      TTT_FRAME_PHASE(d_frameTiming, PHASE_EVENTS);
+      while (::SDL_PollEvent(&event)) {
+        if (0 != handleEvent(event)) {
+          return -1;
+        }
+      }
+      gameResize();
+    }
+
+    if (d_gameInProgress) {
+      TTT_FRAME_PHASE(d_frameTiming, PHASE_COMPUTER);
+      makeComputerMove();
+    }
+    if (!d_dirty) {
+      // timed too, or the think slices of frames that draw nothing are lost
+      TTT_FRAME_END(d_frameTiming);
+      frameAllocationCheck();
+      return 0;
+    }
+    d_dirty = false;
+
     // Background
     ::SDL_SetRenderDrawColor(d_renderer, 0, 0, 0, 255);
     ::SDL_RenderClear(d_renderer);
 
-    gameResize();
-
     // Draw border
     ::SDL_SetRenderDrawColor(d_renderer, 64, 64, 64, 255);
     ::SDL_RenderDrawRect(d_renderer, NULL);
 
-    SDL_Event event;
-    while (::SDL_PollEvent(&event)) {
-      switch (event.type) {
-        case SDL_QUIT:
-          return -1;
-        case SDL_KEYDOWN:
-          if (event.key.keysym.sym == SDLK_ESCAPE) {
-            return -1;
-          }
-          keyPressed(event);
-          break;
-
-        case SDL_MOUSEBUTTONDOWN:
-          mousePressed(event);
-          break;
-      }
-    }
-
     if (!d_gameInProgress) {
+      TTT_FRAME_PHASE(d_frameTiming, PHASE_OVERLAY);
       splashRender();
     } else {
-      makeComputerMove();
-      boardRender();
+      {
+        TTT_FRAME_PHASE(d_frameTiming, PHASE_BOARD);
+        boardRender();
+      }
+      TTT_FRAME_PHASE(d_frameTiming, PHASE_OVERLAY);
       boardWinnerRender();
     }
+#ifdef TTT_FRAME_TIMING
+    if (d_hudVisible) {
+      hudRender();
+    }
+#endif
 
-    ::SDL_RenderPresent(d_renderer);
+    {
+      TTT_FRAME_PHASE(d_frameTiming, PHASE_PRESENT);
+      ::SDL_RenderPresent(d_renderer);
+    }
+    TTT_FRAME_END(d_frameTiming);
+    frameAllocationCheck();
     return 0;
   }
 };
@@ -843,9 +1156,27 @@ void main_loop(void *user_data) {
 #endif
 }  // namespace
 
+// bench.cpp includes the game for its benchmarks, with a main of its own
+#ifndef TTT_BENCH_GAME
 int main(int argc, char **argv) {
   TicTacToe ticTacToe;
 
+  // --record PATH appends the games played to a record file, --tablebase
+  // PATH reads hard moves from a tic-tac-toe-tablebase file, --broadcast
+  // PATH publishes the games to spectators
+  for (int i = 1; i + 1 < argc; i++) {
+    if (strcmp(argv[i], "--record") == 0 && !ticTacToe.record(argv[i + 1])) {
+      perror(argv[i + 1]);
+    }
+    if (strcmp(argv[i], "--tablebase") == 0 &&
+        !ticTacToe.tablebase(argv[i + 1])) {
+      fprintf(stderr, "%s is not a tablebase\n", argv[i + 1]);
+    }
+    if (strcmp(argv[i], "--broadcast") == 0 &&
+        !ticTacToe.broadcast(argv[i + 1])) {
+      perror(argv[i + 1]);
+    }
+  }
   ticTacToe.initialize();
 
 #ifdef __EMSCRIPTEN__
@@ -857,3 +1188,4 @@ int main(int argc, char **argv) {
   ticTacToe.finalize();
 #endif
 }
+#endif